@@ -873,27 +873,14 @@ TAUL_APP_ERR_TYPE PublisherApplication (PUBLISHER_THREAD_PARAMETER_T *pPublisher
 			vos_printLog(VOS_LOG_ERROR, "Publisher Application Create Dataset Failed. createDataset() Error: %d\n", err);
 		}
 
-		/* Get access right to Traffic Store*/
-		err = tau_ldLockTrafficStore();
+		/* Set PD Data in Traffic Store (per dataset seqlock, no Traffic Store lock) */
+		err = tau_ldWriteTrafficStore(pPublisherThreadParameter->pPublishTelegram->pPdParameter->offset,
+				pPublisherThreadParameter->pPublishTelegram->dataset.pDatasetStartAddr,
+				pPublisherThreadParameter->pPublishTelegram->dataset.size);
 		if (err == TRDP_NO_ERR)
 		{
-			/* Set PD Data in Traffic Store */
-			memcpy((void *)((int)pTrafficStoreAddr + pPublisherThreadParameter->pPublishTelegram->pPdParameter->offset),
-					pPublisherThreadParameter->pPublishTelegram->dataset.pDatasetStartAddr,
-					pPublisherThreadParameter->pPublishTelegram->dataset.size);
 			/* put count up */
 			requestCounter++;
-
-			/* Release access right to Traffic Store*/
-			err = tau_ldUnlockTrafficStore();
-			if (err != TRDP_NO_ERR)
-			{
-				vos_printLog(VOS_LOG_ERROR, "Release Traffic Store accessibility Failed\n");
-			}
-		}
-		else
-		{
-			vos_printLog(VOS_LOG_ERROR, "Get Traffic Store accessibility Failed\n");
 		}
 		/* Waits for a next creation cycle */
 		(void) vos_threadDelay(pPublisherThreadParameter->pPdAppParameter->pdAppCycleTime);
@@ -996,7 +983,6 @@ TAUL_APP_ERR_TYPE createSubscriberThread (
 TAUL_APP_ERR_TYPE SubscriberApplication (SUBSCRIBER_THREAD_PARAMETER_T *pSubscriberThreadParameter)
 {
 	UINT32				subscribeCounter = 0;	/* Counter of Get Dataset in Traffic Store */
-	TRDP_ERR_T			err = TRDP_NO_ERR;
 	APPLICATION_THREAD_HANDLE_T				*pOwnApplicationThreadHandle = NULL;
 
 	/* Display RD Return Test Start Time */
@@ -1029,25 +1015,10 @@ TAUL_APP_ERR_TYPE SubscriberApplication (SUBSCRIBER_THREAD_PARAMETER_T *pSubscri
 			}
 		}
 
-		/* Get access right to Traffic Store*/
-    	err = tau_ldLockTrafficStore();
-    	if (err == TRDP_NO_ERR)
-    	{
-			/* Get Receive PD DataSet from Traffic Store */
-    		memcpy(pSubscriberThreadParameter->pSubscribeTelegram->dataset.pDatasetStartAddr,
-    				(void *)((int)pTrafficStoreAddr + pSubscriberThreadParameter->pSubscribeTelegram->pPdParameter->offset),
-    				pSubscriberThreadParameter->pSubscribeTelegram->dataset.size);
-			/* Release access right to Traffic Store*/
-			err = tau_ldUnlockTrafficStore();
-			if (err != TRDP_NO_ERR)
-			{
-				vos_printLog(VOS_LOG_ERROR, "Release Traffic Store accessibility Failed\n");
-			}
-    	}
-    	else
-    	{
-    		vos_printLog(VOS_LOG_ERROR, "Get Traffic Store accessibility Failed\n");
-    	}
+		/* Get a consistent copy of the Receive PD DataSet from Traffic Store (no Traffic Store lock) */
+		(void) tau_ldReadTrafficStore(pSubscriberThreadParameter->pSubscribeTelegram->pPdParameter->offset,
+				pSubscriberThreadParameter->pSubscribeTelegram->dataset.pDatasetStartAddr,
+				pSubscriberThreadParameter->pSubscribeTelegram->dataset.size);
 
 		/* Waits for a next to Traffic Store put/get cycle */
 		(void) vos_threadDelay(pSubscriberThreadParameter->pPdAppParameter->pdAppCycleTime);
@@ -1204,28 +1175,15 @@ TAUL_APP_ERR_TYPE PdRequesterApplication (PD_REQUESTER_THREAD_PARAMETER_T *pPdRe
 			vos_printLog(VOS_LOG_ERROR, "PD Requester Application Create Dataset Failed. createDataset() Error: %d\n", err);
 		}
 
-		/* Get access right to Traffic Store*/
-    	err = tau_lockTrafficStore();
-    	if (err == TRDP_NO_ERR)
-    	{
-    		/* Set PD Data in Traffic Store */
-			memcpy((void *)((int)pTrafficStoreAddr + pPdRequesterThreadParameter->pPdRequestTelegram->pPdParameter->offset),
-					pPdRequesterThreadParameter->pPdRequestTelegram->dataset.pDatasetStartAddr,
-					pPdRequesterThreadParameter->pPdRequestTelegram->dataset.size);
+		/* Set PD Data in Traffic Store (per dataset seqlock, no Traffic Store lock) */
+		err = tau_ldWriteTrafficStore(pPdRequesterThreadParameter->pPdRequestTelegram->pPdParameter->offset,
+				pPdRequesterThreadParameter->pPdRequestTelegram->dataset.pDatasetStartAddr,
+				pPdRequesterThreadParameter->pPdRequestTelegram->dataset.size);
+		if (err == TRDP_NO_ERR)
+		{
 			/* request count up */
 			requestCounter++;
-
-          	/* Release access right to Traffic Store*/
-    		err = tau_unlockTrafficStore();
-    		if (err != TRDP_NO_ERR)
-    		{
-    			vos_printLog(VOS_LOG_ERROR, "Release Traffic Store accessibility Failed\n");
-    		}
-    	}
-    	else
-    	{
-    		vos_printLog(VOS_LOG_ERROR, "Get Traffic Store accessibility Failed\n");
-    	}
+		}
 
     	/* Waits for a next creation cycle */
 		(void) vos_threadDelay(pPdRequesterThreadParameter->pPdAppParameter->pdAppCycleTime);
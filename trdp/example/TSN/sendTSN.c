@@ -152,6 +152,8 @@ static void usage (const char *appName)
            "-p <priority>  0...7 (default 5)\n"
            "-s <start time> (default 250000 [us], max. 999999)\n"
            "-o <own IP address> (default INADDR_ANY) - source IP for standard TRDP traffic\n"
+           "-a <CPU to pin the data producer to> (default none)\n"
+           "-m lock and prefault memory\n"
            "-d debug output, be more verbose\n"
            "-h print usage\n"
            );
@@ -245,6 +247,9 @@ int main (int argc, char *argv[])
     VOS_TIMEVAL_T           now;
     UINT8                   localExampleData[PD_PAYLOAD_SIZE];
     UINT32                  counter = 0;
+    VOS_RT_PROFILE_T        rtProfile = {0u, FALSE, FALSE, FALSE, FALSE};
+    VOS_CPU_SET_T           dataCpuSet = 0u;
+    UINT32                  cpu;
     int                     ch;
 
     /*    Generate some data, that we want to send */
@@ -257,7 +262,7 @@ int main (int argc, char *argv[])
         return 1;
     }
 
-    while ((ch = getopt(argc, argv, "t:o:s:p:c:dh?v:")) != -1)
+    while ((ch = getopt(argc, argv, "t:o:s:p:c:a:mdh?v:")) != -1)
     {
         switch (ch)
         {
@@ -310,6 +315,20 @@ int main (int argc, char *argv[])
                    exit(1);
                }
                break;
+           case 'a':
+               /* read CPU for the data producer */
+               if ((sscanf(optarg, "%u", &cpu) < 1) || (cpu > 63u))
+               {
+                   usage(argv[0]);
+                   exit(1);
+               }
+               dataCpuSet = (VOS_CPU_SET_T)1u << cpu;
+               break;
+           case 'm':
+               rtProfile.lockMemory     = TRUE;
+               rtProfile.prefaultStack  = TRUE;
+               rtProfile.prefaultHeap   = TRUE;
+               break;
            case 'd':
                gVerbose = TRUE;
                break;
@@ -338,6 +357,12 @@ int main (int argc, char *argv[])
         return 1;
     }
 
+    /*    Page faults during the cycle are avoided by locking and touching everything up front  */
+    if ((rtProfile.lockMemory == TRUE) && (vos_threadSetRtProfile(&rtProfile) != VOS_NO_ERR))
+    {
+        fprintf(stderr, "Memory could not be locked\n");
+    }
+
     /*    Init the library  */
     if (tlc_init(&dbgOut,                               /* logging    */
                  NULL,
@@ -460,6 +485,13 @@ int main (int argc, char *argv[])
                                         0u,    /*  stack size (default 4 x PTHREAD_STACK_MIN)   */
                                         (VOS_THREAD_FUNC_T) dataAppThread, &gAppContext);
 
+    /* Keep the producer on its own CPU, migrations show up as send jitter */
+    if ((err == TRDP_NO_ERR) && (dataCpuSet != 0u) &&
+        (vos_threadSetAffinity(myDataThread, dataCpuSet) != VOS_NO_ERR))
+    {
+        vos_printLogStr(VOS_LOG_USR, "Data Producer could not be pinned\n");
+    }
+
     /*
        Enter the main loop.
      */
@@ -54,6 +54,49 @@
  *   Locals
  */
 
+/**********************************************************************************************************************/
+/** Get the seqlock of a Traffic Store dataset.
+ *
+ *  @param[in]      offset              Traffic Store offset of the dataset
+ *
+ *  @retval         pointer to the version counter, NULL if the Traffic Store is not initialised
+ */
+static UINT32 *tau_seqLockOf (
+    UINT16 offset)
+{
+    if (pTrafficStoreSeqLock == NULL)
+    {
+        return NULL;
+    }
+    return &pTrafficStoreSeqLock[offset >> TRAFFIC_STORE_SEQLOCK_SHIFT];
+}
+
+/**********************************************************************************************************************/
+/** Release the seqlocks a dead writer left odd.
+ *  A writer process terminated between tau_beginWriteTrafficStore() and tau_endWriteTrafficStore() leaves the counter
+ *  of its dataset odd, which blocks all readers and writers of that dataset. Only safe while no other process is
+ *  writing the Traffic Store.
+ */
+static void tau_resetSeqLocks (void)
+{
+    UINT32  i;
+    UINT32  seq;
+
+    if (pTrafficStoreSeqLock == NULL)
+    {
+        return;
+    }
+    for (i = 0u; i < TRAFFIC_STORE_SEQLOCK_COUNT; i++)
+    {
+        seq = __atomic_load_n(&pTrafficStoreSeqLock[i], __ATOMIC_RELAXED);
+        if ((seq & 1u) != 0u)
+        {
+            (void) __atomic_compare_exchange_n(&pTrafficStoreSeqLock[i], &seq, seq + 1u, FALSE,
+                                               __ATOMIC_RELEASE, __ATOMIC_RELAXED);
+        }
+    }
+}
+
 /******************************************************************************
  *   Globals
  */
@@ -68,6 +111,7 @@ mode_t      PERMISSION      = 0666;                          /* Traffic Store pe
 UINT8       *pTrafficStoreAddr;                          /* pointer to pointer to Traffic Store Address */
 VOS_SHRD_T  pTrafficStoreHandle;                        /* Pointer to Traffic Store Handle */
 UINT16      TRAFFIC_STORE_MUTEX_VALUE_AREA = 0xFF00;   /* Traffic Store mutex ID Area */
+UINT32      *pTrafficStoreSeqLock = NULL;              /* Traffic Store seqlock area (behind the Traffic Store) */
 
 /* PDComLadderThread */
 /*
@@ -85,7 +129,7 @@ UINT32  usingSubnetId;                                   /* Using SubnetId */
 /** Initialize TRDP Ladder Support
  *  Create Traffic Store mutex, Traffic Store.
  *
- *    Note:
+ *    Note: Seqlocks left odd by a dead writer are released, so no other process may be writing the Traffic Store.
  *
  *    @retval            TRDP_NO_ERR
  *    @retval            TRDP_MUTEX_ERR
@@ -96,7 +140,8 @@ TRDP_ERR_T tau_ladder_init (void)
     extern CHAR8        TRAFFIC_STORE[];             /* Traffic Store shared memory name */
     extern VOS_SHRD_T   pTrafficStoreHandle;               /* Pointer to Traffic Store Handle */
     extern UINT8        *pTrafficStoreAddr;         /* pointer to pointer to Traffic Store Address */
-    UINT32              trafficStoreSize = TRAFFIC_STORE_SIZE; /* Traffic Store Size : 64KB */
+    UINT32              trafficStoreSize = TRAFFIC_STORE_SIZE + TRAFFIC_STORE_SEQLOCK_SIZE; /* Traffic Store Size :
+                                                                                              64KB + seqlocks */
 
 #if 0
     /* PDComLadderThread */
@@ -170,7 +215,9 @@ TRDP_ERR_T tau_ladder_init (void)
     }
     else
     {
-        pTrafficStoreHandle->sharedMemoryName = TRAFFIC_STORE;
+        pTrafficStoreSeqLock = (UINT32 *)(pTrafficStoreAddr + TRAFFIC_STORE_SIZE);
+        /* a writer of an earlier run may have died within a write */
+        tau_resetSeqLocks();
     }
 
     /* Traffic Store Mutex unlock */
@@ -182,7 +229,7 @@ TRDP_ERR_T tau_ladder_init (void)
     }
 */
     /* Set Traffic Store Semaphore Value */
-    memcpy((void *)((int)pTrafficStoreAddr + TRAFFIC_STORE_MUTEX_VALUE_AREA),
+    memcpy((void *)(pTrafficStoreAddr + TRAFFIC_STORE_MUTEX_VALUE_AREA),
            &pTrafficStoreMutex->mutexId,
            sizeof(pTrafficStoreMutex->mutexId));
 
@@ -223,7 +270,7 @@ TRDP_ERR_T tau_ladder_init (void)
 /** Finalize TRDP Ladder Support
  *  Delete Traffic Store mutex, Traffic Store.
  *
- *    Note:
+ *    Note: Seqlocks left odd by a dead writer are released, so no other process may be writing the Traffic Store.
  *
  *    @retval            TRDP_NO_ERR
  *    @retval            TRDP_MEM_ERR
@@ -236,6 +283,8 @@ TRDP_ERR_T tau_ladder_terminate (void)
 
     /* Delete Traffic Store */
     tau_lockTrafficStore();
+    tau_resetSeqLocks();
+    pTrafficStoreSeqLock = NULL;
     if (vos_sharedClose(pTrafficStoreHandle, pTrafficStoreAddr) != VOS_NO_ERR)
     {
         vos_printLog(VOS_LOG_ERROR, "Release Traffic Store shared memory failed\n");
@@ -362,6 +411,150 @@ TRDP_ERR_T  tau_unlockTrafficStore (
     return TRDP_NO_ERR;
 }
 
+/**********************************************************************************************************************/
+/** Start writing a dataset into the Traffic Store.
+ *  The version counter of the dataset is made odd by compare and swap, so concurrent writers of the same dataset
+ *  (e.g. both subnets) are serialised, while writers of other datasets are not affected.
+ *
+ *  @param[in]      offset              Traffic Store offset of the dataset
+ *
+ *  @retval         TRDP_NO_ERR         no error
+ *  @retval         TRDP_PARAM_ERR      offset out of range
+ *  @retval         TRDP_BLOCK_ERR      dataset kept locked by another writer
+ */
+TRDP_ERR_T  tau_beginWriteTrafficStore (
+    UINT16 offset)
+{
+    UINT32  *pSeq = tau_seqLockOf(offset);
+    UINT32  seq;
+    UINT32  retries;
+
+    if (pSeq == NULL)
+    {
+        return TRDP_PARAM_ERR;
+    }
+
+    for (retries = 0u; retries < TRAFFIC_STORE_SEQLOCK_RETRIES; retries++)
+    {
+        seq = __atomic_load_n(pSeq, __ATOMIC_RELAXED);
+        if (((seq & 1u) == 0u) &&
+            __atomic_compare_exchange_n(pSeq, &seq, seq + 1u, FALSE, __ATOMIC_ACQUIRE, __ATOMIC_RELAXED))
+        {
+            /* counter must be visible before any data is changed */
+            __atomic_thread_fence(__ATOMIC_RELEASE);
+            return TRDP_NO_ERR;
+        }
+        (void) vos_threadDelay(0u);
+    }
+    vos_printLog(VOS_LOG_ERROR, "Traffic Store offset %u kept locked by another writer\n", (unsigned int) offset);
+    return TRDP_BLOCK_ERR;
+}
+
+/**********************************************************************************************************************/
+/** End writing a dataset into the Traffic Store.
+ *
+ *  @param[in]      offset              Traffic Store offset of the dataset
+ *
+ *  @retval         TRDP_NO_ERR         no error
+ *  @retval         TRDP_PARAM_ERR      offset out of range
+ */
+TRDP_ERR_T  tau_endWriteTrafficStore (
+    UINT16 offset)
+{
+    UINT32  *pSeq = tau_seqLockOf(offset);
+    UINT32  seq;
+
+    if (pSeq == NULL)
+    {
+        return TRDP_PARAM_ERR;
+    }
+    /* data must be visible before the counter becomes even again. The next even value is taken instead of adding 1,
+       so the counter cannot stay odd if tau_resetSeqLocks() released it during the write. */
+    seq = __atomic_load_n(pSeq, __ATOMIC_RELAXED);
+    while (!__atomic_compare_exchange_n(pSeq, &seq, (seq | 1u) + 1u, FALSE, __ATOMIC_RELEASE, __ATOMIC_RELAXED))
+    {
+        ;
+    }
+    return TRDP_NO_ERR;
+}
+
+/**********************************************************************************************************************/
+/** Write a dataset into the Traffic Store.
+ *
+ *  @param[in]      offset              Traffic Store offset of the dataset
+ *  @param[in]      pData               pointer to the data to write
+ *  @param[in]      size                size of the dataset
+ *
+ *  @retval         TRDP_NO_ERR         no error
+ *  @retval         TRDP_PARAM_ERR      parameter error
+ *  @retval         TRDP_BLOCK_ERR      dataset kept locked by another writer
+ */
+TRDP_ERR_T  tau_writeTrafficStore (
+    UINT16      offset,
+    const UINT8 *pData,
+    UINT32      size)
+{
+    TRDP_ERR_T err;
+
+    if ((pData == NULL) || (((UINT32) offset + size) > TRAFFIC_STORE_SIZE))
+    {
+        return TRDP_PARAM_ERR;
+    }
+    err = tau_beginWriteTrafficStore(offset);
+    if (err == TRDP_NO_ERR)
+    {
+        memcpy(pTrafficStoreAddr + offset, pData, size);
+        err = tau_endWriteTrafficStore(offset);
+    }
+    return err;
+}
+
+/**********************************************************************************************************************/
+/** Read a consistent copy of a dataset from the Traffic Store without locking.
+ *
+ *  @param[in]      offset              Traffic Store offset of the dataset
+ *  @param[out]     pData               pointer to the buffer to copy to
+ *  @param[in]      size                size of the dataset
+ *
+ *  @retval         TRDP_NO_ERR         no error
+ *  @retval         TRDP_PARAM_ERR      parameter error
+ *  @retval         TRDP_BLOCK_ERR      no consistent copy within TRAFFIC_STORE_SEQLOCK_RETRIES attempts
+ */
+TRDP_ERR_T  tau_readTrafficStore (
+    UINT16  offset,
+    UINT8   *pData,
+    UINT32  size)
+{
+    UINT32  *pSeq = tau_seqLockOf(offset);
+    UINT32  seqBefore;
+    UINT32  retries;
+
+    if ((pSeq == NULL) || (pData == NULL) || (((UINT32) offset + size) > TRAFFIC_STORE_SIZE))
+    {
+        return TRDP_PARAM_ERR;
+    }
+
+    for (retries = 0u; retries < TRAFFIC_STORE_SEQLOCK_RETRIES; retries++)
+    {
+        seqBefore = __atomic_load_n(pSeq, __ATOMIC_ACQUIRE);
+        if ((seqBefore & 1u) == 0u)
+        {
+            memcpy(pData, pTrafficStoreAddr + offset, size);
+            /* the copy must be complete before the counter is checked again */
+            __atomic_thread_fence(__ATOMIC_ACQUIRE);
+            if (__atomic_load_n(pSeq, __ATOMIC_RELAXED) == seqBefore)
+            {
+                return TRDP_NO_ERR;
+            }
+        }
+        else
+        {
+            (void) vos_threadDelay(0u);
+        }
+    }
+    return TRDP_BLOCK_ERR;
+}
+
 /**********************************************************************************************************************/
 /** Check Link up/down
  *
@@ -45,6 +45,16 @@ extern "C" {
 #define SUBNETID_TYPE1      1                   /* SUBNETID Type1 */
 #define SUBNETID_TYPE2      2                   /* SUBNETID Type2 */
 
+/* Traffic Store seqlocks: version counters behind the Traffic Store, one per 16 bytes of Traffic Store.
+   Datasets starting in the same 16 byte block share one counter. */
+#define TRAFFIC_STORE_SEQLOCK_SHIFT     4u
+#define TRAFFIC_STORE_SEQLOCK_COUNT     (TRAFFIC_STORE_SIZE >> TRAFFIC_STORE_SEQLOCK_SHIFT)
+#define TRAFFIC_STORE_SEQLOCK_SIZE      (TRAFFIC_STORE_SEQLOCK_COUNT * sizeof(UINT32))
+#define TRAFFIC_STORE_SEQLOCK_RETRIES   100000u     /* give up after this many attempts (writer died?) */
+/* A writer process dying between tau_beginWriteTrafficStore() and tau_endWriteTrafficStore() leaves the counter of
+   its dataset odd: readers and writers of that dataset fail with TRDP_BLOCK_ERR until tau_ladder_init() or
+   tau_ladder_terminate() of a process releases it. */
+
 /***********************************************************************************************************************
  * GLOBAL VARIABLES
  */
@@ -55,6 +65,7 @@ extern mode_t       PERMISSION;                 /* Traffic Store permission is r
 extern UINT8        *pTrafficStoreAddr;     /* pointer to pointer to Traffic Store Address */
 extern VOS_SHRD_T   pTrafficStoreHandle; /* Pointer to Traffic Store Handle */
 extern UINT16       TRAFFIC_STORE_MUTEX_VALUE_AREA; /* Traffic Store mutex ID Area */
+extern UINT32       *pTrafficStoreSeqLock;      /* Traffic Store seqlock area (behind the Traffic Store) */
 
 /* PDComLadderThread */
 extern CHAR8        pdComLadderThreadName[]; /* Thread name is PDComLadder Thread. */
@@ -133,6 +144,9 @@ TRDP_ERR_T tau_getNetworkContext (
 
 /**********************************************************************************************************************/
 /** Get Traffic Store accessibility.
+ *  Note: The stack's PD receive and publish paths do not take this mutex anymore. Datasets shared with the stack
+ *  must be written with tau_writeTrafficStore() (or tau_beginWriteTrafficStore()) and read with
+ *  tau_readTrafficStore().
  *
  *  @retval         TRDP_NO_ERR			no error
  *  @retval         TRDP_PARAM_ERR		parameter error
@@ -155,6 +169,74 @@ TRDP_ERR_T tau_lockTrafficStore (
 TRDP_ERR_T tau_unlockTrafficStore (
     void);
 
+/**********************************************************************************************************************/
+/** Start writing a dataset into the Traffic Store.
+ *  Acquires the seqlock of the dataset at offset. Writers of different datasets do not contend, writers of the
+ *  same dataset are serialised. Readers are not blocked, they retry until the write has ended.
+ *  Note: The PD receive path does not take the Traffic Store mutex anymore, use tau_readTrafficStore() to get a
+ *  consistent copy of a received dataset.
+ *  Note: If the writer dies before tau_endWriteTrafficStore(), the dataset stays locked until the next
+ *  tau_ladder_init() or tau_ladder_terminate().
+ *
+ *  @param[in]      offset              Traffic Store offset of the dataset
+ *
+ *  @retval         TRDP_NO_ERR         no error
+ *  @retval         TRDP_PARAM_ERR      offset out of range
+ *  @retval         TRDP_BLOCK_ERR      dataset kept locked by another writer
+ */
+
+TRDP_ERR_T tau_beginWriteTrafficStore (
+    UINT16 offset);
+
+/**********************************************************************************************************************/
+/** End writing a dataset into the Traffic Store.
+ *  Publishes the new version of the dataset at offset to the readers.
+ *
+ *  @param[in]      offset              Traffic Store offset of the dataset
+ *
+ *  @retval         TRDP_NO_ERR         no error
+ *  @retval         TRDP_PARAM_ERR      offset out of range
+ */
+
+TRDP_ERR_T tau_endWriteTrafficStore (
+    UINT16 offset);
+
+/**********************************************************************************************************************/
+/** Write a dataset into the Traffic Store.
+ *
+ *  @param[in]      offset              Traffic Store offset of the dataset
+ *  @param[in]      pData               pointer to the data to write
+ *  @param[in]      size                size of the dataset
+ *
+ *  @retval         TRDP_NO_ERR         no error
+ *  @retval         TRDP_PARAM_ERR      parameter error
+ *  @retval         TRDP_BLOCK_ERR      dataset kept locked by another writer
+ */
+
+TRDP_ERR_T tau_writeTrafficStore (
+    UINT16      offset,
+    const UINT8 *pData,
+    UINT32      size);
+
+/**********************************************************************************************************************/
+/** Read a consistent copy of a dataset from the Traffic Store without locking.
+ *  The copy is repeated if a writer changed the dataset meanwhile. Usable from any process attached to the Traffic
+ *  Store.
+ *
+ *  @param[in]      offset              Traffic Store offset of the dataset
+ *  @param[out]     pData               pointer to the buffer to copy to
+ *  @param[in]      size                size of the dataset
+ *
+ *  @retval         TRDP_NO_ERR         no error
+ *  @retval         TRDP_PARAM_ERR      parameter error
+ *  @retval         TRDP_BLOCK_ERR      no consistent copy within TRAFFIC_STORE_SEQLOCK_RETRIES attempts
+ */
+
+TRDP_ERR_T tau_readTrafficStore (
+    UINT16  offset,
+    UINT8   *pData,
+    UINT32  size);
+
 /**********************************************************************************************************************/
 /** Check Link up/down
  *
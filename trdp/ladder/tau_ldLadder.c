@@ -2283,6 +2283,15 @@ TRDP_ERR_T tau_pd_main_proc_init (
         vos_printLog(VOS_LOG_ERROR, "TRDP TAULpdMainThread Create failed. VOS Error: %d\n", vosErr);
         return TRDP_THREAD_ERR;
     }
+    /* Keep TAULpdMainThread on its CPUs, a migration costs more than a whole PD cycle */
+    if (taulConfig.pdMainCpuSet != 0u)
+    {
+        vosErr = vos_threadSetAffinity(taulPdMainThreadHandle, taulConfig.pdMainCpuSet);
+        if (vosErr != VOS_NO_ERR)
+        {
+            vos_printLog(VOS_LOG_WARNING, "TRDP TAULpdMainThread pinning failed. VOS Error: %d\n", vosErr);
+        }
+    }
     return TRDP_NO_ERR;
 }
 
@@ -2504,20 +2513,33 @@ VOS_THREAD_FUNC_T TAULpdMainThread (
                     /* Check comId which Publish our statistics packet */
                     if (iterPD->addr.comId != TRDP_GLOBAL_STATISTICS_COMID)
                     {
-                        /* Update Publish Dataset */
-                        tau_ldLockTrafficStore();
-                        memcpy((void *)ts_buffer,
-                               (UINT8 *)((INT32)pTrafficStoreAddr + *(UINT16 *)(iterPD->pUserRef)),
-                               2048);
-                        tau_ldUnlockTrafficStore();
-                        err = tlp_put(
-                                appHandle,
-                                iterPD,
-                                (UINT8 *)ts_buffer,
-                                iterPD->dataSize);
+                        /* Update Publish Dataset (consistent copy, no Traffic Store lock) */
+                        if (iterPD->dataSize > sizeof(ts_buffer))
+                        {
+                            err = TRDP_PARAM_ERR;
+                        }
+                        else
+                        {
+                            err = tau_readTrafficStore(*(UINT16 *)(iterPD->pUserRef),
+                                                       (UINT8 *)ts_buffer,
+                                                       iterPD->dataSize);
+                        }
                         if (err != TRDP_NO_ERR)
                         {
-                            vos_printLog(VOS_LOG_ERROR, "TAULpdMainThread() Failed. tlp_put() Err: %d\n", err);
+                            /* keep sending the last consistent dataset */
+                            vos_printLog(VOS_LOG_ERROR, "TAULpdMainThread() Failed. tau_readTrafficStore() Err: %d\n", err);
+                        }
+                        else
+                        {
+                            err = tlp_put(
+                                    appHandle,
+                                    iterPD,
+                                    (UINT8 *)ts_buffer,
+                                    iterPD->dataSize);
+                            if (err != TRDP_NO_ERR)
+                            {
+                                vos_printLog(VOS_LOG_ERROR, "TAULpdMainThread() Failed. tlp_put() Err: %d\n", err);
+                            }
                         }
                     }
                 }
@@ -2622,20 +2644,33 @@ VOS_THREAD_FUNC_T TAULpdMainThread (
                         /* Check comId which Publish our statistics packet */
                         if (iterPD->addr.comId != TRDP_GLOBAL_STATISTICS_COMID)
                         {
-                            /* Update Publish Dataset */
-                            tau_ldLockTrafficStore();
-                            memcpy((void *)ts_buffer,
-                                   (UINT8 *)((INT32)pTrafficStoreAddr + *(UINT16 *)(iterPD->pUserRef)),
-                                   2048);
-                            tau_ldUnlockTrafficStore();
-                            err = tlp_put(
-                                    appHandle2,
-                                    iterPD,
-                                    (UINT8 *)ts_buffer,
-                                    iterPD->dataSize);
+                            /* Update Publish Dataset (consistent copy, no Traffic Store lock) */
+                            if (iterPD->dataSize > sizeof(ts_buffer))
+                            {
+                                err = TRDP_PARAM_ERR;
+                            }
+                            else
+                            {
+                                err = tau_readTrafficStore(*(UINT16 *)(iterPD->pUserRef),
+                                                           (UINT8 *)ts_buffer,
+                                                           iterPD->dataSize);
+                            }
                             if (err != TRDP_NO_ERR)
                             {
-                                vos_printLog(VOS_LOG_ERROR, "TAULpdMainThread() Failed. tlp_put() Err: %d\n", err);
+                                /* keep sending the last consistent dataset */
+                                vos_printLog(VOS_LOG_ERROR, "TAULpdMainThread() Failed. tau_readTrafficStore() Err: %d\n", err);
+                            }
+                            else
+                            {
+                                err = tlp_put(
+                                        appHandle2,
+                                        iterPD,
+                                        (UINT8 *)ts_buffer,
+                                        iterPD->dataSize);
+                                if (err != TRDP_NO_ERR)
+                                {
+                                    vos_printLog(VOS_LOG_ERROR, "TAULpdMainThread() Failed. tlp_put() Err: %d\n", err);
+                                }
                             }
                         }
                     }
@@ -2787,6 +2822,15 @@ TRDP_ERR_T tau_ldInit (
     }
 #endif /* ifdef XML_CONFIG_ENABLE */
 
+    /* Real-time profile must be in place before tlc_init() sets up the memory pool */
+    if (pLdConfig->pRtProfile != NULL)
+    {
+        if (vos_threadSetRtProfile(pLdConfig->pRtProfile) != VOS_NO_ERR)
+        {
+            vos_printLog(VOS_LOG_WARNING, "tau_ldInit() real-time profile not (fully) applied\n");
+        }
+    }
+
     /*  Init the TRDP library  */
     err = tlc_init(pPrintDebugString,            /* debug print function */
                    &memoryConfigTAUL);                     /* Use application supplied memory */
@@ -3504,6 +3548,58 @@ TRDP_ERR_T  tau_ldUnlockTrafficStore (
     return err;
 }
 
+/**********************************************************************************************************************/
+/** Write a dataset into the Traffic Store (per dataset seqlock, no Traffic Store mutex).
+ *
+ *  @param[in]      offset              Traffic Store offset of the dataset
+ *  @param[in]      pData               pointer to the data to write
+ *  @param[in]      size                size of the dataset
+ *
+ *  @retval         TRDP_NO_ERR         no error
+ *  @retval         TRDP_PARAM_ERR      parameter error
+ *  @retval         TRDP_BLOCK_ERR      dataset kept locked by another writer
+ */
+TRDP_ERR_T  tau_ldWriteTrafficStore (
+    UINT16      offset,
+    const UINT8 *pData,
+    UINT32      size)
+{
+    TRDP_ERR_T err = TRDP_NO_ERR;
+
+    err = tau_writeTrafficStore(offset, pData, size);
+    if (err != TRDP_NO_ERR)
+    {
+        vos_printLog(VOS_LOG_ERROR, "tau_ldWriteTrafficStore() failed. offset: %u err: %d\n", offset, err);
+    }
+    return err;
+}
+
+/**********************************************************************************************************************/
+/** Read a consistent copy of a dataset from the Traffic Store without locking.
+ *
+ *  @param[in]      offset              Traffic Store offset of the dataset
+ *  @param[out]     pData               pointer to the buffer to copy to
+ *  @param[in]      size                size of the dataset
+ *
+ *  @retval         TRDP_NO_ERR         no error
+ *  @retval         TRDP_PARAM_ERR      parameter error
+ *  @retval         TRDP_BLOCK_ERR      no consistent copy (writer died?)
+ */
+TRDP_ERR_T  tau_ldReadTrafficStore (
+    UINT16  offset,
+    UINT8   *pData,
+    UINT32  size)
+{
+    TRDP_ERR_T err = TRDP_NO_ERR;
+
+    err = tau_readTrafficStore(offset, pData, size);
+    if (err != TRDP_NO_ERR)
+    {
+        vos_printLog(VOS_LOG_ERROR, "tau_ldReadTrafficStore() failed. offset: %u err: %d\n", offset, err);
+    }
+    return err;
+}
+
 /**********************************************************************************************************************/
 /** callback function PD receive
  *
@@ -3580,9 +3676,11 @@ void tau_ldRecvPdDs (
             /* Clear Traffic Store */
             /* Get offset Address */
             offset = (UINT16)pSubscribeTelegram->pPdParameter->offset;
-            tau_ldLockTrafficStore();
-            memset((void *)((INT32)pTrafficStoreAddr + offset), 0, pSubscribeTelegram->dataset.size);
-            tau_ldUnlockTrafficStore();
+            if (tau_beginWriteTrafficStore(offset) == TRDP_NO_ERR)
+            {
+                memset((void *)(pTrafficStoreAddr + offset), 0, pSubscribeTelegram->dataset.size);
+                (void) tau_endWriteTrafficStore(offset);
+            }
 
             /* Set sunbetId for display log */
             if ( subnetId == SUBNET1)
@@ -3609,19 +3707,23 @@ void tau_ldRecvPdDs (
         if ((pSubscribeTelegram->pPdParameter->flags & TRDP_FLAGS_MARSHALL) == TRDP_FLAGS_MARSHALL)
         {
             /* unmarshalling */
-            tau_ldLockTrafficStore();
+            err = tau_beginWriteTrafficStore(offset);
+            if (err != TRDP_NO_ERR)
+            {
+                return;
+            }
             err = tau_unmarshall(
                     &marshallConfig.pRefCon,                                            /* pointer to user context*/
                     pPDInfo->comId,                                                     /* comId */
                     pData,                                                              /* source pointer to received
                                                                                           original message */
-                    (UINT8 *)((INT32)pTrafficStoreAddr + (INT32)offset),                /* destination pointer to a
+                    (UINT8 *)(pTrafficStoreAddr + offset),                              /* destination pointer to a
                                                                                           buffer for the treated message
                                                                                           */
                     &pSubscribeTelegram->dataset.size,                                  /* destination Buffer Size */
                     &pSubscribeTelegram->pDatasetDescriptor);                           /* pointer to pointer of cached
                                                                                           dataset */
-            tau_ldUnlockTrafficStore();
+            (void) tau_endWriteTrafficStore(offset);
             if (err != TRDP_NO_ERR)
             {
                 vos_printLog(VOS_LOG_ERROR, "tau_unmarshall returns error %d\n", err);
@@ -3631,9 +3733,7 @@ void tau_ldRecvPdDs (
         else
         {
             /* Set received PD Data in Traffic Store */
-            tau_ldLockTrafficStore();
-            memcpy((void *)((INT32)pTrafficStoreAddr + offset), pData, dataSize);
-            tau_ldUnlockTrafficStore();
+            (void) tau_writeTrafficStore(offset, pData, dataSize);
         }
     }
 }
@@ -111,7 +111,9 @@ typedef enum
 /** Structure TAUL Config */
 typedef struct
 {
-    TRDP_IP_ADDR_T ownIpAddr;               /**< own IP Address                                         */
+    TRDP_IP_ADDR_T          ownIpAddr;      /**< own IP Address                                         */
+    const VOS_RT_PROFILE_T  *pRtProfile;    /**< real-time profile set before tlc_init(), NULL: none     */
+    VOS_CPU_SET_T           pdMainCpuSet;   /**< CPUs TAULpdMainThread is pinned to, 0: no pinning      */
 } TAU_LD_CONFIG_T;
 
 typedef struct
@@ -671,6 +673,38 @@ TRDP_ERR_T tau_ldLockTrafficStore (
 TRDP_ERR_T tau_ldUnlockTrafficStore (
     void);
 
+/**********************************************************************************************************************/
+/** Write a dataset into the Traffic Store (per dataset seqlock, no Traffic Store mutex).
+ *
+ *  @param[in]		offset				Traffic Store offset of the dataset
+ *  @param[in]		pData				pointer to the data to write
+ *  @param[in]		size				size of the dataset
+ *
+ *  @retval         TRDP_NO_ERR			no error
+ *  @retval         TRDP_PARAM_ERR		parameter error
+ *  @retval         TRDP_BLOCK_ERR		dataset kept locked by another writer
+ */
+TRDP_ERR_T tau_ldWriteTrafficStore (
+    UINT16      offset,
+    const UINT8 *pData,
+    UINT32      size);
+
+/**********************************************************************************************************************/
+/** Read a consistent copy of a dataset from the Traffic Store without locking.
+ *
+ *  @param[in]		offset				Traffic Store offset of the dataset
+ *  @param[out]		pData				pointer to the buffer to copy to
+ *  @param[in]		size				size of the dataset
+ *
+ *  @retval         TRDP_NO_ERR			no error
+ *  @retval         TRDP_PARAM_ERR		parameter error
+ *  @retval         TRDP_BLOCK_ERR		no consistent copy (writer died?)
+ */
+TRDP_ERR_T tau_ldReadTrafficStore (
+    UINT16  offset,
+    UINT8   *pData,
+    UINT32  size);
+
 /**********************************************************************************************************************/
 /** callback function PD receive
  *
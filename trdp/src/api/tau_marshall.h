@@ -20,6 +20,10 @@
  * $Id$
  *
  *
+ *      AG 2026-10-19: tau_unmarshallAlloc(), size of fixed size datasets cached
+ *      AG 2026-10-19: Identity layout classification of datasets, tau_getDatasetLayout()
+ *      AG 2026-10-19: Field accessor views over marshalled data (tau_createView, tau_getU32, ...)
+ *      AG 2026-10-19: tau_getFieldsByComId() added
  *      BL 2015-12-14: Ticket #33: source size check for marshalling
  */
 
@@ -53,6 +57,17 @@ extern "C" {
 
 /** Types for marshalling / unmarshalling    */
 
+/** Layout class of a dataset, determined by tau_initMarshall  */
+typedef enum
+{
+    TAU_LAYOUT_UNKNOWN  = 0,            /**< dataset not known to tau_initMarshall                              */
+    TAU_LAYOUT_MARSHALL = 1,            /**< host and wire layout differ, marshalled element by element         */
+    TAU_LAYOUT_IDENTITY = 2             /**< host layout bit-identical to the wire layout, copied as a whole    */
+} TAU_LAYOUT_T;
+
+/** Field accessor view over marshalled (network order) data, see tau_createView  */
+typedef struct TAU_VIEW TAU_VIEW_T;
+
 /***********************************************************************************************************************
  * PROTOTYPES
  */
@@ -204,6 +219,38 @@ EXT_DECL TRDP_ERR_T tau_unmarshallDs (
     TRDP_DATASET_T  * *ppDSPointer);
 
 
+/**********************************************************************************************************************/
+/**    Unmarshall into a buffer of the needed size, allocated with vos_memAlloc().
+ *  Replaces tau_calcDatasetSizeByComId() followed by tau_unmarshall(): the data is usually walked once only.
+ *
+ *  @param[in]      pRefCon         pointer to user context
+ *  @param[in]      comId           ComId to identify the structure out of a configuration
+ *  @param[in]      pSrc            pointer to received original message
+ *  @param[in]      srcSize         size of the source buffer
+ *  @param[out]     ppDest          pointer to the unmarshalled data, to be freed with vos_memFree()
+ *  @param[out]     pDestSize       size of the unmarshalled data
+ *  @param[in,out]  ppDSPointer     pointer to pointer to cached dataset
+ *                                  set NULL if not used, set content NULL if unknown
+ *
+ *  @retval         TRDP_NO_ERR             no error
+ *  @retval         TRDP_MEM_ERR            out of memory
+ *  @retval         TRDP_PARAM_ERR          Parameter error
+ *  @retval         TRDP_COMID_ERR          comid not existing
+ *  @retval         TRDP_STATE_ERR          Too deep recursion
+ *  @retval         TRDP_MARSHALLING_ERR    dataset/source size mismatch
+ *
+ */
+
+EXT_DECL TRDP_ERR_T tau_unmarshallAlloc (
+    void            *pRefCon,
+    UINT32          comId,
+    UINT8           *pSrc,
+    UINT32          srcSize,
+    UINT8           * *ppDest,
+    UINT32          *pDestSize,
+    TRDP_DATASET_T  * *ppDSPointer);
+
+
 /**********************************************************************************************************************/
 /**    Calculate data set size by given data set id.
  *
@@ -256,6 +303,209 @@ EXT_DECL TRDP_ERR_T tau_calcDatasetSizeByComId (
     TRDP_DATASET_T  * *ppDSPointer);
 
 
+/**********************************************************************************************************************/
+/**    Get the fields of the marshalled dataset of a ComId for change detection (see tlp_setChangeFilter).
+ *
+ *  @param[in]      pRefCon         Pointer to user context
+ *  @param[in]      comId           ComId to identify the structure out of a configuration
+ *  @param[out]     pFields         Pointer to an array of fields
+ *  @param[in,out]  pNoOfFields     in: size of the array, out: number of fields
+ *
+ *  @retval         TRDP_NO_ERR     no error
+ *  @retval         TRDP_PARAM_ERR  Parameter error
+ *  @retval         TRDP_COMID_ERR  comid not existing
+ *
+ */
+
+EXT_DECL TRDP_ERR_T tau_getFieldsByComId (
+    void            *pRefCon,
+    UINT32          comId,
+    TRDP_PD_FIELD_T *pFields,
+    UINT32          *pNoOfFields);
+
+
+/**********************************************************************************************************************/
+/**    Get the layout class of a dataset.
+ *  Datasets of fixed size without padding and without multi-byte types on little endian hosts (resp. without
+ *  TIMEDATE48 on big endian hosts) are marshalled and unmarshalled by a single copy.
+ *
+ *  @param[in]      pRefCon         Pointer to user context
+ *  @param[in]      dsId            Dataset id to identify the structure out of a configuration
+ *  @param[out]     pLayout         layout class
+ *  @param[out]     pWireSize       marshalled size, 0 if it depends on the data; may be NULL
+ *
+ *  @retval         TRDP_NO_ERR     no error
+ *  @retval         TRDP_PARAM_ERR  Parameter error
+ *  @retval         TRDP_COMID_ERR  dataset not existing
+ *
+ */
+
+EXT_DECL TRDP_ERR_T tau_getDatasetLayout (
+    void            *pRefCon,
+    UINT32          dsId,
+    TAU_LAYOUT_T    *pLayout,
+    UINT32          *pWireSize);
+
+
+/**********************************************************************************************************************/
+/*    Field accessor views                                                                                            */
+/**********************************************************************************************************************/
+
+/**********************************************************************************************************************/
+/**    Create a field accessor view for the dataset of a ComId.
+ *  The elements of the dataset are flattened into fields, numbered depth first: nested datasets and fixed arrays of
+ *  nested datasets are resolved, an array of a basic type is one field. A variable sized array of nested datasets is
+ *  one field which cannot be read. The offsets in the marshalled data are computed here, as far as they do not depend
+ *  on the data.
+ *
+ *  @param[in]      pRefCon         Pointer to user context
+ *  @param[in]      comId           ComId to identify the structure out of a configuration
+ *  @param[out]     ppView          Pointer to the view handle
+ *
+ *  @retval         TRDP_NO_ERR     no error
+ *  @retval         TRDP_PARAM_ERR  Parameter error
+ *  @retval         TRDP_COMID_ERR  comid or nested dataset not existing
+ *  @retval         TRDP_MEM_ERR    out of memory
+ *  @retval         TRDP_STATE_ERR  too deep nesting
+ *
+ */
+
+EXT_DECL TRDP_ERR_T tau_createView (
+    void        *pRefCon,
+    UINT32      comId,
+    TAU_VIEW_T  * *ppView);
+
+
+/**********************************************************************************************************************/
+/**    Delete a field accessor view.
+ *
+ *  @param[in]      pView           view handle
+ *
+ *  @retval         TRDP_NO_ERR     no error
+ *  @retval         TRDP_PARAM_ERR  Parameter error
+ *
+ */
+
+EXT_DECL TRDP_ERR_T tau_deleteView (
+    TAU_VIEW_T *pView);
+
+
+/**********************************************************************************************************************/
+/**    Get the field id of an element by its path, e.g. "position.axle[2].speed".
+ *  Path components are the element names of the XML configuration, arrays of nested datasets take an index.
+ *
+ *  @param[in]      pView           view handle
+ *  @param[in]      pPath           path of the element
+ *  @param[out]     pFieldId        field id
+ *
+ *  @retval         TRDP_NO_ERR     no error
+ *  @retval         TRDP_PARAM_ERR  Parameter error, path not found
+ *
+ */
+
+EXT_DECL TRDP_ERR_T tau_getViewField (
+    const TAU_VIEW_T    *pView,
+    const CHAR8         *pPath,
+    UINT32              *pFieldId);
+
+
+/**********************************************************************************************************************/
+/**    Set the marshalled data to read, e.g. pData of a PD callback or a zero-copy received buffer.
+ *  The data is not copied and must stay valid while it is read. The offsets of fields following a variable sized
+ *  array are determined on first access and kept until the next call.
+ *  A view is not thread safe; use one view per thread.
+ *
+ *  @param[in]      pView           view handle
+ *  @param[in]      pData           marshalled data
+ *  @param[in]      dataSize        size of the data
+ *
+ *  @retval         TRDP_NO_ERR     no error
+ *  @retval         TRDP_PARAM_ERR  Parameter error
+ *
+ */
+
+EXT_DECL TRDP_ERR_T tau_setViewData (
+    TAU_VIEW_T  *pView,
+    const UINT8 *pData,
+    UINT32      dataSize);
+
+
+/**********************************************************************************************************************/
+/**    Get the number of items of a field in the current data.
+ *
+ *  @param[in]      pView           view handle
+ *  @param[in]      fieldId         field id
+ *  @param[out]     pNoOfItems      number of items
+ *
+ *  @retval         TRDP_NO_ERR             no error
+ *  @retval         TRDP_PARAM_ERR          Parameter error
+ *  @retval         TRDP_MARSHALLING_ERR    data too short
+ *
+ */
+
+EXT_DECL TRDP_ERR_T tau_getNoOfItems (
+    TAU_VIEW_T  *pView,
+    UINT32      fieldId,
+    UINT32      *pNoOfItems);
+
+
+/**********************************************************************************************************************/
+/**    Read the first item of a field, converted to host order.
+ *  The integer functions accept any basic type of the same size except REAL32/REAL64, the signed and unsigned
+ *  variants differ in the type of the result only.
+ *
+ *  @param[in]      pView           view handle
+ *  @param[in]      fieldId         field id
+ *  @param[out]     pValue          value
+ *
+ *  @retval         TRDP_NO_ERR             no error
+ *  @retval         TRDP_PARAM_ERR          Parameter error, field of other type or without items
+ *  @retval         TRDP_MARSHALLING_ERR    data too short
+ *
+ */
+
+EXT_DECL TRDP_ERR_T tau_getU8 (TAU_VIEW_T *pView, UINT32 fieldId, UINT8 *pValue);
+EXT_DECL TRDP_ERR_T tau_getI8 (TAU_VIEW_T *pView, UINT32 fieldId, INT8 *pValue);
+EXT_DECL TRDP_ERR_T tau_getU16 (TAU_VIEW_T *pView, UINT32 fieldId, UINT16 *pValue);
+EXT_DECL TRDP_ERR_T tau_getI16 (TAU_VIEW_T *pView, UINT32 fieldId, INT16 *pValue);
+EXT_DECL TRDP_ERR_T tau_getU32 (TAU_VIEW_T *pView, UINT32 fieldId, UINT32 *pValue);
+EXT_DECL TRDP_ERR_T tau_getI32 (TAU_VIEW_T *pView, UINT32 fieldId, INT32 *pValue);
+EXT_DECL TRDP_ERR_T tau_getU64 (TAU_VIEW_T *pView, UINT32 fieldId, UINT64 *pValue);
+EXT_DECL TRDP_ERR_T tau_getI64 (TAU_VIEW_T *pView, UINT32 fieldId, INT64 *pValue);
+EXT_DECL TRDP_ERR_T tau_getReal32 (TAU_VIEW_T *pView, UINT32 fieldId, REAL32 *pValue);
+EXT_DECL TRDP_ERR_T tau_getReal64 (TAU_VIEW_T *pView, UINT32 fieldId, REAL64 *pValue);
+
+
+/**********************************************************************************************************************/
+/**    Read items of an array field, converted to host order.
+ *  Type rules as for tau_getU8 etc.
+ *
+ *  @param[in]      pView           view handle
+ *  @param[in]      fieldId         field id
+ *  @param[in]      first           index of the first item to read
+ *  @param[out]     pValues         array of values
+ *  @param[in,out]  pNoOfItems      in: size of the array, out: number of items read
+ *
+ *  @retval         TRDP_NO_ERR             no error
+ *  @retval         TRDP_PARAM_ERR          Parameter error, field of other type, first item not existing
+ *  @retval         TRDP_MARSHALLING_ERR    data too short
+ *
+ */
+
+EXT_DECL TRDP_ERR_T tau_getU8Array (TAU_VIEW_T *pView, UINT32 fieldId, UINT32 first, UINT8 *pValues,
+                                    UINT32 *pNoOfItems);
+EXT_DECL TRDP_ERR_T tau_getU16Array (TAU_VIEW_T *pView, UINT32 fieldId, UINT32 first, UINT16 *pValues,
+                                     UINT32 *pNoOfItems);
+EXT_DECL TRDP_ERR_T tau_getU32Array (TAU_VIEW_T *pView, UINT32 fieldId, UINT32 first, UINT32 *pValues,
+                                     UINT32 *pNoOfItems);
+EXT_DECL TRDP_ERR_T tau_getU64Array (TAU_VIEW_T *pView, UINT32 fieldId, UINT32 first, UINT64 *pValues,
+                                     UINT32 *pNoOfItems);
+EXT_DECL TRDP_ERR_T tau_getReal32Array (TAU_VIEW_T *pView, UINT32 fieldId, UINT32 first, REAL32 *pValues,
+                                        UINT32 *pNoOfItems);
+EXT_DECL TRDP_ERR_T tau_getReal64Array (TAU_VIEW_T *pView, UINT32 fieldId, UINT32 first, REAL64 *pValues,
+                                        UINT32 *pNoOfItems);
+
+
 #ifdef __cplusplus
 }
 #endif
@@ -18,6 +18,19 @@
 * $Id$
 *
 *
+*      AG 2026-10-19: tlc_getThreadStatistics() added
+*      AG 2026-10-19: tlp_setBusyPoll() added
+*      AG 2026-10-19: tlp_enableUring(), tlp_getUringStatistics() added
+*      AG 2026-10-19: tlp_enableXdp(), tlp_getXdpStatistics() added
+*      AG 2026-10-19: tlm_notifyMulti(), tlm_requestMulti() added
+*      AG 2026-10-19: tlm_setAdaptiveRetry(), tlc_getMdPeerStatistics() added
+*      AG 2026-10-19: tlm_setPayloadRef() added
+*      AG 2026-10-19: tlp_setChangeFilter() added
+*      AG 2026-10-19: tlp_setBatchCallback() added
+*      AG 2026-10-19: tlp_enableCallbackPool() added
+*      AG 2026-10-19: tlp_enableComIdFilter() added
+*      AG 2026-10-19: Histogram functions added
+*      AG 2026-10-19: tlp_getPubTxStats() added
 *      BL 2019-11-12: Ticket #288 Added EXT_DECL to reply functions
 *      BL 2019-10-15: Ticket #282 Preset index table size and depth to prevent memory fragmentation
 *      BL 2019-06-17: Ticket #264 Provide service oriented interface
@@ -44,6 +57,7 @@
  */
 
 #include "trdp_types.h"
+#include "vos_thread.h"
 
 #ifdef __cplusplus
 extern "C" {
@@ -179,6 +193,11 @@ EXT_DECL TRDP_ERR_T tlp_unpublish (
     TRDP_APP_SESSION_T  appHandle,
     TRDP_PUB_T          pubHandle);
 
+EXT_DECL TRDP_ERR_T tlp_getPubTxStats (
+    TRDP_APP_SESSION_T  appHandle,
+    TRDP_PUB_T          pubHandle,
+    TRDP_PUB_TX_STATS_T *pStats);
+
 
 EXT_DECL TRDP_ERR_T tlp_put (
     TRDP_APP_SESSION_T  appHandle,
@@ -254,6 +273,51 @@ EXT_DECL TRDP_ERR_T tlp_unsubscribe (
     TRDP_APP_SESSION_T  appHandle,
     TRDP_SUB_T          subHandle);
 
+EXT_DECL TRDP_ERR_T tlp_enableComIdFilter (
+    TRDP_APP_SESSION_T  appHandle,
+    BOOL8               enable);
+
+EXT_DECL TRDP_ERR_T tlp_enableXdp (
+    TRDP_APP_SESSION_T  appHandle,
+    const CHAR8         *pIfName,
+    UINT32              queueId,
+    BOOL8               zeroCopy);
+
+EXT_DECL TRDP_ERR_T tlp_getXdpStatistics (
+    TRDP_APP_SESSION_T      appHandle,
+    TRDP_XDP_STATISTICS_T   *pStatistics);
+
+EXT_DECL TRDP_ERR_T tlp_enableUring (
+    TRDP_APP_SESSION_T  appHandle,
+    UINT32              noOfBuffers);
+
+EXT_DECL TRDP_ERR_T tlp_getUringStatistics (
+    TRDP_APP_SESSION_T      appHandle,
+    TRDP_URING_STATISTICS_T *pStatistics);
+
+EXT_DECL TRDP_ERR_T tlp_setBusyPoll (
+    TRDP_APP_SESSION_T  appHandle,
+    UINT32              spinBudget,
+    UINT32              busyPollTime);
+
+EXT_DECL TRDP_ERR_T tlp_enableCallbackPool (
+    TRDP_APP_SESSION_T      appHandle,
+    UINT32                  noOfThreads,
+    VOS_THREAD_POLICY_T     policy,
+    VOS_THREAD_PRIORITY_T   priority);
+
+EXT_DECL TRDP_ERR_T tlp_setBatchCallback (
+    TRDP_APP_SESSION_T          appHandle,
+    TRDP_PD_BATCH_CALLBACK_T    pfCbFunction,
+    void                        *pRefCon);
+
+EXT_DECL TRDP_ERR_T tlp_setChangeFilter (
+    TRDP_APP_SESSION_T      appHandle,
+    TRDP_SUB_T              subHandle,
+    const TRDP_PD_FIELD_T   *pFields,
+    UINT32                  noOfFields,
+    UINT64                  fieldMask);
+
 
 EXT_DECL TRDP_ERR_T tlp_get (
     TRDP_APP_SESSION_T  appHandle,
@@ -311,6 +375,42 @@ EXT_DECL TRDP_ERR_T tlm_request (
     const TRDP_URI_USER_T   sourceURI,
     const TRDP_URI_USER_T   destURI);
 
+EXT_DECL TRDP_ERR_T tlm_notifyMulti (
+    TRDP_APP_SESSION_T      appHandle,
+    const void              *pUserRef,
+    TRDP_MD_CALLBACK_T      pfCbFunction,
+    UINT32                  comId,
+    UINT32                  etbTopoCnt,
+    UINT32                  opTrnTopoCnt,
+    TRDP_IP_ADDR_T          srcIpAddr,
+    const TRDP_IP_ADDR_T    *pDestIpAddr,
+    UINT32                  noOfDest,
+    TRDP_FLAGS_T            pktFlags,
+    const TRDP_SEND_PARAM_T *pSendParam,
+    const UINT8             *pData,
+    UINT32                  dataSize,
+    const TRDP_URI_USER_T   sourceURI,
+    const TRDP_URI_USER_T   destURI);
+
+EXT_DECL TRDP_ERR_T tlm_requestMulti (
+    TRDP_APP_SESSION_T      appHandle,
+    const void              *pUserRef,
+    TRDP_MD_CALLBACK_T      pfCbFunction,
+    TRDP_UUID_T             *pSessionId,
+    UINT32                  comId,
+    UINT32                  etbTopoCnt,
+    UINT32                  opTrnTopoCnt,
+    TRDP_IP_ADDR_T          srcIpAddr,
+    const TRDP_IP_ADDR_T    *pDestIpAddr,
+    UINT32                  noOfDest,
+    TRDP_FLAGS_T            pktFlags,
+    UINT32                  replyTimeout,
+    const TRDP_SEND_PARAM_T *pSendParam,
+    const UINT8             *pData,
+    UINT32                  dataSize,
+    const TRDP_URI_USER_T   sourceURI,
+    const TRDP_URI_USER_T   destURI);
+
 
 EXT_DECL TRDP_ERR_T tlm_confirm (
     TRDP_APP_SESSION_T      appHandle,
@@ -373,6 +473,18 @@ EXT_DECL TRDP_ERR_T tlm_replyQuery (
     const UINT8             *pData,
     UINT32                  dataSize );
 
+EXT_DECL TRDP_ERR_T tlm_setPayloadRef (
+    TRDP_APP_SESSION_T  appHandle,
+    UINT32              minSize,
+    UINT32              zeroCopySize,
+    TRDP_MD_RELEASE_T   pfRelease,
+    void                *pRefCon);
+
+EXT_DECL TRDP_ERR_T tlm_setAdaptiveRetry (
+    TRDP_APP_SESSION_T  appHandle,
+    BOOL8               enable,
+    UINT32              minTimeout);
+
 #endif /* MD_SUPPORT    */
 
 EXT_DECL const CHAR8 *tlc_getVersionString (
@@ -384,6 +496,10 @@ EXT_DECL TRDP_ERR_T tlc_getStatistics (
     TRDP_APP_SESSION_T  appHandle,
     TRDP_STATISTICS_T   *pStatistics);
 
+EXT_DECL TRDP_ERR_T tlc_getThreadStatistics (
+    TRDP_APP_SESSION_T          appHandle,
+    TRDP_THREAD_STATISTICS_T    *pStatistics);
+
 EXT_DECL TRDP_ERR_T tlc_getSubsStatistics (
     TRDP_APP_SESSION_T      appHandle,
     UINT16                  *pNumSubs,
@@ -406,6 +522,11 @@ EXT_DECL TRDP_ERR_T tlc_getTcpListStatistics (
     UINT16                  *pNumList,
     TRDP_LIST_STATISTICS_T  *pStatistics);
 
+EXT_DECL TRDP_ERR_T tlc_getMdPeerStatistics (
+    TRDP_APP_SESSION_T          appHandle,
+    UINT16                      *pNumPeer,
+    TRDP_MD_PEER_STATISTICS_T   *pStatistics);
+
 #endif /* MD_SUPPORT    */
 
 EXT_DECL TRDP_ERR_T tlc_getRedStatistics (
@@ -421,6 +542,24 @@ EXT_DECL TRDP_ERR_T tlc_getJoinStatistics (
 EXT_DECL TRDP_ERR_T tlc_resetStatistics (
     TRDP_APP_SESSION_T appHandle);
 
+EXT_DECL TRDP_ERR_T tlc_enableHistograms (
+    TRDP_APP_SESSION_T  appHandle,
+    BOOL8               enable);
+
+EXT_DECL TRDP_ERR_T tlc_getPubHistograms (
+    TRDP_APP_SESSION_T      appHandle,
+    TRDP_PUB_T              pubHandle,
+    TRDP_PD_HISTOGRAMS_T    *pHistograms);
+
+EXT_DECL TRDP_ERR_T tlc_getSubHistograms (
+    TRDP_APP_SESSION_T      appHandle,
+    TRDP_SUB_T              subHandle,
+    TRDP_PD_HISTOGRAMS_T    *pHistograms);
+
+EXT_DECL UINT32 tlc_getHistoPercentile (
+    const TRDP_HISTOGRAM_T  *pHisto,
+    UINT32                  permille);
+
 #ifdef __cplusplus
 }
 #endif
@@ -15,6 +15,23 @@
  *          Copyright Bombardier Transportation Inc. or its subsidiaries and others, 2015-2019. All rights reserved.
  */
 /*
+ *      AG 2026-10-19: TRDP_PUB_TX_STATS_T.numStampsLost
+ *      AG 2026-10-19: TRDP_PD_BATCH_CALLBACK_T: entries unsubscribed by the callback are cleared
+ *      AG 2026-10-19: txTime requires an ETF qdisc, documented
+ *      AG 2026-10-19: Layout of the statistics reply documented at TRDP_STATISTICS_T, thread statistics sent last
+ *      AG 2026-10-19: TRDP_THREAD_STATISTICS_T no longer part of TRDP_STATISTICS_T
+ *      AG 2026-10-19: TRDP_THREAD_STATISTICS_T appended to TRDP_STATISTICS_T
+ *      AG 2026-10-19: TRDP_URING_STATISTICS_T
+ *      AG 2026-10-19: TRDP_XDP_STATISTICS_T
+ *      AG 2026-10-19: TRDP_MD_PEER_STATISTICS_T: round trip time estimation per MD peer
+ *      AG 2026-10-19: TRDP_MD_RELEASE_T: release of MD payloads sent by reference
+ *      AG 2026-10-19: TRDP_DATASET_T.reserved1 used by tau_initMarshall
+ *      AG 2026-10-19: TRDP_PD_FIELD_T, TRDP_PD_INFO_T.changeMask: field level change detection
+ *      AG 2026-10-19: TRDP_PD_BATCH_ENTRY_T, TRDP_PD_BATCH_CALLBACK_T: one callback per receive pass
+ *      AG 2026-10-19: TRDP_PD_INFO_T / TRDP_MD_INFO_T: arrival time of the received packet
+ *      AG 2026-10-19: Latency and jitter histograms per telegram
+ *      AG 2026-10-19: TRDP_SEND_PARAM_T.txTime, TRDP_PUB_TX_STATS_T for launch time scheduling
+ *      AG 2026-10-19: TRDP_IDX_TABLE_T: configurable base tick and number of send categories
  *      BL 2019-10-15: Ticket #282 Preset index table size and depth to prevent memory fragmentation
  *      BL 2019-08-23: Option flag added to detect default process config (needed for HL + cyclic thread)
  *      BL 2019-06-17: Ticket #264 Provide service oriented interface
@@ -256,8 +273,27 @@ typedef struct
     TRDP_URI_HOST_T     destHostURI;    /**< destination URI host part (unused)                         */
     TRDP_TO_BEHAVIOR_T  toBehavior;     /**< callback can decide about handling of data on timeout      */
     UINT32              serviceId;      /**< the reserved field of the PD header                        */
+    TRDP_TIME_T         rxTime;         /**< arrival time of the packet (kernel timestamp if available,
+                                             time base of vos_getTime)                                  */
+    UINT64              changeMask;     /**< changed dataset fields (bit n: field n of the change filter,
+                                             all bits set without filter), 0 if the data is unchanged   */
 } TRDP_PD_INFO_T;
 
+/** Maximum number of fields of a change filter, one bit of TRDP_PD_INFO_T.changeMask each   */
+#define TRDP_PD_MAX_FIELDS  64u
+
+/** TRDP_PD_INFO_T.changeMask: all fields changed  */
+#define TRDP_PD_ALL_FIELDS  (~(UINT64) 0u)
+
+/** Field of a received dataset for change detection (see tlp_setChangeFilter, tau_getFieldsByComId)  */
+typedef struct
+{
+    UINT32              offset;         /**< offset of the field in the received (marshalled) data      */
+    UINT32              size;           /**< size of the field in bytes, 0: up to the end of the data   */
+    UINT32              type;           /**< data type (TRDP_DATA_TYPE_T) of a single item, else 0      */
+    REAL64              deadband;       /**< numeric item only: report changes beyond this value only   */
+} TRDP_PD_FIELD_T;
+
 
 /**    UUID definition reuses the VOS definition.
  */
@@ -294,6 +330,8 @@ typedef struct
     UINT32              numReplies;         /**< actual number of replies for the request   */
     const void          *pUserRef;          /**< User reference given with the local call   */
     TRDP_ERR_T          resultCode;         /**< error code                                 */
+    TRDP_TIME_T         rxTime;             /**< arrival time of the packet (kernel timestamp
+                                                 if available, time base of vos_getTime)    */
 } TRDP_MD_INFO_T;
 
 
@@ -305,8 +343,50 @@ typedef struct
     UINT8   retries;    /**< MD Retries from XML file                                                           */
     BOOL8   tsn;        /**< if TRUE, do not schedule packet but use TSN socket                                 */
     UINT16  vlan;       /**< VLAN Id to be used                                                                 */
+    BOOL8   txTime;     /**< PD only: hand packets to the kernel ahead of time with a launch time (SO_TXTIME)
+                             and collect TX timestamps, if supported by the target.
+                             Requires an ETF qdisc on the egress interface, otherwise the kernel sends the
+                             packets at once, a cycle early. The qdisc is not queried: the stack checks the
+                             first TX timestamps and falls back to sending at the due time if the launch
+                             times are not honoured (or cannot be verified)                                     */
 } TRDP_COM_PARAM_T, TRDP_SEND_PARAM_T;
 
+/**    Transmit timing statistics of a publisher (requires TRDP_SEND_PARAM_T.txTime)   */
+typedef struct
+{
+    UINT32  numStamps;          /**< number of TX timestamps received                                           */
+    INT32   minDeviation;       /**< min. deviation of the stamped interval from the cycle time in us           */
+    INT32   maxDeviation;       /**< max. deviation of the stamped interval from the cycle time in us           */
+    UINT32  avgDeviation;       /**< mean absolute deviation of the stamped interval in us                      */
+    INT32   maxLaunchDelay;     /**< max. difference between TX timestamp and requested launch time in us       */
+    UINT32  numStampsLost;      /**< number of sent packets without TX timestamp (dropped by the kernel, stamp
+                                     not back before 64 more packets were sent on the socket, or keys unknown)     */
+} TRDP_PUB_TX_STATS_T;
+
+/**    Statistics of the AF_XDP socket of a session (tlp_enableXdp)   */
+typedef struct
+{
+    UINT32  numRx;              /**< frames received via AF_XDP                                                 */
+    UINT32  numTx;              /**< frames sent via AF_XDP                                                     */
+    UINT32  numRxInvalid;       /**< frames received which were no UDP datagrams                                */
+    UINT32  numTxNoFrame;       /**< sent with the socket instead, AF_XDP TX ring full                          */
+    UINT32  numTxNoNeigh;       /**< sent with the socket instead, destination MAC address unknown              */
+    BOOL8   zeroCopy;           /**< zero copy mode, else the kernel copies the frames                          */
+    BOOL8   nativeXdp;          /**< XDP program runs in the driver, else generic (skb) mode                    */
+} TRDP_XDP_STATISTICS_T;
+
+/**    Statistics of the io_uring of a session (tlp_enableUring)   */
+typedef struct
+{
+    UINT32  numRx;              /**< datagrams received via io_uring                                            */
+    UINT32  numRxInvalid;       /**< datagrams too large for the receive buffers                                */
+    UINT32  numTx;              /**< datagrams sent via io_uring                                                */
+    UINT32  numTxErr;           /**< sends failed                                                               */
+    UINT32  numArmed;           /**< multishot receives armed (once per socket, again after numNoBuf)           */
+    UINT32  numNoBuf;           /**< multishot receives ended because all receive buffers were in use           */
+    UINT32  numEnter;           /**< system calls to the io_uring (io_uring_enter)                              */
+} TRDP_URING_STATISTICS_T;
+
 
 /**********************************************************************************************************************/
 /**                          TRDP dataset description definitions.                                                    */
@@ -358,7 +438,7 @@ typedef struct
 typedef struct TRDP_DATASET
 {
     UINT32                  id;         /**< dataset identifier > 1000                                  */
-    UINT16                  reserved1;  /**< Reserved for future use, must be zero                      */
+    UINT16                  reserved1;  /**< Reserved, must be zero, used internally by tau_initMarshall */
     UINT16                  numElement; /**< Number of elements                                         */
     TRDP_DATASET_ELEMENT_T  pElement[]; /**< Pointer to a dataset element, used as array                */
 } TRDP_DATASET_T;
@@ -452,7 +532,32 @@ typedef struct
 } GNU_PACKED TRDP_MD_STATISTICS_T;
 
 
-/** Structure containing all general memory, PD and MD statistics information. */
+/** Structure containing the timing statistics of the cyclic threads of the process (all times in us).
+    Process wide, not cleared by tlc_resetStatistics() but by vos_threadResetStatistics().
+    Returned by tlc_getThreadStatistics() and sent at the end of the global statistics reply,
+    see TRDP_STATISTICS_T. */
+typedef struct
+{
+    UINT32  numThreads;            /**< number of cyclic threads */
+    UINT32  numCycles;             /**< number of executed cycles */
+    UINT32  numMissed;             /**< number of periods skipped because a cycle ran too long */
+    UINT32  maxWakeupLatency;      /**< longest delay between deadline and wakeup */
+    UINT32  avgWakeupLatency;      /**< average delay between deadline and wakeup */
+    UINT32  maxExecTime;           /**< longest execution time of a cycle */
+    UINT32  avgExecTime;           /**< average execution time of a cycle */
+} GNU_PACKED TRDP_THREAD_STATISTICS_T;
+
+
+/** Structure containing all general memory, PD and MD statistics information.
+ *
+ *  Layout of the global statistics reply (all values in network byte order):
+ *  - TRDP_STATISTICS_T
+ *  - UINT32 count of histogram summaries, 0 if histograms are disabled
+ *  - count entries of TRDP_HISTO_SUMMARY_T
+ *  - TRDP_THREAD_STATISTICS_T
+ *
+ *  Readers of earlier versions stop after TRDP_STATISTICS_T and ignore the rest.
+ */
 typedef struct
 {
     UINT32                  version;      /**< TRDP version  */
@@ -522,10 +627,67 @@ typedef struct
     UINT32  state;             /**< Redundant state.Leader or Follower */
 } GNU_PACKED TRDP_RED_STATISTICS_T;
 
+/** Round trip time estimation of an MD peer, measured from UDP request to reply. All times in us. */
+typedef struct
+{
+    TRDP_IP_ADDR_T  ipAddr;             /**< IP address of the replier                                      */
+    UINT32          srtt;               /**< Smoothed round trip time                                       */
+    UINT32          rttVar;             /**< Round trip time variation                                      */
+    UINT32          lastRtt;            /**< Last measured round trip time                                  */
+    UINT32          retryTimeout;       /**< Current adaptive retry timeout (0 if adaptive retries are off) */
+    UINT32          numSamples;         /**< Number of round trip time samples                              */
+    UINT32          numRetries;         /**< Number of retransmitted requests                               */
+    UINT32          numReplyTimeout;    /**< Number of requests without reply                               */
+} GNU_PACKED TRDP_MD_PEER_STATISTICS_T;
+
+/** Histogram summary of a telegram, appended to the global statistics reply if histograms are enabled.
+    See TRDP_STATISTICS_T for the layout of the reply. All times in us. */
+typedef struct
+{
+    UINT32  comId;              /**< ComId of the telegram                                                  */
+    UINT32  type;               /**< 0 = subscription (inter-arrival time), 1 = publisher (send interval)   */
+    UINT32  count;              /**< Number of recorded intervals                                           */
+    UINT32  min;                /**< Shortest interval                                                      */
+    UINT32  max;                /**< Longest interval                                                       */
+    UINT32  mean;               /**< Average interval                                                       */
+    UINT32  p50;                /**< Median interval                                                        */
+    UINT32  p99;                /**< 99th percentile of the interval                                        */
+    UINT32  p999;               /**< 99.9th percentile of the interval                                      */
+    UINT32  cbExecP99;          /**< 99th percentile of the callback execution time                         */
+    UINT32  cbExecMax;          /**< Longest callback execution time                                        */
+    UINT32  cbLatencyP99;       /**< 99th percentile of receive-to-callback latency (subscriptions only)    */
+    UINT32  cbLatencyMax;       /**< Longest receive-to-callback latency (subscriptions only)               */
+} GNU_PACKED TRDP_HISTO_SUMMARY_T;
+
 #if (defined (WIN32) || defined (WIN64))
 #pragma pack(pop)
 #endif
 
+/** Log-linear histogram (HDR style): values below TRDP_HISTO_SUB_BUCKETS are counted exactly, above that
+    each power of two is split into TRDP_HISTO_SUB_BUCKETS linear buckets. Values in us.
+    Bucket i (magnitude m = i / TRDP_HISTO_SUB_BUCKETS, sub bucket s = i % TRDP_HISTO_SUB_BUCKETS) starts at
+    s for m == 0, else at (TRDP_HISTO_SUB_BUCKETS + s) << (m - 1).  */
+#define TRDP_HISTO_SUB_BUCKETS  4u      /**< linear buckets per power of two (max. error 25%)       */
+#define TRDP_HISTO_MAGNITUDES   24u     /**< covers 0us ... 33s, larger values go to the last bucket */
+#define TRDP_HISTO_BUCKETS      (TRDP_HISTO_SUB_BUCKETS * TRDP_HISTO_MAGNITUDES)
+
+typedef struct
+{
+    UINT32  count;                          /**< number of values                                   */
+    UINT32  min;                            /**< smallest value                                     */
+    UINT32  max;                            /**< largest value                                      */
+    UINT64  sum;                            /**< sum of all values                                  */
+    UINT32  bucket[TRDP_HISTO_BUCKETS];     /**< value counts                                       */
+} TRDP_HISTOGRAM_T;
+
+/** Timing distributions of a published or subscribed telegram */
+typedef struct
+{
+    TRDP_HISTOGRAM_T    interval;           /**< subscription: inter-arrival time, publisher: send interval */
+    TRDP_HISTOGRAM_T    cbExec;             /**< execution time of the (pre-send) callback                  */
+    TRDP_HISTOGRAM_T    cbLatency;          /**< subscription: time from reception to callback              */
+} TRDP_PD_HISTOGRAMS_T;
+
 
 typedef struct TRDP_SESSION *TRDP_APP_SESSION_T;
 typedef struct PD_ELE *TRDP_PUB_T;
@@ -636,6 +798,32 @@ typedef void (*TRDP_PD_CALLBACK_T)(
     UINT8                   *pData,
     UINT32                  dataSize);
 
+/**********************************************************************************************************************/
+/** A telegram updated or timed out during a receive pass    */
+typedef struct
+{
+    TRDP_SUB_T              subHandle;          /**< the subscription                                       */
+    TRDP_PD_INFO_T          info;               /**< message information as passed to TRDP_PD_CALLBACK_T    */
+    UINT8                   *pData;             /**< received data, NULL if there is none                   */
+    UINT32                  dataSize;           /**< size of the received data                              */
+} TRDP_PD_BATCH_ENTRY_T;
+
+/**********************************************************************************************************************/
+/**    Callback at the end of a receive pass for all telegrams updated or timed out during that pass.
+ *  If the callback unsubscribes a telegram, the stack clears its entry (subHandle and pData NULL, dataSize 0).
+ *  Entries with subHandle == NULL must be skipped.
+ *
+ *  @param[in]    pRefCon       pointer to user context
+ *  @param[in]    appHandle     application handle returned by tlc_openSession
+ *  @param[in]    pEntries      one entry per telegram, the newest if it was received more than once
+ *  @param[in]    noOfEntries   number of entries
+ */
+typedef void (*TRDP_PD_BATCH_CALLBACK_T)(
+    void                        *pRefCon,
+    TRDP_APP_SESSION_T          appHandle,
+    const TRDP_PD_BATCH_ENTRY_T *pEntries,
+    UINT32                      noOfEntries);
+
 
 /**********************************************************************************************************************/
 /** Default PD configuration    */
@@ -667,6 +855,19 @@ typedef void (*TRDP_MD_CALLBACK_T)(
     UINT8                   *pData,
     UINT32                  dataSize);
 
+/**********************************************************************************************************************/
+/**    Callback releasing a payload sent by reference (see tlm_setPayloadRef).
+ *     Called from tlc_process/tlm_process or tlc_closeSession, once the stack and the kernel no longer access the data.
+ *
+ *  @param[in]    pRefCon       pointer to user context
+ *  @param[in]    pData         payload passed to tlm_notify/tlm_reply
+ *  @param[in]    dataSize      size of the payload
+ */
+typedef void (*TRDP_MD_RELEASE_T)(
+    void                    *pRefCon,
+    const UINT8             *pData,
+    UINT32                  dataSize);
+
 
 /**********************************************************************************************************************/
 /** Default MD configuration
@@ -752,6 +953,10 @@ typedef struct
     UINT32  maxNoOfHighCatPublishers;           /**< Max. number of expected publishers with intervals <= 10000ms   */
     UINT32  maxDepthOfHighCatPublishers;        /**< depth / overlapped publishers with intervals <= 10000ms        */
     UINT32  maxNoOfExtPublishers;               /**< Max. number of expected publishers with intervals > 10000ms    */
+    UINT32  baseCycle;                          /**< Slot cycle of the fastest category in us (100...10000),
+                                                     0 = default (1000us)                                           */
+    UINT32  noOfCategories;                     /**< Number of time slot categories (1...5), each one 10 times
+                                                     slower than the previous one, 0 = default (3)                  */
 } TRDP_IDX_TABLE_T;
 
 
@@ -17,6 +17,10 @@
  /*
  * $Id$
  *
+ *      AG 2026-10-19: Sizes of fixed size datasets cached by tau_initMarshall, tau_unmarshallAlloc()
+ *      AG 2026-10-19: Datasets with identical host and wire layout are copied as a whole
+ *      AG 2026-10-19: Field accessor views: read single fields of marshalled data without unmarshalling
+ *      AG 2026-10-19: tau_getFieldsByComId(): field layout of the marshalled dataset for change detection
  *      SB 2019-08-15: Compiler warning (pointer compared to integer)
  *      SB 2019-08-14: Ticket #265: Incorrect alignment in nested datasets
  *      SB 2019-05-24: Ticket #252 Bug in unmarshalling/marshalling of TIMEDATE48 and TIMEDATE64
@@ -49,6 +53,12 @@
 
 #include "tau_marshall.h"
 
+/***********************************************************************************************************************
+ * DEFINES
+ */
+
+#define TAU_VIEW_NO_FIELD   0xFFFFFFFFu     /**< no field holding the size of a variable sized array   */
+
 /***********************************************************************************************************************
  * TYPEDEFS
  */
@@ -80,6 +90,46 @@ typedef struct
     TIMEDATE64 a;
 } TIMEDATE64_STRUCT_T;
 
+/** Information on a dataset, determined by tau_initMarshall  */
+typedef struct
+{
+    UINT32          wireSize;       /**< marshalled size, 0 if it depends on the data               */
+    UINT32          hostSize;       /**< size of the host struct, 0 if it depends on the data       */
+    TAU_LAYOUT_T    layout;         /**< layout class                                               */
+} TAU_DS_INFO_T;
+
+/** Field of a view: an element of a basic type or a variable sized array of nested datasets   */
+typedef struct
+{
+    UINT32          type;           /**< basic type or dataset id                                   */
+    UINT32          noOfItems;      /**< number of items or TRDP_VAR_SIZE                           */
+    UINT32          itemSize;       /**< marshalled size of one item, 0 if it depends on the data   */
+    UINT32          varField;       /**< field holding the number of items if TRDP_VAR_SIZE         */
+    TRDP_DATASET_T  *pDataset;      /**< nested dataset, NULL for basic types                       */
+} TAU_VIEW_FIELD_T;
+
+/** Field accessor view  */
+struct TAU_VIEW
+{
+    TRDP_DATASET_T      *pDataset;      /**< dataset of the view                                    */
+    UINT32              noOfFields;     /**< number of fields                                       */
+    UINT32              noOfFixed;      /**< fields with an offset not depending on the data        */
+    const UINT8         *pData;         /**< current marshalled data                                */
+    UINT32              dataSize;       /**< size of the current data                               */
+    UINT32              noOfResolved;   /**< fields with a known offset in the current data         */
+    UINT32              *pOffset;       /**< offsets of the fields, allocated behind the fields     */
+    TAU_VIEW_FIELD_T    field[];        /**< fields                                                 */
+};
+
+/** State while building a view  */
+typedef struct
+{
+    TAU_VIEW_T  *pView;             /**< view to fill, NULL to count the fields only    */
+    UINT32      count;              /**< fields so far                                  */
+    UINT32      offset;             /**< offset of the next field                       */
+    BOOL8       fixed;              /**< offset of the next field known in advance      */
+} TAU_VIEW_BUILD_T;
+
 
 /***********************************************************************************************************************
  * LOCALS
@@ -91,6 +141,8 @@ static UINT32 sNumComId = 0u;
 static TRDP_DATASET_T           * *sDataSets = NULL;
 static UINT32       sNumEntries = 0u;
 
+static TAU_DS_INFO_T    *sDsInfo = NULL;   /* parallel to sDataSets, TRDP_DATASET_T.reserved1 is the index + 1 */
+
 /***********************************************************************************************************************
  * LOCAL FUNCTIONS
  */
@@ -356,6 +408,41 @@ static TRDP_DATASET_T *findDs (
     return NULL;
 }
 
+/**********************************************************************************************************************/
+/**    Return the alignment of a basic type in host memory.
+ *
+ *  @param[in]      type            element type (TRDP_DATA_TYPE_T)
+ *
+ *  @retval         1,2,4,8
+ *
+ */
+static UINT8 alignOfType (
+    UINT32 type)
+{
+    switch (type)
+    {
+       case TRDP_UTF16:
+       case TRDP_INT16:
+       case TRDP_UINT16:
+           return ALIGNOF(UINT16);
+       case TRDP_INT32:
+       case TRDP_UINT32:
+       case TRDP_REAL32:
+       case TRDP_TIMEDATE32:
+           return ALIGNOF(UINT32);
+       case TRDP_TIMEDATE64:
+           return ALIGNOF(TIMEDATE64_STRUCT_T);
+       case TRDP_TIMEDATE48:
+           return ALIGNOF(TIMEDATE48_STRUCT_T);
+       case TRDP_INT64:
+       case TRDP_UINT64:
+       case TRDP_REAL64:
+           return ALIGNOF(UINT64);
+       default:
+           return 1u;
+    }
+}
+
 /**********************************************************************************************************************/
 /**    Return the size of the largest member of this dataset.
  *
@@ -378,51 +465,7 @@ static UINT8 maxAlignOfDSMember (
         {
             if (pDataset->pElement[lIndex].type <= TRDP_TIMEDATE64)
             {
-                switch (pDataset->pElement[lIndex].type)
-                {
-                   case TRDP_BOOL8:
-                   case TRDP_CHAR8:
-                   case TRDP_INT8:
-                   case TRDP_UINT8:
-                   {
-                       elemSize = 1;
-                       break;
-                   }
-                   case TRDP_UTF16:
-                   case TRDP_INT16:
-                   case TRDP_UINT16:
-                   {
-                       elemSize = ALIGNOF(UINT16);
-                       break;
-                   }
-                   case TRDP_INT32:
-                   case TRDP_UINT32:
-                   case TRDP_REAL32:
-                   case TRDP_TIMEDATE32:
-                   {
-                       elemSize = ALIGNOF(UINT32);
-                       break;
-                   }
-                   case TRDP_TIMEDATE64:
-                   {
-                       elemSize = ALIGNOF(TIMEDATE64_STRUCT_T);
-                       break;
-                   }
-                   case TRDP_TIMEDATE48:
-                   {
-                       elemSize = ALIGNOF(TIMEDATE48_STRUCT_T);
-                       break;
-                   }
-                   case TRDP_INT64:
-                   case TRDP_UINT64:
-                   case TRDP_REAL64:
-                   {
-                       elemSize = ALIGNOF(UINT64);
-                       break;
-                   }
-                   default:
-                       break;
-                }
+                elemSize = alignOfType(pDataset->pElement[lIndex].type);
             }
             else    /* recurse if nested dataset */
             {
@@ -438,488 +481,775 @@ static UINT8 maxAlignOfDSMember (
 }
 
 /**********************************************************************************************************************/
-/**    Marshall one dataset.
+/**    Return the marshalled size of one item of an element type
  *
- *  @param[in,out]  pInfo           Pointer with src & dest info
- *  @param[in]      pDataset        Pointer to one dataset
+ *  @param[in]      type            element type (TRDP_DATA_TYPE_T)
  *
- *  @retval         TRDP_NO_ERR     no error
- *  @retval         TRDP_MEM_ERR    provided buffer to small
- *  @retval         TRDP_PARAM_ERR  Parameter error
- *  @retval         TRDP_STATE_ERR  Too deep recursion
+ *  @retval         size in bytes, 0 for nested datasets
  *
  */
+static UINT32 wireSizeOfType (
+    UINT32 type)
+{
+    switch (type)
+    {
+        case TRDP_BITSET8:
+        case TRDP_CHAR8:
+        case TRDP_INT8:
+        case TRDP_UINT8:
+            return 1u;
+        case TRDP_UTF16:
+        case TRDP_INT16:
+        case TRDP_UINT16:
+            return 2u;
+        case TRDP_INT32:
+        case TRDP_UINT32:
+        case TRDP_REAL32:
+        case TRDP_TIMEDATE32:
+            return 4u;
+        case TRDP_TIMEDATE48:
+            return 6u;
+        case TRDP_INT64:
+        case TRDP_UINT64:
+        case TRDP_REAL64:
+        case TRDP_TIMEDATE64:
+            return 8u;
+        default:
+            return 0u;
+    }
+}
 
-static TRDP_ERR_T marshallDs (
-    TAU_MARSHALL_INFO_T *pInfo,
-    TRDP_DATASET_T      *pDataset)
+/**********************************************************************************************************************/
+/**    Return the marshalled size of a dataset without variable arrays
+ *
+ *  @param[in]      pDataset        Pointer to one dataset
+ *  @param[in]      level           recursion depth
+ *
+ *  @retval         size in bytes, 0 if the size depends on the data or the dataset is unknown
+ *
+ */
+static UINT32 wireSizeOfDs (
+    TRDP_DATASET_T  *pDataset,
+    UINT32          level)
 {
-    TRDP_ERR_T  err;
-    UINT16      lIndex;
-    UINT32      var_size = 0u;
-    UINT8       *pSrc;
-    UINT8       *pDst = pInfo->pDst;
+    UINT32  size = 0u;
+    UINT32  itemSize;
+    UINT16  lIndex;
 
-    /* Restrict recursion */
-    pInfo->level++;
-    if (pInfo->level > TAU_MAX_DS_LEVEL)
+    if (level >= TAU_MAX_DS_LEVEL)
     {
-        return TRDP_STATE_ERR;
+        return 0u;
+    }
+    for (lIndex = 0u; lIndex < pDataset->numElement; lIndex++)
+    {
+        if (pDataset->pElement[lIndex].size == TRDP_VAR_SIZE)
+        {
+            return 0u;
+        }
+        if (pDataset->pElement[lIndex].type <= TRDP_TIMEDATE64)
+        {
+            itemSize = wireSizeOfType(pDataset->pElement[lIndex].type);
+        }
+        else
+        {
+            if (NULL == pDataset->pElement[lIndex].pCachedDS)
+            {
+                pDataset->pElement[lIndex].pCachedDS = findDs(pDataset->pElement[lIndex].type);
+            }
+            if (NULL == pDataset->pElement[lIndex].pCachedDS)
+            {
+                return 0u;
+            }
+            itemSize = wireSizeOfDs(pDataset->pElement[lIndex].pCachedDS, level + 1u);
+        }
+        if (itemSize == 0u)
+        {
+            return 0u;
+        }
+        size += itemSize * pDataset->pElement[lIndex].size;
     }
+    return size;
+}
 
-    /*  Align on struct boundary first   */
-    /*  Regarding Ticket #197:
-        This is a weak determination of structure alignment!
-            "A struct is always aligned to the largest types alignment requirements"
-        Only, at this point we do need to know the size of the largest member to follow! */
+/**********************************************************************************************************************/
+/**    Check if a basic type has the same representation in host memory and on the wire
+ *
+ *  @param[in]      type            element type (TRDP_DATA_TYPE_T)
+ *
+ *  @retval         TRUE            identical
+ *  @retval         FALSE           byte swapped or padded
+ *
+ */
+static BOOL8 identityType (
+    UINT32 type)
+{
+#ifdef B_ENDIAN
+    return ((0u != wireSizeOfType(type)) && (TRDP_TIMEDATE48 != type)) ? TRUE : FALSE;
+#else
+    return (1u == wireSizeOfType(type)) ? TRUE : FALSE;
+#endif
+}
 
-    pSrc = alignePtr(pInfo->pSrc, maxAlignOfDSMember(pDataset));
+/**********************************************************************************************************************/
+/**    Align an offset
+ *
+ *  @param[in]      offset          offset to align
+ *  @param[in]      alignment       1, 2, 4, 8
+ *
+ *  @retval         aligned offset
+ */
+static INLINE UINT32 alignOffset (
+    UINT32  offset,
+    UINT32  alignment)
+{
+    return (offset + alignment - 1u) & ~(alignment - 1u);
+}
 
-    /*    Loop over all datasets in the array    */
-    for (lIndex = 0u; (lIndex < pDataset->numElement) && (pInfo->pSrcEnd > pInfo->pSrc); ++lIndex)
+/**********************************************************************************************************************/
+/**    Determine the host and wire size of a dataset without variable sized elements.
+ *  Host and wire offsets are tracked in parallel, the host offset being aligned as size_unmarshall() does. The layout
+ *  is an identity if no basic type is converted and the host offsets never differ from the wire offsets.
+ *
+ *  @param[in]      pDataset        Pointer to one dataset
+ *  @param[in,out]  pHostOffset     offset in the host struct
+ *  @param[in,out]  pWireOffset     offset in the marshalled data
+ *  @param[in,out]  pIdentity       cleared if the layouts differ
+ *  @param[in]      level           recursion depth
+ *
+ *  @retval         TRUE            fixed size
+ *  @retval         FALSE           size depends on the data or the dataset is unknown
+ *
+ */
+static BOOL8 fixedLayout (
+    TRDP_DATASET_T  *pDataset,
+    UINT32          *pHostOffset,
+    UINT32          *pWireOffset,
+    BOOL8           *pIdentity,
+    UINT32          level)
+{
+    UINT32  lItem;
+    UINT32  itemSize;
+    UINT16  lIndex;
+
+    if (level > TAU_MAX_DS_LEVEL)
     {
-        UINT32 noOfItems = pDataset->pElement[lIndex].size;
+        return FALSE;
+    }
 
-        if (TRDP_VAR_SIZE == noOfItems) /* variable size    */
+    *pHostOffset = alignOffset(*pHostOffset, maxAlignOfDSMember(pDataset));
+
+    for (lIndex = 0u; lIndex < pDataset->numElement; lIndex++)
+    {
+        TRDP_DATASET_ELEMENT_T *pElement = &pDataset->pElement[lIndex];
+
+        if (TRDP_VAR_SIZE == pElement->size)
         {
-            noOfItems = var_size;
+            return FALSE;
         }
-
-        /*    Is this a composite type?    */
-        if (pDataset->pElement[lIndex].type > (UINT32) TRDP_TYPE_MAX)
+        if (pElement->type <= TRDP_TIMEDATE64)
         {
-            while (noOfItems-- > 0u)
+            itemSize = wireSizeOfType(pElement->type);
+            if (!identityType(pElement->type) ||
+                (alignOffset(*pHostOffset, alignOfType(pElement->type)) != *pWireOffset))
             {
-                /* Dataset, call ourself recursively */
-
-                /* Never used before?  */
-                if (NULL == pDataset->pElement[lIndex].pCachedDS)
-                {
-                    /* Look for it   */
-                    pDataset->pElement[lIndex].pCachedDS = findDs(pDataset->pElement[lIndex].type);
-                }
-
-                if (NULL == pDataset->pElement[lIndex].pCachedDS)      /* Not in our DB    */
-                {
-                    vos_printLog(VOS_LOG_ERROR, "ComID/DatasetID (%u) unknown\n", pDataset->pElement[lIndex].type);
-                    return TRDP_COMID_ERR;
-                }
-
-                err = marshallDs(pInfo, pDataset->pElement[lIndex].pCachedDS);
-                if (err != TRDP_NO_ERR)
-                {
-                    return err;
-                }
-                pDst    = pInfo->pDst;
-                pSrc    = pInfo->pSrc;
+                *pIdentity = FALSE;
             }
+            switch (pElement->type)
+            {
+                case TRDP_TIMEDATE48:
+                    for (lItem = 0u; lItem < pElement->size; lItem++)
+                    {
+                        *pHostOffset    = alignOffset(*pHostOffset, ALIGNOF(TIMEDATE48_STRUCT_T)) + 6u;
+                        *pHostOffset    = alignOffset(*pHostOffset, ALIGNOF(TIMEDATE48_STRUCT_T));
+                    }
+                    break;
+                case TRDP_TIMEDATE64:
+                    for (lItem = 0u; lItem < pElement->size; lItem++)
+                    {
+                        *pHostOffset    = alignOffset(*pHostOffset, ALIGNOF(TIMEDATE64_STRUCT_T)) + 4u;
+                        *pHostOffset    = alignOffset(*pHostOffset, ALIGNOF(UINT32)) + 4u;
+                    }
+                    break;
+                case TRDP_INT64:
+                case TRDP_UINT64:
+                case TRDP_REAL64:
+                    for (lItem = 0u; lItem < pElement->size; lItem++)
+                    {
+                        *pHostOffset = alignOffset(*pHostOffset, ALIGNOF(UINT64)) + 8u;
+                    }
+                    break;
+                default:
+                    *pHostOffset = alignOffset(*pHostOffset, alignOfType(pElement->type)) + pElement->size * itemSize;
+                    break;
+            }
+            *pWireOffset += pElement->size * itemSize;
         }
         else
         {
-            switch (pDataset->pElement[lIndex].type)
+            if (NULL == pElement->pCachedDS)
             {
-               case TRDP_BOOL8:
-               case TRDP_CHAR8:
-               case TRDP_INT8:
-               case TRDP_UINT8:
-               {
-                   /*    possible variable source size    */
-                   var_size = *pSrc;
+                pElement->pCachedDS = findDs(pElement->type);
+            }
+            if (NULL == pElement->pCachedDS)
+            {
+                return FALSE;
+            }
+            for (lItem = 0u; lItem < pElement->size; lItem++)
+            {
+                if (!fixedLayout(pElement->pCachedDS, pHostOffset, pWireOffset, pIdentity, level + 1u))
+                {
+                    return FALSE;
+                }
+            }
+        }
+        if (*pHostOffset != *pWireOffset)
+        {
+            *pIdentity = FALSE;
+        }
+    }
 
-                   if ((pDst + noOfItems) > pInfo->pDstEnd)
-                   {
-                       return TRDP_PARAM_ERR;
-                   }
+    /*  Padding at the end, as size_unmarshall() does  */
+    *pHostOffset = alignOffset(*pHostOffset, maxAlignOfDSMember(pDataset));
+    return TRUE;
+}
 
-                   while (noOfItems-- > 0u)
-                   {
-                       *pDst++ = *pSrc++;
-                   }
-                   break;
-               }
-               case TRDP_UTF16:
-               case TRDP_INT16:
-               case TRDP_UINT16:
-               {
-                   UINT16 *pSrc16 = (UINT16 *) alignePtr(pSrc, ALIGNOF(UINT16));
+/**********************************************************************************************************************/
+/**    Return the information on a dataset, determined by tau_initMarshall
+ *
+ *  @param[in]      pDataset        Pointer to one dataset
+ *
+ *  @retval         NULL if not known
+ *  @retval         pointer to the information
+ *
+ */
+static INLINE const TAU_DS_INFO_T *dsInfo (
+    const TRDP_DATASET_T *pDataset)
+{
+    if ((NULL == sDsInfo) || (0u == pDataset->reserved1) || (pDataset->reserved1 > sNumEntries))
+    {
+        return NULL;
+    }
+    return &sDsInfo[pDataset->reserved1 - 1u];
+}
 
-                   /*    possible variable source size    */
-                   var_size = *pSrc16;
+/**********************************************************************************************************************/
+/**    Copy a dataset with identity layout as a whole.
+ *  Datasets of other layout, and sources too short for the whole dataset, are left to marshallDs()/unmarshallDs().
+ *
+ *  @param[in]      pDataset        Pointer to one dataset
+ *  @param[in]      pSrc            Pointer to the source
+ *  @param[in]      srcSize         size of the source
+ *  @param[in]      pDest           Pointer to the destination
+ *  @param[in,out]  pDestSize       size of the destination / size of the result
+ *  @param[in]      toHost          unmarshalling
+ *  @param[out]     pErr            result if copied
+ *
+ *  @retval         TRUE            copied
+ *  @retval         FALSE           marshalling needed
+ *
+ */
+static BOOL8 identityCopy (
+    const TRDP_DATASET_T    *pDataset,
+    const UINT8             *pSrc,
+    UINT32                  srcSize,
+    UINT8                   *pDest,
+    UINT32                  *pDestSize,
+    BOOL8                   toHost,
+    TRDP_ERR_T              *pErr)
+{
+    const TAU_DS_INFO_T *pInfo = dsInfo(pDataset);
 
-                   if ((pDst + noOfItems * 2) > pInfo->pDstEnd)
-                   {
-                       return TRDP_PARAM_ERR;
-                   }
+    if ((NULL == pInfo) || (TAU_LAYOUT_IDENTITY != pInfo->layout) || (srcSize < pInfo->wireSize))
+    {
+        return FALSE;
+    }
 
-                   while (noOfItems-- > 0u)
-                   {
-                       *pDst++  = (UINT8) (*pSrc16 >> 8u);
-                       *pDst++  = (UINT8) (*pSrc16 & 0xFFu);
-                       pSrc16++;
-                   }
-                   pSrc = (UINT8 *) pSrc16;
-                   break;
-               }
-               case TRDP_INT32:
-               case TRDP_UINT32:
-               case TRDP_REAL32:
-               case TRDP_TIMEDATE32:
-               {
-                   UINT32 *pSrc32 = (UINT32 *) alignePtr(pSrc, ALIGNOF(UINT32));
+    if (*pDestSize < pInfo->wireSize)
+    {
+        *pErr = TRDP_PARAM_ERR;
+    }
+    else
+    {
+        memcpy(pDest, pSrc, pInfo->wireSize);
+        *pDestSize  = (toHost) ? pInfo->hostSize : pInfo->wireSize;
+        *pErr       = TRDP_NO_ERR;
+    }
+    return TRUE;
+}
 
-                   /*    possible variable source size    */
-                   var_size = *pSrc32;
+/**********************************************************************************************************************/
+/**    Read big endian values of the marshalled data
+ *
+ *  @param[in]      pSrc            Pointer to the value, any alignment
+ *
+ *  @retval         value in host order
+ *
+ */
+static INLINE UINT16 viewRead16 (
+    const UINT8 *pSrc)
+{
+    return (UINT16) (((UINT16) pSrc[0] << 8u) | pSrc[1]);
+}
 
-                   if ((pDst + noOfItems * 4) > pInfo->pDstEnd)
-                   {
-                       return TRDP_PARAM_ERR;
-                   }
+static INLINE UINT32 viewRead32 (
+    const UINT8 *pSrc)
+{
+    return ((UINT32) pSrc[0] << 24u) | ((UINT32) pSrc[1] << 16u) | ((UINT32) pSrc[2] << 8u) | pSrc[3];
+}
 
-                   while (noOfItems-- > 0u)
-                   {
-                       *pDst++  = (UINT8) (*pSrc32 >> 24u);
-                       *pDst++  = (UINT8) (*pSrc32 >> 16u);
-                       *pDst++  = (UINT8) (*pSrc32 >> 8u);
-                       *pDst++  = (UINT8) (*pSrc32 & 0xFFu);
-                       pSrc32++;
-                   }
-                   pSrc = (UINT8 *) pSrc32;
-                   break;
-               }
-               case TRDP_TIMEDATE64:
-               {
-                   UINT32 *pSrc32 = (UINT32 *) alignePtr(pSrc, ALIGNOF(TIMEDATE64_STRUCT_T));
-
-                   if ((pDst + noOfItems * 8u) > pInfo->pDstEnd)
-                   {
-                       return TRDP_PARAM_ERR;
-                   }
-
-                   while (noOfItems-- > 0u)
-                   {
-                       *pDst++  = (UINT8) (*pSrc32 >> 24u);
-                       *pDst++  = (UINT8) (*pSrc32 >> 16u);
-                       *pDst++  = (UINT8) (*pSrc32 >> 8u);
-                       *pDst++  = (UINT8) (*pSrc32 & 0xFFu);
-                       pSrc32++;
-                       *pDst++  = (UINT8) (*pSrc32 >> 24u);
-                       *pDst++  = (UINT8) (*pSrc32 >> 16u);
-                       *pDst++  = (UINT8) (*pSrc32 >> 8u);
-                       *pDst++  = (UINT8) (*pSrc32 & 0xFFu);
-                       pSrc32++;
-                   }
-                   pSrc = (UINT8 *) pSrc32;
-                   break;
-               }
-               case TRDP_TIMEDATE48:
-               {
-                   /*    This is not a base type but a structure    */
-                   UINT32   *pSrc32;
-                   UINT16   *pSrc16;
+static INLINE UINT64 viewRead64 (
+    const UINT8 *pSrc)
+{
+    return ((UINT64) viewRead32(pSrc) << 32u) | viewRead32(pSrc + 4u);
+}
 
-                   if (pDst + noOfItems * 6u > pInfo->pDstEnd)
-                   {
-                       return TRDP_PARAM_ERR;
-                   }
+/**********************************************************************************************************************/
+/**    Read the number of items of a following variable sized array, as marshallDs() does
+ *
+ *  @param[in]      pSrc            Pointer to the first item of the preceding element
+ *  @param[in]      itemSize        marshalled size of that item
+ *
+ *  @retval         number of items
+ *
+ */
+static UINT32 viewReadCount (
+    const UINT8 *pSrc,
+    UINT32      itemSize)
+{
+    switch (itemSize)
+    {
+        case 1u:
+            return *pSrc;
+        case 2u:
+            return viewRead16(pSrc);
+        case 4u:
+            return viewRead32(pSrc);
+        default:
+            return 0u;
+    }
+}
 
-                   while (noOfItems-- > 0u)
-                   {
-                       pSrc32 =
-                           (UINT32 *) alignePtr(pSrc, ALIGNOF(TIMEDATE48_STRUCT_T));
-                       *pDst++  = (UINT8) (*pSrc32 >> 24u);
-                       *pDst++  = (UINT8) (*pSrc32 >> 16u);
-                       *pDst++  = (UINT8) (*pSrc32 >> 8u);
-                       *pDst++  = (UINT8) (*pSrc32 & 0xFFu);
-                       pSrc32++;
-                       pSrc16   = (UINT16 *) alignePtr((UINT8 *) pSrc32, ALIGNOF(UINT16));
-                       *pDst++  = (UINT8) (*pSrc16 >> 8u);
-                       *pDst++  = (UINT8) (*pSrc16 & 0xFFu);
-                       pSrc16++;
-                       pSrc16 = (UINT16 *)alignePtr((UINT8 *)pSrc16, ALIGNOF(TIMEDATE48_STRUCT_T));
-                       pSrc = (UINT8 *) pSrc16;
-                   }
-                   break;
-               }
-               case TRDP_INT64:
-               case TRDP_UINT64:
-               case TRDP_REAL64:
-                   if ((pDst + noOfItems * 8u) > pInfo->pDstEnd)
-                   {
-                       return TRDP_PARAM_ERR;
-                   }
+/**********************************************************************************************************************/
+/**    Add a field to a view
+ *
+ *  @param[in,out]  pBuild          build state
+ *  @param[in]      type            basic type or dataset id
+ *  @param[in]      noOfItems       number of items or TRDP_VAR_SIZE
+ *  @param[in]      itemSize        marshalled size of one item, 0 if it depends on the data
+ *  @param[in]      varField        field holding the number of items
+ *  @param[in]      pDataset        nested dataset or NULL
+ *
+ */
+static void viewAddField (
+    TAU_VIEW_BUILD_T    *pBuild,
+    UINT32              type,
+    UINT32              noOfItems,
+    UINT32              itemSize,
+    UINT32              varField,
+    TRDP_DATASET_T      *pDataset)
+{
+    TAU_VIEW_T *pView = pBuild->pView;
 
-                   packedCopy64(&pSrc, &pDst, noOfItems);
-                   break;
-               default:
-                   break;
-            }
-            /* Update info structure if we need to! (was issue #137) */
-            pInfo->pDst = pDst;
-            pInfo->pSrc = pSrc;
+    if (NULL != pView)
+    {
+        pView->field[pBuild->count].type        = type;
+        pView->field[pBuild->count].noOfItems   = noOfItems;
+        pView->field[pBuild->count].itemSize    = itemSize;
+        pView->field[pBuild->count].varField    = varField;
+        pView->field[pBuild->count].pDataset    = pDataset;
+        if (pBuild->fixed)
+        {
+            pView->pOffset[pBuild->count]   = pBuild->offset;
+            pView->noOfFixed                = pBuild->count + 1u;
         }
     }
 
-    pInfo->pSrc = alignePtr(pInfo->pSrc, maxAlignOfDSMember(pDataset));
+    /*  The offsets of the following fields depend on the data  */
+    if ((TRDP_VAR_SIZE == noOfItems) || (0u == itemSize))
+    {
+        pBuild->fixed = FALSE;
+    }
+    else
+    {
+        pBuild->offset += noOfItems * itemSize;
+    }
+    pBuild->count++;
+}
 
-    if (pInfo->pSrc > pInfo->pSrcEnd ) /* Maybe one alignement bejond - do not erratically issue error! */
+/**********************************************************************************************************************/
+/**    Add the fields of a dataset to a view, nested datasets of fixed number are resolved
+ *
+ *  @param[in,out]  pBuild          build state
+ *  @param[in]      pDataset        Pointer to one dataset
+ *  @param[in]      level           recursion depth
+ *
+ *  @retval         TRDP_NO_ERR     no error
+ *  @retval         TRDP_COMID_ERR  nested dataset unknown
+ *  @retval         TRDP_STATE_ERR  Too deep recursion
+ *
+ */
+static TRDP_ERR_T viewAddDs (
+    TAU_VIEW_BUILD_T    *pBuild,
+    TRDP_DATASET_T      *pDataset,
+    UINT32              level)
+{
+    TRDP_ERR_T  err;
+    UINT32      varField = TAU_VIEW_NO_FIELD;
+    UINT32      lItem;
+    UINT16      lIndex;
+
+    if (level > TAU_MAX_DS_LEVEL)
     {
-        vos_printLogStr(VOS_LOG_WARNING, "Marshalling read beyond source area. Wrong Dataset size provided?\n");
+        return TRDP_STATE_ERR;
     }
 
-    /* Decrement recursion counter. Note: Recursion counter will not decrement in case of error */
-    pInfo->level--;
+    for (lIndex = 0u; lIndex < pDataset->numElement; lIndex++)
+    {
+        TRDP_DATASET_ELEMENT_T *pElement = &pDataset->pElement[lIndex];
+
+        if (pElement->type <= TRDP_TIMEDATE64)
+        {
+            viewAddField(pBuild, pElement->type, pElement->size, wireSizeOfType(pElement->type), varField, NULL);
+
+            /*  A following variable sized array takes its size from this element  */
+            varField = pBuild->count - 1u;
+            continue;
+        }
+
+        if (NULL == pElement->pCachedDS)
+        {
+            pElement->pCachedDS = findDs(pElement->type);
+        }
+        if (NULL == pElement->pCachedDS)
+        {
+            vos_printLog(VOS_LOG_ERROR, "ComID/DatasetID (%u) unknown\n", pElement->type);
+            return TRDP_COMID_ERR;
+        }
 
+        if (TRDP_VAR_SIZE == pElement->size)
+        {
+            viewAddField(pBuild, pElement->type, TRDP_VAR_SIZE, wireSizeOfDs(pElement->pCachedDS, level),
+                         varField, pElement->pCachedDS);
+        }
+        else
+        {
+            for (lItem = 0u; lItem < pElement->size; lItem++)
+            {
+                err = viewAddDs(pBuild, pElement->pCachedDS, level + 1u);
+                if (err != TRDP_NO_ERR)
+                {
+                    return err;
+                }
+            }
+        }
+    }
     return TRDP_NO_ERR;
 }
 
 /**********************************************************************************************************************/
-/**    Unmarshall one dataset.
+/**    Determine the marshalled size of a dataset in the data
  *
- *  @param[in,out]  pInfo           Pointer with src & dest info
  *  @param[in]      pDataset        Pointer to one dataset
+ *  @param[in]      pSrc            Pointer to the marshalled dataset
+ *  @param[in]      pSrcEnd         End of the marshalled data
+ *  @param[in]      level           recursion depth
+ *  @param[out]     pSize           size in bytes
  *
  *  @retval         TRDP_NO_ERR             no error
- *  @retval         TRDP_MEM_ERR            provided buffer to small
- *  @retval         TRDP_PARAM_ERR          Parameter error
+ *  @retval         TRDP_COMID_ERR          nested dataset unknown
  *  @retval         TRDP_STATE_ERR          Too deep recursion
- *  @retval         TRDP_MARSHALLING_ERR    dataset/source size mismatch
+ *  @retval         TRDP_MARSHALLING_ERR    data too short
  *
  */
-
-static TRDP_ERR_T unmarshallDs (
-    TAU_MARSHALL_INFO_T *pInfo,
-    TRDP_DATASET_T      *pDataset)
+static TRDP_ERR_T viewSizeOfDs (
+    TRDP_DATASET_T  *pDataset,
+    const UINT8     *pSrc,
+    const UINT8     *pSrcEnd,
+    UINT32          level,
+    UINT32          *pSize)
 {
     TRDP_ERR_T  err;
-    UINT16      lIndex;
+    UINT32      size        = 0u;
     UINT32      var_size    = 0u;
-    UINT8       *pSrc       = pInfo->pSrc;
-    UINT8       *pDst       = pInfo->pDst;
+    UINT32      noOfItems;
+    UINT32      itemSize;
+    UINT16      lIndex;
 
-    /* Restrict recursion */
-    pInfo->level++;
-    if (pInfo->level > TAU_MAX_DS_LEVEL)
+    if (level > TAU_MAX_DS_LEVEL)
     {
         return TRDP_STATE_ERR;
     }
 
-    pDst = alignePtr(pInfo->pDst, maxAlignOfDSMember(pDataset));
-
-    /*    Loop over all datasets in the array    */
-    for (lIndex = 0u; (lIndex < pDataset->numElement) && (pInfo->pSrcEnd > pInfo->pSrc); ++lIndex)
+    for (lIndex = 0u; lIndex < pDataset->numElement; lIndex++)
     {
-        UINT32 noOfItems = pDataset->pElement[lIndex].size;
+        TRDP_DATASET_ELEMENT_T *pElement = &pDataset->pElement[lIndex];
 
-        if (TRDP_VAR_SIZE == noOfItems) /* variable size    */
+        noOfItems = (TRDP_VAR_SIZE == pElement->size) ? var_size : pElement->size;
+
+        if (pElement->type <= TRDP_TIMEDATE64)
         {
-            noOfItems = var_size;
+            itemSize = wireSizeOfType(pElement->type);
+            if ((itemSize != 0u) && (noOfItems > (UINT32) (pSrcEnd - pSrc - size) / itemSize))
+            {
+                return TRDP_MARSHALLING_ERR;
+            }
+            var_size    = (noOfItems > 0u) ? viewReadCount(pSrc + size, itemSize) : 0u;
+            size        += noOfItems * itemSize;
+            continue;
         }
-        /*    Is this a composite type?    */
-        if (pDataset->pElement[lIndex].type > (UINT32) TRDP_TYPE_MAX)
+
+        if (NULL == pElement->pCachedDS)
         {
-            while (noOfItems-- > 0u)
+            pElement->pCachedDS = findDs(pElement->type);
+        }
+        if (NULL == pElement->pCachedDS)
+        {
+            return TRDP_COMID_ERR;
+        }
+        while (noOfItems-- > 0u)
+        {
+            err = viewSizeOfDs(pElement->pCachedDS, pSrc + size, pSrcEnd, level + 1u, &itemSize);
+            if (err != TRDP_NO_ERR)
             {
-                /* Dataset, call ourself recursively */
-                /* Never used before?  */
-                if (NULL == pDataset->pElement[lIndex].pCachedDS)
-                {
-                    /* Look for it   */
-                    pDataset->pElement[lIndex].pCachedDS = findDs(pDataset->pElement[lIndex].type);
-                }
+                return err;
+            }
+            if (0u == itemSize)     /* all further items are empty, too */
+            {
+                break;
+            }
+            size += itemSize;
+        }
+    }
+    *pSize = size;
+    return TRDP_NO_ERR;
+}
 
-                if (NULL == pDataset->pElement[lIndex].pCachedDS)      /* Not in our DB    */
-                {
-                    vos_printLog(VOS_LOG_ERROR, "ComID/DatasetID (%u) unknown\n", pDataset->pElement[lIndex].type);
-                    return TRDP_COMID_ERR;
-                }
+/**********************************************************************************************************************/
+/**    Get the number of items of a field in the current data, its offset must be resolved
+ *
+ *  @param[in]      pView           view handle
+ *  @param[in]      fieldId         field id
+ *  @param[out]     pNoOfItems      number of items
+ *
+ *  @retval         TRDP_NO_ERR             no error
+ *  @retval         TRDP_MARSHALLING_ERR    data too short
+ *
+ */
+static TRDP_ERR_T viewItems (
+    const TAU_VIEW_T    *pView,
+    UINT32              fieldId,
+    UINT32              *pNoOfItems)
+{
+    const TAU_VIEW_FIELD_T  *pField = &pView->field[fieldId];
+    const TAU_VIEW_FIELD_T  *pVarField;
 
-                err = unmarshallDs(pInfo, pDataset->pElement[lIndex].pCachedDS);
+    if (TRDP_VAR_SIZE != pField->noOfItems)
+    {
+        *pNoOfItems = pField->noOfItems;
+    }
+    else if (TAU_VIEW_NO_FIELD == pField->varField)
+    {
+        *pNoOfItems = 0u;
+    }
+    else
+    {
+        pVarField = &pView->field[pField->varField];
+        if ((pView->pOffset[pField->varField] + pVarField->itemSize) > pView->dataSize)
+        {
+            return TRDP_MARSHALLING_ERR;
+        }
+        *pNoOfItems = viewReadCount(pView->pData + pView->pOffset[pField->varField], pVarField->itemSize);
+    }
+    return TRDP_NO_ERR;
+}
+
+/**********************************************************************************************************************/
+/**    Determine the offsets of the fields up to fieldId in the current data
+ *
+ *  @param[in,out]  pView           view handle
+ *  @param[in]      fieldId         field id
+ *
+ *  @retval         TRDP_NO_ERR             no error
+ *  @retval         TRDP_MARSHALLING_ERR    data too short
+ *
+ */
+static TRDP_ERR_T viewResolve (
+    TAU_VIEW_T  *pView,
+    UINT32      fieldId)
+{
+    TRDP_ERR_T  err;
+    UINT32      prev;
+    UINT32      noOfItems;
+    UINT32      size;
+    UINT32      itemSize;
+
+    while (pView->noOfResolved <= fieldId)
+    {
+        prev    = pView->noOfResolved - 1u;
+        err     = viewItems(pView, prev, &noOfItems);
+        if (err != TRDP_NO_ERR)
+        {
+            return err;
+        }
+        if (pView->pOffset[prev] > pView->dataSize)
+        {
+            return TRDP_MARSHALLING_ERR;
+        }
+
+        if (0u != pView->field[prev].itemSize)
+        {
+            if (noOfItems > (pView->dataSize - pView->pOffset[prev]) / pView->field[prev].itemSize)
+            {
+                return TRDP_MARSHALLING_ERR;
+            }
+            size = noOfItems * pView->field[prev].itemSize;
+        }
+        else    /* nested datasets of variable size   */
+        {
+            for (size = 0u; noOfItems > 0u; noOfItems--)
+            {
+                err = viewSizeOfDs(pView->field[prev].pDataset, pView->pData + pView->pOffset[prev] + size,
+                                   pView->pData + pView->dataSize, 2u, &itemSize);
                 if (err != TRDP_NO_ERR)
                 {
                     return err;
                 }
+                if (0u == itemSize)
+                {
+                    break;
+                }
+                size += itemSize;
             }
-            pDst    = pInfo->pDst;
-            pSrc    = pInfo->pSrc;
         }
-        else
-        {
-            switch (pDataset->pElement[lIndex].type)
-            {
-               case TRDP_BOOL8:
-               case TRDP_CHAR8:
-               case TRDP_INT8:
-               case TRDP_UINT8:
-               {
-                   if ((pDst + noOfItems) > pInfo->pDstEnd)
-                   {
-                       return TRDP_PARAM_ERR;
-                   }
+        pView->pOffset[pView->noOfResolved++] = pView->pOffset[prev] + size;
+    }
+    return TRDP_NO_ERR;
+}
 
-                   while (noOfItems-- > 0u)
-                   {
-                       var_size = *pSrc++;
-                       *pDst++  = (UINT8) var_size;
-                   }
-                   break;
-               }
-               case TRDP_UTF16:
-               case TRDP_INT16:
-               case TRDP_UINT16:
-               {
-                   UINT16 *pDst16 = (UINT16 *) alignePtr(pDst, ALIGNOF(UINT16));
-
-                   if ((pDst + noOfItems * 2u) > pInfo->pDstEnd)
-                   {
-                       return TRDP_PARAM_ERR;
-                   }
-
-                   while (noOfItems-- > 0u)
-                   {
-                       *pDst16  = (UINT16) (*pSrc++ << 8u);
-                       *pDst16  += *pSrc++;
-                       /*    possible variable source size    */
-                       var_size = *pDst16;
-                       pDst16++;
-                   }
-                   pDst = (UINT8 *) pDst16;
-                   break;
-               }
-               case TRDP_INT32:
-               case TRDP_UINT32:
-               case TRDP_REAL32:
-               case TRDP_TIMEDATE32:
-               {
-                   UINT32 *pDst32 = (UINT32 *) alignePtr(pDst, ALIGNOF(UINT32));
-
-                   if ((pDst + noOfItems * 4u) > pInfo->pDstEnd)
-                   {
-                       return TRDP_PARAM_ERR;
-                   }
-
-                   while (noOfItems-- > 0)
-                   {
-                       *pDst32  = ((UINT32)(*pSrc++)) << 24u;
-                       *pDst32  += ((UINT32)(*pSrc++)) << 16u;
-                       *pDst32  += ((UINT32)(*pSrc++)) << 8u;
-                       *pDst32  += *pSrc++;
-                       var_size = *pDst32;
-                       pDst32++;
-                   }
-                   pDst = (UINT8 *) pDst32;
-                   break;
-               }
-               case TRDP_TIMEDATE48:
-               {
-                   /*    This is not a base type but a structure    */
-                   UINT32   *pDst32;
-                   UINT16   *pDst16;
-
-                   if (pDst + noOfItems * 6u > pInfo->pDstEnd)
-                   {
-                       return TRDP_PARAM_ERR;
-                   }
-
-                   while (noOfItems-- > 0)
-                   {
-                       pDst32   = (UINT32 *) alignePtr(pDst, ALIGNOF(TIMEDATE48_STRUCT_T));
-                       *pDst32  = ((UINT32)(*pSrc++)) << 24u;
-                       *pDst32  += ((UINT32)(*pSrc++)) << 16u;
-                       *pDst32  += ((UINT32)(*pSrc++)) << 8u;
-                       *pDst32  += *pSrc++;
-                       pDst32++;
-                       pDst16   = (UINT16 *) alignePtr((UINT8 *)pDst32, ALIGNOF(UINT16));
-                       *pDst16  = (UINT16) (*pSrc++ << 8u);
-                       *pDst16  += *pSrc++;
-                       pDst16++;
-                       pDst = (UINT8 *) alignePtr((const UINT8*) pDst16, ALIGNOF(TIMEDATE48_STRUCT_T));
-                   }
-                   break;
-               }
-               case TRDP_TIMEDATE64:
-               {
-                   /*    This is not a base type but a structure    */
-                   UINT32 *pDst32;
-
-                   if ((pDst + noOfItems * 8u) > pInfo->pDstEnd)
-                   {
-                       return TRDP_PARAM_ERR;
-                   }
-
-                   while (noOfItems-- > 0u)
-                   {
-                       pDst32   = (UINT32 *) alignePtr(pDst, ALIGNOF(TIMEDATE64_STRUCT_T));
-                       *pDst32  = ((UINT32)(*pSrc++)) << 24u;
-                       *pDst32  += ((UINT32)(*pSrc++)) << 16u;
-                       *pDst32  += ((UINT32)(*pSrc++)) << 8u;
-                       *pDst32  += *pSrc++;
-                       pDst32++;
-                       pDst32   = (UINT32 *) alignePtr((UINT8 *)pDst32, ALIGNOF(UINT32));
-                       *pDst32  = ((UINT32)(*pSrc++)) << 24u;
-                       *pDst32  += ((UINT32)(*pSrc++)) << 16u;
-                       *pDst32  += ((UINT32)(*pSrc++)) << 8u;
-                       *pDst32  += *pSrc++;
-                       pDst32++;
-                       pDst = (UINT8 *) pDst32;
-                   }
-                   break;
-               }
-               case TRDP_INT64:
-               case TRDP_UINT64:
-               case TRDP_REAL64:
-               {
-                   if (pDst + noOfItems * 8u > pInfo->pDstEnd)
-                   {
-                       return TRDP_PARAM_ERR;
-                   }
+/**********************************************************************************************************************/
+/**    Locate items of a field in the current data
+ *
+ *  @param[in,out]  pView           view handle
+ *  @param[in]      fieldId         field id
+ *  @param[in]      itemSize        expected marshalled size of one item
+ *  @param[in]      real            expected REAL32/REAL64 type
+ *  @param[in]      first           index of the first item
+ *  @param[in,out]  pNoOfItems      in: items wanted, out: items available
+ *  @param[out]     ppSrc           Pointer to the first item
+ *
+ *  @retval         TRDP_NO_ERR             no error
+ *  @retval         TRDP_PARAM_ERR          Parameter error, field of other type, first item not existing
+ *  @retval         TRDP_MARSHALLING_ERR    data too short
+ *
+ */
+static TRDP_ERR_T viewLocate (
+    TAU_VIEW_T  *pView,
+    UINT32      fieldId,
+    UINT32      itemSize,
+    BOOL8       real,
+    UINT32      first,
+    UINT32      *pNoOfItems,
+    const UINT8 * *ppSrc)
+{
+    TRDP_ERR_T          err;
+    TAU_VIEW_FIELD_T    *pField;
+    UINT32              noOfItems;
+    BOOL8               isReal;
 
-                   unpackedCopy64((UINT8 * *) &pSrc, &pDst, noOfItems);
-                   break;
-               }
-               default:
-                   break;
-            }
-            pInfo->pDst = pDst;
-            pInfo->pSrc = pSrc;
-        }
+    if ((NULL == pView) || (NULL == pView->pData) || (fieldId >= pView->noOfFields) || (NULL == pNoOfItems))
+    {
+        return TRDP_PARAM_ERR;
     }
 
-    pInfo->pDst = alignePtr(pInfo->pDst, maxAlignOfDSMember(pDataset));
+    pField  = &pView->field[fieldId];
+    isReal  = ((TRDP_REAL32 == pField->type) || (TRDP_REAL64 == pField->type)) ? TRUE : FALSE;
+    if ((NULL != pField->pDataset) || (pField->itemSize != itemSize) || (isReal != real))
+    {
+        return TRDP_PARAM_ERR;
+    }
 
-    if (pInfo->pSrc > pInfo->pSrcEnd)
+    err = viewResolve(pView, fieldId);
+    if (err == TRDP_NO_ERR)
+    {
+        err = viewItems(pView, fieldId, &noOfItems);
+    }
+    if (err != TRDP_NO_ERR)
+    {
+        return err;
+    }
+    if (first >= noOfItems)
+    {
+        return TRDP_PARAM_ERR;
+    }
+    if (*pNoOfItems > (noOfItems - first))
+    {
+        *pNoOfItems = noOfItems - first;
+    }
+    if ((pView->pOffset[fieldId] > pView->dataSize) ||
+        ((first + *pNoOfItems) > (pView->dataSize - pView->pOffset[fieldId]) / itemSize))
     {
         return TRDP_MARSHALLING_ERR;
     }
+    *ppSrc = pView->pData + pView->pOffset[fieldId] + first * itemSize;
+    return TRDP_NO_ERR;
+}
 
-    /* Decrement recursion counter. Note: Recursion counter will not decrement in case of error */
-    pInfo->level--;
+/**********************************************************************************************************************/
+/**    Number of fields of a dataset in a view
+ *
+ *  @param[in]      pDataset        Pointer to one dataset
+ *  @param[in]      level           recursion depth
+ *
+ *  @retval         number of fields
+ *
+ */
+static UINT32 viewFieldsOfDs (
+    const TRDP_DATASET_T    *pDataset,
+    UINT32                  level)
+{
+    UINT32  count = 0u;
+    UINT16  lIndex;
 
-    return TRDP_NO_ERR;
+    if ((NULL == pDataset) || (level > TAU_MAX_DS_LEVEL))
+    {
+        return 0u;
+    }
+    for (lIndex = 0u; lIndex < pDataset->numElement; lIndex++)
+    {
+        if ((pDataset->pElement[lIndex].type <= TRDP_TIMEDATE64) || (TRDP_VAR_SIZE == pDataset->pElement[lIndex].size))
+        {
+            count++;
+        }
+        else
+        {
+            count += pDataset->pElement[lIndex].size * viewFieldsOfDs(pDataset->pElement[lIndex].pCachedDS, level + 1u);
+        }
+    }
+    return count;
 }
 
 /**********************************************************************************************************************/
-/**    Compute unmarshalled size of one dataset.
+/**    Marshall one dataset.
  *
  *  @param[in,out]  pInfo           Pointer with src & dest info
  *  @param[in]      pDataset        Pointer to one dataset
  *
- *  @retval         TRDP_NO_ERR             no error
- *  @retval         TRDP_MEM_ERR            provided buffer to small
- *  @retval         TRDP_PARAM_ERR          Parameter error
- *  @retval         TRDP_STATE_ERR          Too deep recursion
- *  @retval         TRDP_MARSHALLING_ERR    dataset/source size mismatch
+ *  @retval         TRDP_NO_ERR     no error
+ *  @retval         TRDP_MEM_ERR    provided buffer to small
+ *  @retval         TRDP_PARAM_ERR  Parameter error
+ *  @retval         TRDP_STATE_ERR  Too deep recursion
  *
  */
 
-static TRDP_ERR_T size_unmarshall (
+static TRDP_ERR_T marshallDs (
     TAU_MARSHALL_INFO_T *pInfo,
     TRDP_DATASET_T      *pDataset)
 {
     TRDP_ERR_T  err;
     UINT16      lIndex;
-    UINT32      var_size    = 0u;
-    UINT8       *pSrc       = pInfo->pSrc;
-    UINT8       *pDst;
+    UINT32      var_size = 0u;
+    UINT8       *pSrc;
+    UINT8       *pDst = pInfo->pDst;
 
     /* Restrict recursion */
     pInfo->level++;
@@ -928,7 +1258,13 @@ static TRDP_ERR_T size_unmarshall (
         return TRDP_STATE_ERR;
     }
 
-    pDst = alignePtr(pInfo->pDst, maxAlignOfDSMember(pDataset));
+    /*  Align on struct boundary first   */
+    /*  Regarding Ticket #197:
+        This is a weak determination of structure alignment!
+            "A struct is always aligned to the largest types alignment requirements"
+        Only, at this point we do need to know the size of the largest member to follow! */
+
+    pSrc = alignePtr(pInfo->pSrc, maxAlignOfDSMember(pDataset));
 
     /*    Loop over all datasets in the array    */
     for (lIndex = 0u; (lIndex < pDataset->numElement) && (pInfo->pSrcEnd > pInfo->pSrc); ++lIndex)
@@ -946,6 +1282,7 @@ static TRDP_ERR_T size_unmarshall (
             while (noOfItems-- > 0u)
             {
                 /* Dataset, call ourself recursively */
+
                 /* Never used before?  */
                 if (NULL == pDataset->pElement[lIndex].pCachedDS)
                 {
@@ -959,7 +1296,7 @@ static TRDP_ERR_T size_unmarshall (
                     return TRDP_COMID_ERR;
                 }
 
-                err = size_unmarshall(pInfo, pDataset->pElement[lIndex].pCachedDS);
+                err = marshallDs(pInfo, pDataset->pElement[lIndex].pCachedDS);
                 if (err != TRDP_NO_ERR)
                 {
                     return err;
@@ -980,10 +1317,14 @@ static TRDP_ERR_T size_unmarshall (
                    /*    possible variable source size    */
                    var_size = *pSrc;
 
+                   if ((pDst + noOfItems) > pInfo->pDstEnd)
+                   {
+                       return TRDP_PARAM_ERR;
+                   }
+
                    while (noOfItems-- > 0u)
                    {
-                       pDst++;
-                       pSrc++;
+                       *pDst++ = *pSrc++;
                    }
                    break;
                }
@@ -991,17 +1332,23 @@ static TRDP_ERR_T size_unmarshall (
                case TRDP_INT16:
                case TRDP_UINT16:
                {
-                   UINT16 *pDst16 = (UINT16 *) alignePtr(pDst, ALIGNOF(UINT16));
+                   UINT16 *pSrc16 = (UINT16 *) alignePtr(pSrc, ALIGNOF(UINT16));
 
                    /*    possible variable source size    */
-                   var_size = vos_ntohs(*(UINT16 *)pSrc);
+                   var_size = *pSrc16;
+
+                   if ((pDst + noOfItems * 2) > pInfo->pDstEnd)
+                   {
+                       return TRDP_PARAM_ERR;
+                   }
 
                    while (noOfItems-- > 0u)
                    {
-                       pDst16++;
-                       pSrc += 2u;
+                       *pDst++  = (UINT8) (*pSrc16 >> 8u);
+                       *pDst++  = (UINT8) (*pSrc16 & 0xFFu);
+                       pSrc16++;
                    }
-                   pDst = (UINT8 *) pDst16;
+                   pSrc = (UINT8 *) pSrc16;
                    break;
                }
                case TRDP_INT32:
@@ -1009,184 +1356,1072 @@ static TRDP_ERR_T size_unmarshall (
                case TRDP_REAL32:
                case TRDP_TIMEDATE32:
                {
-                   UINT32 *pDst32 = (UINT32 *) alignePtr(pDst, ALIGNOF(UINT32));
+                   UINT32 *pSrc32 = (UINT32 *) alignePtr(pSrc, ALIGNOF(UINT32));
 
                    /*    possible variable source size    */
-                   var_size = vos_ntohl(*(UINT32 *)pSrc);
+                   var_size = *pSrc32;
 
-                   while (noOfItems-- > 0u)
+                   if ((pDst + noOfItems * 4) > pInfo->pDstEnd)
                    {
-                       pSrc += 4u;
-                       pDst32++;
+                       return TRDP_PARAM_ERR;
                    }
-                   pDst = (UINT8 *) pDst32;
-                   break;
-               }
-               case TRDP_TIMEDATE48:
-               {
-                   /*    This is not a base type but a structure    */
-                   UINT16 *pDst16;
 
                    while (noOfItems-- > 0u)
                    {
-                       pDst16   = (UINT16 *) alignePtr(pDst, ALIGNOF(TIMEDATE48_STRUCT_T));
-                       pDst16   += 3u;
-                       pSrc     += 6u;
-                       pDst     = (UINT8 *)alignePtr((const UINT8*) pDst16, ALIGNOF(TIMEDATE48_STRUCT_T));
+                       *pDst++  = (UINT8) (*pSrc32 >> 24u);
+                       *pDst++  = (UINT8) (*pSrc32 >> 16u);
+                       *pDst++  = (UINT8) (*pSrc32 >> 8u);
+                       *pDst++  = (UINT8) (*pSrc32 & 0xFFu);
+                       pSrc32++;
                    }
+                   pSrc = (UINT8 *) pSrc32;
                    break;
                }
                case TRDP_TIMEDATE64:
                {
-                   UINT32 *pDst32;
+                   UINT32 *pSrc32 = (UINT32 *) alignePtr(pSrc, ALIGNOF(TIMEDATE64_STRUCT_T));
+
+                   if ((pDst + noOfItems * 8u) > pInfo->pDstEnd)
+                   {
+                       return TRDP_PARAM_ERR;
+                   }
 
                    while (noOfItems-- > 0u)
                    {
-                       pDst32   = (UINT32 *) alignePtr(pDst, ALIGNOF(TIMEDATE64_STRUCT_T));
-                       pSrc     += 8u;
-                       pDst32++;
-                       pDst32   = (UINT32 *) alignePtr((UINT8 *) pDst32, ALIGNOF(UINT32));
-                       pDst32++;
-                       pDst     = (UINT8 *) pDst32;
+                       *pDst++  = (UINT8) (*pSrc32 >> 24u);
+                       *pDst++  = (UINT8) (*pSrc32 >> 16u);
+                       *pDst++  = (UINT8) (*pSrc32 >> 8u);
+                       *pDst++  = (UINT8) (*pSrc32 & 0xFFu);
+                       pSrc32++;
+                       *pDst++  = (UINT8) (*pSrc32 >> 24u);
+                       *pDst++  = (UINT8) (*pSrc32 >> 16u);
+                       *pDst++  = (UINT8) (*pSrc32 >> 8u);
+                       *pDst++  = (UINT8) (*pSrc32 & 0xFFu);
+                       pSrc32++;
                    }
+                   pSrc = (UINT8 *) pSrc32;
                    break;
                }
-               case TRDP_INT64:
-               case TRDP_UINT64:
-               case TRDP_REAL64:
+               case TRDP_TIMEDATE48:
                {
-                   UINT32 *pDst32;
+                   /*    This is not a base type but a structure    */
+                   UINT32   *pSrc32;
+                   UINT16   *pSrc16;
+
+                   if (pDst + noOfItems * 6u > pInfo->pDstEnd)
+                   {
+                       return TRDP_PARAM_ERR;
+                   }
 
                    while (noOfItems-- > 0u)
                    {
-                       pDst32   = (UINT32 *) alignePtr(pDst, ALIGNOF(UINT64));
-                       pSrc     += 8u;
-                       pDst32   += 2u;
-                       pDst     = (UINT8 *) pDst32;
+                       pSrc32 =
+                           (UINT32 *) alignePtr(pSrc, ALIGNOF(TIMEDATE48_STRUCT_T));
+                       *pDst++  = (UINT8) (*pSrc32 >> 24u);
+                       *pDst++  = (UINT8) (*pSrc32 >> 16u);
+                       *pDst++  = (UINT8) (*pSrc32 >> 8u);
+                       *pDst++  = (UINT8) (*pSrc32 & 0xFFu);
+                       pSrc32++;
+                       pSrc16   = (UINT16 *) alignePtr((UINT8 *) pSrc32, ALIGNOF(UINT16));
+                       *pDst++  = (UINT8) (*pSrc16 >> 8u);
+                       *pDst++  = (UINT8) (*pSrc16 & 0xFFu);
+                       pSrc16++;
+                       pSrc16 = (UINT16 *)alignePtr((UINT8 *)pSrc16, ALIGNOF(TIMEDATE48_STRUCT_T));
+                       pSrc = (UINT8 *) pSrc16;
                    }
                    break;
                }
+               case TRDP_INT64:
+               case TRDP_UINT64:
+               case TRDP_REAL64:
+                   if ((pDst + noOfItems * 8u) > pInfo->pDstEnd)
+                   {
+                       return TRDP_PARAM_ERR;
+                   }
+
+                   packedCopy64(&pSrc, &pDst, noOfItems);
+                   break;
                default:
                    break;
             }
-
             /* Update info structure if we need to! (was issue #137) */
             pInfo->pDst = pDst;
             pInfo->pSrc = pSrc;
         }
     }
 
-    pInfo->pDst = alignePtr(pDst, maxAlignOfDSMember(pDataset));
+    pInfo->pSrc = alignePtr(pInfo->pSrc, maxAlignOfDSMember(pDataset));
 
-    if (pInfo->pSrc > pInfo->pSrcEnd)
+    if (pInfo->pSrc > pInfo->pSrcEnd ) /* Maybe one alignement bejond - do not erratically issue error! */
     {
-        return TRDP_MARSHALLING_ERR;
+        vos_printLogStr(VOS_LOG_WARNING, "Marshalling read beyond source area. Wrong Dataset size provided?\n");
     }
-    
+
     /* Decrement recursion counter. Note: Recursion counter will not decrement in case of error */
     pInfo->level--;
 
     return TRDP_NO_ERR;
 }
 
-/**********************************************************************************************************************
- * GLOBAL FUNCTIONS
- */
-
 /**********************************************************************************************************************/
-/**    Function to initialise the marshalling/unmarshalling.
- *    The supplied array must be sorted by ComIds. The array must exist during the use of the marshalling
- *    functions (until tlc_terminate()).
+/**    Unmarshall one dataset.
  *
- *  @param[in,out]  ppRefCon         Returns a pointer to be used for the reference context of marshalling/unmarshalling
- *  @param[in]      numComId         Number of datasets found in the configuration
- *  @param[in]      pComIdDsIdMap    Pointer to an array of structures of type TRDP_DATASET_T
- *  @param[in]      numDataSet       Number of datasets found in the configuration
- *  @param[in]      pDataset         Pointer to an array of pointers to structures of type TRDP_DATASET_T
+ *  @param[in,out]  pInfo           Pointer with src & dest info
+ *  @param[in]      pDataset        Pointer to one dataset
  *
- *  @retval         TRDP_NO_ERR      no error
- *  @retval         TRDP_MEM_ERR     provided buffer to small
- *  @retval         TRDP_PARAM_ERR   Parameter error
+ *  @retval         TRDP_NO_ERR             no error
+ *  @retval         TRDP_MEM_ERR            provided buffer to small
+ *  @retval         TRDP_PARAM_ERR          Parameter error
+ *  @retval         TRDP_STATE_ERR          Too deep recursion
+ *  @retval         TRDP_MARSHALLING_ERR    dataset/source size mismatch
  *
  */
 
-EXT_DECL TRDP_ERR_T tau_initMarshall (
-    void                    * *ppRefCon,
-    UINT32                  numComId,
-    TRDP_COMID_DSID_MAP_T   *pComIdDsIdMap,
-    UINT32                  numDataSet,
-    TRDP_DATASET_T          *pDataset[])
+static TRDP_ERR_T unmarshallDs (
+    TAU_MARSHALL_INFO_T *pInfo,
+    TRDP_DATASET_T      *pDataset)
 {
-    UINT32 i, j;
-
-    ppRefCon = ppRefCon;
+    TRDP_ERR_T  err;
+    UINT16      lIndex;
+    UINT32      var_size    = 0u;
+    UINT8       *pSrc       = pInfo->pSrc;
+    UINT8       *pDst       = pInfo->pDst;
 
-    if ((pDataset == NULL) || (numDataSet == 0u) || (numComId == 0u) || (pComIdDsIdMap == NULL))
+    /* Restrict recursion */
+    pInfo->level++;
+    if (pInfo->level > TAU_MAX_DS_LEVEL)
     {
-        return TRDP_PARAM_ERR;
+        return TRDP_STATE_ERR;
     }
 
-    /*    Save the pointer to the comId mapping table    */
-    sComIdDsIdMap   = pComIdDsIdMap;
-    sNumComId       = numComId;
+    pDst = alignePtr(pInfo->pDst, maxAlignOfDSMember(pDataset));
 
-    /* sort the table    */
-    vos_qsort(pComIdDsIdMap, numComId, sizeof(TRDP_COMID_DSID_MAP_T), compareComId);
+    /*    Loop over all datasets in the array    */
+    for (lIndex = 0u; (lIndex < pDataset->numElement) && (pInfo->pSrcEnd > pInfo->pSrc); ++lIndex)
+    {
+        UINT32 noOfItems = pDataset->pElement[lIndex].size;
 
-    /*    Save the pointer to the table    */
-    sDataSets   = pDataset;
-    sNumEntries = numDataSet;
+        if (TRDP_VAR_SIZE == noOfItems) /* variable size    */
+        {
+            noOfItems = var_size;
+        }
+        /*    Is this a composite type?    */
+        if (pDataset->pElement[lIndex].type > (UINT32) TRDP_TYPE_MAX)
+        {
+            while (noOfItems-- > 0u)
+            {
+                /* Dataset, call ourself recursively */
+                /* Never used before?  */
+                if (NULL == pDataset->pElement[lIndex].pCachedDS)
+                {
+                    /* Look for it   */
+                    pDataset->pElement[lIndex].pCachedDS = findDs(pDataset->pElement[lIndex].type);
+                }
+
+                if (NULL == pDataset->pElement[lIndex].pCachedDS)      /* Not in our DB    */
+                {
+                    vos_printLog(VOS_LOG_ERROR, "ComID/DatasetID (%u) unknown\n", pDataset->pElement[lIndex].type);
+                    return TRDP_COMID_ERR;
+                }
+
+                err = unmarshallDs(pInfo, pDataset->pElement[lIndex].pCachedDS);
+                if (err != TRDP_NO_ERR)
+                {
+                    return err;
+                }
+            }
+            pDst    = pInfo->pDst;
+            pSrc    = pInfo->pSrc;
+        }
+        else
+        {
+            switch (pDataset->pElement[lIndex].type)
+            {
+               case TRDP_BOOL8:
+               case TRDP_CHAR8:
+               case TRDP_INT8:
+               case TRDP_UINT8:
+               {
+                   if ((pDst + noOfItems) > pInfo->pDstEnd)
+                   {
+                       return TRDP_PARAM_ERR;
+                   }
+
+                   while (noOfItems-- > 0u)
+                   {
+                       var_size = *pSrc++;
+                       *pDst++  = (UINT8) var_size;
+                   }
+                   break;
+               }
+               case TRDP_UTF16:
+               case TRDP_INT16:
+               case TRDP_UINT16:
+               {
+                   UINT16 *pDst16 = (UINT16 *) alignePtr(pDst, ALIGNOF(UINT16));
+
+                   if ((pDst + noOfItems * 2u) > pInfo->pDstEnd)
+                   {
+                       return TRDP_PARAM_ERR;
+                   }
+
+                   while (noOfItems-- > 0u)
+                   {
+                       *pDst16  = (UINT16) (*pSrc++ << 8u);
+                       *pDst16  += *pSrc++;
+                       /*    possible variable source size    */
+                       var_size = *pDst16;
+                       pDst16++;
+                   }
+                   pDst = (UINT8 *) pDst16;
+                   break;
+               }
+               case TRDP_INT32:
+               case TRDP_UINT32:
+               case TRDP_REAL32:
+               case TRDP_TIMEDATE32:
+               {
+                   UINT32 *pDst32 = (UINT32 *) alignePtr(pDst, ALIGNOF(UINT32));
+
+                   if ((pDst + noOfItems * 4u) > pInfo->pDstEnd)
+                   {
+                       return TRDP_PARAM_ERR;
+                   }
+
+                   while (noOfItems-- > 0)
+                   {
+                       *pDst32  = ((UINT32)(*pSrc++)) << 24u;
+                       *pDst32  += ((UINT32)(*pSrc++)) << 16u;
+                       *pDst32  += ((UINT32)(*pSrc++)) << 8u;
+                       *pDst32  += *pSrc++;
+                       var_size = *pDst32;
+                       pDst32++;
+                   }
+                   pDst = (UINT8 *) pDst32;
+                   break;
+               }
+               case TRDP_TIMEDATE48:
+               {
+                   /*    This is not a base type but a structure    */
+                   UINT32   *pDst32;
+                   UINT16   *pDst16;
+
+                   if (pDst + noOfItems * 6u > pInfo->pDstEnd)
+                   {
+                       return TRDP_PARAM_ERR;
+                   }
+
+                   while (noOfItems-- > 0)
+                   {
+                       pDst32   = (UINT32 *) alignePtr(pDst, ALIGNOF(TIMEDATE48_STRUCT_T));
+                       *pDst32  = ((UINT32)(*pSrc++)) << 24u;
+                       *pDst32  += ((UINT32)(*pSrc++)) << 16u;
+                       *pDst32  += ((UINT32)(*pSrc++)) << 8u;
+                       *pDst32  += *pSrc++;
+                       pDst32++;
+                       pDst16   = (UINT16 *) alignePtr((UINT8 *)pDst32, ALIGNOF(UINT16));
+                       *pDst16  = (UINT16) (*pSrc++ << 8u);
+                       *pDst16  += *pSrc++;
+                       pDst16++;
+                       pDst = (UINT8 *) alignePtr((const UINT8*) pDst16, ALIGNOF(TIMEDATE48_STRUCT_T));
+                   }
+                   break;
+               }
+               case TRDP_TIMEDATE64:
+               {
+                   /*    This is not a base type but a structure    */
+                   UINT32 *pDst32;
+
+                   if ((pDst + noOfItems * 8u) > pInfo->pDstEnd)
+                   {
+                       return TRDP_PARAM_ERR;
+                   }
+
+                   while (noOfItems-- > 0u)
+                   {
+                       pDst32   = (UINT32 *) alignePtr(pDst, ALIGNOF(TIMEDATE64_STRUCT_T));
+                       *pDst32  = ((UINT32)(*pSrc++)) << 24u;
+                       *pDst32  += ((UINT32)(*pSrc++)) << 16u;
+                       *pDst32  += ((UINT32)(*pSrc++)) << 8u;
+                       *pDst32  += *pSrc++;
+                       pDst32++;
+                       pDst32   = (UINT32 *) alignePtr((UINT8 *)pDst32, ALIGNOF(UINT32));
+                       *pDst32  = ((UINT32)(*pSrc++)) << 24u;
+                       *pDst32  += ((UINT32)(*pSrc++)) << 16u;
+                       *pDst32  += ((UINT32)(*pSrc++)) << 8u;
+                       *pDst32  += *pSrc++;
+                       pDst32++;
+                       pDst = (UINT8 *) pDst32;
+                   }
+                   break;
+               }
+               case TRDP_INT64:
+               case TRDP_UINT64:
+               case TRDP_REAL64:
+               {
+                   if (pDst + noOfItems * 8u > pInfo->pDstEnd)
+                   {
+                       return TRDP_PARAM_ERR;
+                   }
+
+                   unpackedCopy64((UINT8 * *) &pSrc, &pDst, noOfItems);
+                   break;
+               }
+               default:
+                   break;
+            }
+            pInfo->pDst = pDst;
+            pInfo->pSrc = pSrc;
+        }
+    }
+
+    pInfo->pDst = alignePtr(pInfo->pDst, maxAlignOfDSMember(pDataset));
+
+    if (pInfo->pSrc > pInfo->pSrcEnd)
+    {
+        return TRDP_MARSHALLING_ERR;
+    }
+
+    /* Decrement recursion counter. Note: Recursion counter will not decrement in case of error */
+    pInfo->level--;
+
+    return TRDP_NO_ERR;
+}
+
+/**********************************************************************************************************************/
+/**    Compute unmarshalled size of one dataset.
+ *
+ *  @param[in,out]  pInfo           Pointer with src & dest info
+ *  @param[in]      pDataset        Pointer to one dataset
+ *
+ *  @retval         TRDP_NO_ERR             no error
+ *  @retval         TRDP_MEM_ERR            provided buffer to small
+ *  @retval         TRDP_PARAM_ERR          Parameter error
+ *  @retval         TRDP_STATE_ERR          Too deep recursion
+ *  @retval         TRDP_MARSHALLING_ERR    dataset/source size mismatch
+ *
+ */
+
+static TRDP_ERR_T size_unmarshall (
+    TAU_MARSHALL_INFO_T *pInfo,
+    TRDP_DATASET_T      *pDataset)
+{
+    TRDP_ERR_T  err;
+    UINT16      lIndex;
+    UINT32      var_size    = 0u;
+    UINT8       *pSrc       = pInfo->pSrc;
+    UINT8       *pDst;
+
+    /* Restrict recursion */
+    pInfo->level++;
+    if (pInfo->level > TAU_MAX_DS_LEVEL)
+    {
+        return TRDP_STATE_ERR;
+    }
+
+    pDst = alignePtr(pInfo->pDst, maxAlignOfDSMember(pDataset));
+
+    /*    Loop over all datasets in the array    */
+    for (lIndex = 0u; (lIndex < pDataset->numElement) && (pInfo->pSrcEnd > pInfo->pSrc); ++lIndex)
+    {
+        UINT32 noOfItems = pDataset->pElement[lIndex].size;
+
+        if (TRDP_VAR_SIZE == noOfItems) /* variable size    */
+        {
+            noOfItems = var_size;
+        }
+
+        /*    Is this a composite type?    */
+        if (pDataset->pElement[lIndex].type > (UINT32) TRDP_TYPE_MAX)
+        {
+            while (noOfItems-- > 0u)
+            {
+                /* Dataset, call ourself recursively */
+                /* Never used before?  */
+                if (NULL == pDataset->pElement[lIndex].pCachedDS)
+                {
+                    /* Look for it   */
+                    pDataset->pElement[lIndex].pCachedDS = findDs(pDataset->pElement[lIndex].type);
+                }
+
+                if (NULL == pDataset->pElement[lIndex].pCachedDS)      /* Not in our DB    */
+                {
+                    vos_printLog(VOS_LOG_ERROR, "ComID/DatasetID (%u) unknown\n", pDataset->pElement[lIndex].type);
+                    return TRDP_COMID_ERR;
+                }
+
+                err = size_unmarshall(pInfo, pDataset->pElement[lIndex].pCachedDS);
+                if (err != TRDP_NO_ERR)
+                {
+                    return err;
+                }
+                pDst    = pInfo->pDst;
+                pSrc    = pInfo->pSrc;
+            }
+        }
+        else
+        {
+            switch (pDataset->pElement[lIndex].type)
+            {
+               case TRDP_BOOL8:
+               case TRDP_CHAR8:
+               case TRDP_INT8:
+               case TRDP_UINT8:
+               {
+                   /*    possible variable source size    */
+                   var_size = *pSrc;
+
+                   while (noOfItems-- > 0u)
+                   {
+                       pDst++;
+                       pSrc++;
+                   }
+                   break;
+               }
+               case TRDP_UTF16:
+               case TRDP_INT16:
+               case TRDP_UINT16:
+               {
+                   UINT16 *pDst16 = (UINT16 *) alignePtr(pDst, ALIGNOF(UINT16));
+
+                   /*    possible variable source size    */
+                   var_size = vos_ntohs(*(UINT16 *)pSrc);
+
+                   while (noOfItems-- > 0u)
+                   {
+                       pDst16++;
+                       pSrc += 2u;
+                   }
+                   pDst = (UINT8 *) pDst16;
+                   break;
+               }
+               case TRDP_INT32:
+               case TRDP_UINT32:
+               case TRDP_REAL32:
+               case TRDP_TIMEDATE32:
+               {
+                   UINT32 *pDst32 = (UINT32 *) alignePtr(pDst, ALIGNOF(UINT32));
+
+                   /*    possible variable source size    */
+                   var_size = vos_ntohl(*(UINT32 *)pSrc);
+
+                   while (noOfItems-- > 0u)
+                   {
+                       pSrc += 4u;
+                       pDst32++;
+                   }
+                   pDst = (UINT8 *) pDst32;
+                   break;
+               }
+               case TRDP_TIMEDATE48:
+               {
+                   /*    This is not a base type but a structure    */
+                   UINT16 *pDst16;
+
+                   while (noOfItems-- > 0u)
+                   {
+                       pDst16   = (UINT16 *) alignePtr(pDst, ALIGNOF(TIMEDATE48_STRUCT_T));
+                       pDst16   += 3u;
+                       pSrc     += 6u;
+                       pDst     = (UINT8 *)alignePtr((const UINT8*) pDst16, ALIGNOF(TIMEDATE48_STRUCT_T));
+                   }
+                   break;
+               }
+               case TRDP_TIMEDATE64:
+               {
+                   UINT32 *pDst32;
+
+                   while (noOfItems-- > 0u)
+                   {
+                       pDst32   = (UINT32 *) alignePtr(pDst, ALIGNOF(TIMEDATE64_STRUCT_T));
+                       pSrc     += 8u;
+                       pDst32++;
+                       pDst32   = (UINT32 *) alignePtr((UINT8 *) pDst32, ALIGNOF(UINT32));
+                       pDst32++;
+                       pDst     = (UINT8 *) pDst32;
+                   }
+                   break;
+               }
+               case TRDP_INT64:
+               case TRDP_UINT64:
+               case TRDP_REAL64:
+               {
+                   UINT32 *pDst32;
+
+                   while (noOfItems-- > 0u)
+                   {
+                       pDst32   = (UINT32 *) alignePtr(pDst, ALIGNOF(UINT64));
+                       pSrc     += 8u;
+                       pDst32   += 2u;
+                       pDst     = (UINT8 *) pDst32;
+                   }
+                   break;
+               }
+               default:
+                   break;
+            }
+
+            /* Update info structure if we need to! (was issue #137) */
+            pInfo->pDst = pDst;
+            pInfo->pSrc = pSrc;
+        }
+    }
+
+    pInfo->pDst = alignePtr(pDst, maxAlignOfDSMember(pDataset));
+
+    if (pInfo->pSrc > pInfo->pSrcEnd)
+    {
+        return TRDP_MARSHALLING_ERR;
+    }
+    
+    /* Decrement recursion counter. Note: Recursion counter will not decrement in case of error */
+    pInfo->level--;
+
+    return TRDP_NO_ERR;
+}
+
+/**********************************************************************************************************************
+ * GLOBAL FUNCTIONS
+ */
+
+/**********************************************************************************************************************/
+/**    Function to initialise the marshalling/unmarshalling.
+ *    The supplied array must be sorted by ComIds. The array must exist during the use of the marshalling
+ *    functions (until tlc_terminate()).
+ *
+ *  @param[in,out]  ppRefCon         Returns a pointer to be used for the reference context of marshalling/unmarshalling
+ *  @param[in]      numComId         Number of datasets found in the configuration
+ *  @param[in]      pComIdDsIdMap    Pointer to an array of structures of type TRDP_DATASET_T
+ *  @param[in]      numDataSet       Number of datasets found in the configuration
+ *  @param[in]      pDataset         Pointer to an array of pointers to structures of type TRDP_DATASET_T
+ *
+ *  @retval         TRDP_NO_ERR      no error
+ *  @retval         TRDP_MEM_ERR     provided buffer to small
+ *  @retval         TRDP_PARAM_ERR   Parameter error
+ *
+ */
+
+EXT_DECL TRDP_ERR_T tau_initMarshall (
+    void                    * *ppRefCon,
+    UINT32                  numComId,
+    TRDP_COMID_DSID_MAP_T   *pComIdDsIdMap,
+    UINT32                  numDataSet,
+    TRDP_DATASET_T          *pDataset[])
+{
+    UINT32 i, j;
+
+    ppRefCon = ppRefCon;
+
+    if ((pDataset == NULL) || (numDataSet == 0u) || (numComId == 0u) || (pComIdDsIdMap == NULL))
+    {
+        return TRDP_PARAM_ERR;
+    }
+
+    /*    Save the pointer to the comId mapping table    */
+    sComIdDsIdMap   = pComIdDsIdMap;
+    sNumComId       = numComId;
+
+    /* sort the table    */
+    vos_qsort(pComIdDsIdMap, numComId, sizeof(TRDP_COMID_DSID_MAP_T), compareComId);
+
+    /*    Save the pointer to the table    */
+    sDataSets   = pDataset;
+    sNumEntries = numDataSet;
+
+    /* invalidate the cache */
+    for (i = 0u; i < numDataSet; i++)
+    {
+        for (j = 0u; j < pDataset[i]->numElement; j++)
+        {
+            pDataset[i]->pElement[j].pCachedDS = NULL;
+        }
+    }
+    /* sort the table    */
+    vos_qsort(pDataset, numDataSet, sizeof(TRDP_DATASET_T *), compareDataset);
+
+    /* classify the datasets, without information they are marshalled element by element */
+    if (NULL != sDsInfo)
+    {
+        vos_memFree(sDsInfo);
+    }
+    sDsInfo = (TAU_DS_INFO_T *) vos_memAlloc(numDataSet * sizeof(TAU_DS_INFO_T));
+    for (i = 0u; i < numDataSet; i++)
+    {
+        UINT32  hostSize    = 0u;
+        UINT32  wireSize    = 0u;
+        BOOL8   identity    = TRUE;
+
+        pDataset[i]->reserved1 = 0u;
+        if ((NULL == sDsInfo) || (i >= 0xFFFFu))
+        {
+            continue;
+        }
+        pDataset[i]->reserved1 = (UINT16) (i + 1u);
+        if (!fixedLayout(pDataset[i], &hostSize, &wireSize, &identity, 1u) || (0u == wireSize))
+        {
+            hostSize    = 0u;
+            wireSize    = 0u;
+            identity    = FALSE;
+        }
+        sDsInfo[i].layout   = (identity) ? TAU_LAYOUT_IDENTITY : TAU_LAYOUT_MARSHALL;
+        sDsInfo[i].wireSize = wireSize;
+        sDsInfo[i].hostSize = hostSize;
+    }
+
+    return TRDP_NO_ERR;
+}
+
+/**********************************************************************************************************************/
+/**    marshall function.
+ *
+ *  @param[in]      pRefCon         pointer to user context
+ *  @param[in]      comId           ComId to identify the structure out of a configuration
+ *  @param[in]      pSrc            pointer to received original message
+ *  @param[in]      srcSize         size of the source buffer
+ *  @param[in]      pDest           pointer to a buffer for the treated message
+ *  @param[in,out]  pDestSize       size of the provide buffer / size of the treated message
+ *  @param[in,out]  ppDSPointer     pointer to pointer to cached dataset
+ *                                  set NULL if not used, set content NULL if unknown
+ *
+ *  @retval         TRDP_NO_ERR             no error
+ *  @retval         TRDP_MEM_ERR            provided buffer to small
+ *  @retval         TRDP_PARAM_ERR          Parameter error
+ *  @retval         TRDP_STATE_ERR          Too deep recursion
+ *  @retval         TRDP_MARSHALLING_ERR    dataset/source size mismatch
+ *
+ */
+
+EXT_DECL TRDP_ERR_T tau_marshall (
+    void            *pRefCon,
+    UINT32          comId,
+    UINT8           *pSrc,
+    UINT32          srcSize,
+    UINT8           *pDest,
+    UINT32          *pDestSize,
+    TRDP_DATASET_T  * *ppDSPointer)
+{
+    TRDP_ERR_T          err;
+    TRDP_DATASET_T      *pDataset;
+    TAU_MARSHALL_INFO_T info;
+
+    pRefCon = pRefCon;
+
+    if ((0u == comId) || (NULL == pSrc) || (NULL == pDest) || (NULL == pDestSize) || (0u == *pDestSize))
+    {
+        return TRDP_PARAM_ERR;
+    }
+
+    /* Can we use the formerly cached value? */
+    if (NULL != ppDSPointer)
+    {
+        if (NULL == *ppDSPointer)
+        {
+            *ppDSPointer = findDSFromComId(comId);
+        }
+        pDataset = *ppDSPointer;
+    }
+    else
+    {
+        pDataset = findDSFromComId(comId);
+    }
+
+    if (NULL == pDataset)   /* Not in our DB    */
+    {
+        vos_printLog(VOS_LOG_ERROR, "ComID/DatasetID (%u) unknown\n", comId);
+        return TRDP_COMID_ERR;
+    }
+
+    if (identityCopy(pDataset, pSrc, srcSize, pDest, pDestSize, FALSE, &err))
+    {
+        return err;
+    }
+
+    info.level      = 0u;
+    info.pSrc       = pSrc;
+    info.pSrcEnd    = pSrc + srcSize;
+    info.pDst       = pDest;
+    info.pDstEnd    = pDest + *pDestSize;
+
+    err = marshallDs(&info, pDataset);
+
+    *pDestSize = (UINT32) (info.pDst - pDest);
+
+    return err;
+}
+
+/**********************************************************************************************************************/
+/**    unmarshall function.
+ *
+ *  @param[in]      pRefCon         pointer to user context
+ *  @param[in]      comId           ComId to identify the structure out of a configuration
+ *  @param[in]      pSrc            pointer to received original message
+ *  @param[in]      srcSize         size of the source buffer
+ *  @param[in]      pDest           pointer to a buffer for the treated message
+ *  @param[in,out]  pDestSize       size of the provide buffer / size of the treated message
+ *  @param[in,out]  ppDSPointer     pointer to pointer to cached dataset
+ *                                  set NULL if not used, set content NULL if unknown
+ *
+ *  @retval         TRDP_INIT_ERR           marshalling not initialised
+ *  @retval         TRDP_NO_ERR             no error
+ *  @retval         TRDP_MEM_ERR            provided buffer to small
+ *  @retval         TRDP_PARAM_ERR          Parameter error
+ *  @retval         TRDP_STATE_ERR          Too deep recursion
+ *  @retval         TRDP_COMID_ERR          comid not existing
+ *  @retval         TRDP_MARSHALLING_ERR    dataset/source size mismatch
+ *
+ */
+
+EXT_DECL TRDP_ERR_T tau_unmarshall (
+    void            *pRefCon,
+    UINT32          comId,
+    UINT8           *pSrc,
+    UINT32          srcSize,
+    UINT8           *pDest,
+    UINT32          *pDestSize,
+    TRDP_DATASET_T  * *ppDSPointer)
+{
+    TRDP_ERR_T          err;
+    TRDP_DATASET_T      *pDataset;
+    TAU_MARSHALL_INFO_T info;
+
+    pRefCon = pRefCon;
+
+    if ((0u == comId) || (NULL == pSrc) || (NULL == pDest) || (NULL == pDestSize) || (0u == *pDestSize))
+    {
+        return TRDP_PARAM_ERR;
+    }
+
+    /* Can we use the formerly cached value? */
+    if (NULL != ppDSPointer)
+    {
+        if (NULL == *ppDSPointer)
+        {
+            *ppDSPointer = findDSFromComId(comId);
+        }
+        pDataset = *ppDSPointer;
+    }
+    else
+    {
+        pDataset = findDSFromComId(comId);
+    }
+
+    if (NULL == pDataset)   /* Not in our DB    */
+    {
+        vos_printLog(VOS_LOG_ERROR, "ComID/DatasetID (%u) unknown\n", comId);
+        return TRDP_COMID_ERR;
+    }
+
+    if (identityCopy(pDataset, pSrc, srcSize, pDest, pDestSize, TRUE, &err))
+    {
+        return err;
+    }
+
+    info.level      = 0u;
+    info.pSrc       = pSrc;
+    info.pSrcEnd    = pSrc + srcSize;
+    info.pDst       = pDest;
+    info.pDstEnd    = pDest + *pDestSize;
+
+    err = unmarshallDs(&info, pDataset);
+
+    *pDestSize = (UINT32) (info.pDst - pDest);
+
+    return err;
+}
+
+
+/**********************************************************************************************************************/
+/**    marshall data set function.
+ *
+ *  @param[in]      pRefCon         pointer to user context
+ *  @param[in]      dsId            Data set id to identify the structure out of a configuration
+ *  @param[in]      pSrc            pointer to received original message
+ *  @param[in]      srcSize         size of the source buffer
+ *  @param[in]      pDest           pointer to a buffer for the treated message
+ *  @param[in,out]  pDestSize       size of the provide buffer / size of the treated message
+ *  @param[in,out]  ppDSPointer     pointer to pointer to cached dataset
+ *                                  set NULL if not used, set content NULL if unknown
+ *
+ *  @retval         TRDP_INIT_ERR           marshalling not initialised
+ *  @retval         TRDP_NO_ERR             no error
+ *  @retval         TRDP_MEM_ERR            provided buffer to small
+ *  @retval         TRDP_PARAM_ERR          Parameter error
+ *  @retval         TRDP_STATE_ERR          Too deep recursion
+ *  @retval         TRDP_COMID_ERR          comid not existing
+ *  @retval         TRDP_MARSHALLING_ERR    dataset/source size mismatch
+ *
+ */
+
+EXT_DECL TRDP_ERR_T tau_marshallDs (
+    void            *pRefCon,
+    UINT32          dsId,
+    UINT8           *pSrc,
+    UINT32          srcSize,
+    UINT8           *pDest,
+    UINT32          *pDestSize,
+    TRDP_DATASET_T  * *ppDSPointer)
+{
+    TRDP_ERR_T          err;
+    TRDP_DATASET_T      *pDataset;
+    TAU_MARSHALL_INFO_T info;
+
+    pRefCon = pRefCon;
+
+    if ((0u == dsId) || (NULL == pSrc) || (NULL == pDest) || (NULL == pDestSize) || (0u == *pDestSize))
+    {
+        return TRDP_PARAM_ERR;
+    }
+
+    /* Can we use the formerly cached value? */
+    if (NULL != ppDSPointer)
+    {
+        if (NULL == *ppDSPointer)
+        {
+            *ppDSPointer = findDs(dsId);
+        }
+        pDataset = *ppDSPointer;
+    }
+    else
+    {
+        pDataset = findDs(dsId);
+    }
+
+    if (NULL == pDataset)   /* Not in our DB    */
+    {
+        vos_printLog(VOS_LOG_ERROR, "ComID/DatasetID (%u) unknown\n", dsId);
+        return TRDP_COMID_ERR;
+    }
+
+    if (identityCopy(pDataset, pSrc, srcSize, pDest, pDestSize, FALSE, &err))
+    {
+        return err;
+    }
+
+    info.level      = 0u;
+    info.pSrc       = pSrc;
+    info.pSrcEnd    = pSrc + srcSize;
+    info.pDst       = pDest;
+    info.pDstEnd    = pDest + *pDestSize;
+
+    err = marshallDs(&info, pDataset);
+
+    *pDestSize = (UINT32) (info.pDst - pDest);
+
+    return err;
+}
+
+/**********************************************************************************************************************/
+/**    unmarshall data set function.
+ *
+ *  @param[in]      pRefCon         pointer to user context
+ *  @param[in]      dsId            Data set id to identify the structure out of a configuration
+ *  @param[in]      pSrc            pointer to received original message
+ *  @param[in]      srcSize         size of the source buffer
+ *  @param[in]      pDest           pointer to a buffer for the treated message
+ *  @param[in,out]  pDestSize       size of the provide buffer / size of the treated message
+ *  @param[in,out]  ppDSPointer     pointer to pointer to cached dataset
+ *                                  set NULL if not used, set content NULL if unknown
+ *
+ *  @retval         TRDP_INIT_ERR           marshalling not initialised
+ *  @retval         TRDP_NO_ERR             no error
+ *  @retval         TRDP_MEM_ERR            provided buffer to small
+ *  @retval         TRDP_PARAM_ERR          Parameter error
+ *  @retval         TRDP_STATE_ERR          Too deep recursion
+ *  @retval         TRDP_COMID_ERR          comid not existing
+ *  @retval         TRDP_MARSHALLING_ERR    dataset/source size mismatch
+ *
+ */
+
+EXT_DECL TRDP_ERR_T tau_unmarshallDs (
+    void            *pRefCon,
+    UINT32          dsId,
+    UINT8           *pSrc,
+    UINT32          srcSize,
+    UINT8           *pDest,
+    UINT32          *pDestSize,
+    TRDP_DATASET_T  * *ppDSPointer)
+{
+    TRDP_ERR_T          err;
+    TRDP_DATASET_T      *pDataset;
+    TAU_MARSHALL_INFO_T info;
+
+    pRefCon = pRefCon;
+
+    if ((0u == dsId) || (NULL == pSrc) || (NULL == pDest) || (NULL == pDestSize) || (0u == *pDestSize))
+    {
+        return TRDP_PARAM_ERR;
+    }
+
+    /* Can we use the formerly cached value? */
+    if (NULL != ppDSPointer)
+    {
+        if (NULL == *ppDSPointer)
+        {
+            *ppDSPointer = findDs(dsId);
+        }
+        pDataset = *ppDSPointer;
+    }
+    else
+    {
+        pDataset = findDs(dsId);
+    }
+
+    if (NULL == pDataset)   /* Not in our DB    */
+    {
+        vos_printLog(VOS_LOG_ERROR, "ComID/DatasetID (%u) unknown\n", dsId);
+        return TRDP_COMID_ERR;
+    }
+
+    if (identityCopy(pDataset, pSrc, srcSize, pDest, pDestSize, TRUE, &err))
+    {
+        return err;
+    }
+
+    info.level      = 0u;
+    info.pSrc       = pSrc;
+    info.pSrcEnd    = pSrc + srcSize;
+    info.pDst       = pDest;
+    info.pDstEnd    = pDest + *pDestSize;
+
+    err = unmarshallDs(&info, pDataset);
+
+    *pDestSize = (UINT32) (info.pDst - pDest);
+
+    return err;
+}
+
+
+/**********************************************************************************************************************/
+/**    Unmarshall into a buffer of the needed size.
+ *  Fixed size datasets get a buffer of the size cached by tau_initMarshall. Otherwise the buffer is estimated from
+ *  the marshalled size; only if that is too small, the exact size is computed and the unmarshalling repeated.
+ *
+ *  @param[in]      pRefCon         pointer to user context
+ *  @param[in]      comId           ComId to identify the structure out of a configuration
+ *  @param[in]      pSrc            pointer to received original message
+ *  @param[in]      srcSize         size of the source buffer
+ *  @param[out]     ppDest          pointer to the unmarshalled data, to be freed with vos_memFree()
+ *  @param[out]     pDestSize       size of the unmarshalled data
+ *  @param[in,out]  ppDSPointer     pointer to pointer to cached dataset
+ *                                  set NULL if not used, set content NULL if unknown
+ *
+ *  @retval         TRDP_NO_ERR             no error
+ *  @retval         TRDP_MEM_ERR            out of memory
+ *  @retval         TRDP_PARAM_ERR          Parameter error
+ *  @retval         TRDP_COMID_ERR          comid not existing
+ *  @retval         TRDP_STATE_ERR          Too deep recursion
+ *  @retval         TRDP_MARSHALLING_ERR    dataset/source size mismatch
+ *
+ */
+
+EXT_DECL TRDP_ERR_T tau_unmarshallAlloc (
+    void            *pRefCon,
+    UINT32          comId,
+    UINT8           *pSrc,
+    UINT32          srcSize,
+    UINT8           * *ppDest,
+    UINT32          *pDestSize,
+    TRDP_DATASET_T  * *ppDSPointer)
+{
+    TRDP_ERR_T          err;
+    TRDP_DATASET_T      *pDataset = NULL;
+    const TAU_DS_INFO_T *pInfo;
+    UINT8               *pDest;
+    UINT32              size;
+    UINT32              attempt;
+
+    if ((0u == comId) || (NULL == pSrc) || (NULL == ppDest) || (NULL == pDestSize))
+    {
+        return TRDP_PARAM_ERR;
+    }
+
+    /* Can we use the formerly cached value? */
+    if (NULL == ppDSPointer)
+    {
+        ppDSPointer = &pDataset;
+    }
+    if (NULL == *ppDSPointer)
+    {
+        *ppDSPointer = findDSFromComId(comId);
+    }
+    if (NULL == *ppDSPointer)   /* Not in our DB    */
+    {
+        vos_printLog(VOS_LOG_ERROR, "ComID/DatasetID (%u) unknown\n", comId);
+        return TRDP_COMID_ERR;
+    }
+
+    /*  Padding and TIMEDATE48 rarely make the host data more than twice as large  */
+    pInfo   = dsInfo(*ppDSPointer);
+    size    = ((NULL != pInfo) && (0u != pInfo->hostSize) && (srcSize >= pInfo->wireSize)) ?
+        pInfo->hostSize : 2u * srcSize + 8u;
 
-    /* invalidate the cache */
-    for (i = 0u; i < numDataSet; i++)
+    for (attempt = 0u; attempt < 2u; attempt++)
     {
-        for (j = 0u; j < pDataset[i]->numElement; j++)
+        pDest = vos_memAlloc(size);
+        if (NULL == pDest)
         {
-            pDataset[i]->pElement[j].pCachedDS = NULL;
+            return TRDP_MEM_ERR;
+        }
+        *pDestSize  = size;
+        err         = tau_unmarshall(pRefCon, comId, pSrc, srcSize, pDest, pDestSize, ppDSPointer);
+        if (err == TRDP_NO_ERR)
+        {
+            *ppDest = pDest;
+            return TRDP_NO_ERR;
+        }
+        vos_memFree(pDest);
+        if ((err != TRDP_PARAM_ERR) || (attempt > 0u))
+        {
+            return err;
         }
-    }
-    /* sort the table    */
-    vos_qsort(pDataset, numDataSet, sizeof(TRDP_DATASET_T *), compareDataset);
 
-    return TRDP_NO_ERR;
+        /*  Estimate too small  */
+        err = tau_calcDatasetSizeByComId(pRefCon, comId, pSrc, srcSize, &size, ppDSPointer);
+        if ((err != TRDP_NO_ERR) || (0u == size))
+        {
+            return (err != TRDP_NO_ERR) ? err : TRDP_PARAM_ERR;
+        }
+    }
+    return TRDP_PARAM_ERR;
 }
 
 /**********************************************************************************************************************/
-/**    marshall function.
+/**    Calculate data set size by given data set id.
  *
- *  @param[in]      pRefCon         pointer to user context
- *  @param[in]      comId           ComId to identify the structure out of a configuration
- *  @param[in]      pSrc            pointer to received original message
+ *  @param[in]      pRefCon         Pointer to user context
+ *  @param[in]      dsId            Dataset id to identify the structure out of a configuration
+ *  @param[in]      pSrc            Pointer to received original message
  *  @param[in]      srcSize         size of the source buffer
- *  @param[in]      pDest           pointer to a buffer for the treated message
- *  @param[in,out]  pDestSize       size of the provide buffer / size of the treated message
- *  @param[in,out]  ppDSPointer     pointer to pointer to cached dataset
+ *  @param[out]     pDestSize       Pointer to the size of the data set
+ *  @param[in,out]  ppDSPointer     pointer to pointer to cached dataset,
  *                                  set NULL if not used, set content NULL if unknown
  *
+ *  @retval         TRDP_INIT_ERR           marshalling not initialised
  *  @retval         TRDP_NO_ERR             no error
  *  @retval         TRDP_MEM_ERR            provided buffer to small
  *  @retval         TRDP_PARAM_ERR          Parameter error
  *  @retval         TRDP_STATE_ERR          Too deep recursion
+ *  @retval         TRDP_COMID_ERR          comid not existing
  *  @retval         TRDP_MARSHALLING_ERR    dataset/source size mismatch
  *
  */
 
-EXT_DECL TRDP_ERR_T tau_marshall (
+EXT_DECL TRDP_ERR_T tau_calcDatasetSize (
     void            *pRefCon,
-    UINT32          comId,
+    UINT32          dsId,
     UINT8           *pSrc,
     UINT32          srcSize,
-    UINT8           *pDest,
     UINT32          *pDestSize,
     TRDP_DATASET_T  * *ppDSPointer)
 {
     TRDP_ERR_T          err;
     TRDP_DATASET_T      *pDataset;
     TAU_MARSHALL_INFO_T info;
+    const TAU_DS_INFO_T *pInfo;
 
     pRefCon = pRefCon;
 
-    if ((0u == comId) || (NULL == pSrc) || (NULL == pDest) || (NULL == pDestSize) || (0u == *pDestSize))
+    if ((0u == dsId) || (NULL == pSrc) || (NULL == pDestSize))
     {
         return TRDP_PARAM_ERR;
     }
@@ -1196,44 +2431,50 @@ EXT_DECL TRDP_ERR_T tau_marshall (
     {
         if (NULL == *ppDSPointer)
         {
-            *ppDSPointer = findDSFromComId(comId);
+            *ppDSPointer = findDs(dsId);
         }
         pDataset = *ppDSPointer;
     }
     else
     {
-        pDataset = findDSFromComId(comId);
+        pDataset = findDs(dsId);
     }
 
     if (NULL == pDataset)   /* Not in our DB    */
     {
-        vos_printLog(VOS_LOG_ERROR, "ComID/DatasetID (%u) unknown\n", comId);
+        vos_printLog(VOS_LOG_ERROR, "ComID/DatasetID (%u) unknown\n", dsId);
         return TRDP_COMID_ERR;
     }
 
+    /* Fixed size datasets need no walk through the data  */
+    pInfo = dsInfo(pDataset);
+    if ((NULL != pInfo) && (0u != pInfo->hostSize) && (srcSize >= pInfo->wireSize))
+    {
+        *pDestSize = pInfo->hostSize;
+        return TRDP_NO_ERR;
+    }
+
     info.level      = 0u;
     info.pSrc       = pSrc;
     info.pSrcEnd    = pSrc + srcSize;
-    info.pDst       = pDest;
-    info.pDstEnd    = pDest + *pDestSize;
+    info.pDst       = 0u;
 
-    err = marshallDs(&info, pDataset);
+    err = size_unmarshall(&info, pDataset);
 
-    *pDestSize = (UINT32) (info.pDst - pDest);
+    *pDestSize = (UINT32) (info.pDst - (UINT8*) NULL);  /*lint !e413 Subtract pointer to emphasize size calculation */
 
     return err;
 }
 
 /**********************************************************************************************************************/
-/**    unmarshall function.
+/**    Calculate data set size by given ComId.
  *
- *  @param[in]      pRefCon         pointer to user context
- *  @param[in]      comId           ComId to identify the structure out of a configuration
- *  @param[in]      pSrc            pointer to received original message
+ *  @param[in]      pRefCon         Pointer to user context
+ *  @param[in]      comId           ComId id to identify the structure out of a configuration
+ *  @param[in]      pSrc            Pointer to received original message
  *  @param[in]      srcSize         size of the source buffer
- *  @param[in]      pDest           pointer to a buffer for the treated message
- *  @param[in,out]  pDestSize       size of the provide buffer / size of the treated message
- *  @param[in,out]  ppDSPointer     pointer to pointer to cached dataset
+ *  @param[out]     pDestSize       Pointer to the size of the data set
+ *  @param[in,out]  ppDSPointer     pointer to pointer to cached dataset,
  *                                  set NULL if not used, set content NULL if unknown
  *
  *  @retval         TRDP_INIT_ERR           marshalling not initialised
@@ -1246,22 +2487,22 @@ EXT_DECL TRDP_ERR_T tau_marshall (
  *
  */
 
-EXT_DECL TRDP_ERR_T tau_unmarshall (
+EXT_DECL TRDP_ERR_T tau_calcDatasetSizeByComId (
     void            *pRefCon,
     UINT32          comId,
     UINT8           *pSrc,
     UINT32          srcSize,
-    UINT8           *pDest,
     UINT32          *pDestSize,
     TRDP_DATASET_T  * *ppDSPointer)
 {
     TRDP_ERR_T          err;
     TRDP_DATASET_T      *pDataset;
     TAU_MARSHALL_INFO_T info;
+    const TAU_DS_INFO_T *pInfo;
 
     pRefCon = pRefCon;
 
-    if ((0u == comId) || (NULL == pSrc) || (NULL == pDest) || (NULL == pDestSize) || (0u == *pDestSize))
+    if ((0u == comId) || (NULL == pSrc) || (NULL == pDestSize))
     {
         return TRDP_PARAM_ERR;
     }
@@ -1286,311 +2527,641 @@ EXT_DECL TRDP_ERR_T tau_unmarshall (
         return TRDP_COMID_ERR;
     }
 
+    /* Fixed size datasets need no walk through the data  */
+    pInfo = dsInfo(pDataset);
+    if ((NULL != pInfo) && (0u != pInfo->hostSize) && (srcSize >= pInfo->wireSize))
+    {
+        *pDestSize = pInfo->hostSize;
+        return TRDP_NO_ERR;
+    }
+
     info.level      = 0u;
     info.pSrc       = pSrc;
     info.pSrcEnd    = pSrc + srcSize;
-    info.pDst       = pDest;
-    info.pDstEnd    = pDest + *pDestSize;
+    info.pDst       = 0u;
 
-    err = unmarshallDs(&info, pDataset);
+    err = size_unmarshall(&info, pDataset);
 
-    *pDestSize = (UINT32) (info.pDst - pDest);
+    *pDestSize = (UINT32) (info.pDst - (UINT8*) NULL); /*lint !e413 Subtract pointer to emphasize size calculation */
 
     return err;
 }
 
+/**********************************************************************************************************************/
+/**    Get the fields of the marshalled dataset of a ComId for change detection (see tlp_setChangeFilter).
+ *  Each element of the dataset becomes one field, nested datasets and arrays included. The offsets of the elements
+ *  following a variable sized element depend on the data, so that element becomes the last field, reaching up to the
+ *  end of the data. The same applies if there are more elements than fields provided.
+ *  The deadbands are set to 0 and may be adjusted by the caller.
+ *
+ *  @param[in]      pRefCon         Pointer to user context
+ *  @param[in]      comId           ComId to identify the structure out of a configuration
+ *  @param[out]     pFields         Pointer to an array of fields
+ *  @param[in,out]  pNoOfFields     in: size of the array, out: number of fields
+ *
+ *  @retval         TRDP_NO_ERR     no error
+ *  @retval         TRDP_PARAM_ERR  Parameter error
+ *  @retval         TRDP_COMID_ERR  comid not existing
+ *
+ */
+
+EXT_DECL TRDP_ERR_T tau_getFieldsByComId (
+    void            *pRefCon,
+    UINT32          comId,
+    TRDP_PD_FIELD_T *pFields,
+    UINT32          *pNoOfFields)
+{
+    TRDP_DATASET_T  *pDataset;
+    UINT32          offset  = 0u;
+    UINT32          count   = 0u;
+    UINT32          itemSize;
+    UINT16          lIndex;
+
+    pRefCon = pRefCon;
+
+    if ((0u == comId) || (NULL == pFields) || (NULL == pNoOfFields) || (0u == *pNoOfFields))
+    {
+        return TRDP_PARAM_ERR;
+    }
+
+    pDataset = findDSFromComId(comId);
+    if (NULL == pDataset)   /* Not in our DB    */
+    {
+        vos_printLog(VOS_LOG_ERROR, "ComID/DatasetID (%u) unknown\n", comId);
+        return TRDP_COMID_ERR;
+    }
+
+    for (lIndex = 0u; (lIndex < pDataset->numElement) && (count < *pNoOfFields); lIndex++)
+    {
+        if (pDataset->pElement[lIndex].type <= TRDP_TIMEDATE64)
+        {
+            itemSize = wireSizeOfType(pDataset->pElement[lIndex].type);
+        }
+        else
+        {
+            if (NULL == pDataset->pElement[lIndex].pCachedDS)
+            {
+                pDataset->pElement[lIndex].pCachedDS = findDs(pDataset->pElement[lIndex].type);
+            }
+            itemSize = (NULL == pDataset->pElement[lIndex].pCachedDS) ?
+                0u : wireSizeOfDs(pDataset->pElement[lIndex].pCachedDS, 1u);
+        }
+
+        pFields[count].offset   = offset;
+        pFields[count].size     = itemSize * pDataset->pElement[lIndex].size;
+        pFields[count].type     = ((pDataset->pElement[lIndex].size == 1u) &&
+                                   (pDataset->pElement[lIndex].type <= TRDP_TIMEDATE64)) ?
+                                  pDataset->pElement[lIndex].type : TRDP_INVALID;
+        pFields[count].deadband = 0.0;
+        offset += pFields[count].size;
+        count++;
+
+        /*  The position of the following elements is not known in advance  */
+        if (pFields[count - 1u].size == 0u)
+        {
+            break;
+        }
+    }
+
+    /*  The last field covers the elements which did not fit  */
+    if ((lIndex < pDataset->numElement) && (pFields[count - 1u].size != 0u))
+    {
+        pFields[count - 1u].size = 0u;
+    }
+    *pNoOfFields = count;
+
+    return TRDP_NO_ERR;
+}
 
 /**********************************************************************************************************************/
-/**    marshall data set function.
+/**    Get the layout class of a dataset.
  *
- *  @param[in]      pRefCon         pointer to user context
- *  @param[in]      dsId            Data set id to identify the structure out of a configuration
- *  @param[in]      pSrc            pointer to received original message
- *  @param[in]      srcSize         size of the source buffer
- *  @param[in]      pDest           pointer to a buffer for the treated message
- *  @param[in,out]  pDestSize       size of the provide buffer / size of the treated message
- *  @param[in,out]  ppDSPointer     pointer to pointer to cached dataset
- *                                  set NULL if not used, set content NULL if unknown
+ *  @param[in]      pRefCon         Pointer to user context
+ *  @param[in]      dsId            Dataset id to identify the structure out of a configuration
+ *  @param[out]     pLayout         layout class
+ *  @param[out]     pWireSize       marshalled size, 0 if it depends on the data; may be NULL
  *
- *  @retval         TRDP_INIT_ERR           marshalling not initialised
- *  @retval         TRDP_NO_ERR             no error
- *  @retval         TRDP_MEM_ERR            provided buffer to small
- *  @retval         TRDP_PARAM_ERR          Parameter error
- *  @retval         TRDP_STATE_ERR          Too deep recursion
- *  @retval         TRDP_COMID_ERR          comid not existing
- *  @retval         TRDP_MARSHALLING_ERR    dataset/source size mismatch
+ *  @retval         TRDP_NO_ERR     no error
+ *  @retval         TRDP_PARAM_ERR  Parameter error
+ *  @retval         TRDP_COMID_ERR  dataset not existing
  *
  */
 
-EXT_DECL TRDP_ERR_T tau_marshallDs (
+EXT_DECL TRDP_ERR_T tau_getDatasetLayout (
     void            *pRefCon,
     UINT32          dsId,
-    UINT8           *pSrc,
-    UINT32          srcSize,
-    UINT8           *pDest,
-    UINT32          *pDestSize,
-    TRDP_DATASET_T  * *ppDSPointer)
+    TAU_LAYOUT_T    *pLayout,
+    UINT32          *pWireSize)
+{
+    TRDP_DATASET_T      *pDataset;
+    const TAU_DS_INFO_T *pInfo;
+
+    pRefCon = pRefCon;
+
+    if ((0u == dsId) || (NULL == pLayout))
+    {
+        return TRDP_PARAM_ERR;
+    }
+
+    pDataset = findDs(dsId);
+    if (NULL == pDataset)   /* Not in our DB    */
+    {
+        return TRDP_COMID_ERR;
+    }
+
+    pInfo       = dsInfo(pDataset);
+    *pLayout    = (NULL == pInfo) ? TAU_LAYOUT_UNKNOWN : pInfo->layout;
+    if (NULL != pWireSize)
+    {
+        *pWireSize = (NULL == pInfo) ? 0u : pInfo->wireSize;
+    }
+    return TRDP_NO_ERR;
+}
+
+/**********************************************************************************************************************/
+/**    Create a field accessor view for the dataset of a ComId.
+ *  The fields are counted in a first pass, filled in a second one.
+ *
+ *  @param[in]      pRefCon         Pointer to user context
+ *  @param[in]      comId           ComId to identify the structure out of a configuration
+ *  @param[out]     ppView          Pointer to the view handle
+ *
+ *  @retval         TRDP_NO_ERR     no error
+ *  @retval         TRDP_PARAM_ERR  Parameter error
+ *  @retval         TRDP_COMID_ERR  comid or nested dataset not existing
+ *  @retval         TRDP_MEM_ERR    out of memory
+ *  @retval         TRDP_STATE_ERR  too deep nesting
+ *
+ */
+
+EXT_DECL TRDP_ERR_T tau_createView (
+    void        *pRefCon,
+    UINT32      comId,
+    TAU_VIEW_T  * *ppView)
 {
     TRDP_ERR_T          err;
     TRDP_DATASET_T      *pDataset;
-    TAU_MARSHALL_INFO_T info;
+    TAU_VIEW_T          *pView;
+    TAU_VIEW_BUILD_T    build;
 
     pRefCon = pRefCon;
 
-    if ((0u == dsId) || (NULL == pSrc) || (NULL == pDest) || (NULL == pDestSize) || (0u == *pDestSize))
+    if ((0u == comId) || (NULL == ppView))
     {
         return TRDP_PARAM_ERR;
     }
 
-    /* Can we use the formerly cached value? */
-    if (NULL != ppDSPointer)
+    pDataset = findDSFromComId(comId);
+    if (NULL == pDataset)   /* Not in our DB    */
     {
-        if (NULL == *ppDSPointer)
-        {
-            *ppDSPointer = findDs(dsId);
-        }
-        pDataset = *ppDSPointer;
+        vos_printLog(VOS_LOG_ERROR, "ComID/DatasetID (%u) unknown\n", comId);
+        return TRDP_COMID_ERR;
     }
-    else
+
+    memset(&build, 0, sizeof(build));
+    build.fixed = TRUE;
+    err         = viewAddDs(&build, pDataset, 1u);
+    if (err != TRDP_NO_ERR)
     {
-        pDataset = findDs(dsId);
+        return err;
+    }
+    if (0u == build.count)
+    {
+        return TRDP_PARAM_ERR;
+    }
+
+    pView = (TAU_VIEW_T *) vos_memAlloc((UINT32) (sizeof(TAU_VIEW_T) +
+                                                  build.count * (sizeof(TAU_VIEW_FIELD_T) + sizeof(UINT32))));
+    if (NULL == pView)
+    {
+        return TRDP_MEM_ERR;
+    }
+    pView->pDataset     = pDataset;
+    pView->noOfFields   = build.count;
+    pView->pOffset      = (UINT32 *) &pView->field[build.count];
+
+    memset(&build, 0, sizeof(build));
+    build.pView = pView;
+    build.fixed = TRUE;
+    (void) viewAddDs(&build, pDataset, 1u);
+
+    *ppView = pView;
+    return TRDP_NO_ERR;
+}
+
+/**********************************************************************************************************************/
+/**    Delete a field accessor view.
+ *
+ *  @param[in]      pView           view handle
+ *
+ *  @retval         TRDP_NO_ERR     no error
+ *  @retval         TRDP_PARAM_ERR  Parameter error
+ *
+ */
+
+EXT_DECL TRDP_ERR_T tau_deleteView (
+    TAU_VIEW_T *pView)
+{
+    if (NULL == pView)
+    {
+        return TRDP_PARAM_ERR;
+    }
+    vos_memFree(pView);
+    return TRDP_NO_ERR;
+}
+
+/**********************************************************************************************************************/
+/**    Get the field id of an element by its path, e.g. "position.axle[2].speed".
+ *  The field id is the number of fields of the elements before the named one, summed up over the nesting levels.
+ *
+ *  @param[in]      pView           view handle
+ *  @param[in]      pPath           path of the element
+ *  @param[out]     pFieldId        field id
+ *
+ *  @retval         TRDP_NO_ERR     no error
+ *  @retval         TRDP_PARAM_ERR  Parameter error, path not found
+ *
+ */
+
+EXT_DECL TRDP_ERR_T tau_getViewField (
+    const TAU_VIEW_T    *pView,
+    const CHAR8         *pPath,
+    UINT32              *pFieldId)
+{
+    const TRDP_DATASET_T            *pDataset;
+    const TRDP_DATASET_ELEMENT_T    *pElement;
+    UINT32                          fieldId = 0u;
+    UINT32                          level   = 1u;
+    UINT32                          index;
+    BOOL8                           indexed;
+    size_t                          len;
+    UINT16                          lIndex;
+
+    if ((NULL == pView) || (NULL == pPath) || (NULL == pFieldId))
+    {
+        return TRDP_PARAM_ERR;
+    }
+
+    pDataset = pView->pDataset;
+    for (;; )
+    {
+        len = strcspn(pPath, ".[");
+        for (lIndex = 0u; lIndex < pDataset->numElement; lIndex++)
+        {
+            pElement = &pDataset->pElement[lIndex];
+            if ((NULL != pElement->name) && (strlen(pElement->name) == len) &&
+                (0 == strncmp(pElement->name, pPath, len)))
+            {
+                break;
+            }
+            fieldId += ((pElement->type <= TRDP_TIMEDATE64) || (TRDP_VAR_SIZE == pElement->size)) ?
+                1u : pElement->size * viewFieldsOfDs(pElement->pCachedDS, level + 1u);
+        }
+        if (lIndex == pDataset->numElement)
+        {
+            return TRDP_PARAM_ERR;
+        }
+        pElement    = &pDataset->pElement[lIndex];
+        pPath       += len;
+
+        /*  Optional index  */
+        index   = 0u;
+        indexed = FALSE;
+        if ('[' == *pPath)
+        {
+            for (pPath++; (*pPath >= '0') && (*pPath <= '9'); pPath++)
+            {
+                index   = index * 10u + (UINT32) (*pPath - '0');
+                indexed = TRUE;
+            }
+            if ((']' != *pPath++) || !indexed)
+            {
+                return TRDP_PARAM_ERR;
+            }
+        }
+
+        /*  A field?    */
+        if ((pElement->type <= TRDP_TIMEDATE64) || (TRDP_VAR_SIZE == pElement->size))
+        {
+            if (('\0' != *pPath) || indexed)
+            {
+                return TRDP_PARAM_ERR;
+            }
+            *pFieldId = fieldId;
+            return TRDP_NO_ERR;
+        }
+
+        /*  Descend into the nested dataset */
+        if ((index >= pElement->size) || ('.' != *pPath) || (level >= TAU_MAX_DS_LEVEL))
+        {
+            return TRDP_PARAM_ERR;
+        }
+        level++;
+        fieldId     += index * viewFieldsOfDs(pElement->pCachedDS, level);
+        pDataset    = pElement->pCachedDS;
+        pPath++;
     }
+}
 
-    if (NULL == pDataset)   /* Not in our DB    */
+/**********************************************************************************************************************/
+/**    Set the marshalled data to read.
+ *
+ *  @param[in]      pView           view handle
+ *  @param[in]      pData           marshalled data
+ *  @param[in]      dataSize        size of the data
+ *
+ *  @retval         TRDP_NO_ERR     no error
+ *  @retval         TRDP_PARAM_ERR  Parameter error
+ *
+ */
+
+EXT_DECL TRDP_ERR_T tau_setViewData (
+    TAU_VIEW_T  *pView,
+    const UINT8 *pData,
+    UINT32      dataSize)
+{
+    if ((NULL == pView) || (NULL == pData))
     {
-        vos_printLog(VOS_LOG_ERROR, "ComID/DatasetID (%u) unknown\n", dsId);
-        return TRDP_COMID_ERR;
+        return TRDP_PARAM_ERR;
     }
-
-    info.level      = 0u;
-    info.pSrc       = pSrc;
-    info.pSrcEnd    = pSrc + srcSize;
-    info.pDst       = pDest;
-    info.pDstEnd    = pDest + *pDestSize;
-
-    err = marshallDs(&info, pDataset);
-
-    *pDestSize = (UINT32) (info.pDst - pDest);
-
-    return err;
+    pView->pData        = pData;
+    pView->dataSize     = dataSize;
+    pView->noOfResolved = pView->noOfFixed;
+    return TRDP_NO_ERR;
 }
 
 /**********************************************************************************************************************/
-/**    unmarshall data set function.
+/**    Get the number of items of a field in the current data.
  *
- *  @param[in]      pRefCon         pointer to user context
- *  @param[in]      dsId            Data set id to identify the structure out of a configuration
- *  @param[in]      pSrc            pointer to received original message
- *  @param[in]      srcSize         size of the source buffer
- *  @param[in]      pDest           pointer to a buffer for the treated message
- *  @param[in,out]  pDestSize       size of the provide buffer / size of the treated message
- *  @param[in,out]  ppDSPointer     pointer to pointer to cached dataset
- *                                  set NULL if not used, set content NULL if unknown
+ *  @param[in]      pView           view handle
+ *  @param[in]      fieldId         field id
+ *  @param[out]     pNoOfItems      number of items
  *
- *  @retval         TRDP_INIT_ERR           marshalling not initialised
  *  @retval         TRDP_NO_ERR             no error
- *  @retval         TRDP_MEM_ERR            provided buffer to small
  *  @retval         TRDP_PARAM_ERR          Parameter error
- *  @retval         TRDP_STATE_ERR          Too deep recursion
- *  @retval         TRDP_COMID_ERR          comid not existing
- *  @retval         TRDP_MARSHALLING_ERR    dataset/source size mismatch
+ *  @retval         TRDP_MARSHALLING_ERR    data too short
  *
  */
 
-EXT_DECL TRDP_ERR_T tau_unmarshallDs (
-    void            *pRefCon,
-    UINT32          dsId,
-    UINT8           *pSrc,
-    UINT32          srcSize,
-    UINT8           *pDest,
-    UINT32          *pDestSize,
-    TRDP_DATASET_T  * *ppDSPointer)
+EXT_DECL TRDP_ERR_T tau_getNoOfItems (
+    TAU_VIEW_T  *pView,
+    UINT32      fieldId,
+    UINT32      *pNoOfItems)
 {
-    TRDP_ERR_T          err;
-    TRDP_DATASET_T      *pDataset;
-    TAU_MARSHALL_INFO_T info;
+    TRDP_ERR_T err;
 
-    pRefCon = pRefCon;
-
-    if ((0u == dsId) || (NULL == pSrc) || (NULL == pDest) || (NULL == pDestSize) || (0u == *pDestSize))
+    if ((NULL == pView) || (NULL == pView->pData) || (fieldId >= pView->noOfFields) || (NULL == pNoOfItems))
     {
         return TRDP_PARAM_ERR;
     }
-
-    /* Can we use the formerly cached value? */
-    if (NULL != ppDSPointer)
-    {
-        if (NULL == *ppDSPointer)
-        {
-            *ppDSPointer = findDs(dsId);
-        }
-        pDataset = *ppDSPointer;
-    }
-    else
-    {
-        pDataset = findDs(dsId);
-    }
-
-    if (NULL == pDataset)   /* Not in our DB    */
+    err = viewResolve(pView, fieldId);
+    if (err != TRDP_NO_ERR)
     {
-        vos_printLog(VOS_LOG_ERROR, "ComID/DatasetID (%u) unknown\n", dsId);
-        return TRDP_COMID_ERR;
+        return err;
     }
-
-    info.level      = 0u;
-    info.pSrc       = pSrc;
-    info.pSrcEnd    = pSrc + srcSize;
-    info.pDst       = pDest;
-    info.pDstEnd    = pDest + *pDestSize;
-
-    err = unmarshallDs(&info, pDataset);
-
-    *pDestSize = (UINT32) (info.pDst - pDest);
-
-    return err;
+    return viewItems(pView, fieldId, pNoOfItems);
 }
 
-
 /**********************************************************************************************************************/
-/**    Calculate data set size by given data set id.
+/**    Read items of an array field, converted to host order.
  *
- *  @param[in]      pRefCon         Pointer to user context
- *  @param[in]      dsId            Dataset id to identify the structure out of a configuration
- *  @param[in]      pSrc            Pointer to received original message
- *  @param[in]      srcSize         size of the source buffer
- *  @param[out]     pDestSize       Pointer to the size of the data set
- *  @param[in,out]  ppDSPointer     pointer to pointer to cached dataset,
- *                                  set NULL if not used, set content NULL if unknown
+ *  @param[in]      pView           view handle
+ *  @param[in]      fieldId         field id
+ *  @param[in]      first           index of the first item to read
+ *  @param[out]     pValues         array of values
+ *  @param[in,out]  pNoOfItems      in: size of the array, out: number of items read
  *
- *  @retval         TRDP_INIT_ERR           marshalling not initialised
  *  @retval         TRDP_NO_ERR             no error
- *  @retval         TRDP_MEM_ERR            provided buffer to small
- *  @retval         TRDP_PARAM_ERR          Parameter error
- *  @retval         TRDP_STATE_ERR          Too deep recursion
- *  @retval         TRDP_COMID_ERR          comid not existing
- *  @retval         TRDP_MARSHALLING_ERR    dataset/source size mismatch
+ *  @retval         TRDP_PARAM_ERR          Parameter error, field of other type, first item not existing
+ *  @retval         TRDP_MARSHALLING_ERR    data too short
  *
  */
 
-EXT_DECL TRDP_ERR_T tau_calcDatasetSize (
-    void            *pRefCon,
-    UINT32          dsId,
-    UINT8           *pSrc,
-    UINT32          srcSize,
-    UINT32          *pDestSize,
-    TRDP_DATASET_T  * *ppDSPointer)
+EXT_DECL TRDP_ERR_T tau_getU8Array (
+    TAU_VIEW_T  *pView,
+    UINT32      fieldId,
+    UINT32      first,
+    UINT8       *pValues,
+    UINT32      *pNoOfItems)
 {
-    TRDP_ERR_T          err;
-    TRDP_DATASET_T      *pDataset;
-    TAU_MARSHALL_INFO_T info;
-
-    pRefCon = pRefCon;
+    TRDP_ERR_T  err;
+    const UINT8 *pSrc;
 
-    if ((0u == dsId) || (NULL == pSrc) || (NULL == pDestSize))
+    if (NULL == pValues)
     {
         return TRDP_PARAM_ERR;
     }
+    err = viewLocate(pView, fieldId, 1u, FALSE, first, pNoOfItems, &pSrc);
+    if (err == TRDP_NO_ERR)
+    {
+        memcpy(pValues, pSrc, *pNoOfItems);
+    }
+    return err;
+}
 
-    /* Can we use the formerly cached value? */
-    if (NULL != ppDSPointer)
+EXT_DECL TRDP_ERR_T tau_getU16Array (
+    TAU_VIEW_T  *pView,
+    UINT32      fieldId,
+    UINT32      first,
+    UINT16      *pValues,
+    UINT32      *pNoOfItems)
+{
+    TRDP_ERR_T  err;
+    const UINT8 *pSrc;
+    UINT32      i;
+
+    if (NULL == pValues)
     {
-        if (NULL == *ppDSPointer)
+        return TRDP_PARAM_ERR;
+    }
+    err = viewLocate(pView, fieldId, 2u, FALSE, first, pNoOfItems, &pSrc);
+    if (err == TRDP_NO_ERR)
+    {
+        for (i = 0u; i < *pNoOfItems; i++, pSrc += 2u)
         {
-            *ppDSPointer = findDs(dsId);
+            pValues[i] = viewRead16(pSrc);
         }
-        pDataset = *ppDSPointer;
     }
-    else
+    return err;
+}
+
+EXT_DECL TRDP_ERR_T tau_getU32Array (
+    TAU_VIEW_T  *pView,
+    UINT32      fieldId,
+    UINT32      first,
+    UINT32      *pValues,
+    UINT32      *pNoOfItems)
+{
+    TRDP_ERR_T  err;
+    const UINT8 *pSrc;
+    UINT32      i;
+
+    if (NULL == pValues)
     {
-        pDataset = findDs(dsId);
+        return TRDP_PARAM_ERR;
+    }
+    err = viewLocate(pView, fieldId, 4u, FALSE, first, pNoOfItems, &pSrc);
+    if (err == TRDP_NO_ERR)
+    {
+        for (i = 0u; i < *pNoOfItems; i++, pSrc += 4u)
+        {
+            pValues[i] = viewRead32(pSrc);
+        }
     }
+    return err;
+}
 
-    if (NULL == pDataset)   /* Not in our DB    */
+EXT_DECL TRDP_ERR_T tau_getU64Array (
+    TAU_VIEW_T  *pView,
+    UINT32      fieldId,
+    UINT32      first,
+    UINT64      *pValues,
+    UINT32      *pNoOfItems)
+{
+    TRDP_ERR_T  err;
+    const UINT8 *pSrc;
+    UINT32      i;
+
+    if (NULL == pValues)
     {
-        vos_printLog(VOS_LOG_ERROR, "ComID/DatasetID (%u) unknown\n", dsId);
-        return TRDP_COMID_ERR;
+        return TRDP_PARAM_ERR;
+    }
+    err = viewLocate(pView, fieldId, 8u, FALSE, first, pNoOfItems, &pSrc);
+    if (err == TRDP_NO_ERR)
+    {
+        for (i = 0u; i < *pNoOfItems; i++, pSrc += 8u)
+        {
+            pValues[i] = viewRead64(pSrc);
+        }
     }
+    return err;
+}
 
-    info.level      = 0u;
-    info.pSrc       = pSrc;
-    info.pSrcEnd    = pSrc + srcSize;
-    info.pDst       = 0u;
+EXT_DECL TRDP_ERR_T tau_getReal32Array (
+    TAU_VIEW_T  *pView,
+    UINT32      fieldId,
+    UINT32      first,
+    REAL32      *pValues,
+    UINT32      *pNoOfItems)
+{
+    TRDP_ERR_T  err;
+    const UINT8 *pSrc;
+    UINT32      i;
+    UINT32      value;
 
-    err = size_unmarshall(&info, pDataset);
+    if (NULL == pValues)
+    {
+        return TRDP_PARAM_ERR;
+    }
+    err = viewLocate(pView, fieldId, 4u, TRUE, first, pNoOfItems, &pSrc);
+    if (err == TRDP_NO_ERR)
+    {
+        for (i = 0u; i < *pNoOfItems; i++, pSrc += 4u)
+        {
+            value = viewRead32(pSrc);
+            memcpy(&pValues[i], &value, sizeof(REAL32));
+        }
+    }
+    return err;
+}
 
-    *pDestSize = (UINT32) (info.pDst - (UINT8*) NULL);  /*lint !e413 Subtract pointer to emphasize size calculation */
+EXT_DECL TRDP_ERR_T tau_getReal64Array (
+    TAU_VIEW_T  *pView,
+    UINT32      fieldId,
+    UINT32      first,
+    REAL64      *pValues,
+    UINT32      *pNoOfItems)
+{
+    TRDP_ERR_T  err;
+    const UINT8 *pSrc;
+    UINT32      i;
+    UINT64      value;
 
+    if (NULL == pValues)
+    {
+        return TRDP_PARAM_ERR;
+    }
+    err = viewLocate(pView, fieldId, 8u, TRUE, first, pNoOfItems, &pSrc);
+    if (err == TRDP_NO_ERR)
+    {
+        for (i = 0u; i < *pNoOfItems; i++, pSrc += 8u)
+        {
+            value = viewRead64(pSrc);
+            memcpy(&pValues[i], &value, sizeof(REAL64));
+        }
+    }
     return err;
 }
 
 /**********************************************************************************************************************/
-/**    Calculate data set size by given ComId.
+/**    Read the first item of a field, converted to host order.
  *
- *  @param[in]      pRefCon         Pointer to user context
- *  @param[in]      comId           ComId id to identify the structure out of a configuration
- *  @param[in]      pSrc            Pointer to received original message
- *  @param[in]      srcSize         size of the source buffer
- *  @param[out]     pDestSize       Pointer to the size of the data set
- *  @param[in,out]  ppDSPointer     pointer to pointer to cached dataset,
- *                                  set NULL if not used, set content NULL if unknown
+ *  @param[in]      pView           view handle
+ *  @param[in]      fieldId         field id
+ *  @param[out]     pValue          value
  *
- *  @retval         TRDP_INIT_ERR           marshalling not initialised
  *  @retval         TRDP_NO_ERR             no error
- *  @retval         TRDP_MEM_ERR            provided buffer to small
- *  @retval         TRDP_PARAM_ERR          Parameter error
- *  @retval         TRDP_STATE_ERR          Too deep recursion
- *  @retval         TRDP_COMID_ERR          comid not existing
- *  @retval         TRDP_MARSHALLING_ERR    dataset/source size mismatch
+ *  @retval         TRDP_PARAM_ERR          Parameter error, field of other type or without items
+ *  @retval         TRDP_MARSHALLING_ERR    data too short
  *
  */
 
-EXT_DECL TRDP_ERR_T tau_calcDatasetSizeByComId (
-    void            *pRefCon,
-    UINT32          comId,
-    UINT8           *pSrc,
-    UINT32          srcSize,
-    UINT32          *pDestSize,
-    TRDP_DATASET_T  * *ppDSPointer)
+EXT_DECL TRDP_ERR_T tau_getU8 (TAU_VIEW_T *pView, UINT32 fieldId, UINT8 *pValue)
 {
-    TRDP_ERR_T          err;
-    TRDP_DATASET_T      *pDataset;
-    TAU_MARSHALL_INFO_T info;
+    UINT32 noOfItems = 1u;
+    return tau_getU8Array(pView, fieldId, 0u, pValue, &noOfItems);
+}
 
-    pRefCon = pRefCon;
+EXT_DECL TRDP_ERR_T tau_getI8 (TAU_VIEW_T *pView, UINT32 fieldId, INT8 *pValue)
+{
+    UINT32 noOfItems = 1u;
+    return tau_getU8Array(pView, fieldId, 0u, (UINT8 *) pValue, &noOfItems);
+}
 
-    if ((0u == comId) || (NULL == pSrc) || (NULL == pDestSize))
-    {
-        return TRDP_PARAM_ERR;
-    }
+EXT_DECL TRDP_ERR_T tau_getU16 (TAU_VIEW_T *pView, UINT32 fieldId, UINT16 *pValue)
+{
+    UINT32 noOfItems = 1u;
+    return tau_getU16Array(pView, fieldId, 0u, pValue, &noOfItems);
+}
 
-    /* Can we use the formerly cached value? */
-    if (NULL != ppDSPointer)
-    {
-        if (NULL == *ppDSPointer)
-        {
-            *ppDSPointer = findDSFromComId(comId);
-        }
-        pDataset = *ppDSPointer;
-    }
-    else
-    {
-        pDataset = findDSFromComId(comId);
-    }
+EXT_DECL TRDP_ERR_T tau_getI16 (TAU_VIEW_T *pView, UINT32 fieldId, INT16 *pValue)
+{
+    UINT32 noOfItems = 1u;
+    return tau_getU16Array(pView, fieldId, 0u, (UINT16 *) pValue, &noOfItems);
+}
 
-    if (NULL == pDataset)   /* Not in our DB    */
-    {
-        vos_printLog(VOS_LOG_ERROR, "ComID/DatasetID (%u) unknown\n", comId);
-        return TRDP_COMID_ERR;
-    }
+EXT_DECL TRDP_ERR_T tau_getU32 (TAU_VIEW_T *pView, UINT32 fieldId, UINT32 *pValue)
+{
+    UINT32 noOfItems = 1u;
+    return tau_getU32Array(pView, fieldId, 0u, pValue, &noOfItems);
+}
 
-    info.level      = 0u;
-    info.pSrc       = pSrc;
-    info.pSrcEnd    = pSrc + srcSize;
-    info.pDst       = 0u;
+EXT_DECL TRDP_ERR_T tau_getI32 (TAU_VIEW_T *pView, UINT32 fieldId, INT32 *pValue)
+{
+    UINT32 noOfItems = 1u;
+    return tau_getU32Array(pView, fieldId, 0u, (UINT32 *) pValue, &noOfItems);
+}
 
-    err = size_unmarshall(&info, pDataset);
+EXT_DECL TRDP_ERR_T tau_getU64 (TAU_VIEW_T *pView, UINT32 fieldId, UINT64 *pValue)
+{
+    UINT32 noOfItems = 1u;
+    return tau_getU64Array(pView, fieldId, 0u, pValue, &noOfItems);
+}
 
-    *pDestSize = (UINT32) (info.pDst - (UINT8*) NULL); /*lint !e413 Subtract pointer to emphasize size calculation */
+EXT_DECL TRDP_ERR_T tau_getI64 (TAU_VIEW_T *pView, UINT32 fieldId, INT64 *pValue)
+{
+    UINT32 noOfItems = 1u;
+    return tau_getU64Array(pView, fieldId, 0u, (UINT64 *) pValue, &noOfItems);
+}
 
-    return err;
+EXT_DECL TRDP_ERR_T tau_getReal32 (TAU_VIEW_T *pView, UINT32 fieldId, REAL32 *pValue)
+{
+    UINT32 noOfItems = 1u;
+    return tau_getReal32Array(pView, fieldId, 0u, pValue, &noOfItems);
+}
+
+EXT_DECL TRDP_ERR_T tau_getReal64 (TAU_VIEW_T *pView, UINT32 fieldId, REAL64 *pValue)
+{
+    UINT32 noOfItems = 1u;
+    return tau_getReal64Array(pView, fieldId, 0u, pValue, &noOfItems);
 }
@@ -17,6 +17,16 @@
 /*
 * $Id$
 *
+*      AG 2026-10-19: Close the io_uring of the session
+*      AG 2026-10-19: Close the AF_XDP socket of the session
+*      AG 2026-10-19: Free the MD sessions waiting for zero copy completions on tlc_closeSession()
+*      AG 2026-10-19: Free the redundancy groups on tlc_closeSession()
+*      AG 2026-10-19: Free the change filters when closing a session
+*      AG 2026-10-19: tlc_process(): batch callback at the end of the PD receive pass
+*      AG 2026-10-19: Stop the PD callback threads before closing a session
+*      AG 2026-10-19: trdp_isValidSession: lock-free walk of the session list, closed sessions freed after the walkers
+*      AG 2026-10-19: Statistics reply published with maximum size (histogram summaries), free histograms
+*      AG 2026-10-19: tlc_presetIndexSession: pass base tick and number of send categories
 *      BL 2020-01-10: Undoing svn revision output, would reflect file revision, only.
 *      BL 2019-11-06: Ticket #289: Changed the max. returnedwait time of tlc_getInterval to 1s (instead of 1000s)
 *      BL 2019-10-25: Ticket #288 Why is not tlm_reply() exported from the DLL
@@ -126,6 +136,7 @@ extern "C" {
 const TRDP_VERSION_T        trdpVersion = {TRDP_VERSION, TRDP_RELEASE, TRDP_UPDATE, TRDP_EVOLUTION};
 static TRDP_APP_SESSION_T   sSession        = NULL;
 static VOS_MUTEX_T          sSessionMutex   = NULL;
+static UINT32               sSessionReaders = 0u;     /* callers inside trdp_isValidSession() */
 static BOOL8 sInited = FALSE;
 
 /******************************************************************************
@@ -143,7 +154,9 @@ void                trdp_releaseAccess (TRDP_APP_SESSION_T pSessionHandle);
 
 /**********************************************************************************************************************/
 /** Check if the session handle is valid
- *
+ *  The session list is walked without the global session mutex, the handle itself is never dereferenced.
+ *  tlc_openSession() and tlc_closeSession() change the list under the mutex with atomic stores, and
+ *  tlc_closeSession() frees an unlinked session only after all callers counted in sSessionReaders have left.
  *
  *  @param[in]    pSessionHandle        pointer to packet data (dataset)
  *
@@ -153,37 +166,38 @@ void                trdp_releaseAccess (TRDP_APP_SESSION_T pSessionHandle);
 BOOL8    trdp_isValidSession (
     TRDP_APP_SESSION_T pSessionHandle)
 {
-    TRDP_SESSION_PT pSession = NULL;
-    BOOL8 found = FALSE;
+    TRDP_SESSION_PT pSession;
 
     if (pSessionHandle == NULL)
     {
         return FALSE;
     }
 
-    if (vos_mutexLock(sSessionMutex) != VOS_NO_ERR)
+    (void) __atomic_fetch_add(&sSessionReaders, 1u, __ATOMIC_SEQ_CST);
+    pSession = __atomic_load_n(&sSession, __ATOMIC_SEQ_CST);
+    while ((pSession != NULL) && (pSession != (TRDP_SESSION_PT) pSessionHandle))
     {
-        return FALSE;
+        pSession = __atomic_load_n(&pSession->pNext, __ATOMIC_ACQUIRE);
     }
+    (void) __atomic_fetch_sub(&sSessionReaders, 1u, __ATOMIC_SEQ_CST);
 
-    pSession = sSession;
-
-    while (pSession)
-    {
-        if (pSession == (TRDP_SESSION_PT) pSessionHandle)
-        {
-            found = TRUE;
-            break;
-        }
-        pSession = pSession->pNext;
-    }
+    return (pSession != NULL) ? TRUE : FALSE;
+}
 
-    if (vos_mutexUnlock(sSessionMutex) != VOS_NO_ERR)
+/**********************************************************************************************************************/
+/** Free a session which was unlinked from the session list, once no caller walks the list anymore
+ *
+ *  @param[in]    pSession              session to free
+ */
+static void trdp_freeSession (
+    TRDP_SESSION_PT pSession)
+{
+    /*  Callers entering later do not find the session, wait for those which might still look at it  */
+    while (__atomic_load_n(&sSessionReaders, __ATOMIC_SEQ_CST) != 0u)
     {
-        vos_printLogStr(VOS_LOG_INFO, "vos_mutexUnlock() failed\n");
+        (void) vos_threadDelay(0u);
     }
-
-    return found;
+    vos_memFree(pSession);
 }
 
 /**********************************************************************************************************************/
@@ -414,12 +428,11 @@ EXT_DECL TRDP_ERR_T tlc_openSession (
         return TRDP_MEM_ERR;
     }
 
-    /* memset(pSession, 0, sizeof(TRDP_SESSION_T)); not necessary, vos_memAlloc always returns cleared block! */
-
 #ifdef HIGH_PERF_INDEXED
     ret = trdp_indexInit(pSession);
     if (ret != TRDP_NO_ERR)
     {
+        vos_memFree(pSession);
         vos_printLogStr(VOS_LOG_ERROR, "trdp_indexInit() failed\n");
         return ret;
     }
@@ -518,7 +531,7 @@ EXT_DECL TRDP_ERR_T tlc_openSession (
         TRDP_SEND_PARAM_T   defaultParams = TRDP_PD_DEFAULT_SEND_PARAM;
 
         pSession->pNext = sSession;
-        sSession        = pSession;
+        __atomic_store_n(&sSession, pSession, __ATOMIC_SEQ_CST);
         *pAppHandle     = pSession;
 
         for (retries = 0; retries < TRDP_IF_WAIT_FOR_READY; retries++)
@@ -538,7 +551,7 @@ EXT_DECL TRDP_ERR_T tlc_openSession (
                               TRDP_FLAGS_NONE,          /*    No callbacks                  */
                               &defaultParams,           /*    default qos and ttl           */
                               NULL,                     /*    initial data                  */
-                              sizeof(TRDP_STATISTICS_T));
+                              TRDP_MAX_PD_DATA_SIZE);   /*    room for histogram summaries  */
             if ((ret == TRDP_SOCK_ERR) &&
                 (ownIpAddr == VOS_INADDR_ANY))          /*  do not wait if own IP was set (but invalid)    */
             {
@@ -854,6 +867,8 @@ EXT_DECL TRDP_ERR_T tlc_updateSession (
  *
  *  tlc_presetIndexSession allows to preallocate the table sizes in HIGH_PERF_INDEXED mode.
  *  If no table sizes are provided, the default sizes are used. In normal mode, this is a no-op.
+ *  The base tick (slot cycle of the fastest category, min. 100us) and the number of categories of the send tables
+ *  are taken from the table, too. The process cycle time must be a multiple of the base tick.
  *  This function should be called during initialisation stage, e.g. right after a session has been opened.
  *
  *  @param[in]      appHandle           The handle returned by tlc_openSession
@@ -890,6 +905,8 @@ EXT_DECL TRDP_ERR_T tlc_presetIndexSession (
                                 localSizes.maxNoOfHighCatSubscriptions;
 
         ret = trdp_indexAllocTables (   appHandle,
+                                        localSizes.baseCycle,
+                                        localSizes.noOfCategories,
                                         maxNoOfSubscriptions,
                                         localSizes.maxNoOfLowCatPublishers,
                                         localSizes.maxDepthOfLowCatPublishers,
@@ -944,10 +961,12 @@ EXT_DECL TRDP_ERR_T tlc_closeSession (
     {
         pSession = sSession;
 
+        /*  Unlink atomically, the unlinked session keeps its pNext for callers walking the list right now.
+            From now on, trdp_isValidSession() rejects the handle */
         if (sSession == (TRDP_SESSION_PT) appHandle)
         {
-            sSession    = sSession->pNext;
-            found       = TRUE;
+            __atomic_store_n(&sSession, sSession->pNext, __ATOMIC_SEQ_CST);
+            found = TRUE;
         }
         else
         {
@@ -955,7 +974,7 @@ EXT_DECL TRDP_ERR_T tlc_closeSession (
             {
                 if (pSession->pNext == (TRDP_SESSION_PT) appHandle)
                 {
-                    pSession->pNext = pSession->pNext->pNext;
+                    __atomic_store_n(&pSession->pNext, pSession->pNext->pNext, __ATOMIC_SEQ_CST);
                     found = TRUE;
                     break;
                 }
@@ -974,6 +993,9 @@ EXT_DECL TRDP_ERR_T tlc_closeSession (
         {
             pSession = (TRDP_SESSION_PT) appHandle;
 
+            /*    Callbacks still running might need the session mutexes    */
+            trdp_pdCbPoolStop(pSession, NULL);
+
             /*    Take the session mutex to prevent someone sitting on the branch while we cut it,
                     in case we can force leaving... */
             ret = trdp_getAccess(pSession, TRUE);
@@ -1002,6 +1024,10 @@ EXT_DECL TRDP_ERR_T tlc_closeSession (
                     {
                         vos_memFree(pSession->pSndQueue->pSeqCntList);
                     }
+                    if (pSession->pSndQueue->pHisto != NULL)
+                    {
+                        vos_memFree(pSession->pSndQueue->pHisto);
+                    }
                     vos_memFree(pSession->pSndQueue->pFrame);
 
                     /*    Only close socket if not used anymore    */
@@ -1010,6 +1036,7 @@ EXT_DECL TRDP_ERR_T tlc_closeSession (
                     vos_memFree(pSession->pSndQueue);
                     pSession->pSndQueue = pNext;
                 }
+                trdp_pdRedGroupFree(pSession);
 
                 while (pSession->pRcvQueue != NULL)
                 {
@@ -1022,6 +1049,15 @@ EXT_DECL TRDP_ERR_T tlc_closeSession (
                     {
                         vos_memFree(pSession->pRcvQueue->pSeqCntList);
                     }
+                    if (pSession->pRcvQueue->pHisto != NULL)
+                    {
+                        vos_memFree(pSession->pRcvQueue->pHisto);
+                    }
+                    if (pSession->pRcvQueue->pFilter != NULL)
+                    {
+                        vos_memFree(pSession->pRcvQueue->pFilter);
+                    }
+                    trdp_pdCbRelease(pSession->pRcvQueue);
                     if (pSession->pRcvQueue->pFrame != NULL)
                     {
                         vos_memFree(pSession->pRcvQueue->pFrame);
@@ -1029,6 +1065,18 @@ EXT_DECL TRDP_ERR_T tlc_closeSession (
                     vos_memFree(pSession->pRcvQueue);
                     pSession->pRcvQueue = pNext;
                 }
+                if (pSession->pBatch != NULL)
+                {
+                    vos_memFree(pSession->pBatch);
+                }
+#ifdef XDP_SUPPORT
+                vos_xskClose(pSession->pdXsk);
+                pSession->pdXsk = NULL;
+#endif
+#ifdef URING_SUPPORT
+                vos_uringClose(pSession->pdUring);
+                pSession->pdUring = NULL;
+#endif
 
 #if MD_SUPPORT
                 if (pSession->pMDRcvEle != NULL)
@@ -1069,6 +1117,14 @@ EXT_DECL TRDP_ERR_T tlc_closeSession (
                     trdp_mdFreeSession(pSession->pMDRcvQueue);
                     pSession->pMDRcvQueue = pNext;
                 }
+                /*    Sessions waiting for zero copy completions, their sockets are released already    */
+                while (pSession->pMDZcQueue != NULL)
+                {
+                    MD_ELE_T *pNext = pSession->pMDZcQueue->pNext;
+
+                    trdp_mdFreeSession(pSession->pMDZcQueue);
+                    pSession->pMDZcQueue = pNext;
+                }
                 /*    Release all allocated sockets and memory    */
                 while (pSession->pMDListenQueue != NULL)
                 {
@@ -1101,7 +1157,7 @@ EXT_DECL TRDP_ERR_T tlc_closeSession (
 #if MD_SUPPORT
                 vos_mutexDelete(pSession->mutexMD);
 #endif
-                vos_memFree(pSession);
+                trdp_freeSession(pSession);
             }
 
         }
@@ -1393,6 +1449,9 @@ EXT_DECL TRDP_ERR_T tlc_process (
                 result = err;
             }
 
+            /*  Report all telegrams updated in this pass at once   */
+            trdp_pdBatchFlush(appHandle);
+
             if (vos_mutexUnlock(appHandle->mutexRxPD) != VOS_NO_ERR)
             {
                 vos_printLogStr(VOS_LOG_INFO, "vos_mutexUnlock() failed\n");
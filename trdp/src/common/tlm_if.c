@@ -17,6 +17,9 @@
 /*
 * $Id$
 *
+*      AG 2026-10-19: tlm_notifyMulti() / tlm_requestMulti(): one payload to several destinations
+*      AG 2026-10-19: tlm_setAdaptiveRetry(): retry UDP requests after the estimated round trip time
+*      AG 2026-10-19: tlm_setPayloadRef(): send notify/reply payloads by reference, optionally with zero copy
 *      SB 2020-03-30: Ticket #309 A Listener's Sessions now close when the Listener is deleted or readded
 *      SB 2020-03-30: Ticket #313 Added topoCount check for notifications
 *      BL 2019-10-25: Ticket #288 Why is not tlm_reply() exported from the DLL
@@ -374,6 +377,189 @@ EXT_DECL TRDP_ERR_T tlm_request (
     }
 }
 
+/**********************************************************************************************************************/
+/** Initiate sending MD notification message to several destinations.
+ *  The payload is marshalled once and shared by all destinations, UDP notifications are sent with one call
+ *  where the target supports it.
+ *
+ *  @param[in]      appHandle           the handle returned by tlc_openSession
+ *  @param[in]      pUserRef            user supplied value returned with reply
+ *  @param[in]      pfCbFunction        Pointer to listener specific callback function, NULL to use default function
+ *  @param[in]      comId               comId of packet to be sent
+ *  @param[in]      etbTopoCnt          ETB topocount to use, 0 if consist local communication
+ *  @param[in]      opTrnTopoCnt        operational topocount, != 0 for orientation/direction sensitive communication
+ *  @param[in]      srcIpAddr           own IP address, 0 - srcIP will be set by the stack
+ *  @param[in]      pDestIpAddr         where to send the packet to (unicast addresses)
+ *  @param[in]      noOfDest            number of destinations
+ *  @param[in]      pktFlags            OPTION:
+ *                                      TRDP_FLAGS_DEFAULT, TRDP_FLAGS_NONE, TRDP_FLAGS_MARSHALL, TRDP_FLAGS_CALLBACK
+ *  @param[in]      pSendParam          optional pointer to send parameter, NULL - default parameters are used
+ *  @param[in]      pData               pointer to packet data / dataset
+ *  @param[in]      dataSize            size of packet data
+ *  @param[in]      sourceURI           only functional group of source URI
+ *  @param[in]      destURI             only functional group of destination URI
+ *
+ *  @retval         TRDP_NO_ERR         no error
+ *  @retval         TRDP_PARAM_ERR      parameter error
+ *  @retval         TRDP_MEM_ERR        out of memory
+ *  @retval         TRDP_NOINIT_ERR     handle invalid
+ */
+EXT_DECL TRDP_ERR_T tlm_notifyMulti (
+    TRDP_APP_SESSION_T      appHandle,
+    const void              *pUserRef,
+    TRDP_MD_CALLBACK_T      pfCbFunction,
+    UINT32                  comId,
+    UINT32                  etbTopoCnt,
+    UINT32                  opTrnTopoCnt,
+    TRDP_IP_ADDR_T          srcIpAddr,
+    const TRDP_IP_ADDR_T    *pDestIpAddr,
+    UINT32                  noOfDest,
+    TRDP_FLAGS_T            pktFlags,
+    const TRDP_SEND_PARAM_T *pSendParam,
+    const UINT8             *pData,
+    UINT32                  dataSize,
+    const TRDP_URI_USER_T   sourceURI,
+    const TRDP_URI_USER_T   destURI)
+{
+    if ( !trdp_isValidSession(appHandle))
+    {
+        return TRDP_NOINIT_ERR;
+    }
+    if (((pData == NULL) && (dataSize != 0u)) || (dataSize > TRDP_MAX_MD_DATA_SIZE))
+    {
+        return TRDP_PARAM_ERR;
+    }
+    if (!trdp_validTopoCounters(appHandle->etbTopoCnt,
+        appHandle->opTrnTopoCnt,
+        etbTopoCnt,
+        opTrnTopoCnt))
+    {
+        return TRDP_TOPO_ERR;
+    }
+    return trdp_mdCallMulti(
+               TRDP_MSG_MN,                                    /* notify without reply */
+               appHandle,
+               pUserRef,
+               pfCbFunction,
+               NULL,                                           /* no session ids */
+               comId,
+               etbTopoCnt,
+               opTrnTopoCnt,
+               srcIpAddr,
+               pDestIpAddr,
+               noOfDest,
+               pktFlags,
+               0u,                                              /* reply timeout for notify */
+               pSendParam,
+               pData,
+               dataSize,
+               sourceURI,
+               destURI
+               );
+}
+
+/**********************************************************************************************************************/
+/** Initiate sending MD request message to several destinations.
+ *  One session per destination is opened, the replies are reported with the session ID of their destination.
+ *  The payload is marshalled once and shared by all sessions.
+ *
+ *  @param[in]      appHandle           the handle returned by tlc_openSession
+ *  @param[in]      pUserRef            user supplied value returned with reply
+ *  @param[in]      pfCbFunction        Pointer to listener specific callback function, NULL to use default function
+ *  @param[out]     pSessionId          return session IDs, noOfDest entries in the order of pDestIpAddr (may be NULL)
+ *  @param[in]      comId               comId of packet to be sent
+ *  @param[in]      etbTopoCnt          ETB topocount to use, 0 if consist local communication
+ *  @param[in]      opTrnTopoCnt        operational topocount, != 0 for orientation/direction sensitive communication
+ *  @param[in]      srcIpAddr           own IP address, 0 - srcIP will be set by the stack
+ *  @param[in]      pDestIpAddr         where to send the packet to (unicast addresses)
+ *  @param[in]      noOfDest            number of destinations
+ *  @param[in]      pktFlags            OPTION:
+ *                                      TRDP_FLAGS_DEFAULT, TRDP_FLAGS_NONE, TRDP_FLAGS_MARSHALL
+ *  @param[in]      replyTimeout        timeout for reply
+ *  @param[in]      pSendParam          Pointer to send parameters, NULL to use default send parameters
+ *  @param[in]      pData               pointer to packet data / dataset
+ *  @param[in]      dataSize            size of packet data
+ *  @param[in]      sourceURI           only functional group of source URI
+ *  @param[in]      destURI             only functional group of destination URI
+ *
+ *  @retval         TRDP_NO_ERR         no error
+ *  @retval         TRDP_PARAM_ERR      parameter error
+ *  @retval         TRDP_MEM_ERR        out of memory
+ *  @retval         TRDP_NOINIT_ERR     handle invalid
+ */
+EXT_DECL TRDP_ERR_T tlm_requestMulti (
+    TRDP_APP_SESSION_T      appHandle,
+    const void              *pUserRef,
+    TRDP_MD_CALLBACK_T      pfCbFunction,
+    TRDP_UUID_T             *pSessionId,
+    UINT32                  comId,
+    UINT32                  etbTopoCnt,
+    UINT32                  opTrnTopoCnt,
+    TRDP_IP_ADDR_T          srcIpAddr,
+    const TRDP_IP_ADDR_T    *pDestIpAddr,
+    UINT32                  noOfDest,
+    TRDP_FLAGS_T            pktFlags,
+    UINT32                  replyTimeout,
+    const TRDP_SEND_PARAM_T *pSendParam,
+    const UINT8             *pData,
+    UINT32                  dataSize,
+    const TRDP_URI_USER_T   sourceURI,
+    const TRDP_URI_USER_T   destURI)
+{
+    UINT32 mdTimeOut;
+
+    if ( !trdp_isValidSession(appHandle))
+    {
+        return TRDP_NOINIT_ERR;
+    }
+    if (((pData == NULL) && (dataSize != 0u))
+        || (dataSize > TRDP_MAX_MD_DATA_SIZE))
+    {
+        return TRDP_PARAM_ERR;
+    }
+
+    if ( replyTimeout == 0U )
+    {
+        mdTimeOut = appHandle->mdDefault.replyTimeout;
+    }
+    else if ( replyTimeout == TRDP_INFINITE_TIMEOUT)
+    {
+        mdTimeOut = 0;
+    }
+    else
+    {
+        mdTimeOut = replyTimeout;
+    }
+
+    if ( !trdp_validTopoCounters( appHandle->etbTopoCnt,
+                                  appHandle->opTrnTopoCnt,
+                                  etbTopoCnt,
+                                  opTrnTopoCnt))
+    {
+        return TRDP_TOPO_ERR;
+    }
+    return trdp_mdCallMulti(
+               TRDP_MSG_MR,                                           /* request with reply */
+               appHandle,
+               pUserRef,
+               pfCbFunction,
+               pSessionId,
+               comId,
+               etbTopoCnt,
+               opTrnTopoCnt,
+               srcIpAddr,
+               pDestIpAddr,
+               noOfDest,
+               pktFlags,
+               mdTimeOut,
+               pSendParam,
+               pData,
+               dataSize,
+               sourceURI,
+               destURI
+               );
+}
+
 
 /**********************************************************************************************************************/
 /** Subscribe to MD messages.
@@ -981,6 +1167,96 @@ EXT_DECL TRDP_ERR_T tlm_abortSession (
     return err;
 }
 
+/**********************************************************************************************************************/
+/** Send large notification and reply payloads by reference.
+ *  Payloads of at least minSize bytes passed to tlm_notify() or tlm_reply() are no longer copied into the stack:
+ *  they are sent directly from the caller's buffer (scatter/gather) and must stay unchanged until pfRelease is
+ *  called for them. Payloads of at least zeroCopySize bytes are sent with zero copy (Linux: MSG_ZEROCOPY); the kernel
+ *  then references the pages until the NIC has sent them, the release is deferred until its completion.
+ *  Zero copy pays off for large payloads only (some 10kB), on loopback and other targets a copy is made anyway.
+ *  Marshalled payloads are always copied.
+ *
+ *  @param[in]      appHandle           the handle returned by tlc_openSession
+ *  @param[in]      minSize             min. payload size to send by reference, 0 to always copy
+ *  @param[in]      zeroCopySize        min. payload size to send with zero copy, 0 to never use zero copy
+ *  @param[in]      pfRelease           called when a payload is no longer used, may be NULL
+ *  @param[in]      pRefCon             user context for pfRelease
+ *
+ *  @retval         TRDP_NO_ERR         no error
+ *  @retval         TRDP_NOINIT_ERR     handle invalid
+ *  @retval         TRDP_MUTEX_ERR      mutex error
+ */
+EXT_DECL TRDP_ERR_T tlm_setPayloadRef (
+    TRDP_APP_SESSION_T  appHandle,
+    UINT32              minSize,
+    UINT32              zeroCopySize,
+    TRDP_MD_RELEASE_T   pfRelease,
+    void                *pRefCon)
+{
+    if (!trdp_isValidSession(appHandle))
+    {
+        return TRDP_NOINIT_ERR;
+    }
+
+    if (vos_mutexLock(appHandle->mutexMD) != VOS_NO_ERR)
+    {
+        return TRDP_MUTEX_ERR;
+    }
+
+    appHandle->mdRefSize        = minSize;
+    appHandle->mdZeroCopySize   = (minSize != 0u) ? zeroCopySize : 0u;
+    appHandle->pfMdRelease      = pfRelease;
+    appHandle->pMdRelRefCon     = pRefCon;
+
+    if (vos_mutexUnlock(appHandle->mutexMD) != VOS_NO_ERR)
+    {
+        vos_printLogStr(VOS_LOG_INFO, "vos_mutexUnlock() failed\n");
+    }
+
+    return TRDP_NO_ERR;
+}
+
+/**********************************************************************************************************************/
+/** Retry UDP requests after the estimated round trip time of the replier.
+ *  The round trip time of every replier is measured from sending a request to receiving its first reply
+ *  (see tlc_getMdPeerStatistics). If enabled, a unicast UDP request is retried after srtt + 4 * rttVar instead of
+ *  the reply timeout, doubling with each retry. The timeout is bounded by minTimeout and the reply timeout; the last
+ *  try always waits for the full reply timeout. Without a measurement the reply timeout is used.
+ *
+ *  @param[in]      appHandle           the handle returned by tlc_openSession
+ *  @param[in]      enable              TRUE: adaptive retry timeout, FALSE: retry after the reply timeout (default)
+ *  @param[in]      minTimeout          lower bound of the retry timeout in us, 0 for the default (10ms)
+ *
+ *  @retval         TRDP_NO_ERR         no error
+ *  @retval         TRDP_NOINIT_ERR     handle invalid
+ *  @retval         TRDP_MUTEX_ERR      mutex error
+ */
+EXT_DECL TRDP_ERR_T tlm_setAdaptiveRetry (
+    TRDP_APP_SESSION_T  appHandle,
+    BOOL8               enable,
+    UINT32              minTimeout)
+{
+    if (!trdp_isValidSession(appHandle))
+    {
+        return TRDP_NOINIT_ERR;
+    }
+
+    if (vos_mutexLock(appHandle->mutexMD) != VOS_NO_ERR)
+    {
+        return TRDP_MUTEX_ERR;
+    }
+
+    appHandle->mdAdaptiveRetry      = enable;
+    appHandle->mdMinRetryTimeout    = (minTimeout != 0u) ? minTimeout : TRDP_MD_MIN_RETRY_TIMEOUT;
+
+    if (vos_mutexUnlock(appHandle->mutexMD) != VOS_NO_ERR)
+    {
+        vos_printLogStr(VOS_LOG_INFO, "vos_mutexUnlock() failed\n");
+    }
+
+    return TRDP_NO_ERR;
+}
+
 #ifdef __cplusplus
 }
 #endif
@@ -17,6 +17,20 @@
 /*
 * $Id$
 *
+*      AG 2026-10-19: tlp_request() joins (or creates) the redundancy group of its redId
+*      AG 2026-10-19: tlp_unsubscribe() from the subscriber's callback: no histogram update of the freed element
+*      AG 2026-10-19: tlp_setBusyPoll(), tlp_processReceive() spins on the PD sockets before the caller blocks
+*      AG 2026-10-19: tlp_enableUring(), tlp_getUringStatistics()
+*      AG 2026-10-19: tlp_enableXdp(), tlp_getXdpStatistics()
+*      AG 2026-10-19: tlp_setRedundant()/tlp_getRedundant() use the redundancy groups, no queue walk
+*      AG 2026-10-19: tlp_setChangeFilter(), tlp_get() reports the fields changed by the last packet
+*      AG 2026-10-19: tlp_setBatchCallback(), batch callback at the end of tlp_processReceive()
+*      AG 2026-10-19: tlp_enableCallbackPool(), release deferred callback delivery on unsubscribe
+*      AG 2026-10-19: tlp_enableComIdFilter(), update the comId filters on (re/un)subscribe
+*      AG 2026-10-19: tlp_get() reports the arrival time of the last packet
+*      AG 2026-10-19: Allocate histograms on publish/subscribe
+*      AG 2026-10-19: Free histograms on unpublish/unsubscribe
+*      AG 2026-10-19: tlp_getPubTxStats() added, drop TX timestamp references on unpublish
 *      CK 2020-04-06: Ticket #318 PD Request - sequence counter not incremented
 *      SB 2020-03-30: Ticket #311: replaced call to trdp_getSeqCnt() with -1 because redundant publisher should not run on the same interface
 *      BL 2019-12-06: Ticket #300 Can error message in tlp_setRedundant() be changed to warning?
@@ -161,6 +175,8 @@ EXT_DECL TRDP_ERR_T tlp_getInterval (
  *    Search the receive queue for pending PDs (time out) and report them,
  *    either by informing the higher layer via the callback mechanism or just by
  *    marking the subscriber as timed-out
+ *    With busy polling enabled (tlp_setBusyPoll), a call with no ready descriptors (*pCount == 0) and the set
+ *    returned by tlp_getInterval() polls the PD sockets of the set for up to the spin budget first.
  *
  *
  *  @param[in]      appHandle          The handle returned by tlc_openSession
@@ -169,6 +185,7 @@ EXT_DECL TRDP_ERR_T tlp_getInterval (
  *
  *  @retval         TRDP_NO_ERR        no error
  *  @retval         TRDP_NOINIT_ERR    handle invalid
+ *  @retval         TRDP_NODATA_ERR    busy polling: nothing arrived within the spin budget, the set is unchanged
  */
 EXT_DECL TRDP_ERR_T tlp_processReceive (
     TRDP_APP_SESSION_T  appHandle,
@@ -189,6 +206,18 @@ EXT_DECL TRDP_ERR_T tlp_processReceive (
     }
     else
     {
+        /******************************************************
+         Spin for packets before the caller blocks
+         ******************************************************/
+        if ((appHandle->busyPollBudget != 0u) &&
+            (pRfds != NULL) &&
+            (pCount != NULL) &&
+            (*pCount == 0) &&
+            (trdp_pdBusyPoll(appHandle, pRfds, pCount) == FALSE))
+        {
+            result = TRDP_NODATA_ERR;
+        }
+
         /******************************************************
          Find packets which are to be received
          ******************************************************/
@@ -218,6 +247,9 @@ EXT_DECL TRDP_ERR_T tlp_processReceive (
 #else
         trdp_pdHandleTimeOuts(appHandle);
 #endif
+        /*  Report all telegrams updated in this pass at once   */
+        trdp_pdBatchFlush(appHandle);
+
         if (vos_mutexUnlock(appHandle->mutexRxPD) != VOS_NO_ERR)
         {
             vos_printLogStr(VOS_LOG_INFO, "vos_mutexUnlock() failed\n");
@@ -297,6 +329,8 @@ EXT_DECL TRDP_ERR_T tlp_processSend (
 
 /**********************************************************************************************************************/
 /** Do not send non-redundant PDs when we are follower.
+ *  Leadership is a flag per redundancy group, the switchover takes effect with the next telegram due and does not
+ *  wait for a running send cycle. Followers keep their sequence counters running (hot standby).
  *
  *  @param[in]      appHandle           the handle returned by tlc_openSession
  *  @param[in]      redId               will be set for all ComID's with the given redId, 0 to change for all redId
@@ -311,48 +345,18 @@ EXT_DECL TRDP_ERR_T tlp_setRedundant (
     UINT32              redId,
     BOOL8               leader)
 {
-    TRDP_ERR_T  ret = TRDP_NOINIT_ERR;
-    PD_ELE_T    *iterPD;
-    BOOL8       found = FALSE;
+    TRDP_ERR_T ret = TRDP_NOINIT_ERR;
 
     if (trdp_isValidSession(appHandle))
     {
-        ret = (TRDP_ERR_T) vos_mutexLock(appHandle->mutexTxPD);
-        if (TRDP_NO_ERR == ret)
-        {
-            /*    Set the redundancy flag for every PD with the specified ID */
-            for (iterPD = appHandle->pSndQueue; NULL != iterPD; iterPD = iterPD->pNext)
-            {
-                if ((0u != iterPD->redId)                           /* packet has redundant ID       */
-                    &&
-                    ((0u == redId) || (iterPD->redId == redId)))    /* all set redundant ID are targeted if redId == 0
-                                                                     or packet redundant ID matches       */
-                {
-                    if (TRUE == leader)
-                    {
-                        iterPD->privFlags = (TRDP_PRIV_FLAGS_T) (iterPD->privFlags & ~(TRDP_PRIV_FLAGS_T)TRDP_REDUNDANT);
-                    }
-                    else
-                    {
-                        iterPD->privFlags |= TRDP_REDUNDANT;
-                    }
-                    found = TRUE;
-                }
-            }
-
-            /*  It would lead to an error, if the user tries to change the redundancy on a non-existant group, because
-             the leadership state is recorded in the PD send queue! If there is no published comID with a certain
-             redId, it would never be set... */
-            if ((FALSE == found) && (0u != redId))
-            {
-                vos_printLogStr(VOS_LOG_WARNING, "Redundant ID not found\n");
-                ret = TRDP_PARAM_ERR;
-            }
+        ret = TRDP_NO_ERR;
 
-            if (vos_mutexUnlock(appHandle->mutexTxPD) != VOS_NO_ERR)
-            {
-                vos_printLogStr(VOS_LOG_INFO, "vos_mutexUnlock() failed\n");
-            }
+        /*  It would lead to an error, if the user tries to change the redundancy on a non-existant group:
+         a group is known only after a comID with this redId has been published */
+        if ((trdp_pdRedGroupSet(appHandle, redId, leader) == FALSE) && (0u != redId))
+        {
+            vos_printLogStr(VOS_LOG_WARNING, "Redundant ID not found\n");
+            ret = TRDP_PARAM_ERR;
         }
     }
 
@@ -361,7 +365,7 @@ EXT_DECL TRDP_ERR_T tlp_setRedundant (
 
 /**********************************************************************************************************************/
 /** Get status of redundant ComIds.
- *  Only the status of the first found redundancy group entry will be returned!
+ *  pLeader is left unchanged if the redundancy group is not known.
  *
  *  @param[in]      appHandle           the handle returned by tlc_openSession
  *  @param[in]      redId               will be returned for all ComID's with the given redId
@@ -376,8 +380,8 @@ EXT_DECL TRDP_ERR_T tlp_getRedundant (
     UINT32              redId,
     BOOL8               *pLeader)
 {
-    TRDP_ERR_T  ret = TRDP_NOINIT_ERR;
-    PD_ELE_T    *iterPD;
+    TRDP_ERR_T          ret = TRDP_NOINIT_ERR;
+    TRDP_RED_GROUP_T    *pGroup;
 
     if ((pLeader == NULL) || (redId == 0u))
     {
@@ -386,30 +390,11 @@ EXT_DECL TRDP_ERR_T tlp_getRedundant (
 
     if (trdp_isValidSession(appHandle))
     {
-        ret = (TRDP_ERR_T) vos_mutexLock(appHandle->mutexTxPD);
-        if (ret == TRDP_NO_ERR)
+        ret     = TRDP_NO_ERR;
+        pGroup  = trdp_pdRedGroupFind(appHandle, redId);
+        if (pGroup != NULL)
         {
-            /*    Search the redundancy flag for every PD with the specified ID */
-            for (iterPD = appHandle->pSndQueue; NULL != iterPD; iterPD = iterPD->pNext)
-            {
-                if (iterPD->redId == redId)         /* packet redundant ID matches                      */
-                {
-                    if (iterPD->privFlags & TRDP_REDUNDANT)
-                    {
-                        *pLeader = FALSE;
-                    }
-                    else
-                    {
-                        *pLeader = TRUE;
-                    }
-                    break;
-                }
-            }
-
-            if (vos_mutexUnlock(appHandle->mutexTxPD) != VOS_NO_ERR)
-            {
-                vos_printLogStr(VOS_LOG_INFO, "vos_mutexUnlock() failed\n");
-            }
+            *pLeader = (__atomic_load_n(&pGroup->follower, __ATOMIC_ACQUIRE) != 0u) ? FALSE : TRUE;
         }
     }
 
@@ -462,6 +447,7 @@ EXT_DECL TRDP_ERR_T tlp_publish (
     UINT32                  dataSize)
 {
     PD_ELE_T            *pNewElement = NULL;
+    TRDP_RED_GROUP_T    *pRedGroup  = NULL;
     TRDP_TIME_T         nextTime;
     TRDP_TIME_T         tv_interval;
     TRDP_ERR_T          ret         = TRDP_NO_ERR;
@@ -505,6 +491,11 @@ EXT_DECL TRDP_ERR_T tlp_publish (
             /*  Already published! */
             ret = TRDP_NOPUB_ERR;
         }
+        else if ((0u != redId) &&
+                 ((pRedGroup = trdp_pdRedGroupReserve(appHandle, redId)) == NULL))
+        {
+            ret = TRDP_MEM_ERR;
+        }
         else
         {
             pNewElement = (PD_ELE_T *) vos_memAlloc(sizeof(PD_ELE_T));
@@ -613,6 +604,7 @@ EXT_DECL TRDP_ERR_T tlp_publish (
             pNewElement->pCachedDS      = NULL;
             pNewElement->magic          = TRDP_MAGIC_PUB_HNDL_VALUE;
             pNewElement->pUserRef       = pUserRef;
+            (void) trdp_pdAllocHisto(appHandle, pNewElement);     /* a telegram without histograms is logged */
 
             /* PD PULL or TSN?    Packet will be sent on request only    */
             if (0 == interval)       /* Disable interval sending of TSN packets */
@@ -652,17 +644,10 @@ EXT_DECL TRDP_ERR_T tlp_publish (
              disturb the monotonic sequence for PDs  */
             pNewElement->curSeqCnt4Pull = 0xFFFFFFFFu;
 
-            /*    Check if the redundancy group is already set as follower; if set, we need to mark this one also!
-             This will only happen, if publish() is called while we are in redundant mode */
-            if (0 != redId)
+            /*    Join the redundancy group, the publisher follows the leadership state of the group */
+            if (pRedGroup != NULL)
             {
-                BOOL8 isLeader = TRUE;
-
-                ret = tlp_getRedundant(appHandle, redId, &isLeader);
-                if (ret == TRDP_NO_ERR && FALSE == isLeader)
-                {
-                    pNewElement->privFlags |= TRDP_REDUNDANT;
-                }
+                trdp_pdRedGroupAdd(pRedGroup, pNewElement);
             }
 
             /*    Compute the header fields */
@@ -818,12 +803,31 @@ EXT_DECL TRDP_ERR_T  tlp_unpublish (
     {
         /*    Remove from queue?    */
         trdp_queueDelElement(&appHandle->pSndQueue, pElement);
+        trdp_pdRedGroupRemove(pElement);
+
+        /*    Outstanding TX timestamps must not refer to this publisher anymore    */
+        if ((pElement->socketIdx != TRDP_INVALID_SOCKET_INDEX) &&
+            (appHandle->ifacePD[pElement->socketIdx].pTxStampRef != NULL))
+        {
+            UINT32 i;
+            for (i = 0u; i < TRDP_TX_STAMP_REFS; i++)
+            {
+                if (appHandle->ifacePD[pElement->socketIdx].pTxStampRef[i].pElement == pElement)
+                {
+                    appHandle->ifacePD[pElement->socketIdx].pTxStampRef[i].pElement = NULL;
+                }
+            }
+        }
         trdp_releaseSocket(appHandle->ifacePD, pElement->socketIdx, 0u, FALSE, VOS_INADDR_ANY);
         pElement->magic = 0u;
         if (pElement->pSeqCntList != NULL)
         {
             vos_memFree(pElement->pSeqCntList);
         }
+        if (pElement->pHisto != NULL)
+        {
+            vos_memFree(pElement->pHisto);
+        }
         vos_memFree(pElement->pFrame);
         vos_memFree(pElement);
 
@@ -847,6 +851,57 @@ EXT_DECL TRDP_ERR_T  tlp_unpublish (
     return ret;      /*    Not found    */
 }
 
+/**********************************************************************************************************************/
+/** Get the transmit timing statistics of a publisher.
+ *  Statistics are only collected for publishers using the txTime send parameter on targets supporting
+ *  launch times and TX timestamps (Linux).
+ *
+ *  @param[in]      appHandle           the handle returned by tlc_openSession
+ *  @param[in]      pubHandle           the handle returned by publish
+ *  @param[out]     pStats              pointer to statistics to be filled
+ *
+ *  @retval         TRDP_NO_ERR         no error
+ *  @retval         TRDP_PARAM_ERR      parameter error
+ *  @retval         TRDP_NOPUB_ERR      not published
+ *  @retval         TRDP_NOINIT_ERR     handle invalid
+ */
+EXT_DECL TRDP_ERR_T tlp_getPubTxStats (
+    TRDP_APP_SESSION_T  appHandle,
+    TRDP_PUB_T          pubHandle,
+    TRDP_PUB_TX_STATS_T *pStats)
+{
+    PD_ELE_T    *pElement = (PD_ELE_T *)pubHandle;
+    TRDP_ERR_T  ret;
+
+    if ((pElement == NULL) || (pStats == NULL))
+    {
+        return TRDP_PARAM_ERR;
+    }
+
+    if (pElement->magic != TRDP_MAGIC_PUB_HNDL_VALUE)
+    {
+        return TRDP_NOPUB_ERR;
+    }
+
+    if (!trdp_isValidSession(appHandle))
+    {
+        return TRDP_NOINIT_ERR;
+    }
+
+    ret = (TRDP_ERR_T) vos_mutexLock(appHandle->mutexTxPD);
+    if (ret == TRDP_NO_ERR)
+    {
+        *pStats = pElement->txStats;
+
+        if (vos_mutexUnlock(appHandle->mutexTxPD) != VOS_NO_ERR)
+        {
+            vos_printLogStr(VOS_LOG_INFO, "vos_mutexUnlock() failed\n");
+        }
+    }
+
+    return ret;
+}
+
 /**********************************************************************************************************************/
 /** Update the process data to send.
  *  Update previously published data. The new telegram will be sent earliest when tlc_process is called.
@@ -1021,6 +1076,7 @@ EXT_DECL TRDP_ERR_T tlp_request (
     PD_ELE_T                *pSubPD         = (PD_ELE_T *) subHandle;
     PD_ELE_T                *pReqElement    = NULL;
     TRDP_PR_SEQ_CNT_LIST_T  *pListElement   = NULL;
+    TRDP_RED_GROUP_T        *pRedGroup      = NULL;
 
     /*    Check params    */
     if ((appHandle == NULL)
@@ -1067,8 +1123,16 @@ EXT_DECL TRDP_ERR_T tlp_request (
                 Handling for Ticket #172!
          */
 
-        /*  Get a new element   */
-        pReqElement = (PD_ELE_T *) vos_memAlloc(sizeof(PD_ELE_T));
+        /*  Get a new element and the redundancy group it joins   */
+        if ((0u != redId) &&
+            ((pRedGroup = trdp_pdRedGroupReserve(appHandle, redId)) == NULL))
+        {
+            pReqElement = NULL;
+        }
+        else
+        {
+            pReqElement = (PD_ELE_T *) vos_memAlloc(sizeof(PD_ELE_T));
+        }
 
         if (pReqElement == NULL)
         {
@@ -1157,6 +1221,12 @@ EXT_DECL TRDP_ERR_T tlp_request (
                     pReqElement->curSeqCnt = pListElement->lastSeqCnt;
                     pListElement->lastSeqCnt++;
 
+                    /*    Join the redundancy group, the request follows the leadership state of the group */
+                    if (pRedGroup != NULL)
+                    {
+                        trdp_pdRedGroupAdd(pRedGroup, pReqElement);
+                    }
+
                     /*    Enter this request into the send queue.    */
                     trdp_queueInsFirst(&appHandle->pSndQueue, pReqElement);
                 }
@@ -1387,6 +1457,7 @@ EXT_DECL TRDP_ERR_T tlp_subscribe (
                         (pfCbFunction == NULL) ? appHandle->pdDefault.pfCbFunction : pfCbFunction;
                     newPD->pCachedDS    = NULL;
                     newPD->magic        = TRDP_MAGIC_SUB_HNDL_VALUE;
+                    (void) trdp_pdAllocHisto(appHandle, newPD);     /* a telegram without histograms is logged */
 
                     if (timeout == TRDP_INFINITE_TIMEOUT)
                     {
@@ -1403,6 +1474,15 @@ EXT_DECL TRDP_ERR_T tlp_subscribe (
                     trdp_queueAppLast(&appHandle->pRcvQueue, newPD);
 
                     *pSubHandle = (TRDP_SUB_T) newPD;
+
+                    if (appHandle->comIdFilter == TRUE)
+                    {
+                        trdp_pdUpdateComIdFilter(appHandle);
+                    }
+                    if (appHandle->busyPollTime != 0u)
+                    {
+                        (void) trdp_pdUpdateBusyPoll(appHandle);
+                    }
                 }
             }
         } /*lint !e438 unused newPD */
@@ -1472,6 +1552,20 @@ EXT_DECL TRDP_ERR_T tlp_unsubscribe (
         {
             vos_memFree(pElement->pSeqCntList);
         }
+        if (pElement->pHisto != NULL)
+        {
+            vos_memFree(pElement->pHisto);
+        }
+        if (pElement->pFilter != NULL)
+        {
+            vos_memFree(pElement->pFilter);
+        }
+        trdp_pdCbRelease(pElement);
+        trdp_pdBatchRemove(appHandle, pElement);
+        if (appHandle->pCbSub == pElement)
+        {
+            appHandle->pCbSub = NULL;   /* unsubscribed from its own callback */
+        }
         vos_memFree(pElement);
 
 #ifdef HIGH_PERF_INDEXED
@@ -1480,6 +1574,10 @@ EXT_DECL TRDP_ERR_T tlp_unsubscribe (
 #endif
 
         ret = TRDP_NO_ERR;
+        if (appHandle->comIdFilter == TRUE)
+        {
+            trdp_pdUpdateComIdFilter(appHandle);
+        }
         if (vos_mutexUnlock(appHandle->mutexRxPD) != VOS_NO_ERR)
         {
             vos_printLogStr(VOS_LOG_INFO, "vos_mutexUnlock() failed\n");
@@ -1489,6 +1587,477 @@ EXT_DECL TRDP_ERR_T tlp_unsubscribe (
     return ret;      /*    Not found    */
 }
 
+/**********************************************************************************************************************/
+/** Drop PD of unsubscribed comIds in the kernel.
+ *  If enabled, a socket filter is attached to each PD socket which only passes the comIds subscribed on that socket
+ *  (and PD pull requests). The filters are updated on each (re/un)subscription. Dropped packets do not show up in the
+ *  PD statistics. Depending on the target, this might not be supported.
+ *
+ *  @param[in]      appHandle           the handle returned by tlc_openSession
+ *  @param[in]      enable              TRUE to filter, FALSE to remove the filters
+ *
+ *  @retval         TRDP_NO_ERR         no error
+ *  @retval         TRDP_NOINIT_ERR     handle invalid
+ *  @retval         TRDP_UNKNOWN_ERR    not supported on this target
+ */
+EXT_DECL TRDP_ERR_T tlp_enableComIdFilter (
+    TRDP_APP_SESSION_T  appHandle,
+    BOOL8               enable)
+{
+    TRDP_ERR_T ret = TRDP_NO_ERR;
+
+    if (!trdp_isValidSession(appHandle))
+    {
+        return TRDP_NOINIT_ERR;
+    }
+
+    if (vos_mutexLock(appHandle->mutexRxPD) != VOS_NO_ERR)
+    {
+        return TRDP_NOINIT_ERR;
+    }
+
+    appHandle->comIdFilter = enable;
+    trdp_pdUpdateComIdFilter(appHandle);
+    if ((enable == TRUE) && (appHandle->comIdFilter == FALSE))
+    {
+        ret = TRDP_UNKNOWN_ERR;
+    }
+
+    if (vos_mutexUnlock(appHandle->mutexRxPD) != VOS_NO_ERR)
+    {
+        vos_printLogStr(VOS_LOG_INFO, "vos_mutexUnlock() failed\n");
+    }
+    return ret;
+}
+
+/**********************************************************************************************************************/
+/** Send and receive PD with an AF_XDP socket (kernel bypass).
+ *  An XDP program attached to the interface redirects the PD arriving on one of its queues to the AF_XDP socket,
+ *  where they are checked in place; only accepted ones are copied. Cyclic PD are sent with it, too; pulled PD, PD
+ *  with a launch time, to TSN or VLAN sockets and to destinations which are neither multicast nor known on the link
+ *  are still sent with the sockets. The sockets keep receiving anything else.
+ *  Zero copy is used if wanted and supported by the driver, else copy mode. Needs CAP_NET_RAW and CAP_BPF (or root)
+ *  and an interface with an IPv4 address.
+ *
+ *  @param[in]      appHandle           the handle returned by tlc_openSession
+ *  @param[in]      pIfName             interface name, NULL to close the AF_XDP socket
+ *  @param[in]      queueId             receive queue of the interface
+ *  @param[in]      zeroCopy            try zero copy
+ *
+ *  @retval         TRDP_NO_ERR         no error
+ *  @retval         TRDP_NOINIT_ERR     handle invalid
+ *  @retval         TRDP_PARAM_ERR      parameter error
+ *  @retval         TRDP_SOCK_ERR       AF_XDP socket or XDP program could not be set up
+ *  @retval         TRDP_UNKNOWN_ERR    not supported on this target
+ */
+EXT_DECL TRDP_ERR_T tlp_enableXdp (
+    TRDP_APP_SESSION_T  appHandle,
+    const CHAR8         *pIfName,
+    UINT32              queueId,
+    BOOL8               zeroCopy)
+{
+#ifdef XDP_SUPPORT
+    TRDP_ERR_T ret = TRDP_NO_ERR;
+
+    if (!trdp_isValidSession(appHandle))
+    {
+        return TRDP_NOINIT_ERR;
+    }
+
+    /*  The socket is used for sending and receiving    */
+    if (vos_mutexLock(appHandle->mutexTxPD) != VOS_NO_ERR)
+    {
+        return TRDP_NOINIT_ERR;
+    }
+    if (vos_mutexLock(appHandle->mutexRxPD) != VOS_NO_ERR)
+    {
+        (void) vos_mutexUnlock(appHandle->mutexTxPD);
+        return TRDP_NOINIT_ERR;
+    }
+
+    vos_xskFlush(appHandle->pdXsk);
+    vos_xskClose(appHandle->pdXsk);
+    appHandle->pdXsk = NULL;
+    if (pIfName != NULL)
+    {
+        ret = (TRDP_ERR_T) vos_xskOpen(&appHandle->pdXsk, pIfName, queueId, appHandle->pdDefault.port, zeroCopy);
+    }
+
+    (void) vos_mutexUnlock(appHandle->mutexRxPD);
+    (void) vos_mutexUnlock(appHandle->mutexTxPD);
+    return ret;
+#else
+    (void) appHandle;
+    (void) pIfName;
+    (void) queueId;
+    (void) zeroCopy;
+    return TRDP_UNKNOWN_ERR;
+#endif
+}
+
+/**********************************************************************************************************************/
+/** Statistics of the AF_XDP socket
+ *
+ *  @param[in]      appHandle           the handle returned by tlc_openSession
+ *  @param[out]     pStatistics         pointer to statistics
+ *
+ *  @retval         TRDP_NO_ERR         no error
+ *  @retval         TRDP_NOINIT_ERR     handle invalid
+ *  @retval         TRDP_PARAM_ERR      parameter error
+ *  @retval         TRDP_NOSESSION_ERR  no AF_XDP socket
+ *  @retval         TRDP_UNKNOWN_ERR    not supported on this target
+ */
+EXT_DECL TRDP_ERR_T tlp_getXdpStatistics (
+    TRDP_APP_SESSION_T      appHandle,
+    TRDP_XDP_STATISTICS_T   *pStatistics)
+{
+#ifdef XDP_SUPPORT
+    VOS_XSK_STATS_T stats;
+
+    if (!trdp_isValidSession(appHandle))
+    {
+        return TRDP_NOINIT_ERR;
+    }
+    if (pStatistics == NULL)
+    {
+        return TRDP_PARAM_ERR;
+    }
+    if (appHandle->pdXsk == NULL)
+    {
+        return TRDP_NOSESSION_ERR;
+    }
+    vos_xskGetStatistics(appHandle->pdXsk, &stats);
+    pStatistics->numRx          = stats.numRx;
+    pStatistics->numTx          = stats.numTx;
+    pStatistics->numRxInvalid   = stats.numRxInvalid;
+    pStatistics->numTxNoFrame   = stats.numTxNoFrame;
+    pStatistics->numTxNoNeigh   = stats.numTxNoNeigh;
+    pStatistics->zeroCopy       = stats.zeroCopy;
+    pStatistics->nativeXdp      = stats.nativeXdp;
+    return TRDP_NO_ERR;
+#else
+    (void) appHandle;
+    (void) pStatistics;
+    return TRDP_UNKNOWN_ERR;
+#endif
+}
+
+/**********************************************************************************************************************/
+/** Send and receive PD with an io_uring.
+ *  The PD sockets waited for by tlp_getInterval()/tlc_getInterval() get a multishot receive instead, their
+ *  datagrams are collected in the receive buffers of the ring and processed by tlp_processReceive()/tlc_process()
+ *  when the descriptor of the ring is readable. The PD of a send cycle are handed to the kernel with one system call.
+ *  Pulled PD and PD with a launch time are still sent with the sockets, MD is not affected.
+ *  The receives are run by the thread calling tlp_getInterval()/tlc_getInterval(), it should be the one waiting in
+ *  select() as well. If the kernel does not provide the needed io_uring features (Linux 6.0), TRDP_SOCK_ERR is
+ *  returned and the sockets are used as before.
+ *
+ *  @param[in]      appHandle           the handle returned by tlc_openSession
+ *  @param[in]      noOfBuffers         number of receive buffers (of 2kB), 0 to close the io_uring
+ *
+ *  @retval         TRDP_NO_ERR         no error
+ *  @retval         TRDP_NOINIT_ERR     handle invalid
+ *  @retval         TRDP_PARAM_ERR      parameter error
+ *  @retval         TRDP_SOCK_ERR       io_uring not available
+ *  @retval         TRDP_UNKNOWN_ERR    not supported on this target
+ */
+EXT_DECL TRDP_ERR_T tlp_enableUring (
+    TRDP_APP_SESSION_T  appHandle,
+    UINT32              noOfBuffers)
+{
+#ifdef URING_SUPPORT
+    TRDP_ERR_T ret = TRDP_NO_ERR;
+
+    if (!trdp_isValidSession(appHandle))
+    {
+        return TRDP_NOINIT_ERR;
+    }
+
+    /*  The ring is used for sending and receiving    */
+    if (vos_mutexLock(appHandle->mutexTxPD) != VOS_NO_ERR)
+    {
+        return TRDP_NOINIT_ERR;
+    }
+    if (vos_mutexLock(appHandle->mutexRxPD) != VOS_NO_ERR)
+    {
+        (void) vos_mutexUnlock(appHandle->mutexTxPD);
+        return TRDP_NOINIT_ERR;
+    }
+
+    vos_uringFlush(appHandle->pdUring);
+    vos_uringClose(appHandle->pdUring);
+    appHandle->pdUring = NULL;
+    if (noOfBuffers != 0u)
+    {
+        ret = (TRDP_ERR_T) vos_uringOpen(&appHandle->pdUring, noOfBuffers);
+    }
+
+    (void) vos_mutexUnlock(appHandle->mutexRxPD);
+    (void) vos_mutexUnlock(appHandle->mutexTxPD);
+    return ret;
+#else
+    (void) appHandle;
+    (void) noOfBuffers;
+    return TRDP_UNKNOWN_ERR;
+#endif
+}
+
+/**********************************************************************************************************************/
+/** Statistics of the io_uring
+ *
+ *  @param[in]      appHandle           the handle returned by tlc_openSession
+ *  @param[out]     pStatistics         pointer to statistics
+ *
+ *  @retval         TRDP_NO_ERR         no error
+ *  @retval         TRDP_NOINIT_ERR     handle invalid
+ *  @retval         TRDP_PARAM_ERR      parameter error
+ *  @retval         TRDP_NOSESSION_ERR  no io_uring
+ *  @retval         TRDP_UNKNOWN_ERR    not supported on this target
+ */
+EXT_DECL TRDP_ERR_T tlp_getUringStatistics (
+    TRDP_APP_SESSION_T      appHandle,
+    TRDP_URING_STATISTICS_T *pStatistics)
+{
+#ifdef URING_SUPPORT
+    VOS_URING_STATS_T stats;
+
+    if (!trdp_isValidSession(appHandle))
+    {
+        return TRDP_NOINIT_ERR;
+    }
+    if (pStatistics == NULL)
+    {
+        return TRDP_PARAM_ERR;
+    }
+    if (appHandle->pdUring == NULL)
+    {
+        return TRDP_NOSESSION_ERR;
+    }
+    vos_uringGetStatistics(appHandle->pdUring, &stats);
+    pStatistics->numRx          = stats.numRx;
+    pStatistics->numRxInvalid   = stats.numRxInvalid;
+    pStatistics->numTx          = stats.numTx;
+    pStatistics->numTxErr       = stats.numTxErr;
+    pStatistics->numArmed       = stats.numArmed;
+    pStatistics->numNoBuf       = stats.numNoBuf;
+    pStatistics->numEnter       = stats.numEnter;
+    return TRDP_NO_ERR;
+#else
+    (void) appHandle;
+    (void) pStatistics;
+    return TRDP_UNKNOWN_ERR;
+#endif
+}
+
+/**********************************************************************************************************************/
+/** Busy poll for PD instead of waiting for the wakeup.
+ *  If a spin budget is set, tlp_processReceive() called before blocking (with the descriptor set returned by
+ *  tlp_getInterval() and *pCount == 0) reads the PD sockets of the set without blocking, over and over, until a
+ *  packet arrives or the budget is used up. If nothing arrived, TRDP_NODATA_ERR is returned and the unchanged set can
+ *  be passed to select() to block for the rest of the interval:
+ *
+ *      tlp_getInterval(appHandle, &tv, &rfds, &noDesc);
+ *      rv = 0;
+ *      if (tlp_processReceive(appHandle, &rfds, &rv) == TRDP_NODATA_ERR)
+ *      {
+ *          rv = vos_select(noDesc + 1, &rfds, NULL, NULL, &tv);
+ *          (void) tlp_processReceive(appHandle, &rfds, &rv);
+ *      }
+ *
+ *  The receive mutex is held while spinning, so the budget should stay well below the process cycle; the spinning
+ *  thread is best pinned to a CPU of its own, e.g. as a cyclic thread started shortly before the expected arrival.
+ *  Additionally, the PD sockets of the session can busy poll the queue of the network device on each receive (Linux
+ *  SO_BUSY_POLL / SO_PREFER_BUSY_POLL; needs CAP_NET_ADMIN above net.core.busy_read). Sockets opened later by
+ *  tlp_subscribe() are set up, too. Not available with TRDP_OPTION_BLOCK.
+ *
+ *  @param[in]      appHandle           the handle returned by tlc_openSession
+ *  @param[in]      spinBudget          max. time to spin in tlp_processReceive() in us, 0 to not spin
+ *  @param[in]      busyPollTime        device busy poll time of the PD sockets in us, 0 for none
+ *
+ *  @retval         TRDP_NO_ERR         no error
+ *  @retval         TRDP_NOINIT_ERR     handle invalid
+ *  @retval         TRDP_PARAM_ERR      blocking sockets cannot be spun on
+ *  @retval         TRDP_SOCK_ERR       busy poll time not set on all sockets (e.g. missing privileges)
+ *  @retval         TRDP_UNKNOWN_ERR    socket busy polling not supported on this target (the spin budget is used)
+ */
+EXT_DECL TRDP_ERR_T tlp_setBusyPoll (
+    TRDP_APP_SESSION_T  appHandle,
+    UINT32              spinBudget,
+    UINT32              busyPollTime)
+{
+    TRDP_ERR_T ret;
+
+    if (!trdp_isValidSession(appHandle))
+    {
+        return TRDP_NOINIT_ERR;
+    }
+
+    if ((spinBudget != 0u) && ((appHandle->option & TRDP_OPTION_BLOCK) != 0u))
+    {
+        vos_printLogStr(VOS_LOG_ERROR, "Busy polling needs non-blocking sockets\n");
+        return TRDP_PARAM_ERR;
+    }
+
+    if (vos_mutexLock(appHandle->mutexRxPD) != VOS_NO_ERR)
+    {
+        return TRDP_NOINIT_ERR;
+    }
+
+    appHandle->busyPollBudget   = spinBudget;
+    appHandle->busyPollTime     = busyPollTime;
+    ret = trdp_pdUpdateBusyPoll(appHandle);
+
+    if (vos_mutexUnlock(appHandle->mutexRxPD) != VOS_NO_ERR)
+    {
+        vos_printLogStr(VOS_LOG_INFO, "vos_mutexUnlock() failed\n");
+    }
+    return ret;
+}
+
+/**********************************************************************************************************************/
+/** Execute the subscriber callbacks on a pool of callback threads.
+ *  If enabled, the receiving thread hands received packets and timeouts over to the callback threads instead of
+ *  calling back itself, so a slow callback does not delay the reception on other sockets or the timeout supervision.
+ *  Callbacks of one subscription are executed one after the other; if they cannot keep up, only the newest sample
+ *  is delivered. The data passed to a deferred callback is a copy, and a callback already executing may still
+ *  return after tlp_unsubscribe(). Timing histograms do not cover deferred callbacks.
+ *  Must not be called from a callback.
+ *
+ *  @param[in]      appHandle           the handle returned by tlc_openSession
+ *  @param[in]      noOfThreads         number of callback threads, 0 to call back from the receiving thread again
+ *  @param[in]      policy              scheduling policy of the callback threads
+ *  @param[in]      priority            scheduling priority of the callback threads
+ *
+ *  @retval         TRDP_NO_ERR         no error
+ *  @retval         TRDP_NOINIT_ERR     handle invalid
+ *  @retval         TRDP_PARAM_ERR      too many threads
+ *  @retval         TRDP_MEM_ERR        out of memory
+ *  @retval         TRDP_THREAD_ERR     thread could not be created
+ *  @retval         TRDP_UNKNOWN_ERR    not supported on this target
+ */
+EXT_DECL TRDP_ERR_T tlp_enableCallbackPool (
+    TRDP_APP_SESSION_T      appHandle,
+    UINT32                  noOfThreads,
+    VOS_THREAD_POLICY_T     policy,
+    VOS_THREAD_PRIORITY_T   priority)
+{
+    if (!trdp_isValidSession(appHandle))
+    {
+        return TRDP_NOINIT_ERR;
+    }
+    if (noOfThreads > TRDP_PD_CB_MAX_THREADS)
+    {
+        return TRDP_PARAM_ERR;
+    }
+
+    trdp_pdCbPoolStop(appHandle, NULL);
+    if (noOfThreads == 0u)
+    {
+        return TRDP_NO_ERR;
+    }
+    return trdp_pdCbPoolStart(appHandle, noOfThreads, policy, priority);
+}
+/**********************************************************************************************************************/
+/** Report all telegrams updated during a receive pass with one callback.
+ *  If set, the telegrams received or timed out during one call of tlp_processReceive() (or tlc_process()) are
+ *  collected and reported together at the end of that call, instead of calling back per telegram. This covers the
+ *  subscriptions with TRDP_FLAGS_CALLBACK (with or without an own callback function). A telegram received more than
+ *  once in a pass is reported once, with its newest data. The data pointers are valid during the callback only.
+ *  The batch callback takes precedence over the callback pool.
+ *
+ *  @param[in]      appHandle           the handle returned by tlc_openSession
+ *  @param[in]      pfCbFunction        batch callback, NULL to call back per telegram again
+ *  @param[in]      pRefCon             user context passed to the batch callback
+ *
+ *  @retval         TRDP_NO_ERR         no error
+ *  @retval         TRDP_NOINIT_ERR     handle invalid
+ */
+EXT_DECL TRDP_ERR_T tlp_setBatchCallback (
+    TRDP_APP_SESSION_T          appHandle,
+    TRDP_PD_BATCH_CALLBACK_T    pfCbFunction,
+    void                        *pRefCon)
+{
+    if (!trdp_isValidSession(appHandle))
+    {
+        return TRDP_NOINIT_ERR;
+    }
+
+    if (vos_mutexLock(appHandle->mutexRxPD) != VOS_NO_ERR)
+    {
+        return TRDP_NOINIT_ERR;
+    }
+
+    /*  Report what was collected so far to the former callback    */
+    trdp_pdBatchFlush(appHandle);
+    appHandle->pfBatchCb    = pfCbFunction;
+    appHandle->pBatchRefCon = pRefCon;
+
+    if (vos_mutexUnlock(appHandle->mutexRxPD) != VOS_NO_ERR)
+    {
+        vos_printLogStr(VOS_LOG_INFO, "vos_mutexUnlock() failed\n");
+    }
+    return TRDP_NO_ERR;
+}
+
+/**********************************************************************************************************************/
+/** Call back only if selected fields of the dataset change.
+ *  The received data is compared field by field with the previous packet; the changed fields are passed in
+ *  TRDP_PD_INFO_T.changeMask (bit n: field n). The subscriber is called back only if one of the fields selected by
+ *  fieldMask changed, for a numeric field with a deadband only if its value moved beyond the deadband since the last
+ *  callback. The first packet after setting the filter is always reported. TRDP_FLAGS_FORCE_CB and time outs are
+ *  reported regardless of the filter.
+ *  The fields refer to the received (marshalled) data; tau_getFieldsByComId() provides them from the dataset
+ *  configuration.
+ *
+ *  @param[in]      appHandle           the handle returned by tlc_openSession
+ *  @param[in]      subHandle           the handle returned by subscription
+ *  @param[in]      pFields             up to TRDP_PD_MAX_FIELDS fields in ascending order, NULL to remove the filter
+ *  @param[in]      noOfFields          number of fields
+ *  @param[in]      fieldMask           fields which trigger a callback (bit n: field n)
+ *
+ *  @retval         TRDP_NO_ERR         no error
+ *  @retval         TRDP_PARAM_ERR      parameter error
+ *  @retval         TRDP_NOSUB_ERR      not subscribed
+ *  @retval         TRDP_NOINIT_ERR     handle invalid
+ *  @retval         TRDP_MEM_ERR        out of memory
+ */
+EXT_DECL TRDP_ERR_T tlp_setChangeFilter (
+    TRDP_APP_SESSION_T      appHandle,
+    TRDP_SUB_T              subHandle,
+    const TRDP_PD_FIELD_T   *pFields,
+    UINT32                  noOfFields,
+    UINT64                  fieldMask)
+{
+    TRDP_ERR_T ret;
+
+    if (subHandle == NULL)
+    {
+        return TRDP_PARAM_ERR;
+    }
+
+    if (subHandle->magic != TRDP_MAGIC_SUB_HNDL_VALUE)
+    {
+        return TRDP_NOSUB_ERR;
+    }
+
+    if (!trdp_isValidSession(appHandle))
+    {
+        return TRDP_NOINIT_ERR;
+    }
+
+    if (vos_mutexLock(appHandle->mutexRxPD) != VOS_NO_ERR)
+    {
+        return TRDP_NOINIT_ERR;
+    }
+
+    ret = trdp_pdSetChangeFilter(subHandle, pFields, noOfFields, fieldMask);
+
+    if (vos_mutexUnlock(appHandle->mutexRxPD) != VOS_NO_ERR)
+    {
+        vos_printLogStr(VOS_LOG_INFO, "vos_mutexUnlock() failed\n");
+    }
+    return ret;
+}
 
 /**********************************************************************************************************************/
 /** Reprepare for receiving PD messages.
@@ -1585,6 +2154,15 @@ EXT_DECL TRDP_ERR_T tlp_resubscribe (
         subHandle->addr.mcGroup = 0u;
     }
 
+    if ((ret == TRDP_NO_ERR) && (appHandle->comIdFilter == TRUE))
+    {
+        trdp_pdUpdateComIdFilter(appHandle);
+    }
+    if ((ret == TRDP_NO_ERR) && (appHandle->busyPollTime != 0u))
+    {
+        (void) trdp_pdUpdateBusyPoll(appHandle);
+    }
+
     if (vos_mutexUnlock(appHandle->mutexRxPD) != VOS_NO_ERR)
     {
         vos_printLogStr(VOS_LOG_INFO, "vos_mutexUnlock() failed\n");
@@ -1692,6 +2270,8 @@ EXT_DECL TRDP_ERR_T tlp_get (
             pPdInfo->replyIpAddr    = vos_ntohl(pElement->pFrame->frameHead.replyIpAddress);
             pPdInfo->pUserRef       = pElement->pUserRef;
             pPdInfo->resultCode     = ret;
+            pPdInfo->rxTime         = pElement->rxTime;
+            pPdInfo->changeMask     = pElement->changeMask;
         }
 
         if (vos_mutexUnlock(appHandle->mutexRxPD) != VOS_NO_ERR)
@@ -20,6 +20,10 @@
  /*
  * $Id$
  *
+ *      AG 2026-10-19: trdp_mdCallMulti(): notify/request to several destinations, shared payload, batched send
+ *      AG 2026-10-19: Notify/reply payloads sent by reference (scatter/gather), optional MSG_ZEROCOPY
+ *      AG 2026-10-19: Round trip time estimation per peer, adaptive retry timeout for UDP requests
+ *      AG 2026-10-19: Kernel receive timestamps for reply/confirm timeouts and TRDP_MD_INFO_T.rxTime
  *      SB 2020-03-30: Ticket #309 Added pointer to a Session's Listener
  *      SB 2020-03-20: Ticket #324 mutexMD added to reply and confirm functions
  *      BL 2019-09-10: Ticket #278 Don't check if a socket is < 0
@@ -133,9 +137,21 @@ static TRDP_ERR_T   trdp_mdCheck (TRDP_SESSION_PT   appHandle,
                                   MD_HEADER_T       *pPacket,
                                   UINT32            packetSize,
                                   BOOL8             checkHeaderOnly);
-static TRDP_ERR_T   trdp_mdSendPacket (SOCKET   mdSock,
-                                       UINT16   port,
-                                       MD_ELE_T *pElement);
+static TRDP_ERR_T   trdp_mdSendPacket (TRDP_SESSION_PT  appHandle,
+                                       UINT16           port,
+                                       MD_ELE_T         *pElement);
+static BOOL8        trdp_mdPayloadByRef (TRDP_SESSION_PT    appHandle,
+                                         TRDP_MSG_T         msgType,
+                                         TRDP_FLAGS_T       pktFlags,
+                                         const UINT8        *pData,
+                                         UINT32             dataSize);
+static void         trdp_mdRetireSession (TRDP_SESSION_PT   appHandle,
+                                          MD_ELE_T          *pElement);
+static void         trdp_mdCheckZeroCopy (TRDP_SESSION_PT appHandle);
+static void         trdp_mdReleaseShared (void          *pRefCon,
+                                          const UINT8   *pData,
+                                          UINT32        dataSize);
+static void         trdp_mdSendBatch (TRDP_SESSION_PT appHandle);
 static TRDP_ERR_T   trdp_mdRecvTCPPacket (TRDP_SESSION_PT   appHandle,
                                           SOCKET            mdSock,
                                           MD_ELE_T          *pElement);
@@ -365,6 +381,7 @@ static void trdp_mdInvokeCallback (const MD_ELE_T           *pMdItem,
 
     /* theMessage.pUserRef     = appHandle->mdDefault.pRefCon; */
     theMessage.resultCode = resultCode;
+    theMessage.rxTime     = pMdItem->rxTime;
 
     if ((resultCode == TRDP_NO_ERR) && (pMdItem->pPacket != NULL))
     {
@@ -376,7 +393,7 @@ static void trdp_mdInvokeCallback (const MD_ELE_T           *pMdItem,
             appHandle->mdDefault.pRefCon,
             appHandle,
             &theMessage,
-            (UINT8 *)(pMdItem->pPacket->data),
+            (pMdItem->pRefData != NULL) ? (UINT8 *) pMdItem->pRefData : (UINT8 *)(pMdItem->pPacket->data),
             vos_ntohl(pMdItem->pPacket->frameHead.datasetLength));
     }
     else
@@ -395,6 +412,147 @@ static void trdp_mdInvokeCallback (const MD_ELE_T           *pMdItem,
     }
 }
 
+/**********************************************************************************************************************/
+/** Find the round trip time estimation of a peer
+ *
+ *  @param[in]      appHandle       session pointer
+ *  @param[in]      ipAddr          IP address of the peer
+ *  @param[in]      create          TRUE: recycle the least recently used entry if the peer is unknown
+ *
+ *  @retval         pointer to the peer entry or NULL
+ */
+static TRDP_MD_PEER_T *trdp_mdGetPeer (TRDP_SESSION_PT appHandle, TRDP_IP_ADDR_T ipAddr, BOOL8 create)
+{
+    TRDP_MD_PEER_T  *pOldest = &appHandle->mdPeer[0];
+    UINT32          i;
+
+    if (ipAddr == 0u)
+    {
+        return NULL;
+    }
+    for (i = 0u; i < TRDP_MD_PEER_CNT; i++)
+    {
+        if (appHandle->mdPeer[i].ipAddr == ipAddr)
+        {
+            return &appHandle->mdPeer[i];
+        }
+        if ((pOldest->ipAddr != 0u) &&
+            ((appHandle->mdPeer[i].ipAddr == 0u) ||
+             (vos_cmpTime(&appHandle->mdPeer[i].lastUsed, &pOldest->lastUsed) < 0)))
+        {
+            pOldest = &appHandle->mdPeer[i];
+        }
+    }
+    if (create == FALSE)
+    {
+        return NULL;
+    }
+    memset(pOldest, 0, sizeof(TRDP_MD_PEER_T));
+    pOldest->ipAddr = ipAddr;
+    return pOldest;
+}
+
+/**********************************************************************************************************************/
+/** Update the round trip time estimation of a peer (Jacobson/Karels, RFC 6298)
+ *
+ *  @param[in,out]  pPeer           peer entry
+ *  @param[in]      rtt             measured round trip time in us
+ */
+static void trdp_mdSampleRtt (TRDP_MD_PEER_T *pPeer, UINT32 rtt)
+{
+    UINT32 delta;
+
+    if (pPeer->numSamples == 0u)
+    {
+        pPeer->srtt     = rtt;
+        pPeer->rttVar   = rtt / 2u;
+    }
+    else
+    {
+        delta           = (pPeer->srtt > rtt) ? (pPeer->srtt - rtt) : (rtt - pPeer->srtt);
+        pPeer->rttVar   = (UINT32)(((UINT64)pPeer->rttVar * 3u + delta) / 4u);
+        pPeer->srtt     = (UINT32)(((UINT64)pPeer->srtt * 7u + rtt) / 8u);
+    }
+    pPeer->lastRtt = rtt;
+    pPeer->numSamples++;
+}
+
+/**********************************************************************************************************************/
+/** Return the adaptive retry timeout of a peer: srtt + 4 * rttVar, bounded by the session's lower bound and maxTimeout
+ *
+ *  @param[in]      appHandle       session pointer
+ *  @param[in]      pPeer           peer entry or NULL
+ *  @param[in]      maxTimeout      upper bound (the reply timeout) in us
+ *
+ *  @retval         retry timeout in us, maxTimeout if nothing was measured yet
+ */
+UINT32 trdp_mdPeerRetryTimeout (TRDP_SESSION_PT appHandle, const TRDP_MD_PEER_T *pPeer, UINT32 maxTimeout)
+{
+    UINT64 timeout;
+
+    if ((pPeer == NULL) || (pPeer->numSamples == 0u))
+    {
+        return maxTimeout;
+    }
+    timeout = (UINT64)pPeer->srtt + 4u * (UINT64)pPeer->rttVar;
+    if (timeout < appHandle->mdMinRetryTimeout)
+    {
+        timeout = appHandle->mdMinRetryTimeout;
+    }
+    return (timeout < maxTimeout) ? (UINT32)timeout : maxTimeout;
+}
+
+/**********************************************************************************************************************/
+/** Note a sent request and arm its adaptive retry timer.
+ *  Only unicast UDP requests expecting one reply are tracked (the ones which might be retransmitted).
+ *  The retry timeout doubles with every retry, the last try waits for the full reply timeout.
+ *
+ *  @param[in]      appHandle       session pointer
+ *  @param[in,out]  pElement        the request just sent
+ */
+static void trdp_mdArmRetry (TRDP_SESSION_PT appHandle, MD_ELE_T *pElement)
+{
+    TRDP_MD_PEER_T  *pPeer;
+    TRDP_TIME_T     timeOut;
+    UINT32          interval;
+    UINT32          timeout;
+    UINT32          i;
+
+    vos_getTime(&pElement->txTime);
+
+    if (((pElement->pktFlags & TRDP_FLAGS_TCP) != 0) ||
+        (pElement->numExpReplies != 1u) ||
+        (pElement->addr.mcGroup != 0u))
+    {
+        return;
+    }
+    pPeer = trdp_mdGetPeer(appHandle, pElement->addr.destIpAddr, TRUE);
+    if (pPeer == NULL)
+    {
+        return;
+    }
+    pPeer->lastUsed = pElement->txTime;
+
+    interval = (UINT32)pElement->interval.tv_sec * 1000000u + (UINT32)pElement->interval.tv_usec;
+    if ((appHandle->mdAdaptiveRetry == FALSE) || (interval == 0u))
+    {
+        return;
+    }
+    timeout = interval;
+    if (pElement->numRetries < pElement->numRetriesMax)
+    {
+        timeout = trdp_mdPeerRetryTimeout(appHandle, pPeer, interval);
+        for (i = 0u; (i < pElement->numRetries) && (timeout < interval); i++)
+        {
+            timeout = (timeout > (interval / 2u)) ? interval : (timeout * 2u);
+        }
+    }
+    timeOut.tv_sec      = timeout / 1000000u;
+    timeOut.tv_usec     = timeout % 1000000u;
+    pElement->timeToGo  = pElement->txTime;
+    vos_addTime(&pElement->timeToGo, &timeOut);
+}
+
 /**********************************************************************************************************************/
 /** Handle and manage the time out and communication state of a given MD_ELE_T
  *
@@ -407,7 +565,8 @@ static void trdp_mdInvokeCallback (const MD_ELE_T           *pMdItem,
  */
 static BOOL8 trdp_mdTimeOutStateHandler ( MD_ELE_T *pElement, TRDP_SESSION_PT appHandle, TRDP_ERR_T *pResult)
 {
-    BOOL8 hasTimedOut = FALSE;
+    BOOL8           hasTimedOut = FALSE;
+    TRDP_MD_PEER_T  *pPeer;
     /* timeout on queue ? */
     switch ( pElement->stateEle )
     {
@@ -460,6 +619,11 @@ static BOOL8 trdp_mdTimeOutStateHandler ( MD_ELE_T *pElement, TRDP_SESSION_PT ap
                        (pElement->pPacket != NULL))
                    {
                        vos_printLogStr(VOS_LOG_INFO, "UDP MD start retransmission\n");
+                       pPeer = trdp_mdGetPeer(appHandle, pElement->addr.destIpAddr, FALSE);
+                       if (pPeer != NULL)
+                       {
+                           pPeer->numRetries++;
+                       }
                        /* Retransmission will occur upon resetting the state of  */
                        /* this MD_ELE_T item to TRDP_ST_TX_REQUEST_ARM, for ref- */
                        /* erence check the trdp_mdSend function                  */
@@ -484,6 +648,15 @@ static BOOL8 trdp_mdTimeOutStateHandler ( MD_ELE_T *pElement, TRDP_SESSION_PT ap
                        pElement->morituri   = TRUE;
                        hasTimedOut          = TRUE;
                        *pResult = TRDP_REPLYTO_ERR;
+                       if ((pElement->numExpReplies == 1U) && (pElement->numReplies == 0u) &&
+                           (pElement->numRepliesQuery == 0u) && (pElement->addr.mcGroup == 0u))
+                       {
+                           pPeer = trdp_mdGetPeer(appHandle, pElement->addr.destIpAddr, FALSE);
+                           if (pPeer != NULL)
+                           {
+                               pPeer->numReplyTimeout++;
+                           }
+                       }
                    }
                    /* Statistics */
                    appHandle->stats.udpMd.numReplyTimeout++;
@@ -610,15 +783,42 @@ static MD_ELE_T *trdp_mdHandleConfirmReply (TRDP_APP_SESSION_T appHandle, MD_HEA
         /* try to get a session match - topo counts must have matched at this point, if applicable */
         if (0 == memcmp(iterMD->pPacket->frameHead.sessionID, pMdItemHeader->sessionID, TRDP_SESS_ID_SIZE))
         {
+            /* Measure the round trip time on the first reply to a request sent once (Karn's algorithm) */
+            if (((vos_ntohs(pMdItemHeader->msgType) == TRDP_MSG_MP) ||
+                 (vos_ntohs(pMdItemHeader->msgType) == TRDP_MSG_MQ))
+                && (iterMD->stateEle == TRDP_ST_TX_REQUEST_W4REPLY)
+                && ((iterMD->pktFlags & TRDP_FLAGS_TCP) == 0)
+                && (iterMD->numRetries == 0u)
+                && (iterMD->numReplies == 0u)
+                && (iterMD->numRepliesQuery == 0u)
+                && (iterMD->addr.mcGroup == 0u)
+                && (vos_cmpTime(&appHandle->pMDRcvEle->rxTime, &iterMD->txTime) > 0))
+            {
+                TRDP_MD_PEER_T  *pPeer = trdp_mdGetPeer(appHandle, iterMD->addr.destIpAddr, FALSE);
+                TRDP_TIME_T     rtt    = appHandle->pMDRcvEle->rxTime;
+
+                if (pPeer != NULL)
+                {
+                    vos_subTime(&rtt, &iterMD->txTime);
+                    trdp_mdSampleRtt(pPeer, (UINT32)rtt.tv_sec * 1000000u + (UINT32)rtt.tv_usec);
+                }
+            }
             /* throw away old packet data  */
             if (NULL != iterMD->pPacket)
             {
                 vos_memFree(iterMD->pPacket);
             }
+            /* the request payload of a multi-destination request is no longer needed */
+            if ((NULL != iterMD->pRefData) && (NULL != iterMD->pfRelease))
+            {
+                iterMD->pfRelease(iterMD->pRelRefCon, iterMD->pRefData, iterMD->dataSize);
+            }
+            iterMD->pRefData = NULL;
             /* and get the newly received data  */
             iterMD->pPacket     = appHandle->pMDRcvEle->pPacket;
             iterMD->dataSize    = vos_ntohl(pMdItemHeader->datasetLength);
             iterMD->grossSize   = appHandle->pMDRcvEle->grossSize;
+            iterMD->rxTime      = appHandle->pMDRcvEle->rxTime;
 
             appHandle->pMDRcvEle->pPacket = NULL;
 
@@ -659,7 +859,7 @@ static MD_ELE_T *trdp_mdHandleConfirmReply (TRDP_APP_SESSION_T appHandle, MD_HEA
                     iterMD->stateEle = TRDP_ST_TX_REQ_W4AP_CONFIRM;
 
                     /* receive time */
-                    vos_getTime(&iterMD->timeToGo);
+                    iterMD->timeToGo = iterMD->rxTime;
                     /* timeout value */
                     /* the implementation of an infinite confirm timeout does not make sense */
                     iterMD->interval.tv_sec     = vos_ntohl(pMdItemHeader->replyTimeout) / 1000000u;
@@ -739,7 +939,7 @@ static void trdp_mdCloseSessions (
                          iterMD->sessionID[0], iterMD->sessionID[1], iterMD->sessionID[2], iterMD->sessionID[3],
                          iterMD->sessionID[4], iterMD->sessionID[5], iterMD->sessionID[6], iterMD->sessionID[7])
 
-            trdp_mdFreeSession(iterMD);
+            trdp_mdRetireSession(appHandle, iterMD);
             iterMD = appHandle->pMDSndQueue;
         }
         else
@@ -764,7 +964,7 @@ static void trdp_mdCloseSessions (
                          iterMD->pktFlags & TRDP_FLAGS_TCP ? "TCP" : "UDP",
                          iterMD->sessionID[0], iterMD->sessionID[1], iterMD->sessionID[2], iterMD->sessionID[3],
                          iterMD->sessionID[4], iterMD->sessionID[5], iterMD->sessionID[6], iterMD->sessionID[7])
-            trdp_mdFreeSession(iterMD);
+            trdp_mdRetireSession(appHandle, iterMD);
             iterMD = appHandle->pMDRcvQueue;
         }
         else
@@ -790,6 +990,85 @@ static void trdp_mdCloseSessions (
         appHandle->ifaceMD[socketIndex].tcpParams.addFileDesc = TRUE;
         appHandle->ifaceMD[socketIndex].tcpParams.connectionTimeout.tv_sec    = 0u;
         appHandle->ifaceMD[socketIndex].tcpParams.connectionTimeout.tv_usec   = 0;
+        appHandle->ifaceMD[socketIndex].zcState = TRDP_ZC_UNKNOWN;
+        appHandle->ifaceMD[socketIndex].zcSent  = 0u;
+        appHandle->ifaceMD[socketIndex].zcDone  = 0u;
+    }
+}
+
+/**********************************************************************************************************************/
+/** Free a closed session or keep it until the kernel has completed its zero copy send.
+ *
+ *  @param[in]      appHandle       session pointer
+ *  @param[in]      pElement        closed session, already removed from its queue
+ */
+static void trdp_mdRetireSession (
+    TRDP_SESSION_PT appHandle,
+    MD_ELE_T        *pElement)
+{
+    if (pElement->zcPending == TRUE)
+    {
+        /* The payload must not be released before the kernel is done with it */
+        pElement->pNext         = appHandle->pMDZcQueue;
+        appHandle->pMDZcQueue   = pElement;
+    }
+    else
+    {
+        trdp_mdFreeSession(pElement);
+    }
+}
+
+/**********************************************************************************************************************/
+/** Collect zero copy completions and free the sessions waiting for them.
+ *  Sessions are also freed if their socket was closed or replaced meanwhile.
+ *
+ *  @param[in]      appHandle       session pointer
+ */
+static void trdp_mdCheckZeroCopy (
+    TRDP_SESSION_PT appHandle)
+{
+    MD_ELE_T        * *ppElement = &appHandle->pMDZcQueue;
+    MD_ELE_T        *pElement;
+    TRDP_SOCKETS_T  *pIface;
+    UINT32          done;
+    UINT32          lIndex;
+
+    if (appHandle->pMDZcQueue == NULL)
+    {
+        return;
+    }
+
+    for (lIndex = 0u; lIndex < TRDP_MAX_MD_SOCKET_CNT; lIndex++)
+    {
+        pIface = &appHandle->ifaceMD[lIndex];
+        if ((pIface->zcState == TRDP_ZC_ENABLED) && (pIface->sock != VOS_INVALID_SOCKET))
+        {
+            while (vos_sockReceiveZeroCopy(pIface->sock, &done) == VOS_NO_ERR)
+            {
+                if ((INT32) (done - pIface->zcDone) > 0)
+                {
+                    pIface->zcDone = done;
+                }
+            }
+        }
+    }
+
+    while (*ppElement != NULL)
+    {
+        pElement    = *ppElement;
+        pIface      = &appHandle->ifaceMD[pElement->socketIdx];
+
+        if ((pIface->sock != pElement->zcSock)
+            || ((INT32) (pIface->zcDone - pElement->zcId) > 0)
+            || ((INT32) (pElement->zcId - pIface->zcSent) >= 0))      /* socket was reopened */
+        {
+            *ppElement = pElement->pNext;
+            trdp_mdFreeSession(pElement);
+        }
+        else
+        {
+            ppElement = &pElement->pNext;
+        }
     }
 }
 
@@ -973,25 +1252,145 @@ static void    trdp_mdUpdatePacket (MD_ELE_T *pElement)
     *hFCS = MAKE_LE(myCRC);
 }
 
+/**********************************************************************************************************************/
+/** Decide whether the payload of a new notification or reply is sent by reference.
+ *
+ *  @param[in]      appHandle       session pointer
+ *  @param[in]      msgType         type of the message
+ *  @param[in]      pktFlags        packet flags
+ *  @param[in]      pData           payload of the caller
+ *  @param[in]      dataSize        size of the payload
+ *  @retval         TRUE            the packet buffer holds the header only, pData is sent from the caller's buffer
+ */
+static BOOL8 trdp_mdPayloadByRef (
+    TRDP_SESSION_PT appHandle,
+    TRDP_MSG_T      msgType,
+    TRDP_FLAGS_T    pktFlags,
+    const UINT8     *pData,
+    UINT32          dataSize)
+{
+    /* Requests and replies with confirmation are kept beyond their send (retries, received packets replace the
+       packet buffer), only notifications and replies are released right after sending */
+    return (appHandle->mdRefSize != 0u)
+           && (dataSize >= appHandle->mdRefSize)
+           && (pData != NULL)
+           && ((msgType == TRDP_MSG_MN) || (msgType == TRDP_MSG_MP))
+           && !(((pktFlags & TRDP_FLAGS_MARSHALL) != 0) && (appHandle->marshall.pfCbMarshall != NULL));
+}
+
+/**********************************************************************************************************************/
+/** Release the payload of a multi-destination notify/request, freed with its last session.
+ *
+ *  @param[in]      pRefCon         the shared payload (TRDP_MD_SHARED_T)
+ *  @param[in]      pData           payload (unused)
+ *  @param[in]      dataSize        size of the payload (unused)
+ */
+static void trdp_mdReleaseShared (
+    void        *pRefCon,
+    const UINT8 *pData,
+    UINT32      dataSize)
+{
+    TRDP_MD_SHARED_T *pShared = (TRDP_MD_SHARED_T *) pRefCon;
+
+    (void) pData;
+    (void) dataSize;
+
+    if ((pShared != NULL) && (--pShared->refCnt == 0u))
+    {
+        vos_memFree(pShared);
+    }
+}
+
 /**********************************************************************************************************************/
 /** Send MD packet
+ *  Packets with a referenced payload are sent from the header and the caller's buffer (scatter/gather),
+ *  large ones with zero copy if enabled.
  *
- *  @param[in]      mdSock          socket descriptor
+ *  @param[in]      appHandle       session pointer
  *  @param[in]      port            port on which to send
  *  @param[in]      pElement        pointer to element to be sent
  *  @retval         != NULL         error
  */
-static TRDP_ERR_T  trdp_mdSendPacket (SOCKET    mdSock,
-                                      UINT16    port,
-                                      MD_ELE_T  *pElement)
+static TRDP_ERR_T  trdp_mdSendPacket (TRDP_SESSION_PT   appHandle,
+                                      UINT16            port,
+                                      MD_ELE_T          *pElement)
 {
-    VOS_ERR_T   err         = VOS_NO_ERR;
-    UINT32      tmpSndSize  = 0u;
+    static const UINT8  cPadding[4] = {0u, 0u, 0u, 0u};
+    TRDP_SOCKETS_T      *pIface     = &appHandle->ifaceMD[pElement->socketIdx];
+    SOCKET              mdSock      = pIface->sock;
+    VOS_ERR_T           err         = VOS_NO_ERR;
+    UINT32              tmpSndSize  = 0u;
+    VOS_IOVEC_T         iov[3];
+    UINT32              noOfIov     = 0u;
+    UINT32              skip;
+    UINT32              i;
+    BOOL8               zeroCopy    = FALSE;
 
     if ((pElement->pktFlags & TRDP_FLAGS_TCP) != 0)
     {
         tmpSndSize = pElement->sendSize;
+    }
+
+    if (pElement->pRefData != NULL)
+    {
+        /* Requests keep their payload for retries only until the reply arrives, they are never sent with zero copy */
+        if ((appHandle->mdZeroCopySize != 0u) && (pElement->dataSize >= appHandle->mdZeroCopySize)
+            && (pElement->stateEle != TRDP_ST_TX_REQUEST_ARM))
+        {
+            if (pIface->zcState == TRDP_ZC_UNKNOWN)
+            {
+                pIface->zcState = (vos_sockEnableZeroCopy(mdSock) == VOS_NO_ERR) ?
+                    TRDP_ZC_ENABLED : TRDP_ZC_UNSUPPORTED;
+            }
+            zeroCopy = (pIface->zcState == TRDP_ZC_ENABLED);
+        }
+
+        /* Header, payload and padding, without the part of an uncomplete TCP message already sent */
+        iov[0].pBuffer  = (const UINT8 *) &pElement->pPacket->frameHead;
+        iov[0].size     = sizeof(MD_HEADER_T);
+        iov[1].pBuffer  = pElement->pRefData;
+        iov[1].size     = pElement->dataSize;
+        iov[2].pBuffer  = cPadding;
+        iov[2].size     = pElement->grossSize - sizeof(MD_HEADER_T) - pElement->dataSize;
 
+        skip = tmpSndSize;
+        for (i = 0u; i < 3u; i++)
+        {
+            if (skip >= iov[i].size)
+            {
+                skip -= iov[i].size;
+            }
+            else
+            {
+                iov[noOfIov].pBuffer    = iov[i].pBuffer + skip;
+                iov[noOfIov].size       = iov[i].size - skip;
+                noOfIov++;
+                skip = 0u;
+            }
+        }
+
+        pElement->sendSize = pElement->grossSize - tmpSndSize;
+
+        if ((pElement->pktFlags & TRDP_FLAGS_TCP) != 0)
+        {
+            err = vos_sockSendTCPV(mdSock, iov, noOfIov, &pElement->sendSize, &zeroCopy);
+        }
+        else
+        {
+            err = vos_sockSendUDPV(mdSock, iov, noOfIov, &pElement->sendSize, pElement->addr.destIpAddr, port,
+                                   &zeroCopy);
+        }
+        pElement->sendSize += tmpSndSize;
+
+        if (zeroCopy == TRUE)
+        {
+            pElement->zcPending = TRUE;
+            pElement->zcId      = pIface->zcSent++;
+            pElement->zcSock    = mdSock;
+        }
+    }
+    else if ((pElement->pktFlags & TRDP_FLAGS_TCP) != 0)
+    {
         pElement->sendSize = pElement->grossSize - tmpSndSize;
 
         err = vos_sockSendTCP(mdSock, ((UINT8 *)&pElement->pPacket->frameHead) + tmpSndSize, &pElement->sendSize);
@@ -1021,6 +1420,10 @@ static TRDP_ERR_T  trdp_mdSendPacket (SOCKET    mdSock,
         {
             return TRDP_IO_ERR;
         }
+        else if (err == VOS_MEM_ERR)
+        {
+            return TRDP_MEM_ERR;
+        }
         else
         {
             return TRDP_BLOCK_ERR;
@@ -1396,15 +1799,16 @@ static TRDP_ERR_T trdp_mdRecvUDPPacket (TRDP_SESSION_PT appHandle, SOCKET mdSock
                 pElement->grossSize = trdp_packetSizeMD(pElement->dataSize);
             }
 
-            /*  get the complete packet */
+            /*  get the complete packet together with its arrival time */
             size    = pElement->grossSize;
-            err     = (TRDP_ERR_T) vos_sockReceiveUDP(mdSock,
-                                                      (UINT8 *)pElement->pPacket,
-                                                      &size,
-                                                      &pElement->addr.srcIpAddr,
-                                                      &pElement->replyPort,
-                                                      &pElement->addr.destIpAddr,
-                                                      FALSE);
+            err     = (TRDP_ERR_T) vos_sockReceiveUDPStamped(mdSock,
+                                                             (UINT8 *)pElement->pPacket,
+                                                             &size,
+                                                             &pElement->addr.srcIpAddr,
+                                                             &pElement->replyPort,
+                                                             &pElement->addr.destIpAddr,
+                                                             &pElement->rxTime,
+                                                             FALSE);
         }
         else
         {
@@ -1475,6 +1879,8 @@ static TRDP_ERR_T  trdp_mdRecvPacket (
             /* fatal communication issue, exit function, but collect error stats (Ticket #267)  */
             /* return err; */
         }
+        /* no kernel timestamps on the stream, the message is complete now */
+        vos_getTime(&pElement->rxTime);
         /* use the TCP statistic structure for storing  */
         /* the trdp_mdCheck result                      */
         pElementStatistics = &appHandle->stats.tcpMd;
@@ -1518,7 +1924,8 @@ static TRDP_ERR_T  trdp_mdRecvPacket (
            ;
     }
 
-    if (err != TRDP_NO_ERR)
+    /* Nothing to read is no check failure (e.g. woken up by a zero copy completion) */
+    if ((err != TRDP_NO_ERR) && (err != TRDP_BLOCK_ERR))
     {
         vos_printLog(VOS_LOG_ERROR, "trdp_mdCheck %s failed (Err: %d)\n",
                      (pElement->pktFlags & TRDP_FLAGS_TCP) ? "TCP" : "UDP", err);
@@ -1752,7 +2159,7 @@ static TRDP_ERR_T trdp_mdHandleRequest (TRDP_SESSION_PT     appHandle,
     if ( NULL != iterMD )
     {
         /* receive time */
-        vos_getTime(&iterMD->timeToGo);
+        iterMD->timeToGo = iterMD->rxTime;
 
         /* timeout value */
         if ((vos_ntohl(pH->replyTimeout) == 0) && (vos_ntohs(pH->msgType) == TRDP_MSG_MR))
@@ -2175,10 +2582,130 @@ void trdp_mdFreeSession (
         {
             vos_memFree(pMDSession->pPacket);
         }
+        if ((NULL != pMDSession->pRefData) && (NULL != pMDSession->pfRelease))
+        {
+            pMDSession->pfRelease(pMDSession->pRelRefCon, pMDSession->pRefData, pMDSession->dataSize);
+        }
         vos_memFree(pMDSession);
     }
 }
 
+/**********************************************************************************************************************/
+/** Check whether a session can be sent with a batch
+ *
+ *  @param[in]      pElement        session
+ *  @retval         TRUE            UDP session of a multi-destination notify/request ready to be sent
+ */
+static BOOL8 trdp_mdBatchable (
+    const MD_ELE_T *pElement)
+{
+    return (pElement->pfRelease == trdp_mdReleaseShared)
+           && (pElement->pRefData != NULL)
+           && ((pElement->stateEle == TRDP_ST_TX_NOTIFY_ARM) || (pElement->stateEle == TRDP_ST_TX_REQUEST_ARM))
+           && ((pElement->pktFlags & TRDP_FLAGS_TCP) == 0)
+           && (pElement->socketIdx != TRDP_INVALID_SOCKET_INDEX)
+           && !(pElement->privFlags & TRDP_REDUNDANT)
+           && (pElement->morituri == FALSE);
+}
+
+/**********************************************************************************************************************/
+/** Send the sessions of a multi-destination notify/request with one call per socket.
+ *  The prebuilt headers are sent together with the shared payload (scatter/gather), sessions which could not be sent
+ *  stay armed and are sent one by one by trdp_mdSend().
+ *
+ *  @param[in]      appHandle       session pointer
+ */
+static void trdp_mdSendBatch (
+    TRDP_SESSION_PT appHandle)
+{
+    static const UINT8  cPadding[4] = {0u, 0u, 0u, 0u};
+    MD_ELE_T            *pGroup[VOS_MAX_UDP_BATCH];
+    VOS_IOVEC_T         iov[VOS_MAX_UDP_BATCH][3];
+    VOS_UDP_MSG_T       msg[VOS_MAX_UDP_BATCH];
+    MD_ELE_T            *pFirst;
+    MD_ELE_T            *iterMD;
+    UINT32              noOfMsg;
+    UINT32              noOfSent;
+    UINT32              i;
+    VOS_ERR_T           err;
+
+    for (pFirst = appHandle->pMDSndQueue; pFirst != NULL; pFirst = pFirst->pNext)
+    {
+        if (trdp_mdBatchable(pFirst) == FALSE)
+        {
+            continue;
+        }
+
+        /* Collect the sessions sharing the payload, the socket and the state */
+        noOfMsg = 0u;
+        for (iterMD = pFirst; (iterMD != NULL) && (noOfMsg < VOS_MAX_UDP_BATCH); iterMD = iterMD->pNext)
+        {
+            if ((trdp_mdBatchable(iterMD) == TRUE)
+                && (iterMD->pRelRefCon == pFirst->pRelRefCon)
+                && (iterMD->socketIdx == pFirst->socketIdx)
+                && (iterMD->stateEle == pFirst->stateEle))
+            {
+                pGroup[noOfMsg++] = iterMD;
+            }
+        }
+        if (noOfMsg < 2u)
+        {
+            continue;
+        }
+
+        for (i = 0u; i < noOfMsg; i++)
+        {
+            iterMD = pGroup[i];
+            trdp_mdUpdatePacket(iterMD);
+
+            iov[i][0].pBuffer   = (const UINT8 *) &iterMD->pPacket->frameHead;
+            iov[i][0].size      = sizeof(MD_HEADER_T);
+            iov[i][1].pBuffer   = iterMD->pRefData;
+            iov[i][1].size      = iterMD->dataSize;
+            iov[i][2].pBuffer   = cPadding;
+            iov[i][2].size      = iterMD->grossSize - sizeof(MD_HEADER_T) - iterMD->dataSize;
+            msg[i].pIov         = iov[i];
+            msg[i].noOfIov      = (iov[i][2].size != 0u) ? 3u : 2u;
+            msg[i].ipAddress    = iterMD->addr.destIpAddr;
+            msg[i].port         = appHandle->mdDefault.udpPort;
+        }
+
+        noOfSent    = noOfMsg;
+        err         = vos_sockSendUDPBatch(appHandle->ifaceMD[pFirst->socketIdx].sock, msg, &noOfSent);
+        if (err != VOS_NO_ERR)
+        {
+            vos_printLog(VOS_LOG_WARNING, "vos_sockSendUDPBatch error (Err: %d, Socket: %d), sending one by one\n",
+                         err, (int) appHandle->ifaceMD[pFirst->socketIdx].sock);
+            break;
+        }
+
+        for (i = 0u; i < noOfSent; i++)
+        {
+            iterMD = pGroup[i];
+            iterMD->sendSize = msg[i].size;
+            /* increment transmission counter for UDP */
+            appHandle->stats.udpMd.numSend++;
+
+            if (iterMD->stateEle == TRDP_ST_TX_REQUEST_ARM)
+            {
+                /* Start the round trip time measurement and the adaptive retry timer */
+                trdp_mdArmRetry(appHandle, iterMD);
+                iterMD->stateEle = TRDP_ST_TX_REQUEST_W4REPLY;
+            }
+            else
+            {
+                iterMD->morituri = TRUE;
+                iterMD->stateEle = TRDP_ST_NONE;
+            }
+        }
+
+        if (noOfSent < noOfMsg)
+        {
+            break;
+        }
+    }
+}
+
 /**********************************************************************************************************************/
 /** Sending MD messages
  *  Send the messages stored in the sendQueue
@@ -2190,9 +2717,14 @@ TRDP_ERR_T  trdp_mdSend (
     TRDP_SESSION_PT appHandle)
 {
     TRDP_ERR_T  result      = TRDP_NO_ERR;
-    MD_ELE_T    *iterMD     = appHandle->pMDSndQueue;
+    MD_ELE_T    *iterMD;
     BOOL8       firstLoop   = TRUE;
 
+    /*  Sessions of a multi-destination notify/request go out with one call, the rest is left to the loop below */
+    trdp_mdSendBatch(appHandle);
+
+    iterMD = appHandle->pMDSndQueue;
+
     /*  Find the packet which has to be sent next:
      Note: We must also check the receive queue for pending replies! */
     do
@@ -2318,13 +2850,13 @@ TRDP_ERR_T  trdp_mdSend (
                         (iterMD->pPacket->frameHead.msgType == vos_ntohs(TRDP_MSG_MP) ||
                          iterMD->pPacket->frameHead.msgType == vos_ntohs(TRDP_MSG_MQ)))
                     {
-                        result = trdp_mdSendPacket(appHandle->ifaceMD[iterMD->socketIdx].sock,
+                        result = trdp_mdSendPacket(appHandle,
                                                    iterMD->replyPort,
                                                    iterMD);
                     }
                     else
                     {
-                        result = trdp_mdSendPacket(appHandle->ifaceMD[iterMD->socketIdx].sock,
+                        result = trdp_mdSendPacket(appHandle,
                                                    appHandle->mdDefault.udpPort,
                                                    iterMD);
                     }
@@ -2348,6 +2880,12 @@ TRDP_ERR_T  trdp_mdSend (
                             appHandle->stats.udpMd.numSend++;
                         }
 
+                        if (iterMD->stateEle == TRDP_ST_TX_REQUEST_ARM)
+                        {
+                            /* Start the round trip time measurement and the adaptive retry timer */
+                            trdp_mdArmRetry(appHandle, iterMD);
+                        }
+
                         if (nextstate == TRDP_ST_RX_REPLYQUERY_W4C)
                         {
                             /* Update timeout */
@@ -2458,6 +2996,7 @@ TRDP_ERR_T  trdp_mdSend (
     while (TRUE); /*lint !e506 */
 
     trdp_mdCloseSessions(appHandle, TRDP_INVALID_SOCKET_INDEX, VOS_INVALID_SOCKET, TRUE);
+    trdp_mdCheckZeroCopy(appHandle);
 
     return result;
 }
@@ -3189,6 +3728,13 @@ static void trdp_mdDetailSenderPacket (const TRDP_MSG_T         msgType,
             pSenderElement->grossSize = trdp_packetSizeMD(destSize);
             pSenderElement->dataSize = destSize;
         }
+        else if (trdp_mdPayloadByRef(appHandle, msgType, pSenderElement->pktFlags, pData, dataSize) == TRUE)
+        {
+            /* Sent from the caller's buffer, released when the session is freed */
+            pSenderElement->pRefData    = pData;
+            pSenderElement->pfRelease   = appHandle->pfMdRelease;
+            pSenderElement->pRelRefCon  = appHandle->pMdRelRefCon;
+        }
         else
         {
             memcpy(pSenderElement->pPacket->data, pData, dataSize);
@@ -3323,8 +3869,10 @@ TRDP_ERR_T trdp_mdReply (const TRDP_MSG_T           msgType,
                         vos_memFree(pSenderElement->pPacket);
                         pSenderElement->pPacket = NULL;
                     }
-                    /* allocate a buffer for the data   */
-                    pSenderElement->pPacket = (MD_PACKET_T *) vos_memAlloc(pSenderElement->grossSize);
+                    /* allocate a buffer for the data (header only if the payload is sent by reference) */
+                    pSenderElement->pPacket = (MD_PACKET_T *) vos_memAlloc(
+                            trdp_mdPayloadByRef(appHandle, msgType, pSenderElement->pktFlags, pData, dataSize) ?
+                            sizeof(MD_HEADER_T) : pSenderElement->grossSize);
                     if ( NULL == pSenderElement->pPacket )
                     {
                         vos_memFree(pSenderElement);
@@ -3542,8 +4090,10 @@ TRDP_ERR_T trdp_mdCall (
                 vos_memFree(pSenderElement->pPacket);
                 pSenderElement->pPacket = NULL;
             }
-            /* allocate a buffer for the data   */
-            pSenderElement->pPacket = (MD_PACKET_T *) vos_memAlloc(pSenderElement->grossSize);
+            /* allocate a buffer for the data (header only if the payload is sent by reference) */
+            pSenderElement->pPacket = (MD_PACKET_T *) vos_memAlloc(
+                    trdp_mdPayloadByRef(appHandle, msgType, pSenderElement->pktFlags, pData, dataSize) ?
+                    sizeof(MD_HEADER_T) : pSenderElement->grossSize);
             if ( NULL == pSenderElement->pPacket )
             {
                 vos_memFree(pSenderElement);
@@ -3589,6 +4139,300 @@ TRDP_ERR_T trdp_mdCall (
     return errv;    /*lint !e438 unused pSenderElement */
 }
 
+/**********************************************************************************************************************/
+/** Initiate sending MD notification/request message to several destinations - private SW level
+ *  The payload is marshalled once and shared by the sessions (one per destination), the headers are prebuilt per
+ *  destination. UDP sessions are sent with one call by trdp_mdSend().
+ *  The call is all or nothing: if a session can't be set up, none is queued.
+ *
+ *  @param[in]      msgType             TRDP_MSG_MN or TRDP_MSG_MR
+ *  @param[in]      appHandle           the handle returned by tlc_init
+ *  @param[in]      pUserRef            user supplied value returned with reply
+ *  @param[in]      pfCbFunction        Pointer to listener specific callback function, NULL to use default function
+ *  @param[out]     pSessionId          return session IDs, one per destination (may be NULL)
+ *  @param[in]      comId               comId of packet to be sent
+ *  @param[in]      etbTopoCnt          ETB topocount to use, 0 if consist local communication
+ *  @param[in]      opTrnTopoCnt        operational topocount, != 0 for orientation/direction sensitive communication
+ *  @param[in]      srcIpAddr           own IP address, 0 - srcIP will be set by the stack
+ *  @param[in]      pDestIpAddr         where to send the packet to (unicast addresses)
+ *  @param[in]      noOfDest            number of destinations
+ *  @param[in]      pktFlags            OPTION:
+ *                                      TRDP_FLAGS_DEFAULT, TRDP_FLAGS_NONE, TRDP_FLAGS_MARSHALL, TRDP_FLAGS_TCP
+ *  @param[in]      replyTimeout        timeout for reply
+ *  @param[in]      pSendParam          Pointer to send parameters, NULL to use default send parameters
+ *  @param[in]      pData               pointer to packet data / dataset
+ *  @param[in]      dataSize            size of packet data
+ *  @param[in]      srcURI              only functional group of source URI
+ *  @param[in]      destURI             only functional group of destination URI
+ *
+ *  @retval         TRDP_NO_ERR         no error
+ *  @retval         TRDP_PARAM_ERR      parameter error
+ *  @retval         TRDP_MEM_ERR        out of memory
+ */
+TRDP_ERR_T trdp_mdCallMulti (
+    const TRDP_MSG_T        msgType,
+    TRDP_APP_SESSION_T      appHandle,
+    const void              *pUserRef,
+    TRDP_MD_CALLBACK_T      pfCbFunction,
+    TRDP_UUID_T             *pSessionId,
+    UINT32                  comId,
+    UINT32                  etbTopoCnt,
+    UINT32                  opTrnTopoCnt,
+    TRDP_IP_ADDR_T          srcIpAddr,
+    const TRDP_IP_ADDR_T    *pDestIpAddr,
+    UINT32                  noOfDest,
+    TRDP_FLAGS_T            pktFlags,
+    UINT32                  replyTimeout,
+    const TRDP_SEND_PARAM_T *pSendParam,
+    const UINT8             *pData,
+    UINT32                  dataSize,
+    const TRDP_URI_USER_T   srcURI,
+    const TRDP_URI_USER_T   destURI)
+{
+    TRDP_ERR_T          errv = TRDP_NO_ERR;
+    MD_ELE_T            *pFirstElement  = NULL;
+    MD_ELE_T            *pLastElement   = NULL;
+    MD_ELE_T            *pSenderElement;
+    TRDP_MD_SHARED_T    *pShared        = NULL;
+    UINT8               *pSharedData    = NULL;
+    TRDP_DATASET_T      *pCachedDS      = NULL;
+    UINT32              timeoutWire     = 0u;
+    INT32               udpSocketIdx    = TRDP_INVALID_SOCKET_INDEX;
+    UINT32              i;
+
+    /*check for valid values within msgType*/
+    if (((msgType != TRDP_MSG_MR) && (msgType != TRDP_MSG_MN))
+        || ((pSendParam != NULL) && (pSendParam->retries > TRDP_MAX_MD_RETRIES))
+        || (pDestIpAddr == NULL) || (noOfDest == 0u))
+    {
+        return TRDP_PARAM_ERR;
+    }
+
+    /* unicast destinations only, multicast has its own fan out */
+    for (i = 0u; i < noOfDest; i++)
+    {
+        if ((pDestIpAddr[i] == 0u) || (vos_isMulticast(pDestIpAddr[i]) == TRUE))
+        {
+            return TRDP_PARAM_ERR;
+        }
+    }
+
+    pktFlags = (pktFlags == TRDP_FLAGS_DEFAULT) ? appHandle->mdDefault.flags : pktFlags;
+
+    /* lock mutex */
+    if ( vos_mutexLock(appHandle->mutex) != VOS_NO_ERR )
+    {
+        return TRDP_MUTEX_ERR;
+    }
+
+    /* set correct source IP address */
+    if ( srcIpAddr == 0u )
+    {
+        srcIpAddr = appHandle->realIP;
+    }
+
+    if ((msgType == TRDP_MSG_MR) && (replyTimeout == TRDP_MD_INFINITE_TIME))
+    {
+        timeoutWire = 0u; /* the table A.18 representation of infinity, only applicable for Mr! */
+    }
+    else
+    {
+        timeoutWire = replyTimeout;
+    }
+
+    /* Marshall (or copy) the payload once, it is shared by all sessions */
+    pShared = (TRDP_MD_SHARED_T *) vos_memAlloc(sizeof(TRDP_MD_SHARED_T) + dataSize);
+    if (pShared == NULL)
+    {
+        errv = TRDP_MEM_ERR;
+    }
+    else
+    {
+        pSharedData     = (UINT8 *) (pShared + 1);
+        pShared->size   = dataSize;
+        if ((pData != NULL) && (dataSize != 0u))
+        {
+            if (((pktFlags & TRDP_FLAGS_MARSHALL) != 0) && (appHandle->marshall.pfCbMarshall != NULL))
+            {
+                (void) appHandle->marshall.pfCbMarshall(appHandle->marshall.pRefCon,
+                                                        comId,
+                                                        (UINT8 *) pData,
+                                                        dataSize,
+                                                        pSharedData,
+                                                        &pShared->size,
+                                                        &pCachedDS);
+            }
+            else
+            {
+                memcpy(pSharedData, pData, dataSize);
+            }
+        }
+    }
+
+    for (i = 0u; (i < noOfDest) && (errv == TRDP_NO_ERR); i++)
+    {
+        /* Room for MD element */
+        pSenderElement = (MD_ELE_T *) vos_memAlloc(sizeof(MD_ELE_T));
+        if (pSenderElement == NULL)
+        {
+            errv = TRDP_MEM_ERR;
+            break;
+        }
+
+        pSenderElement->socketIdx       = TRDP_INVALID_SOCKET_INDEX;
+        pSenderElement->pktFlags        = pktFlags;
+        pSenderElement->pfCbFunction    =
+            (pfCbFunction == NULL) ? appHandle->mdDefault.pfCbFunction : pfCbFunction;
+        pSenderElement->pUserRef        = pUserRef;
+
+        /* Extension for mutual retransmission, only UDP */
+        if ((msgType == TRDP_MSG_MR) && ((pktFlags & TRDP_FLAGS_TCP) == 0))
+        {
+            pSenderElement->numRetriesMax =
+                ((pSendParam != NULL) ? pSendParam->retries : appHandle->mdDefault.sendParam.retries);
+        }
+        pSenderElement->addr.comId          = comId;
+        pSenderElement->addr.srcIpAddr      = srcIpAddr;
+        pSenderElement->addr.destIpAddr     = pDestIpAddr[i];
+        pSenderElement->addr.etbTopoCnt     = etbTopoCnt;
+        pSenderElement->addr.opTrnTopoCnt   = opTrnTopoCnt;
+        pSenderElement->privFlags           = TRDP_PRIV_NONE;
+        pSenderElement->dataSize            = pShared->size;
+        pSenderElement->grossSize           = trdp_packetSizeMD(pShared->size);
+        pSenderElement->pCachedDS           = pCachedDS;
+        pSenderElement->numExpReplies       = (msgType == TRDP_MSG_MR) ? 1u : 0u;
+
+        if ((msgType == TRDP_MSG_MR) && (replyTimeout == TRDP_MD_INFINITE_TIME))
+        {
+            pSenderElement->interval.tv_sec     = TRDP_MD_INFINITE_TIME;
+            pSenderElement->interval.tv_usec    = TRDP_MD_INFINITE_USEC_TIME;
+        }
+        else
+        {
+            pSenderElement->interval.tv_sec     = replyTimeout / 1000000u;
+            pSenderElement->interval.tv_usec    = replyTimeout % 1000000;
+        }
+        trdp_mdSetSessionTimeout(pSenderElement);
+
+        /* The payload is referenced, the packet buffer holds the header only */
+        pSenderElement->pPacket     = (MD_PACKET_T *) vos_memAlloc(sizeof(MD_HEADER_T));
+        pSenderElement->pRefData    = pSharedData;
+        pSenderElement->pfRelease   = trdp_mdReleaseShared;
+        pSenderElement->pRelRefCon  = pShared;
+        pShared->refCnt++;
+
+        /* Chain the sessions, they are queued all together */
+        if (pLastElement == NULL)
+        {
+            pFirstElement = pSenderElement;
+        }
+        else
+        {
+            pLastElement->pNext = pSenderElement;
+        }
+        pLastElement = pSenderElement;
+
+        if (pSenderElement->pPacket == NULL)
+        {
+            errv = TRDP_MEM_ERR;
+            break;
+        }
+
+        if (((pktFlags & TRDP_FLAGS_TCP) == 0) && (udpSocketIdx != TRDP_INVALID_SOCKET_INDEX))
+        {
+            /* all UDP sessions share the socket of the first one */
+            pSenderElement->socketIdx = udpSocketIdx;
+            appHandle->ifaceMD[udpSocketIdx].usage++;
+        }
+        else
+        {
+            errv = trdp_mdConnectSocket(appHandle,
+                                        (pSendParam != NULL) ? pSendParam : (&appHandle->mdDefault.sendParam),
+                                        srcIpAddr,
+                                        pDestIpAddr[i],
+                                        TRUE,
+                                        pSenderElement);
+            if (errv != TRDP_NO_ERR)
+            {
+                /* the socket is not held by the session */
+                pSenderElement->socketIdx = TRDP_INVALID_SOCKET_INDEX;
+                break;
+            }
+            if ((pktFlags & TRDP_FLAGS_TCP) == 0)
+            {
+                udpSocketIdx = pSenderElement->socketIdx;
+            }
+        }
+
+        trdp_mdFillStateElement(msgType, pSenderElement);
+        trdp_mdManageSessionId((pSessionId != NULL) ? pSessionId[i] : NULL, pSenderElement);
+
+        if (pSenderElement == pFirstElement)
+        {
+            trdp_mdDetailSenderPacket(msgType,
+                                      0,
+                                      timeoutWire, /* holds the wire values accd. table A.18 */
+                                      0, /* initial sequenceCounter is always 0 */
+                                      NULL,
+                                      0u,
+                                      FALSE,
+                                      appHandle,
+                                      (const TRDP_URI_USER_T *)srcURI,
+                                      (const TRDP_URI_USER_T *)destURI,
+                                      pSenderElement);
+        }
+        else
+        {
+            /* The header differs in the session ID only */
+            memcpy(&pSenderElement->pPacket->frameHead, &pFirstElement->pPacket->frameHead, sizeof(MD_HEADER_T));
+            if (msgType == TRDP_MSG_MR)
+            {
+                memcpy(pSenderElement->pPacket->frameHead.sessionID, pSenderElement->sessionID, TRDP_SESS_ID_SIZE);
+            }
+        }
+        trdp_mdUpdatePacket(pSenderElement);
+    }
+
+    if (errv == TRDP_NO_ERR)
+    {
+        /* Insert the sessions in the send queue */
+        while (pFirstElement != NULL)
+        {
+            pSenderElement  = pFirstElement;
+            pFirstElement   = pFirstElement->pNext;
+            pSenderElement->pNext = NULL;
+            trdp_MDqueueAppLast(&appHandle->pMDSndQueue, pSenderElement);
+        }
+    }
+    else
+    {
+        /* Error and deallocate elements (and the shared payload with the last one) ! */
+        if ((pFirstElement == NULL) && (pShared != NULL))
+        {
+            vos_memFree(pShared);
+        }
+        while (pFirstElement != NULL)
+        {
+            pSenderElement  = pFirstElement;
+            pFirstElement   = pFirstElement->pNext;
+            if (pSenderElement->socketIdx != TRDP_INVALID_SOCKET_INDEX)
+            {
+                trdp_releaseSocket(appHandle->ifaceMD, pSenderElement->socketIdx,
+                                   appHandle->mdDefault.connectTimeout, FALSE, VOS_INADDR_ANY);
+            }
+            trdp_mdFreeSession(pSenderElement);
+        }
+    }
+
+    /* Release mutex */
+    if ( vos_mutexUnlock(appHandle->mutex) != VOS_NO_ERR )
+    {
+        vos_printLogStr(VOS_LOG_ERROR, "vos_mutexUnlock() failed\n");
+    }
+
+    return errv;
+}
+
 
 /**********************************************************************************************************************/
 /** Initiate sending MD confirm message - private SW level
@@ -17,6 +17,8 @@
  /*
  * $Id$
  *
+ *      AG 2026-10-19: trdp_mdCallMulti(): notify/request to several destinations
+ *      AG 2026-10-19: trdp_mdPeerRetryTimeout(): adaptive retry timeout of an MD peer
  *     AHW 2017-11-08: Ticket #179 Max. number of retries (part of sendParam) of a MD request needs to be checked
  *      BL 2014-07-14: Ticket #46: Protocol change: operational topocount needed
  *                     Ticket #47: Protocol change: no FCS for data part of telegrams
@@ -54,6 +56,11 @@ void        trdp_mdFreeSession (
 TRDP_ERR_T  trdp_mdSend (
     TRDP_SESSION_PT appHandle);
 
+UINT32      trdp_mdPeerRetryTimeout (
+    TRDP_SESSION_PT         appHandle,
+    const TRDP_MD_PEER_T    *pPeer,
+    UINT32                  maxTimeout);
+
 void        trdp_mdCheckPending (
     TRDP_APP_SESSION_T  appHandle,
     TRDP_FDS_T          *pFileDesc,
@@ -124,4 +131,23 @@ TRDP_ERR_T trdp_mdCall (const TRDP_MSG_T        msgType,
                         UINT32                  dataSize,
                         const TRDP_URI_USER_T   srcURI,
                         const TRDP_URI_USER_T   destURI);
+
+TRDP_ERR_T trdp_mdCallMulti (const TRDP_MSG_T        msgType,
+                             TRDP_APP_SESSION_T      appHandle,
+                             const void              *pUserRef,
+                             TRDP_MD_CALLBACK_T      pfCbFunction,
+                             TRDP_UUID_T             *pSessionId,
+                             UINT32                  comId,
+                             UINT32                  etbTopoCnt,
+                             UINT32                  opTrnTopoCnt,
+                             TRDP_IP_ADDR_T          srcIpAddr,
+                             const TRDP_IP_ADDR_T    *pDestIpAddr,
+                             UINT32                  noOfDest,
+                             TRDP_FLAGS_T            pktFlags,
+                             UINT32                  replyTimeout,
+                             const TRDP_SEND_PARAM_T *pSendParam,
+                             const UINT8             *pData,
+                             UINT32                  dataSize,
+                             const TRDP_URI_USER_T   srcURI,
+                             const TRDP_URI_USER_T   destURI);
 #endif
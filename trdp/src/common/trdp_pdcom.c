@@ -17,6 +17,23 @@
 /*
 * $Id$
 *
+*      AG 2026-10-19: TX timestamps keyed by the id handed to the kernel, lost stamps counted per publisher
+*      AG 2026-10-19: Batch entries follow the frame swap of packets received later in the same pass
+*      AG 2026-10-19: Redundancy groups count their members, PD requests join them
+*      AG 2026-10-19: Unsubscribing from the batch callback clears the subscription's entry
+*      AG 2026-10-19: Callback execution time only recorded if the callback did not unsubscribe
+*      AG 2026-10-19: Busy polling receive: spin on the PD sockets before blocking, SO_BUSY_POLL
+*      AG 2026-10-19: io_uring for PD: multishot receive, one system call per send cycle (URING_SUPPORT)
+*      AG 2026-10-19: AF_XDP socket for PD: receive in place from UMEM, send via TX ring (XDP_SUPPORT)
+*      AG 2026-10-19: Redundancy groups, followers only keep their sequence counters running (hot standby)
+*      AG 2026-10-19: Field level change detection and deadband for PD callbacks
+*      AG 2026-10-19: Batch callback at the end of a receive pass (tlp_setBatchCallback)
+*      AG 2026-10-19: Deferred callback delivery by a pool of callback threads (tlp_enableCallbackPool)
+*      AG 2026-10-19: Kernel receive timestamps for timeout supervision and TRDP_PD_INFO_T.rxTime
+*      AG 2026-10-19: trdp_pdUpdateComIdFilter(): in-kernel comId filter from the subscriptions
+*      AG 2026-10-19: Record timing histograms on reception, sending and callbacks
+*      AG 2026-10-19: Send at due time if TX timestamps show that launch times are not honoured
+*      AG 2026-10-19: Launch time scheduling and TX timestamps for standard PD (TRDP_SEND_PARAM_T.txTime)
 *      BL 2019-10-18: Ticket #287 Enhancement performance while receiving (HIGH_PERF_INDEXED mode)
 *      BL 2019-10-10: Ticket #283 Automatic PD sequence counter reset after timeout
 *      BL 2019-08-27: Changed send failure from ERROR to WARNING to DBG
@@ -96,6 +113,18 @@
 #define UINT32_MAX  4294967295U
 #endif
 
+/* The callback pool needs atomic operations */
+#if defined(__GNUC__) || defined(__clang__)
+#define TRDP_PD_CB_POOL_SUPPORT 1
+#endif
+
+#define TRDP_PD_CB_CANCELLED    0x80000000u     /**< slot state: subscription is gone, free the slot        */
+#define TRDP_PD_CB_FRESH        0x04u           /**< middle buffer holds a sample not yet delivered         */
+#define TRDP_PD_CB_INDEX        0x03u           /**< buffer index part of the middle buffer                 */
+
+#define TRDP_PD_BATCH_MIN_SIZE  16u             /**< initial number of batch entries                        */
+#define TRDP_PD_CMP_BLOCK       32u             /**< bytes compared at once by the change detection         */
+
 /*******************************************************************************
  * TYPEDEFS
  */
@@ -105,1394 +134,3529 @@
  *   GLOBALS
  */
 
+/******************************************************************************
+ *   LOCAL FUNCTIONS
+ */
+
+#ifdef TRDP_PD_CB_POOL_SUPPORT
 /******************************************************************************/
-/** Initialize/construct the packet
- *  Set the header infos
+/** Queue a subscription for callback delivery (lock-free, bounded, several producers and consumers)
  *
- *  @param[in]      pPacket         pointer to the packet element to init
- *  @param[in]      type            type the packet
- *  @param[in]      etbTopoCnt      topocount to use for PD frame
- *  @param[in]      opTrnTopoCnt    topocount to use for PD frame
- *  @param[in]      replyComId      Pull request comId
- *  @param[in]      replyIpAddress  Pull request Ip
- *  @param[in]      serviceId       Service Id
+ *  @param[in]      pPool               the callback pool
+ *  @param[in]      pSlot               deferred delivery of the subscription
+ *
+ *  @retval         TRUE                queued
+ *  @retval         FALSE               queue full
  */
-void    trdp_pdInit (
-    PD_ELE_T    *pPacket,
-    TRDP_MSG_T  type,
-    UINT32      etbTopoCnt,
-    UINT32      opTrnTopoCnt,
-    UINT32      replyComId,
-    UINT32      replyIpAddress,
-    UINT32      serviceId)
+static BOOL8 trdp_pdCbEnqueue (
+    TRDP_PD_CB_POOL_T   *pPool,
+    TRDP_PD_CB_SLOT_T   *pSlot)
 {
-    if (pPacket == NULL || pPacket->pFrame == NULL)
-    {
-        return;
-    }
-#ifdef TSN_SUPPORT
-    /* If TSN is set, use the smaller header */
-    if (pPacket->privFlags & TRDP_IS_TSN)
+    TRDP_PD_CB_ENTRY_T  *pEntry;
+    UINT32              pos = __atomic_load_n(&pPool->head, __ATOMIC_RELAXED);
+    INT32               diff;
+
+    for (;;)
     {
-        PD2_HEADER_T *pFrameHead = (PD2_HEADER_T *) &pPacket->pFrame->frameHead;
-        pFrameHead->sequenceCounter = 0u;
-        pFrameHead->protocolVersion = TRDP_VER_TSN_PROTO;
-        pFrameHead->msgType         = (UINT8) (type & 0xFF);
-        pFrameHead->comId           = vos_htonl(pPacket->addr.comId);
-        pFrameHead->datasetLength   = vos_htons((UINT16) pPacket->dataSize);
-        pFrameHead->reserved        = vos_htonl(serviceId);
-    }
-    else
-#endif
-    {   /* This is the standard header */
-        pPacket->pFrame->frameHead.protocolVersion  = vos_htons(TRDP_PROTO_VER);
-        pPacket->pFrame->frameHead.etbTopoCnt       = vos_htonl(etbTopoCnt);
-        pPacket->pFrame->frameHead.opTrnTopoCnt     = vos_htonl(opTrnTopoCnt);
-        pPacket->pFrame->frameHead.comId            = vos_htonl(pPacket->addr.comId);
-        pPacket->pFrame->frameHead.msgType          = vos_htons((UINT16)type);
-        pPacket->pFrame->frameHead.datasetLength    = vos_htonl(pPacket->dataSize);
-        pPacket->pFrame->frameHead.reserved         = vos_htonl(serviceId);
-        pPacket->pFrame->frameHead.replyComId       = vos_htonl(replyComId);
-        pPacket->pFrame->frameHead.replyIpAddress   = vos_htonl(replyIpAddress);
+        pEntry  = &pPool->queue[pos & (TRDP_PD_CB_QUEUE_SIZE - 1u)];
+        diff    = (INT32) (__atomic_load_n(&pEntry->seq, __ATOMIC_ACQUIRE) - pos);
+        if (diff == 0)
+        {
+            if (__atomic_compare_exchange_n(&pPool->head, &pos, pos + 1u, TRUE,
+                                            __ATOMIC_RELAXED, __ATOMIC_RELAXED))
+            {
+                break;
+            }
+        }
+        else if (diff < 0)
+        {
+            return FALSE;
+        }
+        else
+        {
+            pos = __atomic_load_n(&pPool->head, __ATOMIC_RELAXED);
+        }
     }
+    pEntry->pSlot = pSlot;
+    __atomic_store_n(&pEntry->seq, pos + 1u, __ATOMIC_RELEASE);
+    return TRUE;
 }
 
 /******************************************************************************/
-/** Copy data
- *  Update the data to be sent
+/** Take the next subscription to deliver from the callback queue
  *
- *  @param[in]      pPacket         pointer to the packet element to send
- *  @param[in]      marshall        pointer to marshalling function
- *  @param[in]      refCon          reference for marshalling function
- *  @param[in]      pData           pointer to data
- *  @param[in]      dataSize        size of data
+ *  @param[in]      pPool               the callback pool
  *
- *  @retval         TRDP_NO_ERR     no error
- *                                  other errors
+ *  @retval         deferred delivery of the subscription or NULL if the queue is empty
  */
-TRDP_ERR_T trdp_pdPut (
-    PD_ELE_T        *pPacket,
-    TRDP_MARSHALL_T marshall,
-    void            *refCon,
-    const UINT8     *pData,
-    UINT32          dataSize)
+static TRDP_PD_CB_SLOT_T *trdp_pdCbDequeue (
+    TRDP_PD_CB_POOL_T *pPool)
 {
-    TRDP_ERR_T ret = TRDP_NO_ERR;
-
-    if (pPacket == NULL)
-    {
-        return TRDP_PARAM_ERR;
-    }
-
-    /* Ticket #104: There is no data!
-        Start sending by validating the packet */
-    if ((pPacket->dataSize == 0u) && (dataSize == 0u))
-    {
-        /* set data valid */
-        pPacket->privFlags = (TRDP_PRIV_FLAGS_T) (pPacket->privFlags & ~(TRDP_PRIV_FLAGS_T)TRDP_INVALID_DATA);
+    TRDP_PD_CB_ENTRY_T  *pEntry;
+    TRDP_PD_CB_SLOT_T   *pSlot;
+    UINT32              pos = __atomic_load_n(&pPool->tail, __ATOMIC_RELAXED);
+    INT32               diff;
 
-        /*  Update some statistics  */
-        pPacket->updPkts++;
-    }
-    else if ((pData != NULL) && (dataSize != 0u))
+    for (;;)
     {
-        if (pPacket->dataSize == 0u)
+        pEntry  = &pPool->queue[pos & (TRDP_PD_CB_QUEUE_SIZE - 1u)];
+        diff    = (INT32) (__atomic_load_n(&pEntry->seq, __ATOMIC_ACQUIRE) - (pos + 1u));
+        if (diff == 0)
         {
-            /* late data, enlarge packet buffer and copy existing header info */
-            PD_PACKET_T *pTemp;
-
-            pPacket->dataSize   = dataSize;
-            pPacket->grossSize  = trdp_packetSizePD(dataSize);
-            pTemp = (PD_PACKET_T *) vos_memAlloc(pPacket->grossSize);
-            if (pTemp == NULL)
+            if (__atomic_compare_exchange_n(&pPool->tail, &pos, pos + 1u, TRUE,
+                                            __ATOMIC_RELAXED, __ATOMIC_RELAXED))
             {
-                return TRDP_MEM_ERR;
+                break;
             }
-            /* copy existing header info */
-            memcpy(pTemp, pPacket->pFrame, trdp_packetSizePD(0u));
-            vos_memFree(pPacket->pFrame);
-            pPacket->pFrame = pTemp;
-            /* complete header info, set dataset length */
-            pPacket->pFrame->frameHead.datasetLength = vos_htonl(pPacket->dataSize);
         }
-
-        if (!(pPacket->pktFlags & TRDP_FLAGS_MARSHALL) || (marshall == NULL))
+        else if (diff < 0)
         {
-
-            /* We must check the packet size! */
-            if ((dataSize > TRDP_MAX_PD_DATA_SIZE) ||
-                ((pPacket->dataSize != 0u) && (dataSize != pPacket->dataSize)))   /* Ticket #207: datasize differs */
-            {
-                return TRDP_PARAM_ERR;
-            }
-            memcpy(pPacket->pFrame->data, pData, dataSize);
+            return NULL;
         }
         else
         {
-            ret = marshall(refCon,
-                           pPacket->addr.comId,
-                           (UINT8 *) pData,
-                           dataSize,
-                           pPacket->pFrame->data,
-                           &dataSize,
-                           &pPacket->pCachedDS);
-            /* We must set and check a possible smaller packet size! (Ticket #132) */
-            if (dataSize > TRDP_MAX_PD_DATA_SIZE)
-            {
-                return TRDP_PARAM_ERR;
-            }
-            pPacket->dataSize   = dataSize;
-            pPacket->grossSize  = trdp_packetSizePD(dataSize);
-            pPacket->pFrame->frameHead.datasetLength = vos_htonl(pPacket->dataSize);
+            pos = __atomic_load_n(&pPool->tail, __ATOMIC_RELAXED);
         }
+    }
+    pSlot = pEntry->pSlot;
+    __atomic_store_n(&pEntry->seq, pos + TRDP_PD_CB_QUEUE_SIZE, __ATOMIC_RELEASE);
+    return pSlot;
+}
 
-        if (TRDP_NO_ERR == ret)
-        {
-            /* set data valid */
-            pPacket->privFlags = (TRDP_PRIV_FLAGS_T) (pPacket->privFlags & ~(TRDP_PRIV_FLAGS_T)TRDP_INVALID_DATA);
+/******************************************************************************/
+/** Callback thread: deliver the newest sample of each queued subscription
+ *  A subscription belongs to the thread which dequeued it until its post count is reset to zero or it is queued again,
+ *  so callbacks of one subscription are never executed concurrently and never out of order. A subscription posted
+ *  again during its callback is queued again, so a slow callback does not starve the other subscriptions.
+ *
+ *  @param[in]      pArg                the callback pool
+ */
+static void trdp_pdCbThread (
+    void *pArg)
+{
+    TRDP_PD_CB_POOL_T   *pPool      = (TRDP_PD_CB_POOL_T *) pArg;
+    TRDP_SESSION_PT     appHandle   = pPool->pSession;
+    TRDP_PD_CB_SLOT_T   *pSlot;
+    TRDP_PD_CB_SAMPLE_T *pSample;
+    UINT32              state;
 
-            /*  Update some statistics  */
-            pPacket->updPkts++;
+    while (__atomic_load_n(&pPool->stop, __ATOMIC_ACQUIRE) == FALSE)
+    {
+        if ((vos_semaTake(pPool->sema, VOS_SEMA_WAIT_FOREVER) != VOS_NO_ERR) ||
+            (__atomic_load_n(&pPool->stop, __ATOMIC_ACQUIRE) == TRUE))
+        {
+            continue;
+        }
+        pSlot = trdp_pdCbDequeue(pPool);
+        if (pSlot == NULL)
+        {
+            continue;
+        }
+        state = __atomic_load_n(&pSlot->state, __ATOMIC_ACQUIRE);
+        for (;;)
+        {
+            if ((state & TRDP_PD_CB_CANCELLED) != 0u)
+            {
+                /*  Unsubscribed meanwhile, we are the last user   */
+                vos_memFree(pSlot);
+                break;
+            }
+            if ((__atomic_load_n(&pSlot->middle, __ATOMIC_ACQUIRE) & TRDP_PD_CB_FRESH) != 0u)
+            {
+                pSlot->front = (UINT8) (__atomic_exchange_n(&pSlot->middle, pSlot->front, __ATOMIC_ACQ_REL)
+                                        & TRDP_PD_CB_INDEX);
+                pSample = &pSlot->sample[pSlot->front];
+                pSlot->pfCbFunction(appHandle->pdDefault.pRefCon,
+                                    appHandle,
+                                    &pSample->info,
+                                    (pSample->noData == TRUE) ? NULL : pSample->data,
+                                    pSample->dataSize);
+            }
+            /*  Done, unless the receiver posted again while we were busy (state is reloaded then)  */
+            if (__atomic_compare_exchange_n(&pSlot->state, &state, 0u, FALSE, __ATOMIC_ACQ_REL, __ATOMIC_ACQUIRE))
+            {
+                break;
+            }
+            /*  Queue it again behind the other subscriptions, it stays ours until dequeued   */
+            if (((state & TRDP_PD_CB_CANCELLED) == 0u) &&
+                __atomic_compare_exchange_n(&pSlot->state, &state, 1u, FALSE, __ATOMIC_ACQ_REL, __ATOMIC_ACQUIRE) &&
+                (trdp_pdCbEnqueue(pPool, pSlot) == TRUE))
+            {
+                vos_semaGive(pPool->sema);
+                break;
+            }
         }
     }
-
-    return ret;
+    (void) __atomic_sub_fetch(&pPool->running, 1u, __ATOMIC_RELEASE);
 }
+#endif
 
-#ifdef TSN_SUPPORT
 /******************************************************************************/
-/** Send TSN PD message immediately
+/** Get the size of a numeric data type
  *
- *  @param[in]      appHandle           session pointer
- *  @param[in]      pSendPD             pointer to element to be sent
- *  @param[in]      pTxTime             time to send
+ *  @param[in]      type                data type (TRDP_DATA_TYPE_T)
  *
- *  @retval         TRDP_NO_ERR         no error
- *  @retval         TRDP_IO_ERR         socket I/O error
+ *  @retval         size in bytes, 0 if the type is not numeric
  */
-TRDP_ERR_T  trdp_pdSendImmediateTSN (
-    TRDP_SESSION_PT appHandle,
-    PD_ELE_T        *pSendPD,
-    VOS_TIMEVAL_T   *pTxTime)
+static UINT32 trdp_pdNumericSize (
+    UINT32 type)
 {
-    VOS_ERR_T       err;
-    PD2_PACKET_T    *pFrame = (PD2_PACKET_T *) pSendPD->pFrame;
-
-    /*  Update the sequence counter and re-compute CRC    */
-    trdp_pdUpdate(pSendPD);
-
-    /* We pass the error to the application, but we keep on going    */
-    pSendPD->sendSize = pSendPD->grossSize;
-
-    err = vos_sockSendTSN(appHandle->ifacePD[pSendPD->socketIdx].sock,
-                          (UINT8 *)&pFrame->frameHead,
-                          &pSendPD->sendSize,
-                          pSendPD->addr.srcIpAddr,
-                          pSendPD->addr.destIpAddr,
-                          appHandle->pdDefault.port,
-                          pTxTime);
-
-    if (err == VOS_NO_ERR)
+    switch (type)
     {
-        appHandle->stats.pd.numSend++;
-        pSendPD->numRxTx++;
+        case TRDP_INT8:
+        case TRDP_UINT8:
+            return 1u;
+        case TRDP_INT16:
+        case TRDP_UINT16:
+            return 2u;
+        case TRDP_INT32:
+        case TRDP_UINT32:
+        case TRDP_REAL32:
+            return 4u;
+        case TRDP_INT64:
+        case TRDP_UINT64:
+        case TRDP_REAL64:
+            return 8u;
+        default:
+            return 0u;
     }
-    return (TRDP_ERR_T) err;
 }
-#endif
 
 /******************************************************************************/
-/** Send PD message immediately
+/** Get the value of a numeric item in network byte order
  *
- *  @param[in]      appHandle           session pointer
- *  @param[in]      pSendPD             pointer to element to be sent
+ *  @param[in]      pSrc                the marshalled item
+ *  @param[in]      type                its numeric data type
  *
- *  @retval         TRDP_NO_ERR         no error
- *  @retval         TRDP_IO_ERR         socket I/O error
+ *  @retval         the value
  */
-TRDP_ERR_T  trdp_pdSendImmediate (
-    TRDP_SESSION_PT appHandle,
-    PD_ELE_T        *pSendPD)
+static REAL64 trdp_pdNumericValue (
+    const UINT8 *pSrc,
+    UINT32      type)
 {
-    TRDP_ERR_T  err;
-    PD_PACKET_T *pFrame = (PD_PACKET_T *) pSendPD->pFrame;
-
-    /*  Update the sequence counter and re-compute CRC    */
-    trdp_pdUpdate(pSendPD);
-
-    /* Publisher check from Table A.5:
-     Actual topography counter values <-> Locally stored with publish */
-    if ( !trdp_validTopoCounters(appHandle->etbTopoCnt,
-                                 appHandle->opTrnTopoCnt,
-                                 vos_ntohl(pSendPD->pFrame->frameHead.etbTopoCnt),
-                                 vos_ntohl(pSendPD->pFrame->frameHead.opTrnTopoCnt)))
+    UINT64  raw     = 0u;
+    UINT32  size    = trdp_pdNumericSize(type);
+    UINT32  i;
+    REAL32  real32;
+    REAL64  real64;
+    UINT32  raw32;
+
+    for (i = 0u; i < size; i++)
     {
-        err = TRDP_TOPO_ERR;
-        vos_printLogStr(VOS_LOG_WARNING, "Sending PD: TopoCount is out of date!\n");
-        /* We pass the error to the application, and do not send!    */
+        raw = (raw << 8u) | pSrc[i];
     }
-    else
+    switch (type)
     {
-
-        pSendPD->sendSize = pSendPD->grossSize;
-
-        err = (TRDP_ERR_T) vos_sockSendUDP(appHandle->ifacePD[pSendPD->socketIdx].sock,
-                                           (UINT8 *)&pFrame->frameHead,
-                                           &pSendPD->sendSize,
-                                           pSendPD->addr.destIpAddr,
-                                           appHandle->pdDefault.port);
-
-        if (err == TRDP_NO_ERR)
-        {
-            appHandle->stats.pd.numSend++;
-            pSendPD->numRxTx++;
-        }
+        case TRDP_INT8:
+            return (REAL64) (INT8) raw;
+        case TRDP_INT16:
+            return (REAL64) (INT16) raw;
+        case TRDP_INT32:
+            return (REAL64) (INT32) raw;
+        case TRDP_INT64:
+            return (REAL64) (INT64) raw;
+        case TRDP_REAL32:
+            raw32 = (UINT32) raw;
+            memcpy(&real32, &raw32, sizeof(real32));
+            return (REAL64) real32;
+        case TRDP_REAL64:
+            memcpy(&real64, &raw, sizeof(real64));
+            return real64;
+        default:
+            return (REAL64) raw;
     }
+}
 
-    return err;
+/******************************************************************************/
+/** Get the end of a field of a change filter
+ *
+ *  @param[in]      pField              the field
+ *  @param[in]      dataSize            size of the received data
+ *
+ *  @retval         offset behind the field, at most dataSize
+ */
+static INLINE UINT32 trdp_pdFieldEnd (
+    const TRDP_PD_FIELD_T   *pField,
+    UINT32                  dataSize)
+{
+    if ((pField->size == 0u) || (pField->offset + pField->size > dataSize))
+    {
+        return dataSize;
+    }
+    return pField->offset + pField->size;
 }
+
 /******************************************************************************/
-/** Copy data
- *  Set the header infos
+/** Compare a block of TRDP_PD_CMP_BLOCK bytes.
+ *  The block is loaded as words and the differences are or-ed without branching, which compilers turn into
+ *  vector instructions where available.
+ *
+ *  @param[in]      pNew                new data
+ *  @param[in]      pOld                old data
+ *
+ *  @retval         TRUE                the blocks differ
  */
-TRDP_ERR_T trdp_pdGet (
-    PD_ELE_T            *pPacket,
-    TRDP_UNMARSHALL_T   unmarshall,
-    void                *refCon,
-    const UINT8         *pData,
-    UINT32              *pDataSize)
+static INLINE BOOL8 trdp_pdBlockDiffers (
+    const UINT8 *pNew,
+    const UINT8 *pOld)
 {
-    if (pPacket == NULL)
+    UINT64  newWords[TRDP_PD_CMP_BLOCK / sizeof(UINT64)];
+    UINT64  oldWords[TRDP_PD_CMP_BLOCK / sizeof(UINT64)];
+    UINT64  diff = 0u;
+    UINT32  i;
+
+    memcpy(newWords, pNew, TRDP_PD_CMP_BLOCK);
+    memcpy(oldWords, pOld, TRDP_PD_CMP_BLOCK);
+    for (i = 0u; i < TRDP_PD_CMP_BLOCK / sizeof(UINT64); i++)
     {
-        return TRDP_PARAM_ERR;
+        diff |= newWords[i] ^ oldWords[i];
     }
+    return (diff != 0u) ? TRUE : FALSE;
+}
 
-    /*  Update some statistics  */
-    pPacket->getPkts++;
+/******************************************************************************/
+/** Determine the fields of a change filter which differ between the old and the new data.
+ *  The data is compared block-wise; only within a differing block the changed fields are located. A field found
+ *  changed is not compared any further.
+ *
+ *  @param[in]      pFilter             change filter of the subscription
+ *  @param[in]      pNew                received data
+ *  @param[in]      pOld                previously received data
+ *  @param[in]      dataSize            size of the received data
+ *
+ *  @retval         bit n set: field n changed
+ */
+static UINT64 trdp_pdChangeMask (
+    const TRDP_PD_FILTER_T  *pFilter,
+    const UINT8             *pNew,
+    const UINT8             *pOld,
+    UINT32                  dataSize)
+{
+    UINT64  mask    = 0u;
+    UINT32  field   = 0u;
+    UINT32  pos     = 0u;
+    UINT32  end;
+    UINT32  i;
 
-    if ((pPacket->privFlags & TRDP_INVALID_DATA) != 0)
+    while ((pos < dataSize) && (field < pFilter->noOfFields))
     {
-        return TRDP_NODATA_ERR;
+        end = pos + TRDP_PD_CMP_BLOCK;
+        if (end > dataSize)
+        {
+            end = dataSize;
+        }
+        if (((end - pos == TRDP_PD_CMP_BLOCK) && (trdp_pdBlockDiffers(&pNew[pos], &pOld[pos]) == TRUE)) ||
+            ((end - pos < TRDP_PD_CMP_BLOCK) && (memcmp(&pNew[pos], &pOld[pos], end - pos) != 0)))
+        {
+            /*  Locate the changed fields within the block  */
+            for (i = pos; (i < end) && (field < pFilter->noOfFields); i++)
+            {
+                if (pNew[i] == pOld[i])
+                {
+                    continue;
+                }
+                while ((field < pFilter->noOfFields) &&
+                       (i >= trdp_pdFieldEnd(&pFilter->field[field], dataSize)))
+                {
+                    field++;
+                }
+                if ((field < pFilter->noOfFields) && (i >= pFilter->field[field].offset))
+                {
+                    mask    |= (UINT64) 1u << field;
+                    i       = trdp_pdFieldEnd(&pFilter->field[field], dataSize) - 1u;
+                    field++;
+                }
+            }
+            if (i > end)
+            {
+                end = i;        /*  skip the rest of the changed field  */
+            }
+        }
+        pos = end;
     }
+    return mask;
+}
 
-    if ((pPacket->privFlags & TRDP_TIMED_OUT) != 0)
+/******************************************************************************/
+/** Decide whether a change is reported to the subscriber.
+ *  Only changes of the selected fields count, numeric fields with a deadband must have moved beyond it since the
+ *  last callback.
+ *
+ *  @param[in]      pFilter             change filter of the subscription
+ *  @param[in]      pData               received data
+ *  @param[in]      dataSize            size of the received data
+ *  @param[in,out]  pChangeMask         changed fields, all fields if nothing was reported before
+ *
+ *  @retval         TRUE                call back
+ */
+static BOOL8 trdp_pdFilterChanges (
+    const TRDP_PD_FILTER_T  *pFilter,
+    const UINT8             *pData,
+    UINT32                  dataSize,
+    UINT64                  *pChangeMask)
+{
+    UINT64  relevant;
+    UINT32  i;
+    REAL64  delta;
+
+    if (pFilter->reported == FALSE)
     {
-        return TRDP_TIMEOUT_ERR;
+        *pChangeMask = (pFilter->noOfFields < 64u) ?
+                       (((UINT64) 1u << pFilter->noOfFields) - 1u) : TRDP_PD_ALL_FIELDS;
+        return TRUE;
     }
 
-    if ((pData != NULL) && (pDataSize != NULL))
+    relevant = *pChangeMask & pFilter->fieldMask;
+    for (i = 0u; (i < pFilter->noOfFields) && (relevant != 0u); i++)
     {
-        if ( !(pPacket->pktFlags & TRDP_FLAGS_MARSHALL) || (unmarshall == NULL))
+        if (((relevant & ((UINT64) 1u << i)) != 0u) &&
+            (pFilter->field[i].deadband > 0.0) &&
+            (pFilter->field[i].offset + trdp_pdNumericSize(pFilter->field[i].type) <= dataSize))
         {
-            if (*pDataSize >= pPacket->dataSize)
-            {
-                *pDataSize = pPacket->dataSize;
-                memcpy((void *)pData, pPacket->pFrame->data, *pDataSize);
-                return TRDP_NO_ERR;
-            }
-            else
+            delta = trdp_pdNumericValue(&pData[pFilter->field[i].offset], pFilter->field[i].type) -
+                pFilter->lastValue[i];
+            if ((delta <= pFilter->field[i].deadband) && (delta >= -pFilter->field[i].deadband))
             {
-                return TRDP_PARAM_ERR;
+                relevant &= ~((UINT64) 1u << i);
             }
         }
-        else
+    }
+    return (relevant != 0u) ? TRUE : FALSE;
+}
+
+/******************************************************************************/
+/** Remember the values of the deadband fields passed to a callback
+ *
+ *  @param[in]      pFilter             change filter of the subscription
+ *  @param[in]      pData               received data
+ *  @param[in]      dataSize            size of the received data
+ */
+static void trdp_pdFilterReported (
+    TRDP_PD_FILTER_T    *pFilter,
+    const UINT8         *pData,
+    UINT32              dataSize)
+{
+    UINT32 i;
+
+    for (i = 0u; i < pFilter->noOfFields; i++)
+    {
+        if ((pFilter->field[i].deadband > 0.0) &&
+            (pFilter->field[i].offset + trdp_pdNumericSize(pFilter->field[i].type) <= dataSize))
         {
-            return unmarshall(refCon,
-                              pPacket->addr.comId,
-                              pPacket->pFrame->data,
-                              vos_ntohl(pPacket->pFrame->frameHead.datasetLength),
-                              (UINT8 *)pData,
-                              pDataSize,
-                              &pPacket->pCachedDS);
+            pFilter->lastValue[i] = trdp_pdNumericValue(&pData[pFilter->field[i].offset], pFilter->field[i].type);
         }
     }
-    return TRDP_NO_ERR;
+    pFilter->reported = TRUE;
 }
 
 /******************************************************************************/
-/** Send a due PD message
+/** Add a telegram to the batch of the current receive pass.
+ *  A telegram already in the batch is updated, so each telegram is reported once with its newest state.
+ *  Must be called with mutexRxPD held.
  *
  *  @param[in]      appHandle           session pointer
- *  @param[in]      ppElement           pointer to pointer of the element to send
+ *  @param[in]      pElement            subscription
+ *  @param[in]      pInfo               message info
+ *  @param[in]      pData               received data or NULL
+ *  @param[in]      dataSize            size of the data
  *
- *  @retval         TRDP_NO_ERR         no error
- *  @retval         TRDP_IO_ERR         socket I/O error
+ *  @retval         TRUE                added
+ *  @retval         FALSE               out of memory, call back directly
  */
-TRDP_ERR_T  trdp_pdSendElement (
-    TRDP_SESSION_PT appHandle,
-    PD_ELE_T        * *ppElement)
+static BOOL8 trdp_pdBatchAdd (
+    TRDP_SESSION_PT         appHandle,
+    PD_ELE_T                *pElement,
+    const TRDP_PD_INFO_T    *pInfo,
+    UINT8                   *pData,
+    UINT32                  dataSize)
 {
-    TRDP_ERR_T  err     = TRDP_NO_ERR;
-    PD_ELE_T    *iterPD = *ppElement;
+    TRDP_PD_BATCH_ENTRY_T   *pEntry;
+    UINT64                  changeMask = 0u;
 
-    /* send only if there is valid data */
-    if (!(iterPD->privFlags & TRDP_INVALID_DATA))
+    if (pElement->batchPos == 0u)
     {
-        if ((iterPD->privFlags & TRDP_REQ_2B_SENT) &&
-            (iterPD->pFrame->frameHead.msgType == vos_htons(TRDP_MSG_PD)))       /*  PULL packet?  */
-        {
-            iterPD->pFrame->frameHead.msgType = vos_htons(TRDP_MSG_PP);
-        }
-        /*  Update the sequence counter and re-compute CRC    */
-        trdp_pdUpdate(iterPD);
-
-        /* Publisher check from Table A.5:
-         Actual topography counter values <-> Locally stored with publish */
-        if ( !trdp_validTopoCounters( appHandle->etbTopoCnt,
-                                      appHandle->opTrnTopoCnt,
-                                      vos_ntohl(iterPD->pFrame->frameHead.etbTopoCnt),
-                                      vos_ntohl(iterPD->pFrame->frameHead.opTrnTopoCnt)))
-        {
-            err = TRDP_TOPO_ERR;
-            vos_printLogStr(VOS_LOG_INFO, "Sending PD: TopoCount is out of date!\n");
-        }
-        /*    In case we're sending on an uninitialized publisher; should never happen. */
-        else if (iterPD->socketIdx == TRDP_INVALID_SOCKET_INDEX)
-        {
-            vos_printLogStr(VOS_LOG_ERROR, "Sending PD: Socket invalid!\n");
-            /* Try to send the other packets */
-        }
-        /*    Send the packet if it is not redundant    */
-        else if (!(iterPD->privFlags & TRDP_REDUNDANT))
+        if (appHandle->noOfBatch >= appHandle->batchSize)
         {
-            TRDP_ERR_T result;
-            if (iterPD->pfCbFunction != NULL)
-            {
-                TRDP_PD_INFO_T theMessage;
-                theMessage.comId        = iterPD->addr.comId;
-                theMessage.srcIpAddr    = iterPD->addr.srcIpAddr;
-                theMessage.destIpAddr   = iterPD->addr.destIpAddr;
-                theMessage.etbTopoCnt   = vos_ntohl(iterPD->pFrame->frameHead.etbTopoCnt);
-                theMessage.opTrnTopoCnt = vos_ntohl(iterPD->pFrame->frameHead.opTrnTopoCnt);
-                theMessage.msgType      = (TRDP_MSG_T) vos_ntohs(iterPD->pFrame->frameHead.msgType);
-                theMessage.seqCount     = iterPD->curSeqCnt;
-                theMessage.protVersion  = vos_ntohs(iterPD->pFrame->frameHead.protocolVersion);
-                theMessage.replyComId   = vos_ntohl(iterPD->pFrame->frameHead.replyComId);
-                theMessage.replyIpAddr  = vos_ntohl(iterPD->pFrame->frameHead.replyIpAddress);
-                theMessage.pUserRef     = iterPD->pUserRef; /* User reference given with the local subscribe? */
-                theMessage.resultCode   = err;
-
-                iterPD->pfCbFunction(appHandle->pdDefault.pRefCon,
-                                     appHandle,
-                                     &theMessage,
-                                     iterPD->pFrame->data,
-                                     vos_ntohl(iterPD->pFrame->frameHead.datasetLength));
-            }
-            /* We pass the error to the application, but we keep on going    */
-            result = trdp_pdSend(appHandle->ifacePD[iterPD->socketIdx].sock, iterPD, appHandle->pdDefault.port);
-            if (result == TRDP_NO_ERR)
+            UINT32                  newSize = (appHandle->batchSize == 0u) ?
+                                              TRDP_PD_BATCH_MIN_SIZE : 2u * appHandle->batchSize;
+            TRDP_PD_BATCH_ENTRY_T   *pNew   = (TRDP_PD_BATCH_ENTRY_T *) vos_memAlloc(
+                                                  newSize * sizeof(TRDP_PD_BATCH_ENTRY_T));
+            if (pNew == NULL)
             {
-                appHandle->stats.pd.numSend++;
-                iterPD->numRxTx++;
+                vos_printLogStr(VOS_LOG_WARNING, "Out of memory, batch callback skipped\n");
+                return FALSE;
             }
-            else
+            if (appHandle->pBatch != NULL)
             {
-                err = result;   /* pass last error to application  */
+                memcpy(pNew, appHandle->pBatch, appHandle->noOfBatch * sizeof(TRDP_PD_BATCH_ENTRY_T));
+                vos_memFree(appHandle->pBatch);
             }
+            appHandle->pBatch       = pNew;
+            appHandle->batchSize    = newSize;
         }
+        pElement->batchPos = ++appHandle->noOfBatch;
+    }
+    else
+    {
+        /*  Keep reporting the fields changed by the telegrams received before  */
+        changeMask = appHandle->pBatch[pElement->batchPos - 1u].info.changeMask;
     }
+    pEntry              = &appHandle->pBatch[pElement->batchPos - 1u];
+    pEntry->subHandle   = pElement;
+    pEntry->info        = *pInfo;
+    pEntry->info.changeMask |= changeMask;
+    pEntry->pData       = pData;
+    pEntry->dataSize    = dataSize;
+    return TRUE;
+}
 
-    if ((iterPD->privFlags & TRDP_REQ_2B_SENT) &&
-        (iterPD->pFrame->frameHead.msgType == vos_htons(TRDP_MSG_PP)))       /*  PULL packet?  */
+/******************************************************************************/
+/** Hand a callback over to the callback threads, if enabled.
+ *  The sample is copied and replaces an older sample of the subscription which was not delivered yet.
+ *  Must be called with mutexRxPD held.
+ *
+ *  @param[in]      appHandle           session pointer
+ *  @param[in]      pElement            subscription
+ *  @param[in]      pInfo               message info for the callback
+ *  @param[in]      pData               received data or NULL
+ *  @param[in]      dataSize            size of the data
+ *
+ *  @retval         TRUE                a callback thread will call back
+ *  @retval         FALSE               the caller must call back directly
+ */
+static BOOL8 trdp_pdCbPost (
+    TRDP_SESSION_PT         appHandle,
+    PD_ELE_T                *pElement,
+    const TRDP_PD_INFO_T    *pInfo,
+    const UINT8             *pData,
+    UINT32                  dataSize)
+{
+#ifdef TRDP_PD_CB_POOL_SUPPORT
+    TRDP_PD_CB_POOL_T   *pPool = appHandle->pCbPool;
+    TRDP_PD_CB_SLOT_T   *pSlot;
+    TRDP_PD_CB_SAMPLE_T *pSample;
+    UINT8               middle;
+
+    if ((pPool == NULL) ||
+        (pElement->pfCbFunction == NULL) ||
+        ((pData != NULL) && (dataSize > TRDP_PD_CB_DATA_SIZE)))
     {
-        /* Do not reset timer, but restore msgType */
-        iterPD->pFrame->frameHead.msgType = vos_htons(TRDP_MSG_PD);
+        return FALSE;
     }
-#ifndef HIGH_PERF_INDEXED
-    else if (timerisset(&iterPD->interval))
+
+    pSlot = pElement->pCbSlot;
+    if (pSlot == NULL)
     {
-        TRDP_TIME_T now;
+        pSlot = (TRDP_PD_CB_SLOT_T *) vos_memAlloc(sizeof(TRDP_PD_CB_SLOT_T));
+        if (pSlot == NULL)
+        {
+            return FALSE;
+        }
+        pSlot->back     = 0u;
+        pSlot->middle   = 1u;
+        pSlot->front    = 2u;
+        pSlot->pfCbFunction = pElement->pfCbFunction;
+        pElement->pCbSlot   = pSlot;
+    }
 
-        /*    Get the current time    */
-        vos_getTime(&now);
+    pSample             = &pSlot->sample[pSlot->back];
+    pSample->info       = *pInfo;
 
-        /*  Set timer if interval was set.
-         In case of a requested cyclically PD packet, this will lead to one time jump (jitter) in the interval
-         */
-        vos_addTime(&iterPD->timeToGo, &iterPD->interval);
+    /*  A sample not delivered yet is replaced: keep reporting the fields it changed.
+        Only we write the samples, so the middle one may be read even if a callback thread takes it meanwhile. */
+    middle = __atomic_load_n(&pSlot->middle, __ATOMIC_ACQUIRE);
+    if ((middle & TRDP_PD_CB_FRESH) != 0u)
+    {
+        pSample->info.changeMask |= pSlot->sample[middle & TRDP_PD_CB_INDEX].info.changeMask;
+    }
+    pSample->dataSize   = dataSize;
+    pSample->noData     = (pData == NULL) ? TRUE : FALSE;
+    if ((pData != NULL) && (dataSize > 0u))
+    {
+        memcpy(pSample->data, pData, dataSize);
+    }
 
-        if (vos_cmpTime(&iterPD->timeToGo, &now) <= 0)
+    /*  Publish the sample, the former middle buffer is our next back buffer    */
+    pSlot->back = (UINT8) (__atomic_exchange_n(&pSlot->middle, (UINT8) (pSlot->back | TRDP_PD_CB_FRESH),
+                                               __ATOMIC_ACQ_REL) & TRDP_PD_CB_INDEX);
+
+    /*  The first post queues the subscription, further posts just replace the sample  */
+    if (__atomic_fetch_add(&pSlot->state, 1u, __ATOMIC_ACQ_REL) == 0u)
+    {
+        if (trdp_pdCbEnqueue(pPool, pSlot) == FALSE)
         {
-            /* in case of a delay of more than one interval - avoid sending it in the next cycle again */
-            iterPD->timeToGo = now;
-            vos_addTime(&iterPD->timeToGo, &iterPD->interval);
+            /*  Queue full: take the sample back and call back directly  */
+            (void) __atomic_and_fetch(&pSlot->middle, TRDP_PD_CB_INDEX, __ATOMIC_RELAXED);
+            __atomic_store_n(&pSlot->state, 0u, __ATOMIC_RELEASE);
+            pPool->overruns++;
+            return FALSE;
         }
+        vos_semaGive(pPool->sema);
     }
+    return TRUE;
+#else
+    (void) appHandle;
+    (void) pElement;
+    (void) pInfo;
+    (void) pData;
+    (void) dataSize;
+    return FALSE;
 #endif
-    /* Reset "immediate" flag for request or requested packet */
-    if (iterPD->privFlags & TRDP_REQ_2B_SENT)
+}
+
+/******************************************************************************/
+/** Get the time packets on txTime sockets are handed to the kernel ahead of their launch time
+ *
+ *  @param[in]      appHandle           session pointer
+ *  @param[out]     pLookahead          one process cycle (or the timer granularity, if no cycle is configured)
+ */
+static void trdp_pdTxLookahead (
+    TRDP_SESSION_PT appHandle,
+    TRDP_TIME_T     *pLookahead)
+{
+    UINT32 lookahead = (appHandle->stats.processCycle != 0u) ? appHandle->stats.processCycle : TRDP_TIMER_GRANULARITY;
+
+    pLookahead->tv_sec  = (time_t) (lookahead / 1000000u);
+    pLookahead->tv_usec = (suseconds_t) (lookahead % 1000000u);
+}
+
+/******************************************************************************/
+/** Check if packets of a socket are handed to the kernel ahead of their launch time
+ *  Without an ETF qdisc on the interface the kernel sends them immediately, i.e. a cycle early. As soon as the
+ *  TX timestamps show this (or cannot verify the launch times), the packets are sent at their due time again.
+ *
+ *  @param[in]      pIface              socket
+ *
+ *  @retval         TRUE                send ahead with launch time
+ */
+static BOOL8 trdp_pdLaunchAhead (
+    const TRDP_SOCKETS_T *pIface)
+{
+    return ((pIface->pTxStampRef != NULL) && (pIface->launchState != TRDP_LAUNCH_IGNORED)) ? TRUE : FALSE;
+}
+
+/******************************************************************************/
+/** Remember which publisher sent a packet on a txTime socket
+ *  The key handed to the kernel with the packet comes back with its TX timestamp (ee_data). Kernels without
+ *  SCM_TS_OPT_ID report their own count of the packets sent instead, which stays in step with our keys only as long
+ *  as no send fails: after a failed send the stamps of the socket cannot be mapped anymore.
+ *
+ *  @param[in]      pIface              socket the packet was sent on
+ *  @param[in]      stampId             key of the packet
+ *  @param[in]      keyed               TRUE if the kernel reports stampId
+ *  @param[in]      sent                TRUE if the packet was handed to the kernel
+ *  @param[in]      pPacket             cyclic publisher or NULL (packet without statistics)
+ *  @param[in]      pLaunchTime         requested launch time or NULL (sent immediately)
+ */
+static void trdp_pdNoteTxStamp (
+    TRDP_SOCKETS_T      *pIface,
+    UINT32              stampId,
+    BOOL8               keyed,
+    BOOL8               sent,
+    PD_ELE_T            *pPacket,
+    const TRDP_TIME_T   *pLaunchTime)
+{
+    TRDP_TX_STAMP_REF_T *pRef;
+    UINT32              i;
+
+    if (pIface->pTxStampRef == NULL)
     {
-        iterPD->privFlags = (TRDP_PRIV_FLAGS_T) (iterPD->privFlags & ~(TRDP_PRIV_FLAGS_T)TRDP_REQ_2B_SENT);
+        return;
     }
-
-    /* remove one shot messages after they have been sent */
-    if (iterPD->pFrame->frameHead.msgType == vos_htons(TRDP_MSG_PR))    /* Ticket #172: remove element */
+    if ((sent == FALSE) && (keyed == FALSE) && (pIface->txStampSync == TRUE))
     {
-        PD_ELE_T *pTemp;
-        /* Decrease the socket ref */
-        trdp_releaseSocket(appHandle->ifacePD, iterPD->socketIdx, 0u, FALSE, VOS_INADDR_ANY);
-        /* Save next element */
-        pTemp = iterPD->pNext;
-        /* Remove current element */
-        trdp_queueDelElement(&appHandle->pSndQueue, iterPD);
-        iterPD->magic = 0u;
-        if (iterPD->pSeqCntList != NULL)
+        /*  We cannot tell whether the kernel counted the failed packet: the outstanding stamps are lost    */
+        for (i = 0u; i < TRDP_TX_STAMP_REFS; i++)
         {
-            vos_memFree(iterPD->pSeqCntList);
+            if (pIface->pTxStampRef[i].pElement != NULL)
+            {
+                pIface->pTxStampRef[i].pElement->txStats.numStampsLost++;
+                pIface->pTxStampRef[i].pElement = NULL;
+            }
         }
-        vos_memFree(iterPD->pFrame);
-        vos_memFree(iterPD);
-
-        /* pre-set next element */
-        *ppElement = pTemp;
-        /* continue; */
+        pIface->txStampSync = FALSE;
+        vos_printLog(VOS_LOG_WARNING,
+                     "TX timestamps of socket %d cannot be mapped to their packets after a failed send\n",
+                     (int) pIface->sock);
+    }
+    if (sent == FALSE)
+    {
+        return;
+    }
+    if (pIface->txStampSync == FALSE)
+    {
+        if ((pPacket != NULL) && (pLaunchTime != NULL))
+        {
+            pPacket->txStats.numStampsLost++;
+        }
+        return;
+    }
+    pRef = &pIface->pTxStampRef[stampId % TRDP_TX_STAMP_REFS];
+    if (pRef->pElement != NULL)
+    {
+        /*  The stamp of the packet sent TRDP_TX_STAMP_REFS packets ago did not arrive  */
+        pRef->pElement->txStats.numStampsLost++;
+    }
+    pRef->id = stampId;
+    if (pLaunchTime != NULL)
+    {
+        pRef->pElement      = pPacket;
+        pRef->launchTime    = *pLaunchTime;
+    }
+    else
+    {
+        pRef->pElement = NULL;
     }
-    return err;
 }
 
 /******************************************************************************/
-/** Send all due PD messages
- *
- *  @param[in]      appHandle           session pointer
+/** Update the TX timing statistics of a publisher
  *
- *  @retval         TRDP_NO_ERR         no error
- *  @retval         TRDP_IO_ERR         socket I/O error
+ *  @param[in]      pPacket             publisher
+ *  @param[in]      pLaunchTime         requested launch time
+ *  @param[in]      pTxStamp            TX timestamp reported by the kernel
  */
-TRDP_ERR_T  trdp_pdSendQueued (
-    TRDP_SESSION_PT appHandle)
+static void trdp_pdUpdateTxStats (
+    PD_ELE_T            *pPacket,
+    const TRDP_TIME_T   *pLaunchTime,
+    const TRDP_TIME_T   *pTxStamp)
 {
-    PD_ELE_T    *iterPD = appHandle->pSndQueue;
-    TRDP_TIME_T now;
-    TRDP_ERR_T  err = TRDP_NO_ERR;
+    TRDP_PUB_TX_STATS_T *pStats = &pPacket->txStats;
+    INT32 launchDelay;
 
-    /* Clearing the nextJob indicator is of no use here, it will disturb PD timeout handling when separate
-        threads are used!
-     vos_clearTime(&appHandle->nextJob); */
+    launchDelay = (INT32) ((pTxStamp->tv_sec - pLaunchTime->tv_sec) * 1000000 +
+                           (pTxStamp->tv_usec - pLaunchTime->tv_usec));
+    if ((pStats->numStamps == 0u) || (launchDelay > pStats->maxLaunchDelay))
+    {
+        pStats->maxLaunchDelay = launchDelay;
+    }
 
-    /*    Find the packet which has to be sent next:    */
-    while (iterPD != NULL)
+    if (timerisset(&pPacket->lastTxStamp))
     {
-        /*    Get the current time    */
-        vos_getTime(&now);
+        INT32   intervalUs  = (INT32) (pPacket->interval.tv_sec * 1000000 + pPacket->interval.tv_usec);
+        INT32   deviation   = (INT32) ((pTxStamp->tv_sec - pPacket->lastTxStamp.tv_sec) * 1000000 +
+                                       (pTxStamp->tv_usec - pPacket->lastTxStamp.tv_usec)) - intervalUs;
 
-        if (iterPD->privFlags & TRDP_IS_TSN)
+        /* A deviation of a whole interval or more means a stamp is missing, not jitter */
+        if (deviation < intervalUs)
         {
-            iterPD = iterPD->pNext;
-            continue;
+            if ((pPacket->numTxDev == 0u) || (deviation < pStats->minDeviation))
+            {
+                pStats->minDeviation = deviation;
+            }
+            if ((pPacket->numTxDev == 0u) || (deviation > pStats->maxDeviation))
+            {
+                pStats->maxDeviation = deviation;
+            }
+            pPacket->sumTxDev += (UINT64) ((deviation < 0) ? -deviation : deviation);
+            pPacket->numTxDev++;
+            pStats->avgDeviation = (UINT32) (pPacket->sumTxDev / pPacket->numTxDev);
         }
+    }
+    pPacket->lastTxStamp = *pTxStamp;
+    pStats->numStamps++;
+}
 
-        /*  Is this a cyclic packet and
-         due to sent?
+/******************************************************************************/
+/** Send one PD packet, with the AF_XDP socket or the io_uring if there is one
+ *  Pulled packets, packets with a launch time, for TSN or VLAN sockets and to destinations the AF_XDP socket
+ *  cannot address are sent with the packet's socket. Packets posted to the AF_XDP socket or queued to the io_uring
+ *  (all but pulled packets and the ones of txTime or TSN sockets) are sent by trdp_pdFlushPosted().
+ *
+ *  @param[in]      appHandle           session pointer
+ *  @param[in]      pPacket             pointer to packet to be sent
+ *  @param[in]      pLaunchTime         launch time (txTime sockets only) or NULL
+ *
+ *  @retval         TRDP_NO_ERR
+ *  @retval         TRDP_IO_ERR
+ */
+static TRDP_ERR_T trdp_pdSendFrame (
+    TRDP_SESSION_PT     appHandle,
+    PD_ELE_T            *pPacket,
+    const TRDP_TIME_T   *pLaunchTime)
+{
+    TRDP_SOCKETS_T *pIface = &appHandle->ifacePD[pPacket->socketIdx];
+
+#ifdef XDP_SUPPORT
+    /*  Pulled packets may be sent by the receiving thread, the TX ring belongs to the sending one  */
+    if ((appHandle->pdXsk != NULL) &&
+        !(pPacket->privFlags & TRDP_REQ_2B_SENT) &&
+        ((pIface->pTxStampRef == NULL) || (pLaunchTime == NULL)) &&
+        (pIface->sendParam.tsn == FALSE) &&
+        (pIface->sendParam.vlan == 0u))
+    {
+        if (vos_xskSendUDP(appHandle->pdXsk,
+                           (UINT8 *)&pPacket->pFrame->frameHead,
+                           pPacket->grossSize,
+                           pIface->srcAddr,
+                           pPacket->addr.destIpAddr,
+                           appHandle->pdDefault.port,
+                           (UINT8) (pIface->sendParam.qos << 5u),   /* The lower 2 bits are the ECN field! */
+                           (pIface->sendParam.ttl != 0u) ? pIface->sendParam.ttl : 64u) == VOS_NO_ERR)
+        {
+            pPacket->sendSize = pPacket->grossSize;
+            return TRDP_NO_ERR;
+        }
+    }
+#endif
+#ifdef URING_SUPPORT
+    /*  Same for the send ring of the io_uring, TX timestamps are taken from the sockets  */
+    if ((appHandle->pdUring != NULL) &&
+        !(pPacket->privFlags & TRDP_REQ_2B_SENT) &&
+        (pPacket->pullIpAddress == 0u) &&
+        (pIface->pTxStampRef == NULL) &&
+        (pIface->sendParam.tsn == FALSE))
+    {
+        if (vos_uringSendUDP(appHandle->pdUring,
+                             pIface->sock,
+                             (UINT8 *)&pPacket->pFrame->frameHead,
+                             pPacket->grossSize,
+                             pPacket->addr.destIpAddr,
+                             appHandle->pdDefault.port) == VOS_NO_ERR)
+        {
+            pPacket->sendSize = pPacket->grossSize;
+            return TRDP_NO_ERR;
+        }
+    }
+#endif
+    return trdp_pdSend(pIface, pPacket, appHandle->pdDefault.port, pLaunchTime);
+}
+
+/******************************************************************************/
+/** Initialize/construct the packet
+ *  Set the header infos
+ *
+ *  @param[in]      pPacket         pointer to the packet element to init
+ *  @param[in]      type            type the packet
+ *  @param[in]      etbTopoCnt      topocount to use for PD frame
+ *  @param[in]      opTrnTopoCnt    topocount to use for PD frame
+ *  @param[in]      replyComId      Pull request comId
+ *  @param[in]      replyIpAddress  Pull request Ip
+ *  @param[in]      serviceId       Service Id
+ */
+void    trdp_pdInit (
+    PD_ELE_T    *pPacket,
+    TRDP_MSG_T  type,
+    UINT32      etbTopoCnt,
+    UINT32      opTrnTopoCnt,
+    UINT32      replyComId,
+    UINT32      replyIpAddress,
+    UINT32      serviceId)
+{
+    if (pPacket == NULL || pPacket->pFrame == NULL)
+    {
+        return;
+    }
+#ifdef TSN_SUPPORT
+    /* If TSN is set, use the smaller header */
+    if (pPacket->privFlags & TRDP_IS_TSN)
+    {
+        PD2_HEADER_T *pFrameHead = (PD2_HEADER_T *) &pPacket->pFrame->frameHead;
+        pFrameHead->sequenceCounter = 0u;
+        pFrameHead->protocolVersion = TRDP_VER_TSN_PROTO;
+        pFrameHead->msgType         = (UINT8) (type & 0xFF);
+        pFrameHead->comId           = vos_htonl(pPacket->addr.comId);
+        pFrameHead->datasetLength   = vos_htons((UINT16) pPacket->dataSize);
+        pFrameHead->reserved        = vos_htonl(serviceId);
+    }
+    else
+#endif
+    {   /* This is the standard header */
+        pPacket->pFrame->frameHead.protocolVersion  = vos_htons(TRDP_PROTO_VER);
+        pPacket->pFrame->frameHead.etbTopoCnt       = vos_htonl(etbTopoCnt);
+        pPacket->pFrame->frameHead.opTrnTopoCnt     = vos_htonl(opTrnTopoCnt);
+        pPacket->pFrame->frameHead.comId            = vos_htonl(pPacket->addr.comId);
+        pPacket->pFrame->frameHead.msgType          = vos_htons((UINT16)type);
+        pPacket->pFrame->frameHead.datasetLength    = vos_htonl(pPacket->dataSize);
+        pPacket->pFrame->frameHead.reserved         = vos_htonl(serviceId);
+        pPacket->pFrame->frameHead.replyComId       = vos_htonl(replyComId);
+        pPacket->pFrame->frameHead.replyIpAddress   = vos_htonl(replyIpAddress);
+    }
+}
+
+/******************************************************************************/
+/** Copy data
+ *  Update the data to be sent
+ *
+ *  @param[in]      pPacket         pointer to the packet element to send
+ *  @param[in]      marshall        pointer to marshalling function
+ *  @param[in]      refCon          reference for marshalling function
+ *  @param[in]      pData           pointer to data
+ *  @param[in]      dataSize        size of data
+ *
+ *  @retval         TRDP_NO_ERR     no error
+ *                                  other errors
+ */
+TRDP_ERR_T trdp_pdPut (
+    PD_ELE_T        *pPacket,
+    TRDP_MARSHALL_T marshall,
+    void            *refCon,
+    const UINT8     *pData,
+    UINT32          dataSize)
+{
+    TRDP_ERR_T ret = TRDP_NO_ERR;
+
+    if (pPacket == NULL)
+    {
+        return TRDP_PARAM_ERR;
+    }
+
+    /* Ticket #104: There is no data!
+        Start sending by validating the packet */
+    if ((pPacket->dataSize == 0u) && (dataSize == 0u))
+    {
+        /* set data valid */
+        pPacket->privFlags = (TRDP_PRIV_FLAGS_T) (pPacket->privFlags & ~(TRDP_PRIV_FLAGS_T)TRDP_INVALID_DATA);
+
+        /*  Update some statistics  */
+        pPacket->updPkts++;
+    }
+    else if ((pData != NULL) && (dataSize != 0u))
+    {
+        if (pPacket->dataSize == 0u)
+        {
+            /* late data, enlarge packet buffer and copy existing header info */
+            PD_PACKET_T *pTemp;
+
+            pPacket->dataSize   = dataSize;
+            pPacket->grossSize  = trdp_packetSizePD(dataSize);
+            pTemp = (PD_PACKET_T *) vos_memAlloc(pPacket->grossSize);
+            if (pTemp == NULL)
+            {
+                return TRDP_MEM_ERR;
+            }
+            /* copy existing header info */
+            memcpy(pTemp, pPacket->pFrame, trdp_packetSizePD(0u));
+            vos_memFree(pPacket->pFrame);
+            pPacket->pFrame = pTemp;
+            /* complete header info, set dataset length */
+            pPacket->pFrame->frameHead.datasetLength = vos_htonl(pPacket->dataSize);
+        }
+
+        if (!(pPacket->pktFlags & TRDP_FLAGS_MARSHALL) || (marshall == NULL))
+        {
+
+            /* We must check the packet size! */
+            if ((dataSize > TRDP_MAX_PD_DATA_SIZE) ||
+                ((pPacket->dataSize != 0u) && (dataSize != pPacket->dataSize)))   /* Ticket #207: datasize differs */
+            {
+                return TRDP_PARAM_ERR;
+            }
+            memcpy(pPacket->pFrame->data, pData, dataSize);
+        }
+        else
+        {
+            ret = marshall(refCon,
+                           pPacket->addr.comId,
+                           (UINT8 *) pData,
+                           dataSize,
+                           pPacket->pFrame->data,
+                           &dataSize,
+                           &pPacket->pCachedDS);
+            /* We must set and check a possible smaller packet size! (Ticket #132) */
+            if (dataSize > TRDP_MAX_PD_DATA_SIZE)
+            {
+                return TRDP_PARAM_ERR;
+            }
+            pPacket->dataSize   = dataSize;
+            pPacket->grossSize  = trdp_packetSizePD(dataSize);
+            pPacket->pFrame->frameHead.datasetLength = vos_htonl(pPacket->dataSize);
+        }
+
+        if (TRDP_NO_ERR == ret)
+        {
+            /* set data valid */
+            pPacket->privFlags = (TRDP_PRIV_FLAGS_T) (pPacket->privFlags & ~(TRDP_PRIV_FLAGS_T)TRDP_INVALID_DATA);
+
+            /*  Update some statistics  */
+            pPacket->updPkts++;
+        }
+    }
+
+    return ret;
+}
+
+#ifdef TSN_SUPPORT
+/******************************************************************************/
+/** Send TSN PD message immediately
+ *
+ *  @param[in]      appHandle           session pointer
+ *  @param[in]      pSendPD             pointer to element to be sent
+ *  @param[in]      pTxTime             time to send
+ *
+ *  @retval         TRDP_NO_ERR         no error
+ *  @retval         TRDP_IO_ERR         socket I/O error
+ */
+TRDP_ERR_T  trdp_pdSendImmediateTSN (
+    TRDP_SESSION_PT appHandle,
+    PD_ELE_T        *pSendPD,
+    VOS_TIMEVAL_T   *pTxTime)
+{
+    VOS_ERR_T       err;
+    PD2_PACKET_T    *pFrame = (PD2_PACKET_T *) pSendPD->pFrame;
+
+    /*  Update the sequence counter and re-compute CRC    */
+    trdp_pdUpdate(pSendPD);
+
+    /* We pass the error to the application, but we keep on going    */
+    pSendPD->sendSize = pSendPD->grossSize;
+
+    err = vos_sockSendTSN(appHandle->ifacePD[pSendPD->socketIdx].sock,
+                          (UINT8 *)&pFrame->frameHead,
+                          &pSendPD->sendSize,
+                          pSendPD->addr.srcIpAddr,
+                          pSendPD->addr.destIpAddr,
+                          appHandle->pdDefault.port,
+                          pTxTime);
+
+    if (err == VOS_NO_ERR)
+    {
+        appHandle->stats.pd.numSend++;
+        pSendPD->numRxTx++;
+    }
+    return (TRDP_ERR_T) err;
+}
+#endif
+
+/******************************************************************************/
+/** Send PD message immediately
+ *
+ *  @param[in]      appHandle           session pointer
+ *  @param[in]      pSendPD             pointer to element to be sent
+ *
+ *  @retval         TRDP_NO_ERR         no error
+ *  @retval         TRDP_IO_ERR         socket I/O error
+ */
+TRDP_ERR_T  trdp_pdSendImmediate (
+    TRDP_SESSION_PT appHandle,
+    PD_ELE_T        *pSendPD)
+{
+    TRDP_ERR_T  err;
+    PD_PACKET_T *pFrame = (PD_PACKET_T *) pSendPD->pFrame;
+
+    /*  Update the sequence counter and re-compute CRC    */
+    trdp_pdUpdate(pSendPD);
+
+    /* Publisher check from Table A.5:
+     Actual topography counter values <-> Locally stored with publish */
+    if ( !trdp_validTopoCounters(appHandle->etbTopoCnt,
+                                 appHandle->opTrnTopoCnt,
+                                 vos_ntohl(pSendPD->pFrame->frameHead.etbTopoCnt),
+                                 vos_ntohl(pSendPD->pFrame->frameHead.opTrnTopoCnt)))
+    {
+        err = TRDP_TOPO_ERR;
+        vos_printLogStr(VOS_LOG_WARNING, "Sending PD: TopoCount is out of date!\n");
+        /* We pass the error to the application, and do not send!    */
+    }
+    else
+    {
+
+        TRDP_SOCKETS_T *pIface = &appHandle->ifacePD[pSendPD->socketIdx];
+
+        pSendPD->sendSize = pSendPD->grossSize;
+
+        if (pIface->pTxStampRef != NULL)
+        {
+            /*  txTime socket: the TX timestamp of this packet is keyed, too    */
+            UINT32  stampId = pIface->txStampId++;
+            BOOL8   keyed   = FALSE;
+
+            err = (TRDP_ERR_T) vos_sockSendUDPAt(pIface->sock,
+                                                 (UINT8 *)&pFrame->frameHead,
+                                                 &pSendPD->sendSize,
+                                                 pSendPD->addr.destIpAddr,
+                                                 appHandle->pdDefault.port,
+                                                 NULL,
+                                                 stampId,
+                                                 &keyed);
+            trdp_pdNoteTxStamp(pIface, stampId, keyed, (err == TRDP_NO_ERR) ? TRUE : FALSE, NULL, NULL);
+        }
+        else
+        {
+            err = (TRDP_ERR_T) vos_sockSendUDP(pIface->sock,
+                                               (UINT8 *)&pFrame->frameHead,
+                                               &pSendPD->sendSize,
+                                               pSendPD->addr.destIpAddr,
+                                               appHandle->pdDefault.port);
+        }
+
+        if (err == TRDP_NO_ERR)
+        {
+            appHandle->stats.pd.numSend++;
+            pSendPD->numRxTx++;
+        }
+    }
+
+    return err;
+}
+/******************************************************************************/
+/** Copy data
+ *  Set the header infos
+ */
+TRDP_ERR_T trdp_pdGet (
+    PD_ELE_T            *pPacket,
+    TRDP_UNMARSHALL_T   unmarshall,
+    void                *refCon,
+    const UINT8         *pData,
+    UINT32              *pDataSize)
+{
+    if (pPacket == NULL)
+    {
+        return TRDP_PARAM_ERR;
+    }
+
+    /*  Update some statistics  */
+    pPacket->getPkts++;
+
+    if ((pPacket->privFlags & TRDP_INVALID_DATA) != 0)
+    {
+        return TRDP_NODATA_ERR;
+    }
+
+    if ((pPacket->privFlags & TRDP_TIMED_OUT) != 0)
+    {
+        return TRDP_TIMEOUT_ERR;
+    }
+
+    if ((pData != NULL) && (pDataSize != NULL))
+    {
+        if ( !(pPacket->pktFlags & TRDP_FLAGS_MARSHALL) || (unmarshall == NULL))
+        {
+            if (*pDataSize >= pPacket->dataSize)
+            {
+                *pDataSize = pPacket->dataSize;
+                memcpy((void *)pData, pPacket->pFrame->data, *pDataSize);
+                return TRDP_NO_ERR;
+            }
+            else
+            {
+                return TRDP_PARAM_ERR;
+            }
+        }
+        else
+        {
+            return unmarshall(refCon,
+                              pPacket->addr.comId,
+                              pPacket->pFrame->data,
+                              vos_ntohl(pPacket->pFrame->frameHead.datasetLength),
+                              (UINT8 *)pData,
+                              pDataSize,
+                              &pPacket->pCachedDS);
+        }
+    }
+    return TRDP_NO_ERR;
+}
+
+/******************************************************************************/
+/** Send a due PD message
+ *
+ *  @param[in]      appHandle           session pointer
+ *  @param[in]      ppElement           pointer to pointer of the element to send
+ *  @param[in]      pLaunchTime         launch time for txTime sockets or NULL (send now)
+ *
+ *  @retval         TRDP_NO_ERR         no error
+ *  @retval         TRDP_IO_ERR         socket I/O error
+ */
+TRDP_ERR_T  trdp_pdSendElement (
+    TRDP_SESSION_PT     appHandle,
+    PD_ELE_T            * *ppElement,
+    const TRDP_TIME_T   *pLaunchTime)
+{
+    TRDP_ERR_T  err     = TRDP_NO_ERR;
+    PD_ELE_T    *iterPD = *ppElement;
+    BOOL8       follower;
+
+    /* send only if there is valid data */
+    if (!(iterPD->privFlags & TRDP_INVALID_DATA))
+    {
+        if ((iterPD->privFlags & TRDP_REQ_2B_SENT) &&
+            (iterPD->pFrame->frameHead.msgType == vos_htons(TRDP_MSG_PD)))       /*  PULL packet?  */
+        {
+            iterPD->pFrame->frameHead.msgType = vos_htons(TRDP_MSG_PP);
+        }
+        /*  Update the sequence counter and re-compute CRC, a follower only keeps the counter running    */
+        follower = trdp_pdIsFollower(iterPD);
+        if (follower == TRUE)
+        {
+            trdp_pdSkip(iterPD);
+        }
+        else
+        {
+            trdp_pdUpdate(iterPD);
+        }
+
+        /* Publisher check from Table A.5:
+         Actual topography counter values <-> Locally stored with publish */
+        if ( !trdp_validTopoCounters( appHandle->etbTopoCnt,
+                                      appHandle->opTrnTopoCnt,
+                                      vos_ntohl(iterPD->pFrame->frameHead.etbTopoCnt),
+                                      vos_ntohl(iterPD->pFrame->frameHead.opTrnTopoCnt)))
+        {
+            err = TRDP_TOPO_ERR;
+            vos_printLogStr(VOS_LOG_INFO, "Sending PD: TopoCount is out of date!\n");
+        }
+        /*    In case we're sending on an uninitialized publisher; should never happen. */
+        else if (iterPD->socketIdx == TRDP_INVALID_SOCKET_INDEX)
+        {
+            vos_printLogStr(VOS_LOG_ERROR, "Sending PD: Socket invalid!\n");
+            /* Try to send the other packets */
+        }
+        /*    Send the packet if it is not redundant    */
+        else if (follower == FALSE)
+        {
+            TRDP_ERR_T      result;
+            TRDP_TIME_T     cbTime;
+            TRDP_PD_HISTO_T *pHisto =
+                timerisset(&iterPD->interval) ? trdp_pdGetHisto(appHandle, iterPD) : NULL;
+
+            if (iterPD->pfCbFunction != NULL)
+            {
+                TRDP_PD_INFO_T theMessage;
+                theMessage.comId        = iterPD->addr.comId;
+                theMessage.srcIpAddr    = iterPD->addr.srcIpAddr;
+                theMessage.destIpAddr   = iterPD->addr.destIpAddr;
+                theMessage.etbTopoCnt   = vos_ntohl(iterPD->pFrame->frameHead.etbTopoCnt);
+                theMessage.opTrnTopoCnt = vos_ntohl(iterPD->pFrame->frameHead.opTrnTopoCnt);
+                theMessage.msgType      = (TRDP_MSG_T) vos_ntohs(iterPD->pFrame->frameHead.msgType);
+                theMessage.seqCount     = iterPD->curSeqCnt;
+                theMessage.protVersion  = vos_ntohs(iterPD->pFrame->frameHead.protocolVersion);
+                theMessage.replyComId   = vos_ntohl(iterPD->pFrame->frameHead.replyComId);
+                theMessage.replyIpAddr  = vos_ntohl(iterPD->pFrame->frameHead.replyIpAddress);
+                theMessage.pUserRef     = iterPD->pUserRef; /* User reference given with the local subscribe? */
+                theMessage.resultCode   = err;
+                vos_clearTime(&theMessage.rxTime);
+
+                if (pHisto != NULL)
+                {
+                    vos_getTime(&cbTime);
+                }
+                iterPD->pfCbFunction(appHandle->pdDefault.pRefCon,
+                                     appHandle,
+                                     &theMessage,
+                                     iterPD->pFrame->data,
+                                     vos_ntohl(iterPD->pFrame->frameHead.datasetLength));
+                if (pHisto != NULL)
+                {
+                    TRDP_TIME_T now;
+                    vos_getTime(&now);
+                    trdp_histoAddTime(&pHisto->histo.cbExec, &cbTime, &now);
+                }
+            }
+            /* We pass the error to the application, but we keep on going    */
+            result = trdp_pdSendFrame(appHandle, iterPD, (iterPD->privFlags & TRDP_REQ_2B_SENT) ? NULL : pLaunchTime);
+            if (result == TRDP_NO_ERR)
+            {
+                appHandle->stats.pd.numSend++;
+                iterPD->numRxTx++;
+                /*  Send interval of cyclic packets, pulled ones would spoil it  */
+                if ((pHisto != NULL) &&
+                    timerisset(&iterPD->interval) &&
+                    !(iterPD->privFlags & TRDP_REQ_2B_SENT))
+                {
+                    vos_getTime(&cbTime);
+                    trdp_histoMark(pHisto, &cbTime);
+                }
+            }
+            else
+            {
+                err = result;   /* pass last error to application  */
+            }
+        }
+    }
+
+    if ((iterPD->privFlags & TRDP_REQ_2B_SENT) &&
+        (iterPD->pFrame->frameHead.msgType == vos_htons(TRDP_MSG_PP)))       /*  PULL packet?  */
+    {
+        /* Do not reset timer, but restore msgType */
+        iterPD->pFrame->frameHead.msgType = vos_htons(TRDP_MSG_PD);
+    }
+#ifndef HIGH_PERF_INDEXED
+    else if (timerisset(&iterPD->interval))
+    {
+        TRDP_TIME_T now;
+
+        /*    Get the current time    */
+        vos_getTime(&now);
+
+        /*  Set timer if interval was set.
+         In case of a requested cyclically PD packet, this will lead to one time jump (jitter) in the interval
+         */
+        vos_addTime(&iterPD->timeToGo, &iterPD->interval);
+
+        if (vos_cmpTime(&iterPD->timeToGo, &now) <= 0)
+        {
+            /* in case of a delay of more than one interval - avoid sending it in the next cycle again */
+            iterPD->timeToGo = now;
+            vos_addTime(&iterPD->timeToGo, &iterPD->interval);
+        }
+    }
+#endif
+    /* Reset "immediate" flag for request or requested packet */
+    if (iterPD->privFlags & TRDP_REQ_2B_SENT)
+    {
+        iterPD->privFlags = (TRDP_PRIV_FLAGS_T) (iterPD->privFlags & ~(TRDP_PRIV_FLAGS_T)TRDP_REQ_2B_SENT);
+    }
+
+    /* remove one shot messages after they have been sent */
+    if (iterPD->pFrame->frameHead.msgType == vos_htons(TRDP_MSG_PR))    /* Ticket #172: remove element */
+    {
+        PD_ELE_T *pTemp;
+        /* Decrease the socket ref */
+        trdp_releaseSocket(appHandle->ifacePD, iterPD->socketIdx, 0u, FALSE, VOS_INADDR_ANY);
+        /* Save next element */
+        pTemp = iterPD->pNext;
+        /* Remove current element */
+        trdp_queueDelElement(&appHandle->pSndQueue, iterPD);
+        trdp_pdRedGroupRemove(iterPD);
+        iterPD->magic = 0u;
+        if (iterPD->pSeqCntList != NULL)
+        {
+            vos_memFree(iterPD->pSeqCntList);
+        }
+        vos_memFree(iterPD->pFrame);
+        vos_memFree(iterPD);
+
+        /* pre-set next element */
+        *ppElement = pTemp;
+        /* continue; */
+    }
+    return err;
+}
+
+/******************************************************************************/
+/** Send all due PD messages
+ *
+ *  @param[in]      appHandle           session pointer
+ *
+ *  @retval         TRDP_NO_ERR         no error
+ *  @retval         TRDP_IO_ERR         socket I/O error
+ */
+TRDP_ERR_T  trdp_pdSendQueued (
+    TRDP_SESSION_PT appHandle)
+{
+    PD_ELE_T    *iterPD = appHandle->pSndQueue;
+    TRDP_TIME_T now;
+    TRDP_TIME_T due;
+    TRDP_TIME_T lookahead;
+    TRDP_TIME_T launchTime;
+    TRDP_ERR_T  err = TRDP_NO_ERR;
+    BOOL8       follower;
+
+    trdp_pdTxLookahead(appHandle, &lookahead);
+
+    /* Clearing the nextJob indicator is of no use here, it will disturb PD timeout handling when separate
+        threads are used!
+     vos_clearTime(&appHandle->nextJob); */
+
+    /*    Find the packet which has to be sent next:    */
+    while (iterPD != NULL)
+    {
+        /*    Get the current time    */
+        vos_getTime(&now);
+
+        if (iterPD->privFlags & TRDP_IS_TSN)
+        {
+            iterPD = iterPD->pNext;
+            continue;
+        }
+
+        /*  Packets on txTime sockets are handed over one cycle ahead, the kernel sends them at timeToGo */
+        due = now;
+        if ((iterPD->socketIdx != TRDP_INVALID_SOCKET_INDEX) &&
+            (trdp_pdLaunchAhead(&appHandle->ifacePD[iterPD->socketIdx]) == TRUE))
+        {
+            vos_addTime(&due, &lookahead);
+        }
+
+        /*  Is this a cyclic packet and
+         due to sent?
          or is it a PD Request or a requested packet (PULL) ?
          */
-        if ((timerisset(&iterPD->interval) &&                   /*  Request for immediate sending   */
-             !timercmp(&iterPD->timeToGo, &now, >)) ||
-            (iterPD->privFlags & TRDP_REQ_2B_SENT))
+        if ((timerisset(&iterPD->interval) &&                   /*  Request for immediate sending   */
+             !timercmp(&iterPD->timeToGo, &due, >)) ||
+            (iterPD->privFlags & TRDP_REQ_2B_SENT))
+        {
+            launchTime = iterPD->timeToGo;
+
+            /* send only if there is valid data */
+            if (!(iterPD->privFlags & TRDP_INVALID_DATA))
+            {
+                if ((iterPD->privFlags & TRDP_REQ_2B_SENT) &&
+                    (iterPD->pFrame->frameHead.msgType == vos_htons(TRDP_MSG_PD)))       /*  PULL packet?  */
+                {
+                    iterPD->pFrame->frameHead.msgType = vos_htons(TRDP_MSG_PP);
+                }
+                /*  Update the sequence counter and re-compute CRC, a follower only keeps the counter running    */
+                follower = trdp_pdIsFollower(iterPD);
+                if (follower == TRUE)
+                {
+                    trdp_pdSkip(iterPD);
+                }
+                else
+                {
+                    trdp_pdUpdate(iterPD);
+                }
+
+                /* Publisher check from Table A.5:
+                   Actual topography counter values <-> Locally stored with publish */
+                if ( !trdp_validTopoCounters( appHandle->etbTopoCnt,
+                                              appHandle->opTrnTopoCnt,
+                                              vos_ntohl(iterPD->pFrame->frameHead.etbTopoCnt),
+                                              vos_ntohl(iterPD->pFrame->frameHead.opTrnTopoCnt)))
+                {
+                    err = TRDP_TOPO_ERR;
+                    vos_printLogStr(VOS_LOG_INFO, "Sending PD: TopoCount is out of date!\n");
+                }
+                /*    In case we're sending on an uninitialized publisher; should never happen. */
+                else if (iterPD->socketIdx == TRDP_INVALID_SOCKET_INDEX)
+                {
+                    vos_printLogStr(VOS_LOG_ERROR, "Sending PD: Socket invalid!\n");
+                    /* Try to send the other packets */
+                }
+                /*    Send the packet if it is not redundant    */
+                else if (follower == FALSE)
+                {
+                    TRDP_ERR_T      result;
+                    TRDP_TIME_T     cbTime;
+                    TRDP_PD_HISTO_T *pHisto =
+                        timerisset(&iterPD->interval) ? trdp_pdGetHisto(appHandle, iterPD) : NULL;
+
+                    if (iterPD->pfCbFunction != NULL)
+                    {
+                        TRDP_PD_INFO_T theMessage;
+                        theMessage.comId        = iterPD->addr.comId;
+                        theMessage.srcIpAddr    = iterPD->addr.srcIpAddr;
+                        theMessage.destIpAddr   = iterPD->addr.destIpAddr;
+                        theMessage.etbTopoCnt   = vos_ntohl(iterPD->pFrame->frameHead.etbTopoCnt);
+                        theMessage.opTrnTopoCnt = vos_ntohl(iterPD->pFrame->frameHead.opTrnTopoCnt);
+                        theMessage.msgType      = (TRDP_MSG_T) vos_ntohs(iterPD->pFrame->frameHead.msgType);
+                        theMessage.seqCount     = iterPD->curSeqCnt;
+                        theMessage.protVersion  = vos_ntohs(iterPD->pFrame->frameHead.protocolVersion);
+                        theMessage.replyComId   = vos_ntohl(iterPD->pFrame->frameHead.replyComId);
+                        theMessage.replyIpAddr  = vos_ntohl(iterPD->pFrame->frameHead.replyIpAddress);
+                        theMessage.pUserRef     = iterPD->pUserRef; /* User reference given with the local subscribe? */
+                        theMessage.resultCode   = err;
+                        vos_clearTime(&theMessage.rxTime);
+
+                        if (pHisto != NULL)
+                        {
+                            vos_getTime(&cbTime);
+                        }
+                        iterPD->pfCbFunction(appHandle->pdDefault.pRefCon,
+                                             appHandle,
+                                             &theMessage,
+                                             iterPD->pFrame->data,
+                                             vos_ntohl(iterPD->pFrame->frameHead.datasetLength));
+                        if (pHisto != NULL)
+                        {
+                            TRDP_TIME_T now;
+                            vos_getTime(&now);
+                            trdp_histoAddTime(&pHisto->histo.cbExec, &cbTime, &now);
+                        }
+                    }
+                    /* We pass the error to the application, but we keep on going    */
+                    result = trdp_pdSendFrame(appHandle, iterPD,
+                                              (iterPD->privFlags & TRDP_REQ_2B_SENT) ? NULL : &launchTime);
+                    if (result == TRDP_NO_ERR)
+                    {
+                        appHandle->stats.pd.numSend++;
+                        iterPD->numRxTx++;
+                        /*  Send interval of cyclic packets, pulled ones would spoil it  */
+                        if ((pHisto != NULL) &&
+                            timerisset(&iterPD->interval) &&
+                            !(iterPD->privFlags & TRDP_REQ_2B_SENT))
+                        {
+                            vos_getTime(&cbTime);
+                            trdp_histoMark(pHisto, &cbTime);
+                        }
+                    }
+                    else
+                    {
+                        err = result;   /* pass last error to application  */
+                    }
+                }
+            }
+
+            if ((iterPD->privFlags & TRDP_REQ_2B_SENT) &&
+                (iterPD->pFrame->frameHead.msgType == vos_htons(TRDP_MSG_PP)))       /*  PULL packet?  */
+            {
+                /* Do not reset timer, but restore msgType */
+                iterPD->pFrame->frameHead.msgType = vos_htons(TRDP_MSG_PD);
+            }
+            else if (timerisset(&iterPD->interval))
+            {
+                /*  Set timer if interval was set.
+                    In case of a requested cyclically PD packet, this will lead to one time jump (jitter) in the interval
+                */
+                vos_addTime(&iterPD->timeToGo, &iterPD->interval);
+
+                if (vos_cmpTime(&iterPD->timeToGo, &now) <= 0)
+                {
+                    /* in case of a delay of more than one interval - avoid sending it in the next cycle again */
+                    iterPD->timeToGo = now;
+                    vos_addTime(&iterPD->timeToGo, &iterPD->interval);
+                }
+            }
+
+            /* Reset "immediate" flag for request or requested packet */
+            iterPD->privFlags = (TRDP_PRIV_FLAGS_T) (iterPD->privFlags & ~(TRDP_PRIV_FLAGS_T)TRDP_REQ_2B_SENT);
+
+            /* remove one shot messages after they have been sent */
+            if (iterPD->pFrame->frameHead.msgType == vos_htons(TRDP_MSG_PR))    /* Ticket #172: remove element */
+            {
+                PD_ELE_T *pTemp;
+                /* Decrease the socket ref */
+                trdp_releaseSocket(appHandle->ifacePD, iterPD->socketIdx, 0u, FALSE, VOS_INADDR_ANY);
+                /* Save next element */
+                pTemp = iterPD->pNext;
+                /* Remove current element */
+                trdp_queueDelElement(&appHandle->pSndQueue, iterPD);
+                trdp_pdRedGroupRemove(iterPD);
+                iterPD->magic = 0u;
+                if (iterPD->pSeqCntList != NULL)
+                {
+                    vos_memFree(iterPD->pSeqCntList);
+                }
+                vos_memFree(iterPD->pFrame);
+                vos_memFree(iterPD);
+
+                /* pre-set next element */
+                iterPD = pTemp;
+                continue;
+            }
+        }
+        iterPD = iterPD->pNext;
+    }
+
+    trdp_pdFlushPosted(appHandle);
+    trdp_pdCollectTxStamps(appHandle);
+
+    return err;
+}
+
+/******************************************************************************/
+/** Process a received PD packet
+ *  Check for protocol errors and compare the received data to the data in our receive queue.
+ *  If it is a new packet, check if it is a PD Request (PULL).
+ *  If it is an update, exchange the existing entry with the new one
+ *  Call user's callback if needed
+ *  The packet is either the session's receive frame or still in the receive buffer of an AF_XDP socket; in the
+ *  latter case it is copied only if it is accepted.
+ *
+ *  @param[in]      appHandle           session pointer
+ *  @param[in]      pPacket             the received packet
+ *  @param[in]      recSize             its size
+ *  @param[in]      srcIpAddr           source IP address
+ *  @param[in]      destIpAddr          destination IP address
+ *  @param[in]      pRxTime             arrival time
+ *
+ *  @retval         TRDP_NO_ERR         no error
+ *  @retval         TRDP_PARAM_ERR      parameter error
+ *  @retval         TRDP_WIRE_ERR       protocol error (late packet, version mismatch)
+ *  @retval         TRDP_QUEUE_ERR      not in queue
+ *  @retval         TRDP_CRC_ERR        header checksum
+ *  @retval         TRDP_TOPOCOUNT_ERR  invalid topocount
+ */
+static TRDP_ERR_T  trdp_pdProcessFrame (
+    TRDP_SESSION_PT     appHandle,
+    PD_PACKET_T         *pPacket,
+    UINT32              recSize,
+    TRDP_IP_ADDR_T      srcIpAddr,
+    TRDP_IP_ADDR_T      destIpAddr,
+    const TRDP_TIME_T   *pRxTime)
+{
+    PD_HEADER_T         *pNewFrameHead      = &pPacket->frameHead;
+    PD_ELE_T            *pExistingElement   = NULL;
+    PD_ELE_T            *pPulledElement;
+    TRDP_ERR_T          err             = TRDP_NO_ERR;
+    int                 informUser      = FALSE;
+    int                 isTSN           = FALSE;
+    TRDP_ADDRESSES_T    subAddresses    = { 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u};
+    TRDP_MSG_T          msgType;
+    TRDP_PD_HISTO_T     *pHisto         = NULL;
+    TRDP_TIME_T         rxTime          = *pRxTime;
+    TRDP_TIME_T         cbTime;
+#ifdef TSN_SUPPORT
+    PD2_HEADER_T        *pTSNFrameHead = (PD2_HEADER_T *) pNewFrameHead;
+#endif
+
+    subAddresses.srcIpAddr  = srcIpAddr;
+    subAddresses.destIpAddr = destIpAddr;
+
+    /*  Is packet sane?    */
+    err = trdp_pdCheck(pNewFrameHead, recSize, &isTSN);
+
+    /*  Update statistics   */
+    switch (err)
+    {
+        case TRDP_NO_ERR:
+            appHandle->stats.pd.numRcv++;
+            break;
+        case TRDP_CRC_ERR:
+            appHandle->stats.pd.numCrcErr++;
+            return err;
+        case TRDP_WIRE_ERR:
+            appHandle->stats.pd.numProtErr++;
+            return err;
+        default:
+            return err;
+    }
+
+#ifdef TSN_SUPPORT
+    if (TRUE == isTSN)
+    {
+        /*  Compute the subscription handle */
+        subAddresses.comId          = vos_ntohl(pTSNFrameHead->comId);
+        subAddresses.etbTopoCnt     = 0u;   /* they do not matter */
+        subAddresses.opTrnTopoCnt   = 0u;
+        subAddresses.serviceId      = vos_ntohl(pTSNFrameHead->reserved);
+        msgType = pTSNFrameHead->msgType;
+    }
+    else    /* no PULL on TSN */
+#endif
+    {
+        /* First check incoming packet's topoCounts against session topoCounts */
+        /* First subscriber check from Table A.5:
+         Actual topography counter values <-> Topography counters of received */
+        if ( !trdp_validTopoCounters( appHandle->etbTopoCnt,
+                                      appHandle->opTrnTopoCnt,
+                                      vos_ntohl(pNewFrameHead->etbTopoCnt),
+                                      vos_ntohl(pNewFrameHead->opTrnTopoCnt)))
+        {
+            appHandle->stats.pd.numTopoErr++;
+            return TRDP_TOPO_ERR;
+        }
+
+        /*  Compute the subscription handle */
+        subAddresses.comId          = vos_ntohl(pNewFrameHead->comId);
+        subAddresses.etbTopoCnt     = vos_ntohl(pNewFrameHead->etbTopoCnt);
+        subAddresses.opTrnTopoCnt   = vos_ntohl(pNewFrameHead->opTrnTopoCnt);
+        subAddresses.serviceId      = vos_ntohl(pNewFrameHead->reserved);
+        msgType = vos_ntohs(pNewFrameHead->msgType);
+
+
+    }
+
+    /*  Examine subscription queue, are we interested in this PD?   */
+#ifdef HIGH_PERF_INDEXED
+    if ((appHandle->pSlot == NULL) ||
+        (appHandle->pSlot->noOfRxEntries == 0))
+    {
+        /*  If not set up until now, we issue a warning, but handle the data...   */
+        vos_printLogStr(VOS_LOG_WARNING, "Receiving PD while tlc_updateSession() not yet called or rcvIdx empty.\n");
+        pExistingElement = trdp_queueFindSubAddr(appHandle->pRcvQueue, &subAddresses);
+    }
+    else
+    {
+        /*  This is the fast, indexed access to our subscriptions!   */
+        pExistingElement = trdp_indexedFindSubAddr(appHandle, &subAddresses);
+    }
+#else
+    pExistingElement = trdp_queueFindSubAddr(appHandle->pRcvQueue, &subAddresses);
+#endif
+
+    if (pExistingElement == NULL)
+    {
+        /*
+         vos_printLog(VOS_LOG_INFO, "No subscription (SrcIp: %s comId %u)\n", vos_ipDotted(subAddresses.srcIpAddr),
+         vos_ntohl(pNewFrame->frameHead.comId));
+         */
+        err = TRDP_NOSUB_ERR;
+    }
+    else
+    {
+        /*  We check for local communication
+         or if etbTopoCnt and opTrnTopoCnt of the subscription are zero or match */
+        if (((subAddresses.etbTopoCnt == 0) && (subAddresses.opTrnTopoCnt == 0))
+            ||
+            trdp_validTopoCounters(subAddresses.etbTopoCnt,             /* For TSN, topocounts do not matter */
+                                   subAddresses.opTrnTopoCnt,
+                                   pExistingElement->addr.etbTopoCnt,
+                                   pExistingElement->addr.opTrnTopoCnt))
+        {
+            UINT32 newSeqCnt = vos_ntohl(pNewFrameHead->sequenceCounter);   /* same location for PD and PD2 */
+            /* Save the source IP address of the received packet */
+            pExistingElement->lastSrcIP = subAddresses.srcIpAddr;
+            /* Save the real destination of the received packet (own IP or MC group) */
+            pExistingElement->addr.destIpAddr = subAddresses.destIpAddr;
+
+
+            if ((newSeqCnt == 0u) ||                                /* restarted or new sender  */
+                (pExistingElement->privFlags & TRDP_TIMED_OUT))     /* or timed out before      */
+            {
+                trdp_resetSequenceCounter(pExistingElement, subAddresses.srcIpAddr,
+                                          (TRDP_MSG_T) vos_ntohs(pNewFrameHead->msgType));
+            }
+
+            /* find sender in our list */
+            switch (trdp_checkSequenceCounter(pExistingElement,
+                                              newSeqCnt,
+                                              subAddresses.srcIpAddr,
+                                              (TRDP_MSG_T) vos_ntohs(pNewFrameHead->msgType)))
+            {
+                case 0:                      /* Sequence counter is valid (at least 1 higher than previous one) */
+                    break;
+                case -1:                     /* List overflow */
+                    return TRDP_MEM_ERR;
+                case 1:
+                    vos_printLog(VOS_LOG_INFO, "Old PD data ignored (SrcIp: %s comId %u)\n", vos_ipDotted(
+                                     subAddresses.srcIpAddr), vos_ntohl(pNewFrameHead->comId));
+                    return TRDP_NO_ERR;      /* Ignore packet, too old or duplicate */
+            }
+
+            if ((newSeqCnt > 0u) && (newSeqCnt > (pExistingElement->curSeqCnt + 1u)))
+            {
+                pExistingElement->numMissed += newSeqCnt - pExistingElement->curSeqCnt - 1u;
+            }
+            else if (pExistingElement->curSeqCnt > newSeqCnt)
+            {
+                pExistingElement->numMissed += UINT32_MAX - pExistingElement->curSeqCnt + newSeqCnt;
+            }
+
+            /* Store last received sequence counter here, too (pd_get et. al. may access it).   */
+            pExistingElement->curSeqCnt = vos_ntohl(pNewFrameHead->sequenceCounter);
+
+            /*  This might have not been set!   */
+            pExistingElement->dataSize  = vos_ntohl(pNewFrameHead->datasetLength);
+            pExistingElement->grossSize = trdp_packetSizePD(pExistingElement->dataSize);
+
+            if (TRUE == isTSN)
+            {
+                informUser = TRUE;
+            }
+            /*  Has the data changed?   */
+            else if (pExistingElement->pktFlags & TRDP_FLAGS_CALLBACK)
+            {
+                TRDP_PD_FILTER_T *pFilter = pExistingElement->pFilter;
+
+                if (pFilter != NULL)
+                {
+                    pExistingElement->changeMask = trdp_pdChangeMask(pFilter,
+                                                                     pPacket->data,
+                                                                     pExistingElement->pFrame->data,
+                                                                     pExistingElement->dataSize);
+                }
+                else
+                {
+                    pExistingElement->changeMask = (0 != memcmp(pPacket->data,
+                                                                pExistingElement->pFrame->data,
+                                                                pExistingElement->dataSize)) ?
+                                                   TRDP_PD_ALL_FIELDS : 0u;
+                }
+
+                if ((pExistingElement->pktFlags & TRDP_FLAGS_FORCE_CB) ||
+                    (pExistingElement->privFlags & TRDP_TIMED_OUT))
+                {
+                    informUser = TRUE;                 /* Inform user anyway */
+                }
+                else if (pFilter != NULL)
+                {
+                    informUser = trdp_pdFilterChanges(pFilter,
+                                                      pPacket->data,
+                                                      pExistingElement->dataSize,
+                                                      &pExistingElement->changeMask);
+                }
+                else if (pExistingElement->changeMask != 0u)
+                {
+                    informUser = TRUE;
+                }
+
+                if ((informUser == TRUE) && (pFilter != NULL))
+                {
+                    trdp_pdFilterReported(pFilter, pPacket->data, pExistingElement->dataSize);
+                }
+            }
+
+            /*  Compute the next time this packet should be received from its arrival time,
+                not from the time we got to process it.  */
+            pExistingElement->rxTime    = rxTime;
+            pExistingElement->timeToGo  = rxTime;
+            vos_addTime(&pExistingElement->timeToGo, &pExistingElement->interval);
+
+            /*  Update some statistics  */
+            pExistingElement->numRxTx++;
+            pExistingElement->lastErr   = TRDP_NO_ERR;
+            pHisto = trdp_pdGetHisto(appHandle, pExistingElement);
+            if (pHisto != NULL)
+            {
+                trdp_histoMark(pHisto, &rxTime);
+            }
+            pExistingElement->privFlags =
+                (TRDP_PRIV_FLAGS_T) (pExistingElement->privFlags & ~(TRDP_PRIV_FLAGS_T)TRDP_TIMED_OUT);
+
+            /* mark the data as valid */
+            pExistingElement->privFlags =
+                (TRDP_PRIV_FLAGS_T) (pExistingElement->privFlags & ~(TRDP_PRIV_FLAGS_T)TRDP_INVALID_DATA);
+
+            /*  remove the old one, insert the new one  */
+            /*  -> always swap the frame pointers              */
+            {
+                PD_PACKET_T *pTemp;
+
+                if (pPacket != appHandle->pNewFrame)
+                {
+                    memcpy(appHandle->pNewFrame, pPacket, recSize);
+                }
+                pTemp = pExistingElement->pFrame;
+                pExistingElement->pFrame    = appHandle->pNewFrame;
+                appHandle->pNewFrame        = pTemp;
+            }
+
+            /*  The old frame is reused for the next packet, a batch entry must follow the swap    */
+            if ((pExistingElement->batchPos != 0u) &&
+                (appHandle->pBatch[pExistingElement->batchPos - 1u].pData != NULL))
+            {
+                TRDP_PD_BATCH_ENTRY_T *pEntry = &appHandle->pBatch[pExistingElement->batchPos - 1u];
+#ifdef TSN_SUPPORT
+                if (TRUE == isTSN)
+                {
+                    pEntry->pData       = ((PD2_PACKET_T *)pExistingElement->pFrame)->data;
+                    pEntry->dataSize    =
+                        (UINT32) vos_ntohs(((PD2_PACKET_T *)pExistingElement->pFrame)->frameHead.datasetLength);
+                }
+                else
+#endif
+                {
+                    pEntry->pData       = pExistingElement->pFrame->data;
+                    pEntry->dataSize    = vos_ntohl(pExistingElement->pFrame->frameHead.datasetLength);
+                }
+            }
+
+            /*  It might be a PULL request      */
+            if (vos_ntohs(pNewFrameHead->msgType) == (UINT16) TRDP_MSG_PR)
+            {
+                /*  Handle statistics request  */
+                if (vos_ntohl(pNewFrameHead->comId) == TRDP_STATISTICS_PULL_COMID)
+                {
+                    pPulledElement = trdp_queueFindComId(appHandle->pSndQueue, TRDP_GLOBAL_STATS_REPLY_COMID);
+                    if (pPulledElement != NULL)
+                    {
+                        pPulledElement->addr.destIpAddr = vos_ntohl(pNewFrameHead->replyIpAddress);
+
+                        trdp_pdInit(pPulledElement, TRDP_MSG_PP, appHandle->etbTopoCnt, appHandle->opTrnTopoCnt,
+                                    0u, 0u, vos_ntohl(pNewFrameHead->reserved));
+
+                        trdp_pdPrepareStats(appHandle, pPulledElement);
+                    }
+                    else
+                    {
+                        vos_printLogStr(VOS_LOG_ERROR, "Statistics request failed, not published!\n");
+                    }
+                }
+                else
+                {
+                    UINT32 replyComId = vos_ntohl(pNewFrameHead->replyComId);
+
+                    if (replyComId == 0u)
+                    {
+                        replyComId = vos_ntohl(pNewFrameHead->comId);
+                    }
+
+                    /*  Find requested publish element  */
+                    pPulledElement = trdp_queueFindComId(appHandle->pSndQueue, replyComId);
+                }
+
+                if (pPulledElement != NULL)
+                {
+                    /*  Set the destination address of the requested telegram either to the replyIp or the source Ip of the
+                     requester   */
+
+                    if (pNewFrameHead->replyIpAddress != 0u)
+                    {
+                        pPulledElement->pullIpAddress = vos_ntohl(pNewFrameHead->replyIpAddress);
+                    }
+                    else
+                    {
+                        pPulledElement->pullIpAddress = subAddresses.srcIpAddr;
+                    }
+
+                    /* trigger immediate sending of PD  */
+                    pPulledElement->privFlags |= TRDP_REQ_2B_SENT;
+
+                    if (trdp_pdSendElement(appHandle, &pPulledElement, NULL) != TRDP_NO_ERR)
+                    {
+                        /*  We do not break here, only report error */
+                        vos_printLogStr(VOS_LOG_WARNING, "Error sending one or more PD packets\n");
+                    }
+
+                    informUser = TRUE;
+                }
+            }
+
+        }
+        else
+        {
+            appHandle->stats.pd.numTopoErr++;
+            pExistingElement->lastErr = TRDP_TOPO_ERR;
+            err         = TRDP_TOPO_ERR;
+            informUser  = TRUE;
+        }
+    }
+
+    if ((pExistingElement != NULL) &&
+        (informUser == TRUE))
+    {
+        /*  If a callback was provided, call it now */
+        if ((pExistingElement->pktFlags & TRDP_FLAGS_CALLBACK)
+            && ((pExistingElement->pfCbFunction != NULL) || (appHandle->pfBatchCb != NULL)))
+        {
+            TRDP_PD_INFO_T  theMessage;
+            UINT8           *pData;
+            UINT32          dataSize;
+            memset(&theMessage, 0, sizeof(TRDP_PD_INFO_T));
+
+            theMessage.comId        = pExistingElement->addr.comId;
+            theMessage.srcIpAddr    = pExistingElement->lastSrcIP;
+            theMessage.destIpAddr   = subAddresses.destIpAddr;
+            theMessage.msgType      = msgType;
+            theMessage.seqCount     = pExistingElement->curSeqCnt;
+            theMessage.pUserRef     = pExistingElement->pUserRef; /* User reference given with the local subscribe? */
+            theMessage.resultCode   = err;
+            theMessage.rxTime       = rxTime;
+            theMessage.changeMask   = pExistingElement->changeMask;
+
+#ifdef TSN_SUPPORT
+            if (TRUE == isTSN)
+            {
+                theMessage.etbTopoCnt   = 0u;
+                theMessage.opTrnTopoCnt = 0u;
+                theMessage.replyComId   = 0u;
+                theMessage.replyIpAddr  = VOS_INADDR_ANY;
+                theMessage.protVersion  = pTSNFrameHead->protocolVersion;
+                theMessage.serviceId    = pTSNFrameHead->reserved;
+                pData       = ((PD2_PACKET_T *)pExistingElement->pFrame)->data;
+                dataSize    = (UINT32) vos_ntohs(((PD2_PACKET_T *)pExistingElement->pFrame)->frameHead.datasetLength);
+            }
+            else
+#endif
+            {
+                theMessage.etbTopoCnt   = vos_ntohl(pExistingElement->pFrame->frameHead.etbTopoCnt);
+                theMessage.opTrnTopoCnt = vos_ntohl(pExistingElement->pFrame->frameHead.opTrnTopoCnt);
+                theMessage.protVersion  = vos_ntohs(pExistingElement->pFrame->frameHead.protocolVersion);
+                theMessage.replyComId   = vos_ntohl(pExistingElement->pFrame->frameHead.replyComId);
+                theMessage.replyIpAddr  = vos_ntohl(pExistingElement->pFrame->frameHead.replyIpAddress);
+                theMessage.serviceId    = vos_ntohl(pExistingElement->pFrame->frameHead.reserved);
+                pData       = pExistingElement->pFrame->data;
+                dataSize    = vos_ntohl(pExistingElement->pFrame->frameHead.datasetLength);
+            }
+
+            /*  Report it at the end of the receive pass or, with a callback pool, let one of its threads call back */
+            if (((appHandle->pfBatchCb == NULL) ||
+                 (trdp_pdBatchAdd(appHandle, pExistingElement, &theMessage, pData, dataSize) == FALSE)) &&
+                (trdp_pdCbPost(appHandle, pExistingElement, &theMessage, pData, dataSize) == FALSE) &&
+                (pExistingElement->pfCbFunction != NULL))
+            {
+                if (pHisto != NULL)
+                {
+                    vos_getTime(&cbTime);
+                    trdp_histoAddTime(&pHisto->histo.cbLatency, &rxTime, &cbTime);
+                }
+
+                /*  tlp_unsubscribe() from within the callback clears pCbSub, the element is gone then  */
+                appHandle->pCbSub = pExistingElement;
+                pExistingElement->pfCbFunction(appHandle->pdDefault.pRefCon,
+                                               appHandle,
+                                               &theMessage,
+                                               pData,
+                                               dataSize);
+
+                if ((pHisto != NULL) &&
+                    (appHandle->pCbSub != NULL))
+                {
+                    TRDP_TIME_T now;
+                    vos_getTime(&now);
+                    trdp_histoAddTime(&pHisto->histo.cbExec, &cbTime, &now);
+                }
+                appHandle->pCbSub = NULL;
+            }
+        }
+    }
+    return err;
+}
+
+/******************************************************************************/
+/** Receiving PD messages
+ *  Read the receive socket for arriving PDs into the session's receive frame and process it
+ *
+ *  @param[in]      appHandle           session pointer
+ *  @param[in]      sock                the socket to read from
+ *
+ *  @retval         TRDP_NO_ERR         no error
+ *  @retval         TRDP_PARAM_ERR      parameter error
+ *  @retval         TRDP_WIRE_ERR       protocol error (late packet, version mismatch)
+ *  @retval         TRDP_QUEUE_ERR      not in queue
+ *  @retval         TRDP_CRC_ERR        header checksum
+ *  @retval         TRDP_TOPOCOUNT_ERR  invalid topocount
+ */
+TRDP_ERR_T  trdp_pdReceive (
+    TRDP_SESSION_PT appHandle,
+    SOCKET          sock)
+{
+    TRDP_ERR_T      err;
+    UINT32          recSize     = TRDP_MAX_PD_PACKET_SIZE;
+    TRDP_IP_ADDR_T  srcIpAddr   = 0u;
+    TRDP_IP_ADDR_T  destIpAddr  = 0u;
+    TRDP_TIME_T     rxTime;
+
+    /*  Get the packet from the wire together with its arrival time:  */
+    err = (TRDP_ERR_T) vos_sockReceiveUDPStamped(sock,
+                                                 (UINT8 *) &appHandle->pNewFrame->frameHead,
+                                                 &recSize,
+                                                 &srcIpAddr,
+                                                 NULL,
+                                                 &destIpAddr,
+                                                 &rxTime,
+                                                 FALSE);
+    if ( err != TRDP_NO_ERR)
+    {
+        return err;
+    }
+    return trdp_pdProcessFrame(appHandle, appHandle->pNewFrame, recSize, srcIpAddr, destIpAddr, &rxTime);
+}
+
+#ifdef XDP_SUPPORT
+/******************************************************************************/
+/** Set the descriptor of the AF_XDP socket, PD redirected to it arrives there
+ *
+ *  @param[in]      appHandle           session pointer
+ *  @param[in,out]  pFileDesc           pointer to set of ready descriptors
+ *  @param[in,out]  pNoDesc             pointer to number of ready descriptors
+ */
+void trdp_pdCheckPendingXdp (
+    TRDP_SESSION_PT appHandle,
+    TRDP_FDS_T      *pFileDesc,
+    INT32           *pNoDesc)
+{
+    if (appHandle->pdXsk != NULL)
+    {
+        SOCKET xskSock = vos_xskSocket(appHandle->pdXsk);
+
+        FD_SET(xskSock, (fd_set *)pFileDesc);       /*lint !e573 !e505 signed/unsigned division in macro */
+        if (xskSock > *pNoDesc)
+        {
+            *pNoDesc = (INT32) xskSock;
+        }
+    }
+}
+
+/******************************************************************************/
+/** Receiving PD messages from the AF_XDP socket
+ *  The packets are processed in place, in the receive buffer of the socket, and given back afterwards.
+ *
+ *  @param[in]      appHandle           session pointer
+ *
+ *  @retval         TRDP_NO_ERR         no error
+ *  @retval         TRDP_NODATA_ERR     nothing received
+ */
+TRDP_ERR_T  trdp_pdReceiveXdp (
+    TRDP_SESSION_PT appHandle)
+{
+    VOS_XSK_FRAME_T frames[TRDP_XDP_RX_BATCH];
+    UINT32          noOfFrames  = TRDP_XDP_RX_BATCH;
+    UINT32          i;
+    TRDP_TIME_T     rxTime;
+    TRDP_ERR_T      err;
+
+    err = (TRDP_ERR_T) vos_xskReceive(appHandle->pdXsk, frames, &noOfFrames);
+    if (err != TRDP_NO_ERR)
+    {
+        return err;
+    }
+    vos_getTime(&rxTime);
+    for (i = 0u; i < noOfFrames; i++)
+    {
+        if (frames[i].pData != NULL)
+        {
+            err = trdp_pdProcessFrame(appHandle, (PD_PACKET_T *) frames[i].pData, frames[i].size,
+                                      frames[i].srcIpAddr, frames[i].dstIpAddr, &rxTime);
+            if ((err != TRDP_NO_ERR) && (err != TRDP_NOSUB_ERR))
+            {
+                vos_printLog(VOS_LOG_INFO, "trdp_pdProcessFrame() failed (Err: %d)\n", err);
+            }
+        }
+        else
+        {
+            appHandle->stats.pd.numProtErr++;
+        }
+    }
+    vos_xskRelease(appHandle->pdXsk);
+    return TRDP_NO_ERR;
+}
+#endif
+
+#ifdef URING_SUPPORT
+/******************************************************************************/
+/** Let the io_uring receive on the PD sockets selected so far and wait for the io_uring instead
+ *  Sockets the io_uring cannot receive on are left in the set.
+ *
+ *  @param[in]      appHandle           session pointer
+ *  @param[in,out]  pFileDesc           pointer to set of ready descriptors
+ *  @param[in,out]  pNoDesc             pointer to number of ready descriptors
+ */
+void trdp_pdCheckPendingUring (
+    TRDP_SESSION_PT appHandle,
+    TRDP_FDS_T      *pFileDesc,
+    INT32           *pNoDesc)
+{
+    SOCKET  uringSock;
+    INT32   idx;
+
+    if (appHandle->pdUring == NULL)
+    {
+        return;
+    }
+    for (idx = 0; idx < trdp_getCurrentMaxSocketCnt(TRDP_SOCK_PD); idx++)
+    {
+        SOCKET sock = appHandle->ifacePD[idx].sock;
+
+        if ((sock != VOS_INVALID_SOCKET) &&
+            FD_ISSET(sock, (fd_set *)pFileDesc) &&                  /*lint !e573 signed/unsigned division in macro */
+            (vos_uringArm(appHandle->pdUring, sock) == VOS_NO_ERR))
+        {
+            FD_CLR(sock, (fd_set *)pFileDesc);                      /*lint !e502 !e573 !e505
+                                                                       signed/unsigned division in macro */
+        }
+    }
+    uringSock = vos_uringSocket(appHandle->pdUring);
+    FD_SET(uringSock, (fd_set *)pFileDesc);         /*lint !e573 !e505 signed/unsigned division in macro */
+    if (uringSock > *pNoDesc)
+    {
+        *pNoDesc = (INT32) uringSock;
+    }
+}
+
+/******************************************************************************/
+/** Receiving PD messages from the io_uring
+ *  The packets are processed in the receive buffers of the io_uring and given back afterwards.
+ *
+ *  @param[in]      appHandle           session pointer
+ *
+ *  @retval         TRDP_NO_ERR         no error
+ *  @retval         TRDP_NODATA_ERR     nothing received
+ */
+TRDP_ERR_T  trdp_pdReceiveUring (
+    TRDP_SESSION_PT appHandle)
+{
+    VOS_URING_FRAME_T   frames[TRDP_URING_RX_BATCH];
+    UINT32              noOfFrames  = TRDP_URING_RX_BATCH;
+    UINT32              i;
+    TRDP_ERR_T          err;
+
+    err = (TRDP_ERR_T) vos_uringReceive(appHandle->pdUring, frames, &noOfFrames);
+    if (err != TRDP_NO_ERR)
+    {
+        return err;
+    }
+    for (i = 0u; i < noOfFrames; i++)
+    {
+        if (frames[i].pData != NULL)
+        {
+            err = trdp_pdProcessFrame(appHandle, (PD_PACKET_T *) frames[i].pData, frames[i].size,
+                                      frames[i].srcIpAddr, frames[i].dstIpAddr, &frames[i].rxTime);
+            if ((err != TRDP_NO_ERR) && (err != TRDP_NOSUB_ERR))
+            {
+                vos_printLog(VOS_LOG_INFO, "trdp_pdProcessFrame() failed (Err: %d)\n", err);
+            }
+        }
+        else
+        {
+            appHandle->stats.pd.numProtErr++;
+        }
+    }
+    vos_uringRelease(appHandle->pdUring);
+    return TRDP_NO_ERR;
+}
+#endif
+
+/******************************************************************************/
+/** Check for pending packets, set FD if non blocking
+ *
+ *  @param[in]      appHandle           session pointer
+ *  @param[in,out]  pFileDesc           pointer to set of ready descriptors
+ *  @param[in,out]  pNoDesc             pointer to number of ready descriptors
+ *  @param[in]      checkSend           check send queue, too
+ */
+void trdp_pdCheckPending (
+    TRDP_APP_SESSION_T  appHandle,
+    TRDP_FDS_T          *pFileDesc,
+    INT32               *pNoDesc,
+    int                 checkSend)
+{
+    PD_ELE_T    *iterPD;
+    TRDP_TIME_T lookahead;
+
+    /*    Walk over the registered PDs, find pending packets */
+
+    vos_clearTime(&appHandle->nextJob);
+
+    /*    Find the packet which has to be received next:    */
+    for (iterPD = appHandle->pRcvQueue; iterPD != NULL; iterPD = iterPD->pNext)
+    {
+        if ((!(iterPD->privFlags & TRDP_TIMED_OUT)) &&              /* Exempt already timed-out packet */
+            timerisset(&iterPD->interval) &&                        /* not PD PULL?                    */
+            (timercmp(&iterPD->timeToGo, &appHandle->nextJob, <) || /* earlier than current time-out?  */
+             !timerisset(&appHandle->nextJob)))                     /* or not set at all?              */
         {
-            /* send only if there is valid data */
-            if (!(iterPD->privFlags & TRDP_INVALID_DATA))
+            appHandle->nextJob = iterPD->timeToGo;                  /* set new next time value from queue element */
+        }
+
+        /*    Check and set the socket file descriptor, if not already done    */
+        if (iterPD->socketIdx != -1 &&
+            appHandle->ifacePD[iterPD->socketIdx].sock != -1 &&
+            !FD_ISSET(appHandle->ifacePD[iterPD->socketIdx].sock, (fd_set *)pFileDesc))     /*lint !e573 !e505
+                                                                                          signed/unsigned division in macro /
+                                                                                          Redundant left argument to comma */
+        {
+            FD_SET(appHandle->ifacePD[iterPD->socketIdx].sock, (fd_set *)pFileDesc);       /*lint !e573 !e505
+                                                                                          signed/unsigned division in macro /
+                                                                                          Redundant left argument to comma */
+            if (appHandle->ifacePD[iterPD->socketIdx].sock > *pNoDesc)
             {
-                if ((iterPD->privFlags & TRDP_REQ_2B_SENT) &&
-                    (iterPD->pFrame->frameHead.msgType == vos_htons(TRDP_MSG_PD)))       /*  PULL packet?  */
-                {
-                    iterPD->pFrame->frameHead.msgType = vos_htons(TRDP_MSG_PP);
-                }
-                /*  Update the sequence counter and re-compute CRC    */
-                trdp_pdUpdate(iterPD);
+                *pNoDesc = (INT32) appHandle->ifacePD[iterPD->socketIdx].sock;
+            }
+        }
+    }
 
-                /* Publisher check from Table A.5:
-                   Actual topography counter values <-> Locally stored with publish */
-                if ( !trdp_validTopoCounters( appHandle->etbTopoCnt,
-                                              appHandle->opTrnTopoCnt,
-                                              vos_ntohl(iterPD->pFrame->frameHead.etbTopoCnt),
-                                              vos_ntohl(iterPD->pFrame->frameHead.opTrnTopoCnt)))
+#ifdef XDP_SUPPORT
+    trdp_pdCheckPendingXdp(appHandle, pFileDesc, pNoDesc);
+#endif
+#ifdef URING_SUPPORT
+    trdp_pdCheckPendingUring(appHandle, pFileDesc, pNoDesc);
+#endif
+
+    if (checkSend)
+    {
+        trdp_pdTxLookahead(appHandle, &lookahead);
+
+        /*    Find packet in send queue which evntually has to be sent earlier:    */
+        for (iterPD = appHandle->pSndQueue; iterPD != NULL; iterPD = iterPD->pNext)
+        {
+            TRDP_TIME_T sendTime = iterPD->timeToGo;
+
+            /* txTime packets must be handed to the kernel ahead of their launch time */
+            if ((iterPD->socketIdx != TRDP_INVALID_SOCKET_INDEX) &&
+                (trdp_pdLaunchAhead(&appHandle->ifacePD[iterPD->socketIdx]) == TRUE) &&
+                (vos_cmpTime(&sendTime, &lookahead) > 0))
+            {
+                vos_subTime(&sendTime, &lookahead);
+            }
+            if (timerisset(&iterPD->interval) &&                        /* has a time out value?    */
+                (timercmp(&sendTime, &appHandle->nextJob, <) ||         /* earlier than current time-out? */
+                 !timerisset(&appHandle->nextJob)))
+            {
+                appHandle->nextJob = sendTime;                          /* set new next time value from queue element */
+            }
+        }
+    }
+}
+
+/******************************************************************************/
+/** Check for time outs
+ *
+ *  @param[in]      appHandle         application handle
+ */
+void trdp_pdHandleTimeOuts (
+    TRDP_SESSION_PT appHandle)
+{
+    PD_ELE_T *iterPD = NULL;
+
+    /*    Examine receive queue for late packets    */
+    for (iterPD = appHandle->pRcvQueue; iterPD != NULL; iterPD = iterPD->pNext)
+    {
+        trdp_handleTimeout(appHandle, iterPD);
+    }
+}
+
+/******************************************************************************/
+/** Check a packet for timeout packet
+ *  Call user's callback, if necessary
+ *
+ *  @param[in]      appHandle       Session handle
+ *  @param[in]      pPacket         pointer to the packet element to check
+ */
+void trdp_handleTimeout (
+    TRDP_SESSION_PT appHandle,
+    PD_ELE_T        *pPacket)
+{
+    TRDP_TIME_T now;
+
+    /*    Update the current time    */
+    vos_getTime(&now);
+
+    if (timerisset(&pPacket->interval) &&
+        timerisset(&pPacket->timeToGo) &&                        /*  Prevent timing out of PULLed data too early */
+        !timercmp(&pPacket->timeToGo, &now, >) &&                /*  late?   */
+        !(pPacket->privFlags & TRDP_TIMED_OUT) &&                /*  and not already flagged ?   */
+        !(pPacket->addr.comId == TRDP_STATISTICS_PULL_COMID)) /*  Do not bother user with statistics timeout */
+    {
+        /*  Update some statistics  */
+        appHandle->stats.pd.numTimeout++;
+        pPacket->lastErr = TRDP_TIMEOUT_ERR;
+
+        /* Packet is late! We inform the user about this:    */
+        if ((pPacket->pfCbFunction != NULL) ||
+            ((appHandle->pfBatchCb != NULL) && ((pPacket->pktFlags & TRDP_FLAGS_CALLBACK) != 0u)))
+        {
+            BOOL8 toBatch = ((appHandle->pfBatchCb != NULL) && ((pPacket->pktFlags & TRDP_FLAGS_CALLBACK) != 0u));
+            TRDP_PD_INFO_T theMessage;
+            memset(&theMessage, 0, sizeof(TRDP_PD_INFO_T));
+            theMessage.comId        = pPacket->addr.comId;
+            theMessage.srcIpAddr    = pPacket->addr.srcIpAddr;
+            theMessage.destIpAddr   = pPacket->addr.destIpAddr;
+            theMessage.pUserRef     = pPacket->pUserRef;
+            theMessage.resultCode   = TRDP_TIMEOUT_ERR;
+            theMessage.rxTime       = pPacket->rxTime;      /* arrival of the last valid packet */
+            if (pPacket->pFrame != NULL)
+            {
+#ifdef TSN_SUPPORT
+                if (pPacket->privFlags & TRDP_IS_TSN)
                 {
-                    err = TRDP_TOPO_ERR;
-                    vos_printLogStr(VOS_LOG_INFO, "Sending PD: TopoCount is out of date!\n");
+                    PD2_PACKET_T *pFrame = (PD2_PACKET_T *) pPacket->pFrame;
+                    theMessage.msgType      = (TRDP_MSG_T)pFrame->frameHead.msgType;
+                    theMessage.seqCount     = vos_ntohl(pFrame->frameHead.sequenceCounter);
+                    theMessage.protVersion  = pFrame->frameHead.protocolVersion;
                 }
-                /*    In case we're sending on an uninitialized publisher; should never happen. */
-                else if (iterPD->socketIdx == TRDP_INVALID_SOCKET_INDEX)
+                else
+#endif
                 {
-                    vos_printLogStr(VOS_LOG_ERROR, "Sending PD: Socket invalid!\n");
-                    /* Try to send the other packets */
+                    theMessage.etbTopoCnt   = vos_ntohl(pPacket->pFrame->frameHead.etbTopoCnt);
+                    theMessage.opTrnTopoCnt = vos_ntohl(pPacket->pFrame->frameHead.opTrnTopoCnt);
+                    theMessage.msgType      = (TRDP_MSG_T) vos_ntohs(pPacket->pFrame->frameHead.msgType);
+                    theMessage.seqCount     = vos_ntohl(pPacket->pFrame->frameHead.sequenceCounter);
+                    theMessage.protVersion  = vos_ntohs(pPacket->pFrame->frameHead.protocolVersion);
+                    theMessage.replyComId   = vos_ntohl(pPacket->pFrame->frameHead.replyComId);
+                    theMessage.replyIpAddr  = vos_ntohl(pPacket->pFrame->frameHead.replyIpAddress);
                 }
-                /*    Send the packet if it is not redundant    */
-                else if (!(iterPD->privFlags & TRDP_REDUNDANT))
+                if (((toBatch == FALSE) ||
+                     (trdp_pdBatchAdd(appHandle, pPacket, &theMessage, pPacket->pFrame->data, pPacket->dataSize) == FALSE))
+                    && (trdp_pdCbPost(appHandle, pPacket, &theMessage, pPacket->pFrame->data, pPacket->dataSize) == FALSE)
+                    && (pPacket->pfCbFunction != NULL))
                 {
-                    TRDP_ERR_T result;
-                    if (iterPD->pfCbFunction != NULL)
-                    {
-                        TRDP_PD_INFO_T theMessage;
-                        theMessage.comId        = iterPD->addr.comId;
-                        theMessage.srcIpAddr    = iterPD->addr.srcIpAddr;
-                        theMessage.destIpAddr   = iterPD->addr.destIpAddr;
-                        theMessage.etbTopoCnt   = vos_ntohl(iterPD->pFrame->frameHead.etbTopoCnt);
-                        theMessage.opTrnTopoCnt = vos_ntohl(iterPD->pFrame->frameHead.opTrnTopoCnt);
-                        theMessage.msgType      = (TRDP_MSG_T) vos_ntohs(iterPD->pFrame->frameHead.msgType);
-                        theMessage.seqCount     = iterPD->curSeqCnt;
-                        theMessage.protVersion  = vos_ntohs(iterPD->pFrame->frameHead.protocolVersion);
-                        theMessage.replyComId   = vos_ntohl(iterPD->pFrame->frameHead.replyComId);
-                        theMessage.replyIpAddr  = vos_ntohl(iterPD->pFrame->frameHead.replyIpAddress);
-                        theMessage.pUserRef     = iterPD->pUserRef; /* User reference given with the local subscribe? */
-                        theMessage.resultCode   = err;
-
-                        iterPD->pfCbFunction(appHandle->pdDefault.pRefCon,
-                                             appHandle,
-                                             &theMessage,
-                                             iterPD->pFrame->data,
-                                             vos_ntohl(iterPD->pFrame->frameHead.datasetLength));
-                    }
-                    /* We pass the error to the application, but we keep on going    */
-                    result = trdp_pdSend(appHandle->ifacePD[iterPD->socketIdx].sock, iterPD, appHandle->pdDefault.port);
-                    if (result == TRDP_NO_ERR)
-                    {
-                        appHandle->stats.pd.numSend++;
-                        iterPD->numRxTx++;
-                    }
-                    else
-                    {
-                        err = result;   /* pass last error to application  */
-                    }
+                    pPacket->pfCbFunction(appHandle->pdDefault.pRefCon,
+                                          appHandle,
+                                          &theMessage,
+                                          pPacket->pFrame->data,
+                                          pPacket->dataSize);
                 }
             }
-
-            if ((iterPD->privFlags & TRDP_REQ_2B_SENT) &&
-                (iterPD->pFrame->frameHead.msgType == vos_htons(TRDP_MSG_PP)))       /*  PULL packet?  */
+            else if (((toBatch == FALSE) ||
+                      (trdp_pdBatchAdd(appHandle, pPacket, &theMessage, NULL, pPacket->dataSize) == FALSE))
+                     && (trdp_pdCbPost(appHandle, pPacket, &theMessage, NULL, pPacket->dataSize) == FALSE)
+                     && (pPacket->pfCbFunction != NULL))
             {
-                /* Do not reset timer, but restore msgType */
-                iterPD->pFrame->frameHead.msgType = vos_htons(TRDP_MSG_PD);
+                pPacket->pfCbFunction(appHandle->pdDefault.pRefCon,
+                                      appHandle,
+                                      &theMessage,
+                                      NULL,
+                                      pPacket->dataSize);
             }
-            else if (timerisset(&iterPD->interval))
+        }
+
+        /*    Prevent repeated time out events    */
+        pPacket->privFlags |= TRDP_TIMED_OUT;
+    }
+}
+
+/**********************************************************************************************************************/
+/** Checking receive connection requests and data
+ *  Call user's callback if needed
+ *
+ *  @param[in]      appHandle           session pointer
+ *  @param[in]      pRfds               pointer to set of ready descriptors
+ *  @param[in,out]  pCount              pointer to number of ready descriptors
+ */
+TRDP_ERR_T   trdp_pdCheckListenSocks (
+    TRDP_SESSION_PT appHandle,
+    TRDP_FDS_T      *pRfds,
+    INT32           *pCount)
+{
+    TRDP_ERR_T result = TRDP_NO_ERR;
+
+    /*  Check the input params, in case we are in polling mode, the application
+     is responsible to get any process data by calling tlp_get()    */
+    if ((pRfds == NULL) || (pCount == NULL))
+    {
+        /* polling mode */
+    }
+    else if ((pCount != NULL) && (*pCount > 0))
+    {
+        /*
+            Check the sockets for received PD packets.
+            Note:   The formaer approach (iterating through all subscriptions) was less than effective, not only for
+                    many subscriptions. Looping through the much small socket list can do the same job.
+                    For version 2, we changed that not only for HIGH_PERF_INDEXED, but also for standard TRDP.
+         */
+        UINT32      idx;
+        TRDP_ERR_T  err;
+        BOOL8       nonBlocking = !(appHandle->option & TRDP_OPTION_BLOCK);
+
+        /*    Check and set the socket file descriptor by going thru the socket list    */
+        for (idx = 0; idx < (UINT32) trdp_getCurrentMaxSocketCnt(TRDP_SOCK_PD); idx++)
+        {
+            if ((appHandle->ifacePD[idx].sock != -1) &&
+                (FD_ISSET(appHandle->ifacePD[idx].sock, (fd_set *) pRfds)))  /*lint !e573 signed/unsigned division in
+                                                                               macro */
             {
-                /*  Set timer if interval was set.
-                    In case of a requested cyclically PD packet, this will lead to one time jump (jitter) in the interval
-                */
-                vos_addTime(&iterPD->timeToGo, &iterPD->interval);
+                VOS_LOG_T logType = VOS_LOG_ERROR;
 
-                if (vos_cmpTime(&iterPD->timeToGo, &now) <= 0)
+                /*  PD frame received? */
+                /*  Compare the received data to the data in our receive queue
+                 Call user's callback if data changed    */
+
+                do
                 {
-                    /* in case of a delay of more than one interval - avoid sending it in the next cycle again */
-                    iterPD->timeToGo = now;
-                    vos_addTime(&iterPD->timeToGo, &iterPD->interval);
-                }
-            }
+                    /* Read as long as data is available */
+                    err = trdp_pdReceive(appHandle, appHandle->ifacePD[idx].sock);
 
-            /* Reset "immediate" flag for request or requested packet */
-            iterPD->privFlags = (TRDP_PRIV_FLAGS_T) (iterPD->privFlags & ~(TRDP_PRIV_FLAGS_T)TRDP_REQ_2B_SENT);
+                }
+                while ((err == TRDP_NO_ERR) && (nonBlocking == TRUE));
 
-            /* remove one shot messages after they have been sent */
-            if (iterPD->pFrame->frameHead.msgType == vos_htons(TRDP_MSG_PR))    /* Ticket #172: remove element */
-            {
-                PD_ELE_T *pTemp;
-                /* Decrease the socket ref */
-                trdp_releaseSocket(appHandle->ifacePD, iterPD->socketIdx, 0u, FALSE, VOS_INADDR_ANY);
-                /* Save next element */
-                pTemp = iterPD->pNext;
-                /* Remove current element */
-                trdp_queueDelElement(&appHandle->pSndQueue, iterPD);
-                iterPD->magic = 0u;
-                if (iterPD->pSeqCntList != NULL)
+                switch (err)
                 {
-                    vos_memFree(iterPD->pSeqCntList);
+                    case TRDP_NO_ERR:
+                    case TRDP_NOSUB_ERR:        /* missing subscription should not lead to extensive error output */
+                    case TRDP_BLOCK_ERR:
+                    case TRDP_NODATA_ERR:       /* ignore would-block or sporadic unsolicited messages */
+                        break;
+                    case TRDP_TOPO_ERR:
+                    case TRDP_TIMEOUT_ERR:
+                    default:
+                        result  = err;
+                        logType = VOS_LOG_WARNING;
+                        vos_printLog(logType, "trdp_pdReceive() failed (Err: %d)\n", err);
+                        break;
                 }
-                vos_memFree(iterPD->pFrame);
-                vos_memFree(iterPD);
+                (*pCount)--;
+                FD_CLR(appHandle->ifacePD[idx].sock, (fd_set *)pRfds); /*lint !e502 !e573 !e505
+                                                                                      signed/unsigned division in macro */
+            }
+        }
 
-                /* pre-set next element */
-                iterPD = pTemp;
-                continue;
+#ifdef XDP_SUPPORT
+        if ((appHandle->pdXsk != NULL) &&
+            (*pCount > 0) &&
+            (FD_ISSET(vos_xskSocket(appHandle->pdXsk), (fd_set *) pRfds)))  /*lint !e573 signed/unsigned division in
+                                                                               macro */
+        {
+            /*  Take the frames in batches until the ring is empty  */
+            while (trdp_pdReceiveXdp(appHandle) == TRDP_NO_ERR)
+            {
+                ;
             }
+            (*pCount)--;
+            FD_CLR(vos_xskSocket(appHandle->pdXsk), (fd_set *)pRfds); /*lint !e502 !e573 !e505
+                                                                                      signed/unsigned division in macro */
         }
-        iterPD = iterPD->pNext;
+#endif
+#ifdef URING_SUPPORT
+        if ((appHandle->pdUring != NULL) &&
+            (*pCount > 0) &&
+            (FD_ISSET(vos_uringSocket(appHandle->pdUring), (fd_set *) pRfds)))  /*lint !e573 signed/unsigned division
+                                                                                   in macro */
+        {
+            /*  Take the completions in batches until there are none left  */
+            while (trdp_pdReceiveUring(appHandle) == TRDP_NO_ERR)
+            {
+                ;
+            }
+            (*pCount)--;
+            FD_CLR(vos_uringSocket(appHandle->pdUring), (fd_set *)pRfds); /*lint !e502 !e573 !e505
+                                                                                      signed/unsigned division in macro */
+        }
+#endif
     }
-    return err;
+    return result;
 }
 
 /******************************************************************************/
-/** Receiving PD messages
- *  Read the receive socket for arriving PDs, copy the packet to a new PD_ELE_T
- *  Check for protocol errors and compare the received data to the data in our receive queue.
- *  If it is a new packet, check if it is a PD Request (PULL).
- *  If it is an update, exchange the existing entry with the new one
- *  Call user's callback if needed
- *
- *  @param[in]      appHandle           session pointer
- *  @param[in]      sock                the socket to read from
+/** Update the header values
  *
- *  @retval         TRDP_NO_ERR         no error
- *  @retval         TRDP_PARAM_ERR      parameter error
- *  @retval         TRDP_WIRE_ERR       protocol error (late packet, version mismatch)
- *  @retval         TRDP_QUEUE_ERR      not in queue
- *  @retval         TRDP_CRC_ERR        header checksum
- *  @retval         TRDP_TOPOCOUNT_ERR  invalid topocount
+ *  @param[in]      pPacket         pointer to the packet to update
  */
-TRDP_ERR_T  trdp_pdReceive (
-    TRDP_SESSION_PT appHandle,
-    SOCKET          sock)
+void    trdp_pdUpdate (
+    PD_ELE_T *pPacket)
 {
-    PD_HEADER_T         *pNewFrameHead      = &appHandle->pNewFrame->frameHead;
-    PD_ELE_T            *pExistingElement   = NULL;
-    PD_ELE_T            *pPulledElement;
-    TRDP_ERR_T          err             = TRDP_NO_ERR;
-    UINT32              recSize         = TRDP_MAX_PD_PACKET_SIZE;
-    int                 informUser      = FALSE;
-    int                 isTSN           = FALSE;
-    TRDP_ADDRESSES_T    subAddresses    = { 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u};
-    TRDP_MSG_T          msgType;
-#ifdef TSN_SUPPORT
-    PD2_HEADER_T        *pTSNFrameHead = (PD2_HEADER_T *) pNewFrameHead;
-#endif
+    UINT32 myCRC;
 
-    /*  Get the packet from the wire:  */
-    err = (TRDP_ERR_T) vos_sockReceiveUDP(sock,
-                                          (UINT8 *) pNewFrameHead,
-                                          &recSize,
-                                          &subAddresses.srcIpAddr,
-                                          NULL,
-                                          &subAddresses.destIpAddr,
-                                          FALSE);
-    if ( err != TRDP_NO_ERR)
+#ifdef TSN_SUPPORT
+    /* If TSN is set, use the smaller header */
+    if (pPacket->privFlags & TRDP_IS_TSN)
     {
-        return err;
-    }
-
-    /*  Is packet sane?    */
-    err = trdp_pdCheck(pNewFrameHead, recSize, &isTSN);
+        PD2_HEADER_T *pFrameHead = (PD2_HEADER_T *) &pPacket->pFrame->frameHead;
 
-    /*  Update statistics   */
-    switch (err)
-    {
-        case TRDP_NO_ERR:
-            appHandle->stats.pd.numRcv++;
-            break;
-        case TRDP_CRC_ERR:
-            appHandle->stats.pd.numCrcErr++;
-            return err;
-        case TRDP_WIRE_ERR:
-            appHandle->stats.pd.numProtErr++;
-            return err;
-        default:
-            return err;
-    }
+        /* increment counter with each telegram */
+        pPacket->curSeqCnt++;
+        pFrameHead->sequenceCounter = vos_htonl(pPacket->curSeqCnt);
 
-#ifdef TSN_SUPPORT
-    if (TRUE == isTSN)
-    {
-        /*  Compute the subscription handle */
-        subAddresses.comId          = vos_ntohl(pTSNFrameHead->comId);
-        subAddresses.etbTopoCnt     = 0u;   /* they do not matter */
-        subAddresses.opTrnTopoCnt   = 0u;
-        subAddresses.serviceId      = vos_ntohl(pTSNFrameHead->reserved);
-        msgType = pTSNFrameHead->msgType;
+        /* Compute CRC32   */
+        myCRC = vos_crc32(INITFCS, (UINT8 *)pFrameHead, sizeof(PD2_HEADER_T) - SIZE_OF_FCS);
+        pFrameHead->frameCheckSum = MAKE_LE(myCRC);
     }
-    else    /* no PULL on TSN */
+    else
 #endif
     {
-        /* First check incoming packet's topoCounts against session topoCounts */
-        /* First subscriber check from Table A.5:
-         Actual topography counter values <-> Topography counters of received */
-        if ( !trdp_validTopoCounters( appHandle->etbTopoCnt,
-                                      appHandle->opTrnTopoCnt,
-                                      vos_ntohl(pNewFrameHead->etbTopoCnt),
-                                      vos_ntohl(pNewFrameHead->opTrnTopoCnt)))
+        /* increment counter with each telegram */
+        if (pPacket->pFrame->frameHead.msgType == vos_htons(TRDP_MSG_PP))
         {
-            appHandle->stats.pd.numTopoErr++;
-            return TRDP_TOPO_ERR;
+            pPacket->curSeqCnt4Pull++;
+            pPacket->pFrame->frameHead.sequenceCounter = vos_htonl(pPacket->curSeqCnt4Pull);
+        }
+        else
+        {
+            pPacket->curSeqCnt++;
+            pPacket->pFrame->frameHead.sequenceCounter = vos_htonl(pPacket->curSeqCnt);
         }
 
-        /*  Compute the subscription handle */
-        subAddresses.comId          = vos_ntohl(pNewFrameHead->comId);
-        subAddresses.etbTopoCnt     = vos_ntohl(pNewFrameHead->etbTopoCnt);
-        subAddresses.opTrnTopoCnt   = vos_ntohl(pNewFrameHead->opTrnTopoCnt);
-        subAddresses.serviceId      = vos_ntohl(pNewFrameHead->reserved);
-        msgType = vos_ntohs(pNewFrameHead->msgType);
-
-
+        /* Compute CRC32   */
+        myCRC = vos_crc32(INITFCS, (UINT8 *)&pPacket->pFrame->frameHead, sizeof(PD_HEADER_T) - SIZE_OF_FCS);
+        pPacket->pFrame->frameHead.frameCheckSum = MAKE_LE(myCRC);
     }
+}
 
-    /*  Examine subscription queue, are we interested in this PD?   */
-#ifdef HIGH_PERF_INDEXED
-    if ((appHandle->pSlot == NULL) ||
-        (appHandle->pSlot->noOfRxEntries == 0))
+/******************************************************************************/
+/** Hot standby: advance the sequence counter of a follower without touching the frame.
+ *  The frame is stamped by trdp_pdUpdate() once the group is leader again.
+ *
+ *  @param[in]      pPacket         pointer to the packet to skip
+ */
+void    trdp_pdSkip (
+    PD_ELE_T *pPacket)
+{
+#ifdef TSN_SUPPORT
+    if (pPacket->privFlags & TRDP_IS_TSN)
     {
-        /*  If not set up until now, we issue a warning, but handle the data...   */
-        vos_printLogStr(VOS_LOG_WARNING, "Receiving PD while tlc_updateSession() not yet called or rcvIdx empty.\n");
-        pExistingElement = trdp_queueFindSubAddr(appHandle->pRcvQueue, &subAddresses);
+        pPacket->curSeqCnt++;
     }
     else
-    {
-        /*  This is the fast, indexed access to our subscriptions!   */
-        pExistingElement = trdp_indexedFindSubAddr(appHandle, &subAddresses);
-    }
-#else
-    pExistingElement = trdp_queueFindSubAddr(appHandle->pRcvQueue, &subAddresses);
 #endif
-
-    if (pExistingElement == NULL)
+    if (pPacket->pFrame->frameHead.msgType == vos_htons(TRDP_MSG_PP))
     {
-        /*
-         vos_printLog(VOS_LOG_INFO, "No subscription (SrcIp: %s comId %u)\n", vos_ipDotted(subAddresses.srcIpAddr),
-         vos_ntohl(pNewFrame->frameHead.comId));
-         */
-        err = TRDP_NOSUB_ERR;
+        pPacket->curSeqCnt4Pull++;
     }
     else
     {
-        /*  We check for local communication
-         or if etbTopoCnt and opTrnTopoCnt of the subscription are zero or match */
-        if (((subAddresses.etbTopoCnt == 0) && (subAddresses.opTrnTopoCnt == 0))
-            ||
-            trdp_validTopoCounters(subAddresses.etbTopoCnt,             /* For TSN, topocounts do not matter */
-                                   subAddresses.opTrnTopoCnt,
-                                   pExistingElement->addr.etbTopoCnt,
-                                   pExistingElement->addr.opTrnTopoCnt))
-        {
-            UINT32 newSeqCnt = vos_ntohl(pNewFrameHead->sequenceCounter);   /* same location for PD and PD2 */
-            /* Save the source IP address of the received packet */
-            pExistingElement->lastSrcIP = subAddresses.srcIpAddr;
-            /* Save the real destination of the received packet (own IP or MC group) */
-            pExistingElement->addr.destIpAddr = subAddresses.destIpAddr;
+        pPacket->curSeqCnt++;
+    }
+}
+
+/******************************************************************************/
+/** Check if the PD header values and the CRCs are sane
+ *
+ *  @param[in]      pPacket         pointer to the packet to check
+ *  @param[in]      packetSize      max size to check
+ *  @param[out]     pIsTSN          set to TRUE on return if PD2 frame
+ *
+ *  @retval         TRDP_NO_ERR
+ *  @retval         TRDP_CRC_ERR
+ */
+TRDP_ERR_T trdp_pdCheck (
+    PD_HEADER_T *pPacket,
+    UINT32      packetSize,
+    int         *pIsTSN)
+{
+    UINT32          myCRC;
+    TRDP_ERR_T      err = TRDP_NO_ERR;
 
+#ifdef TSN_SUPPORT
+    PD2_HEADER_T    *pPacket2 = (PD2_HEADER_T *) pPacket;
 
-            if ((newSeqCnt == 0u) ||                                /* restarted or new sender  */
-                (pExistingElement->privFlags & TRDP_TIMED_OUT))     /* or timed out before      */
+    /*  Check for TSN small header first    */
+    if (pPacket2->protocolVersion == 0x2)
+    {
+        *pIsTSN = TRUE;
+        if ((packetSize < TRDP_MIN_PD2_HEADER_SIZE) ||
+            (packetSize > TRDP_MAX_PD2_PACKET_SIZE))
+        {
+            vos_printLog(VOS_LOG_INFO, "PDframe size error (%u))\n", packetSize);
+            err = TRDP_WIRE_ERR;
+        }
+        else
+        {
+            /*    Check Header CRC (FCS)  */
+            myCRC = vos_crc32(INITFCS, (UINT8 *) pPacket2, sizeof(PD2_HEADER_T) - SIZE_OF_FCS);
+
+            if (pPacket2->frameCheckSum != MAKE_LE(myCRC))
             {
-                trdp_resetSequenceCounter(pExistingElement, subAddresses.srcIpAddr,
-                                          (TRDP_MSG_T) vos_ntohs(pNewFrameHead->msgType));
+                vos_printLog(VOS_LOG_INFO, "PDframe crc error (%08x != %08x))\n", pPacket2->frameCheckSum,
+                             MAKE_LE(myCRC));
+                err = TRDP_CRC_ERR;
             }
+            /*  Check type  */
+            else if ((pPacket2->msgType != TRDP_MSG_TSN_PD) &&
+                     (pPacket2->msgType != TRDP_MSG_TSN_PD_SDT) &&
+                     (pPacket2->msgType != TRDP_MSG_TSN_PD_MSDT) &&
+                     (pPacket2->msgType != TRDP_MSG_TSN_PD_RES))
+            {
+                vos_printLog(VOS_LOG_INFO, "PDframe type error, received %02x\n", pPacket2->msgType);
+                err = TRDP_WIRE_ERR;
+            }
+            /*  Check size  */
+            else if (vos_ntohs(pPacket2->datasetLength) > TRDP_MAX_PD2_DATA_SIZE)
+            {
+                vos_printLog(VOS_LOG_INFO, "PDframe datalength error, received %04x\n", pPacket2->msgType);
+                err = TRDP_WIRE_ERR;
+            }
+        }
+    }
+    else
+#endif
+    {   /* Version 1 TRDP (non-TSN) */
+        *pIsTSN = FALSE;
+        /*  Check size    */
+        if ((packetSize < TRDP_MIN_PD_HEADER_SIZE) ||
+            (packetSize > TRDP_MAX_PD_PACKET_SIZE))
+        {
+            vos_printLog(VOS_LOG_INFO, "PDframe size error (%u))\n", packetSize);
+            err = TRDP_WIRE_ERR;
+        }
+        else
+        {
+            /*    Check Header CRC (FCS)  */
+            myCRC = vos_crc32(INITFCS, (UINT8 *) pPacket, sizeof(PD_HEADER_T) - SIZE_OF_FCS);
 
-            /* find sender in our list */
-            switch (trdp_checkSequenceCounter(pExistingElement,
-                                              newSeqCnt,
-                                              subAddresses.srcIpAddr,
-                                              (TRDP_MSG_T) vos_ntohs(pNewFrameHead->msgType)))
+            if (pPacket->frameCheckSum != MAKE_LE(myCRC))
             {
-                case 0:                      /* Sequence counter is valid (at least 1 higher than previous one) */
-                    break;
-                case -1:                     /* List overflow */
-                    return TRDP_MEM_ERR;
-                case 1:
-                    vos_printLog(VOS_LOG_INFO, "Old PD data ignored (SrcIp: %s comId %u)\n", vos_ipDotted(
-                                     subAddresses.srcIpAddr), vos_ntohl(pNewFrameHead->comId));
-                    return TRDP_NO_ERR;      /* Ignore packet, too old or duplicate */
+                vos_printLog(VOS_LOG_INFO, "PDframe crc error (%08x != %08x))\n", pPacket->frameCheckSum, MAKE_LE(myCRC));
+                err = TRDP_CRC_ERR;
             }
-
-            if ((newSeqCnt > 0u) && (newSeqCnt > (pExistingElement->curSeqCnt + 1u)))
+            /*  Check protocol version  */
+            else if (((vos_ntohs(pPacket->protocolVersion) & TRDP_PROTOCOL_VERSION_CHECK_MASK)
+                      != (TRDP_PROTO_VER & TRDP_PROTOCOL_VERSION_CHECK_MASK)) ||
+                     (vos_ntohl(pPacket->datasetLength) > TRDP_MAX_PD_DATA_SIZE))
             {
-                pExistingElement->numMissed += newSeqCnt - pExistingElement->curSeqCnt - 1u;
+                vos_printLog(VOS_LOG_INFO, "PDframe protocol error (%04x != %04x))\n",
+                             vos_ntohs(pPacket->protocolVersion),
+                             TRDP_PROTO_VER);
+                err = TRDP_WIRE_ERR;
             }
-            else if (pExistingElement->curSeqCnt > newSeqCnt)
+            /*  Check type  */
+            else if ((vos_ntohs(pPacket->msgType) != (UINT16) TRDP_MSG_PD) &&
+                     (vos_ntohs(pPacket->msgType) != (UINT16) TRDP_MSG_PP) &&
+                     (vos_ntohs(pPacket->msgType) != (UINT16) TRDP_MSG_PR) &&
+                     (vos_ntohs(pPacket->msgType) != (UINT16) TRDP_MSG_PE))
             {
-                pExistingElement->numMissed += UINT32_MAX - pExistingElement->curSeqCnt + newSeqCnt;
+                vos_printLog(VOS_LOG_INFO, "PDframe type error, received %04x\n", vos_ntohs(pPacket->msgType));
+                err = TRDP_WIRE_ERR;
             }
+        }
+    }
+    return err;
+}
 
-            /* Store last received sequence counter here, too (pd_get et. al. may access it).   */
-            pExistingElement->curSeqCnt = vos_ntohl(pNewFrameHead->sequenceCounter);
-
-            /*  This might have not been set!   */
-            pExistingElement->dataSize  = vos_ntohl(pNewFrameHead->datasetLength);
-            pExistingElement->grossSize = trdp_packetSizePD(pExistingElement->dataSize);
 
-            if (TRUE == isTSN)
-            {
-                informUser = TRUE;
-            }
-            /*  Has the data changed?   */
-            else if (pExistingElement->pktFlags & TRDP_FLAGS_CALLBACK)
-            {
-                if ((pExistingElement->pktFlags & TRDP_FLAGS_FORCE_CB) ||
-                    (pExistingElement->privFlags & TRDP_TIMED_OUT))
-                {
-                    informUser = TRUE;                 /* Inform user anyway */
-                }
-                else if (0 != memcmp(appHandle->pNewFrame->data,
-                                     pExistingElement->pFrame->data,
-                                     pExistingElement->dataSize))
-                {
-                    informUser = TRUE;
-                }
-            }
+/******************************************************************************/
+/** Send one PD packet
+ *
+ *  @param[in]      pIface          socket to send on
+ *  @param[in]      pPacket         pointer to packet to be sent
+ *  @param[in]      port            port on which to send
+ *  @param[in]      pLaunchTime     launch time (txTime sockets only) or NULL
+ *
+ *  @retval         TRDP_NO_ERR
+ *  @retval         TRDP_IO_ERR
+ */
+TRDP_ERR_T  trdp_pdSend (
+    TRDP_SOCKETS_T      *pIface,
+    PD_ELE_T            *pPacket,
+    UINT16              port,
+    const TRDP_TIME_T   *pLaunchTime)
+{
+    VOS_ERR_T   err     = VOS_NO_ERR;
+    UINT32      destIp  = pPacket->addr.destIpAddr;
+    UINT32      stampId = 0u;
+    BOOL8       keyed   = FALSE;
+    TRDP_TIME_T now;
 
-            /*  Get the current time and compute the next time this packet should be received.  */
-            vos_getTime(&pExistingElement->timeToGo);
-            vos_addTime(&pExistingElement->timeToGo, &pExistingElement->interval);
+    /*  check for temporary address (PD PULL):  */
+    if (pPacket->pullIpAddress != 0u)
+    {
+        destIp = pPacket->pullIpAddress;
+        pPacket->pullIpAddress = 0u;
+    }
 
-            /*  Update some statistics  */
-            pExistingElement->numRxTx++;
-            pExistingElement->lastErr   = TRDP_NO_ERR;
-            pExistingElement->privFlags =
-                (TRDP_PRIV_FLAGS_T) (pExistingElement->privFlags & ~(TRDP_PRIV_FLAGS_T)TRDP_TIMED_OUT);
+    pPacket->sendSize = pPacket->grossSize;
 
-            /* mark the data as valid */
-            pExistingElement->privFlags =
-                (TRDP_PRIV_FLAGS_T) (pExistingElement->privFlags & ~(TRDP_PRIV_FLAGS_T)TRDP_INVALID_DATA);
+    if (pIface->pTxStampRef != NULL)
+    {
+        const TRDP_TIME_T *pTxTime = NULL;
 
-            /*  remove the old one, insert the new one  */
-            /*  -> always swap the frame pointers              */
+        if ((pLaunchTime != NULL) && (trdp_pdLaunchAhead(pIface) == TRUE))
+        {
+            /*  Without a verifying TX timestamp for a while we cannot tell whether the packets leave on time  */
+            if ((pIface->launchState == TRDP_LAUNCH_UNKNOWN) && (++pIface->launchProbes > TRDP_LAUNCH_PROBES))
             {
-                PD_PACKET_T *pTemp = pExistingElement->pFrame;
-                pExistingElement->pFrame    = appHandle->pNewFrame;
-                appHandle->pNewFrame        = pTemp;
+                pIface->launchState = TRDP_LAUNCH_IGNORED;
+                vos_printLog(VOS_LOG_WARNING,
+                             "No TX timestamps on socket %d, launch times cannot be verified: sending at due time\n",
+                             (int) pIface->sock);
             }
+            pTxTime = pLaunchTime;
+        }
+        stampId = pIface->txStampId++;
+        err     = vos_sockSendUDPAt(pIface->sock,
+                                    (UINT8 *)&pPacket->pFrame->frameHead,
+                                    &pPacket->sendSize,
+                                    destIp,
+                                    port,
+                                    pTxTime,
+                                    stampId,
+                                    &keyed);
+    }
+    else
+    {
+        err = vos_sockSendUDP(pIface->sock,
+                              (UINT8 *)&pPacket->pFrame->frameHead,
+                              &pPacket->sendSize,
+                              destIp,
+                              port);
+    }
 
-            /*  It might be a PULL request      */
-            if (vos_ntohs(pNewFrameHead->msgType) == (UINT16) TRDP_MSG_PR)
-            {
-                /*  Handle statistics request  */
-                if (vos_ntohl(pNewFrameHead->comId) == TRDP_STATISTICS_PULL_COMID)
-                {
-                    pPulledElement = trdp_queueFindComId(appHandle->pSndQueue, TRDP_GLOBAL_STATS_REPLY_COMID);
-                    if (pPulledElement != NULL)
-                    {
-                        pPulledElement->addr.destIpAddr = vos_ntohl(pNewFrameHead->replyIpAddress);
-
-                        trdp_pdInit(pPulledElement, TRDP_MSG_PP, appHandle->etbTopoCnt, appHandle->opTrnTopoCnt,
-                                    0u, 0u, vos_ntohl(pNewFrameHead->reserved));
-
-                        trdp_pdPrepareStats(appHandle, pPulledElement);
-                    }
-                    else
-                    {
-                        vos_printLogStr(VOS_LOG_ERROR, "Statistics request failed, not published!\n");
-                    }
-                }
-                else
-                {
-                    UINT32 replyComId = vos_ntohl(pNewFrameHead->replyComId);
-
-                    if (replyComId == 0u)
-                    {
-                        replyComId = vos_ntohl(pNewFrameHead->comId);
-                    }
+    if (err != VOS_NO_ERR)
+    {
+        trdp_pdNoteTxStamp(pIface, stampId, keyed, FALSE, pPacket, NULL);
+        vos_printLogStr(VOS_LOG_DBG, "trdp_pdSend failed\n");
+        return TRDP_IO_ERR;
+    }
 
-                    /*  Find requested publish element  */
-                    pPulledElement = trdp_queueFindComId(appHandle->pSndQueue, replyComId);
-                }
+    /*  Sent at due time: the statistics refer to the time the packet was handed over, if that was earlier  */
+    if ((pLaunchTime != NULL) && (pIface->launchState == TRDP_LAUNCH_IGNORED))
+    {
+        vos_getTime(&now);
+        if (timercmp(pLaunchTime, &now, >))
+        {
+            pLaunchTime = &now;
+        }
+    }
+    trdp_pdNoteTxStamp(pIface, stampId, keyed, TRUE, pPacket, pLaunchTime);
 
-                if (pPulledElement != NULL)
-                {
-                    /*  Set the destination address of the requested telegram either to the replyIp or the source Ip of the
-                     requester   */
+    if (pPacket->sendSize != pPacket->grossSize)
+    {
+        vos_printLogStr(VOS_LOG_ERROR, "trdp_pdSend incomplete\n");
+        return TRDP_IO_ERR;
+    }
 
-                    if (pNewFrameHead->replyIpAddress != 0u)
-                    {
-                        pPulledElement->pullIpAddress = vos_ntohl(pNewFrameHead->replyIpAddress);
-                    }
-                    else
-                    {
-                        pPulledElement->pullIpAddress = subAddresses.srcIpAddr;
-                    }
+    return TRDP_NO_ERR;
+}
 
-                    /* trigger immediate sending of PD  */
-                    pPulledElement->privFlags |= TRDP_REQ_2B_SENT;
+/******************************************************************************/
+/** Decide from the first TX timestamp whether the launch times of a socket are honoured
+ *  A packet handed over a cycle ahead leaves at once, unless an ETF qdisc holds it back until its launch time.
+ *  The qdisc is not queried, its presence is inferred from this stamp (or a packet dropped for a missed launch time).
+ *
+ *  @param[in]      appHandle           session pointer
+ *  @param[in]      pIface              txTime socket
+ *  @param[in]      pLaunchTime         requested launch time
+ *  @param[in]      pTxStamp            TX timestamp reported by the kernel
+ */
+static void trdp_pdCheckLaunch (
+    TRDP_SESSION_PT     appHandle,
+    TRDP_SOCKETS_T      *pIface,
+    const TRDP_TIME_T   *pLaunchTime,
+    const TRDP_TIME_T   *pTxStamp)
+{
+    TRDP_TIME_T tolerance;
+    TRDP_TIME_T early = *pLaunchTime;
+
+    /* Early by more than half the lookahead: nobody waited for the launch time */
+    trdp_pdTxLookahead(appHandle, &tolerance);
+    vos_divTime(&tolerance, 2u);
+    vos_subTime(&early, &tolerance);
+    if (timercmp(pTxStamp, &early, <))
+    {
+        pIface->launchState = TRDP_LAUNCH_IGNORED;
+        vos_printLog(VOS_LOG_WARNING,
+                     "Launch times not honoured on socket %d (no ETF qdisc?): sending at due time\n",
+                     (int) pIface->sock);
+    }
+    else
+    {
+        pIface->launchState = TRDP_LAUNCH_ENABLED;
+        vos_printLog(VOS_LOG_INFO, "Launch times honoured on socket %d\n", (int) pIface->sock);
+    }
+}
 
-                    if (trdp_pdSendElement(appHandle, &pPulledElement) != TRDP_NO_ERR)
-                    {
-                        /*  We do not break here, only report error */
-                        vos_printLogStr(VOS_LOG_WARNING, "Error sending one or more PD packets\n");
-                    }
+/******************************************************************************/
+/** Collect the TX timestamps of all txTime sockets and update the publishers' statistics
+ *
+ *  @param[in]      appHandle           session pointer
+ */
+void trdp_pdCollectTxStamps (
+    TRDP_SESSION_PT appHandle)
+{
+    INT32 lIndex;
 
-                    informUser = TRUE;
-                }
-            }
+    for (lIndex = 0; lIndex < trdp_getCurrentMaxSocketCnt(TRDP_SOCK_PD); lIndex++)
+    {
+        TRDP_SOCKETS_T *pIface = &appHandle->ifacePD[lIndex];
 
-        }
-        else
+        if ((pIface->sock == VOS_INVALID_SOCKET) || (pIface->pTxStampRef == NULL))
         {
-            appHandle->stats.pd.numTopoErr++;
-            pExistingElement->lastErr = TRDP_TOPO_ERR;
-            err         = TRDP_TOPO_ERR;
-            informUser  = TRUE;
+            continue;
         }
-    }
 
-    if ((pExistingElement != NULL) &&
-        (informUser == TRUE))
-    {
-        /*  If a callback was provided, call it now */
-        if ((pExistingElement->pktFlags & TRDP_FLAGS_CALLBACK)
-            && (pExistingElement->pfCbFunction != NULL))
+        /*  The stamps are keyed by ee_data, the key handed to the kernel with the packet (or its send counter)  */
+        for (;; )
         {
-            TRDP_PD_INFO_T theMessage;
-            memset(&theMessage, 0, sizeof(TRDP_PD_INFO_T));
-
-            theMessage.comId        = pExistingElement->addr.comId;
-            theMessage.srcIpAddr    = pExistingElement->lastSrcIP;
-            theMessage.destIpAddr   = subAddresses.destIpAddr;
-            theMessage.msgType      = msgType;
-            theMessage.seqCount     = pExistingElement->curSeqCnt;
-            theMessage.pUserRef     = pExistingElement->pUserRef; /* User reference given with the local subscribe? */
-            theMessage.resultCode   = err;
+            TRDP_TX_STAMP_REF_T *pRef;
+            TRDP_TIME_T         txStamp;
+            UINT32              id;
+            VOS_ERR_T           err = vos_sockReceiveTxStamp(pIface->sock, &id, &txStamp);
 
-#ifdef TSN_SUPPORT
-            if (TRUE == isTSN)
+            if (err == VOS_IO_ERR)
             {
-                theMessage.etbTopoCnt   = 0u;
-                theMessage.opTrnTopoCnt = 0u;
-                theMessage.replyComId   = 0u;
-                theMessage.replyIpAddr  = VOS_INADDR_ANY;
-                theMessage.protVersion  = pTSNFrameHead->protocolVersion;
-                theMessage.serviceId    = pTSNFrameHead->reserved;
-                pExistingElement->pfCbFunction(appHandle->pdDefault.pRefCon,
-                                               appHandle,
-                                               &theMessage,
-                                               ((PD2_PACKET_T *)pExistingElement->pFrame)->data,
-                                               (UINT32) vos_ntohs(((PD2_PACKET_T *)pExistingElement->pFrame)->frameHead
-                                                                  .datasetLength));
+                /* The dropped packet is counted as numStampsLost of its publisher once its reference is reused */
+                vos_printLog(VOS_LOG_DBG, "Launch time missed, PD packet dropped (socket %d)\n", (int) pIface->sock);
+                if (pIface->launchState == TRDP_LAUNCH_UNKNOWN)
+                {
+                    pIface->launchState = TRDP_LAUNCH_ENABLED;  /* only the ETF qdisc drops late packets */
+                }
+                continue;
             }
-            else
-#endif
+            if (err != VOS_NO_ERR)
             {
-                theMessage.etbTopoCnt   = vos_ntohl(pExistingElement->pFrame->frameHead.etbTopoCnt);
-                theMessage.opTrnTopoCnt = vos_ntohl(pExistingElement->pFrame->frameHead.opTrnTopoCnt);
-                theMessage.protVersion  = vos_ntohs(pExistingElement->pFrame->frameHead.protocolVersion);
-                theMessage.replyComId   = vos_ntohl(pExistingElement->pFrame->frameHead.replyComId);
-                theMessage.replyIpAddr  = vos_ntohl(pExistingElement->pFrame->frameHead.replyIpAddress);
-                theMessage.serviceId    = vos_ntohl(pExistingElement->pFrame->frameHead.reserved);
-                pExistingElement->pfCbFunction(appHandle->pdDefault.pRefCon,
-                                               appHandle,
-                                               &theMessage,
-                                               pExistingElement->pFrame->data,
-                                               vos_ntohl(pExistingElement->pFrame->frameHead.datasetLength));
+                break;
+            }
+            pRef = &pIface->pTxStampRef[id % TRDP_TX_STAMP_REFS];
+            if ((pIface->txStampSync == TRUE) && (pRef->id == id) && (pRef->pElement != NULL))
+            {
+                if (pIface->launchState == TRDP_LAUNCH_UNKNOWN)
+                {
+                    trdp_pdCheckLaunch(appHandle, pIface, &pRef->launchTime, &txStamp);
+                }
+                trdp_pdUpdateTxStats(pRef->pElement, &pRef->launchTime, &txStamp);
+                pRef->pElement = NULL;
             }
         }
     }
-    return err;
 }
 
 /******************************************************************************/
-/** Check for pending packets, set FD if non blocking
+/** Send the packets posted to the AF_XDP socket or queued to the io_uring
+ *
+ *  @param[in]      appHandle           session pointer
+ */
+void trdp_pdFlushPosted (
+    TRDP_SESSION_PT appHandle)
+{
+#ifdef XDP_SUPPORT
+    vos_xskFlush(appHandle->pdXsk);
+#endif
+#ifdef URING_SUPPORT
+    vos_uringFlush(appHandle->pdUring);
+#endif
+    (void) appHandle;
+}
+
+/******************************************************************************/
+/** Update the in-kernel comId filters of the PD sockets
+ *
+ *  Each PD socket gets a filter passing the comIds subscribed on it (and PD pull requests), all other PD is dropped
+ *  before it is copied to user space. If comId filtering is disabled, or a socket carries more subscribed comIds
+ *  than a filter can hold, the filter is removed. Must be called with mutexRxPD held.
  *
  *  @param[in]      appHandle           session pointer
- *  @param[in,out]  pFileDesc           pointer to set of ready descriptors
- *  @param[in,out]  pNoDesc             pointer to number of ready descriptors
- *  @param[in]      checkSend           check send queue, too
  */
-void trdp_pdCheckPending (
-    TRDP_APP_SESSION_T  appHandle,
-    TRDP_FDS_T          *pFileDesc,
-    INT32               *pNoDesc,
-    int                 checkSend)
+void trdp_pdUpdateComIdFilter (
+    TRDP_SESSION_PT appHandle)
 {
-    PD_ELE_T *iterPD;
-
-    /*    Walk over the registered PDs, find pending packets */
+    UINT32  comIds[VOS_SOCK_FILTER_MAX_KEYS];
+    INT32   lIndex;
 
-    vos_clearTime(&appHandle->nextJob);
-
-    /*    Find the packet which has to be received next:    */
-    for (iterPD = appHandle->pRcvQueue; iterPD != NULL; iterPD = iterPD->pNext)
+    for (lIndex = 0; lIndex < trdp_getCurrentMaxSocketCnt(TRDP_SOCK_PD); lIndex++)
     {
-        if ((!(iterPD->privFlags & TRDP_TIMED_OUT)) &&              /* Exempt already timed-out packet */
-            timerisset(&iterPD->interval) &&                        /* not PD PULL?                    */
-            (timercmp(&iterPD->timeToGo, &appHandle->nextJob, <) || /* earlier than current time-out?  */
-             !timerisset(&appHandle->nextJob)))                     /* or not set at all?              */
+        TRDP_SOCKETS_T  *pIface         = &appHandle->ifacePD[lIndex];
+        UINT32          noOfComIds      = 0u;
+        BOOL8           tooMany         = FALSE;
+        PD_ELE_T        *iterPD;
+        VOS_ERR_T       err;
+
+        if ((pIface->sock == VOS_INVALID_SOCKET) || (pIface->type != TRDP_SOCK_PD))
         {
-            appHandle->nextJob = iterPD->timeToGo;                  /* set new next time value from queue element */
+            continue;
         }
 
-        /*    Check and set the socket file descriptor, if not already done    */
-        if (iterPD->socketIdx != -1 &&
-            appHandle->ifacePD[iterPD->socketIdx].sock != -1 &&
-            !FD_ISSET(appHandle->ifacePD[iterPD->socketIdx].sock, (fd_set *)pFileDesc))     /*lint !e573 !e505
-                                                                                          signed/unsigned division in macro /
-                                                                                          Redundant left argument to comma */
+        for (iterPD = appHandle->pRcvQueue; (iterPD != NULL) && (appHandle->comIdFilter == TRUE); iterPD = iterPD->pNext)
         {
-            FD_SET(appHandle->ifacePD[iterPD->socketIdx].sock, (fd_set *)pFileDesc);       /*lint !e573 !e505
-                                                                                          signed/unsigned division in macro /
-                                                                                          Redundant left argument to comma */
-            if (appHandle->ifacePD[iterPD->socketIdx].sock > *pNoDesc)
+            UINT32 i;
+
+            if (iterPD->socketIdx != lIndex)
             {
-                *pNoDesc = (INT32) appHandle->ifacePD[iterPD->socketIdx].sock;
+                continue;
+            }
+            for (i = 0u; (i < noOfComIds) && (comIds[i] != iterPD->addr.comId); i++)
+            {
+                ;
+            }
+            if (i < noOfComIds)
+            {
+                continue;   /* already listed */
             }
+            if (noOfComIds == VOS_SOCK_FILTER_MAX_KEYS)
+            {
+                tooMany = TRUE;
+                break;
+            }
+            comIds[noOfComIds++] = iterPD->addr.comId;
         }
-    }
 
-    if (checkSend)
-    {
-        /*    Find packet in send queue which evntually has to be sent earlier:    */
-        for (iterPD = appHandle->pSndQueue; iterPD != NULL; iterPD = iterPD->pNext)
+        if ((appHandle->comIdFilter == FALSE) || (tooMany == TRUE))
         {
-            if (timerisset(&iterPD->interval) &&                        /* has a time out value?    */
-                (timercmp(&iterPD->timeToGo, &appHandle->nextJob, <) ||  /* earlier than current time-out? */
-                 !timerisset(&appHandle->nextJob)))
+            if (tooMany == TRUE)
             {
-                appHandle->nextJob = iterPD->timeToGo;                  /* set new next time value from queue element */
+                vos_printLog(VOS_LOG_INFO, "More than %u comIds subscribed on socket %d, no comId filter\n",
+                             VOS_SOCK_FILTER_MAX_KEYS, (int) pIface->sock);
             }
+            err = vos_sockSetPayloadFilter(pIface->sock, 0u, NULL, 0u, 0u, 0u);
+        }
+        else
+        {
+            err = vos_sockSetPayloadFilter(pIface->sock,
+                                           (UINT32) offsetof(PD_HEADER_T, comId),
+                                           comIds,
+                                           noOfComIds,
+                                           (UINT32) offsetof(PD_HEADER_T, msgType),
+                                           (UINT16) TRDP_MSG_PR);
+        }
+        if (err == VOS_UNKNOWN_ERR)
+        {
+            vos_printLogStr(VOS_LOG_WARNING, "comId filter not supported on this target, disabled\n");
+            appHandle->comIdFilter = FALSE;
+            return;
+        }
+        if (err != VOS_NO_ERR)
+        {
+            vos_printLog(VOS_LOG_WARNING, "comId filter not set on socket %d (%s)\n",
+                         (int) pIface->sock, vos_getErrorString(err));
         }
     }
 }
 
 /******************************************************************************/
-/** Check for time outs
+/** Set the device busy poll time of all PD sockets of a session.
+ *  Must be called with mutexRxPD held.
  *
- *  @param[in]      appHandle         application handle
+ *  @param[in]      appHandle           session pointer
+ *
+ *  @retval         TRDP_NO_ERR         no error
+ *  @retval         TRDP_SOCK_ERR       not set on at least one socket (e.g. missing privileges)
+ *  @retval         TRDP_UNKNOWN_ERR    not supported on this target
  */
-void trdp_pdHandleTimeOuts (
+TRDP_ERR_T trdp_pdUpdateBusyPoll (
     TRDP_SESSION_PT appHandle)
 {
-    PD_ELE_T *iterPD = NULL;
+    TRDP_ERR_T  ret = TRDP_NO_ERR;
+    INT32       lIndex;
 
-    /*    Examine receive queue for late packets    */
-    for (iterPD = appHandle->pRcvQueue; iterPD != NULL; iterPD = iterPD->pNext)
+    for (lIndex = 0; lIndex < trdp_getCurrentMaxSocketCnt(TRDP_SOCK_PD); lIndex++)
     {
-        trdp_handleTimeout(appHandle, iterPD);
+        TRDP_SOCKETS_T  *pIface = &appHandle->ifacePD[lIndex];
+        VOS_ERR_T       err;
+
+        if ((pIface->sock == VOS_INVALID_SOCKET) || (pIface->type != TRDP_SOCK_PD))
+        {
+            continue;
+        }
+
+        err = vos_sockSetBusyPoll(pIface->sock, appHandle->busyPollTime);
+        if (err == VOS_UNKNOWN_ERR)
+        {
+            if (appHandle->busyPollTime == 0u)
+            {
+                return TRDP_NO_ERR;
+            }
+            vos_printLogStr(VOS_LOG_WARNING, "Busy polling sockets not supported on this target\n");
+            appHandle->busyPollTime = 0u;
+            return TRDP_UNKNOWN_ERR;
+        }
+        if (err != VOS_NO_ERR)
+        {
+            vos_printLog(VOS_LOG_WARNING, "Busy poll time not set on socket %d (%s)\n",
+                         (int) pIface->sock, vos_getErrorString(err));
+            ret = TRDP_SOCK_ERR;
+        }
     }
+    return ret;
 }
 
 /******************************************************************************/
-/** Check a packet for timeout packet
- *  Call user's callback, if necessary
+/** Busy poll the PD receivers of a descriptor set.
+ *  The PD sockets (and the AF_XDP socket or io_uring) in the set are read without blocking, round by round, until
+ *  something arrives or the spin budget of the session is used up. What is read is processed right away.
+ *  If anything arrived, the set is reduced to the descriptors which delivered and trdp_pdCheckListenSocks() takes
+ *  the rest of their packets. Otherwise the set is left as it is, to be passed to select().
  *
- *  @param[in]      appHandle       Session handle
- *  @param[in]      pPacket         pointer to the packet element to check
+ *  @param[in]      appHandle           session pointer
+ *  @param[in,out]  pRfds               pointer to set of descriptors to poll
+ *  @param[out]     pCount              pointer to number of ready descriptors
+ *
+ *  @retval         TRUE                something was received
+ *  @retval         FALSE               nothing arrived within the spin budget
  */
-void trdp_handleTimeout (
+BOOL8 trdp_pdBusyPoll (
     TRDP_SESSION_PT appHandle,
-    PD_ELE_T        *pPacket)
+    TRDP_FDS_T      *pRfds,
+    INT32           *pCount)
 {
+    TRDP_FDS_T  ready;
+    INT32       noOfReady = 0;
+    INT32       idx;
+    TRDP_TIME_T deadline;
     TRDP_TIME_T now;
+    TRDP_TIME_T budget;
+    TRDP_ERR_T  err;
 
-    /*    Update the current time    */
-    vos_getTime(&now);
+    FD_ZERO((fd_set *)&ready);
+    budget.tv_sec   = (time_t) (appHandle->busyPollBudget / 1000000u);
+    budget.tv_usec  = (suseconds_t) (appHandle->busyPollBudget % 1000000u);
+    vos_getTime(&deadline);
+    vos_addTime(&deadline, &budget);
 
-    if (timerisset(&pPacket->interval) &&
-        timerisset(&pPacket->timeToGo) &&                        /*  Prevent timing out of PULLed data too early */
-        !timercmp(&pPacket->timeToGo, &now, >) &&                /*  late?   */
-        !(pPacket->privFlags & TRDP_TIMED_OUT) &&                /*  and not already flagged ?   */
-        !(pPacket->addr.comId == TRDP_STATISTICS_PULL_COMID)) /*  Do not bother user with statistics timeout */
+    do
     {
-        /*  Update some statistics  */
-        appHandle->stats.pd.numTimeout++;
-        pPacket->lastErr = TRDP_TIMEOUT_ERR;
-
-        /* Packet is late! We inform the user about this:    */
-        if (pPacket->pfCbFunction != NULL)
+        for (idx = 0; idx < trdp_getCurrentMaxSocketCnt(TRDP_SOCK_PD); idx++)
         {
-            TRDP_PD_INFO_T theMessage;
-            memset(&theMessage, 0, sizeof(TRDP_PD_INFO_T));
-            theMessage.comId        = pPacket->addr.comId;
-            theMessage.srcIpAddr    = pPacket->addr.srcIpAddr;
-            theMessage.destIpAddr   = pPacket->addr.destIpAddr;
-            theMessage.pUserRef     = pPacket->pUserRef;
-            theMessage.resultCode   = TRDP_TIMEOUT_ERR;
-            if (pPacket->pFrame != NULL)
+            SOCKET sock = appHandle->ifacePD[idx].sock;
+
+            if ((sock == VOS_INVALID_SOCKET) ||
+                !FD_ISSET(sock, (fd_set *) pRfds))                  /*lint !e573 signed/unsigned division in macro */
             {
-#ifdef TSN_SUPPORT
-                if (pPacket->privFlags & TRDP_IS_TSN)
-                {
-                    PD2_PACKET_T *pFrame = (PD2_PACKET_T *) pPacket->pFrame;
-                    theMessage.msgType      = (TRDP_MSG_T)pFrame->frameHead.msgType;
-                    theMessage.seqCount     = vos_ntohl(pFrame->frameHead.sequenceCounter);
-                    theMessage.protVersion  = pFrame->frameHead.protocolVersion;
-                }
-                else
-#endif
-                {
-                    theMessage.etbTopoCnt   = vos_ntohl(pPacket->pFrame->frameHead.etbTopoCnt);
-                    theMessage.opTrnTopoCnt = vos_ntohl(pPacket->pFrame->frameHead.opTrnTopoCnt);
-                    theMessage.msgType      = (TRDP_MSG_T) vos_ntohs(pPacket->pFrame->frameHead.msgType);
-                    theMessage.seqCount     = vos_ntohl(pPacket->pFrame->frameHead.sequenceCounter);
-                    theMessage.protVersion  = vos_ntohs(pPacket->pFrame->frameHead.protocolVersion);
-                    theMessage.replyComId   = vos_ntohl(pPacket->pFrame->frameHead.replyComId);
-                    theMessage.replyIpAddr  = vos_ntohl(pPacket->pFrame->frameHead.replyIpAddress);
-                }
-                pPacket->pfCbFunction(appHandle->pdDefault.pRefCon,
-                                      appHandle,
-                                      &theMessage,
-                                      pPacket->pFrame->data,
-                                      pPacket->dataSize);
+                continue;
             }
-            else
+            err = trdp_pdReceive(appHandle, sock);
+            if (err == TRDP_BLOCK_ERR)
             {
-                pPacket->pfCbFunction(appHandle->pdDefault.pRefCon,
-                                      appHandle,
-                                      &theMessage,
-                                      NULL,
-                                      pPacket->dataSize);
+                continue;
+            }
+            if ((err != TRDP_NO_ERR) && (err != TRDP_NOSUB_ERR) && (err != TRDP_NODATA_ERR))
+            {
+                vos_printLog(VOS_LOG_WARNING, "trdp_pdReceive() failed (Err: %d)\n", err);
             }
+            FD_SET(sock, (fd_set *)&ready);                         /*lint !e573 !e505 signed/unsigned division in macro */
+            noOfReady++;
         }
-
-        /*    Prevent repeated time out events    */
-        pPacket->privFlags |= TRDP_TIMED_OUT;
+#ifdef XDP_SUPPORT
+        if ((appHandle->pdXsk != NULL) &&
+            FD_ISSET(vos_xskSocket(appHandle->pdXsk), (fd_set *) pRfds) &&  /*lint !e573 signed/unsigned division */
+            (trdp_pdReceiveXdp(appHandle) == TRDP_NO_ERR))
+        {
+            FD_SET(vos_xskSocket(appHandle->pdXsk), (fd_set *)&ready);      /*lint !e573 !e505 signed/unsigned */
+            noOfReady++;
+        }
+#endif
+#ifdef URING_SUPPORT
+        if ((appHandle->pdUring != NULL) &&
+            FD_ISSET(vos_uringSocket(appHandle->pdUring), (fd_set *) pRfds) &&  /*lint !e573 signed/unsigned */
+            (trdp_pdReceiveUring(appHandle) == TRDP_NO_ERR))
+        {
+            FD_SET(vos_uringSocket(appHandle->pdUring), (fd_set *)&ready);      /*lint !e573 !e505 signed/unsigned */
+            noOfReady++;
+        }
+#endif
+        if (noOfReady > 0)
+        {
+            *pRfds  = ready;
+            *pCount = noOfReady;
+            return TRUE;
+        }
+        vos_getTime(&now);
     }
+    while (vos_cmpTime(&now, &deadline) < 0);
+
+    return FALSE;
 }
 
-/**********************************************************************************************************************/
-/** Checking receive connection requests and data
- *  Call user's callback if needed
+/******************************************************************************/
+/** Start the callback threads of a session.
+ *  From now on, subscriber callbacks are executed by these threads instead of the receiving thread.
  *
  *  @param[in]      appHandle           session pointer
- *  @param[in]      pRfds               pointer to set of ready descriptors
- *  @param[in,out]  pCount              pointer to number of ready descriptors
+ *  @param[in]      noOfThreads         number of callback threads (1...TRDP_PD_CB_MAX_THREADS)
+ *  @param[in]      policy              scheduling policy of the callback threads
+ *  @param[in]      priority            scheduling priority of the callback threads
+ *
+ *  @retval         TRDP_NO_ERR         no error
+ *  @retval         TRDP_MEM_ERR        out of memory
+ *  @retval         TRDP_SEMA_ERR       semaphore could not be created
+ *  @retval         TRDP_THREAD_ERR     thread could not be created
+ *  @retval         TRDP_UNKNOWN_ERR    not supported on this target
  */
-TRDP_ERR_T   trdp_pdCheckListenSocks (
-    TRDP_SESSION_PT appHandle,
-    TRDP_FDS_T      *pRfds,
-    INT32           *pCount)
+TRDP_ERR_T trdp_pdCbPoolStart (
+    TRDP_SESSION_PT         appHandle,
+    UINT32                  noOfThreads,
+    VOS_THREAD_POLICY_T     policy,
+    VOS_THREAD_PRIORITY_T   priority)
 {
-    TRDP_ERR_T result = TRDP_NO_ERR;
+#ifdef TRDP_PD_CB_POOL_SUPPORT
+    TRDP_PD_CB_POOL_T   *pPool;
+    UINT32              i;
 
-    /*  Check the input params, in case we are in polling mode, the application
-     is responsible to get any process data by calling tlp_get()    */
-    if ((pRfds == NULL) || (pCount == NULL))
+    pPool = (TRDP_PD_CB_POOL_T *) vos_memAlloc(sizeof(TRDP_PD_CB_POOL_T));
+    if (pPool == NULL)
     {
-        /* polling mode */
+        return TRDP_MEM_ERR;
     }
-    else if ((pCount != NULL) && (*pCount > 0))
+    for (i = 0u; i < TRDP_PD_CB_QUEUE_SIZE; i++)
     {
-        /*
-            Check the sockets for received PD packets.
-            Note:   The formaer approach (iterating through all subscriptions) was less than effective, not only for
-                    many subscriptions. Looping through the much small socket list can do the same job.
-                    For version 2, we changed that not only for HIGH_PERF_INDEXED, but also for standard TRDP.
-         */
-        UINT32      idx;
-        TRDP_ERR_T  err;
-        BOOL8       nonBlocking = !(appHandle->option & TRDP_OPTION_BLOCK);
+        pPool->queue[i].seq = i;
+    }
+    pPool->pSession = appHandle;
+    if (vos_semaCreate(&pPool->sema, VOS_SEMA_EMPTY) != VOS_NO_ERR)
+    {
+        vos_memFree(pPool);
+        return TRDP_SEMA_ERR;
+    }
 
-        /*    Check and set the socket file descriptor by going thru the socket list    */
-        for (idx = 0; idx < (UINT32) trdp_getCurrentMaxSocketCnt(TRDP_SOCK_PD); idx++)
+    pPool->running = noOfThreads;
+    for (i = 0u; i < noOfThreads; i++)
+    {
+        if (vos_threadCreate(&pPool->thread[i], "PD Callback", policy, priority, 0u, 0u,
+                             (VOS_THREAD_FUNC_T) trdp_pdCbThread, pPool) != VOS_NO_ERR)
         {
-            if ((appHandle->ifacePD[idx].sock != -1) &&
-                (FD_ISSET(appHandle->ifacePD[idx].sock, (fd_set *) pRfds)))  /*lint !e573 signed/unsigned division in
-                                                                               macro */
-            {
-                VOS_LOG_T logType = VOS_LOG_ERROR;
+            vos_printLog(VOS_LOG_ERROR, "Callback thread %u could not be created\n", i);
+            (void) __atomic_sub_fetch(&pPool->running, noOfThreads - i, __ATOMIC_RELEASE);
+            pPool->noOfThreads = i;
+            trdp_pdCbPoolStop(appHandle, pPool);
+            return TRDP_THREAD_ERR;
+        }
+        pPool->noOfThreads++;
+    }
 
-                /*  PD frame received? */
-                /*  Compare the received data to the data in our receive queue
-                 Call user's callback if data changed    */
+    if (vos_mutexLock(appHandle->mutexRxPD) != VOS_NO_ERR)
+    {
+        trdp_pdCbPoolStop(appHandle, pPool);
+        return TRDP_MUTEX_ERR;
+    }
+    appHandle->pCbPool = pPool;
+    if (vos_mutexUnlock(appHandle->mutexRxPD) != VOS_NO_ERR)
+    {
+        vos_printLogStr(VOS_LOG_INFO, "vos_mutexUnlock() failed\n");
+    }
+    return TRDP_NO_ERR;
+#else
+    (void) appHandle;
+    (void) noOfThreads;
+    (void) policy;
+    (void) priority;
+    return TRDP_UNKNOWN_ERR;
+#endif
+}
 
-                do
-                {
-                    /* Read as long as data is available */
-                    err = trdp_pdReceive(appHandle, appHandle->ifacePD[idx].sock);
+/******************************************************************************/
+/** Stop the callback threads of a session.
+ *  Waits until all running callbacks returned, so it must neither be called with mutexRxPD held nor from a callback.
+ *  Samples not yet delivered are discarded.
+ *
+ *  @param[in]      appHandle           session pointer
+ *  @param[in]      pPool               pool to stop if not yet attached to the session, else NULL
+ */
+void trdp_pdCbPoolStop (
+    TRDP_SESSION_PT     appHandle,
+    TRDP_PD_CB_POOL_T   *pPool)
+{
+#ifdef TRDP_PD_CB_POOL_SUPPORT
+    TRDP_PD_CB_SLOT_T   *pSlot;
+    PD_ELE_T            *iterPD;
+    UINT32              i;
 
-                }
-                while ((err == TRDP_NO_ERR) && (nonBlocking == TRUE));
+    if (vos_mutexLock(appHandle->mutexRxPD) != VOS_NO_ERR)
+    {
+        vos_printLogStr(VOS_LOG_ERROR, "vos_mutexLock() failed, callback threads not stopped\n");
+        return;
+    }
+    if (pPool == NULL)
+    {
+        /*  Detach the pool, from now on callbacks are called directly  */
+        pPool = appHandle->pCbPool;
+        appHandle->pCbPool = NULL;
+    }
+    if (vos_mutexUnlock(appHandle->mutexRxPD) != VOS_NO_ERR)
+    {
+        vos_printLogStr(VOS_LOG_INFO, "vos_mutexUnlock() failed\n");
+    }
+    if (pPool == NULL)
+    {
+        return;
+    }
 
-                switch (err)
-                {
-                    case TRDP_NO_ERR:
-                    case TRDP_NOSUB_ERR:        /* missing subscription should not lead to extensive error output */
-                    case TRDP_BLOCK_ERR:
-                    case TRDP_NODATA_ERR:       /* ignore would-block or sporadic unsolicited messages */
-                        break;
-                    case TRDP_TOPO_ERR:
-                    case TRDP_TIMEOUT_ERR:
-                    default:
-                        result  = err;
-                        logType = VOS_LOG_WARNING;
-                        vos_printLog(logType, "trdp_pdReceive() failed (Err: %d)\n", err);
-                        break;
-                }
-                (*pCount)--;
-                FD_CLR(appHandle->ifacePD[idx].sock, (fd_set *)pRfds); /*lint !e502 !e573 !e505
-                                                                                      signed/unsigned division in macro */
+    __atomic_store_n(&pPool->stop, TRUE, __ATOMIC_RELEASE);
+    for (i = 0u; i < pPool->noOfThreads; i++)
+    {
+        vos_semaGive(pPool->sema);
+    }
+    while (__atomic_load_n(&pPool->running, __ATOMIC_ACQUIRE) != 0u)
+    {
+        (void) vos_threadDelay(1000u);
+    }
+
+    /*  No callback thread left, release the slots   */
+    if (vos_mutexLock(appHandle->mutexRxPD) == VOS_NO_ERR)
+    {
+        while ((pSlot = trdp_pdCbDequeue(pPool)) != NULL)
+        {
+            if ((pSlot->state & TRDP_PD_CB_CANCELLED) != 0u)
+            {
+                vos_memFree(pSlot);
+            }
+            else
+            {
+                pSlot->state = 0u;
+            }
+        }
+        for (iterPD = appHandle->pRcvQueue; iterPD != NULL; iterPD = iterPD->pNext)
+        {
+            if (iterPD->pCbSlot != NULL)
+            {
+                vos_memFree(iterPD->pCbSlot);
+                iterPD->pCbSlot = NULL;
             }
         }
+        if (vos_mutexUnlock(appHandle->mutexRxPD) != VOS_NO_ERR)
+        {
+            vos_printLogStr(VOS_LOG_INFO, "vos_mutexUnlock() failed\n");
+        }
     }
-    return result;
+    if (pPool->overruns != 0u)
+    {
+        vos_printLog(VOS_LOG_INFO, "Callback queue was full %u times\n", pPool->overruns);
+    }
+    vos_semaDelete(pPool->sema);
+    vos_memFree(pPool);
+#else
+    (void) appHandle;
+    (void) pPool;
+#endif
 }
 
 /******************************************************************************/
-/** Update the header values
+/** Release the deferred callback delivery of a subscription which is about to be freed.
+ *  If a callback thread still owns it, that thread frees it. Must be called with mutexRxPD held.
  *
- *  @param[in]      pPacket         pointer to the packet to update
+ *  @param[in]      pElement            subscription
  */
-void    trdp_pdUpdate (
-    PD_ELE_T *pPacket)
+void trdp_pdCbRelease (
+    PD_ELE_T *pElement)
 {
-    UINT32 myCRC;
-
-#ifdef TSN_SUPPORT
-    /* If TSN is set, use the smaller header */
-    if (pPacket->privFlags & TRDP_IS_TSN)
+    if (pElement->pCbSlot != NULL)
     {
-        PD2_HEADER_T *pFrameHead = (PD2_HEADER_T *) &pPacket->pFrame->frameHead;
+#ifdef TRDP_PD_CB_POOL_SUPPORT
+        if ((__atomic_fetch_or(&pElement->pCbSlot->state, TRDP_PD_CB_CANCELLED, __ATOMIC_ACQ_REL)
+             & ~TRDP_PD_CB_CANCELLED) == 0u)
+        {
+            vos_memFree(pElement->pCbSlot);
+        }
+#else
+        vos_memFree(pElement->pCbSlot);
+#endif
+        pElement->pCbSlot = NULL;
+    }
+}
 
-        /* increment counter with each telegram */
-        pPacket->curSeqCnt++;
-        pFrameHead->sequenceCounter = vos_htonl(pPacket->curSeqCnt);
+/******************************************************************************/
+/** Remove a subscription which is about to be freed from the batch of the current receive pass.
+ *  If it is in the batch just being reported, its entry is cleared, the batch callback skips it.
+ *  Must be called with mutexRxPD held.
+ *
+ *  @param[in]      appHandle           session pointer
+ *  @param[in]      pElement            subscription
+ */
+void trdp_pdBatchRemove (
+    TRDP_SESSION_PT appHandle,
+    PD_ELE_T        *pElement)
+{
+    UINT32 last;
 
-        /* Compute CRC32   */
-        myCRC = vos_crc32(INITFCS, (UINT8 *)pFrameHead, sizeof(PD2_HEADER_T) - SIZE_OF_FCS);
-        pFrameHead->frameCheckSum = MAKE_LE(myCRC);
-    }
-    else
-#endif
+    if (pElement->batchPos != 0u)
     {
-        /* increment counter with each telegram */
-        if (pPacket->pFrame->frameHead.msgType == vos_htons(TRDP_MSG_PP))
-        {
-            pPacket->curSeqCnt4Pull++;
-            pPacket->pFrame->frameHead.sequenceCounter = vos_htonl(pPacket->curSeqCnt4Pull);
-        }
-        else
+        /*  The last entry takes its place  */
+        last = --appHandle->noOfBatch;
+        if (pElement->batchPos - 1u != last)
         {
-            pPacket->curSeqCnt++;
-            pPacket->pFrame->frameHead.sequenceCounter = vos_htonl(pPacket->curSeqCnt);
+            appHandle->pBatch[pElement->batchPos - 1u] = appHandle->pBatch[last];
+            appHandle->pBatch[pElement->batchPos - 1u].subHandle->batchPos = pElement->batchPos;
         }
+        pElement->batchPos = 0u;
+    }
+    if ((pElement->batchCbPos != 0u) && (appHandle->pBatchCb != NULL))
+    {
+        TRDP_PD_BATCH_ENTRY_T *pEntry = &appHandle->pBatchCb[pElement->batchCbPos - 1u];
 
-        /* Compute CRC32   */
-        myCRC = vos_crc32(INITFCS, (UINT8 *)&pPacket->pFrame->frameHead, sizeof(PD_HEADER_T) - SIZE_OF_FCS);
-        pPacket->pFrame->frameHead.frameCheckSum = MAKE_LE(myCRC);
+        pEntry->subHandle       = NULL;
+        pEntry->pData           = NULL;
+        pEntry->dataSize        = 0u;
+        pElement->batchCbPos    = 0u;
     }
 }
 
-
 /******************************************************************************/
-/** Check if the PD header values and the CRCs are sane
- *
- *  @param[in]      pPacket         pointer to the packet to check
- *  @param[in]      packetSize      max size to check
- *  @param[out]     pIsTSN          set to TRUE on return if PD2 frame
+/** Report the telegrams updated during a receive pass to the batch callback.
+ *  Must be called with mutexRxPD held, at the end of the receive pass.
  *
- *  @retval         TRDP_NO_ERR
- *  @retval         TRDP_CRC_ERR
+ *  @param[in]      appHandle           session pointer
  */
-TRDP_ERR_T trdp_pdCheck (
-    PD_HEADER_T *pPacket,
-    UINT32      packetSize,
-    int         *pIsTSN)
+void trdp_pdBatchFlush (
+    TRDP_SESSION_PT appHandle)
 {
-    UINT32          myCRC;
-    TRDP_ERR_T      err = TRDP_NO_ERR;
+    TRDP_PD_BATCH_ENTRY_T   *pEntries   = appHandle->pBatch;
+    TRDP_PD_BATCH_ENTRY_T   *pOuter     = appHandle->pBatchCb;
+    UINT32                  noOfEntries = appHandle->noOfBatch;
+    UINT32                  batchSize   = appHandle->batchSize;
+    UINT32                  i;
 
-#ifdef TSN_SUPPORT
-    PD2_HEADER_T    *pPacket2 = (PD2_HEADER_T *) pPacket;
+    if (noOfEntries == 0u)
+    {
+        return;
+    }
 
-    /*  Check for TSN small header first    */
-    if (pPacket2->protocolVersion == 0x2)
+    /*  Detach the batch: the callback may (un)subscribe or pull telegrams, which start the next batch.
+        Unsubscribing clears the entry via batchCbPos, entries behind it must not refer to freed memory.  */
+    for (i = 0u; i < noOfEntries; i++)
     {
-        *pIsTSN = TRUE;
-        if ((packetSize < TRDP_MIN_PD2_HEADER_SIZE) ||
-            (packetSize > TRDP_MAX_PD2_PACKET_SIZE))
+        pEntries[i].subHandle->batchPos     = 0u;
+        pEntries[i].subHandle->batchCbPos   = i + 1u;
+    }
+    appHandle->pBatch       = NULL;
+    appHandle->batchSize    = 0u;
+    appHandle->noOfBatch    = 0u;
+    appHandle->pBatchCb     = pEntries;
+
+    if (appHandle->pfBatchCb != NULL)
+    {
+        appHandle->pfBatchCb(appHandle->pBatchRefCon, appHandle, pEntries, noOfEntries);
+    }
+
+    for (i = 0u; i < noOfEntries; i++)
+    {
+        if (pEntries[i].subHandle != NULL)
         {
-            vos_printLog(VOS_LOG_INFO, "PDframe size error (%u))\n", packetSize);
-            err = TRDP_WIRE_ERR;
+            pEntries[i].subHandle->batchCbPos = 0u;
         }
-        else
-        {
-            /*    Check Header CRC (FCS)  */
-            myCRC = vos_crc32(INITFCS, (UINT8 *) pPacket2, sizeof(PD2_HEADER_T) - SIZE_OF_FCS);
+    }
+    appHandle->pBatchCb = pOuter;
 
-            if (pPacket2->frameCheckSum != MAKE_LE(myCRC))
-            {
-                vos_printLog(VOS_LOG_INFO, "PDframe crc error (%08x != %08x))\n", pPacket2->frameCheckSum,
-                             MAKE_LE(myCRC));
-                err = TRDP_CRC_ERR;
-            }
-            /*  Check type  */
-            else if ((pPacket2->msgType != TRDP_MSG_TSN_PD) &&
-                     (pPacket2->msgType != TRDP_MSG_TSN_PD_SDT) &&
-                     (pPacket2->msgType != TRDP_MSG_TSN_PD_MSDT) &&
-                     (pPacket2->msgType != TRDP_MSG_TSN_PD_RES))
-            {
-                vos_printLog(VOS_LOG_INFO, "PDframe type error, received %02x\n", pPacket2->msgType);
-                err = TRDP_WIRE_ERR;
-            }
-            /*  Check size  */
-            else if (vos_ntohs(pPacket2->datasetLength) > TRDP_MAX_PD2_DATA_SIZE)
-            {
-                vos_printLog(VOS_LOG_INFO, "PDframe datalength error, received %04x\n", pPacket2->msgType);
-                err = TRDP_WIRE_ERR;
-            }
-        }
+    /*  Keep the memory for the next pass, if no new batch was started   */
+    if (appHandle->pBatch == NULL)
+    {
+        appHandle->pBatch       = pEntries;
+        appHandle->batchSize    = batchSize;
     }
     else
-#endif
-    {   /* Version 1 TRDP (non-TSN) */
-        *pIsTSN = FALSE;
-        /*  Check size    */
-        if ((packetSize < TRDP_MIN_PD_HEADER_SIZE) ||
-            (packetSize > TRDP_MAX_PD_PACKET_SIZE))
+    {
+        vos_memFree(pEntries);
+    }
+}
+
+/******************************************************************************/
+/** Set or remove the change filter of a subscription.
+ *  Must be called with mutexRxPD held.
+ *
+ *  @param[in]      pElement            subscription
+ *  @param[in]      pFields             fields in ascending, non-overlapping order, NULL to remove the filter
+ *  @param[in]      noOfFields          number of fields
+ *  @param[in]      fieldMask           fields which trigger a callback (bit n: field n)
+ *
+ *  @retval         TRDP_NO_ERR         no error
+ *  @retval         TRDP_PARAM_ERR      invalid field list
+ *  @retval         TRDP_MEM_ERR        out of memory
+ */
+TRDP_ERR_T trdp_pdSetChangeFilter (
+    PD_ELE_T                *pElement,
+    const TRDP_PD_FIELD_T   *pFields,
+    UINT32                  noOfFields,
+    UINT64                  fieldMask)
+{
+    TRDP_PD_FILTER_T    *pFilter;
+    UINT32              i;
+
+    if ((pFields == NULL) || (noOfFields == 0u))
+    {
+        if (pElement->pFilter != NULL)
         {
-            vos_printLog(VOS_LOG_INFO, "PDframe size error (%u))\n", packetSize);
-            err = TRDP_WIRE_ERR;
+            vos_memFree(pElement->pFilter);
+            pElement->pFilter = NULL;
         }
-        else
+        return TRDP_NO_ERR;
+    }
+    if (noOfFields > TRDP_PD_MAX_FIELDS)
+    {
+        return TRDP_PARAM_ERR;
+    }
+    for (i = 0u; i < noOfFields; i++)
+    {
+        /*  Only the last field may extend to the end of the data, fields must not overlap    */
+        if (((pFields[i].size == 0u) && (i + 1u < noOfFields)) ||
+            ((i > 0u) && (pFields[i].offset < pFields[i - 1u].offset + pFields[i - 1u].size)) ||
+            ((pFields[i].deadband > 0.0) && ((trdp_pdNumericSize(pFields[i].type) == 0u) ||
+                                             (trdp_pdNumericSize(pFields[i].type) != pFields[i].size))))
         {
-            /*    Check Header CRC (FCS)  */
-            myCRC = vos_crc32(INITFCS, (UINT8 *) pPacket, sizeof(PD_HEADER_T) - SIZE_OF_FCS);
+            return TRDP_PARAM_ERR;
+        }
+    }
 
-            if (pPacket->frameCheckSum != MAKE_LE(myCRC))
-            {
-                vos_printLog(VOS_LOG_INFO, "PDframe crc error (%08x != %08x))\n", pPacket->frameCheckSum, MAKE_LE(myCRC));
-                err = TRDP_CRC_ERR;
-            }
-            /*  Check protocol version  */
-            else if (((vos_ntohs(pPacket->protocolVersion) & TRDP_PROTOCOL_VERSION_CHECK_MASK)
-                      != (TRDP_PROTO_VER & TRDP_PROTOCOL_VERSION_CHECK_MASK)) ||
-                     (vos_ntohl(pPacket->datasetLength) > TRDP_MAX_PD_DATA_SIZE))
-            {
-                vos_printLog(VOS_LOG_INFO, "PDframe protocol error (%04x != %04x))\n",
-                             vos_ntohs(pPacket->protocolVersion),
-                             TRDP_PROTO_VER);
-                err = TRDP_WIRE_ERR;
-            }
-            /*  Check type  */
-            else if ((vos_ntohs(pPacket->msgType) != (UINT16) TRDP_MSG_PD) &&
-                     (vos_ntohs(pPacket->msgType) != (UINT16) TRDP_MSG_PP) &&
-                     (vos_ntohs(pPacket->msgType) != (UINT16) TRDP_MSG_PR) &&
-                     (vos_ntohs(pPacket->msgType) != (UINT16) TRDP_MSG_PE))
-            {
-                vos_printLog(VOS_LOG_INFO, "PDframe type error, received %04x\n", vos_ntohs(pPacket->msgType));
-                err = TRDP_WIRE_ERR;
-            }
+    pFilter = pElement->pFilter;
+    if (pFilter == NULL)
+    {
+        pFilter = (TRDP_PD_FILTER_T *) vos_memAlloc(sizeof(TRDP_PD_FILTER_T));
+        if (pFilter == NULL)
+        {
+            return TRDP_MEM_ERR;
         }
     }
-    return err;
+    memcpy(pFilter->field, pFields, noOfFields * sizeof(TRDP_PD_FIELD_T));
+    pFilter->noOfFields = noOfFields;
+    pFilter->fieldMask  = fieldMask;
+    pFilter->reported   = FALSE;        /*  report all fields with the next packet  */
+    pElement->pFilter   = pFilter;
+    return TRDP_NO_ERR;
 }
 
+/******************************************************************************/
+/** Find a redundancy group.
+ *  Lock-free, groups are never removed while the session is open.
+ *
+ *  @param[in]      appHandle           session pointer
+ *  @param[in]      redId               redundancy group ID
+ *
+ *  @retval         group or NULL
+ */
+TRDP_RED_GROUP_T *trdp_pdRedGroupFind (
+    TRDP_SESSION_PT appHandle,
+    UINT32          redId)
+{
+    TRDP_RED_GROUP_T *pGroup;
+
+    for (pGroup = __atomic_load_n(&appHandle->pRedGroups, __ATOMIC_ACQUIRE);
+         (pGroup != NULL) && (pGroup->redId != redId);
+         pGroup = pGroup->pNext)
+    {
+        ;
+    }
+    return pGroup;
+}
 
 /******************************************************************************/
-/** Send one PD packet
+/** Find or create a redundancy group for a new publisher or PD request.
+ *  A new group starts as leader. Must be called with mutexTxPD held.
  *
- *  @param[in]      pdSock          socket descriptor
- *  @param[in]      pPacket         pointer to packet to be sent
- *  @param[in]      port            port on which to send
+ *  @param[in]      appHandle           session pointer
+ *  @param[in]      redId               redundancy group ID, not zero
  *
- *  @retval         TRDP_NO_ERR
- *  @retval         TRDP_IO_ERR
+ *  @retval         group or NULL if out of memory
  */
-TRDP_ERR_T  trdp_pdSend (
-    SOCKET      pdSock,
-    PD_ELE_T    *pPacket,
-    UINT16      port)
+TRDP_RED_GROUP_T *trdp_pdRedGroupReserve (
+    TRDP_SESSION_PT appHandle,
+    UINT32          redId)
 {
-    VOS_ERR_T   err     = VOS_NO_ERR;
-    UINT32      destIp  = pPacket->addr.destIpAddr;
+    TRDP_RED_GROUP_T *pGroup = trdp_pdRedGroupFind(appHandle, redId);
 
-    /*  check for temporary address (PD PULL):  */
-    if (pPacket->pullIpAddress != 0u)
+    if (pGroup == NULL)
     {
-        destIp = pPacket->pullIpAddress;
-        pPacket->pullIpAddress = 0u;
+        pGroup = (TRDP_RED_GROUP_T *) vos_memAlloc(sizeof(TRDP_RED_GROUP_T));
+        if (pGroup == NULL)
+        {
+            return NULL;
+        }
+        pGroup->redId   = redId;
+        pGroup->pNext   = appHandle->pRedGroups;
+        __atomic_store_n(&appHandle->pRedGroups, pGroup, __ATOMIC_RELEASE);
     }
+    return pGroup;
+}
 
-    pPacket->sendSize = pPacket->grossSize;
+/******************************************************************************/
+/** Add a publisher or PD request to the group returned by trdp_pdRedGroupReserve().
+ *  Must be called with mutexTxPD held.
+ *
+ *  @param[in]      pGroup              redundancy group
+ *  @param[in]      pElement            publisher or PD request
+ */
+void trdp_pdRedGroupAdd (
+    TRDP_RED_GROUP_T    *pGroup,
+    PD_ELE_T            *pElement)
+{
+    __atomic_store_n(&pGroup->noOfPub, pGroup->noOfPub + 1u, __ATOMIC_RELEASE);
+    pElement->pRedGroup = pGroup;
+}
 
-    err = vos_sockSendUDP(pdSock,
-                          (UINT8 *)&pPacket->pFrame->frameHead,
-                          &pPacket->sendSize,
-                          destIp,
-                          port);
+/******************************************************************************/
+/** Remove a publisher or PD request from its redundancy group. The group keeps its leadership state.
+ *  Must be called with mutexTxPD held.
+ *
+ *  @param[in]      pElement            publisher or PD request
+ */
+void trdp_pdRedGroupRemove (
+    PD_ELE_T *pElement)
+{
+    TRDP_RED_GROUP_T *pGroup = pElement->pRedGroup;
 
-    if (err != VOS_NO_ERR)
+    if (pGroup == NULL)
     {
-        vos_printLogStr(VOS_LOG_DBG, "trdp_pdSend failed\n");
-        return TRDP_IO_ERR;
+        return;
     }
+    __atomic_store_n(&pGroup->noOfPub, pGroup->noOfPub - 1u, __ATOMIC_RELEASE);
+    pElement->pRedGroup = NULL;
+}
 
-    if (pPacket->sendSize != pPacket->grossSize)
+/******************************************************************************/
+/** Set the leadership of one or all redundancy groups.
+ *  A single store per group, the send loop picks it up with the next telegram due.
+ *
+ *  @param[in]      appHandle           session pointer
+ *  @param[in]      redId               redundancy group ID, 0 for all groups
+ *  @param[in]      leader              TRUE if we send
+ *
+ *  @retval         TRUE                at least one matching group has publishers
+ */
+BOOL8 trdp_pdRedGroupSet (
+    TRDP_SESSION_PT appHandle,
+    UINT32          redId,
+    BOOL8           leader)
+{
+    TRDP_RED_GROUP_T    *pGroup;
+    BOOL8               found = FALSE;
+
+    for (pGroup = __atomic_load_n(&appHandle->pRedGroups, __ATOMIC_ACQUIRE); pGroup != NULL; pGroup = pGroup->pNext)
     {
-        vos_printLogStr(VOS_LOG_ERROR, "trdp_pdSend incomplete\n");
-        return TRDP_IO_ERR;
+        if ((redId == 0u) || (pGroup->redId == redId))
+        {
+            __atomic_store_n(&pGroup->follower, (leader == TRUE) ? 0u : 1u, __ATOMIC_RELEASE);
+            if (__atomic_load_n(&pGroup->noOfPub, __ATOMIC_ACQUIRE) != 0u)
+            {
+                found = TRUE;
+            }
+        }
     }
+    return found;
+}
 
-    return TRDP_NO_ERR;
+/******************************************************************************/
+/** Free the redundancy groups of a closing session.
+ *
+ *  @param[in]      appHandle           session pointer
+ */
+void trdp_pdRedGroupFree (
+    TRDP_SESSION_PT appHandle)
+{
+    while (appHandle->pRedGroups != NULL)
+    {
+        TRDP_RED_GROUP_T *pNext = appHandle->pRedGroups->pNext;
+
+        vos_memFree(appHandle->pRedGroups);
+        appHandle->pRedGroups = pNext;
+    }
+}
+
+/******************************************************************************/
+/** Check if a telegram must not be sent because its redundancy group is follower.
+ *
+ *  @param[in]      pElement            publisher or PD request
+ *
+ *  @retval         TRUE                follower
+ */
+BOOL8 trdp_pdIsFollower (
+    const PD_ELE_T *pElement)
+{
+    return ((pElement->pRedGroup != NULL) &&
+            (__atomic_load_n(&pElement->pRedGroup->follower, __ATOMIC_ACQUIRE) != 0u)) ? TRUE : FALSE;
 }
 
 #ifndef HIGH_PERF_INDEXED
@@ -17,6 +17,15 @@
 /*
 * $Id$
 *
+*      AG 2026-10-19: trdp_pdUpdateBusyPoll(), trdp_pdBusyPoll()
+*      AG 2026-10-19: trdp_pdReceiveUring(), trdp_pdCheckPendingUring(), trdp_pdFlushXdp() -> trdp_pdFlushPosted()
+*      AG 2026-10-19: trdp_pdReceiveXdp(), trdp_pdCheckPendingXdp(), trdp_pdFlushXdp()
+*      AG 2026-10-19: trdp_pdSkip(), trdp_pdRedGroup...(), trdp_pdIsFollower()
+*      AG 2026-10-19: trdp_pdSetChangeFilter()
+*      AG 2026-10-19: trdp_pdBatchRemove(), trdp_pdBatchFlush()
+*      AG 2026-10-19: trdp_pdCbPoolStart(), trdp_pdCbPoolStop(), trdp_pdCbRelease()
+*      AG 2026-10-19: trdp_pdUpdateComIdFilter()
+*      AG 2026-10-19: trdp_pdSend()/trdp_pdSendElement(): launch time, trdp_pdCollectTxStamps()
 *      BL 2019-06-17: Ticket #264 Provide service oriented interface
 *      BL 2019-06-17: Ticket #162 Independent handling of PD and MD to reduce jitter
 *      BL 2019-06-17: Ticket #161 Increase performance
@@ -64,6 +73,9 @@ void trdp_pdInit(
 void        trdp_pdUpdate (
     PD_ELE_T *);
 
+void        trdp_pdSkip (
+    PD_ELE_T *);
+
 TRDP_ERR_T  trdp_pdPut (
     PD_ELE_T *,
     TRDP_MARSHALL_T func,
@@ -77,9 +89,76 @@ TRDP_ERR_T trdp_pdCheck (
     int         *pIsTSN);
 
 TRDP_ERR_T trdp_pdSend (
-    SOCKET      pdSock,
-    PD_ELE_T    *pPacket,
-    UINT16      port);
+    TRDP_SOCKETS_T      *pIface,
+    PD_ELE_T            *pPacket,
+    UINT16              port,
+    const TRDP_TIME_T   *pLaunchTime);
+
+void        trdp_pdCollectTxStamps (
+    TRDP_SESSION_PT appHandle);
+
+void        trdp_pdUpdateComIdFilter (
+    TRDP_SESSION_PT appHandle);
+
+TRDP_ERR_T  trdp_pdUpdateBusyPoll (
+    TRDP_SESSION_PT appHandle);
+
+BOOL8       trdp_pdBusyPoll (
+    TRDP_SESSION_PT appHandle,
+    TRDP_FDS_T      *pRfds,
+    INT32           *pCount);
+
+TRDP_ERR_T  trdp_pdCbPoolStart (
+    TRDP_SESSION_PT         appHandle,
+    UINT32                  noOfThreads,
+    VOS_THREAD_POLICY_T     policy,
+    VOS_THREAD_PRIORITY_T   priority);
+
+void        trdp_pdCbPoolStop (
+    TRDP_SESSION_PT     appHandle,
+    TRDP_PD_CB_POOL_T   *pPool);
+
+void        trdp_pdCbRelease (
+    PD_ELE_T *pElement);
+
+void        trdp_pdBatchRemove (
+    TRDP_SESSION_PT appHandle,
+    PD_ELE_T        *pElement);
+
+void        trdp_pdBatchFlush (
+    TRDP_SESSION_PT appHandle);
+
+TRDP_ERR_T  trdp_pdSetChangeFilter (
+    PD_ELE_T                *pElement,
+    const TRDP_PD_FIELD_T   *pFields,
+    UINT32                  noOfFields,
+    UINT64                  fieldMask);
+
+TRDP_RED_GROUP_T *trdp_pdRedGroupFind (
+    TRDP_SESSION_PT appHandle,
+    UINT32          redId);
+
+TRDP_RED_GROUP_T *trdp_pdRedGroupReserve (
+    TRDP_SESSION_PT appHandle,
+    UINT32          redId);
+
+void        trdp_pdRedGroupAdd (
+    TRDP_RED_GROUP_T    *pGroup,
+    PD_ELE_T            *pElement);
+
+void        trdp_pdRedGroupRemove (
+    PD_ELE_T *pElement);
+
+BOOL8       trdp_pdRedGroupSet (
+    TRDP_SESSION_PT appHandle,
+    UINT32          redId,
+    BOOL8           leader);
+
+void        trdp_pdRedGroupFree (
+    TRDP_SESSION_PT appHandle);
+
+BOOL8       trdp_pdIsFollower (
+    const PD_ELE_T *pElement);
 
 TRDP_ERR_T trdp_pdGet (
     PD_ELE_T            *pPacket,
@@ -89,8 +168,9 @@ TRDP_ERR_T trdp_pdGet (
     UINT32              *pDataSize);
 
 TRDP_ERR_T  trdp_pdSendElement (
-    TRDP_SESSION_PT appHandle,
-    PD_ELE_T        * *ppElement);
+    TRDP_SESSION_PT     appHandle,
+    PD_ELE_T            * *ppElement,
+    const TRDP_TIME_T   *pLaunchTime);
 
 TRDP_ERR_T  trdp_pdSendQueued (
     TRDP_SESSION_PT appHandle);
@@ -110,6 +190,29 @@ TRDP_ERR_T  trdp_pdReceive (
     TRDP_SESSION_PT pSessionHandle,
     SOCKET          sock);
 
+#ifdef XDP_SUPPORT
+TRDP_ERR_T  trdp_pdReceiveXdp (
+    TRDP_SESSION_PT appHandle);
+
+void        trdp_pdCheckPendingXdp (
+    TRDP_SESSION_PT appHandle,
+    TRDP_FDS_T      *pFileDesc,
+    INT32           *pNoDesc);
+#endif
+
+#ifdef URING_SUPPORT
+TRDP_ERR_T  trdp_pdReceiveUring (
+    TRDP_SESSION_PT appHandle);
+
+void        trdp_pdCheckPendingUring (
+    TRDP_SESSION_PT appHandle,
+    TRDP_FDS_T      *pFileDesc,
+    INT32           *pNoDesc);
+#endif
+
+void        trdp_pdFlushPosted (
+    TRDP_SESSION_PT appHandle);
+
 void        trdp_pdCheckPending (
     TRDP_APP_SESSION_T  appHandle,
     TRDP_FDS_T          *pFileDesc,
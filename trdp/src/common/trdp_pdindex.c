@@ -17,6 +17,11 @@
 /*
  * $Id$
  *
+ *      AG 2026-10-19: Category range inclusive except for the highest one, as the former low/mid/high tables
+ *      AG 2026-10-19: Send PD queued to the io_uring, receive with it
+ *      AG 2026-10-19: Send PD posted to the AF_XDP socket, wait for its descriptor
+ *      AG 2026-10-19: Launch times for txTime sockets, collect TX timestamps after sending
+ *      AG 2026-10-19: Generalized send index tables: configurable base tick and number of categories
  *      BL 2019-12-06: Ticket #302 HIGH_PERF_INDEXED: Rebuild tables completely on tlc_update
  *      BL 2019-10-18: Ticket #287 Enhancement performance while receiving (HIGH_PERF_INDEXED mode)
  *      BL 2019-10-15: Ticket #282 Preset index table size and depth to prevent memory fragmentation
@@ -65,9 +70,7 @@ extern "C" {
     typedef enum
     {
         PERF_IGNORE,
-        PERF_LOW_TABLE,
-        PERF_MID_TABLE,
-        PERF_HIGH_TABLE,
+        PERF_CAT_TABLE,
         PERF_EXT_TABLE
     } PERF_TABLE_TYPE_T;
 
@@ -167,8 +170,8 @@ extern "C" {
 
         vos_printLogStr(VOS_LOG_INFO, "-------------------------------------------------\n");
         vos_printLog(VOS_LOG_INFO,
-                     "----- Time Slots for %4ums cycled packets  -----\n",
-                     (unsigned int) pSlots->slotCycle / 1000u);
+                     "----- Time Slots for %6uus cycled packets -----\n",
+                     (unsigned int) pSlots->slotCycle);
         vos_printLogStr(VOS_LOG_INFO, "----- SlotNo: ComId (Tx-Interval) x depth   -----\n");
         vos_printLogStr(VOS_LOG_INFO, "-------------------------------------------------\n");
         for (slot = 0; slot < pSlots->noOfTxEntries; slot++)
@@ -229,48 +232,155 @@ extern "C" {
         return found;
     }
 
+    /**********************************************************************************************************************/
+    /** Check if the interval is within the range of a category
+     *  The upper limit is inclusive (100ms in the 100ms table, 1s in the 1s table, as with the former fixed
+     *  low/mid tables), except for the highest category, beyond which the extended table takes over.
+     *
+     *  @param[in]      pSlot            pointer to the index tables
+     *  @param[in]      catIdx           index of the category table
+     *  @param[in]      pdInterval       interval in us
+     *
+     *  @retval         TRUE             interval is covered by the category
+     */
+    static BOOL8 perf_category_covers (
+                                       const TRDP_HP_SLOTS_T   *pSlot,
+                                       UINT32                  catIdx,
+                                       UINT64                  pdInterval)
+    {
+        return ((pdInterval < pSlot->cat[catIdx].rangeMax) ||
+                ((pdInterval == pSlot->cat[catIdx].rangeMax) && (catIdx < (pSlot->noOfCategories - 1u))))
+               ? TRUE : FALSE;
+    }
+
     /**********************************************************************************************************************/
     /** Return the category for the index tables
      *
+     *  @param[in]      pSlot            pointer to the index tables
      *  @param[in]      pElement         pointer to the packet element to send
+     *  @param[out]     pCatIdx          index of the category table (valid for PERF_CAT_TABLE only)
      *
      *  @retval         PERF_IGNORE         do not count
-     *                  PERF_LOW_TABLE      low table
-     *                  PERF_MID_TABLE      medium interval times
-     *                  PERF_HIGH_TABLE     slow
+     *                  PERF_CAT_TABLE      one of the slot tables, fastest fitting category in *pCatIdx
+     *                  PERF_EXT_TABLE      interval beyond the highest category
      */
     static PERF_TABLE_TYPE_T   perf_table_category (
-                                                    PD_ELE_T *pElement)
+                                                    const TRDP_HP_SLOTS_T   *pSlot,
+                                                    const PD_ELE_T          *pElement,
+                                                    UINT32                  *pCatIdx)
     {
-        if (pElement->interval.tv_sec == 0u)
+        UINT64  pdInterval;
+        UINT32  catIdx;
+
+        if ((timerisset(&pElement->interval) == 0) ||
+            ((pElement->pktFlags & TRDP_FLAGS_TSN) != 0))            /* Is it a to-be-pulled or a TSN packet? */
         {
-            if ((pElement->interval.tv_usec == 0) ||
-                ((pElement->pktFlags & TRDP_FLAGS_TSN) != 0))            /* Is it a to-be-pulled or a TSN packet? */
-            {
-                return PERF_IGNORE;                         /* do not count */
-            }
-            if (pElement->interval.tv_usec <= TRDP_LOW_CYCLE_LIMIT)
+            return PERF_IGNORE;                         /* do not count */
+        }
+
+        pdInterval = (UINT64) pElement->interval.tv_sec * 1000000u + (UINT64) pElement->interval.tv_usec;
+
+        /* Prefer the fastest category the interval fits into without a remainder (e.g. 10ms does not fit
+           into the 25ms range of a 250us table, but into the 250ms range of the 2.5ms table) */
+        for (catIdx = 0u; catIdx < pSlot->noOfCategories; catIdx++)
+        {
+            const TRDP_HP_CAT_SLOT_T *pCat = &pSlot->cat[catIdx];
+
+            if ((perf_category_covers(pSlot, catIdx, pdInterval) == TRUE) &&
+                ((pCat->rangeMax % pdInterval) == 0u) &&
+                ((pdInterval % pCat->slotCycle) == 0u))
             {
-                return PERF_LOW_TABLE;
+                *pCatIdx = catIdx;
+                return PERF_CAT_TABLE;
             }
-            else if (pElement->interval.tv_usec <= TRDP_MID_CYCLE_LIMIT)
+        }
+        /* Otherwise take the fastest category covering the interval (with additional jitter) */
+        for (catIdx = 0u; catIdx < pSlot->noOfCategories; catIdx++)
+        {
+            if (perf_category_covers(pSlot, catIdx, pdInterval) == TRUE)
             {
-                return PERF_MID_TABLE;
+                *pCatIdx = catIdx;
+                return PERF_CAT_TABLE;
             }
         }
-        else if ((pElement->interval.tv_sec == 1u) &&   /* special case 1 sec. */
-                 (pElement->interval.tv_usec == 0))
+        return PERF_EXT_TABLE;      /* This PD has a higher interval time than our highest category */
+    }
+
+    /**********************************************************************************************************************/
+    /** Compute the slot cycles and limits of all categories from the base tick
+     *
+     *  @param[in,out]  pSlot               pointer to the index tables
+     *  @param[in]      baseCycle           slot cycle of the fastest category in us
+     *  @param[in]      noOfCategories      number of categories to use
+     */
+    static void initCategories (
+                                TRDP_HP_SLOTS_T *pSlot,
+                                UINT32          baseCycle,
+                                UINT32          noOfCategories)
+    {
+        UINT32  catIdx;
+        UINT32  divider = 1u;
+
+        pSlot->baseCycle        = baseCycle;
+        pSlot->noOfCategories   = noOfCategories;
+
+        for (catIdx = 0u; catIdx < noOfCategories; catIdx++)
+        {
+            pSlot->cat[catIdx].slotCycle    = baseCycle * divider;
+            pSlot->cat[catIdx].rangeMax     = pSlot->cat[catIdx].slotCycle * TRDP_SLOTS_PER_CATEGORY;
+            pSlot->cat[catIdx].tickDivider  = divider;
+            /* Serve neighbouring categories in different base ticks to spread the load
+               (default: 10ms table at tick 5, 100ms table at tick 0) */
+            pSlot->cat[catIdx].tickPhase    = ((catIdx % 2u) != 0u) ? (divider / 2u) : 0u;
+            divider *= TRDP_CATEGORY_SCALE;
+        }
+    }
+
+    /**********************************************************************************************************************/
+    /** Check the base tick and number of categories, replace zero values by the defaults
+     *
+     *  @param[in,out]  pBaseCycle          pointer to base tick in us
+     *  @param[in,out]  pNoOfCategories     pointer to number of categories
+     *
+     *  @retval         TRDP_NO_ERR         no error
+     *                  TRDP_PARAM_ERR      unsupported configuration
+     */
+    static TRDP_ERR_T checkCategories (
+                                       UINT32  *pBaseCycle,
+                                       UINT32  *pNoOfCategories)
+    {
+        UINT64  topLimit;
+        UINT32  catIdx;
+
+        if (*pBaseCycle == 0u)
         {
-            return PERF_MID_TABLE;
+            *pBaseCycle = TRDP_DEFAULT_BASE_CYCLE;
         }
-        if ((pElement->interval.tv_sec * 1000000u + pElement->interval.tv_usec) < TRDP_HIGH_CYCLE_LIMIT)
+        if (*pNoOfCategories == 0u)
         {
-            return PERF_HIGH_TABLE;
+            *pNoOfCategories = TRDP_DEFAULT_NO_OF_CATEGORIES;
         }
-        else
+        if ((*pBaseCycle < TRDP_MIN_BASE_CYCLE) ||
+            (*pBaseCycle > TRDP_MAX_CYCLE) ||
+            (*pNoOfCategories > TRDP_MAX_NO_OF_CATEGORIES))
+        {
+            vos_printLog(VOS_LOG_ERROR, "Unsupported index table configuration (base tick %uus, %u categories)\n",
+                         (unsigned int) *pBaseCycle, (unsigned int) *pNoOfCategories);
+            return TRDP_PARAM_ERR;
+        }
+        topLimit = (UINT64) *pBaseCycle * TRDP_SLOTS_PER_CATEGORY;
+        for (catIdx = 1u; catIdx < *pNoOfCategories; catIdx++)
         {
-            return PERF_EXT_TABLE;      /* This PD has a higher interval time than 10s */
+            topLimit *= TRDP_CATEGORY_SCALE;
+        }
+        if (topLimit > TRDP_MAX_CATEGORY_LIMIT)
+        {
+            vos_printLog(VOS_LOG_ERROR, "Highest category would exceed %us (base tick %uus, %u categories)\n",
+                         (unsigned int) (TRDP_MAX_CATEGORY_LIMIT / 1000000u),
+                         (unsigned int) *pBaseCycle, (unsigned int) *pNoOfCategories);
+            return TRDP_PARAM_ERR;
         }
+        return TRDP_NO_ERR;
     }
 
     /**********************************************************************************************************************/
@@ -310,6 +420,15 @@ extern "C" {
         /* How many times do we need to enter this PD? */
         count = pCat->noOfTxEntries * pCat->slotCycle / pdInterval;
 
+        if (((pCat->rangeMax % pdInterval) != 0u) || ((pdInterval % pCat->slotCycle) != 0u))
+        {
+            vos_printLog(VOS_LOG_WARNING,
+                         "Interval of comId %u (%uus) does not fit into range (%uus), expect additional jitter\n",
+                         (unsigned int) pElement->addr.comId,
+                         (unsigned int) pdInterval,
+                         (unsigned int) pCat->rangeMax);
+        }
+
         /* Control: */
         if ((maxStartIdx * count) > pCat->noOfTxEntries)
         {
@@ -391,19 +510,19 @@ extern "C" {
     /**********************************************************************************************************************/
     /** Create an index table
      *
-     *  @param[in]      rangeMax            time range this table shall support (e.g. 100000us for low table)
-     *  @param[in]      cat_noOfTxEntries   interval of callers, i.e. cycle time of calls into each slot (e.g. 1000us for low table)
+     *  @param[in]      cat_noOfTxEntries   number of publishers expected in this category
      *  @param[in]      cat_Depth           preset depth, used if proposed value is smaller
-     *  @param[out]     pCat                pointer to slot / category entry holding the resulting table
+     *  @param[in,out]  pCat                pointer to slot / category entry holding the resulting table,
+     *                                      slotCycle and rangeMax must be set
      */
     static TRDP_ERR_T indexCreatePubTable (
-                                           UINT32              rangeMax,
                                            UINT32              cat_noOfTxEntries,
                                            UINT32              cat_Depth,
                                            TRDP_HP_CAT_SLOT_T  *pCat)
     {
+        UINT32 rangeMax = pCat->rangeMax;
         /* Number of needed array entries for the lower range */
-        /* First dimension / number of slots is rangeMax (e.g. 100ms) / processCycle */
+        /* First dimension / number of slots is rangeMax (e.g. 100ms) / slot cycle (e.g. 1ms) */
         UINT32 slots = rangeMax / pCat->slotCycle;
 
 
@@ -418,15 +537,6 @@ extern "C" {
             depth = cat_Depth;
         }
 
-        if ((rangeMax % pCat->slotCycle) > 0)
-        {
-            vos_printLog(VOS_LOG_WARNING,
-                         "Process cycle time (%ums) should be an integral value of range (%ums)\n",
-                         (unsigned int) pCat->slotCycle / 1000, (unsigned int) rangeMax / 1000u);
-            vos_printLogStr(VOS_LOG_WARNING,
-                            "Current cycle time will introduce larger jitter, optimal values are e.g.: 1, 2, 4, 5, 10ms\n");
-        }
-
         /* depth must be at least 1 ! */
         if (depth > 255u)
         {
@@ -474,8 +584,8 @@ extern "C" {
 
 
         vos_printLog(VOS_LOG_INFO,
-                     "Process cycle time: %ums, PDs < %ums: %u telegrams, (re-)allocating table[%u][%u] %ukByte\n",
-                     (unsigned int) pCat->slotCycle / 1000u,
+                     "Slot cycle time: %uus, PDs < %ums: %u telegrams, (re-)allocating table[%u][%u] %ukByte\n",
+                     (unsigned int) pCat->slotCycle,
                      (unsigned int) rangeMax / 1000u,
                      (unsigned int) cat_noOfTxEntries,
                      (unsigned int) slots,
@@ -544,10 +654,8 @@ extern "C" {
                 return TRDP_MEM_ERR;
             }
 
-            /* prevent division with zero during initialisation */
-            appHandle->pSlot->lowCat.slotCycle  = TRDP_LOW_CYCLE;   /* the lowest table can be called with 1ms cycle      */
-            appHandle->pSlot->midCat.slotCycle  = TRDP_MID_CYCLE;   /* the mid table will always be called in 10ms steps  */
-            appHandle->pSlot->highCat.slotCycle = TRDP_HIGH_CYCLE;  /* the hi table will always be called in 100ms steps  */
+            /* prevent division with zero during initialisation, default is 1ms / 10ms / 100ms slot cycles */
+            initCategories(appHandle->pSlot, TRDP_DEFAULT_BASE_CYCLE, TRDP_DEFAULT_NO_OF_CATEGORIES);
             /* The index tables will be allocated later */
         }
         return TRDP_NO_ERR;
@@ -567,17 +675,15 @@ extern "C" {
         /* if not already done, allocate some work space: */
         if (appHandle->pSlot != NULL)
         {
-            if (appHandle->pSlot->lowCat.ppIdxCat != NULL)
-            {
-                vos_memFree(appHandle->pSlot->lowCat.ppIdxCat);
-            }
-            if (appHandle->pSlot->midCat.ppIdxCat != NULL)
-            {
-                vos_memFree(appHandle->pSlot->midCat.ppIdxCat);
-            }
-            if (appHandle->pSlot->highCat.ppIdxCat != NULL)
+            UINT32 catIdx;
+
+            /* tables of previously used categories might still be allocated */
+            for (catIdx = 0u; catIdx < TRDP_MAX_NO_OF_CATEGORIES; catIdx++)
             {
-                vos_memFree(appHandle->pSlot->highCat.ppIdxCat);
+                if (appHandle->pSlot->cat[catIdx].ppIdxCat != NULL)
+                {
+                    vos_memFree(appHandle->pSlot->cat[catIdx].ppIdxCat);
+                }
             }
             if (appHandle->pSlot->pRcvTableComId != NULL)
             {
@@ -602,6 +708,8 @@ extern "C" {
      *  tables for the separate time-classes need to be provided, too.
      *
      *  @param[in]      appHandle                   The application handle
+     *  @param[in]      baseCycle                   slot cycle of the fastest category in us (0 = default)
+     *  @param[in]      noOfCategories              number of time slot categories (0 = default)
      *  @param[in]      maxNoOfSubscriptions        max. expected number of subscriptions
      *  @param[in]      maxNoOfLowCatPublishers     max. expected number of publishers
      *  @param[in]      maxDepthOfLowCatPublishers  max. depth of publishers
@@ -613,10 +721,13 @@ extern "C" {
      *
      *  @retval         TRDP_NO_ERR     no error
      *                  TRDP_MEM_ERR    not enough memory
+     *                  TRDP_PARAM_ERR  unsupported base tick / number of categories
      */
 
     TRDP_ERR_T  trdp_indexAllocTables (
                                        TRDP_SESSION_PT appHandle,
+                                       UINT32          baseCycle,
+                                       UINT32          noOfCategories,
                                        UINT32          maxNoOfSubscriptions,
                                        UINT32          maxNoOfLowCatPublishers,
                                        UINT32          maxDepthOfLowCatPublishers,
@@ -626,20 +737,34 @@ extern "C" {
                                        UINT32          maxDepthOfHighCatPublishers,
                                        UINT32          maxNoOfExtPublishers)
     {
-        TRDP_ERR_T err = TRDP_NO_ERR;
+        TRDP_ERR_T  err = TRDP_NO_ERR;
+        UINT32      catIdx;
 
-        err = indexCreatePubTable(TRDP_LOW_CYCLE_LIMIT, maxNoOfLowCatPublishers,
-                                  maxDepthOfLowCatPublishers, &appHandle->pSlot->lowCat);
-        if (err == TRDP_NO_ERR)
+        err = checkCategories(&baseCycle, &noOfCategories);
+        if (err != TRDP_NO_ERR)
         {
-            err = indexCreatePubTable(TRDP_MID_CYCLE_LIMIT, maxNoOfMidCatPublishers,
-                                      maxDepthOfMidCatPublishers, &appHandle->pSlot->midCat);
+            return err;
         }
+        initCategories(appHandle->pSlot, baseCycle, noOfCategories);
 
-        if (err == TRDP_NO_ERR)
+        /* The sizing hints are given for the classic 100ms / 1000ms / 10s ranges,
+           apply them to each category by its upper interval limit */
+        for (catIdx = 0u; (catIdx < noOfCategories) && (err == TRDP_NO_ERR); catIdx++)
         {
-            err = indexCreatePubTable(TRDP_HIGH_CYCLE_LIMIT, maxNoOfHighCatPublishers,
-                                      maxDepthOfHighCatPublishers, &appHandle->pSlot->highCat);
+            TRDP_HP_CAT_SLOT_T *pCat = &appHandle->pSlot->cat[catIdx];
+
+            if (pCat->rangeMax <= TRDP_LOW_CYCLE_LIMIT)
+            {
+                err = indexCreatePubTable(maxNoOfLowCatPublishers, maxDepthOfLowCatPublishers, pCat);
+            }
+            else if (pCat->rangeMax <= TRDP_MID_CYCLE_LIMIT)
+            {
+                err = indexCreatePubTable(maxNoOfMidCatPublishers, maxDepthOfMidCatPublishers, pCat);
+            }
+            else
+            {
+                err = indexCreatePubTable(maxNoOfHighCatPublishers, maxDepthOfHighCatPublishers, pCat);
+            }
         }
 
         /* We must be prepared for additional packets outside of the indexed time slots.    */
@@ -802,11 +927,9 @@ extern "C" {
     {
         TRDP_ERR_T      err = TRDP_NO_ERR;
         UINT32          processCycle            = TRDP_DEFAULT_CYCLE;
-        UINT32          lowCat_noOfTxEntries    = 0u;
-        UINT32          midCat_noOfTxEntries    = 0u;
-        UINT32          highCat_noOfTxEntries   = 0u;
+        UINT32          cat_noOfTxEntries[TRDP_MAX_NO_OF_CATEGORIES] = {0u};
         UINT32          extCat_noOfTxEntries    = 0u;
-        UINT32          idx, depth;
+        UINT32          idx, depth, catIdx;
         TRDP_HP_SLOTS_T *pSlot;
 
         /* Check the parameters */
@@ -815,37 +938,39 @@ extern "C" {
         {
             processCycle = appHandle->stats.processCycle;   /* Take the value from the process configuration, if set */
         }
-        /* the smallest array in 500us...5000us steps */
+        pSlot = appHandle->pSlot;
+
+        /* the process cycle must be a multiple of the base tick (0.1ms...10ms) */
         if ((processCycle < TRDP_MIN_CYCLE) ||
-            (processCycle > TRDP_MAX_CYCLE))
+            (processCycle > TRDP_MAX_CYCLE) ||
+            (processCycle < pSlot->baseCycle))
         {
-            vos_printLog(VOS_LOG_ERROR, "trdp_indexCreatePubTables Failed! processCycle %d : Not between 1000 to 10000...\n", processCycle);
+            vos_printLog(VOS_LOG_ERROR,
+                         "trdp_indexCreatePubTables Failed! processCycle %u : Not between %u to %u...\n",
+                         (unsigned int) processCycle, (unsigned int) pSlot->baseCycle, (unsigned int) TRDP_MAX_CYCLE);
             return TRDP_PARAM_ERR;
         }
-
-        pSlot = appHandle->pSlot;
+        if ((processCycle % pSlot->baseCycle) != 0u)
+        {
+            vos_printLog(VOS_LOG_WARNING,
+                         "Process cycle time (%uus) should be an integral multiple of the base tick (%uus)\n",
+                         (unsigned int) processCycle, (unsigned int) pSlot->baseCycle);
+            vos_printLogStr(VOS_LOG_WARNING,
+                            "Current cycle time will introduce larger jitter!\n");
+        }
 
         /* Initialize the table entries */
         pSlot->processCycle         = processCycle;      /* cycle time in us with which we will be called      */
-        pSlot->lowCat.slotCycle     = TRDP_LOW_CYCLE;    /* the lowest table can be called with 1ms cycle     */
-        pSlot->midCat.slotCycle     = TRDP_MID_CYCLE;    /* the mid table will always be called in 10ms steps  */
-        pSlot->highCat.slotCycle    = TRDP_HIGH_CYCLE;   /* the hi table will always be called in 100ms steps  */
 
         /* get the number of PDs to be sent and allocate enough pointer space    */
         {
             PD_ELE_T *pPDsend = appHandle->pSndQueue;
             while (pPDsend != NULL)
             {
-                switch (perf_table_category(pPDsend))
+                switch (perf_table_category(pSlot, pPDsend, &catIdx))
                 {
-                    case PERF_LOW_TABLE:
-                        lowCat_noOfTxEntries++;
-                        break;
-                    case PERF_MID_TABLE:
-                        midCat_noOfTxEntries++;
-                        break;
-                    case PERF_HIGH_TABLE:
-                        highCat_noOfTxEntries++;
+                    case PERF_CAT_TABLE:
+                        cat_noOfTxEntries[catIdx]++;
                         break;
                     case PERF_EXT_TABLE:
                         extCat_noOfTxEntries++;
@@ -862,8 +987,8 @@ extern "C" {
         {
             if (extCat_noOfTxEntries > 255)
             {
-                vos_printLog(VOS_LOG_ERROR, "More than 255 PDs with interval > %us are not supported!\n",
-                             TRDP_HIGH_CYCLE_LIMIT / 1000000u);
+                vos_printLog(VOS_LOG_ERROR, "More than 255 PDs with interval > %ums are not supported!\n",
+                             (unsigned int) (pSlot->cat[pSlot->noOfCategories - 1u].rangeMax / 1000u));
                 return TRDP_PARAM_ERR;
             }
             /* create the extended list, if not yet done or needed  */
@@ -892,46 +1017,20 @@ extern "C" {
         }
 
         /* These are now checks to prevent a possible table overflow in case the pre-allocated tables are too small! */
-        err = indexCreatePubTable(TRDP_LOW_CYCLE_LIMIT, lowCat_noOfTxEntries,
-                                  pSlot->lowCat.depthOfTxEntries, &pSlot->lowCat);
-        if (err == TRDP_NO_ERR)
-        {
-            err = indexCreatePubTable(TRDP_MID_CYCLE_LIMIT, midCat_noOfTxEntries,
-                                      pSlot->midCat.depthOfTxEntries, &pSlot->midCat);
-        }
-        if (err == TRDP_NO_ERR)
+        for (catIdx = 0u; (catIdx < pSlot->noOfCategories) && (err == TRDP_NO_ERR); catIdx++)
         {
-            err = indexCreatePubTable(TRDP_HIGH_CYCLE_LIMIT, highCat_noOfTxEntries,
-                                      pSlot->highCat.depthOfTxEntries, &pSlot->highCat);
-        }
+            TRDP_HP_CAT_SLOT_T *pCat = &pSlot->cat[catIdx];
 
-        /* Empty the low-cat slots */
-        for (idx = 0u; idx < pSlot->lowCat.noOfTxEntries; idx++)
-        {
-            for (depth = 0u; depth < pSlot->lowCat.depthOfTxEntries; depth++)
-            {
-                /* remove it */
-                setElement(&pSlot->lowCat, idx, depth, NULL);
-            }
-        }
-
-        /* Empty the mid-cat slots */
-        for (idx = 0u; idx < pSlot->midCat.noOfTxEntries; idx++)
-        {
-            for (depth = 0u; depth < pSlot->midCat.depthOfTxEntries; depth++)
-            {
-                /* remove it */
-                setElement(&pSlot->midCat, idx, depth, NULL);
-            }
-        }
+            err = indexCreatePubTable(cat_noOfTxEntries[catIdx], pCat->depthOfTxEntries, pCat);
 
-        /* Empty the high-cat slots */
-        for (idx = 0u; idx < pSlot->highCat.noOfTxEntries; idx++)
-        {
-            for (depth = 0u; depth < pSlot->highCat.depthOfTxEntries; depth++)
+            /* Empty the slots */
+            for (idx = 0u; (err == TRDP_NO_ERR) && (idx < pCat->noOfTxEntries); idx++)
             {
-                /* remove it */
-                setElement(&pSlot->highCat, idx, depth, NULL);
+                for (depth = 0u; depth < pCat->depthOfTxEntries; depth++)
+                {
+                    /* remove it */
+                    setElement(pCat, idx, depth, NULL);
+                }
             }
         }
 
@@ -945,16 +1044,10 @@ extern "C" {
                    (err == TRDP_NO_ERR))
             {
                 /* Decide whitch array to fill */
-                switch (perf_table_category(pPDsend))
+                switch (perf_table_category(pSlot, pPDsend, &catIdx))
                 {
-                    case PERF_LOW_TABLE:
-                        err = distribute(&pSlot->lowCat, pPDsend);
-                        break;
-                    case PERF_MID_TABLE:
-                        err = distribute(&pSlot->midCat, pPDsend);
-                        break;
-                    case PERF_HIGH_TABLE:
-                        err = distribute(&pSlot->highCat, pPDsend);
+                    case PERF_CAT_TABLE:
+                        err = distribute(&pSlot->cat[catIdx], pPDsend);
                         break;
                     case PERF_EXT_TABLE:
                         pSlot->pExtTxTable[extCat_noOfTxEntries] = pPDsend;
@@ -972,9 +1065,10 @@ extern "C" {
                 pPDsend = pPDsend->pNext;
             }
 #ifdef DEBUG
-            print_table(&pSlot->lowCat);
-            print_table(&pSlot->midCat);
-            print_table(&pSlot->highCat);
+            for (catIdx = 0u; catIdx < pSlot->noOfCategories; catIdx++)
+            {
+                print_table(&pSlot->cat[catIdx]);
+            }
 #endif
         }
         return err;
@@ -1061,102 +1155,102 @@ extern "C" {
         TRDP_ERR_T      err, result = TRDP_NO_ERR;
 
         /* Compute the indexes from the current cycle */
-        UINT32          idxLow, idxMid, idxHigh;
+        UINT32          catIdx, slotIdx;
         UINT32          depth;
         TRDP_HP_SLOTS_T *pSlot = appHandle->pSlot;
         PD_ELE_T        *pCurElement;
         UINT32          i;
+        UINT32          reqCat, lastCat;
+        TRDP_TIME_T     now, latest, launch;
+        TRDP_TIME_T     baseTick;
 
         if (appHandle->pSlot == NULL)
         {
             return TRDP_BLOCK_ERR;
         }
 
-
-        /* In case we are called less often than 1ms, we'll loop over the index table */
-        for (i = 0u; i < pSlot->processCycle; i += TRDP_MIN_CYCLE)
+        /* Packets on txTime sockets are handed to the kernel one process cycle ahead of their launch time.
+           The launch times follow the base tick; they are re-anchored if we were called too late or too early. */
+        vos_getTime(&now);
+        latest = now;
+        launch.tv_sec   = (time_t) (pSlot->processCycle / 1000000u);
+        launch.tv_usec  = (suseconds_t) (pSlot->processCycle % 1000000u);
+        vos_addTime(&latest, &launch);
+        vos_addTime(&latest, &launch);
+        if (!timerisset(&pSlot->nextLaunch) ||
+            timercmp(&pSlot->nextLaunch, &now, <) ||
+            timercmp(&pSlot->nextLaunch, &latest, >))
         {
-            /* cycleN is the Nth send cycle in us */
-            UINT32 cycleN = pSlot->currentCycle;
+            pSlot->nextLaunch = now;
+            vos_addTime(&pSlot->nextLaunch, &launch);
+        }
+        launch = pSlot->nextLaunch;
+        baseTick.tv_sec     = (time_t) (pSlot->baseCycle / 1000000u);
+        baseTick.tv_usec    = (suseconds_t) (pSlot->baseCycle % 1000000u);
 
-            idxLow = (cycleN / pSlot->lowCat.slotCycle) % pSlot->lowCat.noOfTxEntries;
+        /* PD requests are checked with the second category (10ms by default), late PDs with the last one (100ms) */
+        lastCat = pSlot->noOfCategories - 1u;
+        reqCat  = (lastCat > 0u) ? 1u : 0u;
+
+        /* In case we are called less often than the base tick, we'll loop over the index table */
+        for (i = 0u; i < pSlot->processCycle; i += pSlot->baseCycle)
+        {
+            /* cycleN is the Nth send cycle in us, tick the Nth base tick */
+            UINT32  cycleN  = pSlot->currentCycle;
+            UINT32  tick    = cycleN / pSlot->baseCycle;
 
             /* send the packets with the shortest intervals first */
-            for (depth = 0u; depth < pSlot->lowCat.depthOfTxEntries; depth++)
+            for (catIdx = 0u; catIdx < pSlot->noOfCategories; catIdx++)
             {
-                pCurElement = getElement(&pSlot->lowCat, idxLow, depth);
-                if (pCurElement == NULL)
-                {
-                    break;
-                }
-                err = trdp_pdSendElement(appHandle, &pCurElement);
-                if (err != TRDP_NO_ERR)
+                TRDP_HP_CAT_SLOT_T *pCat = &pSlot->cat[catIdx];
+
+                if ((tick % pCat->tickDivider) != pCat->tickPhase)
                 {
-                    result = err;   /* return first error, only. Keep on sending... */
+                    continue;   /* not this category's turn */
                 }
-            }
 
-            if ((idxLow % 10) == 5u)
-            {
-                idxMid = (cycleN / pSlot->midCat.slotCycle) % pSlot->midCat.noOfTxEntries;
+                slotIdx = (cycleN / pCat->slotCycle) % pCat->noOfTxEntries;
 
-                /* send the packets with medium intervals */
-                for (depth = 0; depth < pSlot->midCat.depthOfTxEntries; depth++)
+                for (depth = 0u; depth < pCat->depthOfTxEntries; depth++)
                 {
-                    pCurElement = getElement(&pSlot->midCat, idxMid, depth);
+                    pCurElement = getElement(pCat, slotIdx, depth);
                     if (pCurElement == NULL)
                     {
                         break;
                     }
-                    err = trdp_pdSendElement(appHandle, &pCurElement);
+                    err = trdp_pdSendElement(appHandle, &pCurElement, &launch);
                     if (err != TRDP_NO_ERR)
                     {
                         result = err;   /* return first error, only. Keep on sending... */
                     }
                 }
 
-                /* We check for PD Requests in the send queue every 10ms */
-                while ((appHandle->pSndQueue != NULL) &&
-                       (appHandle->pSndQueue->privFlags & TRDP_REQ_2B_SENT) &&
-                       (appHandle->pSndQueue->pFrame != NULL) &&
-                       (appHandle->pSndQueue->pFrame->frameHead.msgType == vos_htons(TRDP_MSG_PR)))
+                if (catIdx == reqCat)
                 {
-                    /* Defensive programming: Prohibit endless loop! */
-                    PD_ELE_T *pBefore = appHandle->pSndQueue;
-                    err = trdp_pdSendElement(appHandle, &appHandle->pSndQueue);
-                    if (err != TRDP_NO_ERR)
-                    {
-                        result = err;   /* return first error, only. Keep on sending... */
-                    }
-                    if (appHandle->pSndQueue == pBefore)
+                    /* We check for PD Requests in the send queue */
+                    while ((appHandle->pSndQueue != NULL) &&
+                           (appHandle->pSndQueue->privFlags & TRDP_REQ_2B_SENT) &&
+                           (appHandle->pSndQueue->pFrame != NULL) &&
+                           (appHandle->pSndQueue->pFrame->frameHead.msgType == vos_htons(TRDP_MSG_PR)))
                     {
-                        break;  /* In case the request wasn't removed */
+                        /* Defensive programming: Prohibit endless loop! */
+                        PD_ELE_T *pBefore = appHandle->pSndQueue;
+                        err = trdp_pdSendElement(appHandle, &appHandle->pSndQueue, NULL);
+                        if (err != TRDP_NO_ERR)
+                        {
+                            result = err;   /* return first error, only. Keep on sending... */
+                        }
+                        if (appHandle->pSndQueue == pBefore)
+                        {
+                            break;  /* In case the request wasn't removed */
+                        }
                     }
                 }
-            }
-            if (idxLow == 0u)       /* Every 100ms check the > 1s PDs   */
-            {
-                idxHigh = (cycleN / pSlot->highCat.slotCycle) % pSlot->highCat.noOfTxEntries;
 
-                /* send the slowest packets */
-                for (depth = 0; depth < pSlot->highCat.depthOfTxEntries; depth++)
-                {
-                    pCurElement = getElement(&pSlot->highCat, idxHigh, depth);
-                    if (pCurElement == NULL)
-                    {
-                        break;
-                    }
-                    err = trdp_pdSendElement(appHandle, &pCurElement);
-                    if (err != TRDP_NO_ERR)
-                    {
-                        result = err;   /* return first error, only. Keep on sending... */
-                    }
-                }
-                /* Every 100ms we check here for packets with intervals beyond our upper limit */
-                if (pSlot->noOfExtTxEntries != 0)
+                /* With the slowest category we check here for packets with intervals beyond our upper limit */
+                if ((catIdx == lastCat) &&
+                    (pSlot->noOfExtTxEntries != 0))
                 {
-                    TRDP_TIME_T now;
-
                     /*    Get the current time    */
                     vos_getTime(&now);
 
@@ -1167,18 +1261,24 @@ extern "C" {
                             /*  Set timer if interval was set.                     */
                             vos_addTime(&pSlot->pExtTxTable[depth]->timeToGo,
                                         &pSlot->pExtTxTable[depth]->interval);
-                            (void) trdp_pdSendElement(appHandle, &pSlot->pExtTxTable[depth]);
+                            (void) trdp_pdSendElement(appHandle, &pSlot->pExtTxTable[depth], NULL);
                         }
                     }
                 }
             }
             /* We count the numbers of cycles, an overflow does not matter! */
-            pSlot->currentCycle += TRDP_MIN_CYCLE;
-            if (pSlot->currentCycle >= (pSlot->highCat.noOfTxEntries * pSlot->highCat.slotCycle))
+            pSlot->currentCycle += pSlot->baseCycle;
+            if (pSlot->currentCycle >= pSlot->cat[lastCat].rangeMax)
             {
                 pSlot->currentCycle = 0u;
             }
+            vos_addTime(&launch, &baseTick);
         }
+        pSlot->nextLaunch = launch;
+
+        trdp_pdFlushPosted(appHandle);
+        trdp_pdCollectTxStamps(appHandle);
+
         return result;
     }
 
@@ -1386,6 +1486,12 @@ extern "C" {
                 }
             }
         }
+#ifdef XDP_SUPPORT
+        trdp_pdCheckPendingXdp(appHandle, pFileDesc, pNoDesc);
+#endif
+#ifdef URING_SUPPORT
+        trdp_pdCheckPendingUring(appHandle, pFileDesc, pNoDesc);
+#endif
     }
 
     /******************************************************************************/
@@ -1405,23 +1511,14 @@ extern "C" {
             return;
         }
 
-        /* Find the packet in the short list */
-        if (removePub(&appHandle->pSlot->lowCat, pElement) != 0)
+        /* Find the packet in the category tables */
+        for (idx = 0u; idx < pSlot->noOfCategories; idx++)
         {
-            /* it can only be in one of these */
-            return;
-        }
-        /* Find the packet in the short list */
-        if (removePub(&appHandle->pSlot->midCat, pElement) != 0)
-        {
-            /* it can only be in one of these */
-            return;
-        }
-        /* Find the packet in the short list */
-        if (removePub(&appHandle->pSlot->highCat, pElement) != 0)
-        {
-            /* it can only be in one of these */
-            return;
+            if (removePub(&pSlot->cat[idx], pElement) != 0)
+            {
+                /* it can only be in one of these */
+                return;
+            }
         }
 
         /* Must be an extended interval entry */
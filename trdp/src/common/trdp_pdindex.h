@@ -17,6 +17,8 @@
 /*
  * $Id$
  *
+ *      AG 2026-10-19: Launch time of the next base tick for txTime sockets
+ *      AG 2026-10-19: Configurable base tick (down to 100us) and number of send categories
  *      BL 2019-10-15: Ticket #282 Preset index table size and depth to prevent memory fragmentation
  *      BL 2019-07-10: Ticket #162 Independent handling of PD and MD to reduce jitter
  *      BL 2019-07-10: Ticket #161 Increase performance
@@ -43,16 +45,24 @@
 
 /** Supported and recomended cycle times for the tlp_processTransmit loop   */
 #define TRDP_DEFAULT_CYCLE      1000u
-#define TRDP_MIN_CYCLE          1000u
+#define TRDP_MIN_CYCLE          100u
 #define TRDP_MAX_CYCLE          10000u
 
-#define TRDP_LOW_CYCLE          1000                    /* 1...99ms         */
-#define TRDP_MID_CYCLE          10000                   /* 100ms...990ms    */
-#define TRDP_HIGH_CYCLE         100000                  /* >= 1000ms        */
-
-#define TRDP_LOW_CYCLE_LIMIT    100000                  /* 0.5...100ms      */
-#define TRDP_MID_CYCLE_LIMIT    1000000                 /* 101ms...1000ms   */
-#define TRDP_HIGH_CYCLE_LIMIT   10000000                /* > 1000ms         */
+/** Base tick (slot cycle of the fastest category) and number of categories of the send index tables.
+    Each category holds TRDP_SLOTS_PER_CATEGORY slots, the slot cycle of the next category is
+    TRDP_CATEGORY_SCALE times larger. With the defaults this results in:
+        1ms slots for intervals <= 100ms, 10ms slots for intervals <= 1000ms, 100ms slots for intervals < 10s */
+#define TRDP_DEFAULT_BASE_CYCLE         1000u                   /**< default base tick in us                    */
+#define TRDP_MIN_BASE_CYCLE             100u                    /**< smallest supported base tick in us         */
+#define TRDP_DEFAULT_NO_OF_CATEGORIES   3u                      /**< 1ms/10ms/100ms slot cycles                 */
+#define TRDP_MAX_NO_OF_CATEGORIES       5u
+#define TRDP_SLOTS_PER_CATEGORY         100u
+#define TRDP_CATEGORY_SCALE             10u
+#define TRDP_MAX_CATEGORY_LIMIT         100000000u              /**< upper bound of highest category: 100s      */
+
+/** Sizing hints of TRDP_IDX_TABLE_T are applied to the categories by their upper interval limit   */
+#define TRDP_LOW_CYCLE_LIMIT    100000u                 /* 0.5...100ms      */
+#define TRDP_MID_CYCLE_LIMIT    1000000u                /* 101ms...1000ms   */
 
 /** Default table size settings in HIGH_PERF_INDEXED Mode  */
 #define TRDP_DEFAULT_INDEX_SIZES  {100,     /**< Max. number of expected subscriptions with intervals <= 100ms  */ \
@@ -64,7 +74,9 @@
                                    15,      /**< depth / overlapped publishers with intervals <= 1000ms         */ \
                                    10,      /**< Max. number of expected publishers with intervals <= 10000ms   */ \
                                    5,       /**< depth / overlapped publishers with intervals <= 10000ms        */ \
-                                   10  }    /**< Max. number of expected publishers with intervals > 10000ms    */
+                                   10,      /**< Max. number of expected publishers with intervals > 10000ms    */ \
+                                   TRDP_DEFAULT_BASE_CYCLE,         /**< base tick of the index tables in us    */ \
+                                   TRDP_DEFAULT_NO_OF_CATEGORIES }  /**< number of time slot categories         */
 
 
 /***********************************************************************************************************************
@@ -73,10 +85,13 @@
 
 /* Definitions for the transmitter optimisation */
 
-/** Low cycle-time slots */
+/** Time slots of one category */
 typedef struct hp_slot
 {
     UINT32          slotCycle;                          /**< cycle time with which each slot will be called (us)    */
+    UINT32          rangeMax;                           /**< upper interval limit of this category (us)             */
+    UINT32          tickDivider;                        /**< slotCycle in multiples of the base tick                */
+    UINT32          tickPhase;                          /**< base tick offset at which this category is served      */
     UINT8           noOfTxEntries;                      /**< no of slots == first array dimension                   */
     UINT8           depthOfTxEntries;                   /**< depth of slots == second array dimension               */
     const PD_ELE_T  * *ppIdxCat;                        /**< pointer to an array of PD_ELE_T* (dim[depth][slot])    */
@@ -92,10 +107,11 @@ typedef struct hp_slots
 {
     UINT32              processCycle;                   /**< system cycle time with which lowest array will be called */
     UINT32              currentCycle;                   /**< the current cycle of the send loop                       */
+    TRDP_TIME_T         nextLaunch;                     /**< launch time of currentCycle (txTime sockets only)        */
 
-    TRDP_HP_CAT_SLOT_T  lowCat;                         /**< array dim[slot][depth]          */
-    TRDP_HP_CAT_SLOT_T  midCat;                         /**< array dim[slot][depth]          */
-    TRDP_HP_CAT_SLOT_T  highCat;                        /**< array dim[slot][depth]          */
+    UINT32              baseCycle;                      /**< slot cycle of the fastest category (us)                  */
+    UINT32              noOfCategories;                 /**< number of used entries in cat[]                          */
+    TRDP_HP_CAT_SLOT_T  cat[TRDP_MAX_NO_OF_CATEGORIES]; /**< arrays dim[slot][depth], fastest first                   */
 
     UINT32              noOfRxEntries;                  /**< number of subscribed PDs to be handled             */
     PD_ELE_T            * *pRcvTableComId;              /**< Pointer to sorted array of PDs to be handled       */
@@ -113,6 +129,8 @@ TRDP_ERR_T  trdp_indexInit (TRDP_SESSION_PT appHandle);
 void        trdp_indexDeInit (TRDP_SESSION_PT appHandle);
 
 TRDP_ERR_T  trdp_indexAllocTables (TRDP_SESSION_PT  appHandle,
+                                   UINT32           baseCycle,
+                                   UINT32           noOfCategories,
                                    UINT32           maxNoOfSubscriptions,
                                    UINT32           maxNoOfLowCatPublishers,
                                    UINT32           maxDepthOfLowCatPublishers,
@@ -17,6 +17,26 @@
 /*
  * $Id$
  *
+ *      AG 2026-10-19: TX timestamp references keyed by the id handed to the kernel, txStampSync
+ *      AG 2026-10-19: Redundancy group counts its publishers and PD requests
+ *      AG 2026-10-19: Batch being reported (pBatchCb, batchCbPos)
+ *      AG 2026-10-19: Subscription in its direct callback (pCbSub)
+ *      AG 2026-10-19: Launch time state of txTime sockets (fallback without ETF qdisc)
+ *      AG 2026-10-19: Busy polling receive (spin budget, SO_BUSY_POLL time)
+ *      AG 2026-10-19: io_uring for PD (URING_SUPPORT)
+ *      AG 2026-10-19: AF_XDP socket for PD (XDP_SUPPORT)
+ *      AG 2026-10-19: Payload shared by the sessions of a multi-destination notify/request
+ *      AG 2026-10-19: RTT estimation per MD peer, adaptive retry timeout
+ *      AG 2026-10-19: MD payload by reference, zero copy send state per socket
+ *      AG 2026-10-19: Redundancy groups with a leadership flag per group
+ *      AG 2026-10-19: Change filter per subscription
+ *      AG 2026-10-19: Batch of telegrams updated in a receive pass
+ *      AG 2026-10-19: Deferred PD callback delivery by a pool of callback threads
+ *      AG 2026-10-19: Arrival time of the last received packet in PD_ELE_T / MD_ELE_T
+ *      AG 2026-10-19: Session flag for in-kernel comId filtering
+ *      AG 2026-10-19: Histograms per PD element
+ *      AG 2026-10-19: TX timestamp reference ring per socket, TX statistics per publisher
+ *      AG 2026-10-19: HIGH_PERF_INDEXED: timer granularity lowered to 100us
  *      CK 2020-04-06: Ticket #318 Added pointer to list of seqCnt used per comId for PD Requests in TRDP_SESSION_T
  *      SB 2020-03-30: Ticket #309 Added pointer to a Session's Listener
  *      BL 2020-02-26: Ticket #319 Protocol Version is defined twice
@@ -78,7 +98,7 @@
                             STR_EXPAND(TRDP_UPDATE) "." STR_EXPAND(TRDP_EVOLUTION)
 
 #ifdef HIGH_PERF_INDEXED
-#   define TRDP_TIMER_GRANULARITY          500u                     /**< granularity in us - we allow 0.5ms now!      */
+#   define TRDP_TIMER_GRANULARITY          100u                     /**< granularity in us - we allow 0.1ms now!      */
 #else
 #   define TRDP_TIMER_GRANULARITY          5000u                    /**< granularity in us - we allow 5ms now!        */
 #endif
@@ -108,6 +128,23 @@
 
 #define TRDP_SEQ_CNT_START_ARRAY_SIZE   64u                         /**< This should be enough for the start          */
 
+#define TRDP_TX_STAMP_REFS              64u                         /**< outstanding TX timestamps per txTime socket  */
+#define TRDP_LAUNCH_PROBES              TRDP_TX_STAMP_REFS          /**< packets sent ahead without a verifying stamp */
+
+#define TRDP_PD_CB_MAX_THREADS          16u                         /**< max. callback threads of a session           */
+#define TRDP_PD_CB_QUEUE_SIZE           1024u                       /**< pending subscriptions, must be a power of 2  */
+#ifdef TSN_SUPPORT
+#define TRDP_PD_CB_DATA_SIZE            TRDP_MAX_PD2_DATA_SIZE
+#else
+#define TRDP_PD_CB_DATA_SIZE            TRDP_MAX_PD_DATA_SIZE
+#endif
+
+#define TRDP_XDP_RX_BATCH               64u                         /**< PD frames read from AF_XDP at once           */
+#define TRDP_URING_RX_BATCH             64u                         /**< PD frames taken from io_uring at once        */
+
+#define TRDP_MD_PEER_CNT                16u                         /**< MD peers with RTT estimation per session     */
+#define TRDP_MD_MIN_RETRY_TIMEOUT       10000u                      /**< [us] default lower bound of adaptive retries */
+
 #define TRDP_IF_WAIT_FOR_READY          120u        /**< 120 seconds (120 tries each second to bind to an IP address) */
 
 #ifdef SOA_SUPPORT
@@ -168,6 +205,22 @@ typedef enum
     TRDP_SOCK_PD_TSN    = 4u,               /**< Socket is used for TSN process data                    */
 } TRDP_SOCK_TYPE_T;
 
+/** Zero copy state of a socket    */
+typedef enum
+{
+    TRDP_ZC_UNKNOWN     = 0u,               /**< not yet tried                                          */
+    TRDP_ZC_ENABLED     = 1u,               /**< zero copy sends possible                               */
+    TRDP_ZC_UNSUPPORTED = 2u                /**< not supported by the target or the kernel              */
+} TRDP_ZC_STATE_T;
+
+/** Launch time state of a txTime socket    */
+typedef enum
+{
+    TRDP_LAUNCH_UNKNOWN = 0u,               /**< not yet verified by a TX timestamp                     */
+    TRDP_LAUNCH_ENABLED = 1u,               /**< launch times are honoured (ETF qdisc)                  */
+    TRDP_LAUNCH_IGNORED = 2u                /**< packets leave early or unverifiable: send at due time  */
+} TRDP_LAUNCH_STATE_T;
+
 /** Hidden handle definition, used as unique addressing item    */
 typedef struct TRDP_HANDLE
 {
@@ -216,6 +269,87 @@ typedef struct TRDP_SOCKET_TCP
     BOOL8           morituri;                           /**< about to die                                 */
 } TRDP_SOCKET_TCP_T;
 
+/** Maps the key of a TX timestamp (SOF_TIMESTAMPING_OPT_ID, ee_data) back to the sending publisher */
+typedef struct TRDP_TX_STAMP_REF
+{
+    UINT32          id;                                 /**< key the kernel reports with the TX timestamp */
+    struct PD_ELE   *pElement;                          /**< publisher which sent the packet or NULL      */
+    TRDP_TIME_T     launchTime;                         /**< requested launch time                        */
+} TRDP_TX_STAMP_REF_T;
+
+/** Timing histograms of a PD element, allocated with the element or by tlc_enableHistograms().
+    Written by the owner of the queue mutex only, read without locking (relaxed atomics). */
+typedef struct TRDP_PD_HISTO
+{
+    TRDP_TIME_T             lastTime;           /**< time of the last reception / sending         */
+    UINT32                  epoch;              /**< histoEpoch of the session the data belongs to */
+    TRDP_PD_HISTOGRAMS_T    histo;              /**< the distributions                            */
+} TRDP_PD_HISTO_T;
+
+/** A sample waiting for deferred callback delivery */
+typedef struct TRDP_PD_CB_SAMPLE
+{
+    TRDP_PD_INFO_T          info;               /**< message info passed to the callback          */
+    UINT32                  dataSize;           /**< size of the data                             */
+    BOOL8                   noData;             /**< pass NULL data (time out before first packet)*/
+    UINT8                   data[TRDP_PD_CB_DATA_SIZE];   /**< copy of the received data          */
+} TRDP_PD_CB_SAMPLE_T;
+
+/** Deferred callback delivery of a subscription, allocated on first use if the callback pool is enabled.
+    The three samples form a triple buffer: the receiver fills the back buffer and swaps it with the middle one,
+    the delivering thread swaps the middle buffer with its front buffer. Only the newest sample is delivered. */
+typedef struct TRDP_PD_CB_SLOT
+{
+    UINT32                  state;              /**< number of posts not yet consumed, cancel flag (atomic) */
+    UINT8                   middle;             /**< index of the middle buffer, fresh flag (atomic)  */
+    UINT8                   back;               /**< index of the buffer written by the receiver      */
+    UINT8                   front;              /**< index of the buffer read by the callback thread  */
+    TRDP_PD_CALLBACK_T      pfCbFunction;       /**< the subscriber's callback                        */
+    TRDP_PD_CB_SAMPLE_T     sample[3];          /**< back, middle and front buffer                    */
+} TRDP_PD_CB_SLOT_T;
+
+/** Entry of the callback queue */
+typedef struct TRDP_PD_CB_ENTRY
+{
+    UINT32                  seq;                /**< sequence of the lock-free queue (atomic)         */
+    TRDP_PD_CB_SLOT_T       *pSlot;             /**< subscription with a pending sample               */
+} TRDP_PD_CB_ENTRY_T;
+
+/** Pool of threads delivering PD callbacks */
+typedef struct TRDP_PD_CB_POOL
+{
+    struct TRDP_SESSION     *pSession;          /**< owning session                                   */
+    VOS_SEMA_T              sema;               /**< counts the queued entries                        */
+    UINT32                  noOfThreads;        /**< number of callback threads                       */
+    UINT32                  running;            /**< callback threads not yet stopped (atomic)        */
+    BOOL8                   stop;               /**< tell the callback threads to stop (atomic)       */
+    UINT32                  head;               /**< next entry to enqueue (atomic)                   */
+    UINT32                  tail;               /**< next entry to dequeue (atomic)                   */
+    UINT32                  overruns;           /**< queue was full, delivery postponed               */
+    VOS_THREAD_T            thread[TRDP_PD_CB_MAX_THREADS];   /**< the callback threads               */
+    TRDP_PD_CB_ENTRY_T      queue[TRDP_PD_CB_QUEUE_SIZE];     /**< subscriptions to deliver           */
+} TRDP_PD_CB_POOL_T;
+
+/** Change filter of a subscription, allocated by tlp_setChangeFilter() */
+typedef struct TRDP_PD_FILTER
+{
+    UINT64                  fieldMask;          /**< fields which trigger a callback                  */
+    UINT32                  noOfFields;         /**< number of fields                                 */
+    BOOL8                   reported;           /**< lastValue holds the values of the last callback  */
+    TRDP_PD_FIELD_T         field[TRDP_PD_MAX_FIELDS];        /**< fields in ascending order          */
+    REAL64                  lastValue[TRDP_PD_MAX_FIELDS];    /**< deadband fields: value last reported */
+} TRDP_PD_FILTER_T;
+
+/** Redundancy group of a session, created by the first publisher or request with its redId.
+    Groups are only appended and live until the session is closed, so the send loop and tlp_setRedundant()
+    can look them up and read/write the leadership flag without taking mutexTxPD. */
+typedef struct TRDP_RED_GROUP
+{
+    struct TRDP_RED_GROUP   *pNext;             /**< next group (atomic)                              */
+    UINT32                  redId;              /**< redundancy group ID                              */
+    UINT32                  follower;           /**< non-zero if we do not send this group (atomic)   */
+    UINT32                  noOfPub;            /**< number of publishers and PD requests in the group */
+} TRDP_RED_GROUP_T;
 
 /** Socket item    */
 typedef struct TRDP_SOCKETS
@@ -229,6 +363,14 @@ typedef struct TRDP_SOCKETS
     INT16               usage;                           /**< No. of current users of this socket         */
     TRDP_SOCKET_TCP_T   tcpParams;                       /**< Params used for TCP                         */
     TRDP_IP_ADDR_T      mcGroups[VOS_MAX_MULTICAST_CNT]; /**< List of multicast addresses for this socket */
+    UINT32              txStampId;                       /**< Key of the next packet on a txTime socket   */
+    BOOL8               txStampSync;                     /**< Keys of the kernel known, txTime only       */
+    TRDP_TX_STAMP_REF_T *pTxStampRef;                    /**< TRDP_TX_STAMP_REFS entries, txTime only     */
+    TRDP_LAUNCH_STATE_T launchState;                     /**< Launch times honoured, txTime only          */
+    UINT32              launchProbes;                    /**< Packets sent ahead while state is unknown   */
+    TRDP_ZC_STATE_T     zcState;                         /**< MSG_ZEROCOPY enabled on this socket         */
+    UINT32              zcSent;                          /**< zero copy sends on this socket              */
+    UINT32              zcDone;                          /**< zero copy sends completed by the kernel     */
 } TRDP_SOCKETS_T;
 
 #if (defined (WIN32) || defined (WIN64))
@@ -325,6 +467,7 @@ typedef struct PD_ELE
     TRDP_IP_ADDR_T      lastSrcIP;              /**< last source IP a subscribed packet was received from   */
     TRDP_IP_ADDR_T      pullIpAddress;          /**< In case of pulling a PD this is the requested Ip       */
     UINT32              redId;                  /**< Redundancy group ID or zero                            */
+    TRDP_RED_GROUP_T    *pRedGroup;             /**< redundancy group or NULL                               */
     UINT32              curSeqCnt;              /**< the last sent or received sequence counter             */
     UINT32              curSeqCnt4Pull;         /**< the last sent sequence counter for PULL                */
     TRDP_SEQ_CNT_LIST_T *pSeqCntList;           /**< pointer to list of received sequence numbers per comId */
@@ -338,6 +481,7 @@ typedef struct PD_ELE
     TRDP_TIME_T         interval;               /**< time out value for received packets or
                                                      interval for packets to send (set from ms)             */
     TRDP_TIME_T         timeToGo;               /**< next time this packet must be sent/rcv                 */
+    TRDP_TIME_T         rxTime;                 /**< arrival time of the last received packet               */
     TRDP_TO_BEHAVIOR_T  toBehavior;             /**< timeout behavior for packets                           */
     UINT32              dataSize;               /**< net data size                                          */
     UINT32              grossSize;              /**< complete packet size (header, data)                    */
@@ -347,6 +491,16 @@ typedef struct PD_ELE
     const void          *pUserRef;              /**< from subscribe()                                       */
     TRDP_PD_CALLBACK_T  pfCbFunction;           /**< Pointer to PD callback function                        */
     PD_PACKET_T         *pFrame;                /**< header ... data + FCS...                               */
+    TRDP_TIME_T         lastTxStamp;            /**< last TX timestamp (txTime publishers only)             */
+    UINT64              sumTxDev;               /**< sum of absolute interval deviations in us              */
+    UINT32              numTxDev;               /**< number of interval deviations summed up                */
+    TRDP_PUB_TX_STATS_T txStats;                /**< TX timing statistics                                   */
+    TRDP_PD_HISTO_T     *pHisto;                /**< timing histograms or NULL                              */
+    TRDP_PD_CB_SLOT_T   *pCbSlot;               /**< deferred callback delivery or NULL                     */
+    UINT32              batchPos;               /**< position in the batch of the receive pass + 1, or 0    */
+    UINT32              batchCbPos;             /**< position in the batch being reported + 1, or 0         */
+    TRDP_PD_FILTER_T    *pFilter;               /**< change filter or NULL                                  */
+    UINT64              changeMask;             /**< fields changed by the last received packet             */
 } PD_ELE_T, *TRDP_PUB_PT, *TRDP_SUB_PT;
 
 #if MD_SUPPORT
@@ -372,6 +526,26 @@ typedef struct TRDP_MD_TCP
     BOOL8   msgUncomplete;                      /**< The receive message is uncomplete                      */
 } TRDP_MD_TCP_T;
 
+/** Round trip time estimation for an MD peer (UDP requests)  */
+typedef struct TRDP_MD_PEER
+{
+    TRDP_IP_ADDR_T      ipAddr;                 /**< peer address, 0 if the entry is unused                 */
+    TRDP_TIME_T         lastUsed;               /**< last request sent to the peer, to recycle the entry    */
+    UINT32              srtt;                   /**< smoothed round trip time in us                         */
+    UINT32              rttVar;                 /**< round trip time variation in us                        */
+    UINT32              lastRtt;                /**< last measured round trip time in us                    */
+    UINT32              numSamples;             /**< number of round trip time samples                      */
+    UINT32              numRetries;             /**< number of retransmitted requests                       */
+    UINT32              numReplyTimeout;        /**< number of requests without reply                       */
+} TRDP_MD_PEER_T;
+
+/** Payload shared by the sessions of a multi-destination notify or request, the data follows  */
+typedef struct TRDP_MD_SHARED
+{
+    UINT32              refCnt;                 /**< number of sessions still referencing the payload       */
+    UINT32              size;                   /**< net data size (marshalled)                             */
+} TRDP_MD_SHARED_T;
+
 /** Session queue element for MD (UDP and TCP)  */
 typedef struct MD_ELE
 {
@@ -384,6 +558,7 @@ typedef struct MD_ELE
     TRDP_TIME_T         interval;               /**< time out value for received packets or
                                                      interval for packets to send (set from ms)             */
     TRDP_TIME_T         timeToGo;               /**< next time this packet must be sent/rcv                 */
+    TRDP_TIME_T         rxTime;                 /**< arrival time of the last received packet               */
     UINT32              dataSize;               /**< net data size                                          */
     UINT32              grossSize;              /**< complete packet size (header, data)                    */
     UINT32              sendSize;               /**< data size sent out                                     */
@@ -408,6 +583,13 @@ typedef struct MD_ELE
     MD_PACKET_T         *pPacket;               /**< Packet header in network byte order                    */
                                                 /**< data ready to be sent (with CRCs)                      */
     MD_LIS_ELE_T        *pListener;             /**< Pointer to the Session's associated Listener           */
+    const UINT8         *pRefData;              /**< payload of the caller, sent by reference, or NULL      */
+    TRDP_MD_RELEASE_T   pfRelease;              /**< release callback for pRefData                          */
+    void                *pRelRefCon;            /**< user context for pfRelease                             */
+    BOOL8               zcPending;              /**< the kernel may still reference pRefData                */
+    UINT32              zcId;                   /**< number of the last zero copy send                      */
+    SOCKET              zcSock;                 /**< socket of the last zero copy send                      */
+    TRDP_TIME_T         txTime;                 /**< time the request was sent last                         */
 } MD_ELE_T;
 
 /**    TCP file descriptor parameters   */
@@ -441,10 +623,30 @@ typedef struct TRDP_SESSION
     TRDP_SOCKETS_T          ifacePD[TRDP_MAX_PD_SOCKET_CNT];  /**< Collection of sockets to use               */
     PD_ELE_T                *pSndQueue;         /**< pointer to first element of send queue                 */
     PD_ELE_T                *pRcvQueue;         /**< pointer to first element of rcv queue                  */
+    TRDP_RED_GROUP_T        *pRedGroups;        /**< redundancy groups of the send queue                    */
     PD_PACKET_T             *pNewFrame;         /**< pointer to received PD frame                           */
     TRDP_PR_SEQ_CNT_LIST_T  *pSeqCntList4PDReq; /**< pointer to list of sequence counters for PR per comId  */
     TRDP_TIME_T             initTime;           /**< initialization time of session                         */
     TRDP_STATISTICS_T       stats;              /**< statistics of this session                             */
+    BOOL8                   histograms;         /**< record timing histograms per telegram                  */
+    UINT32                  histoEpoch;         /**< incremented by tlc_resetStatistics(), restarts histograms */
+    BOOL8                   comIdFilter;        /**< drop PD of unsubscribed comIds in the kernel           */
+    UINT32                  busyPollBudget;     /**< spin time of tlp_processReceive() in us, 0: none       */
+    UINT32                  busyPollTime;       /**< device busy poll time of the PD sockets in us          */
+    TRDP_PD_CB_POOL_T       *pCbPool;           /**< callback threads or NULL for direct callbacks          */
+    PD_ELE_T                *pCbSub;            /**< subscription in its direct callback, NULL if removed   */
+    TRDP_PD_BATCH_CALLBACK_T pfBatchCb;         /**< callback at the end of a receive pass or NULL          */
+    void                    *pBatchRefCon;      /**< user context for the batch callback                    */
+    TRDP_PD_BATCH_ENTRY_T   *pBatch;            /**< telegrams updated in the current receive pass          */
+    UINT32                  batchSize;          /**< allocated entries                                      */
+    UINT32                  noOfBatch;          /**< used entries                                           */
+    TRDP_PD_BATCH_ENTRY_T   *pBatchCb;          /**< batch passed to the batch callback or NULL             */
+#ifdef XDP_SUPPORT
+    VOS_XSK_T               pdXsk;              /**< AF_XDP socket for PD or NULL                           */
+#endif
+#ifdef URING_SUPPORT
+    VOS_URING_T             pdUring;            /**< io_uring for PD or NULL                                */
+#endif
 #ifdef HIGH_PERF_INDEXED
     TRDP_HP_SLOTS_T         *pSlot;             /**< pointer to a struct holding a list of slots for
                                                                         high speed access to PD telegrams   */
@@ -461,6 +663,14 @@ typedef struct TRDP_SESSION
     MD_ELE_T                *pMDRcvQueue;       /**< pointer to first element of recv MD queue (replier)    */
     MD_ELE_T                *pMDRcvEle;         /**< pointer to received MD element                         */
     MD_ELE_T                *uncompletedTCP[VOS_MAX_SOCKET_CNT];     /**< uncompleted TCP messages buffer   */
+    MD_ELE_T                *pMDZcQueue;        /**< closed sessions waiting for zero copy completions      */
+    UINT32                  mdRefSize;          /**< min. payload size sent by reference, 0 = always copy   */
+    UINT32                  mdZeroCopySize;     /**< min. payload size sent with zero copy, 0 = never       */
+    TRDP_MD_RELEASE_T       pfMdRelease;        /**< release callback for payloads sent by reference        */
+    void                    *pMdRelRefCon;      /**< user context for pfMdRelease                           */
+    BOOL8                   mdAdaptiveRetry;    /**< retry UDP requests after the estimated round trip time */
+    UINT32                  mdMinRetryTimeout;  /**< lower bound of the adaptive retry timeout in us        */
+    TRDP_MD_PEER_T          mdPeer[TRDP_MD_PEER_CNT];   /**< round trip time estimation per peer            */
 #endif
 } TRDP_SESSION_T, *TRDP_SESSION_PT;
 
@@ -17,7 +17,14 @@
  /*
  * $Id$
  *
- *      BL 2019-02-01: Ticket #234 Correcting Statistics ComIds & defines
+ *      AG 2026-10-19: Thread statistics returned by tlc_getThreadStatistics() instead of tlc_getStatistics()
+ *      AG 2026-10-19: Histograms preallocated, relaxed atomic updates, read and reset without locking
+ *      AG 2026-10-19: Thread statistics appended behind the histogram summaries of the statistics reply
+ *      AG 2026-10-19: Cyclic thread timing statistics
+ *      AG 2026-10-19: Round trip time statistics per MD peer
+ *      AG 2026-10-19: Redundancy state taken from the redundancy groups
+ *      AG 2026-10-19: Timing histograms per telegram, summary appended to the global statistics reply
+*      BL 2019-02-01: Ticket #234 Correcting Statistics ComIds & defines
  *      BL 2018-06-20: Ticket #184: Building with VS 2015: WIN64 and Windows threads (SOCKET instead of INT32)
  *      BL 2017-11-17: superfluous session->redID replaced by sndQueue->redId
  *      BL 2017-05-22: Ticket #122: Addendum for 64Bit compatibility (VOS_TIME_T -> VOS_TIMEVAL_T)
@@ -40,6 +47,9 @@
 #include "tlc_if.h"
 #include "trdp_private.h"
 #include "trdp_pdcom.h"
+#if MD_SUPPORT
+#include "trdp_mdcom.h"
+#endif
 #include "trdp_utils.h"
 #include "vos_mem.h"
 #include "vos_thread.h"
@@ -48,6 +58,8 @@
  * DEFINES
  */
 
+/** Size of the standard part of the statistics reply, everything in front of the thread statistics */
+
 /*******************************************************************************
  * TYPEDEFS
  */
@@ -58,6 +70,51 @@
 
 void trdp_UpdateStats (TRDP_APP_SESSION_T appHandle);
 
+/**********************************************************************************************************************/
+/** Compute the histogram bucket of a value
+ *
+ *  @param[in]      value               value to sort in
+ *  @retval         bucket index
+ */
+static UINT32 trdp_histoIndex (
+    UINT32 value)
+{
+    UINT32 magnitude = 1u;
+
+    if (value < TRDP_HISTO_SUB_BUCKETS)
+    {
+        return value;
+    }
+    while (value >= 2u * TRDP_HISTO_SUB_BUCKETS)
+    {
+        value >>= 1u;
+        magnitude++;
+    }
+    if (magnitude >= TRDP_HISTO_MAGNITUDES)
+    {
+        return TRDP_HISTO_BUCKETS - 1u;
+    }
+    return magnitude * TRDP_HISTO_SUB_BUCKETS + value - TRDP_HISTO_SUB_BUCKETS;
+}
+
+/**********************************************************************************************************************/
+/** Compute the first value of a histogram bucket
+ *
+ *  @param[in]      index               bucket index
+ *  @retval         lowest value counted in this bucket
+ */
+static UINT32 trdp_histoLowest (
+    UINT32 index)
+{
+    UINT32 magnitude = index / TRDP_HISTO_SUB_BUCKETS;
+
+    if (magnitude == 0u)
+    {
+        return index;
+    }
+    return (TRDP_HISTO_SUB_BUCKETS + index % TRDP_HISTO_SUB_BUCKETS) << (magnitude - 1u);
+}
+
 /******************************************************************************
  *   Globals
  */
@@ -95,6 +152,372 @@ void trdp_initStats (
     }
 }
 
+/**********************************************************************************************************************/
+/** Add a value to a histogram.
+ *
+ *  @param[in,out]  pHisto              histogram to update
+ *  @param[in]      value               value in us
+ */
+void trdp_histoAdd (
+    TRDP_HISTOGRAM_T    *pHisto,
+    UINT32              value)
+{
+    /*  One writer at a time (queue mutex), readers take a snapshot without locking  */
+    if ((__atomic_fetch_add(&pHisto->count, 1u, __ATOMIC_RELAXED) == 0u) ||
+        (value < __atomic_load_n(&pHisto->min, __ATOMIC_RELAXED)))
+    {
+        __atomic_store_n(&pHisto->min, value, __ATOMIC_RELAXED);
+    }
+    if (value > __atomic_load_n(&pHisto->max, __ATOMIC_RELAXED))
+    {
+        __atomic_store_n(&pHisto->max, value, __ATOMIC_RELAXED);
+    }
+    (void) __atomic_fetch_add(&pHisto->sum, (UINT64) value, __ATOMIC_RELAXED);
+    (void) __atomic_fetch_add(&pHisto->bucket[trdp_histoIndex(value)], 1u, __ATOMIC_RELAXED);
+}
+
+/**********************************************************************************************************************/
+/** Clear a histogram, readers may look at it concurrently.
+ *
+ *  @param[in,out]  pHisto              histogram to clear
+ */
+static void trdp_histoClear (
+    TRDP_HISTOGRAM_T *pHisto)
+{
+    UINT32 i;
+
+    __atomic_store_n(&pHisto->count, 0u, __ATOMIC_RELAXED);
+    __atomic_store_n(&pHisto->min, 0u, __ATOMIC_RELAXED);
+    __atomic_store_n(&pHisto->max, 0u, __ATOMIC_RELAXED);
+    __atomic_store_n(&pHisto->sum, 0u, __ATOMIC_RELAXED);
+    for (i = 0u; i < TRDP_HISTO_BUCKETS; i++)
+    {
+        __atomic_store_n(&pHisto->bucket[i], 0u, __ATOMIC_RELAXED);
+    }
+}
+
+/**********************************************************************************************************************/
+/** Copy a histogram which may be updated concurrently.
+ *  The fields are read one by one, count and buckets may differ by the updates made during the copy.
+ *
+ *  @param[out]     pDst                copy
+ *  @param[in]      pSrc                histogram to copy
+ */
+static void trdp_histoSnapshot (
+    TRDP_HISTOGRAM_T        *pDst,
+    const TRDP_HISTOGRAM_T  *pSrc)
+{
+    UINT32 i;
+
+    pDst->count = __atomic_load_n(&pSrc->count, __ATOMIC_RELAXED);
+    pDst->min   = __atomic_load_n(&pSrc->min, __ATOMIC_RELAXED);
+    pDst->max   = __atomic_load_n(&pSrc->max, __ATOMIC_RELAXED);
+    pDst->sum   = __atomic_load_n(&pSrc->sum, __ATOMIC_RELAXED);
+    for (i = 0u; i < TRDP_HISTO_BUCKETS; i++)
+    {
+        pDst->bucket[i] = __atomic_load_n(&pSrc->bucket[i], __ATOMIC_RELAXED);
+    }
+}
+
+/**********************************************************************************************************************/
+/** Copy the histograms of a PD element without locking.
+ *  Histograms not updated since the last tlc_resetStatistics() are reported empty.
+ *
+ *  @param[in]      appHandle           the handle returned by tlc_openSession
+ *  @param[in]      pElement            publisher or subscriber
+ *  @param[out]     pHistograms         copy
+ */
+static void trdp_pdHistoSnapshot (
+    TRDP_APP_SESSION_T      appHandle,
+    const PD_ELE_T          *pElement,
+    TRDP_PD_HISTOGRAMS_T    *pHistograms)
+{
+    const TRDP_PD_HISTO_T *pHisto = __atomic_load_n(&pElement->pHisto, __ATOMIC_ACQUIRE);
+
+    if ((pHisto == NULL) ||
+        (__atomic_load_n(&pHisto->epoch, __ATOMIC_ACQUIRE) != __atomic_load_n(&appHandle->histoEpoch,
+                                                                             __ATOMIC_ACQUIRE)))
+    {
+        memset(pHistograms, 0, sizeof(TRDP_PD_HISTOGRAMS_T));
+        return;
+    }
+    trdp_histoSnapshot(&pHistograms->interval, &pHisto->histo.interval);
+    trdp_histoSnapshot(&pHistograms->cbExec, &pHisto->histo.cbExec);
+    trdp_histoSnapshot(&pHistograms->cbLatency, &pHisto->histo.cbLatency);
+}
+
+/**********************************************************************************************************************/
+/** Add a time difference to a histogram.
+ *
+ *  @param[in,out]  pHisto              histogram to update
+ *  @param[in]      pStart              start time
+ *  @param[in]      pEnd                end time, negative differences are counted as 0
+ */
+void trdp_histoAddTime (
+    TRDP_HISTOGRAM_T    *pHisto,
+    const TRDP_TIME_T   *pStart,
+    const TRDP_TIME_T   *pEnd)
+{
+    INT64 diff = ((INT64) pEnd->tv_sec - (INT64) pStart->tv_sec) * 1000000 +
+        (INT64) pEnd->tv_usec - (INT64) pStart->tv_usec;
+
+    if (diff < 0)
+    {
+        diff = 0;
+    }
+    else if (diff > (INT64) 0xFFFFFFFFu)
+    {
+        diff = (INT64) 0xFFFFFFFFu;
+    }
+    trdp_histoAdd(pHisto, (UINT32) diff);
+}
+
+/**********************************************************************************************************************/
+/** Record the interval since the last call for a PD element.
+ *
+ *  @param[in,out]  pHisto              histograms of the element
+ *  @param[in]      pNow                time of reception or sending
+ */
+void trdp_histoMark (
+    TRDP_PD_HISTO_T     *pHisto,
+    const TRDP_TIME_T   *pNow)
+{
+    if (timerisset(&pHisto->lastTime))
+    {
+        trdp_histoAddTime(&pHisto->histo.interval, &pHisto->lastTime, pNow);
+    }
+    pHisto->lastTime = *pNow;
+}
+
+/**********************************************************************************************************************/
+/** Get the histograms of a PD element for an update, with the queue mutex held.
+ *  After tlc_resetStatistics() the histograms are cleared here, by their only writer.
+ *
+ *  @param[in]      appHandle           the handle returned by tlc_openSession
+ *  @param[in]      pElement            publisher or subscriber
+ *  @retval         pointer to the histograms or NULL if histograms are disabled or not allocated
+ */
+TRDP_PD_HISTO_T *trdp_pdGetHisto (
+    TRDP_APP_SESSION_T  appHandle,
+    PD_ELE_T            *pElement)
+{
+    TRDP_PD_HISTO_T *pHisto = pElement->pHisto;
+    UINT32          epoch;
+
+    if ((appHandle->histograms == FALSE) || (pHisto == NULL))
+    {
+        return NULL;
+    }
+    epoch = __atomic_load_n(&appHandle->histoEpoch, __ATOMIC_ACQUIRE);
+    if (pHisto->epoch != epoch)
+    {
+        trdp_histoClear(&pHisto->histo.interval);
+        trdp_histoClear(&pHisto->histo.cbExec);
+        trdp_histoClear(&pHisto->histo.cbLatency);
+        __atomic_store_n(&pHisto->epoch, epoch, __ATOMIC_RELEASE);
+    }
+    return pHisto;
+}
+
+/**********************************************************************************************************************/
+/** Allocate the histograms of a PD element, if histograms are enabled. Called with the queue mutex held.
+ *
+ *  @param[in]      appHandle           the handle returned by tlc_openSession
+ *  @param[in]      pElement            publisher or subscriber
+ *  @retval         TRDP_NO_ERR         no error
+ *  @retval         TRDP_MEM_ERR        out of memory, the element records no histograms
+ */
+TRDP_ERR_T trdp_pdAllocHisto (
+    TRDP_APP_SESSION_T  appHandle,
+    PD_ELE_T            *pElement)
+{
+    TRDP_PD_HISTO_T *pHisto;
+
+    if ((appHandle->histograms == FALSE) || (pElement->pHisto != NULL))
+    {
+        return TRDP_NO_ERR;
+    }
+    pHisto = (TRDP_PD_HISTO_T *) vos_memAlloc(sizeof(TRDP_PD_HISTO_T));
+    if (pHisto == NULL)
+    {
+        vos_printLog(VOS_LOG_WARNING, "Out of memory, no histograms for comId %u\n", pElement->addr.comId);
+        return TRDP_MEM_ERR;
+    }
+    pHisto->epoch = __atomic_load_n(&appHandle->histoEpoch, __ATOMIC_ACQUIRE);
+    __atomic_store_n(&pElement->pHisto, pHisto, __ATOMIC_RELEASE);
+    return TRDP_NO_ERR;
+}
+
+/**********************************************************************************************************************/
+/** Get a percentile of a histogram.
+ *  The result is exact up to the bucket resolution (TRDP_HISTO_SUB_BUCKETS per power of two).
+ *
+ *  @param[in]      pHisto              pointer to the histogram
+ *  @param[in]      permille            wanted percentile in 1/1000 (e.g. 500 for the median, 999 for p99.9)
+ *  @retval         highest value within the percentile, 0 if the histogram is empty
+ */
+EXT_DECL UINT32 tlc_getHistoPercentile (
+    const TRDP_HISTOGRAM_T  *pHisto,
+    UINT32                  permille)
+{
+    UINT64  target;
+    UINT64  sum = 0u;
+    UINT32  i;
+
+    if ((pHisto == NULL) || (pHisto->count == 0u))
+    {
+        return 0u;
+    }
+    if (permille > 1000u)
+    {
+        permille = 1000u;
+    }
+    target = ((UINT64) pHisto->count * permille + 999u) / 1000u;
+    for (i = 0u; i < TRDP_HISTO_BUCKETS - 1u; i++)
+    {
+        sum += pHisto->bucket[i];
+        if ((sum >= target) && (sum != 0u))
+        {
+            UINT32 highest = trdp_histoLowest(i + 1u) - 1u;
+            return (highest < pHisto->max) ? highest : pHisto->max;
+        }
+    }
+    return pHisto->max;
+}
+
+/**********************************************************************************************************************/
+/** Enable or disable the recording of timing histograms.
+ *  If enabled, each published and subscribed telegram records the distribution of its intervals, its callback
+ *  execution time and (subscriptions) the latency from reception to callback. The memory for a telegram's histograms
+ *  (sizeof(TRDP_PD_HISTOGRAMS_T)) is allocated here for the existing telegrams and by tlp_publish() / tlp_subscribe()
+ *  for new ones, never while sending or receiving. Disabling keeps the memory until the telegram is removed.
+ *
+ *  @param[in]      appHandle           the handle returned by tlc_openSession
+ *  @param[in]      enable              TRUE to record histograms
+ *  @retval         TRDP_NO_ERR         no error
+ *  @retval         TRDP_NOINIT_ERR     handle invalid
+ *  @retval         TRDP_MEM_ERR        out of memory, some telegrams record no histograms
+ */
+EXT_DECL TRDP_ERR_T tlc_enableHistograms (
+    TRDP_APP_SESSION_T  appHandle,
+    BOOL8               enable)
+{
+    TRDP_ERR_T  ret = TRDP_NO_ERR;
+    PD_ELE_T    *iter;
+
+    if (!trdp_isValidSession(appHandle))
+    {
+        return TRDP_NOINIT_ERR;
+    }
+    if (enable == FALSE)
+    {
+        appHandle->histograms = FALSE;
+        return TRDP_NO_ERR;
+    }
+
+    if (vos_mutexLock(appHandle->mutexTxPD) != VOS_NO_ERR)
+    {
+        return TRDP_NOINIT_ERR;
+    }
+    appHandle->histograms = TRUE;
+    for (iter = appHandle->pSndQueue; iter != NULL; iter = iter->pNext)
+    {
+        if (trdp_pdAllocHisto(appHandle, iter) != TRDP_NO_ERR)
+        {
+            ret = TRDP_MEM_ERR;
+        }
+    }
+    if (vos_mutexUnlock(appHandle->mutexTxPD) != VOS_NO_ERR)
+    {
+        vos_printLogStr(VOS_LOG_INFO, "vos_mutexUnlock() failed\n");
+    }
+
+    if (vos_mutexLock(appHandle->mutexRxPD) != VOS_NO_ERR)
+    {
+        return TRDP_NOINIT_ERR;
+    }
+    for (iter = appHandle->pRcvQueue; iter != NULL; iter = iter->pNext)
+    {
+        if (trdp_pdAllocHisto(appHandle, iter) != TRDP_NO_ERR)
+        {
+            ret = TRDP_MEM_ERR;
+        }
+    }
+    if (vos_mutexUnlock(appHandle->mutexRxPD) != VOS_NO_ERR)
+    {
+        vos_printLogStr(VOS_LOG_INFO, "vos_mutexUnlock() failed\n");
+    }
+    return ret;
+}
+
+/**********************************************************************************************************************/
+/** Return the timing histograms of a publisher.
+ *  The histograms are copied without locking, sending goes on meanwhile. Must not be called concurrently with
+ *  tlp_unpublish() of the same publisher.
+ *
+ *  @param[in]      appHandle           the handle returned by tlc_openSession
+ *  @param[in]      pubHandle           the handle returned by tlp_publish
+ *  @param[out]     pHistograms         pointer to the histograms to be filled
+ *  @retval         TRDP_NO_ERR         no error
+ *  @retval         TRDP_NOINIT_ERR     handle invalid
+ *  @retval         TRDP_PARAM_ERR      parameter error
+ *  @retval         TRDP_NOPUB_ERR      not published
+ */
+EXT_DECL TRDP_ERR_T tlc_getPubHistograms (
+    TRDP_APP_SESSION_T      appHandle,
+    TRDP_PUB_T              pubHandle,
+    TRDP_PD_HISTOGRAMS_T    *pHistograms)
+{
+    if ((pubHandle == NULL) || (pHistograms == NULL))
+    {
+        return TRDP_PARAM_ERR;
+    }
+    if (pubHandle->magic != TRDP_MAGIC_PUB_HNDL_VALUE)
+    {
+        return TRDP_NOPUB_ERR;
+    }
+    if (!trdp_isValidSession(appHandle))
+    {
+        return TRDP_NOINIT_ERR;
+    }
+    trdp_pdHistoSnapshot(appHandle, pubHandle, pHistograms);
+    return TRDP_NO_ERR;
+}
+
+/**********************************************************************************************************************/
+/** Return the timing histograms of a subscription.
+ *  The histograms are copied without locking, reception goes on meanwhile. Must not be called concurrently with
+ *  tlp_unsubscribe() of the same subscription.
+ *
+ *  @param[in]      appHandle           the handle returned by tlc_openSession
+ *  @param[in]      subHandle           the handle returned by tlp_subscribe
+ *  @param[out]     pHistograms         pointer to the histograms to be filled
+ *  @retval         TRDP_NO_ERR         no error
+ *  @retval         TRDP_NOINIT_ERR     handle invalid
+ *  @retval         TRDP_PARAM_ERR      parameter error
+ *  @retval         TRDP_NOSUB_ERR      not subscribed
+ */
+EXT_DECL TRDP_ERR_T tlc_getSubHistograms (
+    TRDP_APP_SESSION_T      appHandle,
+    TRDP_SUB_T              subHandle,
+    TRDP_PD_HISTOGRAMS_T    *pHistograms)
+{
+    if ((subHandle == NULL) || (pHistograms == NULL))
+    {
+        return TRDP_PARAM_ERR;
+    }
+    if (subHandle->magic != TRDP_MAGIC_SUB_HNDL_VALUE)
+    {
+        return TRDP_NOSUB_ERR;
+    }
+    if (!trdp_isValidSession(appHandle))
+    {
+        return TRDP_NOINIT_ERR;
+    }
+    trdp_pdHistoSnapshot(appHandle, subHandle, pHistograms);
+    return TRDP_NO_ERR;
+}
+
 /**********************************************************************************************************************/
 /** Reset statistics.
  *
@@ -117,6 +540,21 @@ EXT_DECL TRDP_ERR_T tlc_resetStatistics (
     memset(&appHandle->stats, 0, sizeof(TRDP_STATISTICS_T));
     appHandle->stats.upTime = tempTime;
 
+    /*  Restart the histograms, too: each one is cleared by its writer on the next update, reported empty until then */
+    (void) __atomic_fetch_add(&appHandle->histoEpoch, 1u, __ATOMIC_ACQ_REL);
+
+#if MD_SUPPORT
+    /*  Keep the round trip time estimations, restart the counters */
+    {
+        UINT32 i;
+        for (i = 0u; i < TRDP_MD_PEER_CNT; i++)
+        {
+            appHandle->mdPeer[i].numRetries         = 0u;
+            appHandle->mdPeer[i].numReplyTimeout    = 0u;
+        }
+    }
+#endif
+
     return TRDP_NO_ERR;
 }
 
@@ -150,6 +588,46 @@ EXT_DECL TRDP_ERR_T tlc_getStatistics (
     return TRDP_NO_ERR;
 }
 
+/**********************************************************************************************************************/
+/** Return the timing statistics of the cyclic threads.
+ *  The values are process wide; they are not cleared by tlc_resetStatistics() but by vos_threadResetStatistics().
+ *
+ *  @param[in]      appHandle           the handle returned by tlc_openSession
+ *  @param[out]     pStatistics         Pointer to the thread statistics
+ *  @retval         TRDP_NO_ERR         no error
+ *  @retval         TRDP_NOINIT_ERR     handle invalid
+ *  @retval         TRDP_PARAM_ERR      parameter error
+ */
+EXT_DECL TRDP_ERR_T tlc_getThreadStatistics (
+    TRDP_APP_SESSION_T          appHandle,
+    TRDP_THREAD_STATISTICS_T    *pStatistics)
+{
+    VOS_THREAD_STATS_T threadStats;
+
+    if (pStatistics == NULL)
+    {
+        return TRDP_PARAM_ERR;
+    }
+    if (!trdp_isValidSession(appHandle))
+    {
+        return TRDP_NOINIT_ERR;
+    }
+
+    memset(pStatistics, 0, sizeof(TRDP_THREAD_STATISTICS_T));
+    if (vos_threadGetStatistics(NULL, &threadStats) == VOS_NO_ERR)
+    {
+        pStatistics->numThreads         = threadStats.numThreads;
+        pStatistics->numCycles          = threadStats.numCycles;
+        pStatistics->numMissed          = threadStats.numMissed;
+        pStatistics->maxWakeupLatency   = threadStats.maxWakeupLatency;
+        pStatistics->avgWakeupLatency   = threadStats.avgWakeupLatency;
+        pStatistics->maxExecTime        = threadStats.maxExecTime;
+        pStatistics->avgExecTime        = threadStats.avgExecTime;
+    }
+
+    return TRDP_NO_ERR;
+}
+
 /**********************************************************************************************************************/
 /** Return PD subscription statistics.
  *  Memory for statistics information must be provided by the user.
@@ -241,7 +719,7 @@ EXT_DECL TRDP_ERR_T tlc_getPubStatistics (
         pStatistics[lIndex].comId       = iter->addr.comId;         /* Published ComId                                */
         pStatistics[lIndex].destAddr    = iter->addr.destIpAddr;    /* IP address of destination for this publishing. */
         pStatistics[lIndex].redId       = iter->redId;              /* Redundancy group id                            */
-        pStatistics[lIndex].redState    = (iter->privFlags & TRDP_REDUNDANT) ? 1 : 0; /* Redundancy state:
+        pStatistics[lIndex].redState    = trdp_pdIsFollower(iter) ? 1 : 0;            /* Redundancy state:
                                                                                         1 = Follower
                                                                                         0 = Leader                  */
 
@@ -357,6 +835,71 @@ EXT_DECL TRDP_ERR_T tlc_getTcpListStatistics (
     *pNumList = lIndex;
     return TRDP_NO_ERR;
 }
+
+/**********************************************************************************************************************/
+/** Return the round trip time estimation of the MD peers.
+ *  Peers are recorded when UDP requests expecting one reply are sent to them; up to TRDP_MD_PEER_CNT peers are kept.
+ *  Memory for statistics information must be provided by the user.
+ *
+ *  @param[in]      appHandle           the handle returned by tlc_openSession
+ *  @param[in,out]  pNumPeer            Pointer to the number of peers
+ *  @param[out]     pStatistics         Pointer to a list with the peer statistics
+ *  @retval         TRDP_NO_ERR         no error
+ *  @retval         TRDP_NOINIT_ERR     handle invalid
+ *  @retval         TRDP_PARAM_ERR      parameter error
+ *  @retval         TRDP_MUTEX_ERR      mutex error
+ */
+EXT_DECL TRDP_ERR_T tlc_getMdPeerStatistics (
+    TRDP_APP_SESSION_T          appHandle,
+    UINT16                      *pNumPeer,
+    TRDP_MD_PEER_STATISTICS_T   *pStatistics)
+{
+    const TRDP_MD_PEER_T    *pPeer;
+    UINT16                  lIndex = 0u;
+    UINT32                  i;
+
+    if (!trdp_isValidSession(appHandle))
+    {
+        return TRDP_NOINIT_ERR;
+    }
+
+    if (pNumPeer == NULL || pStatistics == NULL || *pNumPeer == 0)
+    {
+        return TRDP_PARAM_ERR;
+    }
+
+    if (vos_mutexLock(appHandle->mutexMD) != VOS_NO_ERR)
+    {
+        return TRDP_MUTEX_ERR;
+    }
+
+    for (i = 0u; (i < TRDP_MD_PEER_CNT) && (lIndex < *pNumPeer); i++)
+    {
+        pPeer = &appHandle->mdPeer[i];
+        if (pPeer->ipAddr != 0u)
+        {
+            pStatistics->ipAddr             = pPeer->ipAddr;
+            pStatistics->srtt               = pPeer->srtt;
+            pStatistics->rttVar             = pPeer->rttVar;
+            pStatistics->lastRtt            = pPeer->lastRtt;
+            pStatistics->retryTimeout       = (appHandle->mdAdaptiveRetry == FALSE) ? 0u :
+                trdp_mdPeerRetryTimeout(appHandle, pPeer, appHandle->mdDefault.replyTimeout);
+            pStatistics->numSamples         = pPeer->numSamples;
+            pStatistics->numRetries         = pPeer->numRetries;
+            pStatistics->numReplyTimeout    = pPeer->numReplyTimeout;
+            pStatistics++;
+            lIndex++;
+        }
+    }
+
+    if (vos_mutexUnlock(appHandle->mutexMD) != VOS_NO_ERR)
+    {
+        vos_printLogStr(VOS_LOG_INFO, "vos_mutexUnlock() failed\n");
+    }
+
+    *pNumPeer = lIndex;
+    return TRDP_NO_ERR;
+}
 #endif
 
 /**********************************************************************************************************************/
@@ -376,20 +919,26 @@ EXT_DECL TRDP_ERR_T tlc_getRedStatistics (
     UINT16                  *pNumRed,
     TRDP_RED_STATISTICS_T   *pStatistics)
 {
-    UINT16      lIndex = 0;
-    PD_ELE_T    *iterPD;
+    UINT16              lIndex = 0;
+    TRDP_RED_GROUP_T    *pGroup;
+    UINT32              i;
     if (!trdp_isValidSession(appHandle))
     {
         return TRDP_NOINIT_ERR;
     }
 
-    /*    Search the redundancy flag for every PD  */
-    for ((void)(lIndex = 0), iterPD = appHandle->pSndQueue; (lIndex < *pNumRed) && (NULL != iterPD); iterPD = iterPD->pNext)
+    if (vos_mutexLock(appHandle->mutexTxPD) != VOS_NO_ERR)
     {
-        if (iterPD->redId != 0)         /* redundant ID set?    */
+        return TRDP_MUTEX_ERR;
+    }
+
+    /*    Report the redundancy state for every PD of every group  */
+    for (pGroup = appHandle->pRedGroups; (lIndex < *pNumRed) && (NULL != pGroup); pGroup = pGroup->pNext)
+    {
+        for (i = 0u; (lIndex < *pNumRed) && (i < pGroup->noOfPub); i++)
         {
-            pStatistics->id = iterPD->redId;
-            if (iterPD->privFlags & TRDP_REDUNDANT)
+            pStatistics->id = pGroup->redId;
+            if (pGroup->follower != 0u)
             {
                 pStatistics->state = TRDP_RED_FOLLOWER;
             }
@@ -402,6 +951,11 @@ EXT_DECL TRDP_ERR_T tlc_getRedStatistics (
         }
     }
 
+    if (vos_mutexUnlock(appHandle->mutexTxPD) != VOS_NO_ERR)
+    {
+        vos_printLogStr(VOS_LOG_INFO, "vos_mutexUnlock() failed\n");
+    }
+
     *pNumRed = lIndex;
     return TRDP_NO_ERR;
 }
@@ -539,6 +1093,60 @@ void    trdp_UpdateStats (
 
 }
 
+/**********************************************************************************************************************/
+/** Append the histogram summaries of a queue to the statistics packet
+ *
+ *  @param[in]      appHandle           the handle returned by tlc_openSession
+ *  @param[in]      pQueue              send or receive queue
+ *  @param[in]      type                0 = subscriptions, 1 = publishers
+ *  @param[in,out]  ppDst               next free summary entry
+ *  @param[in,out]  pNumFree            number of free entries in the packet
+ *  @retval         number of appended entries
+ */
+static UINT32 trdp_appendHistoSummary (
+    TRDP_APP_SESSION_T      appHandle,
+    PD_ELE_T                *pQueue,
+    UINT32                  type,
+    TRDP_HISTO_SUMMARY_T    * *ppDst,
+    UINT32                  *pNumFree)
+{
+    PD_ELE_T                *iter;
+    UINT32                  numAdded = 0u;
+    TRDP_PD_HISTOGRAMS_T    histos;
+    TRDP_PD_HISTOGRAMS_T    *pHistos = &histos;
+
+    for (iter = pQueue; (iter != NULL) && (*pNumFree > 0u); iter = iter->pNext)
+    {
+        TRDP_HISTO_SUMMARY_T *pDst = *ppDst;
+
+        if ((iter->pHisto == NULL) || (iter->addr.comId == TRDP_GLOBAL_STATS_REPLY_COMID))
+        {
+            continue;
+        }
+        trdp_pdHistoSnapshot(appHandle, iter, pHistos);
+
+        pDst->comId     = vos_htonl(iter->addr.comId);
+        pDst->type      = vos_htonl(type);
+        pDst->count     = vos_htonl(pHistos->interval.count);
+        pDst->min       = vos_htonl(pHistos->interval.min);
+        pDst->max       = vos_htonl(pHistos->interval.max);
+        pDst->mean      = vos_htonl((pHistos->interval.count == 0u) ? 0u :
+                                    (UINT32) (pHistos->interval.sum / pHistos->interval.count));
+        pDst->p50       = vos_htonl(tlc_getHistoPercentile(&pHistos->interval, 500u));
+        pDst->p99       = vos_htonl(tlc_getHistoPercentile(&pHistos->interval, 990u));
+        pDst->p999      = vos_htonl(tlc_getHistoPercentile(&pHistos->interval, 999u));
+        pDst->cbExecP99 = vos_htonl(tlc_getHistoPercentile(&pHistos->cbExec, 990u));
+        pDst->cbExecMax = vos_htonl(pHistos->cbExec.max);
+        pDst->cbLatencyP99  = vos_htonl(tlc_getHistoPercentile(&pHistos->cbLatency, 990u));
+        pDst->cbLatencyMax  = vos_htonl(pHistos->cbLatency.max);
+
+        (*ppDst)++;
+        (*pNumFree)--;
+        numAdded++;
+    }
+    return numAdded;
+}
+
 /**********************************************************************************************************************/
 /** Fill the statistics packet
  *
@@ -633,8 +1241,43 @@ void    trdp_pdPrepareStats (
     pData->tcpMd.numReplyTimeout    = vos_htonl(appHandle->stats.tcpMd.numReplyTimeout);
     pData->tcpMd.numConfirmTimeout  = vos_htonl(appHandle->stats.tcpMd.numConfirmTimeout);
     pData->tcpMd.numSend            = vos_htonl(appHandle->stats.tcpMd.numSend);
+
     pPacket->dataSize = sizeof(TRDP_STATISTICS_T);
 
+    /*  The histogram summaries follow the standard statistics, as many as fit into the packet,
+        the thread statistics come last (see TRDP_STATISTICS_T)    */
+    {
+        UINT8                   *pCount     = pPacket->pFrame->data + sizeof(TRDP_STATISTICS_T);
+        TRDP_HISTO_SUMMARY_T    *pSummary   = (TRDP_HISTO_SUMMARY_T *) (pCount + sizeof(UINT32));
+        UINT32                  numFree     = (TRDP_MAX_PD_DATA_SIZE - sizeof(TRDP_STATISTICS_T) - sizeof(UINT32) -
+                                               sizeof(TRDP_THREAD_STATISTICS_T)) / sizeof(TRDP_HISTO_SUMMARY_T);
+        UINT32                  numHisto    = 0u;
+        TRDP_THREAD_STATISTICS_T thread;
+
+        if (appHandle->histograms == TRUE)
+        {
+            numHisto    = trdp_appendHistoSummary(appHandle, appHandle->pRcvQueue, 0u, &pSummary, &numFree);
+            numHisto    += trdp_appendHistoSummary(appHandle, appHandle->pSndQueue, 1u, &pSummary, &numFree);
+        }
+        numHisto    = vos_htonl(numHisto);
+        memcpy(pCount, &numHisto, sizeof(UINT32));
+
+        (void) tlc_getThreadStatistics(appHandle, &thread);
+        thread.numThreads       = vos_htonl(thread.numThreads);
+        thread.numCycles        = vos_htonl(thread.numCycles);
+        thread.numMissed        = vos_htonl(thread.numMissed);
+        thread.maxWakeupLatency = vos_htonl(thread.maxWakeupLatency);
+        thread.avgWakeupLatency = vos_htonl(thread.avgWakeupLatency);
+        thread.maxExecTime      = vos_htonl(thread.maxExecTime);
+        thread.avgExecTime      = vos_htonl(thread.avgExecTime);
+        memcpy(pSummary, &thread, sizeof(TRDP_THREAD_STATISTICS_T));
+
+        pPacket->dataSize = (UINT32) ((UINT8 *) pSummary - pPacket->pFrame->data) +
+                            (UINT32) sizeof(TRDP_THREAD_STATISTICS_T);
+    }
+    pPacket->grossSize = trdp_packetSizePD(pPacket->dataSize);
+    pPacket->pFrame->frameHead.datasetLength = vos_htonl(pPacket->dataSize);
+
     /* mark the data as valid */
     pPacket->privFlags = (TRDP_PRIV_FLAGS_T) (pPacket->privFlags & ~(TRDP_PRIV_FLAGS_T)TRDP_INVALID_DATA);
 }
@@ -17,6 +17,8 @@
  /*
  * $Id$
  *
+ *      AG 2026-10-19: Histograms allocated with the telegram
+ *      AG 2026-10-19: Timing histograms
  */
 
 
@@ -48,5 +50,11 @@
 void    trdp_initStats(TRDP_APP_SESSION_T appHandle);
 void    trdp_pdPrepareStats (TRDP_APP_SESSION_T appHandle, PD_ELE_T *pPacket);
 
+void    trdp_histoAdd (TRDP_HISTOGRAM_T *pHisto, UINT32 value);
+void    trdp_histoAddTime (TRDP_HISTOGRAM_T *pHisto, const TRDP_TIME_T *pStart, const TRDP_TIME_T *pEnd);
+void    trdp_histoMark (TRDP_PD_HISTO_T *pHisto, const TRDP_TIME_T *pNow);
+TRDP_PD_HISTO_T *trdp_pdGetHisto (TRDP_APP_SESSION_T appHandle, PD_ELE_T *pElement);
+TRDP_ERR_T trdp_pdAllocHisto (TRDP_APP_SESSION_T appHandle, PD_ELE_T *pElement);
+
 
 #endif
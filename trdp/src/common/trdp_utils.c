@@ -17,6 +17,9 @@
 /*
 * $Id$
 *
+*      AG 2026-10-19: Reset the TX timestamp key state of new sockets
+*      AG 2026-10-19: Reset the zero copy state of new sockets
+*      AG 2026-10-19: Sockets with launch time (txTime) option are not shared with ordinary senders
 *      SB 2020-03-30: Ticket #311: removed trdp_getSeqCnt() because redundant publisher should not run on the same interface
 *      SB 2019-08-20: Fixed lint errors and warnings
 *      SB 2019-08-15: Ticket #269: tau_initTTI: leave standard MC fails
@@ -953,6 +956,7 @@ TRDP_ERR_T  trdp_requestSocket (
                  && ((rcvMostly) || (iface[lIndex].sendParam.ttl == params->ttl))
                  && (iface[lIndex].sendParam.tsn == params->tsn)
                  && (iface[lIndex].sendParam.vlan == params->vlan)
+                 && ((rcvMostly) || (iface[lIndex].sendParam.txTime == params->txTime))
                  && (iface[lIndex].rcvMostly == rcvMostly)
                  && ((type != TRDP_SOCK_MD_TCP)
                      || ((type == TRDP_SOCK_MD_TCP) && (iface[lIndex].tcpParams.cornerIp == cornerIp) &&
@@ -1054,7 +1058,14 @@ TRDP_ERR_T  trdp_requestSocket (
         iface[lIndex].tcpParams.morituri    = FALSE;
         iface[lIndex].tcpParams.sendingTimeout.tv_sec   = 0;
         iface[lIndex].tcpParams.sendingTimeout.tv_usec  = 0;
-
+        iface[lIndex].txStampId     = 0u;
+        iface[lIndex].txStampSync   = TRUE;
+        iface[lIndex].pTxStampRef   = NULL;
+        iface[lIndex].launchState   = TRDP_LAUNCH_UNKNOWN;
+        iface[lIndex].launchProbes  = 0u;
+        iface[lIndex].zcState       = TRDP_ZC_UNKNOWN;
+        iface[lIndex].zcSent        = 0u;
+        iface[lIndex].zcDone        = 0u;
 
         /* Add to the file desc only if it's an accepted socket */
         if (rcvMostly == TRUE)
@@ -1206,6 +1217,19 @@ TRDP_ERR_T  trdp_requestSocket (
                 sock_options.nonBlocking = TRUE;  /* MD UDP sockets are always non blocking because they are polled */
             /* fall thru! */
             case TRDP_SOCK_PD:
+                if ((type == TRDP_SOCK_PD) && (rcvMostly == FALSE) && (params->txTime == TRUE))
+                {
+                    /* Launch time and TX timestamps, the references are kept until the stamp arrives */
+                    iface[lIndex].pTxStampRef = (TRDP_TX_STAMP_REF_T *) vos_memAlloc(
+                            TRDP_TX_STAMP_REFS * sizeof(TRDP_TX_STAMP_REF_T));
+                    if (iface[lIndex].pTxStampRef == NULL)
+                    {
+                        *pIndex = TRDP_INVALID_SOCKET_INDEX;
+                        err     = TRDP_MEM_ERR;
+                        break;
+                    }
+                    sock_options.txTime = TRUE;
+                }
                 err = (TRDP_ERR_T) vos_sockOpenUDP(&iface[lIndex].sock, &sock_options);
                 if (err != TRDP_NO_ERR)
                 {
@@ -1299,6 +1323,11 @@ TRDP_ERR_T  trdp_requestSocket (
         {
             /* Release socket in case of error */
             trdp_releaseSocket(iface, lIndex, 0, FALSE, VOS_INADDR_ANY);
+            if (iface[lIndex].pTxStampRef != NULL)
+            {
+                vos_memFree(iface[lIndex].pTxStampRef);
+                iface[lIndex].pTxStampRef = NULL;
+            }
         }
     }
     else
@@ -1404,6 +1433,11 @@ void  trdp_releaseSocket (
                     vos_printLog(VOS_LOG_DBG, "Closed socket %d\n", (int) iface[lIndex].sock);
                 }
                 iface[lIndex].sock = VOS_INVALID_SOCKET;
+                if (iface[lIndex].pTxStampRef != NULL)
+                {
+                    vos_memFree(iface[lIndex].pTxStampRef);
+                    iface[lIndex].pTxStampRef = NULL;
+                }
             }
             else if (mcGroupUsed != VOS_INADDR_ANY) /* Check for MC usage (close socket will unjoin MC anyway) */
             {
@@ -18,6 +18,8 @@
  /*
  * $Id$
  *
+ *      AG 2026-10-19: vos_queueCreateLockFree(): bounded lock-free queue variant
+ *      AG 2026-10-19: vos_memSetPoolMode() for prefaulted and huge page backed pools
  *      BL 2019-09-06: Default pre-allocated blocks for HIGH_PERF raised again
  *      BL 2019-08-15: Default pre-allocated blocks for HIGH_PERF raised
  *      BL 2017-05-08: Compiler warnings, doxygen comment errors
@@ -56,6 +58,11 @@ typedef enum
     VOS_QUEUE_POLICY_LIFO           /*  Last in, first out               */
 } VOS_QUEUE_POLICY_T;
 
+/** Options for vos_queueCreateLockFree()   */
+#define VOS_QUEUE_FLAG_NONE     0x00u   /**< MPMC, vos_queueSend() returns VOS_QUEUE_FULL_ERR if full   */
+#define VOS_QUEUE_FLAG_SPSC     0x01u   /**< Only one sending and one receiving thread (FIFO only)  */
+#define VOS_QUEUE_FLAG_BLOCK    0x02u   /**< vos_queueSend() waits while the queue is full          */
+
 
 #ifdef HIGH_PERF_INDEXED
     /** We internally allocate memory always by these block sizes. The largest available block is (tbd), provided */
@@ -146,6 +153,18 @@ EXT_DECL VOS_ERR_T vos_memInit (
 EXT_DECL void vos_memDelete (
     UINT8 *pMemoryArea);
 
+/**********************************************************************************************************************/
+/** Set how the memory area is set up by the next vos_memInit().
+ *  Normally set through vos_threadSetRtProfile().
+ *
+ *  @param[in]      prefault        Touch every page of the memory area during vos_memInit()
+ *  @param[in]      hugePages       Map a self-allocated memory area from huge pages (falls back to the heap)
+ */
+
+EXT_DECL void vos_memSetPoolMode (
+    BOOL8   prefault,
+    BOOL8   hugePages);
+
 /**********************************************************************************************************************/
 /** Allocate a block of memory (from memory area above).
  *
@@ -321,6 +340,32 @@ EXT_DECL VOS_ERR_T vos_queueCreate (
     VOS_QUEUE_T         *pQueueHandle );
 
 
+/**********************************************************************************************************************/
+/** Initialize a lock-free message queue.
+ *  The queue is preallocated and bounded; it is used with vos_queueSend(), vos_queueReceive() and
+ *  vos_queueDestroy() like a queue created by vos_queueCreate().
+ *  FIFO queues are a ring buffer of maxNoOfMsg rounded up to the next power of two entries, LIFO queues a
+ *  stack of maxNoOfMsg entries. Senders and receivers only enter the kernel if the queue is empty (or full with
+ *  VOS_QUEUE_FLAG_BLOCK) and the other side has to be woken up.
+ *  Without atomic operations provided by the compiler, a queue as by vos_queueCreate() is returned.
+ *
+ *  @param[in]      queueType       Define queue type (FIFO or LIFO)
+ *  @param[in]      maxNoOfMsg      Maximum number of messages
+ *  @param[in]      flags           VOS_QUEUE_FLAG_SPSC, VOS_QUEUE_FLAG_BLOCK
+ *  @param[out]     pQueueHandle    Handle of created queue
+ *
+ *  @retval         VOS_NO_ERR      no error
+ *  @retval         VOS_PARAM_ERR   parameter out of range/invalid
+ *  @retval         VOS_MEM_ERR     out of memory
+ */
+
+EXT_DECL VOS_ERR_T vos_queueCreateLockFree (
+    VOS_QUEUE_POLICY_T  queueType,
+    UINT32              maxNoOfMsg,
+    UINT32              flags,
+    VOS_QUEUE_T         *pQueueHandle );
+
+
 /**********************************************************************************************************************/
 /** Send a message.
  *
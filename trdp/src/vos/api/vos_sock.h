@@ -17,6 +17,15 @@
 /*
  * $Id$
  *
+ *      AG 2026-10-19: vos_sockSendUDPAt(): key for the TX timestamp of the packet
+ *      AG 2026-10-19: vos_sockSetBusyPoll(): busy polling of the device queue on receive
+ *      AG 2026-10-19: io_uring functions (URING_SUPPORT)
+ *      AG 2026-10-19: AF_XDP socket functions (XDP_SUPPORT)
+ *      AG 2026-10-19: vos_sockSendUDPBatch(): several datagrams with one call
+ *      AG 2026-10-19: Scatter/gather send (vos_sockSendUDPV/vos_sockSendTCPV) and MSG_ZEROCOPY completions
+ *      AG 2026-10-19: vos_sockSetPayloadFilter(): in-kernel filtering of received datagrams
+ *      AG 2026-10-19: vos_sockReceiveUDPStamped(): receive timestamps
+ *      AG 2026-10-19: Launch time (SO_TXTIME) and TX timestamps for standard UDP sockets
 *       A 2019-11-11: Ticket #290: Add support for Virtualization on Windows
  *      BL 2019-09-10: Ticket #278 Don't check if a socket is < 0
  *      BL 2019-06-17: Ticket #191 Add provisions for TSN / Hard Real Time (open source)
@@ -89,6 +98,7 @@ extern "C" {
 
 #endif
 
+#define VOS_SOCK_FILTER_MAX_KEYS  250u   /**< The maximum number of keys of vos_sockSetPayloadFilter()   */
 #define VOS_TTL_MULTICAST  64       /**< The maximum number of hops a multicast packet can take    */
 #ifndef VOS_MAX_IF_NAME_SIZE        /**< The maximum size for the interface name                   */
 #ifdef IFNAMSIZ
@@ -144,12 +154,33 @@ typedef struct
     BOOL8   nonBlocking;    /**< use non blocking calls                             */
     BOOL8   no_mc_loop;     /**< no multicast loop back                             */
     BOOL8   no_udp_crc;     /**< supress udp crc computation                       */
-    BOOL8   txTime;         /**< use transmit time on send, if available            */
+    BOOL8   txTime;         /**< use transmit time on send and report TX timestamps, if available   */
     BOOL8   raw;            /**< use raw socket, not for receiver!                  */
     UINT16  vlanId;
     CHAR8   ifName[VOS_MAX_IF_NAME_SIZE]; /**< interface name if available          */
 } VOS_SOCK_OPT_T;
 
+/** Buffer of a scatter/gather send  */
+typedef struct
+{
+    const UINT8 *pBuffer;   /**< data to send                                       */
+    UINT32      size;       /**< size of the data                                   */
+} VOS_IOVEC_T;
+
+#define VOS_MAX_IOV     4u  /**< max. number of buffers of a scatter/gather send    */
+
+/** One datagram of a batch send */
+typedef struct
+{
+    const VOS_IOVEC_T   *pIov;      /**< buffers of the datagram                    */
+    UINT32              noOfIov;    /**< number of buffers (max. VOS_MAX_IOV)       */
+    UINT32              ipAddress;  /**< destination IP                             */
+    UINT16              port;       /**< destination port                           */
+    UINT32              size;       /**< out: no of bytes sent                      */
+} VOS_UDP_MSG_T;
+
+#define VOS_MAX_UDP_BATCH   64u     /**< max. number of datagrams of a batch send   */
+
 typedef fd_set VOS_FDS_T;
 
 typedef struct
@@ -474,6 +505,61 @@ EXT_DECL VOS_ERR_T vos_sockSendUDP (
     UINT32      ipAddress,
     UINT16      port);
 
+/**********************************************************************************************************************/
+/** Send UDP data at a given time.
+ *  Hand the packet to the kernel together with its launch time (Linux: SO_TXTIME/ETF qdisc). The socket must have been
+ *  opened with the txTime option. If launch times are not supported or the launch time is already due, the packet
+ *  is sent immediately.
+ *  Where supported (Linux 6.13), stampId is reported with the TX timestamp of the packet; otherwise the kernel reports
+ *  its own count of the packets sent on the socket.
+ *
+ *  @param[in]      sock               socket descriptor
+ *  @param[in]      pBuffer            pointer to data to send
+ *  @param[in,out]  pSize              In: size of the data to send, Out: no of bytes sent
+ *  @param[in]      ipAddress          destination IP
+ *  @param[in]      port               destination port
+ *  @param[in]      pTxTime            launch time (time base of vos_getTime), NULL to send immediately
+ *  @param[in]      stampId            key of the TX timestamp of this packet
+ *  @param[out]     pStampIdSet        TRUE if the packet was handed over with stampId, may be NULL
+ *
+ *  @retval         VOS_NO_ERR         no error
+ *  @retval         VOS_PARAM_ERR      parameter out of range/invalid
+ *  @retval         VOS_IO_ERR         data could not be sent
+ *  @retval         VOS_BLOCK_ERR      Call would have blocked in blocking mode
+ */
+
+EXT_DECL VOS_ERR_T vos_sockSendUDPAt (
+    SOCKET              sock,
+    const UINT8         *pBuffer,
+    UINT32              *pSize,
+    UINT32              ipAddress,
+    UINT16              port,
+    const VOS_TIMEVAL_T *pTxTime,
+    UINT32              stampId,
+    BOOL8               *pStampIdSet);
+
+/**********************************************************************************************************************/
+/** Fetch the next TX completion timestamp of a socket.
+ *  Reads the socket's error queue (Linux: SO_TIMESTAMPING). The socket must have been opened with the txTime option.
+ *  The timestamp is keyed by the stampId given to vos_sockSendUDPAt() or, if that was not set, by the kernel's
+ *  count of the packets sent on the socket, starting with 0.
+ *
+ *  @param[in]      sock               socket descriptor
+ *  @param[out]     pId                key of the packet the timestamp belongs to
+ *  @param[out]     pTxStamp           time the packet left the host (time base of vos_getTime)
+ *
+ *  @retval         VOS_NO_ERR         timestamp returned
+ *  @retval         VOS_NODATA_ERR     no (more) timestamps available
+ *  @retval         VOS_IO_ERR         a packet was dropped by the kernel (launch time missed)
+ *  @retval         VOS_PARAM_ERR      parameter out of range/invalid
+ *  @retval         VOS_UNKNOWN_ERR    not supported on this target
+ */
+
+EXT_DECL VOS_ERR_T vos_sockReceiveTxStamp (
+    SOCKET          sock,
+    UINT32          *pId,
+    VOS_TIMEVAL_T   *pTxStamp);
+
 /**********************************************************************************************************************/
 /** Receive UDP data.
  *  The caller must provide a sufficient sized buffer. If the supplied buffer is smaller than the bytes received, *pSize
@@ -507,6 +593,38 @@ EXT_DECL VOS_ERR_T vos_sockReceiveUDP (
     UINT32  *pDstIPAddr,
     BOOL8   peek);
 
+/**********************************************************************************************************************/
+/** Receive UDP data together with its arrival time.
+ *  Like vos_sockReceiveUDP, but additionally reports the time the packet was received. On Linux, the kernel receive
+ *  timestamp (SO_TIMESTAMPING, hardware if enabled on the interface) is used, other targets report the time of
+ *  reception by the stack.
+ *
+ *  @param[in]      sock            socket descriptor
+ *  @param[out]     pBuffer         pointer to applications data buffer
+ *  @param[in,out]  pSize           pointer to the received data size
+ *  @param[out]     pSrcIPAddr      pointer to source IP
+ *  @param[out]     pSrcIPPort      pointer to source port
+ *  @param[out]     pDstIPAddr      pointer to dest IP
+ *  @param[out]     pRxTime         pointer to arrival time (time base of vos_getTime)
+ *  @param[in]      peek            if true, leave data in queue
+ *
+ *  @retval         VOS_NO_ERR      no error
+ *  @retval         VOS_PARAM_ERR   sock descriptor unknown, parameter error
+ *  @retval         VOS_IO_ERR      data could not be read
+ *  @retval         VOS_NODATA_ERR  no data
+ *  @retval         VOS_BLOCK_ERR   Call would have blocked in blocking mode
+ */
+
+EXT_DECL VOS_ERR_T vos_sockReceiveUDPStamped (
+    SOCKET          sock,
+    UINT8           *pBuffer,
+    UINT32          *pSize,
+    UINT32          *pSrcIPAddr,
+    UINT16          *pSrcIPPort,
+    UINT32          *pDstIPAddr,
+    VOS_TIMEVAL_T   *pRxTime,
+    BOOL8           peek);
+
 /**********************************************************************************************************************/
 /** Bind a socket to an address and port.
  *
@@ -602,6 +720,111 @@ EXT_DECL VOS_ERR_T vos_sockSendTCP (
     const UINT8 *pBuffer,
     UINT32      *pSize);
 
+/**********************************************************************************************************************/
+/** Send UDP data from several buffers as one datagram.
+ *  If zero copy is requested and available (Linux: MSG_ZEROCOPY, enabled by vos_sockEnableZeroCopy()), the kernel
+ *  references the buffers until the completion is reported by vos_sockReceiveZeroCopy().
+ *
+ *  @param[in]      sock            socket descriptor
+ *  @param[in]      pIov            buffers to send
+ *  @param[in]      noOfIov         number of buffers (max. VOS_MAX_IOV)
+ *  @param[in,out]  pSize           In: total size of the data to send, Out: no of bytes sent
+ *  @param[in]      ipAddress       destination IP
+ *  @param[in]      port            destination port
+ *  @param[in,out]  pZeroCopy       In: try zero copy, Out: TRUE if the data was sent with zero copy
+ *
+ *  @retval         VOS_NO_ERR      no error
+ *  @retval         VOS_PARAM_ERR   sock descriptor unknown, parameter error
+ *  @retval         VOS_MEM_ERR     out of memory (targets without scatter/gather support)
+ *  @retval         VOS_IO_ERR      data could not be sent
+ *  @retval         VOS_BLOCK_ERR   Call would have blocked in blocking mode
+ */
+
+EXT_DECL VOS_ERR_T vos_sockSendUDPV (
+    SOCKET              sock,
+    const VOS_IOVEC_T   *pIov,
+    UINT32              noOfIov,
+    UINT32              *pSize,
+    UINT32              ipAddress,
+    UINT16              port,
+    BOOL8               *pZeroCopy);
+
+/**********************************************************************************************************************/
+/** Send several UDP datagrams with one call (Linux: sendmmsg), other targets send them one by one.
+ *  Datagrams are sent in order, sending stops at the first one which could not be sent.
+ *
+ *  @param[in]      sock            socket descriptor
+ *  @param[in,out]  pMsg            datagrams to send, the size sent is returned per datagram
+ *  @param[in,out]  pNoOfMsg        In: number of datagrams (max. VOS_MAX_UDP_BATCH), Out: number of datagrams sent
+ *
+ *  @retval         VOS_NO_ERR      at least one datagram was sent
+ *  @retval         VOS_PARAM_ERR   sock descriptor unknown, parameter error
+ *  @retval         VOS_MEM_ERR     out of memory (targets without scatter/gather support)
+ *  @retval         VOS_IO_ERR      data could not be sent
+ *  @retval         VOS_BLOCK_ERR   Call would have blocked in blocking mode
+ */
+
+EXT_DECL VOS_ERR_T vos_sockSendUDPBatch (
+    SOCKET          sock,
+    VOS_UDP_MSG_T   *pMsg,
+    UINT32          *pNoOfMsg);
+
+/**********************************************************************************************************************/
+/** Send TCP data from several buffers.
+ *  Without zero copy, sends until all data is sent or the call would block (like vos_sockSendTCP).
+ *  With zero copy, a single send call is made: each call is one zero copy completion, the rest is sent by the next call.
+ *
+ *  @param[in]      sock            socket descriptor
+ *  @param[in]      pIov            buffers to send
+ *  @param[in]      noOfIov         number of buffers (max. VOS_MAX_IOV)
+ *  @param[in,out]  pSize           In: total size of the data to send, Out: no of bytes sent
+ *  @param[in,out]  pZeroCopy       In: try zero copy, Out: TRUE if data was sent with zero copy
+ *
+ *  @retval         VOS_NO_ERR      no error
+ *  @retval         VOS_PARAM_ERR   sock descriptor unknown, parameter error
+ *  @retval         VOS_MEM_ERR     out of memory (targets without scatter/gather support)
+ *  @retval         VOS_IO_ERR      data could not be sent
+ *  @retval         VOS_NOCONN_ERR  no TCP connection
+ *  @retval         VOS_BLOCK_ERR   call would have blocked in blocking mode, data partially sent
+ */
+
+EXT_DECL VOS_ERR_T vos_sockSendTCPV (
+    SOCKET              sock,
+    const VOS_IOVEC_T   *pIov,
+    UINT32              noOfIov,
+    UINT32              *pSize,
+    BOOL8               *pZeroCopy);
+
+/**********************************************************************************************************************/
+/** Enable zero copy sending on a socket (Linux: SO_ZEROCOPY).
+ *
+ *  @param[in]      sock            socket descriptor
+ *
+ *  @retval         VOS_NO_ERR      no error
+ *  @retval         VOS_PARAM_ERR   sock descriptor unknown
+ *  @retval         VOS_UNKNOWN_ERR not supported on this target or by the kernel
+ */
+
+EXT_DECL VOS_ERR_T vos_sockEnableZeroCopy (
+    SOCKET sock);
+
+/**********************************************************************************************************************/
+/** Fetch the next zero copy completion of a socket.
+ *  Zero copy sends are numbered consecutively per socket, starting with 0. Completions are reported in ranges.
+ *
+ *  @param[in]      sock            socket descriptor
+ *  @param[out]     pDone           number of the last completed zero copy send + 1
+ *
+ *  @retval         VOS_NO_ERR      completion returned
+ *  @retval         VOS_NODATA_ERR  no (more) completions available
+ *  @retval         VOS_PARAM_ERR   parameter out of range/invalid
+ *  @retval         VOS_UNKNOWN_ERR not supported on this target
+ */
+
+EXT_DECL VOS_ERR_T vos_sockReceiveZeroCopy (
+    SOCKET  sock,
+    UINT32  *pDone);
+
 /**********************************************************************************************************************/
 /** Receive TCP data.
  *  The caller must provide a sufficient sized buffer. If the supplied buffer is smaller than the bytes received, *pSize
@@ -639,6 +862,51 @@ EXT_DECL VOS_ERR_T vos_sockSetMulticastIf (
     SOCKET  sock,
     UINT32  mcIfAddress);
 
+/**********************************************************************************************************************/
+/** Drop unwanted UDP datagrams in the kernel.
+ *  A datagram is passed to the socket only if the 32 bit big endian key at keyOffset of its payload matches one of
+ *  the given keys, if the 16 bit big endian field at bypassOffset equals bypassValue, or if it is too short to carry
+ *  the key. All other datagrams are dropped before they are copied to user space.
+ *
+ *  @param[in]      sock               socket descriptor
+ *  @param[in]      keyOffset          payload offset of the key
+ *  @param[in]      pKeys              keys to pass, NULL removes the filter
+ *  @param[in]      noOfKeys           number of keys (max. VOS_SOCK_FILTER_MAX_KEYS)
+ *  @param[in]      bypassOffset       payload offset of the bypass field
+ *  @param[in]      bypassValue        value of the bypass field to pass regardless of the key
+ *
+ *  @retval         VOS_NO_ERR         no error
+ *  @retval         VOS_PARAM_ERR      parameter out of range/invalid
+ *  @retval         VOS_SOCK_ERR       filter could not be attached
+ *  @retval         VOS_UNKNOWN_ERR    not supported on this target
+ */
+
+EXT_DECL VOS_ERR_T vos_sockSetPayloadFilter (
+    SOCKET          sock,
+    UINT32          keyOffset,
+    const UINT32    *pKeys,
+    UINT32          noOfKeys,
+    UINT32          bypassOffset,
+    UINT16          bypassValue);
+
+/**********************************************************************************************************************/
+/** Busy poll the device queue on receive.
+ *  A receive finding no data polls the queue of the network device for up to busyPollTime us before it returns,
+ *  device interrupts are deferred while the socket is polled. Devices without polling support are not affected.
+ *
+ *  @param[in]      sock               socket descriptor
+ *  @param[in]      busyPollTime       time to poll in us, 0 to switch busy polling off
+ *
+ *  @retval         VOS_NO_ERR         no error
+ *  @retval         VOS_PARAM_ERR      sock descriptor unknown
+ *  @retval         VOS_SOCK_ERR       option could not be set (e.g. missing privileges)
+ *  @retval         VOS_UNKNOWN_ERR    not supported on this target
+ */
+
+EXT_DECL VOS_ERR_T vos_sockSetBusyPoll (
+    SOCKET  sock,
+    UINT32  busyPollTime);
+
 
 /**********************************************************************************************************************/
 /** Determines the address to bind to since the behaviour in the different OS is different
@@ -681,6 +949,100 @@ EXT_DECL VOS_ERR_T  vos_sockBind2IF (SOCKET         sock,
 EXT_DECL void       vos_sockPrintOptions (SOCKET sock);
 #endif
 
+#ifdef XDP_SUPPORT
+/* Extension for AF_XDP (kernel bypass) support */
+typedef struct VOS_XSK *VOS_XSK_T;
+
+typedef struct
+{
+    UINT32          numRx;              /**< frames received                                    */
+    UINT32          numTx;              /**< frames posted for sending                          */
+    UINT32          numRxInvalid;       /**< frames received which were no UDP datagrams        */
+    UINT32          numTxNoFrame;       /**< send failed, no free frame                         */
+    UINT32          numTxNoNeigh;       /**< send failed, destination MAC address unknown       */
+    BOOL8           zeroCopy;           /**< socket bound in zero copy mode                     */
+    BOOL8           nativeXdp;          /**< XDP program runs in the driver                     */
+} VOS_XSK_STATS_T;
+
+typedef struct
+{
+    UINT8           *pData;             /**< UDP payload in UMEM, NULL if frame is invalid      */
+    UINT32          size;               /**< size of the UDP payload                            */
+    VOS_IP4_ADDR_T  srcIpAddr;          /**< source IP address                                  */
+    VOS_IP4_ADDR_T  dstIpAddr;          /**< destination IP address                             */
+    UINT16          srcPort;            /**< source port                                        */
+} VOS_XSK_FRAME_T;
+
+EXT_DECL VOS_ERR_T  vos_xskOpen (VOS_XSK_T      *pXsk,
+                                 const CHAR8    *pIfName,
+                                 UINT32         queueId,
+                                 UINT16         port,
+                                 BOOL8          zeroCopy);
+EXT_DECL void       vos_xskClose (VOS_XSK_T xsk);
+EXT_DECL SOCKET     vos_xskSocket (VOS_XSK_T xsk);
+EXT_DECL VOS_ERR_T  vos_xskReceive (VOS_XSK_T       xsk,
+                                    VOS_XSK_FRAME_T *pFrame,
+                                    UINT32          *pNoOfFrames);
+EXT_DECL void       vos_xskRelease (VOS_XSK_T xsk);
+EXT_DECL VOS_ERR_T  vos_xskSendUDP (VOS_XSK_T       xsk,
+                                    const UINT8     *pBuffer,
+                                    UINT32          size,
+                                    VOS_IP4_ADDR_T  srcIpAddress,
+                                    VOS_IP4_ADDR_T  dstIpAddress,
+                                    UINT16          port,
+                                    UINT8           tos,
+                                    UINT8           ttl);
+EXT_DECL void       vos_xskFlush (VOS_XSK_T xsk);
+EXT_DECL void       vos_xskGetStatistics (VOS_XSK_T         xsk,
+                                          VOS_XSK_STATS_T   *pStats);
+#endif
+
+#ifdef URING_SUPPORT
+/* Extension for io_uring support */
+typedef struct VOS_URING *VOS_URING_T;
+
+typedef struct
+{
+    UINT32          numRx;              /**< datagrams received                                 */
+    UINT32          numRxInvalid;       /**< datagrams truncated                                */
+    UINT32          numTx;              /**< datagrams sent                                     */
+    UINT32          numTxErr;           /**< sends failed                                       */
+    UINT32          numArmed;           /**< multishot receives armed                           */
+    UINT32          numNoBuf;           /**< receives ended for lack of buffers                 */
+    UINT32          numEnter;           /**< io_uring_enter() calls                             */
+} VOS_URING_STATS_T;
+
+typedef struct
+{
+    UINT8           *pData;             /**< datagram in the receive buffer, NULL if truncated  */
+    UINT32          size;               /**< size of the datagram                               */
+    VOS_IP4_ADDR_T  srcIpAddr;          /**< source IP address                                  */
+    VOS_IP4_ADDR_T  dstIpAddr;          /**< destination IP address                             */
+    UINT16          srcPort;            /**< source port                                        */
+    VOS_TIMEVAL_T   rxTime;             /**< arrival time                                       */
+} VOS_URING_FRAME_T;
+
+EXT_DECL VOS_ERR_T  vos_uringOpen (VOS_URING_T  *pRing,
+                                   UINT32       noOfBufs);
+EXT_DECL void       vos_uringClose (VOS_URING_T ring);
+EXT_DECL SOCKET     vos_uringSocket (VOS_URING_T ring);
+EXT_DECL VOS_ERR_T  vos_uringArm (VOS_URING_T   ring,
+                                  SOCKET        sock);
+EXT_DECL VOS_ERR_T  vos_uringReceive (VOS_URING_T       ring,
+                                      VOS_URING_FRAME_T *pFrame,
+                                      UINT32            *pNoOfFrames);
+EXT_DECL void       vos_uringRelease (VOS_URING_T ring);
+EXT_DECL VOS_ERR_T  vos_uringSendUDP (VOS_URING_T       ring,
+                                      SOCKET            sock,
+                                      const UINT8       *pBuffer,
+                                      UINT32            size,
+                                      VOS_IP4_ADDR_T    ipAddress,
+                                      UINT16            port);
+EXT_DECL void       vos_uringFlush (VOS_URING_T ring);
+EXT_DECL void       vos_uringGetStatistics (VOS_URING_T         ring,
+                                            VOS_URING_STATS_T   *pStats);
+#endif
+
 #ifdef __cplusplus
 }
 #endif
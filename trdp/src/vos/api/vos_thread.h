@@ -17,6 +17,8 @@
 /*
 * $Id$
 *
+*      AG 2026-10-19: Timing statistics of cyclic threads
+*      AG 2026-10-19: Real-time profile: CPU affinity, memory locking, stack and heap prefault
 *      A 2019-12-17: Ticket #308: Add vos Sim function to API 
 *      A 2019-11-11: Ticket #290: Add support for Virtualization on Windows
 *      BL 2019-06-12: Ticket #238 VOS: Public API headers include private header file
@@ -143,6 +145,33 @@ typedef struct VOS_SEMA *VOS_SEMA_T;
 /** Hidden thread handle definition    */
 typedef void *VOS_THREAD_T;
 
+/** CPU set for thread and IRQ affinity, bit n selects CPU n    */
+typedef UINT64 VOS_CPU_SET_T;
+
+/** Real-time profile for the process and the threads created afterwards    */
+typedef struct
+{
+    VOS_CPU_SET_T   cpuSet;             /**< default CPU set of new threads, 0: no pinning                  */
+    BOOL8           lockMemory;         /**< lock current and future pages into RAM (mlockall)              */
+    BOOL8           prefaultStack;      /**< touch the stack of new threads before they start working       */
+    BOOL8           prefaultHeap;       /**< touch the vos_memInit() pool when it is set up                 */
+    BOOL8           hugePages;          /**< back a self-allocated vos_memInit() pool by huge pages         */
+} VOS_RT_PROFILE_T;
+
+/** Timing statistics of cyclic threads, all times in us    */
+typedef struct
+{
+    UINT32  numThreads;                 /**< number of cyclic threads covered                               */
+    UINT32  interval;                   /**< cycle time (0 if more than one thread is covered)              */
+    UINT32  numCycles;                  /**< number of executed cycles                                      */
+    UINT32  numMissed;                  /**< number of periods skipped because a cycle ran too long         */
+    UINT32  minWakeupLatency;           /**< shortest delay between deadline and wakeup                     */
+    UINT32  maxWakeupLatency;           /**< longest delay between deadline and wakeup                      */
+    UINT32  avgWakeupLatency;           /**< average delay between deadline and wakeup                      */
+    UINT32  maxExecTime;                /**< longest execution time of the thread function                  */
+    UINT32  avgExecTime;                /**< average execution time of the thread function                  */
+} VOS_THREAD_STATS_T;
+
 
 /***********************************************************************************************************************
  * PROTOTYPES
@@ -266,6 +295,86 @@ EXT_DECL VOS_ERR_T vos_threadTerminate (
 EXT_DECL VOS_ERR_T vos_threadIsActive (
     VOS_THREAD_T thread);
 
+/**********************************************************************************************************************/
+/** Set the real-time profile.
+ *  Memory locking takes effect immediately. The CPU set and stack prefaulting apply to threads created by
+ *  vos_threadCreate()/vos_threadCreateSync() afterwards, the heap options to the next vos_memInit(). Call it
+ *  before tlc_init() to get a prefaulted or huge page backed memory pool.
+ *
+ *  @param[in]      pProfile          Pointer to the profile
+ *
+ *  @retval         VOS_NO_ERR        no error
+ *  @retval         VOS_PARAM_ERR     parameter out of range/invalid
+ *  @retval         VOS_MEM_ERR       memory could not be locked
+ *  @retval         VOS_UNKNOWN_ERR   not supported by the target
+ */
+
+EXT_DECL VOS_ERR_T vos_threadSetRtProfile (
+    const VOS_RT_PROFILE_T *pProfile);
+
+/**********************************************************************************************************************/
+/** Pin a thread to a set of CPUs.
+ *
+ *  @param[in]      thread            Thread handle (or NULL if current thread)
+ *  @param[in]      cpuSet            CPUs the thread may run on, bit n selects CPU n
+ *
+ *  @retval         VOS_NO_ERR        no error
+ *  @retval         VOS_PARAM_ERR     parameter out of range/invalid
+ *  @retval         VOS_THREAD_ERR    affinity could not be set
+ *  @retval         VOS_UNKNOWN_ERR   not supported by the target
+ */
+
+EXT_DECL VOS_ERR_T vos_threadSetAffinity (
+    VOS_THREAD_T    thread,
+    VOS_CPU_SET_T   cpuSet);
+
+/**********************************************************************************************************************/
+/** Route an interrupt to a set of CPUs.
+ *  Used to keep NIC interrupts away from the CPUs running the cyclic TRDP threads (needs root privileges).
+ *
+ *  @param[in]      irq               Interrupt number
+ *  @param[in]      cpuSet            CPUs allowed to serve the interrupt, bit n selects CPU n
+ *
+ *  @retval         VOS_NO_ERR        no error
+ *  @retval         VOS_PARAM_ERR     parameter out of range/invalid
+ *  @retval         VOS_IO_ERR        affinity could not be written
+ *  @retval         VOS_UNKNOWN_ERR   not supported by the target
+ */
+
+EXT_DECL VOS_ERR_T vos_irqSetAffinity (
+    UINT32          irq,
+    VOS_CPU_SET_T   cpuSet);
+
+/**********************************************************************************************************************/
+/** Get the timing statistics of cyclic threads.
+ *  Cyclic threads are woken up at absolute deadlines, multiples of the interval after the start time. A cycle
+ *  running past the next deadline skips the missed periods instead of shifting the following ones.
+ *
+ *  @param[in]      thread            Thread handle of a cyclic thread (or NULL for the sum over all cyclic threads)
+ *  @param[out]     pStats            Pointer to the statistics
+ *
+ *  @retval         VOS_NO_ERR        no error
+ *  @retval         VOS_PARAM_ERR     parameter out of range/invalid, thread is not a cyclic thread
+ *  @retval         VOS_UNKNOWN_ERR   not supported by the target
+ */
+
+EXT_DECL VOS_ERR_T vos_threadGetStatistics (
+    VOS_THREAD_T        thread,
+    VOS_THREAD_STATS_T  *pStats);
+
+/**********************************************************************************************************************/
+/** Reset the timing statistics of cyclic threads.
+ *
+ *  @param[in]      thread            Thread handle of a cyclic thread (or NULL for all cyclic threads)
+ *
+ *  @retval         VOS_NO_ERR        no error
+ *  @retval         VOS_PARAM_ERR     thread is not a cyclic thread
+ *  @retval         VOS_UNKNOWN_ERR   not supported by the target
+ */
+
+EXT_DECL VOS_ERR_T vos_threadResetStatistics (
+    VOS_THREAD_T thread);
+
 #ifdef SIM
 /**********************************************************************************************************************/
 /** Register a thread.
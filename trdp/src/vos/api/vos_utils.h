@@ -17,6 +17,7 @@
  /*
  * $Id$
  *
+ *      AG 2026-10-19: Log level gate before formatting, compile-time level stripping, binary log ring
  *      BL 2019-01-23: Ticket #231: XML config from stream buffer
  *     AHW 2018-11-28: Doxygen comment errors
  *      BL 2017-05-08: Compiler warnings, doxygen comment errors
@@ -48,6 +49,16 @@ extern "C" {
 
 extern VOS_PRINT_DBG_T gPDebugFunction;
 extern void *gRefCon;
+extern VOS_LOG_T gVosLogLevel;
+extern BOOL8 gVosLogRingActive;
+
+/** Highest log category compiled in (VOS_LOG_USR is always kept), e.g. -DVOS_LOG_MAX_LEVEL=VOS_LOG_WARNING */
+#ifndef VOS_LOG_MAX_LEVEL
+#define VOS_LOG_MAX_LEVEL       VOS_LOG_DBG
+#endif
+
+/** Size of the argument area of a log ring entry (numbers take 8 bytes each, strings are copied) */
+#define VOS_LOG_RING_ARG_SIZE   112u
 
 /** String size definitions for the debug output functions */
 #define VOS_MAX_PRNT_STR_SIZE   256u         /**< Max. size of the debug/error string of debug function */
@@ -73,38 +84,60 @@ extern void *gRefCon;
     snprintf(str, size, format, ## args)    /*lint !e586 logging output needed */
 #endif
 
+/** Check if output of the log category is wanted, before anything is formatted.
+    Categories above VOS_LOG_MAX_LEVEL are removed by the compiler. */
+#define vos_logEnabled(level)   ((gPDebugFunction != NULL) &&                               \
+                                 (((level) == VOS_LOG_USR) ||                               \
+                                  (((level) <= VOS_LOG_MAX_LEVEL) && ((level) <= gVosLogLevel))))
+
 /** Debug output macro without formatting options */
-#define vos_printLogStr(level, string)  {if (gPDebugFunction != NULL)         \
-                                         {gPDebugFunction(gRefCon,            \
-                                                          (level),            \
-                                                          vos_getTimeStamp(), \
-                                                          (__FILE__),         \
-                                                          (UINT16)(__LINE__), \
-                                                          (string)); }}
+#define vos_printLogStr(level, string)  {if (vos_logEnabled(level))                         \
+                                         {if (gVosLogRingActive)                            \
+                                          {vos_logRingPut((level), (__FILE__),              \
+                                                          (UINT16)(__LINE__), "%s", (string)); } \
+                                          else                                              \
+                                          {gPDebugFunction(gRefCon,                         \
+                                                           (level),                         \
+                                                           vos_getTimeStamp(),              \
+                                                           (__FILE__),                      \
+                                                           (UINT16)(__LINE__),              \
+                                                           (string)); }}}
 
 /** Debug output macro with formatting options */
 #if (defined (WIN32) || defined (WIN64))
     #define vos_printLog(level, format, ...)                                   \
-    {if (gPDebugFunction != NULL)                                              \
-     {   char str[VOS_MAX_PRNT_STR_SIZE];                                      \
-         (void) _snprintf_s(str, sizeof(str), _TRUNCATE, format, __VA_ARGS__); \
-         vos_printLogStr(level, str);                                          \
+    {if (vos_logEnabled(level))                                                \
+     {if (gVosLogRingActive)                                                   \
+      {vos_logRingPut((level), (__FILE__), (UINT16)(__LINE__), format, __VA_ARGS__); } \
+      else                                                                     \
+      {   char str[VOS_MAX_PRNT_STR_SIZE];                                     \
+          (void) _snprintf_s(str, sizeof(str), _TRUNCATE, format, __VA_ARGS__); \
+          gPDebugFunction(gRefCon, (level), vos_getTimeStamp(), (__FILE__), (UINT16)(__LINE__), str); \
+      }                                                                        \
      }                                                                         \
     }
 #elif defined(__clang__)
     #define vos_printLog(level, format, ...)                    \
-    {if (gPDebugFunction != NULL)                               \
-     {   char str[VOS_MAX_PRNT_STR_SIZE];                       \
-         (void)snprintf(str, sizeof(str), format, __VA_ARGS__); \
-         vos_printLogStr(level, str);                           \
+    {if (vos_logEnabled(level))                                 \
+     {if (gVosLogRingActive)                                    \
+      {vos_logRingPut((level), (__FILE__), (UINT16)(__LINE__), format, __VA_ARGS__); } \
+      else                                                      \
+      {   char str[VOS_MAX_PRNT_STR_SIZE];                      \
+          (void)snprintf(str, sizeof(str), format, __VA_ARGS__); \
+          gPDebugFunction(gRefCon, (level), vos_getTimeStamp(), (__FILE__), (UINT16)(__LINE__), str); \
+      }                                                         \
      }                                                          \
     }
 #else
     #define vos_printLog(level, format, args ...)            \
-    {if (gPDebugFunction != NULL)                            \
-     {   char str[VOS_MAX_PRNT_STR_SIZE];                    \
-         (void) snprintf(str, sizeof(str), format, ## args); \
-         vos_printLogStr(level, str);                        \
+    {if (vos_logEnabled(level))                              \
+     {if (gVosLogRingActive)                                 \
+      {vos_logRingPut((level), (__FILE__), (UINT16)(__LINE__), format, ## args); } \
+      else                                                   \
+      {   char str[VOS_MAX_PRNT_STR_SIZE];                   \
+          (void) snprintf(str, sizeof(str), format, ## args); \
+          gPDebugFunction(gRefCon, (level), vos_getTimeStamp(), (__FILE__), (UINT16)(__LINE__), str); \
+      }                                                      \
      }                                                       \
     }
 #endif
@@ -240,6 +273,70 @@ EXT_DECL VOS_ERR_T vos_init (
 
 EXT_DECL void vos_terminate (void);
 
+/**********************************************************************************************************************/
+/** Set the log level.
+ *  Log output of a less important category is suppressed before it is formatted (VOS_LOG_USR is always output).
+ *  Default is VOS_LOG_DBG (all output).
+ *
+ *  @param[in]        level             highest category to output (VOS_LOG_ERROR...VOS_LOG_DBG)
+ */
+
+EXT_DECL void vos_setLogLevel (
+    VOS_LOG_T level);
+
+/**********************************************************************************************************************/
+/** Activate the binary log ring.
+ *  While the ring is active, log output is not formatted by the calling thread. The format string pointer, the raw
+ *  arguments and a time stamp are stored in a lock-free ring instead, which must be drained by a background thread
+ *  (e.g. of low priority) calling vos_logRingDrain(). Entries are dropped (and counted) if the ring is full.
+ *  Format strings must be static (string literals), string arguments are copied.
+ *
+ *  @param[in]        noOfEntries       number of entries, rounded up to a power of two
+ *  @retval           VOS_NO_ERR        no error
+ *  @retval           VOS_PARAM_ERR     no entries
+ *  @retval           VOS_MEM_ERR       out of memory
+ *  @retval           VOS_INIT_ERR      already active or not supported by the compiler
+ */
+
+EXT_DECL VOS_ERR_T vos_logRingInit (
+    UINT32 noOfEntries);
+
+/**********************************************************************************************************************/
+/** Deactivate the binary log ring.
+ *  Remaining entries are output, the ring memory is released as soon as no producer is inside vos_logRingPut().
+ *  Must not be called while another thread is draining the ring.
+ */
+
+EXT_DECL void vos_logRingTerm (void);
+
+/**********************************************************************************************************************/
+/** Format entries of the log ring and pass them to the debug output function.
+ *  Only one thread may drain the ring.
+ *
+ *  @param[in]        maxEntries        maximum number of entries to output, 0 for all
+ *  @retval           number of entries output
+ */
+
+EXT_DECL UINT32 vos_logRingDrain (
+    UINT32 maxEntries);
+
+/**********************************************************************************************************************/
+/** Store a log entry in the binary log ring (used by the log macros).
+ *
+ *  @param[in]        level             log category
+ *  @param[in]        pFile             source file
+ *  @param[in]        line              source line
+ *  @param[in]        pFormat           printf format string, must be static
+ *  @param[in]        ...               arguments
+ */
+
+EXT_DECL void vos_logRingPut (
+    VOS_LOG_T   level,
+    const CHAR8 *pFile,
+    UINT16      line,
+    const CHAR8 *pFormat,
+    ...);
+
 /**********************************************************************************************************************/
 /** Return a human readable version representation.
  *    Return string in the form 'v.r.u.b'
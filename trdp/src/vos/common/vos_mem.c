@@ -19,6 +19,8 @@
  * $Id$
  *
  * Changes:
+ *      AG 2026-10-19: Lock-free bounded queue variant (vos_queueCreateLockFree)
+ *      AG 2026-10-19: Optionally prefaulted and huge page backed memory area
  *      BL 2018-06-20: Ticket #184: Building with VS 2015: WIN64 and Windows threads (SOCKET instead of INT32)
  *      BL 2016-07-06: Ticket #122 64Bit compatibility (+ compiler warnings)
  *      BL 2016-02-10: Debug print: tabs before size output
@@ -46,6 +48,13 @@
 #include <strings.h>
 #include <unistd.h>
 #include <pthread.h>
+#include <sys/mman.h>
+#endif
+
+#if defined(POSIX) && defined(__linux__)
+#include <time.h>
+#include <sys/syscall.h>
+#include <linux/futex.h>
 #endif
 
 #ifdef ESP32
@@ -94,6 +103,7 @@ typedef struct
     UINT32              allocSize;      /* Size of allocated area */
     UINT32              noOfBlocks;     /* No of blocks */
     BOOL8               wasMalloced;    /* needs to be freed in the end */
+    UINT32              mapSize;        /* size of the huge page mapping, 0 if not mapped */
 
     /* Free block header array, one entry for each possible free block size */
     struct
@@ -125,6 +135,7 @@ struct VOS_QUEUE
     VOS_SEMA_T              semaphore;
     VOS_MUTEX_T             mutex;
     struct VOS_QUEUE_ELEM   *pQueue;
+    struct VOS_QUEUE_LF     *pLockFree;     /* != NULL if created by vos_queueCreateLockFree() */
 };
 
 /* Queue element struct */
@@ -134,18 +145,66 @@ struct VOS_QUEUE_ELEM
     UINT32  size;
 };
 
+/* Lock-free queues need the atomic builtins of the compiler */
+#if defined(__GNUC__) || defined(__clang__)
+#define VOS_QUEUE_LOCKFREE_SUPPORT  1
+#endif
+
+#ifdef VOS_QUEUE_LOCKFREE_SUPPORT
+
+/* Waiting for an empty/full lock-free queue sleeps on a futex, other targets poll */
+#if defined(POSIX) && defined(__linux__) && defined(SYS_futex) && defined(FUTEX_WAIT_BITSET)
+#define VOS_QUEUE_FUTEX             1
+#endif
+
+#define VOS_QUEUE_CACHE_LINE        64u
+#define VOS_QUEUE_NIL               0xFFFFFFFFu     /* end of a LIFO node list */
+#define VOS_QUEUE_POLL_TIME         100u            /* us, wait time without futex */
+
+/* Entry of a lock-free queue */
+typedef struct
+{
+    UINT32  seq;                /* FIFO: position the entry is ready for, LIFO: index of next node */
+    UINT32  size;
+    UINT8   *pData;
+} VOS_QUEUE_LF_ENTRY_T;
+
+/* Lock-free queue, the positions advanced by senders and receivers live on separate cache lines */
+struct VOS_QUEUE_LF
+{
+    UINT32                  head;           /* FIFO: next position to write */
+    UINT8                   pad1[VOS_QUEUE_CACHE_LINE - sizeof(UINT32)];
+    UINT32                  tail;           /* FIFO: next position to read */
+    UINT8                   pad2[VOS_QUEUE_CACHE_LINE - sizeof(UINT32)];
+    UINT64                  stack;          /* LIFO: tag << 32 | first used node */
+    UINT64                  freeList;       /* LIFO: tag << 32 | first free node */
+    UINT32                  putSeq;         /* futex, incremented by every send */
+    UINT32                  getSeq;         /* futex, incremented by every receive */
+    UINT32                  numWaitRx;      /* receivers sleeping on putSeq */
+    UINT32                  numWaitTx;      /* senders sleeping on getSeq */
+    UINT32                  mask;           /* FIFO: no of entries - 1 */
+    UINT32                  flags;          /* VOS_QUEUE_FLAG_xxx */
+    BOOL8                   lifo;
+    VOS_QUEUE_LF_ENTRY_T    *pEntry;
+};
+
+#endif
+
 /* Forward declaration, Mutex size is target dependent! */
 VOS_ERR_T       vos_mutexLocalCreate (struct VOS_MUTEX *pMutex);
 void            vos_mutexLocalDelete (struct VOS_MUTEX *pMutex);
 
 const UINT32    cQueueMagic = 0xE5E1E5E1;
+
+/* Huge pages are assumed to be 2MB, the mapping is rounded up to it */
+#define VOS_MEM_HUGEPAGE_SIZE  0x200000u
 /***********************************************************************************************************************
  *  LOCALS
  */
 
 static MEM_CONTROL_T gMem =
 {
-    {0, PTHREAD_MUTEX_INITIALIZER}, NULL, NULL, 0L, 0L, 0L, FALSE,
+    {0, PTHREAD_MUTEX_INITIALIZER}, NULL, NULL, 0L, 0L, 0L, FALSE, 0L,
     {
         {0L, NULL}, {0L, NULL}, {0L, NULL}, {0L, NULL}, {0L, NULL}, {0L, NULL}, {0L, NULL},
         {0L, NULL}, {0L, NULL}, {0L, NULL}, {0L, NULL}, {0L, NULL}, {0L, NULL}, {0L, NULL}, {0L, NULL}
@@ -153,6 +212,10 @@ static MEM_CONTROL_T gMem =
     {0, 0, 0, 0, 0, {0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, VOS_MEM_PREALLOCATE}
 };
 
+/* Set up mode of the memory area, survives vos_memDelete() */
+static BOOL8    gMemPrefault    = FALSE;
+static BOOL8    gMemHugePages   = FALSE;
+
 /***********************************************************************************************************************
  * GLOBAL FUNCTIONS
  */
@@ -243,18 +306,45 @@ EXT_DECL VOS_ERR_T vos_memInit (
     {
         if (pMemoryArea == NULL)                    /* We must allocate memory from the heap once   */
         {
-            gMem.pArea = (UINT8 *) malloc(size);    /*lint !e421 !e586 optional use of heap memory for debugging/development
-                                                      */
-            if (gMem.pArea == NULL)
+#if defined(POSIX) && defined(MAP_HUGETLB)
+            if (gMemHugePages == TRUE)
             {
-                return VOS_MEM_ERR;
+                UINT32  mapSize = ((size + VOS_MEM_HUGEPAGE_SIZE - 1u) / VOS_MEM_HUGEPAGE_SIZE) * VOS_MEM_HUGEPAGE_SIZE;
+                void    *pMap   = mmap(NULL, mapSize, PROT_READ | PROT_WRITE,
+                                       MAP_PRIVATE | MAP_ANONYMOUS | MAP_HUGETLB, -1, 0);
+                if (pMap != MAP_FAILED)
+                {
+                    gMem.pArea      = (UINT8 *) pMap;
+                    gMem.mapSize    = mapSize;
+                }
+                else
+                {
+                    vos_printLog(VOS_LOG_WARNING, "vos_memInit() no huge pages available (Err: %d), using heap\n",
+                                 errno);
+                }
+            }
+#endif
+            if (gMem.mapSize == 0u)
+            {
+                gMem.pArea = (UINT8 *) malloc(size);    /*lint !e421 !e586 optional use of heap memory for
+                                                          debugging/development */
+                if (gMem.pArea == NULL)
+                {
+                    return VOS_MEM_ERR;
+                }
+                gMem.wasMalloced = TRUE;
             }
-            gMem.wasMalloced = TRUE;
         }
         else                                        /* Use the memory provided from calling application */
         {
             gMem.pArea = pMemoryArea;
         }
+
+        /* Fault in every page now instead of on the first allocation */
+        if (gMemPrefault == TRUE)
+        {
+            memset(gMem.pArea, 0, size);
+        }
     }
     else
     {
@@ -340,9 +430,30 @@ EXT_DECL void vos_memDelete (
     {
         free(gMem.pArea);    /*lint !e421 !e586 optional use of heap memory for debugging/development */
     }
+#if defined(POSIX) && defined(MAP_HUGETLB)
+    if (gMem.mapSize != 0u && gMem.pArea != NULL)
+    {
+        (void) munmap(gMem.pArea, gMem.mapSize);
+    }
+#endif
     memset(&gMem, 0, sizeof(gMem));
 }
 
+/**********************************************************************************************************************/
+/** Set how the memory area is set up by the next vos_memInit().
+ *
+ *  @param[in]      prefault        Touch every page of the memory area during vos_memInit()
+ *  @param[in]      hugePages       Map a self-allocated memory area from huge pages (falls back to the heap)
+ */
+
+EXT_DECL void vos_memSetPoolMode (
+    BOOL8   prefault,
+    BOOL8   hugePages)
+{
+    gMemPrefault    = prefault;
+    gMemHugePages   = hugePages;
+}
+
 /**********************************************************************************************************************/
 /** Allocate a block of memory (from memory area above).
  *
@@ -772,6 +883,485 @@ EXT_DECL void vos_strncat (
                                                                                                                */
 /**********************************************************************************************************************/
 
+#ifdef VOS_QUEUE_LOCKFREE_SUPPORT
+/**********************************************************************************************************************/
+/** Append to a lock-free FIFO (Vyukov's bounded MPMC queue).
+ *  An entry may be written if its sequence equals the position, afterwards it is ready for reading (pos + 1).
+ *  With a single sender the position is owned by the caller and needs no CAS.
+ *
+ *  @param[in]      pLf             lock-free queue
+ *  @param[in]      pData           data pointer
+ *  @param[in]      size            data size
+ *  @retval         TRUE            appended
+ *  @retval         FALSE           queue full
+ */
+static BOOL8 vos_lfFifoPut (
+    struct VOS_QUEUE_LF *pLf,
+    UINT8               *pData,
+    UINT32              size)
+{
+    VOS_QUEUE_LF_ENTRY_T    *pEntry;
+    UINT32                  pos = __atomic_load_n(&pLf->head, __ATOMIC_RELAXED);
+    INT32                   diff;
+
+    for (;;)
+    {
+        pEntry  = &pLf->pEntry[pos & pLf->mask];
+        diff    = (INT32) (__atomic_load_n(&pEntry->seq, __ATOMIC_ACQUIRE) - pos);
+        if (diff == 0)
+        {
+            if ((pLf->flags & VOS_QUEUE_FLAG_SPSC) != 0u)
+            {
+                __atomic_store_n(&pLf->head, pos + 1u, __ATOMIC_RELAXED);
+                break;
+            }
+            if (__atomic_compare_exchange_n(&pLf->head, &pos, pos + 1u, TRUE,
+                                            __ATOMIC_RELAXED, __ATOMIC_RELAXED))
+            {
+                break;
+            }
+        }
+        else if (diff < 0)
+        {
+            return FALSE;
+        }
+        else
+        {
+            pos = __atomic_load_n(&pLf->head, __ATOMIC_RELAXED);
+        }
+    }
+    pEntry->pData   = pData;
+    pEntry->size    = size;
+    __atomic_store_n(&pEntry->seq, pos + 1u, __ATOMIC_RELEASE);
+    return TRUE;
+}
+
+/**********************************************************************************************************************/
+/** Take the oldest entry from a lock-free FIFO.
+ *  An entry may be read if its sequence equals pos + 1, afterwards it is free for the next round (pos + size).
+ *
+ *  @param[in]      pLf             lock-free queue
+ *  @param[out]     ppData          data pointer
+ *  @param[out]     pSize           data size
+ *  @retval         TRUE            entry taken
+ *  @retval         FALSE           queue empty
+ */
+static BOOL8 vos_lfFifoGet (
+    struct VOS_QUEUE_LF *pLf,
+    UINT8               * *ppData,
+    UINT32              *pSize)
+{
+    VOS_QUEUE_LF_ENTRY_T    *pEntry;
+    UINT32                  pos = __atomic_load_n(&pLf->tail, __ATOMIC_RELAXED);
+    INT32                   diff;
+
+    for (;;)
+    {
+        pEntry  = &pLf->pEntry[pos & pLf->mask];
+        diff    = (INT32) (__atomic_load_n(&pEntry->seq, __ATOMIC_ACQUIRE) - (pos + 1u));
+        if (diff == 0)
+        {
+            if ((pLf->flags & VOS_QUEUE_FLAG_SPSC) != 0u)
+            {
+                __atomic_store_n(&pLf->tail, pos + 1u, __ATOMIC_RELAXED);
+                break;
+            }
+            if (__atomic_compare_exchange_n(&pLf->tail, &pos, pos + 1u, TRUE,
+                                            __ATOMIC_RELAXED, __ATOMIC_RELAXED))
+            {
+                break;
+            }
+        }
+        else if (diff < 0)
+        {
+            return FALSE;
+        }
+        else
+        {
+            pos = __atomic_load_n(&pLf->tail, __ATOMIC_RELAXED);
+        }
+    }
+    *ppData = pEntry->pData;
+    *pSize  = pEntry->size;
+    __atomic_store_n(&pEntry->seq, pos + pLf->mask + 1u, __ATOMIC_RELEASE);
+    return TRUE;
+}
+
+/**********************************************************************************************************************/
+/** Pop a node from a LIFO node list (Treiber stack).
+ *  The list head carries a tag which is incremented by every change to rule out ABA.
+ *
+ *  @param[in]      pHead           list head
+ *  @param[in]      pEntry          node array
+ *  @retval         node index or VOS_QUEUE_NIL if the list is empty
+ */
+static UINT32 vos_lfPop (
+    UINT64                      *pHead,
+    const VOS_QUEUE_LF_ENTRY_T  *pEntry)
+{
+    UINT64  oldHead = __atomic_load_n(pHead, __ATOMIC_ACQUIRE);
+    UINT64  newHead;
+    UINT32  idx;
+
+    do
+    {
+        idx = (UINT32) oldHead;
+        if (idx == VOS_QUEUE_NIL)
+        {
+            return VOS_QUEUE_NIL;
+        }
+        /* A stale next is caught by the tag comparison of the CAS */
+        newHead = (((oldHead >> 32) + 1u) << 32) | __atomic_load_n(&pEntry[idx].seq, __ATOMIC_RELAXED);
+    }
+    while (!__atomic_compare_exchange_n(pHead, &oldHead, newHead, TRUE, __ATOMIC_ACQUIRE, __ATOMIC_ACQUIRE));
+
+    return idx;
+}
+
+/**********************************************************************************************************************/
+/** Push a node onto a LIFO node list.
+ *
+ *  @param[in]      pHead           list head
+ *  @param[in]      pEntry          node array
+ *  @param[in]      idx             node index
+ */
+static void vos_lfPush (
+    UINT64                  *pHead,
+    VOS_QUEUE_LF_ENTRY_T    *pEntry,
+    UINT32                  idx)
+{
+    UINT64 oldHead = __atomic_load_n(pHead, __ATOMIC_RELAXED);
+    UINT64 newHead;
+
+    do
+    {
+        __atomic_store_n(&pEntry[idx].seq, (UINT32) oldHead, __ATOMIC_RELAXED);
+        newHead = (((oldHead >> 32) + 1u) << 32) | idx;
+    }
+    while (!__atomic_compare_exchange_n(pHead, &oldHead, newHead, TRUE, __ATOMIC_RELEASE, __ATOMIC_RELAXED));
+}
+
+/**********************************************************************************************************************/
+/** Put a message into a lock-free queue without waiting.
+ *
+ *  @param[in]      pLf             lock-free queue
+ *  @param[in]      pData           data pointer
+ *  @param[in]      size            data size
+ *  @retval         TRUE            queued
+ *  @retval         FALSE           queue full
+ */
+static BOOL8 vos_lfPut (
+    struct VOS_QUEUE_LF *pLf,
+    UINT8               *pData,
+    UINT32              size)
+{
+    UINT32 idx;
+
+    if (pLf->lifo == FALSE)
+    {
+        return vos_lfFifoPut(pLf, pData, size);
+    }
+    idx = vos_lfPop(&pLf->freeList, pLf->pEntry);
+    if (idx == VOS_QUEUE_NIL)
+    {
+        return FALSE;
+    }
+    pLf->pEntry[idx].pData  = pData;
+    pLf->pEntry[idx].size   = size;
+    vos_lfPush(&pLf->stack, pLf->pEntry, idx);
+    return TRUE;
+}
+
+/**********************************************************************************************************************/
+/** Get a message from a lock-free queue without waiting.
+ *
+ *  @param[in]      pLf             lock-free queue
+ *  @param[out]     ppData          data pointer
+ *  @param[out]     pSize           data size
+ *  @retval         TRUE            message received
+ *  @retval         FALSE           queue empty
+ */
+static BOOL8 vos_lfGet (
+    struct VOS_QUEUE_LF *pLf,
+    UINT8               * *ppData,
+    UINT32              *pSize)
+{
+    UINT32 idx;
+
+    if (pLf->lifo == FALSE)
+    {
+        return vos_lfFifoGet(pLf, ppData, pSize);
+    }
+    idx = vos_lfPop(&pLf->stack, pLf->pEntry);
+    if (idx == VOS_QUEUE_NIL)
+    {
+        return FALSE;
+    }
+    *ppData = pLf->pEntry[idx].pData;
+    *pSize  = pLf->pEntry[idx].size;
+    vos_lfPush(&pLf->freeList, pLf->pEntry, idx);
+    return TRUE;
+}
+
+/**********************************************************************************************************************/
+/** Sleep until the sequence counter differs from seq, the deadline passed or a spurious wakeup.
+ *  The caller has read seq before it found the queue empty (full), a concurrent change of the queue is therefore
+ *  never missed: either the waker sees the waiter count or the kernel sees the changed counter.
+ *
+ *  @param[in]      pSeq            sequence counter of the other side
+ *  @param[in]      pNumWait        waiter count of this side
+ *  @param[in]      seq             sequence counter value read before the last try
+ *  @param[in]      pDeadline       absolute time (vos_getTime) or NULL to wait forever
+ */
+static void vos_lfWait (
+    UINT32              *pSeq,
+    UINT32              *pNumWait,
+    UINT32              seq,
+    const VOS_TIMEVAL_T *pDeadline)
+{
+#ifdef VOS_QUEUE_FUTEX
+    struct timespec deadline;
+
+    if (pDeadline != NULL)
+    {
+        deadline.tv_sec     = pDeadline->tv_sec;
+        deadline.tv_nsec    = (long) pDeadline->tv_usec * 1000;
+    }
+    (void) __atomic_add_fetch(pNumWait, 1u, __ATOMIC_SEQ_CST);
+    /* FUTEX_WAIT_BITSET takes an absolute CLOCK_MONOTONIC time, as used by vos_getTime() */
+    (void) syscall(SYS_futex, pSeq, FUTEX_WAIT_BITSET | FUTEX_PRIVATE_FLAG, seq,
+                   (pDeadline != NULL) ? &deadline : NULL, NULL, FUTEX_BITSET_MATCH_ANY);
+    (void) __atomic_sub_fetch(pNumWait, 1u, __ATOMIC_SEQ_CST);
+#else
+    (void) pSeq;
+    (void) pNumWait;
+    (void) seq;
+    (void) pDeadline;
+    (void) vos_threadDelay(VOS_QUEUE_POLL_TIME);
+#endif
+}
+
+/**********************************************************************************************************************/
+/** Announce a change of the queue and wake up a waiter of the other side, if there is one.
+ *
+ *  @param[in]      pSeq            sequence counter of this side
+ *  @param[in]      pNumWait        waiter count of the other side
+ */
+static void vos_lfWake (
+    UINT32  *pSeq,
+    UINT32  *pNumWait)
+{
+    (void) __atomic_add_fetch(pSeq, 1u, __ATOMIC_SEQ_CST);
+#ifdef VOS_QUEUE_FUTEX
+    if (__atomic_load_n(pNumWait, __ATOMIC_SEQ_CST) != 0u)
+    {
+        (void) syscall(SYS_futex, pSeq, FUTEX_WAKE | FUTEX_PRIVATE_FLAG, 1, NULL, NULL, 0);
+    }
+#else
+    (void) pNumWait;
+#endif
+}
+
+/**********************************************************************************************************************/
+/** Send a message to a lock-free queue, wait while it is full if VOS_QUEUE_FLAG_BLOCK was given.
+ *
+ *  @param[in]      pLf             lock-free queue
+ *  @param[in]      pData           data pointer
+ *  @param[in]      size            data size
+ *  @retval         VOS_NO_ERR          no error
+ *  @retval         VOS_QUEUE_FULL_ERR  queue is full
+ */
+static VOS_ERR_T vos_queueSendLockFree (
+    struct VOS_QUEUE_LF *pLf,
+    UINT8               *pData,
+    UINT32              size)
+{
+    UINT32 seq;
+
+    while (vos_lfPut(pLf, pData, size) == FALSE)
+    {
+        if ((pLf->flags & VOS_QUEUE_FLAG_BLOCK) == 0u)
+        {
+            vos_printLogStr(VOS_LOG_ERROR, "vos_queueSend() ERROR Queue is full\n");
+            return VOS_QUEUE_FULL_ERR;
+        }
+        seq = __atomic_load_n(&pLf->getSeq, __ATOMIC_SEQ_CST);
+        if (vos_lfPut(pLf, pData, size) == TRUE)
+        {
+            break;
+        }
+        vos_lfWait(&pLf->getSeq, &pLf->numWaitTx, seq, NULL);
+    }
+    vos_lfWake(&pLf->putSeq, &pLf->numWaitRx);
+    return VOS_NO_ERR;
+}
+
+/**********************************************************************************************************************/
+/** Get a message from a lock-free queue, wait for it up to usTimeout.
+ *
+ *  @param[in]      pLf             lock-free queue
+ *  @param[out]     ppData          data pointer
+ *  @param[out]     pSize           data size
+ *  @param[in]      usTimeout       0: do not wait, VOS_SEMA_WAIT_FOREVER: no timeout
+ *  @retval         VOS_NO_ERR      no error
+ *  @retval         VOS_QUEUE_ERR   queue is empty
+ */
+static VOS_ERR_T vos_queueReceiveLockFree (
+    struct VOS_QUEUE_LF *pLf,
+    UINT8               * *ppData,
+    UINT32              *pSize,
+    UINT32              usTimeout)
+{
+    VOS_TIMEVAL_T   deadline    = {0, 0};
+    VOS_TIMEVAL_T   now;
+    UINT32          seq;
+
+    if ((usTimeout != 0u) && (usTimeout != VOS_SEMA_WAIT_FOREVER))
+    {
+        VOS_TIMEVAL_T timeout;
+
+        timeout.tv_sec  = usTimeout / 1000000u;
+        timeout.tv_usec = usTimeout % 1000000u;
+        vos_getTime(&deadline);
+        vos_addTime(&deadline, &timeout);
+    }
+
+    while (vos_lfGet(pLf, ppData, pSize) == FALSE)
+    {
+        if (usTimeout == 0u)
+        {
+            *ppData = NULL;
+            *pSize  = 0u;
+            return VOS_QUEUE_ERR;
+        }
+        if (usTimeout != VOS_SEMA_WAIT_FOREVER)
+        {
+            vos_getTime(&now);
+            if (vos_cmpTime(&now, &deadline) >= 0)
+            {
+                *ppData = NULL;
+                *pSize  = 0u;
+                return VOS_QUEUE_ERR;
+            }
+        }
+        seq = __atomic_load_n(&pLf->putSeq, __ATOMIC_SEQ_CST);
+        if (vos_lfGet(pLf, ppData, pSize) == TRUE)
+        {
+            break;
+        }
+        vos_lfWait(&pLf->putSeq, &pLf->numWaitRx, seq,
+                   (usTimeout != VOS_SEMA_WAIT_FOREVER) ? &deadline : NULL);
+    }
+    vos_lfWake(&pLf->getSeq, &pLf->numWaitTx);
+    return VOS_NO_ERR;
+}
+#endif
+
+/**********************************************************************************************************************/
+/** Initialize a lock-free message queue.
+ *  Returns a handle for further calls
+ *
+ *  @param[in]      queueType       Define queue type (FIFO or LIFO)
+ *  @param[in]      maxNoOfMsg      Maximum number of messages
+ *  @param[in]      flags           VOS_QUEUE_FLAG_SPSC, VOS_QUEUE_FLAG_BLOCK
+ *  @param[out]     pQueueHandle    Handle of created queue
+ *
+ *  @retval         VOS_NO_ERR      no error
+ *  @retval         VOS_PARAM_ERR   parameter out of range/invalid
+ *  @retval         VOS_MEM_ERR     out of memory
+ */
+
+EXT_DECL VOS_ERR_T vos_queueCreateLockFree (
+    VOS_QUEUE_POLICY_T  queueType,
+    UINT32              maxNoOfMsg,
+    UINT32              flags,
+    VOS_QUEUE_T         *pQueueHandle )
+{
+#ifdef VOS_QUEUE_LOCKFREE_SUPPORT
+    struct VOS_QUEUE_LF *pLf;
+    UINT32              noOfEntries;
+    UINT32              i;
+
+    /* Check parameters */
+    if ((queueType < VOS_QUEUE_POLICY_OTHER)
+        || (queueType > VOS_QUEUE_POLICY_LIFO)
+        || (pQueueHandle == NULL)
+        || (maxNoOfMsg == 0u)
+        || (maxNoOfMsg > 0x80000000u)
+        || ((queueType == VOS_QUEUE_POLICY_LIFO) && ((flags & VOS_QUEUE_FLAG_SPSC) != 0u)))
+    {
+        vos_printLogStr(VOS_LOG_ERROR, "vos_queueCreateLockFree() ERROR invalid parameter\n");
+        return VOS_PARAM_ERR;
+    }
+
+    /* The FIFO ring is indexed by masking the position */
+    noOfEntries = maxNoOfMsg;
+    if (queueType != VOS_QUEUE_POLICY_LIFO)
+    {
+        noOfEntries = 1u;
+        while (noOfEntries < maxNoOfMsg)
+        {
+            noOfEntries <<= 1;
+        }
+    }
+
+    *pQueueHandle   = (VOS_QUEUE_T) vos_memAlloc(sizeof(struct VOS_QUEUE));
+    pLf             = NULL;
+    if (*pQueueHandle != NULL)
+    {
+        pLf = (struct VOS_QUEUE_LF *) vos_memAlloc(sizeof(struct VOS_QUEUE_LF));
+        if (pLf != NULL)
+        {
+            memset(pLf, 0, sizeof(struct VOS_QUEUE_LF));
+            pLf->pEntry = (VOS_QUEUE_LF_ENTRY_T *) vos_memAlloc(noOfEntries * sizeof(VOS_QUEUE_LF_ENTRY_T));
+            if (pLf->pEntry == NULL)
+            {
+                vos_memFree(pLf);
+                pLf = NULL;
+            }
+        }
+        if (pLf == NULL)
+        {
+            vos_memFree(*pQueueHandle);
+            *pQueueHandle = NULL;
+        }
+    }
+    if (pLf == NULL)
+    {
+        vos_printLogStr(VOS_LOG_ERROR, "vos_queueCreateLockFree() ERROR could not allocate memory\n");
+        return VOS_MEM_ERR;
+    }
+
+    pLf->flags  = flags;
+    pLf->lifo   = (queueType == VOS_QUEUE_POLICY_LIFO) ? TRUE : FALSE;
+    pLf->mask   = noOfEntries - 1u;
+    for (i = 0u; i < noOfEntries; i++)
+    {
+        pLf->pEntry[i].pData    = NULL;
+        pLf->pEntry[i].size     = 0u;
+        /* FIFO: ready for writing in the first round, LIFO: all nodes chained into the free list */
+        pLf->pEntry[i].seq      = (pLf->lifo == FALSE) ? i : ((i + 1u < noOfEntries) ? (i + 1u) : VOS_QUEUE_NIL);
+    }
+    pLf->stack      = VOS_QUEUE_NIL;
+    pLf->freeList   = 0u;
+
+    (*pQueueHandle)->firstElem      = 0u;
+    (*pQueueHandle)->lastElem       = 0u;
+    (*pQueueHandle)->queueType      = queueType;
+    (*pQueueHandle)->maxNoOfMsg     = maxNoOfMsg;
+    (*pQueueHandle)->semaphore      = NULL;
+    (*pQueueHandle)->mutex          = NULL;
+    (*pQueueHandle)->pQueue         = NULL;
+    (*pQueueHandle)->pLockFree      = pLf;
+    (*pQueueHandle)->magicNumber    = cQueueMagic;
+    __atomic_thread_fence(__ATOMIC_RELEASE);
+    return VOS_NO_ERR;
+#else
+    (void) flags;
+    return vos_queueCreate(queueType, maxNoOfMsg, pQueueHandle);
+#endif
+}
+
 /**********************************************************************************************************************/
 /** Initialize a message queue.
  *  Returns a handle for further calls
@@ -844,6 +1434,7 @@ EXT_DECL VOS_ERR_T vos_queueCreate (
                         (*pQueueHandle)->queueType      = queueType;
                         (*pQueueHandle)->maxNoOfMsg     = maxNoOfMsg;
                         (*pQueueHandle)->magicNumber    = cQueueMagic;
+                        (*pQueueHandle)->pLockFree      = NULL;
                         /* alloc queue memory */
                         (*pQueueHandle)->pQueue =
                             (struct VOS_QUEUE_ELEM *)vos_memAlloc(maxNoOfMsg * sizeof(struct VOS_QUEUE_ELEM));
@@ -907,6 +1498,12 @@ EXT_DECL VOS_ERR_T vos_queueSend (
         vos_printLogStr(VOS_LOG_ERROR, "vos_queueSend() ERROR invalid parameter\n");
         retVal = VOS_PARAM_ERR;
     }
+#ifdef VOS_QUEUE_LOCKFREE_SUPPORT
+    else if (queueHandle->pLockFree != NULL)
+    {
+        retVal = vos_queueSendLockFree(queueHandle->pLockFree, pData, size);
+    }
+#endif
     else
     {
         err = vos_mutexLock(queueHandle->mutex);
@@ -1018,6 +1615,12 @@ EXT_DECL VOS_ERR_T vos_queueReceive (
         vos_printLogStr(VOS_LOG_ERROR, "vos_queueReceive() ERROR invalid parameter\n");
         retVal = VOS_PARAM_ERR;
     }
+#ifdef VOS_QUEUE_LOCKFREE_SUPPORT
+    else if (queueHandle->pLockFree != NULL)
+    {
+        retVal = vos_queueReceiveLockFree(queueHandle->pLockFree, ppData, pSize, usTimeout);
+    }
+#endif
     else
     {
         /* wait for semaphore indicating new message in queue */
@@ -1102,6 +1705,17 @@ EXT_DECL VOS_ERR_T vos_queueDestroy (
         vos_printLogStr(VOS_LOG_ERROR, "vos_queueDestroy() ERROR invalid parameter\n");
         retVal = VOS_PARAM_ERR;
     }
+#ifdef VOS_QUEUE_LOCKFREE_SUPPORT
+    else if (queueHandle->pLockFree != NULL)
+    {
+        /* Senders and receivers must have stopped using the queue */
+        queueHandle->magicNumber = 0u;
+        vos_memFree(queueHandle->pLockFree->pEntry);
+        vos_memFree(queueHandle->pLockFree);
+        vos_memFree(queueHandle);
+        retVal = VOS_NO_ERR;
+    }
+#endif
     else
     {
         err = vos_mutexLock(queueHandle->mutex);
@@ -18,6 +18,8 @@
 /*
 * $Id$
 *
+*      AG 2026-10-19: Log ring released only after the last producer left vos_logRingPut()
+*      AG 2026-10-19: Log level, lock-free binary log ring
 *      BL 2017-05-08: Compiler warnings
 *      BL 2017-02-27: #142 Compiler warnings / MISRA-C 2012 issues
 *      BL 2016-08-17: parentheses added (compiler warning)
@@ -33,6 +35,8 @@
  */
 
 #include <string.h>
+#include <stdarg.h>
+#include <time.h>
 
 #include "vos_utils.h"
 #include "vos_sock.h"
@@ -51,12 +55,52 @@
 
 #define NO_OF_ERROR_STRINGS  52u
 
+/* The log ring needs atomic operations */
+#if defined(__GNUC__) || defined(__clang__)
+#define VOS_LOG_RING_SUPPORT    1
+#endif
+
+#define VOS_LOG_RING_SPEC_SIZE  24u         /**< Max. size of a single conversion specification            */
+
+/***********************************************************************************************************************
+ * TYPEDEFS
+ */
+
+/** Argument types of printf conversions */
+typedef enum
+{
+    VOS_LOG_ARG_NONE,                       /**< '%%' or unknown conversion                                */
+    VOS_LOG_ARG_INT,
+    VOS_LOG_ARG_LONG,
+    VOS_LOG_ARG_LLONG,
+    VOS_LOG_ARG_SIZE,
+    VOS_LOG_ARG_DOUBLE,
+    VOS_LOG_ARG_LDOUBLE,
+    VOS_LOG_ARG_PTR,
+    VOS_LOG_ARG_STR
+} VOS_LOG_ARG_T;
+
+/** Entry of the binary log ring */
+typedef struct
+{
+    UINT32          seq;                    /**< ring sequence, tells producer and consumer the slot state  */
+    VOS_LOG_T       level;
+    UINT16          line;
+    UINT16          argSize;                /**< used bytes in args                                         */
+    const CHAR8     *pFile;
+    const CHAR8     *pFormat;
+    VOS_TIMEVAL_T   time;                   /**< real time of the log call                                  */
+    UINT8           args[VOS_LOG_RING_ARG_SIZE];    /**< raw arguments in format order                     */
+} VOS_LOG_RING_ENTRY_T;
+
 /***********************************************************************************************************************
  * GLOBALS
  */
 
 VOS_PRINT_DBG_T gPDebugFunction = NULL;
 void *gRefCon = NULL;
+VOS_LOG_T gVosLogLevel = VOS_LOG_DBG;
+BOOL8 gVosLogRingActive = FALSE;
 
 /***********************************************************************************************************************
  *  LOCALS
@@ -64,6 +108,13 @@ void *gRefCon = NULL;
 
 static const VOS_VERSION_T vosVersion = {VOS_VERSION, VOS_RELEASE, VOS_UPDATE, VOS_EVOLUTION};
 
+static VOS_LOG_RING_ENTRY_T *sLogRing       = NULL;
+static UINT32               sLogRingMask    = 0u;
+static UINT32               sLogRingHead    = 0u;   /* next slot to write   */
+static UINT32               sLogRingTail    = 0u;   /* next slot to read    */
+static UINT32               sLogRingDropped = 0u;
+static UINT32               sLogRingUsers   = 0u;   /* producers inside vos_logRingPut() */
+
 /** Table of CRC-32s of all single-byte values according to IEEE802.3 / IEC 61375-2-3 A.3
  *  The FCS-32 generator polynomial:
  *  x**0 + x**1 + x**2 + x**4 + x**5 + x**7 + x**8 + x**10 + x**11 + x**12 + x**16
@@ -495,11 +546,551 @@ VOS_ERR_T vos_init (
  */
 EXT_DECL void vos_terminate (void)
 {
+    vos_logRingTerm();
     vos_sockTerm();
     vos_threadTerm();
     vos_memDelete(NULL);
 }
 
+/**********************************************************************************************************************/
+/** Set the log level.
+ *
+ *  @param[in]        level             highest category to output (VOS_LOG_ERROR...VOS_LOG_DBG)
+ */
+
+EXT_DECL void vos_setLogLevel (
+    VOS_LOG_T level)
+{
+    gVosLogLevel = level;
+}
+
+#ifdef VOS_LOG_RING_SUPPORT
+
+/**********************************************************************************************************************/
+/** Parse the next conversion specification of a format string.
+ *
+ *  @param[in]          pFormat     pointer to the '%'
+ *  @param[out]         pStars      number of '*' (int arguments for width/precision)
+ *  @param[out]         pType       argument type of the conversion
+ *  @retval             length of the specification
+ */
+
+static UINT32 vos_logParseSpec (
+    const CHAR8     *pFormat,
+    UINT32          *pStars,
+    VOS_LOG_ARG_T   *pType)
+{
+    UINT32  i       = 1u;
+    UINT32  longs   = 0u;
+    BOOL8   sizeMod = FALSE;
+    BOOL8   longDbl = FALSE;
+
+    *pStars = 0u;
+    *pType  = VOS_LOG_ARG_NONE;
+
+    /* flags, width and precision */
+    while ((pFormat[i] != 0) && (strchr("-+ #0123456789.*", pFormat[i]) != NULL))
+    {
+        if (pFormat[i] == '*')
+        {
+            (*pStars)++;
+        }
+        i++;
+    }
+    /* length modifiers */
+    while ((pFormat[i] != 0) && (strchr("hlLqjzt", pFormat[i]) != NULL))
+    {
+        if ((pFormat[i] == 'l') || (pFormat[i] == 'q'))
+        {
+            longs++;
+        }
+        else if (pFormat[i] == 'L')
+        {
+            longDbl = TRUE;
+        }
+        else if (pFormat[i] != 'h')
+        {
+            sizeMod = TRUE;
+        }
+        i++;
+    }
+    if (pFormat[i] == 0)
+    {
+        return i;
+    }
+    switch (pFormat[i])
+    {
+        case 'd': case 'i': case 'u': case 'o': case 'x': case 'X': case 'c':
+            *pType = (sizeMod == TRUE) ? VOS_LOG_ARG_SIZE :
+                (longs > 1u) ? VOS_LOG_ARG_LLONG : (longs == 1u) ? VOS_LOG_ARG_LONG : VOS_LOG_ARG_INT;
+            break;
+        case 'f': case 'F': case 'e': case 'E': case 'g': case 'G': case 'a': case 'A':
+            *pType = (longDbl == TRUE) ? VOS_LOG_ARG_LDOUBLE : VOS_LOG_ARG_DOUBLE;
+            break;
+        case 's':
+            *pType = VOS_LOG_ARG_STR;
+            break;
+        case 'p':
+        case 'n':
+            *pType = VOS_LOG_ARG_PTR;
+            break;
+        default:
+            break;
+    }
+    return i + 1u;
+}
+
+/**********************************************************************************************************************/
+/** Store a log entry in the binary log ring (used by the log macros).
+ *  Producers reserve a slot by advancing the head index, the slot sequence tells whether it is free (bounded
+ *  multi-producer queue, no locks).
+ *
+ *  @param[in]        level             log category
+ *  @param[in]        pFile             source file
+ *  @param[in]        line              source line
+ *  @param[in]        pFormat           printf format string, must be static
+ *  @param[in]        ...               arguments
+ */
+
+EXT_DECL void vos_logRingPut (
+    VOS_LOG_T   level,
+    const CHAR8 *pFile,
+    UINT16      line,
+    const CHAR8 *pFormat,
+    ...)
+{
+    VOS_LOG_RING_ENTRY_T    *pEntry;
+    VOS_LOG_RING_ENTRY_T    *pRing;
+    UINT32                  pos;
+    UINT32                  used = 0u;
+    va_list                 args;
+
+    /* count the producer before fetching the ring pointer, vos_logRingTerm() waits until it left */
+    (void) __atomic_add_fetch(&sLogRingUsers, 1u, __ATOMIC_SEQ_CST);
+    pRing = __atomic_load_n(&sLogRing, __ATOMIC_SEQ_CST);
+    if (pRing == NULL)
+    {
+        (void) __atomic_sub_fetch(&sLogRingUsers, 1u, __ATOMIC_RELEASE);
+        return;
+    }
+
+    /* reserve a slot */
+    pos = __atomic_load_n(&sLogRingHead, __ATOMIC_RELAXED);
+    for (;; )
+    {
+        INT32 diff;
+
+        pEntry  = &pRing[pos & sLogRingMask];
+        diff    = (INT32) (__atomic_load_n(&pEntry->seq, __ATOMIC_ACQUIRE) - pos);
+        if (diff == 0)
+        {
+            if (__atomic_compare_exchange_n(&sLogRingHead, &pos, pos + 1u, TRUE,
+                                            __ATOMIC_RELAXED, __ATOMIC_RELAXED))
+            {
+                break;
+            }
+        }
+        else if (diff < 0)
+        {
+            /* ring is full */
+            (void) __atomic_add_fetch(&sLogRingDropped, 1u, __ATOMIC_RELAXED);
+            (void) __atomic_sub_fetch(&sLogRingUsers, 1u, __ATOMIC_RELEASE);
+            return;
+        }
+        else
+        {
+            pos = __atomic_load_n(&sLogRingHead, __ATOMIC_RELAXED);
+        }
+    }
+
+    vos_getRealTime(&pEntry->time);
+    pEntry->level   = level;
+    pEntry->pFile   = pFile;
+    pEntry->line    = line;
+    pEntry->pFormat = pFormat;
+
+    /* copy the raw arguments in format order, no formatting */
+    va_start(args, pFormat);
+    while ((*pFormat != 0) && (used < VOS_LOG_RING_ARG_SIZE))
+    {
+        UINT32          stars;
+        VOS_LOG_ARG_T   type;
+        UINT64          value = 0u;
+        double          dbl;
+
+        if (*pFormat != '%')
+        {
+            pFormat++;
+            continue;
+        }
+        pFormat += vos_logParseSpec(pFormat, &stars, &type);
+
+        /* width and precision given as arguments */
+        while ((stars > 0u) && (used + sizeof(UINT64) <= VOS_LOG_RING_ARG_SIZE))
+        {
+            value = (UINT64) (INT64) va_arg(args, int);
+            memcpy(&pEntry->args[used], &value, sizeof(UINT64));
+            used += sizeof(UINT64);
+            stars--;
+        }
+        if (stars > 0u)
+        {
+            used = VOS_LOG_RING_ARG_SIZE;
+            break;
+        }
+        switch (type)
+        {
+            case VOS_LOG_ARG_NONE:
+                continue;
+            case VOS_LOG_ARG_STR:
+            {
+                const CHAR8 *pStr   = va_arg(args, const CHAR8 *);
+                UINT32      len;
+
+                if (pStr == NULL)
+                {
+                    pStr = "(null)";
+                }
+                len = (UINT32) strlen(pStr);
+                if (len >= VOS_LOG_RING_ARG_SIZE - used)
+                {
+                    len = VOS_LOG_RING_ARG_SIZE - used - 1u;
+                }
+                memcpy(&pEntry->args[used], pStr, len);
+                pEntry->args[used + len] = 0u;
+                used += len + 1u;
+                continue;
+            }
+            case VOS_LOG_ARG_INT:
+                value = (UINT64) (INT64) va_arg(args, int);
+                break;
+            case VOS_LOG_ARG_LONG:
+                value = (UINT64) (INT64) va_arg(args, long);
+                break;
+            case VOS_LOG_ARG_LLONG:
+                value = (UINT64) va_arg(args, long long);
+                break;
+            case VOS_LOG_ARG_SIZE:
+                value = (UINT64) va_arg(args, size_t);
+                break;
+            case VOS_LOG_ARG_PTR:
+                value = (UINT64) (uintptr_t) va_arg(args, void *);
+                break;
+            case VOS_LOG_ARG_DOUBLE:
+                dbl = va_arg(args, double);
+                memcpy(&value, &dbl, sizeof(UINT64));
+                break;
+            case VOS_LOG_ARG_LDOUBLE:
+                dbl = (double) va_arg(args, long double);
+                memcpy(&value, &dbl, sizeof(UINT64));
+                break;
+        }
+        if (used + sizeof(UINT64) > VOS_LOG_RING_ARG_SIZE)
+        {
+            used = VOS_LOG_RING_ARG_SIZE;
+            break;
+        }
+        memcpy(&pEntry->args[used], &value, sizeof(UINT64));
+        used += sizeof(UINT64);
+    }
+    va_end(args);
+    pEntry->argSize = (UINT16) used;
+
+    /* hand the slot over to the consumer */
+    __atomic_store_n(&pEntry->seq, pos + 1u, __ATOMIC_RELEASE);
+    (void) __atomic_sub_fetch(&sLogRingUsers, 1u, __ATOMIC_RELEASE);
+}
+
+/**********************************************************************************************************************/
+/** Format a log ring entry.
+ *  Each conversion is formatted on its own with the stored argument. If the arguments did not fit into the entry,
+ *  the rest of the format string is output unformatted.
+ *
+ *  @param[in]        pEntry            log ring entry
+ *  @param[out]       pStr              output string
+ *  @param[in]        size              size of the output string
+ */
+
+static void vos_logRingFormat (
+    const VOS_LOG_RING_ENTRY_T  *pEntry,
+    CHAR8                       *pStr,
+    UINT32                      size)
+{
+    const CHAR8 *pFormat    = pEntry->pFormat;
+    UINT32      used        = 0u;
+    UINT32      out         = 0u;
+
+    pStr[0] = 0;
+    while ((*pFormat != 0) && (out < size - 1u))
+    {
+        CHAR8           spec[VOS_LOG_RING_SPEC_SIZE];
+        UINT32          specLen;
+        UINT32          stars;
+        VOS_LOG_ARG_T   type;
+        int             star[2] = {0, 0};
+        UINT64          value   = 0u;
+        double          dbl;
+        int             res     = 0;
+        UINT32          i;
+
+        if (*pFormat != '%')
+        {
+            pStr[out++] = *pFormat++;
+            continue;
+        }
+        specLen = vos_logParseSpec(pFormat, &stars, &type);
+        if (type == VOS_LOG_ARG_NONE)
+        {
+            if (pFormat[specLen - 1u] == '%')
+            {
+                pStr[out++] = '%';
+            }
+            pFormat += specLen;
+            continue;
+        }
+        if ((stars > 2u) || (specLen >= VOS_LOG_RING_SPEC_SIZE) ||
+            (used + stars * sizeof(UINT64) + ((type == VOS_LOG_ARG_STR) ? 1u : sizeof(UINT64)) > pEntry->argSize))
+        {
+            break;      /* arguments not stored */
+        }
+        memcpy(spec, pFormat, specLen);
+        spec[specLen] = 0;
+        pFormat += specLen;
+        for (i = 0u; i < stars; i++)
+        {
+            memcpy(&value, &pEntry->args[used], sizeof(UINT64));
+            star[i] = (int) (INT64) value;
+            used    += sizeof(UINT64);
+        }
+        if (type == VOS_LOG_ARG_STR)
+        {
+            const CHAR8 *pArg = (const CHAR8 *) &pEntry->args[used];
+
+            used += (UINT32) strlen(pArg) + 1u;
+            res = (stars == 0u) ? snprintf(&pStr[out], size - out, spec, pArg) :
+                  (stars == 1u) ? snprintf(&pStr[out], size - out, spec, star[0], pArg) :
+                  snprintf(&pStr[out], size - out, spec, star[0], star[1], pArg);
+        }
+        else
+        {
+            memcpy(&value, &pEntry->args[used], sizeof(UINT64));
+            used += sizeof(UINT64);
+            memcpy(&dbl, &value, sizeof(double));
+
+#define VOS_LOG_RING_PRINT(arg)                                                                   \
+    ((stars == 0u) ? snprintf(&pStr[out], size - out, spec, arg) :                                \
+     (stars == 1u) ? snprintf(&pStr[out], size - out, spec, star[0], arg) :                       \
+     snprintf(&pStr[out], size - out, spec, star[0], star[1], arg))
+
+            switch (type)
+            {
+                case VOS_LOG_ARG_INT:
+                    res = VOS_LOG_RING_PRINT((int) (INT64) value);
+                    break;
+                case VOS_LOG_ARG_LONG:
+                    res = VOS_LOG_RING_PRINT((long) (INT64) value);
+                    break;
+                case VOS_LOG_ARG_LLONG:
+                    res = VOS_LOG_RING_PRINT((long long) value);
+                    break;
+                case VOS_LOG_ARG_SIZE:
+                    res = VOS_LOG_RING_PRINT((size_t) value);
+                    break;
+                case VOS_LOG_ARG_PTR:
+                    /* %n is not executed later on */
+                    res = (spec[specLen - 1u] == 'n') ? 0 : VOS_LOG_RING_PRINT((void *) (uintptr_t) value);
+                    break;
+                case VOS_LOG_ARG_DOUBLE:
+                    res = VOS_LOG_RING_PRINT(dbl);
+                    break;
+                case VOS_LOG_ARG_LDOUBLE:
+                    res = VOS_LOG_RING_PRINT((long double) dbl);
+                    break;
+                default:
+                    break;
+            }
+#undef VOS_LOG_RING_PRINT
+        }
+        if (res > 0)
+        {
+            out += ((UINT32) res < size - out) ? (UINT32) res : size - out - 1u;
+        }
+    }
+    /* arguments missing, output the remaining format verbatim */
+    while ((*pFormat != 0) && (out < size - 1u))
+    {
+        pStr[out++] = *pFormat++;
+    }
+    pStr[out] = 0;
+}
+
+/**********************************************************************************************************************/
+/** Activate the binary log ring.
+ *
+ *  @param[in]        noOfEntries       number of entries, rounded up to a power of two
+ *  @retval           VOS_NO_ERR        no error
+ *  @retval           VOS_PARAM_ERR     no entries
+ *  @retval           VOS_MEM_ERR       out of memory
+ *  @retval           VOS_INIT_ERR      already active
+ */
+
+EXT_DECL VOS_ERR_T vos_logRingInit (
+    UINT32 noOfEntries)
+{
+    VOS_LOG_RING_ENTRY_T    *pRing;
+    UINT32                  size = 1u;
+    UINT32                  i;
+
+    if ((noOfEntries == 0u) || (noOfEntries > 0x10000000u))
+    {
+        return VOS_PARAM_ERR;
+    }
+    if (sLogRing != NULL)
+    {
+        return VOS_INIT_ERR;
+    }
+    while (size < noOfEntries)
+    {
+        size <<= 1u;
+    }
+    pRing = (VOS_LOG_RING_ENTRY_T *) vos_memAlloc(size * (UINT32) sizeof(VOS_LOG_RING_ENTRY_T));
+    if (pRing == NULL)
+    {
+        return VOS_MEM_ERR;
+    }
+    for (i = 0u; i < size; i++)
+    {
+        pRing[i].seq = i;
+    }
+    sLogRingMask    = size - 1u;
+    sLogRingHead    = 0u;
+    sLogRingTail    = 0u;
+    sLogRingDropped = 0u;
+    __atomic_store_n(&sLogRing, pRing, __ATOMIC_RELEASE);
+    gVosLogRingActive = TRUE;
+    return VOS_NO_ERR;
+}
+
+/**********************************************************************************************************************/
+/** Deactivate the binary log ring.
+ *  Remaining entries are output, the ring memory is released as soon as no producer is inside vos_logRingPut().
+ */
+
+EXT_DECL void vos_logRingTerm (void)
+{
+    VOS_LOG_RING_ENTRY_T *pRing = sLogRing;
+
+    if (pRing == NULL)
+    {
+        return;
+    }
+    gVosLogRingActive = FALSE;
+    (void) vos_logRingDrain(0u);
+    __atomic_store_n(&sLogRing, NULL, __ATOMIC_SEQ_CST);
+    /* producers, which fetched the ring pointer before, must have left before it is freed */
+    while (__atomic_load_n(&sLogRingUsers, __ATOMIC_ACQUIRE) != 0u)
+    {
+        (void) vos_threadDelay(0u);
+    }
+    vos_memFree(pRing);
+}
+
+/**********************************************************************************************************************/
+/** Format entries of the log ring and pass them to the debug output function.
+ *
+ *  @param[in]        maxEntries        maximum number of entries to output, 0 for all
+ *  @retval           number of entries output
+ */
+
+EXT_DECL UINT32 vos_logRingDrain (
+    UINT32 maxEntries)
+{
+    VOS_LOG_RING_ENTRY_T    *pRing = sLogRing;
+    UINT32                  count = 0u;
+    UINT32                  dropped;
+    CHAR8                   str[VOS_MAX_PRNT_STR_SIZE];
+    CHAR8                   timeStr[64];
+
+    if (pRing == NULL)
+    {
+        return 0u;
+    }
+    while ((maxEntries == 0u) || (count < maxEntries))
+    {
+        VOS_LOG_RING_ENTRY_T    *pEntry = &pRing[sLogRingTail & sLogRingMask];
+        time_t                  sec;
+        struct tm               *pTM;
+
+        if (__atomic_load_n(&pEntry->seq, __ATOMIC_ACQUIRE) != sLogRingTail + 1u)
+        {
+            break;      /* empty */
+        }
+        vos_logRingFormat(pEntry, str, sizeof(str));
+
+        sec = (time_t) pEntry->time.tv_sec;
+        pTM = localtime(&sec);
+        timeStr[0] = 0;
+        if (pTM != NULL)
+        {
+            (void) snprintf(timeStr, sizeof(timeStr), "%04d%02d%02d-%02d:%02d:%02d.%06ld ",
+                            pTM->tm_year + 1900, pTM->tm_mon + 1, pTM->tm_mday,
+                            pTM->tm_hour, pTM->tm_min, pTM->tm_sec, (long) pEntry->time.tv_usec);
+        }
+        if (gPDebugFunction != NULL)
+        {
+            gPDebugFunction(gRefCon, pEntry->level, timeStr, pEntry->pFile, pEntry->line, str);
+        }
+
+        /* release the slot for the producers */
+        __atomic_store_n(&pEntry->seq, sLogRingTail + sLogRingMask + 1u, __ATOMIC_RELEASE);
+        sLogRingTail++;
+        count++;
+    }
+
+    dropped = __atomic_exchange_n(&sLogRingDropped, 0u, __ATOMIC_RELAXED);
+    if ((dropped != 0u) && (gPDebugFunction != NULL))
+    {
+        (void) snprintf(str, sizeof(str), "log ring full, %u entries dropped\n", dropped);
+        gPDebugFunction(gRefCon, VOS_LOG_WARNING, vos_getTimeStamp(), __FILE__, (UINT16) __LINE__, str);
+    }
+    return count;
+}
+
+#else
+
+EXT_DECL void vos_logRingPut (
+    VOS_LOG_T   level,
+    const CHAR8 *pFile,
+    UINT16      line,
+    const CHAR8 *pFormat,
+    ...)
+{
+    (void) level;
+    (void) pFile;
+    (void) line;
+    (void) pFormat;
+}
+
+EXT_DECL VOS_ERR_T vos_logRingInit (
+    UINT32 noOfEntries)
+{
+    (void) noOfEntries;
+    return VOS_INIT_ERR;
+}
+
+EXT_DECL void vos_logRingTerm (void)
+{
+}
+
+EXT_DECL UINT32 vos_logRingDrain (
+    UINT32 maxEntries)
+{
+    (void) maxEntries;
+    return 0u;
+}
+
+#endif
+
 /**********************************************************************************************************************/
 /** Compute crc32 according to IEEE802.3. / to IEC 61375-2-3 A.3
  *  Note: Returned CRC is inverted
@@ -17,6 +17,8 @@
  /*
  * $Id$
  *
+ *      AG 2026-10-19: Cyclic thread statistics API stubs
+ *      AG 2026-10-19: Real-time profile API stubs
  *      BL 2018-06-25: Ticket #202: vos_mutexTrylock return value
  *      BL 2018-06-20: Ticket #184: Building with VS 2015: WIN64 and Windows threads (SOCKET instead of INT32)
  */
@@ -396,6 +398,90 @@ EXT_DECL VOS_ERR_T vos_threadIsActive (
     return VOS_NO_ERR;
 }
 
+/**********************************************************************************************************************/
+/** Set the real-time profile.
+ *  Not supported on this target.
+ *
+ *  @param[in]      pProfile        Pointer to the profile
+ *  @retval         VOS_UNKNOWN_ERR not supported
+ */
+
+EXT_DECL VOS_ERR_T vos_threadSetRtProfile (
+    const VOS_RT_PROFILE_T *pProfile)
+{
+    (void) pProfile;
+    return VOS_UNKNOWN_ERR;
+}
+
+/**********************************************************************************************************************/
+/** Pin a thread to a set of CPUs.
+ *  Not supported on this target.
+ *
+ *  @param[in]      thread          Thread handle (or NULL if current thread)
+ *  @param[in]      cpuSet          CPUs the thread may run on, bit n selects CPU n
+ *  @retval         VOS_UNKNOWN_ERR not supported
+ */
+
+EXT_DECL VOS_ERR_T vos_threadSetAffinity (
+    VOS_THREAD_T    thread,
+    VOS_CPU_SET_T   cpuSet)
+{
+    (void) thread;
+    (void) cpuSet;
+    return VOS_UNKNOWN_ERR;
+}
+
+/**********************************************************************************************************************/
+/** Route an interrupt to a set of CPUs.
+ *  Not supported on this target.
+ *
+ *  @param[in]      irq             Interrupt number
+ *  @param[in]      cpuSet          CPUs allowed to serve the interrupt, bit n selects CPU n
+ *  @retval         VOS_UNKNOWN_ERR not supported
+ */
+
+EXT_DECL VOS_ERR_T vos_irqSetAffinity (
+    UINT32          irq,
+    VOS_CPU_SET_T   cpuSet)
+{
+    (void) irq;
+    (void) cpuSet;
+    return VOS_UNKNOWN_ERR;
+}
+
+/**********************************************************************************************************************/
+/** Get the timing statistics of cyclic threads.
+ *  Not supported on this target.
+ *
+ *  @param[in]      thread          Thread handle of a cyclic thread (or NULL for the sum over all cyclic threads)
+ *  @param[out]     pStats          Pointer to the statistics
+ *  @retval         VOS_UNKNOWN_ERR not supported
+ */
+
+EXT_DECL VOS_ERR_T vos_threadGetStatistics (
+    VOS_THREAD_T        thread,
+    VOS_THREAD_STATS_T  *pStats)
+{
+    (void) thread;
+    (void) pStats;
+    return VOS_UNKNOWN_ERR;
+}
+
+/**********************************************************************************************************************/
+/** Reset the timing statistics of cyclic threads.
+ *  Not supported on this target.
+ *
+ *  @param[in]      thread          Thread handle of a cyclic thread (or NULL for all cyclic threads)
+ *  @retval         VOS_UNKNOWN_ERR not supported
+ */
+
+EXT_DECL VOS_ERR_T vos_threadResetStatistics (
+    VOS_THREAD_T thread)
+{
+    (void) thread;
+    return VOS_UNKNOWN_ERR;
+}
+
 /**********************************************************************************************************************/
 /** Return thread handle of calling task
  *
@@ -17,6 +17,7 @@
  /*
  * $Id$
  *
+ *      AG 2026-10-19: vos_sockStampToTime(), vos_uringCancelSocket()
  */
 
 #ifndef VOS_PRIVATE_H
@@ -96,6 +97,16 @@ void        vos_mutexLocalDelete (struct VOS_MUTEX *pMutex);
 
 EXT_DECL    VOS_ERR_T   vos_sockSetBuffer (SOCKET sock);
 
+#if defined(__linux) && defined(SO_TIMESTAMPING) && defined(SCM_TIMESTAMPING)
+void        vos_sockStampToTime (const struct timespec  *pStamp,
+                                 clockid_t              refClock,
+                                 VOS_TIMEVAL_T          *pTime);
+#endif
+
+#ifdef URING_SUPPORT
+void        vos_uringCancelSocket (SOCKET sock);
+#endif
+
 #ifdef __cplusplus
 }
 #endif
@@ -17,6 +17,14 @@
 /*
 * $Id$
 *
+*      AG 2026-10-19: vos_sockSendUDPAt(): key for the TX timestamp (SCM_TS_OPT_ID), on txTime sockets
+*      AG 2026-10-19: vos_sockSetBusyPoll(): SO_BUSY_POLL / SO_PREFER_BUSY_POLL (Linux)
+*      AG 2026-10-19: vos_sockClose() cancels pending io_uring receives (URING_SUPPORT)
+*      AG 2026-10-19: vos_sockSendUDPBatch(): sendmmsg() (Linux)
+*      AG 2026-10-19: vos_sockSendUDPV() / vos_sockSendTCPV(): scatter/gather send, MSG_ZEROCOPY (Linux)
+*      AG 2026-10-19: vos_sockSetPayloadFilter(): classic BPF socket filter (Linux)
+*      AG 2026-10-19: vos_sockReceiveUDPStamped(): kernel (SO_TIMESTAMPING) receive timestamps
+*      AG 2026-10-19: vos_sockSendUDPAt() / vos_sockReceiveTxStamp(): SO_TXTIME launch time and TX timestamps
 *      BL 2019-08-27: Changed send failure from ERROR to WARNING
 *      SB 2019-07-11: Added includes linux/if_vlan.h and linux/sockios.h
 *      BL 2019-06-17: Ticket #191 Add provisions for TSN / Hard Real Time (open source)
@@ -57,15 +65,17 @@
 #include <sys/socket.h>
 #include <sys/ioctl.h>
 
-#ifdef INTEGRITY
-#   include <sys/uio.h>
-#endif
+#include <sys/uio.h>
 
 #ifdef __linux
 #   include <linux/if.h>
 #   include <byteswap.h>
 #   include <linux/if_vlan.h>
 #   include <linux/sockios.h>
+#   include <linux/net_tstamp.h>
+#   include <linux/errqueue.h>
+#   include <linux/filter.h>
+#   include <time.h>
 #else
 #   include <net/if.h>
 #   include <net/if_types.h>
@@ -93,6 +103,50 @@ const CHAR8 *cDefaultIface = "en0";
 const CHAR8 *cDefaultIface = "eth0";
 #endif
 
+/* Launch time and TX timestamps need Linux 4.19 or later */
+#if defined(__linux) && defined(SO_EE_ORIGIN_TXTIME) && defined(SCM_TIMESTAMPING)
+#   define VOS_TXTIME_SUPPORT   1
+#endif
+
+/* Own keys for TX timestamps need Linux 6.13, checked at runtime by vos_sockSendUDPAt() */
+#ifdef VOS_TXTIME_SUPPORT
+#   define VOS_TXSTAMP_ID_SUPPORT   1
+#   ifndef SCM_TS_OPT_ID
+#       define SCM_TS_OPT_ID    81
+#   endif
+#endif
+
+/* Kernel receive timestamps */
+#if defined(__linux) && defined(SO_TIMESTAMPING) && defined(SCM_TIMESTAMPING)
+#   define VOS_RXSTAMP_SUPPORT  1
+#endif
+
+/* Socket filters (classic BPF) */
+#if defined(__linux) && defined(SO_ATTACH_FILTER)
+#   define VOS_SOCKFILTER_SUPPORT   1
+#endif
+
+/* Zero copy send needs Linux 4.14 (TCP) or 5.0 (UDP), checked at runtime by vos_sockEnableZeroCopy() */
+#if defined(__linux) && defined(SO_ZEROCOPY) && defined(MSG_ZEROCOPY) && defined(SO_EE_ORIGIN_ZEROCOPY)
+#   define VOS_ZEROCOPY_SUPPORT 1
+#endif
+
+/* Busy polling of the device queue on receive, SO_PREFER_BUSY_POLL needs Linux 5.11 */
+#if defined(__linux) && defined(SO_BUSY_POLL)
+#   define VOS_BUSYPOLL_SUPPORT 1
+#   ifndef SO_PREFER_BUSY_POLL
+#       define SO_PREFER_BUSY_POLL  69
+#   endif
+#endif
+
+/* Batch send (sendmmsg) needs the GNU extensions */
+#if defined(__linux) && defined(_GNU_SOURCE)
+#   define VOS_SENDMMSG_SUPPORT 1
+#endif
+
+/* Launch times closer than this (in us) are not handed to the kernel, the packet is sent immediately */
+#define VOS_TXTIME_MIN_LEAD     50
+
 /***********************************************************************************************************************
  *  LOCALS
  */
@@ -105,6 +159,15 @@ struct ifreq    gIfr;
  * LOCAL FUNCTIONS
  */
 
+static VOS_ERR_T vos_sockRecvMsg (SOCKET        sock,
+                                  UINT8         *pBuffer,
+                                  UINT32        *pSize,
+                                  UINT32        *pSrcIPAddr,
+                                  UINT16        *pSrcIPPort,
+                                  UINT32        *pDstIPAddr,
+                                  VOS_TIMEVAL_T *pRxTime,
+                                  BOOL8         peek);
+
 BOOL8       vos_getMacAddress (UINT8        *pMacAddr,
                                const char   *pIfName);
 
@@ -219,6 +282,34 @@ BOOL8 vos_getMacAddress (
 #endif
 }
 
+#ifdef VOS_RXSTAMP_SUPPORT
+/**********************************************************************************************************************/
+/** Convert a kernel timestamp to the time base of vos_getTime.
+ *  The stamp is aged against its reference clock and the age subtracted from the current monotonic time.
+ *
+ *  @param[in]      pStamp          kernel timestamp
+ *  @param[in]      refClock        clock the stamp was taken from (CLOCK_REALTIME or CLOCK_TAI)
+ *  @param[out]     pTime           converted time
+ */
+void vos_sockStampToTime (
+    const struct timespec   *pStamp,
+    clockid_t               refClock,
+    VOS_TIMEVAL_T           *pTime)
+{
+    struct timespec mono;
+    struct timespec ref;
+    INT64           age;
+
+    (void) clock_gettime(CLOCK_MONOTONIC, &mono);
+    (void) clock_gettime(refClock, &ref);
+    age = ((INT64) ref.tv_sec - (INT64) pStamp->tv_sec) * 1000000000ll + (INT64) ref.tv_nsec - (INT64) pStamp->tv_nsec;
+    age = (INT64) mono.tv_sec * 1000000000ll + (INT64) mono.tv_nsec - age;
+
+    pTime->tv_sec   = (time_t) (age / 1000000000ll);
+    pTime->tv_usec  = (suseconds_t) ((age % 1000000000ll) / 1000ll);
+}
+#endif
+
 /**********************************************************************************************************************/
 /** Enlarge send and receive buffers to TRDP_SOCKBUF_SIZE if necessary.
  *
@@ -736,6 +827,9 @@ EXT_DECL VOS_ERR_T vos_sockOpenTCP (
 EXT_DECL VOS_ERR_T vos_sockClose (
     SOCKET sock)
 {
+#ifdef URING_SUPPORT
+    vos_uringCancelSocket(sock);
+#endif
     if (close(sock) == -1)
     {
         vos_printLog(VOS_LOG_ERROR,
@@ -924,6 +1018,41 @@ EXT_DECL VOS_ERR_T vos_sockSetOptions (
         }
 #endif
     }
+#ifdef VOS_TXTIME_SUPPORT
+    if ((pOptions != NULL) && (pOptions->txTime > 0))
+    {
+        /* Launch time in CLOCK_TAI (as the ETF qdisc expects), report packets dropped for missing it */
+        struct sock_txtime  txTimeCfg;
+        txTimeCfg.clockid   = CLOCK_TAI;
+        txTimeCfg.flags     = SOF_TXTIME_REPORT_ERRORS;
+        if (setsockopt(sock, SOL_SOCKET, SO_TXTIME, &txTimeCfg, sizeof(txTimeCfg)) == -1)
+        {
+            char buff[VOS_MAX_ERR_STR_SIZE];
+            STRING_ERR(buff);
+            vos_printLog(VOS_LOG_WARNING, "setsockopt() SO_TXTIME failed (Err: %s)\n", buff);
+        }
+    }
+#endif
+#ifdef VOS_RXSTAMP_SUPPORT
+    /* Receive timestamps (hardware if enabled on the interface) */
+    sockOptValue = SOF_TIMESTAMPING_RX_SOFTWARE | SOF_TIMESTAMPING_SOFTWARE |
+        SOF_TIMESTAMPING_RX_HARDWARE | SOF_TIMESTAMPING_RAW_HARDWARE;
+#ifdef VOS_TXTIME_SUPPORT
+    if ((pOptions != NULL) && (pOptions->txTime > 0))
+    {
+        /* Numbered TX completion timestamps without packet payload */
+        sockOptValue |= SOF_TIMESTAMPING_TX_SOFTWARE | SOF_TIMESTAMPING_TX_HARDWARE |
+            SOF_TIMESTAMPING_OPT_ID | SOF_TIMESTAMPING_OPT_TSONLY;
+    }
+#endif
+    if (setsockopt(sock, SOL_SOCKET, SO_TIMESTAMPING, &sockOptValue, sizeof(sockOptValue)) == -1)
+    {
+        char buff[VOS_MAX_ERR_STR_SIZE];
+        STRING_ERR(buff);
+        vos_printLog(VOS_LOG_WARNING, "setsockopt() SO_TIMESTAMPING failed (Err: %s)\n", buff);
+    }
+#endif
+
     /*  Include struct in_pktinfo in the message "ancilliary" control data.
         This way we can get the destination IP address for received UDP packets */
     sockOptValue = 1;
@@ -1172,6 +1301,271 @@ EXT_DECL VOS_ERR_T vos_sockSendUDP (
     return VOS_NO_ERR;
 }
 
+/**********************************************************************************************************************/
+/** Send UDP data at a given time.
+ *  Hand the packet to the kernel together with its launch time (SO_TXTIME/ETF qdisc). The socket must have been
+ *  opened with the txTime option. If launch times are not supported or the launch time is already due, the packet
+ *  is sent immediately.
+ *  The kernel reports stampId with the TX timestamp of the packet (SCM_TS_OPT_ID, Linux 6.13). Older kernels report
+ *  their own count of the packets sent on the socket instead, *pStampIdSet tells which one applies.
+ *
+ *  @param[in]      sock            socket descriptor
+ *  @param[in]      pBuffer         pointer to data to send
+ *  @param[in,out]  pSize           In: size of the data to send, Out: no of bytes sent
+ *  @param[in]      ipAddress       destination IP
+ *  @param[in]      port            destination port
+ *  @param[in]      pTxTime         launch time (time base of vos_getTime), NULL to send immediately
+ *  @param[in]      stampId         key of the TX timestamp of this packet
+ *  @param[out]     pStampIdSet     TRUE if the packet was handed over with stampId, may be NULL
+ *
+ *  @retval         VOS_NO_ERR      no error
+ *  @retval         VOS_PARAM_ERR   sock descriptor unknown, parameter error
+ *  @retval         VOS_IO_ERR      data could not be sent
+ *  @retval         VOS_BLOCK_ERR   Call would have blocked in blocking mode
+ */
+
+EXT_DECL VOS_ERR_T vos_sockSendUDPAt (
+    SOCKET              sock,
+    const UINT8         *pBuffer,
+    UINT32              *pSize,
+    UINT32              ipAddress,
+    UINT16              port,
+    const VOS_TIMEVAL_T *pTxTime,
+    UINT32              stampId,
+    BOOL8               *pStampIdSet)
+{
+#ifdef VOS_TXTIME_SUPPORT
+    static BOOL8 sStampIdOk = TRUE;     /* cleared once the kernel rejects SCM_TS_OPT_ID */
+    union
+    {
+        struct cmsghdr  cm;
+        char            raw[CMSG_SPACE(sizeof(uint64_t)) + CMSG_SPACE(sizeof(uint32_t))];
+    } control_un;
+    struct sockaddr_in  destAddr;
+    struct msghdr       msg;
+    struct iovec        iov;
+    struct cmsghdr      *cmsg;
+    struct timespec     mono;
+    struct timespec     tai;
+    ssize_t             sendSize    = 0;
+    INT64               lead        = 0;
+    BOOL8               withTxTime  = FALSE;
+    BOOL8               withId;
+    BOOL8               retry;
+
+    if (pStampIdSet != NULL)
+    {
+        *pStampIdSet = FALSE;
+    }
+    if (sock == -1 || pBuffer == NULL || pSize == NULL)
+    {
+        return VOS_PARAM_ERR;
+    }
+
+    if (pTxTime != NULL)
+    {
+        /* Our time base is CLOCK_MONOTONIC, the ETF qdisc wants CLOCK_TAI */
+        (void) clock_gettime(CLOCK_MONOTONIC, &mono);
+        (void) clock_gettime(CLOCK_TAI, &tai);
+        lead = ((INT64) pTxTime->tv_sec - (INT64) mono.tv_sec) * 1000000000ll +
+            (INT64) pTxTime->tv_usec * 1000ll - (INT64) mono.tv_nsec;
+
+        /* Too late to be scheduled by the kernel, it would drop the packet: send immediately */
+        withTxTime = (lead >= (INT64) VOS_TXTIME_MIN_LEAD * 1000ll) ? TRUE : FALSE;
+    }
+    withId = sStampIdOk;
+
+    if ((withTxTime == FALSE) && (withId == FALSE))
+    {
+        return vos_sockSendUDP(sock, pBuffer, pSize, ipAddress, port);
+    }
+
+    memset(&destAddr, 0, sizeof(destAddr));
+    destAddr.sin_family         = AF_INET;
+    destAddr.sin_addr.s_addr    = vos_htonl(ipAddress);
+    destAddr.sin_port           = vos_htons(port);
+
+    iov.iov_base    = (void *) pBuffer;
+    iov.iov_len     = *pSize;
+
+    *pSize = 0;
+
+    do
+    {
+        memset(&msg, 0, sizeof(msg));
+        memset(&control_un, 0, sizeof(control_un));
+        msg.msg_name        = &destAddr;
+        msg.msg_namelen     = sizeof(destAddr);
+        msg.msg_iov         = &iov;
+        msg.msg_iovlen      = 1;
+        msg.msg_control     = &control_un.cm;
+        msg.msg_controllen  = sizeof(control_un);
+
+        cmsg = CMSG_FIRSTHDR(&msg);
+        msg.msg_controllen = 0;
+        if (withTxTime == TRUE)
+        {
+            cmsg->cmsg_level    = SOL_SOCKET;
+            cmsg->cmsg_type     = SCM_TXTIME;
+            cmsg->cmsg_len      = CMSG_LEN(sizeof(uint64_t));
+            *((uint64_t *) CMSG_DATA(cmsg)) =
+                (uint64_t) ((INT64) tai.tv_sec * 1000000000ll + (INT64) tai.tv_nsec + lead);
+            msg.msg_controllen  += CMSG_SPACE(sizeof(uint64_t));
+            cmsg = (struct cmsghdr *) ((char *) cmsg + CMSG_SPACE(sizeof(uint64_t)));
+        }
+        if (withId == TRUE)
+        {
+            uint32_t key = (uint32_t) stampId;
+
+            cmsg->cmsg_level    = SOL_SOCKET;
+            cmsg->cmsg_type     = SCM_TS_OPT_ID;
+            cmsg->cmsg_len      = CMSG_LEN(sizeof(uint32_t));
+            memcpy(CMSG_DATA(cmsg), &key, sizeof(uint32_t));
+            msg.msg_controllen  += CMSG_SPACE(sizeof(uint32_t));
+        }
+
+        retry       = FALSE;
+        sendSize    = sendmsg(sock, &msg, 0);
+
+        if (sendSize == -1 && errno == EWOULDBLOCK)
+        {
+            return VOS_BLOCK_ERR;
+        }
+        if (sendSize == -1 && errno == EINVAL && withId == TRUE)
+        {
+            /* Kernel older than 6.13: it numbers the packets itself */
+            vos_printLogStr(VOS_LOG_INFO, "SCM_TS_OPT_ID not supported, TX timestamps are keyed by the kernel\n");
+            sStampIdOk  = FALSE;
+            withId      = FALSE;
+            retry       = TRUE;
+        }
+    }
+    while (sendSize == -1 && (errno == EINTR || retry == TRUE));
+
+    if (pStampIdSet != NULL)
+    {
+        *pStampIdSet = withId;
+    }
+    if (sendSize == -1)
+    {
+        char buff[VOS_MAX_ERR_STR_SIZE];
+        STRING_ERR(buff);
+        vos_printLog(VOS_LOG_WARNING, "sendmsg() to %s:%u failed (Err: %s)\n",
+                     inet_ntoa(destAddr.sin_addr), (unsigned int)port, buff);
+        return VOS_IO_ERR;
+    }
+    *pSize = (UINT32) sendSize;
+    return VOS_NO_ERR;
+#else
+    (void) pTxTime;
+    (void) stampId;
+    if (pStampIdSet != NULL)
+    {
+        *pStampIdSet = FALSE;
+    }
+    return vos_sockSendUDP(sock, pBuffer, pSize, ipAddress, port);
+#endif
+}
+
+/**********************************************************************************************************************/
+/** Fetch the next TX completion timestamp of a socket.
+ *  Reads the socket's error queue (SO_TIMESTAMPING). The socket must have been opened with the txTime option.
+ *  Software timestamps are taken from CLOCK_REALTIME, hardware timestamps are expected to be synchronised to
+ *  CLOCK_TAI (phc2sys); both are converted to the time base of vos_getTime.
+ *
+ *  @param[in]      sock            socket descriptor
+ *  @param[out]     pId             key of the packet (ee_data): stampId given to vos_sockSendUDPAt() or the
+ *                                  kernel's count of the packets sent on the socket
+ *  @param[out]     pTxStamp        time the packet left the host
+ *
+ *  @retval         VOS_NO_ERR      timestamp returned
+ *  @retval         VOS_NODATA_ERR  no (more) timestamps available
+ *  @retval         VOS_IO_ERR      a packet was dropped by the kernel (launch time missed)
+ *  @retval         VOS_PARAM_ERR   sock descriptor unknown, parameter error
+ *  @retval         VOS_UNKNOWN_ERR not supported on this target
+ */
+
+EXT_DECL VOS_ERR_T vos_sockReceiveTxStamp (
+    SOCKET          sock,
+    UINT32          *pId,
+    VOS_TIMEVAL_T   *pTxStamp)
+{
+#ifdef VOS_TXTIME_SUPPORT
+    union
+    {
+        struct cmsghdr  cm;
+        char            raw[CMSG_SPACE(sizeof(struct scm_timestamping)) +
+                            CMSG_SPACE(sizeof(struct sock_extended_err) + sizeof(struct sockaddr_in))];
+    } control_un;
+    struct msghdr               msg;
+    struct cmsghdr              *cmsg;
+    struct scm_timestamping     *pStamps    = NULL;
+    struct sock_extended_err    *pExtErr    = NULL;
+    struct timespec             stamp;
+    clockid_t                   refClock;
+
+    if (sock == -1 || pId == NULL || pTxStamp == NULL)
+    {
+        return VOS_PARAM_ERR;
+    }
+
+    memset(&msg, 0, sizeof(msg));
+    msg.msg_control     = &control_un.cm;
+    msg.msg_controllen  = sizeof(control_un);
+
+    if (recvmsg(sock, &msg, MSG_ERRQUEUE | MSG_DONTWAIT) == -1)
+    {
+        return VOS_NODATA_ERR;
+    }
+
+    for (cmsg = CMSG_FIRSTHDR(&msg); cmsg != NULL; cmsg = CMSG_NXTHDR(&msg, cmsg))
+    {
+        if (cmsg->cmsg_level == SOL_SOCKET && cmsg->cmsg_type == SCM_TIMESTAMPING)
+        {
+            pStamps = (struct scm_timestamping *) CMSG_DATA(cmsg);
+        }
+        else if (cmsg->cmsg_level == SOL_IP && cmsg->cmsg_type == IP_RECVERR)
+        {
+            pExtErr = (struct sock_extended_err *) CMSG_DATA(cmsg);
+        }
+    }
+
+    if (pExtErr == NULL)
+    {
+        return VOS_NODATA_ERR;
+    }
+    if (pExtErr->ee_origin == SO_EE_ORIGIN_TXTIME)
+    {
+        return VOS_IO_ERR;
+    }
+    if ((pExtErr->ee_origin != SO_EE_ORIGIN_TIMESTAMPING) || (pStamps == NULL))
+    {
+        return VOS_NODATA_ERR;
+    }
+
+    /* Prefer the software stamp, fall back to the hardware stamp */
+    if ((pStamps->ts[0].tv_sec != 0) || (pStamps->ts[0].tv_nsec != 0))
+    {
+        stamp       = pStamps->ts[0];
+        refClock    = CLOCK_REALTIME;
+    }
+    else
+    {
+        stamp       = pStamps->ts[2];
+        refClock    = CLOCK_TAI;
+    }
+
+    vos_sockStampToTime(&stamp, refClock, pTxStamp);
+    *pId = (UINT32) pExtErr->ee_data;
+    return VOS_NO_ERR;
+#else
+    (void) sock;
+    (void) pId;
+    (void) pTxStamp;
+    return VOS_UNKNOWN_ERR;
+#endif
+}
+
 /**********************************************************************************************************************/
 /** Receive UDP data.
  *  The caller must provide a sufficient sized buffer. If the supplied buffer is smaller than the bytes received, *pSize
@@ -1204,11 +1598,82 @@ EXT_DECL VOS_ERR_T vos_sockReceiveUDP (
     UINT16  *pSrcIPPort,
     UINT32  *pDstIPAddr,
     BOOL8   peek)
+{
+    return vos_sockRecvMsg(sock, pBuffer, pSize, pSrcIPAddr, pSrcIPPort, pDstIPAddr, NULL, peek);
+}
+
+/**********************************************************************************************************************/
+/** Receive UDP data together with its arrival time.
+ *  Like vos_sockReceiveUDP, but additionally reports the time the packet was received by the kernel
+ *  (SO_TIMESTAMPING). Hardware timestamps are used if enabled on the interface and are expected to be synchronised
+ *  to CLOCK_TAI (phc2sys), software timestamps are taken from CLOCK_REALTIME. Without any kernel timestamp, the
+ *  time of the recvmsg() call is reported.
+ *
+ *  @param[in]      sock            socket descriptor
+ *  @param[out]     pBuffer         pointer to applications data buffer
+ *  @param[in,out]  pSize           pointer to the received data size
+ *  @param[out]     pSrcIPAddr      pointer to source IP
+ *  @param[out]     pSrcIPPort      pointer to source port
+ *  @param[out]     pDstIPAddr      pointer to dest IP
+ *  @param[out]     pRxTime         pointer to arrival time (time base of vos_getTime)
+ *  @param[in]      peek            if true, leave data in queue
+ *
+ *  @retval         VOS_NO_ERR      no error
+ *  @retval         VOS_PARAM_ERR   sock descriptor unknown, parameter error
+ *  @retval         VOS_IO_ERR      data could not be read
+ *  @retval         VOS_NODATA_ERR  no data
+ *  @retval         VOS_BLOCK_ERR   Call would have blocked in blocking mode
+ */
+
+EXT_DECL VOS_ERR_T vos_sockReceiveUDPStamped (
+    SOCKET          sock,
+    UINT8           *pBuffer,
+    UINT32          *pSize,
+    UINT32          *pSrcIPAddr,
+    UINT16          *pSrcIPPort,
+    UINT32          *pDstIPAddr,
+    VOS_TIMEVAL_T   *pRxTime,
+    BOOL8           peek)
+{
+    if (pRxTime == NULL)
+    {
+        return VOS_PARAM_ERR;
+    }
+    return vos_sockRecvMsg(sock, pBuffer, pSize, pSrcIPAddr, pSrcIPPort, pDstIPAddr, pRxTime, peek);
+}
+
+/**********************************************************************************************************************/
+/** Receive UDP data, common part of vos_sockReceiveUDP and vos_sockReceiveUDPStamped.
+ *
+ *  @param[in]      sock            socket descriptor
+ *  @param[out]     pBuffer         pointer to applications data buffer
+ *  @param[in,out]  pSize           pointer to the received data size
+ *  @param[out]     pSrcIPAddr      pointer to source IP
+ *  @param[out]     pSrcIPPort      pointer to source port
+ *  @param[out]     pDstIPAddr      pointer to dest IP
+ *  @param[out]     pRxTime         pointer to arrival time, NULL if not needed
+ *  @param[in]      peek            if true, leave data in queue
+ *
+ *  @retval         VOS_NO_ERR      no error
+ *  @retval         VOS_PARAM_ERR   sock descriptor unknown, parameter error
+ *  @retval         VOS_IO_ERR      data could not be read
+ *  @retval         VOS_NODATA_ERR  no data
+ *  @retval         VOS_BLOCK_ERR   Call would have blocked in blocking mode
+ */
+static VOS_ERR_T vos_sockRecvMsg (
+    SOCKET          sock,
+    UINT8           *pBuffer,
+    UINT32          *pSize,
+    UINT32          *pSrcIPAddr,
+    UINT16          *pSrcIPPort,
+    UINT32          *pDstIPAddr,
+    VOS_TIMEVAL_T   *pRxTime,
+    BOOL8           peek)
 {
     union
     {
         struct cmsghdr  cm;
-        char            raw[32];
+        char            raw[128];   /* destination address and receive timestamps */
     } control_un;
     struct sockaddr_in  srcAddr;
     socklen_t           sockLen = sizeof(srcAddr);
@@ -1246,6 +1711,29 @@ EXT_DECL VOS_ERR_T vos_sockReceiveUDP (
 
         if (rcvSize != -1)
         {
+            if (pRxTime != NULL)
+            {
+                vos_getTime(pRxTime);
+#ifdef VOS_RXSTAMP_SUPPORT
+                for (cmsg = CMSG_FIRSTHDR(&msg); cmsg != NULL; cmsg = CMSG_NXTHDR(&msg, cmsg))
+                {
+                    if (cmsg->cmsg_level == SOL_SOCKET && cmsg->cmsg_type == SCM_TIMESTAMPING)
+                    {
+                        struct scm_timestamping *pStamps = (struct scm_timestamping *) CMSG_DATA(cmsg);
+
+                        /* Prefer the hardware stamp, fall back to the software stamp */
+                        if ((pStamps->ts[2].tv_sec != 0) || (pStamps->ts[2].tv_nsec != 0))
+                        {
+                            vos_sockStampToTime(&pStamps->ts[2], CLOCK_TAI, pRxTime);
+                        }
+                        else if ((pStamps->ts[0].tv_sec != 0) || (pStamps->ts[0].tv_nsec != 0))
+                        {
+                            vos_sockStampToTime(&pStamps->ts[0], CLOCK_REALTIME, pRxTime);
+                        }
+                    }
+                }
+#endif
+            }
             if (pDstIPAddr != NULL)
             {
                 for (cmsg = CMSG_FIRSTHDR(&msg); cmsg != NULL; cmsg = CMSG_NXTHDR(&msg, cmsg))
@@ -1613,31 +2101,485 @@ EXT_DECL VOS_ERR_T vos_sockSendTCP (
 }
 
 /**********************************************************************************************************************/
-/** Receive TCP data.
- *  The caller must provide a sufficient sized buffer. If the supplied buffer is smaller than the bytes received, *pSize
- *  will reflect the number of copied bytes and the call should be repeated until *pSize is 0 (zero).
- *  If the socket was created in blocking-mode (default), then this call will block and will only return if data has
- *  been received or the socket was closed or an error occured.
- *  If called in non-blocking mode, and no data is available, VOS_NODATA_ERR will be returned.
+/** Fill a scatter/gather list.
+ *
+ *  @param[in]      pIov            buffers to send
+ *  @param[in]      noOfIov         number of buffers
+ *  @param[out]     pVec            system buffer list
+ *
+ *  @retval         total size of the buffers
+ */
+static size_t vos_sockFillIov (
+    const VOS_IOVEC_T   *pIov,
+    UINT32              noOfIov,
+    struct iovec        *pVec)
+{
+    size_t  size = 0u;
+    UINT32  i;
+
+    for (i = 0u; i < noOfIov; i++)
+    {
+        pVec[i].iov_base    = (void *) pIov[i].pBuffer;
+        pVec[i].iov_len     = pIov[i].size;
+        size += pIov[i].size;
+    }
+    return size;
+}
+
+/**********************************************************************************************************************/
+/** Send UDP data from several buffers as one datagram.
+ *  If zero copy is requested and available (Linux: MSG_ZEROCOPY, enabled by vos_sockEnableZeroCopy()), the kernel
+ *  references the buffers until the completion is reported by vos_sockReceiveZeroCopy().
  *
  *  @param[in]      sock            socket descriptor
- *  @param[out]     pBuffer         pointer to applications data buffer
- *  @param[in,out]  pSize           pointer to the received data size
+ *  @param[in]      pIov            buffers to send
+ *  @param[in]      noOfIov         number of buffers (max. VOS_MAX_IOV)
+ *  @param[in,out]  pSize           In: total size of the data to send, Out: no of bytes sent
+ *  @param[in]      ipAddress       destination IP
+ *  @param[in]      port            destination port
+ *  @param[in,out]  pZeroCopy       In: try zero copy, Out: TRUE if the data was sent with zero copy
  *
  *  @retval         VOS_NO_ERR      no error
  *  @retval         VOS_PARAM_ERR   sock descriptor unknown, parameter error
- *  @retval         VOS_IO_ERR      data could not be read
- *  @retval         VOS_NODATA_ERR  no data
+ *  @retval         VOS_IO_ERR      data could not be sent
  *  @retval         VOS_BLOCK_ERR   Call would have blocked in blocking mode
  */
 
-EXT_DECL VOS_ERR_T vos_sockReceiveTCP (
-    SOCKET  sock,
-    UINT8   *pBuffer,
-    UINT32  *pSize)
+EXT_DECL VOS_ERR_T vos_sockSendUDPV (
+    SOCKET              sock,
+    const VOS_IOVEC_T   *pIov,
+    UINT32              noOfIov,
+    UINT32              *pSize,
+    UINT32              ipAddress,
+    UINT16              port,
+    BOOL8               *pZeroCopy)
 {
-    ssize_t rcvSize     = 0;
-    size_t  bufferSize  = (size_t) *pSize;
+    struct sockaddr_in  destAddr;
+    struct msghdr       msg;
+    struct iovec        vec[VOS_MAX_IOV];
+    ssize_t             sendSize    = 0;
+    int                 flags       = 0;
+
+    if (sock == -1 || pIov == NULL || pSize == NULL || noOfIov == 0u || noOfIov > VOS_MAX_IOV)
+    {
+        return VOS_PARAM_ERR;
+    }
+
+#ifdef VOS_ZEROCOPY_SUPPORT
+    if ((pZeroCopy != NULL) && (*pZeroCopy == TRUE))
+    {
+        flags = MSG_ZEROCOPY;
+    }
+#endif
+    if (pZeroCopy != NULL)
+    {
+        *pZeroCopy = FALSE;
+    }
+
+    memset(&destAddr, 0, sizeof(destAddr));
+    destAddr.sin_family         = AF_INET;
+    destAddr.sin_addr.s_addr    = vos_htonl(ipAddress);
+    destAddr.sin_port           = vos_htons(port);
+
+    memset(&msg, 0, sizeof(msg));
+    msg.msg_name    = &destAddr;
+    msg.msg_namelen = sizeof(destAddr);
+    msg.msg_iov     = vec;
+    msg.msg_iovlen  = noOfIov;
+    (void) vos_sockFillIov(pIov, noOfIov, vec);
+
+    *pSize = 0u;
+
+    do
+    {
+        sendSize = sendmsg(sock, &msg, flags);
+
+        if ((sendSize == -1) && (errno == ENOBUFS) && (flags != 0))
+        {
+            /* No more pages can be pinned for this socket: send a copy */
+            flags       = 0;
+            sendSize    = sendmsg(sock, &msg, flags);
+        }
+
+        if (sendSize == -1 && errno == EWOULDBLOCK)
+        {
+            return VOS_BLOCK_ERR;
+        }
+    }
+    while (sendSize == -1 && errno == EINTR);
+
+    if (sendSize == -1)
+    {
+        char buff[VOS_MAX_ERR_STR_SIZE];
+        STRING_ERR(buff);
+        vos_printLog(VOS_LOG_WARNING, "sendmsg() to %s:%u failed (Err: %s)\n",
+                     inet_ntoa(destAddr.sin_addr), (unsigned int)port, buff);
+        return VOS_IO_ERR;
+    }
+
+    *pSize = (UINT32) sendSize;
+    if ((pZeroCopy != NULL) && (flags != 0))
+    {
+        *pZeroCopy = TRUE;
+    }
+    return VOS_NO_ERR;
+}
+
+/**********************************************************************************************************************/
+/** Send several UDP datagrams with one call (Linux: sendmmsg), other targets send them one by one.
+ *  Datagrams are sent in order, sending stops at the first one which could not be sent.
+ *
+ *  @param[in]      sock            socket descriptor
+ *  @param[in,out]  pMsg            datagrams to send, the size sent is returned per datagram
+ *  @param[in,out]  pNoOfMsg        In: number of datagrams (max. VOS_MAX_UDP_BATCH), Out: number of datagrams sent
+ *
+ *  @retval         VOS_NO_ERR      at least one datagram was sent
+ *  @retval         VOS_PARAM_ERR   sock descriptor unknown, parameter error
+ *  @retval         VOS_IO_ERR      data could not be sent
+ *  @retval         VOS_BLOCK_ERR   Call would have blocked in blocking mode
+ */
+
+EXT_DECL VOS_ERR_T vos_sockSendUDPBatch (
+    SOCKET          sock,
+    VOS_UDP_MSG_T   *pMsg,
+    UINT32          *pNoOfMsg)
+{
+#ifdef VOS_SENDMMSG_SUPPORT
+    struct sockaddr_in  destAddr[VOS_MAX_UDP_BATCH];
+    struct mmsghdr      msg[VOS_MAX_UDP_BATCH];
+    struct iovec        vec[VOS_MAX_UDP_BATCH][VOS_MAX_IOV];
+    int                 sent;
+    UINT32              i;
+
+    if (sock == -1 || pMsg == NULL || pNoOfMsg == NULL || *pNoOfMsg == 0u || *pNoOfMsg > VOS_MAX_UDP_BATCH)
+    {
+        return VOS_PARAM_ERR;
+    }
+
+    memset(msg, 0, *pNoOfMsg * sizeof(struct mmsghdr));
+    for (i = 0u; i < *pNoOfMsg; i++)
+    {
+        if ((pMsg[i].pIov == NULL) || (pMsg[i].noOfIov == 0u) || (pMsg[i].noOfIov > VOS_MAX_IOV))
+        {
+            return VOS_PARAM_ERR;
+        }
+        memset(&destAddr[i], 0, sizeof(struct sockaddr_in));
+        destAddr[i].sin_family          = AF_INET;
+        destAddr[i].sin_addr.s_addr     = vos_htonl(pMsg[i].ipAddress);
+        destAddr[i].sin_port            = vos_htons(pMsg[i].port);
+        msg[i].msg_hdr.msg_name         = &destAddr[i];
+        msg[i].msg_hdr.msg_namelen      = sizeof(struct sockaddr_in);
+        msg[i].msg_hdr.msg_iov          = vec[i];
+        msg[i].msg_hdr.msg_iovlen       = pMsg[i].noOfIov;
+        (void) vos_sockFillIov(pMsg[i].pIov, pMsg[i].noOfIov, vec[i]);
+        pMsg[i].size = 0u;
+    }
+
+    do
+    {
+        sent = sendmmsg(sock, msg, *pNoOfMsg, 0);
+
+        if (sent == -1 && errno == EWOULDBLOCK)
+        {
+            *pNoOfMsg = 0u;
+            return VOS_BLOCK_ERR;
+        }
+    }
+    while (sent == -1 && errno == EINTR);
+
+    if (sent == -1)
+    {
+        char buff[VOS_MAX_ERR_STR_SIZE];
+        STRING_ERR(buff);
+        vos_printLog(VOS_LOG_WARNING, "sendmmsg() to %s:%u failed (Err: %s)\n",
+                     inet_ntoa(destAddr[0].sin_addr), (unsigned int)pMsg[0].port, buff);
+        *pNoOfMsg = 0u;
+        return VOS_IO_ERR;
+    }
+
+    for (i = 0u; i < (UINT32) sent; i++)
+    {
+        pMsg[i].size = (UINT32) msg[i].msg_len;
+    }
+    *pNoOfMsg = (UINT32) sent;
+    return VOS_NO_ERR;
+#else
+    UINT32      i;
+    VOS_ERR_T   err = VOS_NO_ERR;
+
+    if (pMsg == NULL || pNoOfMsg == NULL || *pNoOfMsg == 0u || *pNoOfMsg > VOS_MAX_UDP_BATCH)
+    {
+        return VOS_PARAM_ERR;
+    }
+    for (i = 0u; (i < *pNoOfMsg) && (err == VOS_NO_ERR); i++)
+    {
+        UINT32 j;
+        pMsg[i].size = 0u;
+        for (j = 0u; j < pMsg[i].noOfIov; j++)
+        {
+            pMsg[i].size += pMsg[i].pIov[j].size;
+        }
+        err = vos_sockSendUDPV(sock, pMsg[i].pIov, pMsg[i].noOfIov, &pMsg[i].size, pMsg[i].ipAddress,
+                               pMsg[i].port, NULL);
+    }
+    if (err != VOS_NO_ERR)
+    {
+        i--;
+    }
+    *pNoOfMsg = i;
+    return (i > 0u) ? VOS_NO_ERR : err;
+#endif
+}
+
+/**********************************************************************************************************************/
+/** Send TCP data from several buffers.
+ *  Without zero copy, sends until all data is sent or the call would block (like vos_sockSendTCP).
+ *  With zero copy, a single send call is made: each call is one zero copy completion, the rest is sent by the next call.
+ *
+ *  @param[in]      sock            socket descriptor
+ *  @param[in]      pIov            buffers to send
+ *  @param[in]      noOfIov         number of buffers (max. VOS_MAX_IOV)
+ *  @param[in,out]  pSize           In: total size of the data to send, Out: no of bytes sent
+ *  @param[in,out]  pZeroCopy       In: try zero copy, Out: TRUE if data was sent with zero copy
+ *
+ *  @retval         VOS_NO_ERR      no error
+ *  @retval         VOS_PARAM_ERR   sock descriptor unknown, parameter error
+ *  @retval         VOS_IO_ERR      data could not be sent
+ *  @retval         VOS_NOCONN_ERR  no TCP connection
+ *  @retval         VOS_BLOCK_ERR   call would have blocked in blocking mode, data partially sent
+ */
+
+EXT_DECL VOS_ERR_T vos_sockSendTCPV (
+    SOCKET              sock,
+    const VOS_IOVEC_T   *pIov,
+    UINT32              noOfIov,
+    UINT32              *pSize,
+    BOOL8               *pZeroCopy)
+{
+    struct msghdr   msg;
+    struct iovec    vec[VOS_MAX_IOV];
+    struct iovec    *pVec       = vec;
+    size_t          vecCnt      = noOfIov;
+    size_t          bufferSize  = 0u;
+    ssize_t         sendSize    = 0;
+    size_t          sent;
+    int             flags       = 0;
+
+    if (sock == -1 || pIov == NULL || pSize == NULL || noOfIov == 0u || noOfIov > VOS_MAX_IOV)
+    {
+        return VOS_PARAM_ERR;
+    }
+
+#ifdef VOS_ZEROCOPY_SUPPORT
+    if ((pZeroCopy != NULL) && (*pZeroCopy == TRUE))
+    {
+        flags = MSG_ZEROCOPY;
+    }
+#endif
+    if (pZeroCopy != NULL)
+    {
+        *pZeroCopy = FALSE;
+    }
+
+    bufferSize  = vos_sockFillIov(pIov, noOfIov, vec);
+    *pSize      = 0u;
+
+    /* Keep on sending until we got rid of all data or we received an unrecoverable error */
+    do
+    {
+        memset(&msg, 0, sizeof(msg));
+        msg.msg_iov     = pVec;
+        msg.msg_iovlen  = vecCnt;
+
+        sendSize = sendmsg(sock, &msg, flags);
+
+        if ((sendSize == -1) && (errno == ENOBUFS) && (flags != 0))
+        {
+            /* No more pages can be pinned for this socket: send a copy */
+            flags       = 0;
+            sendSize    = sendmsg(sock, &msg, flags);
+        }
+
+        if (sendSize >= 0)
+        {
+            bufferSize  -= (size_t) sendSize;
+            *pSize      += (UINT32) sendSize;
+
+            if (flags != 0)
+            {
+                /* One zero copy send per call, the caller continues with the remainder */
+                *pZeroCopy = TRUE;
+                break;
+            }
+
+            /* Skip the buffers already sent */
+            sent = (size_t) sendSize;
+            while ((vecCnt > 0u) && (sent >= pVec->iov_len))
+            {
+                sent -= pVec->iov_len;
+                pVec++;
+                vecCnt--;
+            }
+            if (vecCnt > 0u)
+            {
+                pVec->iov_base  = (UINT8 *) pVec->iov_base + sent;
+                pVec->iov_len  -= sent;
+            }
+        }
+        if (sendSize == -1 && errno == EWOULDBLOCK)
+        {
+            return VOS_BLOCK_ERR;
+        }
+    }
+    while (bufferSize && !(sendSize == -1 && errno != EINTR));
+
+    if (sendSize == -1)
+    {
+        char buff[VOS_MAX_ERR_STR_SIZE];
+        STRING_ERR(buff);
+        vos_printLog(VOS_LOG_WARNING, "sendmsg() failed (Err: %s)\n", buff);
+
+        if ((errno == ENOTCONN)
+            || (errno == ECONNREFUSED)
+            || (errno == EHOSTUNREACH))
+        {
+            return VOS_NOCONN_ERR;
+        }
+        else
+        {
+            return VOS_IO_ERR;
+        }
+    }
+    return VOS_NO_ERR;
+}
+
+/**********************************************************************************************************************/
+/** Enable zero copy sending on a socket (Linux: SO_ZEROCOPY).
+ *
+ *  @param[in]      sock            socket descriptor
+ *
+ *  @retval         VOS_NO_ERR      no error
+ *  @retval         VOS_PARAM_ERR   sock descriptor unknown
+ *  @retval         VOS_UNKNOWN_ERR not supported on this target or by the kernel
+ */
+
+EXT_DECL VOS_ERR_T vos_sockEnableZeroCopy (
+    SOCKET sock)
+{
+#ifdef VOS_ZEROCOPY_SUPPORT
+    int one = 1;
+
+    if (sock == -1)
+    {
+        return VOS_PARAM_ERR;
+    }
+    if (setsockopt(sock, SOL_SOCKET, SO_ZEROCOPY, &one, sizeof(one)) == -1)
+    {
+        char buff[VOS_MAX_ERR_STR_SIZE];
+        STRING_ERR(buff);
+        vos_printLog(VOS_LOG_INFO, "setsockopt() SO_ZEROCOPY failed (Err: %s)\n", buff);
+        return VOS_UNKNOWN_ERR;
+    }
+    return VOS_NO_ERR;
+#else
+    (void) sock;
+    return VOS_UNKNOWN_ERR;
+#endif
+}
+
+/**********************************************************************************************************************/
+/** Fetch the next zero copy completion of a socket.
+ *  Zero copy sends are numbered consecutively per socket, starting with 0. Completions are reported in ranges.
+ *
+ *  @param[in]      sock            socket descriptor
+ *  @param[out]     pDone           number of the last completed zero copy send + 1
+ *
+ *  @retval         VOS_NO_ERR      completion returned
+ *  @retval         VOS_NODATA_ERR  no (more) completions available
+ *  @retval         VOS_PARAM_ERR   parameter out of range/invalid
+ *  @retval         VOS_UNKNOWN_ERR not supported on this target
+ */
+
+EXT_DECL VOS_ERR_T vos_sockReceiveZeroCopy (
+    SOCKET  sock,
+    UINT32  *pDone)
+{
+#ifdef VOS_ZEROCOPY_SUPPORT
+    union
+    {
+        struct cmsghdr  cm;
+        char            raw[CMSG_SPACE(sizeof(struct sock_extended_err) + sizeof(struct sockaddr_in6))];
+    } control_un;
+    struct msghdr               msg;
+    struct cmsghdr              *cmsg;
+    struct sock_extended_err    *pExtErr;
+
+    if (sock == -1 || pDone == NULL)
+    {
+        return VOS_PARAM_ERR;
+    }
+
+    do
+    {
+        memset(&msg, 0, sizeof(msg));
+        msg.msg_control     = &control_un.cm;
+        msg.msg_controllen  = sizeof(control_un);
+
+        if (recvmsg(sock, &msg, MSG_ERRQUEUE | MSG_DONTWAIT) == -1)
+        {
+            return VOS_NODATA_ERR;
+        }
+
+        /* Skip other entries of the error queue (e.g. TX timestamps) */
+        for (cmsg = CMSG_FIRSTHDR(&msg); cmsg != NULL; cmsg = CMSG_NXTHDR(&msg, cmsg))
+        {
+            if (((cmsg->cmsg_level == SOL_IP) && (cmsg->cmsg_type == IP_RECVERR))
+                || ((cmsg->cmsg_level == SOL_IPV6) && (cmsg->cmsg_type == IPV6_RECVERR)))
+            {
+                pExtErr = (struct sock_extended_err *) CMSG_DATA(cmsg);
+                if ((pExtErr->ee_errno == 0) && (pExtErr->ee_origin == SO_EE_ORIGIN_ZEROCOPY))
+                {
+                    /* ee_info .. ee_data is the range of completed sends */
+                    *pDone = pExtErr->ee_data + 1u;
+                    return VOS_NO_ERR;
+                }
+            }
+        }
+    }
+    while (TRUE);  /*lint !e506 */
+#else
+    (void) sock;
+    (void) pDone;
+    return VOS_UNKNOWN_ERR;
+#endif
+}
+
+/**********************************************************************************************************************/
+/** Receive TCP data.
+ *  The caller must provide a sufficient sized buffer. If the supplied buffer is smaller than the bytes received, *pSize
+ *  will reflect the number of copied bytes and the call should be repeated until *pSize is 0 (zero).
+ *  If the socket was created in blocking-mode (default), then this call will block and will only return if data has
+ *  been received or the socket was closed or an error occured.
+ *  If called in non-blocking mode, and no data is available, VOS_NODATA_ERR will be returned.
+ *
+ *  @param[in]      sock            socket descriptor
+ *  @param[out]     pBuffer         pointer to applications data buffer
+ *  @param[in,out]  pSize           pointer to the received data size
+ *
+ *  @retval         VOS_NO_ERR      no error
+ *  @retval         VOS_PARAM_ERR   sock descriptor unknown, parameter error
+ *  @retval         VOS_IO_ERR      data could not be read
+ *  @retval         VOS_NODATA_ERR  no data
+ *  @retval         VOS_BLOCK_ERR   Call would have blocked in blocking mode
+ */
+
+EXT_DECL VOS_ERR_T vos_sockReceiveTCP (
+    SOCKET  sock,
+    UINT8   *pBuffer,
+    UINT32  *pSize)
+{
+    ssize_t rcvSize     = 0;
+    size_t  bufferSize  = (size_t) *pSize;
 
     *pSize = 0;
 
@@ -1750,6 +2692,140 @@ EXT_DECL VOS_ERR_T vos_sockSetMulticastIf (
 }
 
 
+/**********************************************************************************************************************/
+/** Drop unwanted UDP datagrams in the kernel.
+ *  On Linux a classic BPF program is attached to the socket. For UDP sockets, the filter sees the datagram starting
+ *  with the UDP header.
+ *
+ *  @param[in]      sock               socket descriptor
+ *  @param[in]      keyOffset          payload offset of the key
+ *  @param[in]      pKeys              keys to pass, NULL removes the filter
+ *  @param[in]      noOfKeys           number of keys (max. VOS_SOCK_FILTER_MAX_KEYS)
+ *  @param[in]      bypassOffset       payload offset of the bypass field
+ *  @param[in]      bypassValue        value of the bypass field to pass regardless of the key
+ *
+ *  @retval         VOS_NO_ERR         no error
+ *  @retval         VOS_PARAM_ERR      parameter out of range/invalid
+ *  @retval         VOS_SOCK_ERR       filter could not be attached
+ *  @retval         VOS_UNKNOWN_ERR    not supported on this target
+ */
+EXT_DECL VOS_ERR_T vos_sockSetPayloadFilter (
+    SOCKET          sock,
+    UINT32          keyOffset,
+    const UINT32    *pKeys,
+    UINT32          noOfKeys,
+    UINT32          bypassOffset,
+    UINT16          bypassValue)
+{
+#ifdef VOS_SOCKFILTER_SUPPORT
+    struct sock_filter  code[VOS_SOCK_FILTER_MAX_KEYS + 6u];
+    struct sock_fprog   prog;
+    const UINT32        udpHeader   = 8u;
+    UINT32              accept;
+    UINT32              i;
+
+    if ((sock == -1) || (noOfKeys > VOS_SOCK_FILTER_MAX_KEYS))
+    {
+        return VOS_PARAM_ERR;
+    }
+    if (pKeys == NULL)
+    {
+        /* Fails if no filter was attached, which is fine */
+        (void) setsockopt(sock, SOL_SOCKET, SO_DETACH_FILTER, NULL, 0);
+        return VOS_NO_ERR;
+    }
+
+    /*  0: A = datagram length
+        1: if (A < end of key) goto accept
+        2: A = 16 bit bypass field
+        3: if (A == bypassValue) goto accept
+        4: A = 32 bit key
+        5...: if (A == key[i]) goto accept
+        drop: return 0
+        accept: return all          */
+    accept = 6u + noOfKeys;
+    code[0] = (struct sock_filter) BPF_STMT(BPF_LD | BPF_W | BPF_LEN, 0);
+    code[1] = (struct sock_filter) BPF_JUMP(BPF_JMP | BPF_JGE | BPF_K, udpHeader + keyOffset + 4u, 0u,
+                                            (UINT8) (accept - 2u));
+    code[2] = (struct sock_filter) BPF_STMT(BPF_LD | BPF_H | BPF_ABS, udpHeader + bypassOffset);
+    code[3] = (struct sock_filter) BPF_JUMP(BPF_JMP | BPF_JEQ | BPF_K, bypassValue, (UINT8) (accept - 4u), 0u);
+    code[4] = (struct sock_filter) BPF_STMT(BPF_LD | BPF_W | BPF_ABS, udpHeader + keyOffset);
+    for (i = 0u; i < noOfKeys; i++)
+    {
+        code[5u + i] = (struct sock_filter) BPF_JUMP(BPF_JMP | BPF_JEQ | BPF_K, pKeys[i],
+                                                     (UINT8) (accept - 6u - i), 0u);
+    }
+    code[accept - 1u]   = (struct sock_filter) BPF_STMT(BPF_RET | BPF_K, 0u);
+    code[accept]        = (struct sock_filter) BPF_STMT(BPF_RET | BPF_K, 0xFFFFFFFFu);
+
+    prog.len    = (unsigned short) (accept + 1u);
+    prog.filter = code;
+
+    if (setsockopt(sock, SOL_SOCKET, SO_ATTACH_FILTER, &prog, sizeof(prog)) == -1)
+    {
+        char buff[VOS_MAX_ERR_STR_SIZE];
+        STRING_ERR(buff);
+        vos_printLog(VOS_LOG_WARNING, "setsockopt() SO_ATTACH_FILTER failed (Err: %s)\n", buff);
+        return VOS_SOCK_ERR;
+    }
+    return VOS_NO_ERR;
+#else
+    (void) sock;
+    (void) keyOffset;
+    (void) pKeys;
+    (void) noOfKeys;
+    (void) bypassOffset;
+    (void) bypassValue;
+    return VOS_UNKNOWN_ERR;
+#endif
+}
+
+/**********************************************************************************************************************/
+/** Busy poll the device queue on receive.
+ *  On Linux, a receive finding no data polls the queue of the network device for up to busyPollTime us before it
+ *  returns (SO_BUSY_POLL), and the device interrupts are deferred while the socket is polled (SO_PREFER_BUSY_POLL,
+ *  Linux 5.11, ignored by older kernels). Times above net.core.busy_read need CAP_NET_ADMIN. Devices without NAPI
+ *  (e.g. loopback) are not affected.
+ *
+ *  @param[in]      sock               socket descriptor
+ *  @param[in]      busyPollTime       time to poll in us, 0 to switch busy polling off
+ *
+ *  @retval         VOS_NO_ERR         no error
+ *  @retval         VOS_PARAM_ERR      sock descriptor unknown
+ *  @retval         VOS_SOCK_ERR       option could not be set
+ *  @retval         VOS_UNKNOWN_ERR    not supported on this target
+ */
+EXT_DECL VOS_ERR_T vos_sockSetBusyPoll (
+    SOCKET  sock,
+    UINT32  busyPollTime)
+{
+#ifdef VOS_BUSYPOLL_SUPPORT
+    int optval = (int) busyPollTime;
+
+    if (sock == -1)
+    {
+        return VOS_PARAM_ERR;
+    }
+    if (setsockopt(sock, SOL_SOCKET, SO_BUSY_POLL, &optval, sizeof(optval)) == -1)
+    {
+        char buff[VOS_MAX_ERR_STR_SIZE];
+        STRING_ERR(buff);
+        vos_printLog(VOS_LOG_WARNING, "setsockopt() SO_BUSY_POLL failed (Err: %s)\n", buff);
+        return VOS_SOCK_ERR;
+    }
+    optval = (busyPollTime != 0u) ? 1 : 0;
+    if (setsockopt(sock, SOL_SOCKET, SO_PREFER_BUSY_POLL, &optval, sizeof(optval)) == -1)
+    {
+        vos_printLogStr(VOS_LOG_DBG, "setsockopt() SO_PREFER_BUSY_POLL not supported\n");
+    }
+    return VOS_NO_ERR;
+#else
+    (void) sock;
+    (void) busyPollTime;
+    return VOS_UNKNOWN_ERR;
+#endif
+}
+
 /**********************************************************************************************************************/
 /** Determines the address to bind to since the behaviour in the different OS is different
  *  @param[in]      srcIP           IP to bind to (0 = any address)
@@ -0,0 +1,923 @@
+/**********************************************************************************************************************/
+/**
+ * @file            posix/vos_sockUring.c
+ *
+ * @brief           io_uring socket functions
+ *
+ * @details         OS abstraction of an io_uring based I/O engine (Linux) for PD traffic.
+ *                  Receiving: a multishot recvmsg is armed once per socket, the kernel places each datagram
+ *                  (together with its source address, destination address and receive timestamp) in one of the
+ *                  buffers of a provided buffer ring and posts a completion. The completions are taken from the
+ *                  shared memory of the ring, the descriptor of the ring is readable as long as there are some.
+ *                  Sending: the datagrams of a send cycle are queued as sendmsg submissions and handed to the kernel
+ *                  with one io_uring_enter() call, which also waits for their completions.
+ *                  Receiving and sending use separate rings, they may be driven by different threads.
+ *                  Needs Linux 6.0 or later (multishot recvmsg), vos_uringOpen() fails on older kernels.
+ *
+ * @note            Project: TCNOpen TRDP prototype stack
+ *
+ * @author          agent
+ *
+ * @remarks This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0.
+ *          If a copy of the MPL was not distributed with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ *          Copyright agent, 2026. All rights reserved.
+ */
+/*
+* $Id$
+*
+*      AG 2026-10-19: io_uring for PD: multishot receive with provided buffers, batched send (URING_SUPPORT)
+*
+*/
+
+#ifndef URING_SUPPORT
+#error \
+    "You are trying to add io_uring support to vos_sock.c - either define URING_SUPPORT or exclude this file!"
+#else
+
+/***********************************************************************************************************************
+ * INCLUDES
+ */
+
+#include <stdio.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <unistd.h>
+#include <errno.h>
+#include <string.h>
+#include <time.h>
+#include <pthread.h>
+#include <sys/socket.h>
+#include <sys/mman.h>
+#include <sys/syscall.h>
+#include <netinet/in.h>
+#include <arpa/inet.h>
+
+#include <linux/io_uring.h>
+#include <linux/net_tstamp.h>
+#include <linux/errqueue.h>
+
+#include "vos_utils.h"
+#include "vos_sock.h"
+#include "vos_thread.h"
+#include "vos_mem.h"
+#include "vos_private.h"
+
+/***********************************************************************************************************************
+ * DEFINITIONS
+ */
+
+#define VOS_URING_BUF_SIZE      2048u               /**< size of a receive buffer                           */
+#define VOS_URING_MAX_BUFS      32768u              /**< max. receive buffers (provided buffer ring)        */
+#define VOS_URING_CONTROL_SIZE  128u                /**< destination address and receive timestamps         */
+#define VOS_URING_RX_ENTRIES    32u                 /**< submissions of the receive ring (arm, cancel)      */
+#define VOS_URING_TX_ENTRIES    256u                /**< datagrams queued for sending at most               */
+#define VOS_URING_BGID          0u                  /**< buffer group of the receive buffers                */
+#define VOS_URING_CANCEL_TAG    0xFFFFFFFFFFFFFFFFull   /**< user data of cancel requests                   */
+
+/** Header in front of each datagram in a receive buffer (struct io_uring_recvmsg_out, name and control data) */
+#define VOS_URING_HDR_SIZE      (sizeof(struct io_uring_recvmsg_out) + sizeof(struct sockaddr_in) + \
+                                 VOS_URING_CONTROL_SIZE)
+
+#if defined(SO_TIMESTAMPING) && defined(SCM_TIMESTAMPING)
+#   define VOS_URING_RXSTAMP    1
+#endif
+
+/** A submission and completion queue pair shared with the kernel */
+typedef struct
+{
+    int                 fd;
+    UINT32              *pSqHead;
+    UINT32              *pSqTail;
+    UINT32              *pSqFlags;
+    UINT32              sqMask;
+    UINT32              *pSqArray;
+    struct io_uring_sqe *pSqes;
+    UINT32              *pCqHead;
+    UINT32              *pCqTail;
+    UINT32              cqMask;
+    struct io_uring_cqe *pCqes;
+    void                *pMap;
+    size_t              mapSize;
+    size_t              sqesSize;
+} VOS_URING_QUEUE_T;
+
+/** Socket with an armed multishot receive */
+typedef struct
+{
+    SOCKET              sock;
+    UINT32              gen;                        /**< distinguishes the completions of former sockets    */
+    BOOL8               used;
+    BOOL8               armed;                      /**< FALSE after the kernel ended the multishot receive */
+} VOS_URING_SLOT_T;
+
+/** io_uring I/O engine */
+struct VOS_URING
+{
+    struct VOS_URING        *pNext;                 /**< list of open rings (vos_uringCancelSocket)         */
+    VOS_URING_QUEUE_T       rx;
+    VOS_URING_QUEUE_T       tx;
+    struct VOS_MUTEX        rxMutex;                /**< submissions to the receive ring                    */
+    struct io_uring_buf_ring *pBufRing;
+    size_t                  bufRingSize;
+    UINT8                   *pBufs;
+    UINT32                  noOfBufs;
+    UINT16                  *pPeeked;               /**< buffers handed out by vos_uringReceive             */
+    UINT32                  noOfPeeked;
+    struct msghdr           rxMsg;                  /**< template of the multishot receive                  */
+    VOS_URING_SLOT_T        slot[VOS_MAX_SOCKET_CNT];
+    struct msghdr           txMsg[VOS_URING_TX_ENTRIES];
+    struct iovec            txIov[VOS_URING_TX_ENTRIES];
+    struct sockaddr_in      txAddr[VOS_URING_TX_ENTRIES];
+    UINT32                  txPending;              /**< queued, not yet submitted                          */
+    VOS_URING_STATS_T       stats;
+};
+
+/***********************************************************************************************************************
+ * LOCALS
+ */
+
+static struct VOS_URING *sUringList = NULL;
+static pthread_mutex_t  sUringListMutex = PTHREAD_MUTEX_INITIALIZER;
+
+/***********************************************************************************************************************
+ * LOCAL FUNCTIONS
+ */
+
+static INLINE int vos_uringEnter (
+    VOS_URING_QUEUE_T   *pQueue,
+    UINT32              toSubmit,
+    UINT32              minComplete,
+    UINT32              flags)
+{
+    return (int) syscall(__NR_io_uring_enter, pQueue->fd, toSubmit, minComplete, flags, NULL, 0);
+}
+
+/**********************************************************************************************************************/
+/** Create a submission and completion queue pair and map it
+ *
+ *  @param[out]     pQueue          queue pair
+ *  @param[in]      sqEntries       entries of the submission queue
+ *  @param[in]      cqEntries       entries of the completion queue
+ *
+ *  @retval         VOS_NO_ERR      no error
+ *  @retval         VOS_SOCK_ERR    io_uring not available
+ */
+static VOS_ERR_T vos_uringQueueOpen (
+    VOS_URING_QUEUE_T   *pQueue,
+    UINT32              sqEntries,
+    UINT32              cqEntries)
+{
+    struct io_uring_params  params;
+    UINT8                   *pMap;
+    size_t                  sqSize;
+    size_t                  cqSize;
+    UINT32                  i;
+
+    memset(&params, 0, sizeof(params));
+    params.flags        = IORING_SETUP_CQSIZE;
+    params.cq_entries   = cqEntries;
+    pQueue->fd = (int) syscall(__NR_io_uring_setup, sqEntries, &params);
+    if (pQueue->fd < 0)
+    {
+        vos_printLog(VOS_LOG_WARNING, "io_uring not available (Err: %d)\n", errno);
+        return VOS_SOCK_ERR;
+    }
+    if (!(params.features & IORING_FEAT_SINGLE_MMAP) || !(params.features & IORING_FEAT_NODROP))
+    {
+        vos_printLogStr(VOS_LOG_WARNING, "io_uring too old\n");
+        return VOS_SOCK_ERR;
+    }
+
+    sqSize  = params.sq_off.array + params.sq_entries * sizeof(UINT32);
+    cqSize  = params.cq_off.cqes + params.cq_entries * sizeof(struct io_uring_cqe);
+    pQueue->mapSize = (sqSize > cqSize) ? sqSize : cqSize;
+    pMap = (UINT8 *) mmap(NULL, pQueue->mapSize, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE,
+                          pQueue->fd, IORING_OFF_SQ_RING);
+    if (pMap == MAP_FAILED)
+    {
+        return VOS_SOCK_ERR;
+    }
+    pQueue->pMap        = pMap;
+    pQueue->sqesSize    = params.sq_entries * sizeof(struct io_uring_sqe);
+    pQueue->pSqes       = (struct io_uring_sqe *) mmap(NULL, pQueue->sqesSize, PROT_READ | PROT_WRITE,
+                                                       MAP_SHARED | MAP_POPULATE, pQueue->fd, IORING_OFF_SQES);
+    if (pQueue->pSqes == MAP_FAILED)
+    {
+        pQueue->pSqes = NULL;
+        return VOS_SOCK_ERR;
+    }
+    pQueue->pSqHead     = (UINT32 *) (pMap + params.sq_off.head);
+    pQueue->pSqTail     = (UINT32 *) (pMap + params.sq_off.tail);
+    pQueue->pSqFlags    = (UINT32 *) (pMap + params.sq_off.flags);
+    pQueue->sqMask      = *(UINT32 *) (pMap + params.sq_off.ring_mask);
+    pQueue->pSqArray    = (UINT32 *) (pMap + params.sq_off.array);
+    pQueue->pCqHead     = (UINT32 *) (pMap + params.cq_off.head);
+    pQueue->pCqTail     = (UINT32 *) (pMap + params.cq_off.tail);
+    pQueue->cqMask      = *(UINT32 *) (pMap + params.cq_off.ring_mask);
+    pQueue->pCqes       = (struct io_uring_cqe *) (pMap + params.cq_off.cqes);
+
+    /*  Submission queue entries are used in ring order */
+    for (i = 0u; i <= pQueue->sqMask; i++)
+    {
+        pQueue->pSqArray[i] = i;
+    }
+    return VOS_NO_ERR;
+}
+
+/**********************************************************************************************************************/
+/** Unmap and close a queue pair
+ *
+ *  @param[in]      pQueue          queue pair
+ */
+static void vos_uringQueueClose (
+    VOS_URING_QUEUE_T *pQueue)
+{
+    if (pQueue->pSqes != NULL)
+    {
+        (void) munmap(pQueue->pSqes, pQueue->sqesSize);
+    }
+    if (pQueue->pMap != NULL)
+    {
+        (void) munmap(pQueue->pMap, pQueue->mapSize);
+    }
+    if (pQueue->fd >= 0)
+    {
+        (void) close(pQueue->fd);
+    }
+}
+
+/**********************************************************************************************************************/
+/** Get the next free submission queue entry, it is handed to the kernel by vos_uringQueueCommit()
+ *
+ *  @param[in]      pQueue          queue pair
+ *  @retval         cleared entry or NULL if the submission queue is full
+ */
+static struct io_uring_sqe *vos_uringQueueGet (
+    VOS_URING_QUEUE_T *pQueue)
+{
+    UINT32              tail = *pQueue->pSqTail;
+    struct io_uring_sqe *pSqe;
+
+    if ((tail - __atomic_load_n(pQueue->pSqHead, __ATOMIC_ACQUIRE)) > pQueue->sqMask)
+    {
+        return NULL;
+    }
+    pSqe = &pQueue->pSqes[tail & pQueue->sqMask];
+    memset(pSqe, 0, sizeof(*pSqe));
+    return pSqe;
+}
+
+static INLINE void vos_uringQueueCommit (
+    VOS_URING_QUEUE_T *pQueue)
+{
+    __atomic_store_n(pQueue->pSqTail, *pQueue->pSqTail + 1u, __ATOMIC_RELEASE);
+}
+
+/**********************************************************************************************************************/
+/** Hand buffers to the kernel for receiving
+ *
+ *  @param[in]      ring            ring handle
+ *  @param[in]      pBids           buffer ids
+ *  @param[in]      noOfBids        number of buffers
+ */
+static void vos_uringProvide (
+    VOS_URING_T     ring,
+    const UINT16    *pBids,
+    UINT32          noOfBids)
+{
+    UINT16  tail = ring->pBufRing->tail;
+    UINT32  mask = ring->noOfBufs - 1u;
+    UINT32  i;
+
+    for (i = 0u; i < noOfBids; i++)
+    {
+        /* Only address, length and id, the tail shares its place with 'resv' of the first entry */
+        struct io_uring_buf *pBuf = &ring->pBufRing->bufs[(tail + i) & mask];
+
+        pBuf->addr  = (UINT64) (uintptr_t) (ring->pBufs + (size_t) pBids[i] * VOS_URING_BUF_SIZE);
+        pBuf->len   = VOS_URING_BUF_SIZE;
+        pBuf->bid   = pBids[i];
+    }
+    __atomic_store_n(&ring->pBufRing->tail, (UINT16) (tail + noOfBids), __ATOMIC_RELEASE);
+}
+
+/**********************************************************************************************************************/
+/** Submit the multishot receive of a socket slot
+ *
+ *  @param[in]      ring            ring handle, receive mutex locked
+ *  @param[in]      idx             slot
+ *
+ *  @retval         VOS_NO_ERR      no error
+ *  @retval         VOS_SOCK_ERR    receive could not be submitted
+ */
+static VOS_ERR_T vos_uringSubmitRecv (
+    VOS_URING_T ring,
+    UINT32      idx)
+{
+    struct io_uring_sqe *pSqe = vos_uringQueueGet(&ring->rx);
+
+    if (pSqe == NULL)
+    {
+        return VOS_SOCK_ERR;
+    }
+    pSqe->opcode    = IORING_OP_RECVMSG;
+    pSqe->fd        = ring->slot[idx].sock;
+    pSqe->addr      = (UINT64) (uintptr_t) &ring->rxMsg;
+    pSqe->len       = 1u;
+    pSqe->ioprio    = IORING_RECV_MULTISHOT;
+    pSqe->flags     = IOSQE_BUFFER_SELECT;
+    pSqe->buf_group = VOS_URING_BGID;
+    pSqe->user_data = ((UINT64) ring->slot[idx].gen << 32u) | idx;
+    vos_uringQueueCommit(&ring->rx);
+
+    ring->stats.numEnter++;
+    if (vos_uringEnter(&ring->rx, 1u, 0u, 0u) != 1)
+    {
+        vos_printLog(VOS_LOG_WARNING, "io_uring receive on socket %d not submitted (Err: %d)\n",
+                     (int) ring->slot[idx].sock, errno);
+        return VOS_SOCK_ERR;
+    }
+    ring->slot[idx].armed = TRUE;
+    ring->stats.numArmed++;
+    return VOS_NO_ERR;
+}
+
+/**********************************************************************************************************************/
+/** Get source and destination address and the arrival time of a received datagram
+ *
+ *  @param[in]      pOut            start of the receive buffer
+ *  @param[out]     pFrame          datagram
+ */
+static void vos_uringParse (
+    const struct io_uring_recvmsg_out   *pOut,
+    VOS_URING_FRAME_T                   *pFrame)
+{
+    const struct sockaddr_in    *pName  = (const struct sockaddr_in *) (pOut + 1);
+    struct msghdr               msg;
+    struct cmsghdr              *cmsg;
+
+    pFrame->srcIpAddr   = (VOS_IP4_ADDR_T) vos_ntohl(pName->sin_addr.s_addr);
+    pFrame->srcPort     = (UINT16) vos_ntohs(pName->sin_port);
+    pFrame->dstIpAddr   = 0u;
+    vos_getTime(&pFrame->rxTime);
+
+    /*  The control data as a message header to walk over it  */
+    memset(&msg, 0, sizeof(msg));
+    msg.msg_control     = (UINT8 *) (pOut + 1) + sizeof(struct sockaddr_in);
+    msg.msg_controllen  = pOut->controllen;
+    for (cmsg = CMSG_FIRSTHDR(&msg); cmsg != NULL; cmsg = CMSG_NXTHDR(&msg, cmsg))
+    {
+        if ((cmsg->cmsg_level == SOL_IP) && (cmsg->cmsg_type == IP_PKTINFO))
+        {
+            const struct in_pktinfo *pia = (const struct in_pktinfo *) CMSG_DATA(cmsg);
+            pFrame->dstIpAddr = (VOS_IP4_ADDR_T) vos_ntohl(pia->ipi_addr.s_addr);
+        }
+#ifdef VOS_URING_RXSTAMP
+        else if ((cmsg->cmsg_level == SOL_SOCKET) && (cmsg->cmsg_type == SCM_TIMESTAMPING))
+        {
+            const struct scm_timestamping *pStamps = (const struct scm_timestamping *) CMSG_DATA(cmsg);
+
+            /* Prefer the hardware stamp, fall back to the software stamp */
+            if ((pStamps->ts[2].tv_sec != 0) || (pStamps->ts[2].tv_nsec != 0))
+            {
+                vos_sockStampToTime(&pStamps->ts[2], CLOCK_TAI, &pFrame->rxTime);
+            }
+            else if ((pStamps->ts[0].tv_sec != 0) || (pStamps->ts[0].tv_nsec != 0))
+            {
+                vos_sockStampToTime(&pStamps->ts[0], CLOCK_REALTIME, &pFrame->rxTime);
+            }
+        }
+#endif
+    }
+}
+
+/***********************************************************************************************************************
+ * GLOBAL FUNCTIONS
+ */
+
+/**********************************************************************************************************************/
+/** Open an io_uring I/O engine.
+ *  Creates the receive and the send ring and registers the receive buffers as provided buffer ring.
+ *
+ *  @param[out]     pRing           pointer to the ring handle returned
+ *  @param[in]      noOfBufs        number of receive buffers, rounded up to a power of 2
+ *
+ *  @retval         VOS_NO_ERR      no error
+ *  @retval         VOS_PARAM_ERR   parameter error
+ *  @retval         VOS_MEM_ERR     out of memory
+ *  @retval         VOS_SOCK_ERR    io_uring, provided buffer rings or multishot receive not available
+ */
+EXT_DECL VOS_ERR_T vos_uringOpen (
+    VOS_URING_T *pRing,
+    UINT32      noOfBufs)
+{
+    struct VOS_URING        *pNew;
+    struct io_uring_buf_reg reg;
+    struct io_uring_probe   *pProbe;
+    size_t                  probeSize;
+    VOS_ERR_T               err = VOS_SOCK_ERR;
+    UINT32                  n;
+    UINT32                  i;
+
+    if ((pRing == NULL) || (noOfBufs == 0u) || (noOfBufs > VOS_URING_MAX_BUFS))
+    {
+        return VOS_PARAM_ERR;
+    }
+    *pRing = NULL;
+    for (n = 1u; n < noOfBufs; n <<= 1u)
+    {
+        ;
+    }
+
+    pNew = (struct VOS_URING *) vos_memAlloc(sizeof(struct VOS_URING));
+    if (pNew == NULL)
+    {
+        return VOS_MEM_ERR;
+    }
+    pNew->rx.fd     = -1;
+    pNew->tx.fd     = -1;
+    pNew->noOfBufs  = n;
+    if (vos_mutexLocalCreate(&pNew->rxMutex) != VOS_NO_ERR)
+    {
+        vos_memFree(pNew);
+        return VOS_MUTEX_ERR;
+    }
+
+    /*  Room for more completions than buffers (cancelled receives, ended receives) */
+    if ((vos_uringQueueOpen(&pNew->rx, VOS_URING_RX_ENTRIES,
+                            2u * ((n > VOS_URING_RX_ENTRIES) ? n : VOS_URING_RX_ENTRIES)) != VOS_NO_ERR) ||
+        (vos_uringQueueOpen(&pNew->tx, VOS_URING_TX_ENTRIES, 2u * VOS_URING_TX_ENTRIES) != VOS_NO_ERR))
+    {
+        goto fail;
+    }
+
+    /*  Multishot recvmsg came with Linux 6.0, as IORING_OP_SEND_ZC did  */
+    probeSize   = sizeof(struct io_uring_probe) + IORING_OP_LAST * sizeof(struct io_uring_probe_op);
+    pProbe      = (struct io_uring_probe *) vos_memAlloc((UINT32) probeSize);
+    if (pProbe == NULL)
+    {
+        err = VOS_MEM_ERR;
+        goto fail;
+    }
+    if ((syscall(__NR_io_uring_register, pNew->rx.fd, IORING_REGISTER_PROBE, pProbe, IORING_OP_LAST) != 0) ||
+        (pProbe->last_op < IORING_OP_SEND_ZC) ||
+        !(pProbe->ops[IORING_OP_RECVMSG].flags & IO_URING_OP_SUPPORTED) ||
+        !(pProbe->ops[IORING_OP_SENDMSG].flags & IO_URING_OP_SUPPORTED))
+    {
+        vos_memFree(pProbe);
+        vos_printLogStr(VOS_LOG_WARNING, "io_uring without multishot receive (Linux 6.0 needed)\n");
+        goto fail;
+    }
+    vos_memFree(pProbe);
+
+    /*  Receive buffers and the ring announcing them to the kernel */
+    pNew->bufRingSize   = n * sizeof(struct io_uring_buf);
+    pNew->pBufRing      = (struct io_uring_buf_ring *) mmap(NULL, pNew->bufRingSize, PROT_READ | PROT_WRITE,
+                                                            MAP_PRIVATE | MAP_ANONYMOUS | MAP_POPULATE, -1, 0);
+    pNew->pBufs         = (UINT8 *) mmap(NULL, (size_t) n * VOS_URING_BUF_SIZE, PROT_READ | PROT_WRITE,
+                                         MAP_PRIVATE | MAP_ANONYMOUS | MAP_POPULATE, -1, 0);
+    pNew->pPeeked       = (UINT16 *) vos_memAlloc(n * sizeof(UINT16));
+    if ((pNew->pBufRing == MAP_FAILED) || (pNew->pBufs == MAP_FAILED) || (pNew->pPeeked == NULL))
+    {
+        pNew->pBufRing  = (pNew->pBufRing == MAP_FAILED) ? NULL : pNew->pBufRing;
+        pNew->pBufs     = (pNew->pBufs == MAP_FAILED) ? NULL : pNew->pBufs;
+        err = VOS_MEM_ERR;
+        goto fail;
+    }
+    memset(&reg, 0, sizeof(reg));
+    reg.ring_addr       = (UINT64) (uintptr_t) pNew->pBufRing;
+    reg.ring_entries    = n;
+    reg.bgid            = VOS_URING_BGID;
+    if (syscall(__NR_io_uring_register, pNew->rx.fd, IORING_REGISTER_PBUF_RING, &reg, 1) != 0)
+    {
+        vos_printLog(VOS_LOG_WARNING, "io_uring provided buffer ring not available (Err: %d)\n", errno);
+        goto fail;
+    }
+    for (i = 0u; i < n; i++)
+    {
+        pNew->pPeeked[i] = (UINT16) i;
+    }
+    vos_uringProvide(pNew, pNew->pPeeked, n);
+
+    /*  Each buffer receives the source address and the control data in front of the datagram   */
+    pNew->rxMsg.msg_namelen     = sizeof(struct sockaddr_in);
+    pNew->rxMsg.msg_controllen  = VOS_URING_CONTROL_SIZE;
+
+    (void) pthread_mutex_lock(&sUringListMutex);
+    pNew->pNext = sUringList;
+    sUringList  = pNew;
+    (void) pthread_mutex_unlock(&sUringListMutex);
+
+    vos_printLog(VOS_LOG_INFO, "io_uring with %u receive buffers\n", (unsigned int) n);
+    *pRing = pNew;
+    return VOS_NO_ERR;
+
+fail:
+    vos_uringClose(pNew);
+    return err;
+}
+
+/**********************************************************************************************************************/
+/** Close an io_uring I/O engine, pending receives are cancelled by closing the rings
+ *
+ *  @param[in]      ring            ring handle
+ */
+EXT_DECL void vos_uringClose (
+    VOS_URING_T ring)
+{
+    struct VOS_URING **ppIter;
+
+    if (ring == NULL)
+    {
+        return;
+    }
+    (void) pthread_mutex_lock(&sUringListMutex);
+    for (ppIter = &sUringList; *ppIter != NULL; ppIter = &(*ppIter)->pNext)
+    {
+        if (*ppIter == ring)
+        {
+            *ppIter = ring->pNext;
+            break;
+        }
+    }
+    (void) pthread_mutex_unlock(&sUringListMutex);
+
+    vos_uringQueueClose(&ring->rx);
+    vos_uringQueueClose(&ring->tx);
+    if (ring->pBufRing != NULL)
+    {
+        (void) munmap(ring->pBufRing, ring->bufRingSize);
+    }
+    if (ring->pBufs != NULL)
+    {
+        (void) munmap(ring->pBufs, (size_t) ring->noOfBufs * VOS_URING_BUF_SIZE);
+    }
+    if (ring->pPeeked != NULL)
+    {
+        vos_memFree(ring->pPeeked);
+    }
+    vos_mutexLocalDelete(&ring->rxMutex);
+    vos_memFree(ring);
+}
+
+/**********************************************************************************************************************/
+/** Descriptor of the receive ring, readable if there are completions.
+ *  The completions are posted in the context of the thread which armed the receive (vos_uringArm()), it should be
+ *  the thread waiting for the descriptor.
+ *
+ *  @param[in]      ring            ring handle
+ *  @retval         descriptor
+ */
+EXT_DECL SOCKET vos_uringSocket (
+    VOS_URING_T ring)
+{
+    return (ring != NULL) ? ring->rx.fd : VOS_INVALID_SOCKET;
+}
+
+/**********************************************************************************************************************/
+/** Receive a UDP socket's datagrams with the ring.
+ *  Arms a multishot receive for the socket if there is none, again if the kernel ended it (out of buffers).
+ *  The socket must have been set up with vos_sockSetOptions() (destination address, timestamps).
+ *
+ *  @param[in]      ring            ring handle
+ *  @param[in]      sock            UDP socket
+ *
+ *  @retval         VOS_NO_ERR      datagrams of the socket arrive at the ring
+ *  @retval         VOS_PARAM_ERR   parameter error
+ *  @retval         VOS_QUEUE_FULL_ERR  too many sockets
+ *  @retval         VOS_SOCK_ERR    receive could not be armed, use the socket itself
+ */
+EXT_DECL VOS_ERR_T vos_uringArm (
+    VOS_URING_T ring,
+    SOCKET      sock)
+{
+    VOS_ERR_T   err     = VOS_QUEUE_FULL_ERR;
+    UINT32      idx;
+    UINT32      freeIdx = VOS_MAX_SOCKET_CNT;
+
+    if ((ring == NULL) || (sock == VOS_INVALID_SOCKET))
+    {
+        return VOS_PARAM_ERR;
+    }
+    (void) pthread_mutex_lock(&ring->rxMutex.mutexId);
+    for (idx = 0u; idx < VOS_MAX_SOCKET_CNT; idx++)
+    {
+        if ((ring->slot[idx].used == TRUE) && (ring->slot[idx].sock == sock))
+        {
+            break;
+        }
+        if ((ring->slot[idx].used == FALSE) && (freeIdx == VOS_MAX_SOCKET_CNT))
+        {
+            freeIdx = idx;
+        }
+    }
+    if ((idx < VOS_MAX_SOCKET_CNT) && (ring->slot[idx].armed == TRUE))
+    {
+        (void) pthread_mutex_unlock(&ring->rxMutex.mutexId);
+        return VOS_NO_ERR;
+    }
+    if (idx == VOS_MAX_SOCKET_CNT)
+    {
+        idx = freeIdx;
+        if (idx < VOS_MAX_SOCKET_CNT)
+        {
+            ring->slot[idx].used    = TRUE;
+            ring->slot[idx].sock    = sock;
+            ring->slot[idx].gen++;
+        }
+    }
+    if (idx < VOS_MAX_SOCKET_CNT)
+    {
+        err = vos_uringSubmitRecv(ring, idx);
+        if (err != VOS_NO_ERR)
+        {
+            ring->slot[idx].used = FALSE;
+        }
+    }
+    (void) pthread_mutex_unlock(&ring->rxMutex.mutexId);
+    return err;
+}
+
+/**********************************************************************************************************************/
+/** Get received UDP datagrams without copying them.
+ *  The payloads stay valid in the receive buffers until vos_uringRelease() is called, truncated datagrams are
+ *  returned with pData == NULL.
+ *
+ *  @param[in]      ring            ring handle
+ *  @param[out]     pFrame          received datagrams
+ *  @param[in,out]  pNoOfFrames     In: max. number of datagrams, Out: number of datagrams received
+ *
+ *  @retval         VOS_NO_ERR      at least one datagram was received
+ *  @retval         VOS_PARAM_ERR   parameter error or datagrams not released
+ *  @retval         VOS_NODATA_ERR  nothing received
+ */
+EXT_DECL VOS_ERR_T vos_uringReceive (
+    VOS_URING_T         ring,
+    VOS_URING_FRAME_T   *pFrame,
+    UINT32              *pNoOfFrames)
+{
+    UINT32  head;
+    UINT32  tail;
+    UINT32  n = 0u;
+
+    if ((ring == NULL) || (pFrame == NULL) || (pNoOfFrames == NULL) || (ring->noOfPeeked != 0u))
+    {
+        return VOS_PARAM_ERR;
+    }
+
+    /*  Completions the queue had no room for are moved in by entering the kernel   */
+    if (__atomic_load_n(ring->rx.pSqFlags, __ATOMIC_RELAXED) & IORING_SQ_CQ_OVERFLOW)
+    {
+        ring->stats.numEnter++;
+        (void) vos_uringEnter(&ring->rx, 0u, 0u, IORING_ENTER_GETEVENTS);
+    }
+
+    head    = *ring->rx.pCqHead;
+    tail    = __atomic_load_n(ring->rx.pCqTail, __ATOMIC_ACQUIRE);
+    for (; (head != tail) && (n < *pNoOfFrames); head++)
+    {
+        const struct io_uring_cqe *pCqe = &ring->rx.pCqes[head & ring->rx.cqMask];
+        UINT32  idx = (UINT32) (pCqe->user_data & 0xFFFFFFFFu);
+        BOOL8   current;
+
+        if (pCqe->user_data == VOS_URING_CANCEL_TAG)
+        {
+            continue;
+        }
+        current = (idx < VOS_MAX_SOCKET_CNT) && (ring->slot[idx].used == TRUE) &&
+            (ring->slot[idx].gen == (UINT32) (pCqe->user_data >> 32u));
+        if (!(pCqe->flags & IORING_CQE_F_MORE) && (current == TRUE))
+        {
+            /*  The kernel ended the receive (mostly out of buffers), it is armed again by vos_uringArm()  */
+            (void) pthread_mutex_lock(&ring->rxMutex.mutexId);
+            ring->slot[idx].armed = FALSE;
+            (void) pthread_mutex_unlock(&ring->rxMutex.mutexId);
+            if (pCqe->res == -ENOBUFS)
+            {
+                ring->stats.numNoBuf++;
+            }
+            else if (pCqe->res < 0)
+            {
+                vos_printLog(VOS_LOG_WARNING, "io_uring receive on socket %d ended (Err: %d)\n",
+                             (int) ring->slot[idx].sock, -pCqe->res);
+            }
+        }
+        if (pCqe->flags & IORING_CQE_F_BUFFER)
+        {
+            UINT16 bid = (UINT16) (pCqe->flags >> IORING_CQE_BUFFER_SHIFT);
+            const struct io_uring_recvmsg_out *pOut =
+                (const struct io_uring_recvmsg_out *) (ring->pBufs + (size_t) bid * VOS_URING_BUF_SIZE);
+
+            ring->pPeeked[ring->noOfPeeked++] = bid;
+            if ((pCqe->res < 0) || (current == FALSE))
+            {
+                continue;                       /* datagram of a socket closed meanwhile */
+            }
+            vos_uringParse(pOut, &pFrame[n]);
+            if ((pOut->flags & MSG_TRUNC) || (pOut->payloadlen > VOS_URING_BUF_SIZE - VOS_URING_HDR_SIZE))
+            {
+                pFrame[n].pData = NULL;
+                pFrame[n].size  = 0u;
+                ring->stats.numRxInvalid++;
+            }
+            else
+            {
+                pFrame[n].pData = (UINT8 *) pOut + VOS_URING_HDR_SIZE;
+                pFrame[n].size  = pOut->payloadlen;
+            }
+            ring->stats.numRx++;
+            n++;
+        }
+    }
+    __atomic_store_n(ring->rx.pCqHead, head, __ATOMIC_RELEASE);
+
+    *pNoOfFrames = n;
+    return (n > 0u) ? VOS_NO_ERR : VOS_NODATA_ERR;
+}
+
+/**********************************************************************************************************************/
+/** Give the buffers of the last vos_uringReceive() back to the kernel
+ *
+ *  @param[in]      ring            ring handle
+ */
+EXT_DECL void vos_uringRelease (
+    VOS_URING_T ring)
+{
+    if ((ring == NULL) || (ring->noOfPeeked == 0u))
+    {
+        return;
+    }
+    vos_uringProvide(ring, ring->pPeeked, ring->noOfPeeked);
+    ring->noOfPeeked = 0u;
+}
+
+/**********************************************************************************************************************/
+/** Queue a UDP datagram for sending.
+ *  The buffer must not change until vos_uringFlush() returned. If the send queue is full, it is flushed first.
+ *
+ *  @param[in]      ring            ring handle
+ *  @param[in]      sock            UDP socket to send with
+ *  @param[in]      pBuffer         datagram
+ *  @param[in]      size            size of the datagram
+ *  @param[in]      ipAddress       destination IP address
+ *  @param[in]      port            destination port
+ *
+ *  @retval         VOS_NO_ERR      datagram queued
+ *  @retval         VOS_PARAM_ERR   parameter error
+ *  @retval         VOS_IO_ERR      send queue full
+ */
+EXT_DECL VOS_ERR_T vos_uringSendUDP (
+    VOS_URING_T     ring,
+    SOCKET          sock,
+    const UINT8     *pBuffer,
+    UINT32          size,
+    VOS_IP4_ADDR_T  ipAddress,
+    UINT16          port)
+{
+    struct io_uring_sqe *pSqe;
+    UINT32              idx;
+
+    if ((ring == NULL) || (sock == VOS_INVALID_SOCKET) || (pBuffer == NULL))
+    {
+        return VOS_PARAM_ERR;
+    }
+    if (ring->txPending > ring->tx.sqMask)
+    {
+        vos_uringFlush(ring);
+    }
+    pSqe = vos_uringQueueGet(&ring->tx);
+    if (pSqe == NULL)
+    {
+        return VOS_IO_ERR;
+    }
+    idx = *ring->tx.pSqTail & ring->tx.sqMask;
+
+    memset(&ring->txAddr[idx], 0, sizeof(ring->txAddr[idx]));
+    ring->txAddr[idx].sin_family        = AF_INET;
+    ring->txAddr[idx].sin_addr.s_addr   = vos_htonl(ipAddress);
+    ring->txAddr[idx].sin_port          = vos_htons(port);
+    ring->txIov[idx].iov_base           = (void *) pBuffer;
+    ring->txIov[idx].iov_len            = size;
+    memset(&ring->txMsg[idx], 0, sizeof(ring->txMsg[idx]));
+    ring->txMsg[idx].msg_name           = &ring->txAddr[idx];
+    ring->txMsg[idx].msg_namelen        = sizeof(ring->txAddr[idx]);
+    ring->txMsg[idx].msg_iov            = &ring->txIov[idx];
+    ring->txMsg[idx].msg_iovlen         = 1;
+
+    pSqe->opcode    = IORING_OP_SENDMSG;
+    pSqe->fd        = sock;
+    pSqe->addr      = (UINT64) (uintptr_t) &ring->txMsg[idx];
+    pSqe->len       = 1u;
+    pSqe->user_data = idx;
+    vos_uringQueueCommit(&ring->tx);
+    ring->txPending++;
+    return VOS_NO_ERR;
+}
+
+/**********************************************************************************************************************/
+/** Send the queued datagrams with one call and wait until the kernel is done with them
+ *
+ *  @param[in]      ring            ring handle
+ */
+EXT_DECL void vos_uringFlush (
+    VOS_URING_T ring)
+{
+    UINT32  done = 0u;
+    UINT32  head;
+    UINT32  tail;
+
+    if ((ring == NULL) || (ring->txPending == 0u))
+    {
+        return;
+    }
+    while (done < ring->txPending)
+    {
+        int rc;
+
+        /*  UDP sends complete inline, mostly the first call returns with all completions  */
+        ring->stats.numEnter++;
+        rc = vos_uringEnter(&ring->tx, ring->txPending - done, ring->txPending - done, IORING_ENTER_GETEVENTS);
+        if ((rc < 0) && (errno != EINTR))
+        {
+            vos_printLog(VOS_LOG_WARNING, "io_uring send failed (Err: %d)\n", errno);
+            break;
+        }
+        head    = *ring->tx.pCqHead;
+        tail    = __atomic_load_n(ring->tx.pCqTail, __ATOMIC_ACQUIRE);
+        for (; head != tail; head++)
+        {
+            if (ring->tx.pCqes[head & ring->tx.cqMask].res < 0)
+            {
+                ring->stats.numTxErr++;
+            }
+            else
+            {
+                ring->stats.numTx++;
+            }
+            done++;
+        }
+        __atomic_store_n(ring->tx.pCqHead, head, __ATOMIC_RELEASE);
+    }
+    ring->txPending = 0u;
+}
+
+/**********************************************************************************************************************/
+/** Statistics of an io_uring I/O engine
+ *
+ *  @param[in]      ring            ring handle
+ *  @param[out]     pStats          statistics
+ */
+EXT_DECL void vos_uringGetStatistics (
+    VOS_URING_T         ring,
+    VOS_URING_STATS_T   *pStats)
+{
+    if ((ring != NULL) && (pStats != NULL))
+    {
+        *pStats = ring->stats;
+    }
+}
+
+/**********************************************************************************************************************/
+/** Cancel the receives of the rings on a socket about to be closed.
+ *  A pending receive holds a reference to the socket, it would stay open (and bound) otherwise.
+ *
+ *  @param[in]      sock            socket descriptor
+ */
+void vos_uringCancelSocket (
+    SOCKET sock)
+{
+    struct VOS_URING *pIter;
+
+    (void) pthread_mutex_lock(&sUringListMutex);
+    for (pIter = sUringList; pIter != NULL; pIter = pIter->pNext)
+    {
+        UINT32 idx;
+
+        (void) pthread_mutex_lock(&pIter->rxMutex.mutexId);
+        for (idx = 0u; idx < VOS_MAX_SOCKET_CNT; idx++)
+        {
+            if ((pIter->slot[idx].used == TRUE) && (pIter->slot[idx].sock == sock))
+            {
+                struct io_uring_sqe *pSqe = vos_uringQueueGet(&pIter->rx);
+
+                if (pSqe != NULL)
+                {
+                    pSqe->opcode    = IORING_OP_ASYNC_CANCEL;
+                    pSqe->fd        = -1;
+                    pSqe->addr      = ((UINT64) pIter->slot[idx].gen << 32u) | idx;
+                    pSqe->user_data = VOS_URING_CANCEL_TAG;
+                    vos_uringQueueCommit(&pIter->rx);
+                    pIter->stats.numEnter++;
+                    (void) vos_uringEnter(&pIter->rx, 1u, 0u, 0u);
+                }
+                pIter->slot[idx].used   = FALSE;
+                pIter->slot[idx].armed  = FALSE;
+            }
+        }
+        (void) pthread_mutex_unlock(&pIter->rxMutex.mutexId);
+    }
+    (void) pthread_mutex_unlock(&sUringListMutex);
+}
+
+#endif
@@ -0,0 +1,950 @@
+/**********************************************************************************************************************/
+/**
+ * @file            posix/vos_sockXDP.c
+ *
+ * @brief           AF_XDP socket functions
+ *
+ * @details         OS abstraction of a kernel bypass socket (Linux AF_XDP) for PD traffic.
+ *                  An XDP program redirects the IPv4/UDP frames for the PD port arriving on one queue of an interface
+ *                  into the UMEM of the socket, all other frames are passed to the kernel. Frames to send are built
+ *                  (Ethernet, IP and UDP header) in UMEM and posted to the TX ring.
+ *                  The socket is bound in zero copy mode if the driver supports it, else in copy mode; the XDP
+ *                  program is attached in driver mode if possible, else in generic (skb) mode. Any interface, a veth
+ *                  pair as well, can be used.
+ *
+ * @note            Project: TCNOpen TRDP prototype stack
+ *
+ * @author          agent
+ *
+ * @remarks This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0.
+ *          If a copy of the MPL was not distributed with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ *          Copyright agent, 2026. All rights reserved.
+ */
+/*
+* $Id$
+*
+*      AG 2026-10-19: AF_XDP socket for PD (kernel bypass)
+*
+*/
+
+#ifndef XDP_SUPPORT
+#error \
+    "You are trying to add AF_XDP support to vos_sock.c - either define XDP_SUPPORT or exclude this file!"
+#else
+
+/***********************************************************************************************************************
+ * INCLUDES
+ */
+
+#include <stdio.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <unistd.h>
+#include <errno.h>
+#include <string.h>
+#include <sys/socket.h>
+#include <sys/ioctl.h>
+#include <sys/mman.h>
+#include <sys/syscall.h>
+#include <net/if.h>
+#include <net/if_arp.h>
+#include <netinet/in.h>
+#include <arpa/inet.h>
+
+#include <linux/if_xdp.h>
+#include <linux/if_link.h>
+#include <linux/bpf.h>
+
+#include "vos_utils.h"
+#include "vos_sock.h"
+#include "vos_thread.h"
+#include "vos_mem.h"
+#include "vos_private.h"
+
+/***********************************************************************************************************************
+ * DEFINITIONS
+ */
+
+#define VOS_XSK_FRAME_SIZE      2048u               /**< size of an UMEM frame                              */
+#define VOS_XSK_NUM_FRAMES      4096u               /**< UMEM frames, half of them for receiving            */
+#define VOS_XSK_RING_SIZE       2048u               /**< entries of each ring                               */
+#define VOS_XSK_NUM_NEIGH       32u                 /**< cached destination MAC addresses                   */
+#define VOS_XSK_NEIGH_TIMEOUT   1u                  /**< seconds a cached MAC address is used               */
+#define VOS_XSK_MAX_KICKS       64u                 /**< max. send calls to flush the TX ring               */
+
+#define VOS_ETH_HDR_SIZE        14u
+#define VOS_IP_HDR_SIZE         20u
+#define VOS_UDP_HDR_SIZE        8u
+#define VOS_XSK_HDR_SIZE        (VOS_ETH_HDR_SIZE + VOS_IP_HDR_SIZE + VOS_UDP_HDR_SIZE)
+
+/** One of the four rings shared with the kernel */
+typedef struct
+{
+    UINT32  *pProducer;
+    UINT32  *pConsumer;
+    void    *pDesc;
+    UINT32  mask;
+    void    *pMap;
+    size_t  mapSize;
+} VOS_XSK_RING_T;
+
+/** Cached destination MAC address */
+typedef struct
+{
+    VOS_IP4_ADDR_T  ipAddr;
+    UINT8           mac[VOS_MAC_SIZE];
+    VOS_TIMEVAL_T   validUntil;
+} VOS_XSK_NEIGH_T;
+
+/** AF_XDP socket */
+struct VOS_XSK
+{
+    int                 fd;                         /**< AF_XDP socket                                      */
+    int                 ctlFd;                      /**< INET socket for ioctls (neighbour lookup)          */
+    int                 mapFd;                      /**< XSKMAP                                             */
+    int                 progFd;                     /**< XDP program                                        */
+    int                 linkFd;                     /**< attachment of the XDP program to the interface     */
+    CHAR8               ifName[IFNAMSIZ];
+    UINT32              ifIndex;
+    UINT32              queueId;
+    UINT16              port;
+    VOS_IP4_ADDR_T      ifAddr;
+    VOS_IP4_ADDR_T      ifMask;
+    UINT8               ifMac[VOS_MAC_SIZE];
+    UINT8               *pUmem;
+    VOS_XSK_RING_T      rx;
+    VOS_XSK_RING_T      tx;
+    VOS_XSK_RING_T      fill;
+    VOS_XSK_RING_T      comp;
+    UINT64              txFree[VOS_XSK_NUM_FRAMES / 2u];    /**< free TX frames (stack)                     */
+    UINT32              noOfTxFree;
+    UINT32              noOfPeeked;                 /**< RX descriptors handed out by vos_xskReceive        */
+    UINT32              txPending;                  /**< TX descriptors not yet kicked                      */
+    UINT16              ipId;
+    VOS_XSK_NEIGH_T     neigh[VOS_XSK_NUM_NEIGH];
+    UINT32              nextNeigh;
+    VOS_XSK_STATS_T     stats;
+};
+
+/***********************************************************************************************************************
+ * LOCAL FUNCTIONS
+ */
+
+static INLINE int vos_bpf (int cmd, union bpf_attr *pAttr)
+{
+    return (int) syscall(__NR_bpf, cmd, pAttr, sizeof(union bpf_attr));
+}
+
+/**********************************************************************************************************************/
+/** Create the XSKMAP and load the XDP program which redirects IPv4/UDP frames for our port into it.
+ *  Frames with IP options, fragments and VLAN tagged frames are passed to the kernel.
+ *
+ *  @param[in]      pXsk            socket
+ *  @retval         VOS_NO_ERR      no error
+ *  @retval         VOS_SOCK_ERR    map or program could not be created
+ */
+static VOS_ERR_T vos_xskLoadProgram (
+    struct VOS_XSK *pXsk)
+{
+    /*  r1 = ctx, r2 = data, r3 = data_end, r5 = scratch, returns XDP_PASS if not for us   */
+    struct bpf_insn prog[] =
+    {
+        {BPF_ALU64 | BPF_MOV | BPF_X, 6, 1, 0, 0},                                  /* r6 = ctx                 */
+        {BPF_LDX | BPF_MEM | BPF_W, 2, 1, offsetof(struct xdp_md, data), 0},        /* r2 = data                */
+        {BPF_LDX | BPF_MEM | BPF_W, 3, 1, offsetof(struct xdp_md, data_end), 0},    /* r3 = data_end            */
+        {BPF_ALU64 | BPF_MOV | BPF_X, 4, 2, 0, 0},                                  /* r4 = data                */
+        {BPF_ALU64 | BPF_ADD | BPF_K, 4, 0, 0, VOS_XSK_HDR_SIZE},                   /* r4 += headers            */
+        {BPF_JMP | BPF_JGT | BPF_X, 4, 3, 17, 0},                                   /* too short -> pass        */
+        {BPF_LDX | BPF_MEM | BPF_H, 5, 2, 12, 0},                                   /* ether type               */
+        {BPF_JMP | BPF_JNE | BPF_K, 5, 0, 15, 0x0008},                              /* != IPv4 -> pass          */
+        {BPF_LDX | BPF_MEM | BPF_B, 5, 2, 14, 0},                                   /* version / header length  */
+        {BPF_JMP | BPF_JNE | BPF_K, 5, 0, 13, 0x45},                                /* options -> pass          */
+        {BPF_LDX | BPF_MEM | BPF_B, 5, 2, 23, 0},                                   /* protocol                 */
+        {BPF_JMP | BPF_JNE | BPF_K, 5, 0, 11, IPPROTO_UDP},                         /* != UDP -> pass           */
+        {BPF_LDX | BPF_MEM | BPF_H, 5, 2, 20, 0},                                   /* flags / fragment offset  */
+        {BPF_ALU64 | BPF_AND | BPF_K, 5, 0, 0, 0xFF3F},                             /* MF and offset            */
+        {BPF_JMP | BPF_JNE | BPF_K, 5, 0, 8, 0},                                    /* fragment -> pass         */
+        {BPF_LDX | BPF_MEM | BPF_H, 5, 2, 36, 0},                                   /* UDP destination port     */
+        {BPF_JMP | BPF_JNE | BPF_K, 5, 0, 6, 0},                                    /* other port -> pass       */
+        {BPF_LDX | BPF_MEM | BPF_W, 2, 6, offsetof(struct xdp_md, rx_queue_index), 0},  /* key = rx queue     */
+        {BPF_LD | BPF_DW | BPF_IMM, 1, BPF_PSEUDO_MAP_FD, 0, 0},                    /* r1 = map                 */
+        {0, 0, 0, 0, 0},
+        {BPF_ALU64 | BPF_MOV | BPF_K, 3, 0, 0, XDP_PASS},                           /* not in map -> pass       */
+        {BPF_JMP | BPF_CALL, 0, 0, 0, BPF_FUNC_redirect_map},
+        {BPF_JMP | BPF_EXIT, 0, 0, 0, 0},
+        {BPF_ALU64 | BPF_MOV | BPF_K, 0, 0, 0, XDP_PASS},                           /* pass:                    */
+        {BPF_JMP | BPF_EXIT, 0, 0, 0, 0}
+    };
+    static const char   cLicense[] = "Dual MPL/GPL";
+    static char         log[4096];
+    union bpf_attr      attr;
+
+    prog[16].imm    = vos_htons(pXsk->port);    /* compared as loaded, in network order */
+    prog[18].imm    = 0;
+
+    memset(&attr, 0, sizeof(attr));
+    attr.map_type       = BPF_MAP_TYPE_XSKMAP;
+    attr.key_size       = sizeof(UINT32);
+    attr.value_size     = sizeof(int);
+    attr.max_entries    = pXsk->queueId + 1u;
+    pXsk->mapFd = vos_bpf(BPF_MAP_CREATE, &attr);
+    if (pXsk->mapFd < 0)
+    {
+        vos_printLog(VOS_LOG_ERROR, "XSKMAP creation failed (Err: %d)\n", errno);
+        return VOS_SOCK_ERR;
+    }
+    prog[18].imm = pXsk->mapFd;
+
+    memset(&attr, 0, sizeof(attr));
+    attr.prog_type  = BPF_PROG_TYPE_XDP;
+    attr.insns      = (UINT64) (uintptr_t) prog;
+    attr.insn_cnt   = sizeof(prog) / sizeof(struct bpf_insn);
+    attr.license    = (UINT64) (uintptr_t) cLicense;
+    attr.log_buf    = (UINT64) (uintptr_t) log;
+    attr.log_size   = sizeof(log);
+    attr.log_level  = 1u;
+    log[0]          = 0;
+    pXsk->progFd    = vos_bpf(BPF_PROG_LOAD, &attr);
+    if (pXsk->progFd < 0)
+    {
+        size_t len = strlen(log);
+
+        /* the end of the verifier log tells why */
+        vos_printLog(VOS_LOG_ERROR, "XDP program not loaded (Err: %d) %.180s\n", errno,
+                     (len > 180u) ? &log[len - 180u] : log);
+        return VOS_SOCK_ERR;
+    }
+    return VOS_NO_ERR;
+}
+
+/**********************************************************************************************************************/
+/** Attach the XDP program to the interface, in driver mode if possible, else generic.
+ *  The program is detached when the link is closed.
+ *
+ *  @param[in]      pXsk            socket
+ *  @retval         VOS_NO_ERR      no error
+ *  @retval         VOS_SOCK_ERR    program could not be attached
+ */
+static VOS_ERR_T vos_xskAttach (
+    struct VOS_XSK *pXsk)
+{
+    static const UINT32 cModes[2] = {XDP_FLAGS_DRV_MODE, XDP_FLAGS_SKB_MODE};
+    union bpf_attr      attr;
+    UINT32              i;
+
+    for (i = 0u; (i < 2u) && (pXsk->linkFd < 0); i++)
+    {
+        memset(&attr, 0, sizeof(attr));
+        attr.link_create.prog_fd        = (UINT32) pXsk->progFd;
+        attr.link_create.target_ifindex = pXsk->ifIndex;
+        attr.link_create.attach_type    = BPF_XDP;
+        attr.link_create.flags          = cModes[i];
+        pXsk->linkFd = vos_bpf(BPF_LINK_CREATE, &attr);
+        pXsk->stats.nativeXdp = (pXsk->linkFd >= 0) && (i == 0u);
+    }
+    if (pXsk->linkFd < 0)
+    {
+        vos_printLog(VOS_LOG_ERROR, "XDP program not attached to %s (Err: %d)\n", pXsk->ifName, errno);
+        return VOS_SOCK_ERR;
+    }
+    return VOS_NO_ERR;
+}
+
+/**********************************************************************************************************************/
+/** Map one of the rings
+ *
+ *  @param[in]      fd              AF_XDP socket
+ *  @param[in]      pOff            offsets of the ring
+ *  @param[in]      pgOff           page offset identifying the ring
+ *  @param[in]      descSize        size of a descriptor
+ *  @param[out]     pRing           ring
+ *  @retval         VOS_NO_ERR      no error
+ *  @retval         VOS_MEM_ERR     mapping failed
+ */
+static VOS_ERR_T vos_xskMapRing (
+    int                             fd,
+    const struct xdp_ring_offset    *pOff,
+    off_t                           pgOff,
+    size_t                          descSize,
+    VOS_XSK_RING_T                  *pRing)
+{
+    pRing->mapSize  = pOff->desc + VOS_XSK_RING_SIZE * descSize;
+    pRing->pMap     = mmap(NULL, pRing->mapSize, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, fd, pgOff);
+    if (pRing->pMap == MAP_FAILED)
+    {
+        pRing->pMap = NULL;
+        return VOS_MEM_ERR;
+    }
+    pRing->pProducer    = (UINT32 *) ((UINT8 *) pRing->pMap + pOff->producer);
+    pRing->pConsumer    = (UINT32 *) ((UINT8 *) pRing->pMap + pOff->consumer);
+    pRing->pDesc        = (UINT8 *) pRing->pMap + pOff->desc;
+    pRing->mask         = VOS_XSK_RING_SIZE - 1u;
+    return VOS_NO_ERR;
+}
+
+/**********************************************************************************************************************/
+/** Bind the socket to the interface queue, in zero copy mode if wanted and supported
+ *
+ *  @param[in]      pXsk            socket
+ *  @param[in]      zeroCopy        try zero copy first
+ *  @retval         VOS_NO_ERR      no error
+ *  @retval         VOS_SOCK_ERR    bind failed
+ */
+static VOS_ERR_T vos_xskBind (
+    struct VOS_XSK  *pXsk,
+    BOOL8           zeroCopy)
+{
+    struct sockaddr_xdp addr;
+
+    memset(&addr, 0, sizeof(addr));
+    addr.sxdp_family    = AF_XDP;
+    addr.sxdp_ifindex   = pXsk->ifIndex;
+    addr.sxdp_queue_id  = pXsk->queueId;
+
+    if (zeroCopy == TRUE)
+    {
+        addr.sxdp_flags = XDP_ZEROCOPY;
+        if (bind(pXsk->fd, (struct sockaddr *) &addr, sizeof(addr)) == 0)
+        {
+            pXsk->stats.zeroCopy = TRUE;
+            return VOS_NO_ERR;
+        }
+        vos_printLog(VOS_LOG_INFO, "%s: no AF_XDP zero copy support (Err: %d), using copy mode\n",
+                     pXsk->ifName, errno);
+    }
+    addr.sxdp_flags = XDP_COPY;
+    if (bind(pXsk->fd, (struct sockaddr *) &addr, sizeof(addr)) != 0)
+    {
+        vos_printLog(VOS_LOG_ERROR, "AF_XDP bind to %s queue %u failed (Err: %d)\n",
+                     pXsk->ifName, pXsk->queueId, errno);
+        return VOS_SOCK_ERR;
+    }
+    pXsk->stats.zeroCopy = FALSE;
+    return VOS_NO_ERR;
+}
+
+/**********************************************************************************************************************/
+/** Get the interface parameters (index, MAC, IP address and mask)
+ *
+ *  @param[in]      pXsk            socket
+ *  @retval         VOS_NO_ERR      no error
+ *  @retval         VOS_SOCK_ERR    unknown interface
+ */
+static VOS_ERR_T vos_xskGetInterface (
+    struct VOS_XSK *pXsk)
+{
+    struct ifreq ifr;
+
+    pXsk->ifIndex = if_nametoindex(pXsk->ifName);
+    if (pXsk->ifIndex == 0u)
+    {
+        vos_printLog(VOS_LOG_ERROR, "Interface %s unknown\n", pXsk->ifName);
+        return VOS_SOCK_ERR;
+    }
+    memset(&ifr, 0, sizeof(ifr));
+    vos_strncpy(ifr.ifr_name, pXsk->ifName, IFNAMSIZ - 1);
+    if (ioctl(pXsk->ctlFd, SIOCGIFHWADDR, &ifr) != 0)
+    {
+        return VOS_SOCK_ERR;
+    }
+    memcpy(pXsk->ifMac, ifr.ifr_hwaddr.sa_data, VOS_MAC_SIZE);
+    if (ioctl(pXsk->ctlFd, SIOCGIFADDR, &ifr) == 0)
+    {
+        pXsk->ifAddr = vos_ntohl(((struct sockaddr_in *) &ifr.ifr_addr)->sin_addr.s_addr);
+    }
+    if (ioctl(pXsk->ctlFd, SIOCGIFNETMASK, &ifr) == 0)
+    {
+        pXsk->ifMask = vos_ntohl(((struct sockaddr_in *) &ifr.ifr_netmask)->sin_addr.s_addr);
+    }
+    return VOS_NO_ERR;
+}
+
+/**********************************************************************************************************************/
+/** Get the destination MAC address: multicast and broadcast are mapped, unicast addresses on the link are looked up
+ *  in the kernel's neighbour table (and cached for a second).
+ *
+ *  @param[in]      pXsk            socket
+ *  @param[in]      ipAddr          destination IP address
+ *  @param[out]     pMac            destination MAC address
+ *  @retval         VOS_NO_ERR      no error
+ *  @retval         VOS_UNKNOWN_ERR MAC address not known (not resolved yet or not on the link)
+ */
+static VOS_ERR_T vos_xskGetDestMac (
+    struct VOS_XSK  *pXsk,
+    VOS_IP4_ADDR_T  ipAddr,
+    UINT8           *pMac)
+{
+    struct arpreq       req;
+    struct sockaddr_in  *pSin = (struct sockaddr_in *) &req.arp_pa;
+    VOS_TIMEVAL_T       now;
+    UINT32              i;
+
+    if (vos_isMulticast(ipAddr))
+    {
+        pMac[0] = 0x01u;
+        pMac[1] = 0x00u;
+        pMac[2] = 0x5Eu;
+        pMac[3] = (UINT8) ((ipAddr >> 16u) & 0x7Fu);
+        pMac[4] = (UINT8) (ipAddr >> 8u);
+        pMac[5] = (UINT8) ipAddr;
+        return VOS_NO_ERR;
+    }
+    if ((ipAddr == 0xFFFFFFFFu) ||
+        ((pXsk->ifMask != 0u) && (ipAddr == (pXsk->ifAddr | ~pXsk->ifMask))))
+    {
+        memset(pMac, 0xFF, VOS_MAC_SIZE);
+        return VOS_NO_ERR;
+    }
+    if ((pXsk->ifMask == 0u) || ((ipAddr & pXsk->ifMask) != (pXsk->ifAddr & pXsk->ifMask)))
+    {
+        /* routed destinations are left to the kernel */
+        return VOS_UNKNOWN_ERR;
+    }
+
+    vos_getTime(&now);
+    for (i = 0u; i < VOS_XSK_NUM_NEIGH; i++)
+    {
+        if ((pXsk->neigh[i].ipAddr == ipAddr) && (vos_cmpTime(&pXsk->neigh[i].validUntil, &now) > 0))
+        {
+            memcpy(pMac, pXsk->neigh[i].mac, VOS_MAC_SIZE);
+            return VOS_NO_ERR;
+        }
+    }
+
+    memset(&req, 0, sizeof(req));
+    pSin->sin_family        = AF_INET;
+    pSin->sin_addr.s_addr   = vos_htonl(ipAddr);
+    vos_strncpy(req.arp_dev, pXsk->ifName, sizeof(req.arp_dev) - 1);
+    if ((ioctl(pXsk->ctlFd, SIOCGARP, &req) != 0) || !(req.arp_flags & ATF_COM))
+    {
+        return VOS_UNKNOWN_ERR;
+    }
+    memcpy(pMac, req.arp_ha.sa_data, VOS_MAC_SIZE);
+
+    /* replace the oldest entry */
+    i = pXsk->nextNeigh;
+    pXsk->nextNeigh = (i + 1u) % VOS_XSK_NUM_NEIGH;
+    pXsk->neigh[i].ipAddr       = ipAddr;
+    memcpy(pXsk->neigh[i].mac, pMac, VOS_MAC_SIZE);
+    pXsk->neigh[i].validUntil   = now;
+    pXsk->neigh[i].validUntil.tv_sec += VOS_XSK_NEIGH_TIMEOUT;
+    return VOS_NO_ERR;
+}
+
+/**********************************************************************************************************************/
+/** Return sent frames from the completion ring to the free TX frames
+ *
+ *  @param[in]      pXsk            socket
+ */
+static void vos_xskReclaim (
+    struct VOS_XSK *pXsk)
+{
+    UINT32  prod    = __atomic_load_n(pXsk->comp.pProducer, __ATOMIC_ACQUIRE);
+    UINT32  cons    = *pXsk->comp.pConsumer;
+    UINT64  *pAddr  = (UINT64 *) pXsk->comp.pDesc;
+
+    while (cons != prod)
+    {
+        pXsk->txFree[pXsk->noOfTxFree++] = pAddr[cons & pXsk->comp.mask];
+        cons++;
+    }
+    __atomic_store_n(pXsk->comp.pConsumer, cons, __ATOMIC_RELEASE);
+}
+
+/**********************************************************************************************************************/
+/** Internet checksum of the IP header
+ *
+ *  @param[in]      pHdr            IP header
+ *  @retval         checksum (network order)
+ */
+static UINT16 vos_xskIpChecksum (
+    const UINT8 *pHdr)
+{
+    UINT32  sum = 0u;
+    UINT32  i;
+
+    for (i = 0u; i < VOS_IP_HDR_SIZE; i += 2u)
+    {
+        sum += ((UINT32) pHdr[i] << 8u) | pHdr[i + 1u];
+    }
+    while (sum >> 16u)
+    {
+        sum = (sum & 0xFFFFu) + (sum >> 16u);
+    }
+    return vos_htons((UINT16) ~sum);
+}
+
+/***********************************************************************************************************************
+ * GLOBAL FUNCTIONS
+ */
+
+/**********************************************************************************************************************/
+/** Open an AF_XDP socket on one queue of an interface.
+ *  Creates the UMEM and the rings, loads and attaches the XDP program redirecting the IPv4/UDP frames for the port.
+ *  Zero copy is used if wanted and supported by the driver, else the socket falls back to copy mode.
+ *
+ *  @param[out]     pXsk            pointer to the socket handle returned
+ *  @param[in]      pIfName         interface name
+ *  @param[in]      queueId         queue of the interface
+ *  @param[in]      port            UDP port to receive
+ *  @param[in]      zeroCopy        try zero copy
+ *
+ *  @retval         VOS_NO_ERR      no error
+ *  @retval         VOS_PARAM_ERR   parameter error
+ *  @retval         VOS_MEM_ERR     out of memory
+ *  @retval         VOS_SOCK_ERR    AF_XDP or XDP not available (kernel, rights)
+ */
+EXT_DECL VOS_ERR_T vos_xskOpen (
+    VOS_XSK_T       *pXsk,
+    const CHAR8     *pIfName,
+    UINT32          queueId,
+    UINT16          port,
+    BOOL8           zeroCopy)
+{
+    struct VOS_XSK          *pNew;
+    struct xdp_umem_reg     umemReg;
+    struct xdp_mmap_offsets off;
+    socklen_t               optLen  = sizeof(off);
+    int                     ringSize = VOS_XSK_RING_SIZE;
+    union bpf_attr          attr;
+    VOS_ERR_T               err     = VOS_SOCK_ERR;
+    UINT64                  *pFill;
+    UINT32                  i;
+
+    if ((pXsk == NULL) || (pIfName == NULL) || (strlen(pIfName) >= IFNAMSIZ))
+    {
+        return VOS_PARAM_ERR;
+    }
+    *pXsk = NULL;
+
+    pNew = (struct VOS_XSK *) vos_memAlloc(sizeof(struct VOS_XSK));
+    if (pNew == NULL)
+    {
+        return VOS_MEM_ERR;
+    }
+    pNew->fd        = -1;
+    pNew->mapFd     = -1;
+    pNew->progFd    = -1;
+    pNew->linkFd    = -1;
+    pNew->queueId   = queueId;
+    pNew->port      = port;
+    vos_strncpy(pNew->ifName, pIfName, IFNAMSIZ - 1);
+
+    pNew->ctlFd = socket(AF_INET, SOCK_DGRAM, 0);
+    if ((pNew->ctlFd < 0) || (vos_xskGetInterface(pNew) != VOS_NO_ERR))
+    {
+        goto fail;
+    }
+
+    pNew->fd = socket(AF_XDP, SOCK_RAW, 0);
+    if (pNew->fd < 0)
+    {
+        vos_printLog(VOS_LOG_ERROR, "AF_XDP socket not available (Err: %d)\n", errno);
+        goto fail;
+    }
+
+    /*  UMEM: the first half is used for receiving, the second half for sending */
+    pNew->pUmem = (UINT8 *) mmap(NULL, VOS_XSK_NUM_FRAMES * VOS_XSK_FRAME_SIZE, PROT_READ | PROT_WRITE,
+                                 MAP_PRIVATE | MAP_ANONYMOUS | MAP_POPULATE, -1, 0);
+    if (pNew->pUmem == MAP_FAILED)
+    {
+        pNew->pUmem = NULL;
+        err = VOS_MEM_ERR;
+        goto fail;
+    }
+    memset(&umemReg, 0, sizeof(umemReg));
+    umemReg.addr        = (UINT64) (uintptr_t) pNew->pUmem;
+    umemReg.len         = VOS_XSK_NUM_FRAMES * VOS_XSK_FRAME_SIZE;
+    umemReg.chunk_size  = VOS_XSK_FRAME_SIZE;
+    umemReg.headroom    = 0u;
+    if ((setsockopt(pNew->fd, SOL_XDP, XDP_UMEM_REG, &umemReg, sizeof(umemReg)) != 0) ||
+        (setsockopt(pNew->fd, SOL_XDP, XDP_UMEM_FILL_RING, &ringSize, sizeof(ringSize)) != 0) ||
+        (setsockopt(pNew->fd, SOL_XDP, XDP_UMEM_COMPLETION_RING, &ringSize, sizeof(ringSize)) != 0) ||
+        (setsockopt(pNew->fd, SOL_XDP, XDP_RX_RING, &ringSize, sizeof(ringSize)) != 0) ||
+        (setsockopt(pNew->fd, SOL_XDP, XDP_TX_RING, &ringSize, sizeof(ringSize)) != 0) ||
+        (getsockopt(pNew->fd, SOL_XDP, XDP_MMAP_OFFSETS, &off, &optLen) != 0))
+    {
+        vos_printLog(VOS_LOG_ERROR, "AF_XDP UMEM setup failed (Err: %d)\n", errno);
+        goto fail;
+    }
+    if ((vos_xskMapRing(pNew->fd, &off.rx, XDP_PGOFF_RX_RING, sizeof(struct xdp_desc), &pNew->rx) != VOS_NO_ERR) ||
+        (vos_xskMapRing(pNew->fd, &off.tx, XDP_PGOFF_TX_RING, sizeof(struct xdp_desc), &pNew->tx) != VOS_NO_ERR) ||
+        (vos_xskMapRing(pNew->fd, &off.fr, XDP_UMEM_PGOFF_FILL_RING, sizeof(UINT64), &pNew->fill) != VOS_NO_ERR) ||
+        (vos_xskMapRing(pNew->fd, &off.cr, XDP_UMEM_PGOFF_COMPLETION_RING, sizeof(UINT64), &pNew->comp)
+         != VOS_NO_ERR))
+    {
+        err = VOS_MEM_ERR;
+        goto fail;
+    }
+
+    /*  Hand the receive frames to the kernel, keep the send frames */
+    pFill = (UINT64 *) pNew->fill.pDesc;
+    for (i = 0u; i < VOS_XSK_NUM_FRAMES / 2u; i++)
+    {
+        pFill[i & pNew->fill.mask] = (UINT64) i * VOS_XSK_FRAME_SIZE;
+        pNew->txFree[i] = (UINT64) (i + VOS_XSK_NUM_FRAMES / 2u) * VOS_XSK_FRAME_SIZE;
+    }
+    pNew->noOfTxFree = VOS_XSK_NUM_FRAMES / 2u;
+    __atomic_store_n(pNew->fill.pProducer, VOS_XSK_NUM_FRAMES / 2u, __ATOMIC_RELEASE);
+
+    if ((vos_xskBind(pNew, zeroCopy) != VOS_NO_ERR) ||
+        (vos_xskLoadProgram(pNew) != VOS_NO_ERR))
+    {
+        goto fail;
+    }
+
+    /*  Register the socket for its queue, then let the program redirect to it  */
+    memset(&attr, 0, sizeof(attr));
+    attr.map_fd = (UINT32) pNew->mapFd;
+    attr.key    = (UINT64) (uintptr_t) &pNew->queueId;
+    attr.value  = (UINT64) (uintptr_t) &pNew->fd;
+    if (vos_bpf(BPF_MAP_UPDATE_ELEM, &attr) != 0)
+    {
+        vos_printLog(VOS_LOG_ERROR, "XSKMAP update failed (Err: %d)\n", errno);
+        goto fail;
+    }
+    if (vos_xskAttach(pNew) != VOS_NO_ERR)
+    {
+        goto fail;
+    }
+
+    vos_printLog(VOS_LOG_INFO, "AF_XDP socket on %s queue %u (%s mode, XDP %s), port %u\n",
+                 pNew->ifName, pNew->queueId, pNew->stats.zeroCopy ? "zero copy" : "copy",
+                 pNew->stats.nativeXdp ? "native" : "generic", (unsigned int) port);
+    *pXsk = pNew;
+    return VOS_NO_ERR;
+
+fail:
+    vos_xskClose(pNew);
+    return err;
+}
+
+/**********************************************************************************************************************/
+/** Close an AF_XDP socket, detach the XDP program and free the UMEM
+ *
+ *  @param[in]      xsk             socket handle
+ */
+EXT_DECL void vos_xskClose (
+    VOS_XSK_T xsk)
+{
+    VOS_XSK_RING_T  *pRings[4];
+    UINT32          i;
+
+    if (xsk == NULL)
+    {
+        return;
+    }
+    if (xsk->linkFd >= 0)
+    {
+        (void) close(xsk->linkFd);
+    }
+    if (xsk->progFd >= 0)
+    {
+        (void) close(xsk->progFd);
+    }
+    if (xsk->mapFd >= 0)
+    {
+        (void) close(xsk->mapFd);
+    }
+    pRings[0]   = &xsk->rx;
+    pRings[1]   = &xsk->tx;
+    pRings[2]   = &xsk->fill;
+    pRings[3]   = &xsk->comp;
+    for (i = 0u; i < 4u; i++)
+    {
+        if (pRings[i]->pMap != NULL)
+        {
+            (void) munmap(pRings[i]->pMap, pRings[i]->mapSize);
+        }
+    }
+    if (xsk->fd >= 0)
+    {
+        (void) close(xsk->fd);
+    }
+    if (xsk->pUmem != NULL)
+    {
+        (void) munmap(xsk->pUmem, VOS_XSK_NUM_FRAMES * VOS_XSK_FRAME_SIZE);
+    }
+    if (xsk->ctlFd >= 0)
+    {
+        (void) close(xsk->ctlFd);
+    }
+    vos_memFree(xsk);
+}
+
+/**********************************************************************************************************************/
+/** Descriptor of the AF_XDP socket, readable if frames were received
+ *
+ *  @param[in]      xsk             socket handle
+ *  @retval         socket descriptor
+ */
+EXT_DECL SOCKET vos_xskSocket (
+    VOS_XSK_T xsk)
+{
+    return (xsk != NULL) ? xsk->fd : VOS_INVALID_SOCKET;
+}
+
+/**********************************************************************************************************************/
+/** Get received UDP datagrams without copying them.
+ *  The payloads stay valid in UMEM until vos_xskRelease() is called, frames which are not valid IPv4/UDP datagrams
+ *  for the port are returned with pData == NULL.
+ *
+ *  @param[in]      xsk             socket handle
+ *  @param[out]     pFrame          received datagrams
+ *  @param[in,out]  pNoOfFrames     In: max. number of datagrams, Out: number of datagrams received
+ *
+ *  @retval         VOS_NO_ERR      at least one datagram was received
+ *  @retval         VOS_PARAM_ERR   parameter error or datagrams not released
+ *  @retval         VOS_NODATA_ERR  nothing received
+ */
+EXT_DECL VOS_ERR_T vos_xskReceive (
+    VOS_XSK_T       xsk,
+    VOS_XSK_FRAME_T *pFrame,
+    UINT32          *pNoOfFrames)
+{
+    const struct xdp_desc   *pDesc;
+    UINT32                  prod;
+    UINT32                  cons;
+    UINT32                  n;
+    UINT32                  i;
+
+    if ((xsk == NULL) || (pFrame == NULL) || (pNoOfFrames == NULL) || (xsk->noOfPeeked != 0u))
+    {
+        return VOS_PARAM_ERR;
+    }
+    prod    = __atomic_load_n(xsk->rx.pProducer, __ATOMIC_ACQUIRE);
+    cons    = *xsk->rx.pConsumer;
+    n       = prod - cons;
+    if (n > *pNoOfFrames)
+    {
+        n = *pNoOfFrames;
+    }
+    *pNoOfFrames = n;
+    if (n == 0u)
+    {
+        return VOS_NODATA_ERR;
+    }
+
+    for (i = 0u; i < n; i++)
+    {
+        const UINT8 *pEth;
+        const UINT8 *pIp;
+        const UINT8 *pUdp;
+        UINT32      udpLen;
+
+        pDesc   = &((const struct xdp_desc *) xsk->rx.pDesc)[(cons + i) & xsk->rx.mask];
+        pEth    = xsk->pUmem + pDesc->addr;
+        pIp     = pEth + VOS_ETH_HDR_SIZE;
+        pUdp    = pIp + VOS_IP_HDR_SIZE;
+
+        memset(&pFrame[i], 0, sizeof(VOS_XSK_FRAME_T));
+        xsk->stats.numRx++;
+
+        /*  The program redirects IPv4 without options only, but the length must be checked */
+        udpLen = ((UINT32) pUdp[4] << 8u) | pUdp[5];
+        if ((pDesc->len < VOS_XSK_HDR_SIZE) || (udpLen < VOS_UDP_HDR_SIZE) ||
+            (udpLen > pDesc->len - VOS_ETH_HDR_SIZE - VOS_IP_HDR_SIZE) ||
+            (pIp[0] != 0x45u) || (pIp[9] != IPPROTO_UDP))
+        {
+            xsk->stats.numRxInvalid++;
+            continue;
+        }
+        pFrame[i].pData     = (UINT8 *) pUdp + VOS_UDP_HDR_SIZE;
+        pFrame[i].size      = udpLen - VOS_UDP_HDR_SIZE;
+        pFrame[i].srcIpAddr = ((UINT32) pIp[12] << 24u) | ((UINT32) pIp[13] << 16u) |
+                              ((UINT32) pIp[14] << 8u) | pIp[15];
+        pFrame[i].dstIpAddr = ((UINT32) pIp[16] << 24u) | ((UINT32) pIp[17] << 16u) |
+                              ((UINT32) pIp[18] << 8u) | pIp[19];
+        pFrame[i].srcPort   = (UINT16) (((UINT32) pUdp[0] << 8u) | pUdp[1]);
+    }
+    xsk->noOfPeeked = n;
+    return VOS_NO_ERR;
+}
+
+/**********************************************************************************************************************/
+/** Give the frames of the last vos_xskReceive() back to the kernel
+ *
+ *  @param[in]      xsk             socket handle
+ */
+EXT_DECL void vos_xskRelease (
+    VOS_XSK_T xsk)
+{
+    UINT32  cons;
+    UINT32  prod;
+    UINT64  *pFill;
+    UINT32  i;
+
+    if ((xsk == NULL) || (xsk->noOfPeeked == 0u))
+    {
+        return;
+    }
+    cons    = *xsk->rx.pConsumer;
+    prod    = *xsk->fill.pProducer;
+    pFill   = (UINT64 *) xsk->fill.pDesc;
+
+    /*  The fill ring has room for all receive frames, a frame is either in the fill or in the RX ring or with us */
+    for (i = 0u; i < xsk->noOfPeeked; i++)
+    {
+        UINT64 addr = ((const struct xdp_desc *) xsk->rx.pDesc)[(cons + i) & xsk->rx.mask].addr;
+        pFill[(prod + i) & xsk->fill.mask] = addr & ~((UINT64) VOS_XSK_FRAME_SIZE - 1u);
+    }
+    __atomic_store_n(xsk->fill.pProducer, prod + xsk->noOfPeeked, __ATOMIC_RELEASE);
+    __atomic_store_n(xsk->rx.pConsumer, cons + xsk->noOfPeeked, __ATOMIC_RELEASE);
+    xsk->noOfPeeked = 0u;
+}
+
+/**********************************************************************************************************************/
+/** Post a UDP datagram to the TX ring.
+ *  The Ethernet, IP and UDP headers are built in front of the payload in a UMEM frame, the UDP checksum is not
+ *  computed (optional for IPv4). The frames are sent with the next vos_xskFlush().
+ *
+ *  @param[in]      xsk             socket handle
+ *  @param[in]      pBuffer         payload
+ *  @param[in]      size            size of the payload
+ *  @param[in]      srcIpAddress    source IP address, 0 = address of the interface
+ *  @param[in]      dstIpAddress    destination IP address
+ *  @param[in]      port            source and destination port
+ *  @param[in]      tos             type of service
+ *  @param[in]      ttl             time to live
+ *
+ *  @retval         VOS_NO_ERR          no error
+ *  @retval         VOS_PARAM_ERR       parameter error, payload too large
+ *  @retval         VOS_QUEUE_FULL_ERR  no free frame, TX ring full
+ *  @retval         VOS_UNKNOWN_ERR     destination MAC address unknown, send it with a socket
+ */
+EXT_DECL VOS_ERR_T vos_xskSendUDP (
+    VOS_XSK_T       xsk,
+    const UINT8     *pBuffer,
+    UINT32          size,
+    VOS_IP4_ADDR_T  srcIpAddress,
+    VOS_IP4_ADDR_T  dstIpAddress,
+    UINT16          port,
+    UINT8           tos,
+    UINT8           ttl)
+{
+    struct xdp_desc *pDesc;
+    UINT8           destMac[VOS_MAC_SIZE];
+    UINT8           *pEth;
+    UINT8           *pIp;
+    UINT8           *pUdp;
+    UINT64          addr;
+    UINT32          prod;
+    UINT32          ipLen;
+
+    if ((xsk == NULL) || (pBuffer == NULL) || (size > VOS_XSK_FRAME_SIZE - VOS_XSK_HDR_SIZE))
+    {
+        return VOS_PARAM_ERR;
+    }
+    if (vos_xskGetDestMac(xsk, dstIpAddress, destMac) != VOS_NO_ERR)
+    {
+        xsk->stats.numTxNoNeigh++;
+        return VOS_UNKNOWN_ERR;
+    }
+    if (xsk->noOfTxFree == 0u)
+    {
+        vos_xskReclaim(xsk);
+    }
+    prod = *xsk->tx.pProducer;
+    if ((xsk->noOfTxFree == 0u) ||
+        ((prod - __atomic_load_n(xsk->tx.pConsumer, __ATOMIC_ACQUIRE)) > xsk->tx.mask))
+    {
+        xsk->stats.numTxNoFrame++;
+        return VOS_QUEUE_FULL_ERR;
+    }
+    addr    = xsk->txFree[--xsk->noOfTxFree];
+    pEth    = xsk->pUmem + addr;
+    pIp     = pEth + VOS_ETH_HDR_SIZE;
+    pUdp    = pIp + VOS_IP_HDR_SIZE;
+    ipLen   = VOS_IP_HDR_SIZE + VOS_UDP_HDR_SIZE + size;
+    if (srcIpAddress == 0u)
+    {
+        srcIpAddress = xsk->ifAddr;
+    }
+
+    memcpy(pEth, destMac, VOS_MAC_SIZE);
+    memcpy(pEth + VOS_MAC_SIZE, xsk->ifMac, VOS_MAC_SIZE);
+    pEth[12]    = 0x08u;
+    pEth[13]    = 0x00u;
+
+    pIp[0]  = 0x45u;
+    pIp[1]  = tos;
+    pIp[2]  = (UINT8) (ipLen >> 8u);
+    pIp[3]  = (UINT8) ipLen;
+    pIp[4]  = (UINT8) (xsk->ipId >> 8u);
+    pIp[5]  = (UINT8) xsk->ipId;
+    pIp[6]  = 0x40u;                            /* don't fragment */
+    pIp[7]  = 0x00u;
+    pIp[8]  = ttl;
+    pIp[9]  = IPPROTO_UDP;
+    pIp[10] = 0u;
+    pIp[11] = 0u;
+    *(UINT32 *) (pIp + 12)  = vos_htonl(srcIpAddress);
+    *(UINT32 *) (pIp + 16)  = vos_htonl(dstIpAddress);
+    *(UINT16 *) (pIp + 10)  = vos_xskIpChecksum(pIp);
+    xsk->ipId++;
+
+    *(UINT16 *) (pUdp + 0)  = vos_htons(port);
+    *(UINT16 *) (pUdp + 2)  = vos_htons(port);
+    *(UINT16 *) (pUdp + 4)  = vos_htons((UINT16) (VOS_UDP_HDR_SIZE + size));
+    *(UINT16 *) (pUdp + 6)  = 0u;
+    memcpy(pUdp + VOS_UDP_HDR_SIZE, pBuffer, size);
+
+    pDesc           = &((struct xdp_desc *) xsk->tx.pDesc)[prod & xsk->tx.mask];
+    pDesc->addr     = addr;
+    pDesc->len      = VOS_ETH_HDR_SIZE + ipLen;
+    pDesc->options  = 0u;
+    __atomic_store_n(xsk->tx.pProducer, prod + 1u, __ATOMIC_RELEASE);
+    xsk->txPending++;
+    xsk->stats.numTx++;
+    return VOS_NO_ERR;
+}
+
+/**********************************************************************************************************************/
+/** Let the kernel send the posted frames and reclaim the sent ones
+ *
+ *  @param[in]      xsk             socket handle
+ */
+EXT_DECL void vos_xskFlush (
+    VOS_XSK_T xsk)
+{
+    UINT32 i;
+
+    if (xsk == NULL)
+    {
+        return;
+    }
+    /*  In copy mode the kernel sends a limited number of frames per call  */
+    for (i = 0u; (i < VOS_XSK_MAX_KICKS) && (xsk->txPending != 0u); i++)
+    {
+        if ((sendto(xsk->fd, NULL, 0, MSG_DONTWAIT, NULL, 0) < 0) &&
+            (errno != EAGAIN) && (errno != EBUSY) && (errno != ENOBUFS))
+        {
+            vos_printLog(VOS_LOG_WARNING, "AF_XDP send failed (Err: %d)\n", errno);
+            break;
+        }
+        if (*xsk->tx.pProducer == __atomic_load_n(xsk->tx.pConsumer, __ATOMIC_ACQUIRE))
+        {
+            xsk->txPending = 0u;
+        }
+    }
+    vos_xskReclaim(xsk);
+}
+
+/**********************************************************************************************************************/
+/** Statistics of an AF_XDP socket
+ *
+ *  @param[in]      xsk             socket handle
+ *  @param[out]     pStats          statistics
+ */
+EXT_DECL void vos_xskGetStatistics (
+    VOS_XSK_T       xsk,
+    VOS_XSK_STATS_T *pStats)
+{
+    if ((xsk != NULL) && (pStats != NULL))
+    {
+        *pStats = xsk->stats;
+    }
+}
+
+#endif
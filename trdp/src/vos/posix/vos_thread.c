@@ -17,6 +17,8 @@
  *
  * $Id$
  *
+ *      AG 2026-10-19: Cyclic threads wake up at absolute deadlines, timing statistics per cyclic thread
+ *      AG 2026-10-19: Real-time profile: CPU affinity, memory locking, stack and heap prefault
  *      BL 2019-12-06: Ticket #303: UUID creation does not always conform to standard
  *      BL 2019-08-19: LINT warnings
  *      BL 2019-08-12: Ticket #274 Cyclic thread parameters must not use stack
@@ -45,9 +47,13 @@
  */
 
 #include <stdint.h>
+#include <stdio.h>
+#include <string.h>
 #include <unistd.h>
 #include <errno.h>
+#include <alloca.h>
 #include <sys/time.h>
+#include <sys/mman.h>
 #include <limits.h>
 #include <pthread.h>
 #include <semaphore.h>
@@ -82,6 +88,9 @@ const UINT32    cMutextMagic        = 0x1234FEDCu;
 
 int             vosThreadInitialised = FALSE;
 
+/* Real-time profile for threads created from now on */
+static VOS_RT_PROFILE_T gRtProfile = {0u, FALSE, FALSE, FALSE, FALSE};
+
 #if defined(SCHED_DEADLINE) && defined (RT_THREADS)
 
 /* __NR_sched_setattr number */
@@ -222,7 +231,7 @@ int sem_init (sem_t *pSema, int flags, unsigned int mode)
 #define NSECS_PER_USEC  1000u
 #define USECS_PER_MSEC  1000u
 #define MSECS_PER_SEC   1000u
-#define NSECS_PER_SEC   1000000000u;
+#define NSECS_PER_SEC   1000000000u
 
 /* This define holds the max amount os seconds to get stored in 32bit holding micro seconds        */
 /* It is the result when using the common time struct with tv_sec and tv_usec as on a 32 bit value */
@@ -230,6 +239,29 @@ int sem_init (sem_t *pSema, int flags, unsigned int mode)
 /* are remaining to represent the seconds, which in turn give 0x10C5 seconds or in decimal 4293    */
 #define MAXSEC_FOR_USECPRESENTATION  4293
 
+/* Absolute deadlines need clock_nanosleep() on the monotonic clock (not available on macOS) */
+#if defined(CLOCK_MONOTONIC) && defined(TIMER_ABSTIME) && !defined(__APPLE__)
+#define VOS_CYCLIC_ABSTIME
+#endif
+
+/* Timing statistics of a cyclic thread, written by the thread only */
+typedef struct
+{
+    pthread_t   thread;
+    BOOL8       inUse;
+    UINT32      interval;
+    UINT32      numCycles;
+    UINT32      numMissed;
+    UINT32      minWakeup;
+    UINT32      maxWakeup;
+    UINT64      sumWakeup;
+    UINT32      maxExec;
+    UINT64      sumExec;
+} VOS_CYCLIC_STATS_T;
+
+static VOS_CYCLIC_STATS_T   gCyclicStats[VOS_MAX_THREAD_CNT];
+static pthread_mutex_t      gCyclicStatsMutex = PTHREAD_MUTEX_INITIALIZER;
+
 typedef struct
 {
     const CHAR8         *pName;
@@ -237,12 +269,174 @@ typedef struct
     UINT32              interval;
     VOS_THREAD_FUNC_T   pFunction;
     void                *pArguments;
+    size_t              prefaultSize;   /* stack bytes to touch on start, 0 = none */
+    VOS_CYCLIC_STATS_T  *pStats;        /* timing statistics, may be NULL */
 } VOS_THREAD_CYC_T;
 
+/**********************************************************************************************************************/
+/** Read the monotonic clock.
+ *
+ *  @retval         current time in ns
+ */
+static INT64 vos_monotonicNs (void)
+{
+    struct timespec now;
+
+    (void) clock_gettime(CLOCK_MONOTONIC, &now);
+    return (INT64) now.tv_sec * 1000000000 + (INT64) now.tv_nsec;
+}
+
+/**********************************************************************************************************************/
+/** Reserve a statistics entry for a new cyclic thread.
+ *
+ *  @param[in]      interval        Interval of the thread in us
+ *
+ *  @retval         pointer to the entry or NULL if all entries are in use
+ */
+static VOS_CYCLIC_STATS_T *vos_cyclicStatsAlloc (
+    UINT32 interval)
+{
+    VOS_CYCLIC_STATS_T  *pStats = NULL;
+    UINT32              i;
+
+    (void) pthread_mutex_lock(&gCyclicStatsMutex);
+    for (i = 0u; i < VOS_MAX_THREAD_CNT; i++)
+    {
+        if (gCyclicStats[i].inUse == FALSE)
+        {
+            pStats = &gCyclicStats[i];
+            memset(pStats, 0, sizeof(VOS_CYCLIC_STATS_T));
+            pStats->inUse       = TRUE;
+            pStats->interval    = interval;
+            break;
+        }
+    }
+    (void) pthread_mutex_unlock(&gCyclicStatsMutex);
+    return pStats;
+}
+
+/**********************************************************************************************************************/
+/** Release the statistics entry of a cyclic thread (also called on cancellation).
+ *
+ *  @param[in]      pArg            Pointer to the entry (may be NULL)
+ */
+static void vos_cyclicStatsFree (
+    void *pArg)
+{
+    VOS_CYCLIC_STATS_T *pStats = (VOS_CYCLIC_STATS_T *) pArg;
+
+    if (pStats != NULL)
+    {
+        (void) pthread_mutex_lock(&gCyclicStatsMutex);
+        pStats->inUse = FALSE;
+        (void) pthread_mutex_unlock(&gCyclicStatsMutex);
+    }
+}
+
+/**********************************************************************************************************************/
+/** Account one cycle.
+ *
+ *  @param[in]      pStats          Pointer to the entry (may be NULL)
+ *  @param[in]      wakeupLatency   Delay between deadline and wakeup in us
+ *  @param[in]      execTime        Execution time of the thread function in us
+ *  @param[in]      missed          Number of periods skipped after this cycle
+ */
+static void vos_cyclicStatsAdd (
+    VOS_CYCLIC_STATS_T  *pStats,
+    UINT32              wakeupLatency,
+    UINT32              execTime,
+    UINT32              missed)
+{
+    if (pStats == NULL)
+    {
+        return;
+    }
+    if ((pStats->numCycles == 0u) || (wakeupLatency < pStats->minWakeup))
+    {
+        pStats->minWakeup = wakeupLatency;
+    }
+    if (wakeupLatency > pStats->maxWakeup)
+    {
+        pStats->maxWakeup = wakeupLatency;
+    }
+    if (execTime > pStats->maxExec)
+    {
+        pStats->maxExec = execTime;
+    }
+    pStats->sumWakeup   += wakeupLatency;
+    pStats->sumExec     += execTime;
+    pStats->numMissed   += missed;
+    pStats->numCycles++;
+}
+
+#if defined(__linux__) && defined(_GNU_SOURCE)
+/**********************************************************************************************************************/
+/** Convert a VOS CPU set into a cpu_set_t.
+ *
+ *  @param[out]     pCpuSet         Pointer to the Linux CPU set
+ *  @param[in]      cpuSet          CPU set, bit n selects CPU n
+ */
+static void vos_cpuSetToLinux (
+    cpu_set_t       *pCpuSet,
+    VOS_CPU_SET_T   cpuSet)
+{
+    UINT32 cpu;
+
+    CPU_ZERO(pCpuSet);
+    for (cpu = 0u; (cpu < 64u) && (cpu < CPU_SETSIZE); cpu++)
+    {
+        if ((cpuSet & ((VOS_CPU_SET_T)1u << cpu)) != 0u)
+        {
+            CPU_SET(cpu, pCpuSet);
+        }
+    }
+}
+#endif
+
+/**********************************************************************************************************************/
+/** Touch the stack of the calling thread.
+ *  Writes to one byte per page, so no page fault hits the thread later in its cycle.
+ *
+ *  @param[in]      size            Number of bytes below the current frame to touch
+ */
+static void vos_prefaultStack (
+    size_t size)
+{
+    volatile UINT8  *pStack = (volatile UINT8 *) alloca(size);
+    size_t          pageSize = (size_t) getpagesize();
+    size_t          i;
+
+    for (i = 0u; i < size; i += pageSize)
+    {
+        pStack[i] = 0u;
+    }
+}
+
+/**********************************************************************************************************************/
+/** Execute a non-cyclic thread function after preparing the thread.
+ *
+ *  @param[in]      pParameters     Pointer to the thread function parameters
+ *
+ *  @retval         none
+ */
+static void vos_runThread (
+    VOS_THREAD_CYC_T *pParameters)
+{
+    VOS_THREAD_FUNC_T   pFunction   = pParameters->pFunction;
+    void                *pArguments = pParameters->pArguments;
+
+    vos_prefaultStack(pParameters->prefaultSize);
+    vos_memFree(pParameters);
+
+    pFunction(pArguments);
+}
+
 /**********************************************************************************************************************/
 /** Execute a cyclic thread function.
  *  This function blocks by cyclically executing the provided user function. If supported by the OS,
- *  uses real-time threads and tries to sync to the supplied start time.
+ *  uses real-time threads. The thread wakes up at absolute deadlines which are multiples of the interval after the
+ *  supplied start time, so neither execution time nor wakeup latency accumulate. A cycle overrunning the next
+ *  deadline skips the missed periods and keeps the grid.
  *
  *  @param[in]      pParameters     Pointer to the thread function parameters
  *
@@ -251,11 +445,20 @@ typedef struct
 static void vos_runCyclicThread (
     VOS_THREAD_CYC_T *pParameters)
 {
-#if defined(SCHED_DEADLINE) && defined (RT_THREADS)
+#ifdef VOS_CYCLIC_ABSTIME
     struct timespec     deadline;
-    struct timespec     now;
+    INT64               intervalNs;
+    INT64               startNs;
+    INT64               offsetNs;
+    INT64               nextNs;
+    INT64               deadlineNs;
+    INT64               wakeupNs;
+    INT64               doneNs;
+    UINT32              missed;
+    int                 retCode;
 #else
     VOS_TIMEVAL_T       now;
+    VOS_TIMEVAL_T       expected;
     VOS_TIMEVAL_T       priorCall;
     VOS_TIMEVAL_T       afterCall;
     UINT32              execTime;
@@ -265,19 +468,23 @@ static void vos_runCyclicThread (
     VOS_THREAD_FUNC_T   pFunction   = pParameters->pFunction;
     void *pArguments = pParameters->pArguments;
     VOS_TIMEVAL_T       startTime = pParameters->startTime;
+    VOS_CYCLIC_STATS_T  *pStats     = pParameters->pStats;
     CHAR8               name[16];
 
     vos_strncpy(name, pParameters->pName, 16);      /* for logging */
 
+    if (pParameters->prefaultSize != 0u)
+    {
+        vos_prefaultStack(pParameters->prefaultSize);
+    }
+
     vos_printLog(VOS_LOG_DBG, "thread parameters freed: %p\n", (void *) pParameters);
     vos_memFree(pParameters);
 
 #if defined(SCHED_DEADLINE) && defined (RT_THREADS)
-
-    UINT64  interval_ns = interval * NSECS_PER_USEC;
-    int     retCode;
     /* Cyclic tasks are real-time tasks (RTLinux only) */
     {
+        UINT64 interval_ns = (UINT64) interval * NSECS_PER_USEC;
         struct sched_attr rt_attribs;
         rt_attribs.size             = sizeof(struct sched_attr); /* Size of this structure */
         rt_attribs.sched_policy     = SCHED_DEADLINE; /* Policy (SCHED_*) */
@@ -288,65 +495,76 @@ static void vos_runCyclicThread (
         rt_attribs.sched_runtime    = interval_ns / 4u;
         rt_attribs.sched_deadline   = interval_ns / 2u;
         rt_attribs.sched_period     = interval_ns;
-        retCode = sched_setattr(0, &rt_attribs, 0);
-        if (retCode != 0)
+        if (sched_setattr(0, &rt_attribs, 0) != 0)
         {
             vos_printLog(VOS_LOG_ERROR,
                          "%s sched_setattr for policy %d failed (Err: %d)\n",
                          name,
                          (int)rt_attribs.sched_policy,
                          (int)errno);
+            vos_cyclicStatsFree(pStats);
             return;
         }
     }
+#endif
 
-    deadline.tv_sec     = startTime.tv_sec;
-    deadline.tv_nsec    = startTime.tv_usec * NSECS_PER_USEC;
+    pthread_cleanup_push(vos_cyclicStatsFree, pStats);
 
-    deadline.tv_nsec    += 7500000;
-    deadline.tv_sec     += deadline.tv_nsec / NSECS_PER_SEC;
-    deadline.tv_nsec    = deadline.tv_nsec % NSECS_PER_SEC;
+#ifdef VOS_CYCLIC_ABSTIME
+    /* The first deadline is the next point on the grid startTime + n * interval */
+    intervalNs  = (INT64) interval * NSECS_PER_USEC;
+    startNs     = (INT64) startTime.tv_sec * 1000000000 + (INT64) startTime.tv_usec * NSECS_PER_USEC;
+    nextNs      = vos_monotonicNs();
+    offsetNs    = (nextNs - startNs) % intervalNs;
+    if (offsetNs < 0)
+    {
+        offsetNs += intervalNs;
+    }
+    nextNs += intervalNs - offsetNs;
 
     for (;; )
     {
         /* Sleep until deadline */
-        while (clock_nanosleep(CLOCK_MONOTONIC, TIMER_ABSTIME, &deadline, NULL) != 0)
+        deadlineNs          = nextNs;
+        deadline.tv_sec     = (time_t) (deadlineNs / 1000000000);
+        deadline.tv_nsec    = (long) (deadlineNs % 1000000000);
+        while ((retCode = clock_nanosleep(CLOCK_MONOTONIC, TIMER_ABSTIME, &deadline, NULL)) != 0)
         {
-            if (errno != EINTR)
+            if (retCode != EINTR)
             {
                 vos_printLog(VOS_LOG_ERROR,
-                             "cyclic thread %s sleep error.\n",
-                             name);
+                             "cyclic thread %s sleep error (Err: %d).\n",
+                             name, retCode);
+                break;
             }
         }
+        wakeupNs = vos_monotonicNs();
         pFunction(pArguments);
+        doneNs = vos_monotonicNs();
 
-        /* calculate next deadline */
-        deadline.tv_nsec    += interval_ns;
-        deadline.tv_sec     += deadline.tv_nsec / NSECS_PER_SEC;
-        deadline.tv_nsec    = deadline.tv_nsec % NSECS_PER_SEC;
-
-        clock_gettime(CLOCK_MONOTONIC, &now);
-        if (now.tv_sec > deadline.tv_sec || (now.tv_sec == deadline.tv_sec && now.tv_nsec > deadline.tv_nsec))
+        /* calculate next deadline, skip the periods we have missed */
+        nextNs += intervalNs;
+        missed = 0u;
+        if (doneNs >= nextNs)
         {
-            /*severe error: cyclic task time violated*/
-            /* calculate next deadline */
-            deadline.tv_nsec    += interval_ns;
-            deadline.tv_sec     += deadline.tv_nsec / NSECS_PER_SEC;
-            deadline.tv_nsec    = deadline.tv_nsec % NSECS_PER_SEC;
-            /* Log the runtime violation */
+            missed  = (UINT32) ((doneNs - nextNs) / intervalNs) + 1u;
+            nextNs  += (INT64) missed * intervalNs;
             vos_printLog(VOS_LOG_WARNING,
-                         "cyclic thread with interval %u usec was running too long.\n",
-                         (unsigned int)interval);
+                         "cyclic thread %s with interval %u usec was running too long, %u period(s) missed.\n",
+                         name, (unsigned int)interval, (unsigned int)missed);
         }
+        vos_cyclicStatsAdd(pStats,
+                           (wakeupNs > deadlineNs) ? (UINT32) ((wakeupNs - deadlineNs) / NSECS_PER_USEC) : 0u,
+                           (UINT32) ((doneNs - wakeupNs) / NSECS_PER_USEC),
+                           missed);
         pthread_testcancel();
     }
-
 #else
     for (;; )
     {
         /* Synchronize with starttime */
         vos_getTime(&now);                      /* get initial time */
+        expected = now;
         vos_subTime(&now, &startTime);
 
         /* Wait for multiples of interval */
@@ -359,6 +577,9 @@ static void vos_runCyclicThread (
                          "waiting time > interval:  %u > %u usec!\n",
                          (unsigned int) waitingTime, (unsigned int) interval);
         }
+        expected.tv_usec += (INT32) waitingTime;
+        expected.tv_sec  += expected.tv_usec / 1000000;
+        expected.tv_usec %= 1000000;
 
         /* Idle for the difference */
         (void) vos_threadDelay(waitingTime);
@@ -369,6 +590,7 @@ static void vos_runCyclicThread (
 
         /* subtract in the pattern after - prior to get the runtime of function() */
         vos_subTime(&afterCall, &priorCall);
+        vos_subTime(&priorCall, &expected);
 
         /* afterCall holds now the time difference within a structure not compatible with interval */
         /* check if UINT32 fits to hold the waiting time value */
@@ -384,6 +606,10 @@ static void vos_runCyclicThread (
                              "cyclic thread with interval %u usec was running  %u usec\n",
                              (unsigned int)interval, (unsigned int)execTime);
             }
+            vos_cyclicStatsAdd(pStats,
+                               (priorCall.tv_sec == 0) ? (UINT32)priorCall.tv_usec : 0u,
+                               execTime,
+                               execTime / interval);
         }
         else
         {
@@ -398,6 +624,8 @@ static void vos_runCyclicThread (
         pthread_testcancel();
     }
 #endif
+
+    pthread_cleanup_pop(1);
 }
 
 /***********************************************************************************************************************
@@ -466,6 +694,7 @@ EXT_DECL VOS_ERR_T vos_threadCreateSync (
     pthread_t           hThread;
     pthread_attr_t      threadAttrib;
     struct sched_param  schedParam;  /* scheduling priority */
+    size_t              prefaultSize = 0u;
     int retCode;
 
     if (!vosThreadInitialised)
@@ -604,10 +833,42 @@ EXT_DECL VOS_ERR_T vos_threadCreateSync (
             (int)retCode );
         return VOS_THREAD_ERR;
     }
+
+#if defined(__linux__) && defined(_GNU_SOURCE)
+    /* Pin the thread from its very first instruction on */
+    if (gRtProfile.cpuSet != 0u)
+    {
+        cpu_set_t cpuSet;
+
+        vos_cpuSetToLinux(&cpuSet, gRtProfile.cpuSet);
+        retCode = pthread_attr_setaffinity_np(&threadAttrib, sizeof(cpuSet), &cpuSet);
+        if (retCode != 0)
+        {
+            vos_printLog(
+                VOS_LOG_WARNING,
+                "%s pthread_attr_setaffinity_np() failed (Err:%d)\n",
+                pName,
+                (int)retCode );
+        }
+    }
+#endif
+
+    /* Leave a quarter of the stack untouched for TLS, guard page and the thread's start frames */
+    if ((gRtProfile.prefaultStack == TRUE) &&
+        (pthread_attr_getstacksize(&threadAttrib, &prefaultSize) == 0))
+    {
+        prefaultSize = (prefaultSize / 4u) * 3u;
+    }
+    else
+    {
+        prefaultSize = 0u;
+    }
+
     if (interval > 0u)
     {
         /* malloc freed in vos_runCyclicThread */
-        VOS_THREAD_CYC_T *p_params = (VOS_THREAD_CYC_T *) vos_memAlloc(sizeof(VOS_THREAD_CYC_T));
+        VOS_THREAD_CYC_T    *p_params   = (VOS_THREAD_CYC_T *) vos_memAlloc(sizeof(VOS_THREAD_CYC_T));
+        VOS_CYCLIC_STATS_T  *pStats     = vos_cyclicStatsAlloc(interval);
 
         p_params->pName = pName;
         p_params->startTime.tv_sec  = 0;
@@ -615,6 +876,8 @@ EXT_DECL VOS_ERR_T vos_threadCreateSync (
         p_params->interval      = interval;
         p_params->pFunction     = pFunction;
         p_params->pArguments    = pArguments;
+        p_params->prefaultSize  = prefaultSize;
+        p_params->pStats        = pStats;
         vos_printLog(VOS_LOG_DBG, "thread parameters alloc: %p\n", (void *) p_params);
 
         if (pStartTime != NULL)
@@ -623,8 +886,39 @@ EXT_DECL VOS_ERR_T vos_threadCreateSync (
         }
         /* Create a cyclic thread */
         retCode = pthread_create(&hThread, &threadAttrib, (void *(*)(void *))vos_runCyclicThread, p_params);
+        /* p_params belongs to the new thread now */
+        if (pStats != NULL)
+        {
+            if (retCode == 0)
+            {
+                pStats->thread = hThread;
+            }
+            else
+            {
+                vos_cyclicStatsFree(pStats);
+            }
+        }
         (void) vos_threadDelay(10000u);
     }
+    else if (prefaultSize != 0u)
+    {
+        /* malloc freed in vos_runThread */
+        VOS_THREAD_CYC_T *p_params = (VOS_THREAD_CYC_T *) vos_memAlloc(sizeof(VOS_THREAD_CYC_T));
+
+        if (p_params == NULL)
+        {
+            (void) pthread_attr_destroy(&threadAttrib);
+            return VOS_MEM_ERR;
+        }
+        p_params->pName         = pName;
+        p_params->interval      = 0u;
+        p_params->pFunction     = pFunction;
+        p_params->pArguments    = pArguments;
+        p_params->prefaultSize  = prefaultSize;
+
+        /* Create the thread, it touches its stack before entering pFunction */
+        retCode = pthread_create(&hThread, &threadAttrib, (void *(*)(void *))vos_runThread, p_params);
+    }
     else
     {
 
@@ -739,6 +1033,248 @@ EXT_DECL VOS_ERR_T vos_threadIsActive (
     return (retValue == 0 ? VOS_NO_ERR : VOS_PARAM_ERR);
 }
 
+/**********************************************************************************************************************/
+/** Set the real-time profile.
+ *  Memory locking takes effect immediately. The CPU set and stack prefaulting apply to threads created by
+ *  vos_threadCreate()/vos_threadCreateSync() afterwards, the heap options to the next vos_memInit().
+ *
+ *  @param[in]      pProfile        Pointer to the profile
+ *  @retval         VOS_NO_ERR      no error
+ *  @retval         VOS_PARAM_ERR   parameter out of range/invalid
+ *  @retval         VOS_MEM_ERR     memory could not be locked
+ */
+
+EXT_DECL VOS_ERR_T vos_threadSetRtProfile (
+    const VOS_RT_PROFILE_T *pProfile)
+{
+    VOS_ERR_T err = VOS_NO_ERR;
+
+    if (pProfile == NULL)
+    {
+        return VOS_PARAM_ERR;
+    }
+
+    if (pProfile->lockMemory == TRUE)
+    {
+        if (mlockall(MCL_CURRENT | MCL_FUTURE) != 0)
+        {
+            vos_printLog(VOS_LOG_ERROR, "mlockall() failed (Err: %d)\n", (int)errno);
+            err = VOS_MEM_ERR;
+        }
+    }
+    else if (gRtProfile.lockMemory == TRUE)
+    {
+        (void) munlockall();
+    }
+
+    vos_memSetPoolMode(pProfile->prefaultHeap, pProfile->hugePages);
+    gRtProfile = *pProfile;
+
+    return err;
+}
+
+/**********************************************************************************************************************/
+/** Pin a thread to a set of CPUs.
+ *
+ *  @param[in]      thread          Thread handle (or NULL if current thread)
+ *  @param[in]      cpuSet          CPUs the thread may run on, bit n selects CPU n
+ *  @retval         VOS_NO_ERR      no error
+ *  @retval         VOS_PARAM_ERR   parameter out of range/invalid
+ *  @retval         VOS_THREAD_ERR  affinity could not be set
+ *  @retval         VOS_UNKNOWN_ERR not supported by the target
+ */
+
+EXT_DECL VOS_ERR_T vos_threadSetAffinity (
+    VOS_THREAD_T    thread,
+    VOS_CPU_SET_T   cpuSet)
+{
+#if defined(__linux__) && defined(_GNU_SOURCE)
+    cpu_set_t   linuxCpuSet;
+    pthread_t   hThread = (thread == NULL) ? pthread_self() : (pthread_t)thread;
+    int         retCode;
+
+    if (cpuSet == 0u)
+    {
+        return VOS_PARAM_ERR;
+    }
+
+    vos_cpuSetToLinux(&linuxCpuSet, cpuSet);
+    retCode = pthread_setaffinity_np(hThread, sizeof(linuxCpuSet), &linuxCpuSet);
+    if (retCode != 0)
+    {
+        vos_printLog(VOS_LOG_ERROR, "pthread_setaffinity_np() failed (Err: %d)\n", retCode);
+        return VOS_THREAD_ERR;
+    }
+    return VOS_NO_ERR;
+#else
+    (void) thread;
+    (void) cpuSet;
+    return VOS_UNKNOWN_ERR;
+#endif
+}
+
+/**********************************************************************************************************************/
+/** Route an interrupt to a set of CPUs.
+ *
+ *  @param[in]      irq             Interrupt number
+ *  @param[in]      cpuSet          CPUs allowed to serve the interrupt, bit n selects CPU n
+ *  @retval         VOS_NO_ERR      no error
+ *  @retval         VOS_PARAM_ERR   parameter out of range/invalid
+ *  @retval         VOS_IO_ERR      affinity could not be written
+ *  @retval         VOS_UNKNOWN_ERR not supported by the target
+ */
+
+EXT_DECL VOS_ERR_T vos_irqSetAffinity (
+    UINT32          irq,
+    VOS_CPU_SET_T   cpuSet)
+{
+#ifdef __linux__
+    CHAR8   fileName[64];
+    CHAR8   cpuList[256];
+    UINT32  cpu;
+    size_t  len = 0u;
+    FILE    *fp;
+    int     retCode;
+
+    if (cpuSet == 0u)
+    {
+        return VOS_PARAM_ERR;
+    }
+
+    cpuList[0] = '\0';
+    for (cpu = 0u; cpu < 64u; cpu++)
+    {
+        if ((cpuSet & ((VOS_CPU_SET_T)1u << cpu)) != 0u)
+        {
+            len += (size_t) snprintf(cpuList + len, sizeof(cpuList) - len, (len == 0u) ? "%u" : ",%u", cpu);
+        }
+    }
+
+    (void) snprintf(fileName, sizeof(fileName), "/proc/irq/%u/smp_affinity_list", (unsigned int)irq);
+    fp = fopen(fileName, "w");
+    if (fp == NULL)
+    {
+        vos_printLog(VOS_LOG_ERROR, "%s could not be opened (Err: %d)\n", fileName, (int)errno);
+        return VOS_IO_ERR;
+    }
+    retCode = fprintf(fp, "%s\n", cpuList);
+    if (fclose(fp) != 0 || retCode < 0)
+    {
+        vos_printLog(VOS_LOG_ERROR, "%s could not be written (Err: %d)\n", fileName, (int)errno);
+        return VOS_IO_ERR;
+    }
+    return VOS_NO_ERR;
+#else
+    (void) irq;
+    (void) cpuSet;
+    return VOS_UNKNOWN_ERR;
+#endif
+}
+
+/**********************************************************************************************************************/
+/** Get the timing statistics of cyclic threads.
+ *
+ *  @param[in]      thread          Thread handle of a cyclic thread (or NULL for the sum over all cyclic threads)
+ *  @param[out]     pStats          Pointer to the statistics
+ *  @retval         VOS_NO_ERR      no error
+ *  @retval         VOS_PARAM_ERR   parameter out of range/invalid, thread is not a cyclic thread
+ */
+
+EXT_DECL VOS_ERR_T vos_threadGetStatistics (
+    VOS_THREAD_T        thread,
+    VOS_THREAD_STATS_T  *pStats)
+{
+    UINT64  sumWakeup   = 0u;
+    UINT64  sumExec     = 0u;
+    UINT32  i;
+
+    if (pStats == NULL)
+    {
+        return VOS_PARAM_ERR;
+    }
+    memset(pStats, 0, sizeof(VOS_THREAD_STATS_T));
+
+    (void) pthread_mutex_lock(&gCyclicStatsMutex);
+    for (i = 0u; i < VOS_MAX_THREAD_CNT; i++)
+    {
+        const VOS_CYCLIC_STATS_T *pCyc = &gCyclicStats[i];
+
+        if ((pCyc->inUse == FALSE) ||
+            ((thread != NULL) && (pthread_equal(pCyc->thread, (pthread_t)thread) == 0)))
+        {
+            continue;
+        }
+        if ((pCyc->numCycles != 0u) &&
+            ((pStats->numCycles == 0u) || (pCyc->minWakeup < pStats->minWakeupLatency)))
+        {
+            pStats->minWakeupLatency = pCyc->minWakeup;
+        }
+        if (pCyc->maxWakeup > pStats->maxWakeupLatency)
+        {
+            pStats->maxWakeupLatency = pCyc->maxWakeup;
+        }
+        if (pCyc->maxExec > pStats->maxExecTime)
+        {
+            pStats->maxExecTime = pCyc->maxExec;
+        }
+        pStats->interval    = (pStats->numThreads == 0u) ? pCyc->interval : 0u;
+        pStats->numThreads++;
+        pStats->numCycles   += pCyc->numCycles;
+        pStats->numMissed   += pCyc->numMissed;
+        sumWakeup           += pCyc->sumWakeup;
+        sumExec             += pCyc->sumExec;
+    }
+    (void) pthread_mutex_unlock(&gCyclicStatsMutex);
+
+    if (pStats->numCycles != 0u)
+    {
+        pStats->avgWakeupLatency    = (UINT32) (sumWakeup / pStats->numCycles);
+        pStats->avgExecTime         = (UINT32) (sumExec / pStats->numCycles);
+    }
+    if ((thread != NULL) && (pStats->numThreads == 0u))
+    {
+        return VOS_PARAM_ERR;
+    }
+    return VOS_NO_ERR;
+}
+
+/**********************************************************************************************************************/
+/** Reset the timing statistics of cyclic threads.
+ *
+ *  @param[in]      thread          Thread handle of a cyclic thread (or NULL for all cyclic threads)
+ *  @retval         VOS_NO_ERR      no error
+ *  @retval         VOS_PARAM_ERR   thread is not a cyclic thread
+ */
+
+EXT_DECL VOS_ERR_T vos_threadResetStatistics (
+    VOS_THREAD_T thread)
+{
+    VOS_ERR_T   err = (thread == NULL) ? VOS_NO_ERR : VOS_PARAM_ERR;
+    UINT32      i;
+
+    (void) pthread_mutex_lock(&gCyclicStatsMutex);
+    for (i = 0u; i < VOS_MAX_THREAD_CNT; i++)
+    {
+        VOS_CYCLIC_STATS_T *pCyc = &gCyclicStats[i];
+
+        if ((pCyc->inUse == FALSE) ||
+            ((thread != NULL) && (pthread_equal(pCyc->thread, (pthread_t)thread) == 0)))
+        {
+            continue;
+        }
+        pCyc->numCycles = 0u;
+        pCyc->numMissed = 0u;
+        pCyc->minWakeup = 0u;
+        pCyc->maxWakeup = 0u;
+        pCyc->sumWakeup = 0u;
+        pCyc->maxExec   = 0u;
+        pCyc->sumExec   = 0u;
+        err = VOS_NO_ERR;
+    }
+    (void) pthread_mutex_unlock(&gCyclicStatsMutex);
+    return err;
+}
+
 /**********************************************************************************************************************/
 /** Return thread handle of calling task
  *
@@ -20,6 +20,13 @@
 /*
 * $Id$*
 *
+*      AG 2026-10-19: vos_sockSetBusyPoll() stub
+*      AG 2026-10-19: vos_sockSendUDPBatch() (one by one)
+*      AG 2026-10-19: vos_sockSendUDPV() / vos_sockSendTCPV() (copying), zero copy stubs
+*      AG 2026-10-19: vos_sockSetPayloadFilter() stub
+*      AG 2026-10-19: vos_sockReceiveUDPStamped() (stack time stamp)
+*      AG 2026-10-19: vos_sockSendUDPAt(): stampId parameter
+*      AG 2026-10-19: vos_sockSendUDPAt() / vos_sockReceiveTxStamp() stubs
 *      A 2019-12-18: Ticket #307: Avoid vos functions to block TimeSync
 *      A 2019-12-18: Ticket #295: vos_sockSendUDP some times report err 183 in Windows Sim
 *      A 2019-11-11: Ticket #290: Add support for Virtualization on Windows
@@ -1110,6 +1117,66 @@ EXT_DECL VOS_ERR_T vos_sockSendUDP (
     return VOS_NO_ERR;
 }
 
+/**********************************************************************************************************************/
+/** Send UDP data at a given time.
+ *  Launch times are not supported on this target, the packet is sent immediately.
+ *
+ *  @param[in]      sock            socket descriptor
+ *  @param[in]      pBuffer         pointer to data to send
+ *  @param[in,out]  pSize           In: size of the data to send, Out: no of bytes sent
+ *  @param[in]      ipAddress       destination IP
+ *  @param[in]      port            destination port
+ *  @param[in]      pTxTime         launch time (ignored)
+ *  @param[in]      stampId         key of the TX timestamp (ignored)
+ *  @param[out]     pStampIdSet     always FALSE, may be NULL
+ *
+ *  @retval         VOS_NO_ERR      no error
+ *  @retval         VOS_PARAM_ERR   sock descriptor unknown, parameter error
+ *  @retval         VOS_IO_ERR      data could not be sent
+ *  @retval         VOS_BLOCK_ERR   Call would have blocked in blocking mode
+ */
+
+EXT_DECL VOS_ERR_T vos_sockSendUDPAt (
+    SOCKET              sock,
+    const UINT8         *pBuffer,
+    UINT32              *pSize,
+    UINT32              ipAddress,
+    UINT16              port,
+    const VOS_TIMEVAL_T *pTxTime,
+    UINT32              stampId,
+    BOOL8               *pStampIdSet)
+{
+    (void) pTxTime;
+    (void) stampId;
+    if (pStampIdSet != NULL)
+    {
+        *pStampIdSet = FALSE;
+    }
+    return vos_sockSendUDP(sock, pBuffer, pSize, ipAddress, port);
+}
+
+/**********************************************************************************************************************/
+/** Fetch the next TX completion timestamp of a socket.
+ *  TX timestamps are not supported on this target.
+ *
+ *  @param[in]      sock            socket descriptor
+ *  @param[out]     pId             number of the packet the timestamp belongs to
+ *  @param[out]     pTxStamp        time the packet left the host
+ *
+ *  @retval         VOS_UNKNOWN_ERR not supported on this target
+ */
+
+EXT_DECL VOS_ERR_T vos_sockReceiveTxStamp (
+    SOCKET          sock,
+    UINT32          *pId,
+    VOS_TIMEVAL_T   *pTxStamp)
+{
+    (void) sock;
+    (void) pId;
+    (void) pTxStamp;
+    return VOS_UNKNOWN_ERR;
+}
+
 /**********************************************************************************************************************/
 /** Receive UDP data.
  *  The caller must provide a sufficient sized buffer. If the supplied buffer is smaller than the bytes received, *pSize
@@ -1240,6 +1307,47 @@ EXT_DECL VOS_ERR_T vos_sockReceiveUDP (
 
 }
 
+/**********************************************************************************************************************/
+/** Receive UDP data together with its arrival time.
+ *  Kernel receive timestamps are not supported on this target, the time of reception by the stack is reported.
+ *
+ *  @param[in]      sock            socket descriptor
+ *  @param[out]     pBuffer         pointer to applications data buffer
+ *  @param[in,out]  pSize           pointer to the received data size
+ *  @param[out]     pSrcIPAddr      pointer to source IP
+ *  @param[out]     pSrcIPPort      pointer to source port
+ *  @param[out]     pDstIPAddr      pointer to dest IP
+ *  @param[out]     pRxTime         pointer to arrival time
+ *  @param[in]      peek            if true, leave data in queue
+ *
+ *  @retval         VOS_NO_ERR      no error
+ *  @retval         VOS_PARAM_ERR   sock descriptor unknown, parameter error
+ *  @retval         VOS_IO_ERR      data could not be read
+ *  @retval         VOS_NODATA_ERR  no data
+ *  @retval         VOS_BLOCK_ERR   Call would have blocked in blocking mode
+ */
+
+EXT_DECL VOS_ERR_T vos_sockReceiveUDPStamped (
+    SOCKET          sock,
+    UINT8           *pBuffer,
+    UINT32          *pSize,
+    UINT32          *pSrcIPAddr,
+    UINT16          *pSrcIPPort,
+    UINT32          *pDstIPAddr,
+    VOS_TIMEVAL_T   *pRxTime,
+    BOOL8           peek)
+{
+    VOS_ERR_T err;
+
+    if (pRxTime == NULL)
+    {
+        return VOS_PARAM_ERR;
+    }
+    err = vos_sockReceiveUDP(sock, pBuffer, pSize, pSrcIPAddr, pSrcIPPort, pDstIPAddr, peek);
+    vos_getTime(pRxTime);
+    return err;
+}
+
 /**********************************************************************************************************************/
 /** Bind a socket to an address and port.
  *
@@ -1559,6 +1667,199 @@ EXT_DECL VOS_ERR_T vos_sockSendTCP (
     return VOS_NO_ERR;
 }
 
+/**********************************************************************************************************************/
+/** Gather the buffers of a scatter/gather send into one buffer.
+ *
+ *  @param[in]      pIov            buffers to send
+ *  @param[in]      noOfIov         number of buffers
+ *  @param[out]     pSize           total size
+ *
+ *  @retval         buffer (to be freed by vos_memFree) or NULL
+ */
+static UINT8 *vos_sockGather (
+    const VOS_IOVEC_T   *pIov,
+    UINT32              noOfIov,
+    UINT32              *pSize)
+{
+    UINT8   *pBuffer;
+    UINT32  size = 0u;
+    UINT32  i;
+
+    for (i = 0u; i < noOfIov; i++)
+    {
+        size += pIov[i].size;
+    }
+    pBuffer = (UINT8 *) vos_memAlloc(size);
+    if (pBuffer != NULL)
+    {
+        size = 0u;
+        for (i = 0u; i < noOfIov; i++)
+        {
+            memcpy(pBuffer + size, pIov[i].pBuffer, pIov[i].size);
+            size += pIov[i].size;
+        }
+        *pSize = size;
+    }
+    return pBuffer;
+}
+
+/**********************************************************************************************************************/
+/** Send UDP data from several buffers as one datagram.
+ *  No scatter/gather support on this target: the buffers are copied, zero copy is never used.
+ *
+ *  @param[in]      sock            socket descriptor
+ *  @param[in]      pIov            buffers to send
+ *  @param[in]      noOfIov         number of buffers (max. VOS_MAX_IOV)
+ *  @param[in,out]  pSize           In: total size of the data to send, Out: no of bytes sent
+ *  @param[in]      ipAddress       destination IP
+ *  @param[in]      port            destination port
+ *  @param[in,out]  pZeroCopy       In: try zero copy, Out: always FALSE
+ *
+ *  @retval         VOS_NO_ERR      no error
+ *  @retval         VOS_PARAM_ERR   sock descriptor unknown, parameter error
+ *  @retval         VOS_MEM_ERR     out of memory
+ *  @retval         VOS_IO_ERR      data could not be sent
+ *  @retval         VOS_BLOCK_ERR   Call would have blocked in blocking mode
+ */
+
+EXT_DECL VOS_ERR_T vos_sockSendUDPV (
+    SOCKET              sock,
+    const VOS_IOVEC_T   *pIov,
+    UINT32              noOfIov,
+    UINT32              *pSize,
+    UINT32              ipAddress,
+    UINT16              port,
+    BOOL8               *pZeroCopy)
+{
+    VOS_ERR_T   err;
+    UINT8       *pBuffer;
+
+    if (pIov == NULL || pSize == NULL || noOfIov == 0u || noOfIov > VOS_MAX_IOV)
+    {
+        return VOS_PARAM_ERR;
+    }
+    if (pZeroCopy != NULL)
+    {
+        *pZeroCopy = FALSE;
+    }
+    pBuffer = vos_sockGather(pIov, noOfIov, pSize);
+    if (pBuffer == NULL)
+    {
+        return VOS_MEM_ERR;
+    }
+    err = vos_sockSendUDP(sock, pBuffer, pSize, ipAddress, port);
+    vos_memFree(pBuffer);
+    return err;
+}
+
+/**********************************************************************************************************************/
+/** Send several UDP datagrams with one call (sent one by one on this target).
+ *  Datagrams are sent in order, sending stops at the first one which could not be sent.
+ *
+ *  @param[in]      sock            socket descriptor
+ *  @param[in,out]  pMsg            datagrams to send, the size sent is returned per datagram
+ *  @param[in,out]  pNoOfMsg        In: number of datagrams (max. VOS_MAX_UDP_BATCH), Out: number of datagrams sent
+ *
+ *  @retval         VOS_NO_ERR      at least one datagram was sent
+ *  @retval         VOS_PARAM_ERR   sock descriptor unknown, parameter error
+ *  @retval         VOS_MEM_ERR     out of memory
+ *  @retval         VOS_IO_ERR      data could not be sent
+ *  @retval         VOS_BLOCK_ERR   Call would have blocked in blocking mode
+ */
+
+EXT_DECL VOS_ERR_T vos_sockSendUDPBatch (
+    SOCKET          sock,
+    VOS_UDP_MSG_T   *pMsg,
+    UINT32          *pNoOfMsg)
+{
+    UINT32      i;
+    VOS_ERR_T   err = VOS_NO_ERR;
+
+    if (pMsg == NULL || pNoOfMsg == NULL || *pNoOfMsg == 0u || *pNoOfMsg > VOS_MAX_UDP_BATCH)
+    {
+        return VOS_PARAM_ERR;
+    }
+    for (i = 0u; (i < *pNoOfMsg) && (err == VOS_NO_ERR); i++)
+    {
+        UINT32 j;
+        pMsg[i].size = 0u;
+        for (j = 0u; j < pMsg[i].noOfIov; j++)
+        {
+            pMsg[i].size += pMsg[i].pIov[j].size;
+        }
+        err = vos_sockSendUDPV(sock, pMsg[i].pIov, pMsg[i].noOfIov, &pMsg[i].size, pMsg[i].ipAddress,
+                               pMsg[i].port, NULL);
+    }
+    if (err != VOS_NO_ERR)
+    {
+        i--;
+    }
+    *pNoOfMsg = i;
+    return (i > 0u) ? VOS_NO_ERR : err;
+}
+
+/**********************************************************************************************************************/
+/** Send TCP data from several buffers.
+ *  No scatter/gather support on this target: the buffers are copied, zero copy is never used.
+ *
+ *  @param[in]      sock            socket descriptor
+ *  @param[in]      pIov            buffers to send
+ *  @param[in]      noOfIov         number of buffers (max. VOS_MAX_IOV)
+ *  @param[in,out]  pSize           In: total size of the data to send, Out: no of bytes sent
+ *  @param[in,out]  pZeroCopy       In: try zero copy, Out: always FALSE
+ *
+ *  @retval         VOS_NO_ERR      no error
+ *  @retval         VOS_PARAM_ERR   sock descriptor unknown, parameter error
+ *  @retval         VOS_MEM_ERR     out of memory
+ *  @retval         VOS_IO_ERR      data could not be sent
+ *  @retval         VOS_NOCONN_ERR  no TCP connection
+ *  @retval         VOS_BLOCK_ERR   call would have blocked in blocking mode, data partially sent
+ */
+
+EXT_DECL VOS_ERR_T vos_sockSendTCPV (
+    SOCKET              sock,
+    const VOS_IOVEC_T   *pIov,
+    UINT32              noOfIov,
+    UINT32              *pSize,
+    BOOL8               *pZeroCopy)
+{
+    VOS_ERR_T   err;
+    UINT8       *pBuffer;
+
+    if (pIov == NULL || pSize == NULL || noOfIov == 0u || noOfIov > VOS_MAX_IOV)
+    {
+        return VOS_PARAM_ERR;
+    }
+    if (pZeroCopy != NULL)
+    {
+        *pZeroCopy = FALSE;
+    }
+    pBuffer = vos_sockGather(pIov, noOfIov, pSize);
+    if (pBuffer == NULL)
+    {
+        return VOS_MEM_ERR;
+    }
+    err = vos_sockSendTCP(sock, pBuffer, pSize);
+    vos_memFree(pBuffer);
+    return err;
+}
+
+EXT_DECL VOS_ERR_T vos_sockEnableZeroCopy (
+    SOCKET sock)
+{
+    (void) sock;
+    return VOS_UNKNOWN_ERR;
+}
+
+EXT_DECL VOS_ERR_T vos_sockReceiveZeroCopy (
+    SOCKET  sock,
+    UINT32  *pDone)
+{
+    (void) sock;
+    (void) pDone;
+    return VOS_UNKNOWN_ERR;
+}
+
 /**********************************************************************************************************************/
 /** Receive TCP data.
  *  The caller must provide a sufficient sized buffer. If the supplied buffer is smaller than the bytes received, *pSize
@@ -1652,6 +1953,54 @@ EXT_DECL VOS_ERR_T vos_sockReceiveTCP (
 }
 
 
+/**********************************************************************************************************************/
+/** Drop unwanted UDP datagrams in the kernel.
+ *  Not supported on this target.
+ *
+ *  @param[in]      sock               socket descriptor
+ *  @param[in]      keyOffset          payload offset of the key
+ *  @param[in]      pKeys              keys to pass, NULL removes the filter
+ *  @param[in]      noOfKeys           number of keys
+ *  @param[in]      bypassOffset       payload offset of the bypass field
+ *  @param[in]      bypassValue        value of the bypass field to pass regardless of the key
+ *
+ *  @retval         VOS_UNKNOWN_ERR    not supported on this target
+ */
+EXT_DECL VOS_ERR_T vos_sockSetPayloadFilter (
+    SOCKET          sock,
+    UINT32          keyOffset,
+    const UINT32    *pKeys,
+    UINT32          noOfKeys,
+    UINT32          bypassOffset,
+    UINT16          bypassValue)
+{
+    (void) sock;
+    (void) keyOffset;
+    (void) pKeys;
+    (void) noOfKeys;
+    (void) bypassOffset;
+    (void) bypassValue;
+    return VOS_UNKNOWN_ERR;
+}
+
+/**********************************************************************************************************************/
+/** Busy poll the device queue on receive.
+ *  Not supported on this target.
+ *
+ *  @param[in]      sock               socket descriptor
+ *  @param[in]      busyPollTime       time to poll in us, 0 to switch busy polling off
+ *
+ *  @retval         VOS_UNKNOWN_ERR    not supported on this target
+ */
+EXT_DECL VOS_ERR_T vos_sockSetBusyPoll (
+    SOCKET  sock,
+    UINT32  busyPollTime)
+{
+    (void) sock;
+    (void) busyPollTime;
+    return VOS_UNKNOWN_ERR;
+}
+
 /**********************************************************************************************************************/
 /** Set Using Multicast I/F
  *
@@ -20,6 +20,8 @@
 /*
 * $Id$
 *
+*      AG 2026-10-19: Cyclic thread statistics API stubs
+*      AG 2026-10-19: Real-time profile API stubs
 *      A 2019-12-18: Ticket #307: Avoid vos functions to block TimeSync
 *      A 2019-12-17: Ticket #306: Improve TerminateThread in SIM 
 *      A 2019-11-11: Ticket #290: Add support for Virtualization on Windows
@@ -913,6 +915,90 @@ EXT_DECL VOS_ERR_T vos_threadIsActive (VOS_THREAD_T thread)
     return VOS_PARAM_ERR;
 }
 
+/**********************************************************************************************************************/
+/** Set the real-time profile.
+ *  Not supported on this target.
+ *
+ *  @param[in]      pProfile        Pointer to the profile
+ *  @retval         VOS_UNKNOWN_ERR not supported
+ */
+
+EXT_DECL VOS_ERR_T vos_threadSetRtProfile (
+    const VOS_RT_PROFILE_T *pProfile)
+{
+    (void) pProfile;
+    return VOS_UNKNOWN_ERR;
+}
+
+/**********************************************************************************************************************/
+/** Pin a thread to a set of CPUs.
+ *  Not supported on this target.
+ *
+ *  @param[in]      thread          Thread handle (or NULL if current thread)
+ *  @param[in]      cpuSet          CPUs the thread may run on, bit n selects CPU n
+ *  @retval         VOS_UNKNOWN_ERR not supported
+ */
+
+EXT_DECL VOS_ERR_T vos_threadSetAffinity (
+    VOS_THREAD_T    thread,
+    VOS_CPU_SET_T   cpuSet)
+{
+    (void) thread;
+    (void) cpuSet;
+    return VOS_UNKNOWN_ERR;
+}
+
+/**********************************************************************************************************************/
+/** Route an interrupt to a set of CPUs.
+ *  Not supported on this target.
+ *
+ *  @param[in]      irq             Interrupt number
+ *  @param[in]      cpuSet          CPUs allowed to serve the interrupt, bit n selects CPU n
+ *  @retval         VOS_UNKNOWN_ERR not supported
+ */
+
+EXT_DECL VOS_ERR_T vos_irqSetAffinity (
+    UINT32          irq,
+    VOS_CPU_SET_T   cpuSet)
+{
+    (void) irq;
+    (void) cpuSet;
+    return VOS_UNKNOWN_ERR;
+}
+
+/**********************************************************************************************************************/
+/** Get the timing statistics of cyclic threads.
+ *  Not supported on this target.
+ *
+ *  @param[in]      thread          Thread handle of a cyclic thread (or NULL for the sum over all cyclic threads)
+ *  @param[out]     pStats          Pointer to the statistics
+ *  @retval         VOS_UNKNOWN_ERR not supported
+ */
+
+EXT_DECL VOS_ERR_T vos_threadGetStatistics (
+    VOS_THREAD_T        thread,
+    VOS_THREAD_STATS_T  *pStats)
+{
+    (void) thread;
+    (void) pStats;
+    return VOS_UNKNOWN_ERR;
+}
+
+/**********************************************************************************************************************/
+/** Reset the timing statistics of cyclic threads.
+ *  Not supported on this target.
+ *
+ *  @param[in]      thread          Thread handle of a cyclic thread (or NULL for all cyclic threads)
+ *  @retval         VOS_UNKNOWN_ERR not supported
+ */
+
+EXT_DECL VOS_ERR_T vos_threadResetStatistics (
+    VOS_THREAD_T thread)
+{
+    (void) thread;
+    return VOS_UNKNOWN_ERR;
+}
+
 /**********************************************************************************************************************/
 /** Return thread handle of calling task
 *
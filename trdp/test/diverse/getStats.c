@@ -16,6 +16,7 @@
  *
  * $Id$
  *
+ *      AG 2026-10-19: Histogram summaries and thread statistics behind the standard statistics parsed
  *      BL 2019-02-01: Ticket #234 Correcting Statistics ComIds
  *      BL 2017-06-30: Compiler warnings, local prototypes added
  *      BL 2016-06-08: Ticket #120: ComIds for statistics changed to proposed 61375 errata
@@ -79,6 +80,7 @@ void dbgOut (void           *pRefCon,
              const CHAR8    *pMsgStr);
 void    usage (const char *appName);
 void    print_stats (TRDP_STATISTICS_T *pData);
+void    print_ext_stats (const UINT8 *pData, UINT32 dataSize);
 
 /**********************************************************************************************************************/
 
@@ -146,6 +148,67 @@ void print_stats (
     printf("----------------------------------------------------------------------------------------------------\n\n");
 }
 
+/**********************************************************************************************************************/
+/** Print the part of the reply behind TRDP_STATISTICS_T: histogram summaries and thread statistics
+ *
+ *  @param[in]      pData           pointer to the data behind TRDP_STATISTICS_T
+ *  @param[in]      dataSize        size of that data (0 for replies of earlier versions)
+ */
+void print_ext_stats (
+    const UINT8 *pData,
+    UINT32      dataSize)
+{
+    UINT32                      i, numHisto;
+    TRDP_HISTO_SUMMARY_T        summary;
+    TRDP_THREAD_STATISTICS_T    thread;
+
+    if (dataSize < sizeof(UINT32))
+    {
+        return;
+    }
+    memcpy(&numHisto, pData, sizeof(UINT32));
+    numHisto    = vos_ntohl(numHisto);
+    pData       += sizeof(UINT32);
+    dataSize    -= sizeof(UINT32);
+    if (numHisto > dataSize / sizeof(TRDP_HISTO_SUMMARY_T))
+    {
+        printf("Invalid number of histogram summaries: %u\n", numHisto);
+        return;
+    }
+
+    printf("histograms:         %u\n", numHisto);
+    for (i = 0; i < numHisto; i++)
+    {
+        memcpy(&summary, pData, sizeof(TRDP_HISTO_SUMMARY_T));
+        pData       += sizeof(TRDP_HISTO_SUMMARY_T);
+        dataSize    -= sizeof(TRDP_HISTO_SUMMARY_T);
+        printf("  %s comId %u: count %u, min %u, max %u, mean %u, p50 %u, p99 %u, p999 %u\n",
+               (vos_ntohl(summary.type) == 0u) ? "sub" : "pub",
+               vos_ntohl(summary.comId),
+               vos_ntohl(summary.count),
+               vos_ntohl(summary.min),
+               vos_ntohl(summary.max),
+               vos_ntohl(summary.mean),
+               vos_ntohl(summary.p50),
+               vos_ntohl(summary.p99),
+               vos_ntohl(summary.p999));
+    }
+
+    if (dataSize < sizeof(TRDP_THREAD_STATISTICS_T))
+    {
+        return;
+    }
+    memcpy(&thread, pData, sizeof(TRDP_THREAD_STATISTICS_T));
+    printf("thread.numThreads:  %u\n", vos_ntohl(thread.numThreads));
+    printf("thread.numCycles:   %u\n", vos_ntohl(thread.numCycles));
+    printf("thread.numMissed:   %u\n", vos_ntohl(thread.numMissed));
+    printf("thread.maxWakeup:   %u\n", vos_ntohl(thread.maxWakeupLatency));
+    printf("thread.avgWakeup:   %u\n", vos_ntohl(thread.avgWakeupLatency));
+    printf("thread.maxExecTime: %u\n", vos_ntohl(thread.maxExecTime));
+    printf("thread.avgExecTime: %u\n", vos_ntohl(thread.avgExecTime));
+    printf("----------------------------------------------------------------------------------------------------\n\n");
+}
+
 /* Print a sensible usage message */
 void usage (const char *appName)
 {
@@ -219,9 +282,13 @@ void myPDcallBack (
                memcpy(&gBuffer, pData,
                       ((sizeof(gBuffer) <
                         dataSize) ? sizeof(gBuffer) : dataSize));
-               if (pMsg->comId == TRDP_STATISTICS_PULL_COMID)
+               if ((pMsg->comId == TRDP_STATISTICS_PULL_COMID) && (dataSize >= sizeof(gBuffer)))
                {
                    print_stats(&gBuffer);
+                   if (dataSize > sizeof(gBuffer))
+                   {
+                       print_ext_stats(pData + sizeof(gBuffer), dataSize - (UINT32) sizeof(gBuffer));
+                   }
                    gKeepOnRunning = FALSE;
                }
            }
@@ -0,0 +1,465 @@
+/**********************************************************************************************************************/
+/**
+ * @file            vos-queue-bench.c
+ *
+ * @brief           Throughput benchmark for the VOS message queues
+ *
+ * @details         Several sender threads pass a number of messages each through one queue to several receiver
+ *                  threads. This is done for the mutex/semaphore based queue (vos_queueCreate) and the lock-free
+ *                  queue (vos_queueCreateLockFree), as FIFO and as LIFO, and with a single sender and receiver also
+ *                  for the lock-free single producer/single consumer FIFO.
+ *                  Every message carries its sender and sequence number: the receivers check that no message is lost
+ *                  or duplicated and, for FIFOs, that the messages of one sender arrive in order.
+ *
+ * @note            Project: TCNOpen TRDP prototype stack
+ *
+ * @author          agent
+ *
+ * @remarks This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0.
+ *          If a copy of the MPL was not distributed with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ *          Copyright agent, 2026. All rights reserved.
+ *
+ * $Id$
+ *
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdint.h>
+
+#if defined (POSIX)
+#include <unistd.h>
+#endif
+
+#include "vos_types.h"
+#include "vos_utils.h"
+#include "vos_mem.h"
+#include "vos_thread.h"
+
+/***********************************************************************************************************************
+ * DEFINITIONS
+ */
+#define APP_VERSION         "1.0"
+
+#define QB_DEFAULT_COUNT    200000u         /* messages per sender      */
+#define QB_DEFAULT_SIZE     256u            /* queue size               */
+#define QB_DEFAULT_THREADS  2u
+#define QB_MAX_THREADS      16u
+#define QB_MAX_COUNT        0xFFFFFFu       /* sequence bits of a message */
+#define QB_WAIT_TIME        1000u           /* us, receive timeout      */
+#define QB_POLL_TIME        100u            /* us, main thread polls the progress */
+#define QB_IDLE_LIMIT       10000u          /* polls without progress until giving up */
+
+/* A message is no pointer to data, but sender << 24 | sequence (1...count) */
+#define QB_MSG(sender, seq) ((UINT8 *) (uintptr_t) ((((UINT32) (sender) + 1u) << 24) | (seq)))
+#define QB_SENDER(pMsg)     ((UINT32) ((uintptr_t) (pMsg) >> 24) - 1u)
+#define QB_SEQ(pMsg)        ((UINT32) (uintptr_t) (pMsg) & QB_MAX_COUNT)
+
+typedef struct
+{
+    VOS_THREAD_T    thread;
+    UINT32          id;
+    UINT32          count;          /* sender: sent, receiver: received */
+    UINT32          errors;
+    UINT32          lastSeq[QB_MAX_THREADS];
+    UINT64          seqSum[QB_MAX_THREADS];
+    volatile BOOL8  done;
+} QB_WORKER_T;
+
+typedef struct
+{
+    const CHAR8         *pName;
+    BOOL8               lockFree;
+    VOS_QUEUE_POLICY_T  policy;
+    UINT32              flags;
+} QB_VARIANT_T;
+
+/***********************************************************************************************************************
+ * GLOBALS
+ */
+static QB_WORKER_T      gSender[QB_MAX_THREADS];
+static QB_WORKER_T      gReceiver[QB_MAX_THREADS];
+static VOS_QUEUE_T      gQueue;
+static BOOL8            gFifo;
+static UINT32           gCount      = QB_DEFAULT_COUNT;
+static volatile BOOL8   gRun        = FALSE;
+static volatile BOOL8   gStop       = FALSE;
+static BOOL8            gVerbose    = FALSE;
+
+/***********************************************************************************************************************
+ * PROTOTYPES
+ */
+static void dbgOut (void *, VOS_LOG_T, const CHAR8 *, const CHAR8 *, UINT16, const CHAR8 *);
+static void usage (const char *);
+static void sendThread (void *);
+static void receiveThread (void *);
+
+/**********************************************************************************************************************/
+/** callback routine for VOS logging/error output
+ *
+ *  @param[in]      pRefCon          user supplied context pointer
+ *  @param[in]      category         Log category (Error, Warning, Info etc.)
+ *  @param[in]      pTime            pointer to NULL-terminated string of time stamp
+ *  @param[in]      pFile            pointer to NULL-terminated string of source module
+ *  @param[in]      lineNumber       line
+ *  @param[in]      pMsgStr          pointer to NULL-terminated string
+ *  @retval         none
+ */
+static void dbgOut (
+    void        *pRefCon,
+    VOS_LOG_T   category,
+    const CHAR8 *pTime,
+    const CHAR8 *pFile,
+    UINT16      lineNumber,
+    const CHAR8 *pMsgStr)
+{
+    const char *catStr[] = {"**Error:", "Warning:", "   Info:", "  Debug:", "   User:"};
+
+    (void) pRefCon;
+    printf("%s %s %s:%d %s",
+           strrchr(pTime, '-') + 1,
+           catStr[category],
+           strrchr(pFile, VOS_DIR_SEP) + 1,
+           lineNumber,
+           pMsgStr);
+}
+
+/**********************************************************************************************************************/
+/* Print a sensible usage message */
+static void usage (const char *appName)
+{
+    printf("Usage of %s\n", appName);
+    printf("This tool passes messages from sender to receiver threads through the VOS queues\n"
+           "and reports the achieved message rate of each queue variant. Arguments are:\n"
+           "-n <number of sender threads> (default %u, max. %u)\n"
+           "-r <number of receiver threads> (default %u, max. %u)\n"
+           "-c <messages per sender> (default %u, max. %u)\n"
+           "-q <queue size> (default %u)\n"
+           "-b lock-free senders wait while the queue is full (VOS_QUEUE_FLAG_BLOCK) instead of yielding\n"
+           "-d verbose output (also queue full errors)\n"
+           "-h print usage\n",
+           QB_DEFAULT_THREADS, QB_MAX_THREADS, QB_DEFAULT_THREADS, QB_MAX_THREADS,
+           QB_DEFAULT_COUNT, QB_MAX_COUNT, QB_DEFAULT_SIZE);
+}
+
+/**********************************************************************************************************************/
+/** Sender thread: queue gCount messages, yield while the queue is full
+ *
+ *  @param[in]      pArg        pointer to the worker
+ *  @retval         none
+ */
+static void sendThread (
+    void *pArg)
+{
+    QB_WORKER_T *pWorker = (QB_WORKER_T *) pArg;
+    UINT32      seq;
+    VOS_ERR_T   err;
+
+    while (gRun == FALSE)
+    {
+        (void) vos_threadDelay(1000u);
+    }
+    for (seq = 1u; seq <= gCount; seq++)
+    {
+        while ((err = vos_queueSend(gQueue, QB_MSG(pWorker->id, seq), 1u)) == VOS_QUEUE_FULL_ERR)
+        {
+            (void) vos_threadDelay(0u);
+        }
+        if (err != VOS_NO_ERR)
+        {
+            pWorker->errors++;
+        }
+        else
+        {
+            pWorker->count++;
+        }
+    }
+    pWorker->done = TRUE;
+}
+
+/**********************************************************************************************************************/
+/** Receiver thread: take messages until told to stop, check them
+ *
+ *  @param[in]      pArg        pointer to the worker
+ *  @retval         none
+ */
+static void receiveThread (
+    void *pArg)
+{
+    QB_WORKER_T *pWorker = (QB_WORKER_T *) pArg;
+    UINT8       *pMsg;
+    UINT32      size;
+    UINT32      sender;
+
+    while (gRun == FALSE)
+    {
+        (void) vos_threadDelay(1000u);
+    }
+    while (gStop == FALSE)
+    {
+        if (vos_queueReceive(gQueue, &pMsg, &size, QB_WAIT_TIME) != VOS_NO_ERR)
+        {
+            continue;
+        }
+        sender = QB_SENDER(pMsg);
+        if ((sender >= QB_MAX_THREADS) || (size != 1u))
+        {
+            pWorker->errors++;
+            continue;
+        }
+        /* Messages of one sender must not overtake each other in a FIFO */
+        if ((gFifo == TRUE) && (QB_SEQ(pMsg) <= pWorker->lastSeq[sender]))
+        {
+            pWorker->errors++;
+        }
+        pWorker->lastSeq[sender]    = QB_SEQ(pMsg);
+        pWorker->seqSum[sender]     += QB_SEQ(pMsg);
+        pWorker->count++;
+    }
+    pWorker->done = TRUE;
+}
+
+/**********************************************************************************************************************/
+/** Run one queue variant
+ *
+ *  @param[in]      pVariant        queue variant
+ *  @param[in]      noOfSenders     number of sender threads
+ *  @param[in]      noOfReceivers   number of receiver threads
+ *  @param[in]      queueSize       number of queue entries
+ *  @retval         number of errors
+ */
+static UINT32 runVariant (
+    const QB_VARIANT_T  *pVariant,
+    UINT32              noOfSenders,
+    UINT32              noOfReceivers,
+    UINT32              queueSize)
+{
+    VOS_TIMEVAL_T   start;
+    VOS_TIMEVAL_T   end;
+    UINT64          expected    = (UINT64) gCount * noOfSenders;
+    UINT64          received;
+    UINT64          lastReceived    = 0u;
+    UINT32          idle            = 0u;
+    UINT64          seqSum;
+    UINT64          usec;
+    UINT32          errors      = 0u;
+    UINT32          i, j;
+    VOS_ERR_T       err;
+
+    memset(gSender, 0, sizeof(gSender));
+    memset(gReceiver, 0, sizeof(gReceiver));
+    gRun    = FALSE;
+    gStop   = FALSE;
+    gFifo   = (pVariant->policy == VOS_QUEUE_POLICY_LIFO) ? FALSE : TRUE;
+
+    if (pVariant->lockFree == TRUE)
+    {
+        err = vos_queueCreateLockFree(pVariant->policy, queueSize, pVariant->flags, &gQueue);
+    }
+    else
+    {
+        err = vos_queueCreate(pVariant->policy, queueSize, &gQueue);
+    }
+    if (err != VOS_NO_ERR)
+    {
+        printf("%-24s: queue could not be created (%s)\n", pVariant->pName, vos_getErrorString(err));
+        return 1u;
+    }
+
+    for (i = 0u; i < noOfReceivers; i++)
+    {
+        gReceiver[i].id = i;
+        err = vos_threadCreate(&gReceiver[i].thread, "Receiver",
+                               VOS_THREAD_POLICY_OTHER, VOS_THREAD_PRIORITY_DEFAULT, 0u, 0u,
+                               (VOS_THREAD_FUNC_T) receiveThread, &gReceiver[i]);
+        if (err != VOS_NO_ERR)
+        {
+            printf("Receiver thread could not be created (%s)\n", vos_getErrorString(err));
+            gReceiver[i].done = TRUE;
+            errors++;
+        }
+    }
+    for (i = 0u; i < noOfSenders; i++)
+    {
+        gSender[i].id = i;
+        err = vos_threadCreate(&gSender[i].thread, "Sender",
+                               VOS_THREAD_POLICY_OTHER, VOS_THREAD_PRIORITY_DEFAULT, 0u, 0u,
+                               (VOS_THREAD_FUNC_T) sendThread, &gSender[i]);
+        if (err != VOS_NO_ERR)
+        {
+            printf("Sender thread could not be created (%s)\n", vos_getErrorString(err));
+            gSender[i].done = TRUE;
+            errors++;
+            expected -= gCount;
+        }
+    }
+
+    vos_getTime(&start);
+    gRun = TRUE;
+
+    /* Wait until all messages were received (or nothing moves anymore because of an error) */
+    do
+    {
+        (void) vos_threadDelay(QB_POLL_TIME);
+        received = 0u;
+        for (i = 0u; i < noOfReceivers; i++)
+        {
+            received += gReceiver[i].count;
+        }
+        idle            = (received == lastReceived) ? (idle + 1u) : 0u;
+        lastReceived    = received;
+    }
+    while ((received < expected) && (idle < QB_IDLE_LIMIT));
+    vos_getTime(&end);
+    gStop = TRUE;
+
+    for (i = 0u; i < noOfReceivers; i++)
+    {
+        while (gReceiver[i].done == FALSE)
+        {
+            (void) vos_threadDelay(1000u);
+        }
+        errors += gReceiver[i].errors;
+    }
+    for (i = 0u; i < noOfSenders; i++)
+    {
+        while (gSender[i].done == FALSE)
+        {
+            (void) vos_threadDelay(1000u);
+        }
+        errors += gSender[i].errors;
+
+        /* Every message of the sender must have been received exactly once */
+        seqSum = 0u;
+        for (j = 0u; j < noOfReceivers; j++)
+        {
+            seqSum += gReceiver[j].seqSum[i];
+        }
+        if (seqSum != (UINT64) gCount * (gCount + 1u) / 2u)
+        {
+            errors++;
+        }
+    }
+    (void) vos_queueDestroy(gQueue);
+
+    vos_subTime(&end, &start);
+    usec = (UINT64) end.tv_sec * 1000000u + (UINT64) end.tv_usec;
+    if (usec == 0u)
+    {
+        usec = 1u;
+    }
+    printf("%-24s: %10llu msgs in %8.3f ms, %10llu msgs/s, %u errors\n",
+           pVariant->pName,
+           (unsigned long long) received,
+           (double) usec / 1000.0,
+           (unsigned long long) (received * 1000000u / usec),
+           errors);
+    return errors;
+}
+
+/**********************************************************************************************************************/
+/** main entry
+ *
+ *  @retval         0        no error
+ *  @retval         1        some error
+ */
+int main (int argc, char *argv[])
+{
+    QB_VARIANT_T    variants[] =
+    {
+        {"vos_queue FIFO", FALSE, VOS_QUEUE_POLICY_FIFO, VOS_QUEUE_FLAG_NONE},
+        {"lock-free FIFO", TRUE, VOS_QUEUE_POLICY_FIFO, VOS_QUEUE_FLAG_NONE},
+        {"lock-free FIFO (SPSC)", TRUE, VOS_QUEUE_POLICY_FIFO, VOS_QUEUE_FLAG_SPSC},
+        {"vos_queue LIFO", FALSE, VOS_QUEUE_POLICY_LIFO, VOS_QUEUE_FLAG_NONE},
+        {"lock-free LIFO", TRUE, VOS_QUEUE_POLICY_LIFO, VOS_QUEUE_FLAG_NONE}
+    };
+    UINT32          noOfSenders     = QB_DEFAULT_THREADS;
+    UINT32          noOfReceivers   = QB_DEFAULT_THREADS;
+    UINT32          queueSize       = QB_DEFAULT_SIZE;
+    UINT32          flags           = VOS_QUEUE_FLAG_NONE;
+    UINT32          errors          = 0u;
+    UINT32          i;
+    int             ch;
+
+    while ((ch = getopt(argc, argv, "n:r:c:q:bdh?")) != -1)
+    {
+        switch (ch)
+        {
+           case 'n':
+               if ((sscanf(optarg, "%u", &noOfSenders) < 1) || (noOfSenders == 0u) || (noOfSenders > QB_MAX_THREADS))
+               {
+                   usage(argv[0]);
+                   exit(1);
+               }
+               break;
+           case 'r':
+               if ((sscanf(optarg, "%u", &noOfReceivers) < 1) || (noOfReceivers == 0u) ||
+                   (noOfReceivers > QB_MAX_THREADS))
+               {
+                   usage(argv[0]);
+                   exit(1);
+               }
+               break;
+           case 'c':
+               if ((sscanf(optarg, "%u", &gCount) < 1) || (gCount == 0u) || (gCount > QB_MAX_COUNT))
+               {
+                   usage(argv[0]);
+                   exit(1);
+               }
+               break;
+           case 'q':
+               if ((sscanf(optarg, "%u", &queueSize) < 1) || (queueSize == 0u))
+               {
+                   usage(argv[0]);
+                   exit(1);
+               }
+               break;
+           case 'b':
+               flags |= VOS_QUEUE_FLAG_BLOCK;
+               break;
+           case 'd':
+               gVerbose = TRUE;
+               break;
+           case 'h':
+           case '?':
+           default:
+               printf("%s: Version %s\t(%s - %s)\n", argv[0], APP_VERSION, __DATE__, __TIME__);
+               usage(argv[0]);
+               return 1;
+        }
+    }
+
+    /* Without output function, a full queue costs no log formatting */
+    if ((vos_init(NULL, (gVerbose == TRUE) ? dbgOut : NULL) != VOS_NO_ERR)
+        || (vos_memInit(NULL, 0u, NULL) != VOS_NO_ERR))
+    {
+        fprintf(stderr, "Initialization error\n");
+        return 1;
+    }
+
+    printf("-----------------------------------------------\n");
+    printf("Senders                   :   %u\n", noOfSenders);
+    printf("Receivers                 :   %u\n", noOfReceivers);
+    printf("Messages per sender       :   %u\n", gCount);
+    printf("Queue size                :   %u\n", queueSize);
+    printf("-----------------------------------------------\n");
+
+    for (i = 0u; i < sizeof(variants) / sizeof(variants[0]); i++)
+    {
+        /* The SPSC fast path must not be used by several threads on one side */
+        if (((variants[i].flags & VOS_QUEUE_FLAG_SPSC) != 0u) && ((noOfSenders > 1u) || (noOfReceivers > 1u)))
+        {
+            continue;
+        }
+        if (variants[i].lockFree == TRUE)
+        {
+            variants[i].flags |= flags;
+        }
+        errors += runVariant(&variants[i], noOfSenders, noOfReceivers, queueSize);
+    }
+
+    vos_terminate();
+
+    return (errors == 0u) ? 0 : 1;
+}
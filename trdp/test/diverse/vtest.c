@@ -17,6 +17,7 @@
  *
  * $Id$
  *
+ *      AG 2026-10-19: Log level and log ring test
  *      A 2019-11-12: Ticket #290: Add support for Virtualization on Windows, changed thread names to unique ones
  *      BL 2017-05-22: Ticket #122: Addendum for 64Bit compatibility (VOS_TIME_T -> VOS_TIMEVAL_T)
  */
@@ -24,6 +25,8 @@
 #include "vtest.h"
 
 static FILE *pLogFile;
+static UINT32 gLogCount = 0;
+static CHAR8 gLastLogMsg[VOS_MAX_PRNT_STR_SIZE];
 
 /**********************************************************************************************************************/
 /** callback routine for TRDP logging/error output
@@ -47,6 +50,8 @@ void dbgOut(
 {
    const char *catStr[] = { "**Error:", "Warning:", "   Info:", "  Debug:", "        " };
 
+   gLogCount++;
+   vos_strncpy(gLastLogMsg, pMsgStr, sizeof(gLastLogMsg) - 1);
    {
       printf("%s %s %s",
          strrchr(pTime, '-') + 1,
@@ -2378,6 +2383,64 @@ UTILS_ERR_T L3_test_utils_CRC()
    return retVal;
 }
 
+UTILS_ERR_T L3_test_utils_log()
+{
+   UTILS_ERR_T retVal = UTILS_NO_ERR;
+   UINT32 count;
+   CHAR8 tmpStr[16] = "temporary";
+
+   vos_printLogStr(VOS_LOG_USR, "[UTILS_LOG] start...\n");
+   /******************************************/
+   /* suppressed categories are not output   */
+   /******************************************/
+   vos_setLogLevel(VOS_LOG_WARNING);
+   count = gLogCount;
+   vos_printLog(VOS_LOG_DBG, "[UTILS_LOG] debug %d\n", 1);
+   vos_printLog(VOS_LOG_INFO, "[UTILS_LOG] info %d\n", 2);
+   if (gLogCount != count)
+   {
+      retVal = UTILS_LOG_ERR;
+   }
+   vos_printLog(VOS_LOG_WARNING, "[UTILS_LOG] warning %d\n", 3);
+   if (gLogCount != count + 1)
+   {
+      retVal = UTILS_LOG_ERR;
+   }
+   vos_setLogLevel(VOS_LOG_DBG);
+
+   /******************************************/
+   /* log ring: output only when drained     */
+   /******************************************/
+   if (vos_logRingInit(8) != VOS_NO_ERR)
+   {
+      vos_printLogStr(VOS_LOG_ERROR, "[UTILS_LOG] log ring not available\n");
+      return UTILS_LOG_ERR;
+   }
+   count = gLogCount;
+   vos_printLog(VOS_LOG_INFO, "[UTILS_LOG] ring %d %u 0x%04x %s %.2f %%|%-*s|\n", -1, 2u, 0xABu, tmpStr, 2.5, 4, "ab");
+   strcpy(tmpStr, "overwritten");
+   if (gLogCount != count)
+   {
+      retVal = UTILS_LOG_ERR;
+   }
+   if ((vos_logRingDrain(0) != 1) || (gLogCount != count + 1) ||
+       (strcmp(gLastLogMsg, "[UTILS_LOG] ring -1 2 0x00ab temporary 2.50 %|ab  |\n") != 0))
+   {
+      retVal = UTILS_LOG_ERR;
+   }
+   vos_logRingTerm();
+
+   if (retVal == UTILS_NO_ERR)
+   {
+      vos_printLogStr(VOS_LOG_USR, "[UTILS_LOG] finished OK\n");
+   }
+   else
+   {
+      vos_printLogStr(VOS_LOG_ERROR, "[UTILS_LOG] finished ERROR\n");
+   }
+   return retVal;
+}
+
 UTILS_ERR_T L3_test_utils_terminate()
 {
    /* tested with debugger, it's ok although vos_memDelete() has internal error, but that's because vos_memDelete() has been
@@ -2472,6 +2535,7 @@ UTILS_ERR_T L2_test_utils()
    vos_printLogStr(VOS_LOG_USR, "*********************************************************************\n");
    errcnt += L3_test_utils_init();
    errcnt += L3_test_utils_CRC();
+   errcnt += L3_test_utils_log();
    errcnt += L3_test_utils_terminate();
    vos_printLogStr(VOS_LOG_USR, "*********************************************************************\n");
    vos_printLog(VOS_LOG_USR, "*   [UTILS] Test finished with errcnt = %i\n", errcnt);
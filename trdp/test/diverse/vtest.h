@@ -106,7 +106,8 @@ typedef enum
     UTILS_INIT_ERR      = 1,
     UTILS_CRC_ERR       = 2,
     UTILS_TERMINATE_ERR = 4,
-    UTILS_ALL_ERR       = 7
+    UTILS_LOG_ERR       = 8,
+    UTILS_ALL_ERR       = 15
 } UTILS_ERR_T;
 
 UINT32 gTestIP = 0;
@@ -2144,6 +2144,7 @@ PD_APP_ERR_TYPE PDApplication (PD_THREAD_PARAMETER *pPdThreadParameter)
 	BOOL8 linkUpDown = TRUE;							/* Link Up Down information TRUE:Up FALSE:Down */
 	UINT32 TS_SUBNET_NOW = SUBNET1;
 	UINT32 putDatasetSize = 0;						/* tlp_put Dataset Size in Traffic Store */
+	UINT8 putDataset[TRDP_MAX_PD_DATA_SIZE];		/* consistent copy of the Dataset in Traffic Store */
 	TRDP_ERR_T err = TRDP_NO_ERR;
 
 	/* Wait for multicast grouping */
@@ -2191,8 +2192,20 @@ PD_APP_ERR_TYPE PDApplication (PD_THREAD_PARAMETER *pPdThreadParameter)
 			}
 		}
 
-      	/* Get access right to Traffic Store*/
-    	err = tau_lockTrafficStore();
+    	/* Check MarshallingFlag */
+    	if (pPdThreadParameter->pPdCommandValue->marshallingFlag == TRUE)
+    	{
+    		/* Set tlp_put Size */
+    		putDatasetSize = appHandle->pSndQueue->dataSize;
+    	}
+    	else
+    	{
+    		/* Set tlp_put Size */
+    		putDatasetSize = pPdThreadParameter->pPdCommandValue->sendDataSetSize;
+    	}
+      	/* Get a consistent copy of the Dataset from Traffic Store (no Traffic Store lock) */
+    	err = (putDatasetSize > sizeof(putDataset)) ? TRDP_PARAM_ERR :
+    		tau_readTrafficStore(pPdThreadParameter->pPdCommandValue->OFFSET_ADDRESS1, putDataset, putDatasetSize);
     	if (err == TRDP_NO_ERR)
     	{
 
@@ -2233,39 +2246,21 @@ PD_APP_ERR_TYPE PDApplication (PD_THREAD_PARAMETER *pPdThreadParameter)
 #endif /* if 0 */
 
 			/* First TRDP instance in TRDP publish buffer */
-    		/* Check MarshallingFlag */
-    		if (pPdThreadParameter->pPdCommandValue->marshallingFlag == TRUE)
-    		{
-    			/* Set tlp_put Size */
-    			putDatasetSize = appHandle->pSndQueue->dataSize;
-    		}
-    		else
-    		{
-    			/* Set tlp_put Size */
-    			putDatasetSize = pPdThreadParameter->pPdCommandValue->sendDataSetSize;
-    		}
 			tlp_put(appHandle,
 					pPdThreadParameter->pubHandleNet1ComId1,
-					(void *)((int)pTrafficStoreAddr + pPdThreadParameter->pPdCommandValue->OFFSET_ADDRESS1),
+					putDataset,
 					putDatasetSize);
 			/* Second TRDP instance in TRDP publish buffer */
 			tlp_put(appHandle2,
 					pPdThreadParameter->pubHandleNet2ComId1,
-					(void *)((int)pTrafficStoreAddr + pPdThreadParameter->pPdCommandValue->OFFSET_ADDRESS1),
+					putDataset,
 					putDatasetSize);
 			/* put count up */
 			requestCounter++;
-
-          	/* Release access right to Traffic Store*/
-    		err = tau_unlockTrafficStore();
-    		if (err != TRDP_NO_ERR)
-    		{
-    			vos_printLog(VOS_LOG_ERROR, "Release Traffic Store accessibility Failed\n");
-    		}
     	}
     	else
     	{
-    		vos_printLog(VOS_LOG_ERROR, "Get Traffic Store accessibility Failed\n");
+    		vos_printLog(VOS_LOG_ERROR, "Get Traffic Store Dataset Failed\n");
     	}
 
     	/* Waits for a next creation cycle */
@@ -2335,6 +2330,7 @@ PD_APP_ERR_TYPE PDPullRequester (PD_THREAD_PARAMETER *pPdThreadParameter)
 	INT32 requestCounter = 0;						/* request counter */
 	BOOL8 linkUpDown = TRUE;							/* Link Up Down information TRUE:Up FALSE:Down */
 	UINT32 TS_SUBNET_NOW = SUBNET1;
+	UINT8 requestDataset[TRDP_MAX_PD_DATA_SIZE];	/* consistent copy of the Dataset in Traffic Store */
 	TRDP_ERR_T err = TRDP_NO_ERR;
 
 	/* Wait for multicast grouping */
@@ -2385,8 +2381,11 @@ PD_APP_ERR_TYPE PDPullRequester (PD_THREAD_PARAMETER *pPdThreadParameter)
 			}
 		}
 
-      	/* Get access right to Traffic Store*/
-    	err = tau_lockTrafficStore();
+      	/* Get a consistent copy of the Dataset from Traffic Store (no Traffic Store lock) */
+    	err = (pPdThreadParameter->pPdCommandValue->sendDataSetSize > sizeof(requestDataset)) ? TRDP_PARAM_ERR :
+    		tau_readTrafficStore(pPdThreadParameter->pPdCommandValue->OFFSET_ADDRESS1,
+    							 requestDataset,
+    							 pPdThreadParameter->pPdCommandValue->sendDataSetSize);
     	if (err == TRDP_NO_ERR)
     	{
 
@@ -2436,7 +2435,7 @@ PD_APP_ERR_TYPE PDPullRequester (PD_THREAD_PARAMETER *pPdThreadParameter)
 						0,
 						TRDP_FLAGS_NONE,
 						NULL,
-						(void *)((int)pTrafficStoreAddr + pPdThreadParameter->pPdCommandValue->OFFSET_ADDRESS1),
+						requestDataset,
 //						appHandle->pSndQueue->dataSize,
 						pPdThreadParameter->pPdCommandValue->sendDataSetSize,
 						pPdThreadParameter->pPdCommandValue->PD_REPLY_COMID,
@@ -2456,7 +2455,7 @@ PD_APP_ERR_TYPE PDPullRequester (PD_THREAD_PARAMETER *pPdThreadParameter)
 						0,
 						TRDP_FLAGS_NONE,
 						NULL,
-						(void *)((int)pTrafficStoreAddr + pPdThreadParameter->pPdCommandValue->OFFSET_ADDRESS1),
+						requestDataset,
 //						appHandle2->pSndQueue->dataSize,
 						pPdThreadParameter->pPdCommandValue->sendDataSetSize,
 						pPdThreadParameter->pPdCommandValue->PD_REPLY_COMID,
@@ -2467,17 +2466,10 @@ PD_APP_ERR_TYPE PDPullRequester (PD_THREAD_PARAMETER *pPdThreadParameter)
 			}
 			/* request count up */
 			requestCounter++;
-
-          	/* Release access right to Traffic Store*/
-    		err = tau_unlockTrafficStore();
-    		if (err != TRDP_NO_ERR)
-    		{
-    			vos_printLog(VOS_LOG_ERROR, "Release Traffic Store accessibility Failed\n");
-    		}
     	}
     	else
     	{
-    		vos_printLog(VOS_LOG_ERROR, "Get Traffic Store accessibility Failed\n");
+    		vos_printLog(VOS_LOG_ERROR, "Get Traffic Store Dataset Failed\n");
     	}
 
     	/* Waits for a next creation cycle */
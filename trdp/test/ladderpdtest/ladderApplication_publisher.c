@@ -451,6 +451,8 @@ int main (int argc, char *argv[])
 	DATASET2 putDataSet2;										/* put DataSet2 */
 	DATASET1 getDataSet1 = {0};									/* get DataSet1 from Traffic Store */
 	DATASET2 getDataSet2;										/* get DataSet2 from Traffic Store */
+	UINT8 getTsDataSet1[sizeof(DATASET1)];						/* consistent copy of DataSet1 in Traffic Store */
+	UINT8 getTsDataSet2[sizeof(DATASET2)];						/* consistent copy of DataSet2 in Traffic Store */
 	memset(&putDataSet2, 0, sizeof(putDataSet2));
 	memset(&getDataSet2, 0, sizeof(getDataSet2));
 
@@ -1553,36 +1555,27 @@ int main (int argc, char *argv[])
 			}
     	}
 
-		/* Get access right to Traffic Store*/
-		err = tau_lockTrafficStore();
-		if (err == TRDP_NO_ERR)
+		/* Set PD DataSets in Traffic Store (per DataSet seqlock, no Traffic Store lock) */
+		err = TRDP_NO_ERR;
+		/* Enable Comid1 ? */
+		if ((VALID_PD_COMID & ENABLE_COMDID1) == ENABLE_COMDID1)
 		{
-			/* Enable Comid1 ? */
-			if ((VALID_PD_COMID & ENABLE_COMDID1) == ENABLE_COMDID1)
-			{
-				/* Set PD DataSet1 in Traffic Store */
-				dataSet1Size = sizeof(dataSet1);
-				memcpy((void *)((int)pTrafficStoreAddr + OFFSET_ADDRESS1), &dataSet1, dataSet1Size);
-				memcpy(&putDataSet1, &dataSet1, dataSet1Size);
-			}
-			/* Enable Comid2 ? */
-			if ((VALID_PD_COMID & ENABLE_COMDID2) == ENABLE_COMDID2)
-			{
-				/* Set PD DataSet2 in Traffic Store */
-				dataSet2Size = sizeof(dataSet2);
-				memcpy((void *)((int)pTrafficStoreAddr + OFFSET_ADDRESS2), &dataSet2, dataSet2Size);
-				memcpy(&putDataSet2, &dataSet2, dataSet2Size);
-			}
-			/* Release access right to Traffic Store*/
-			err = tau_unlockTrafficStore();
-			if (err != TRDP_NO_ERR)
-			{
-				vos_printLog(VOS_LOG_ERROR, "Release Traffic Store accessibility Failed\n");
-			}
+			/* Set PD DataSet1 in Traffic Store */
+			dataSet1Size = sizeof(dataSet1);
+			err = tau_writeTrafficStore(OFFSET_ADDRESS1, (UINT8 *) &dataSet1, dataSet1Size);
+			memcpy(&putDataSet1, &dataSet1, dataSet1Size);
 		}
-		else
+		/* Enable Comid2 ? */
+		if ((err == TRDP_NO_ERR) && ((VALID_PD_COMID & ENABLE_COMDID2) == ENABLE_COMDID2))
+		{
+			/* Set PD DataSet2 in Traffic Store */
+			dataSet2Size = sizeof(dataSet2);
+			err = tau_writeTrafficStore(OFFSET_ADDRESS2, (UINT8 *) &dataSet2, dataSet2Size);
+			memcpy(&putDataSet2, &dataSet2, dataSet2Size);
+		}
+		if (err != TRDP_NO_ERR)
 		{
-			vos_printLog(VOS_LOG_ERROR, "Get Traffic Store accessibility Failed\n");
+			vos_printLog(VOS_LOG_ERROR, "Set Traffic Store PD DATASET Failed\n");
 			/* Waits for a next to Traffic Store put/get cycle */
 			vos_threadDelay(publisherAppCycle);
 			continue;
@@ -1724,8 +1717,16 @@ int main (int argc, char *argv[])
 		/* UnMarshalling ? */
 		if (marshallingFlag == TRUE)
 		{
-			/* Get access right to Traffic Store*/
-			err = tau_lockTrafficStore();
+			/* Get consistent copies of the received DataSets from Traffic Store (no Traffic Store lock) */
+			err = TRDP_NO_ERR;
+			if ((VALID_PD_COMID & ENABLE_COMDID1) == ENABLE_COMDID1)
+			{
+				err = tau_readTrafficStore(OFFSET_ADDRESS3, getTsDataSet1, sizeof(getTsDataSet1));
+			}
+			if ((err == TRDP_NO_ERR) && ((VALID_PD_COMID & ENABLE_COMDID2) == ENABLE_COMDID2))
+			{
+				err = tau_readTrafficStore(OFFSET_ADDRESS4, getTsDataSet2, sizeof(getTsDataSet2));
+			}
 			if (err == TRDP_NO_ERR)
 			{
 				/* Enable Comid1 ? */
@@ -1735,7 +1736,7 @@ int main (int argc, char *argv[])
 					/* unmarshalling ComId1 */
 					err = tau_unmarshall (pRefConMarshallDataset,
 											PD_COMID1,
-											(UINT8 *)((int)pTrafficStoreAddr + OFFSET_ADDRESS3),
+											getTsDataSet1,
 											(UINT8 *) &getDataSet1,
 											&dataSet1Size,
 											NULL);
@@ -1753,7 +1754,7 @@ int main (int argc, char *argv[])
 					/* unmarshalling ComId2 */
 					err = tau_unmarshall (pRefConMarshallDataset,
 											PD_COMID2,
-											(UINT8 *)((int)pTrafficStoreAddr + OFFSET_ADDRESS4),
+											getTsDataSet2,
 											(UINT8 *) &getDataSet2,
 											&dataSet2Size,
 											NULL);
@@ -1764,50 +1765,44 @@ int main (int argc, char *argv[])
 						return 1;
 					}
 				}
-
-				/* Release access right to Traffic Store*/
-				err = tau_unlockTrafficStore();
-				if (err != TRDP_NO_ERR)
-				{
-					vos_printLog(VOS_LOG_ERROR, "Release Traffic Store accessibility Failed\n");
-				}
 			}
 			else
 			{
-				vos_printLog(VOS_LOG_ERROR, "Get Traffic Store accessibility Failed\n");
+				vos_printLog(VOS_LOG_ERROR, "Get Traffic Store PD DATASET Failed\n");
 			}
 		}
 		else
 		{
-			/* Get access right to Traffic Store*/
-			err = tau_lockTrafficStore();
+			/* Get consistent copies of the received DataSets from Traffic Store (no Traffic Store lock) */
+			err = TRDP_NO_ERR;
+			if ((VALID_PD_COMID & ENABLE_COMDID1) == ENABLE_COMDID1)
+			{
+				err = tau_readTrafficStore(OFFSET_ADDRESS3, getTsDataSet1, sizeof(getTsDataSet1));
+			}
+			if ((err == TRDP_NO_ERR) && ((VALID_PD_COMID & ENABLE_COMDID2) == ENABLE_COMDID2))
+			{
+				err = tau_readTrafficStore(OFFSET_ADDRESS4, getTsDataSet2, sizeof(getTsDataSet2));
+			}
 			if (err == TRDP_NO_ERR)
 			{
 				/* Enable Comid1 ? */
 				if ((VALID_PD_COMID & ENABLE_COMDID1) == ENABLE_COMDID1)
 				{
 					/* Get ComId1 from Traffic Store */
-					memcpy(&getDataSet1, (void *)((int)pTrafficStoreAddr + OFFSET_ADDRESS3), dataSet1Size);
+					memcpy(&getDataSet1, getTsDataSet1, dataSet1Size);
 					vos_printLog(VOS_LOG_DBG, "Get Traffic Store PD DATASET%d character:%u\n", DATASET_NO_1, getDataSet1.character);
 				}
 				/* Enable Comid2 ? */
 				if ((VALID_PD_COMID & ENABLE_COMDID2) == ENABLE_COMDID2)
 				{
 	    			/* Get ComId2 from Traffic Store */
-					memcpy(&getDataSet2, (void *)((int)pTrafficStoreAddr + OFFSET_ADDRESS4), dataSet2Size);
+					memcpy(&getDataSet2, getTsDataSet2, dataSet2Size);
 					vos_printLog(VOS_LOG_DBG, "Get Traffic Store PD DATASET%d character:%u\n", DATASET_NO_2, getDataSet2.dataset1[0].character);
 				}
-
-				/* Release access right to Traffic Store*/
-				err = tau_unlockTrafficStore();
-				if (err != TRDP_NO_ERR)
-				{
-					vos_printLog(VOS_LOG_ERROR, "Release Traffic Store accessibility Failed\n");
-				}
 			}
 			else
 			{
-				vos_printLog(VOS_LOG_ERROR, "Get Traffic Store accessibility Failed\n");
+				vos_printLog(VOS_LOG_ERROR, "Get Traffic Store PD DATASET Failed\n");
 			}
 		}
 
@@ -406,6 +406,8 @@ int main (int argc, char *argv[])
 	};
 	DATASET1 getDataSet1 = {0};								/* get DataSet1 from Traffic Store */
 	DATASET2 getDataSet2;									/* get DataSet2 from Traffic Store */
+	UINT8 getTsDataSet1[sizeof(DATASET1)];					/* consistent copy of DataSet1 in Traffic Store */
+	UINT8 getTsDataSet2[sizeof(DATASET2)];					/* consistent copy of DataSet2 in Traffic Store */
 	memset(&getDataSet2, 0, sizeof(getDataSet2));
 
 	DATASET1 dataSet1 = {0};								/* publish Dataset1 */
@@ -1421,8 +1423,16 @@ int main (int argc, char *argv[])
      */
 	while(pdReturnLoopCounter <= PD_RETURN_CYCLE_NUMBER - 1)
     {
-      	/* Get access right to Traffic Store*/
-    	err = tau_lockTrafficStore();
+      	/* Get consistent copies of the received DataSets from Traffic Store (no Traffic Store lock) */
+    	err = TRDP_NO_ERR;
+    	if ((VALID_PD_COMID & ENABLE_COMDID1) == ENABLE_COMDID1)
+    	{
+    		err = tau_readTrafficStore(OFFSET_ADDRESS3, getTsDataSet1, sizeof(getTsDataSet1));
+    	}
+    	if ((err == TRDP_NO_ERR) && ((VALID_PD_COMID & ENABLE_COMDID2) == ENABLE_COMDID2))
+    	{
+    		err = tau_readTrafficStore(OFFSET_ADDRESS4, getTsDataSet2, sizeof(getTsDataSet2));
+    	}
     	if (err == TRDP_NO_ERR)
     	{
 			/* unmarshall */
@@ -1435,7 +1445,7 @@ int main (int argc, char *argv[])
 					/* unmarshalling ComId1 */
 					err = tau_unmarshall (pRefConMarshallDataset,
 											PD_COMID1,
-											(UINT8 *)((int)pTrafficStoreAddr + OFFSET_ADDRESS3),
+											getTsDataSet1,
 											(UINT8 *) &getDataSet1,
 											&dataSet1Size,
 											NULL);
@@ -1453,7 +1463,7 @@ int main (int argc, char *argv[])
 					/* unmarshalling ComId2 */
 					err = tau_unmarshall (pRefConMarshallDataset,
 											PD_COMID2,
-											(UINT8 *)((int)pTrafficStoreAddr + OFFSET_ADDRESS4),
+											getTsDataSet2,
 											(UINT8 *) &getDataSet2,
 											&dataSet2Size,
 											NULL);
@@ -1471,14 +1481,14 @@ int main (int argc, char *argv[])
 				if ((VALID_PD_COMID & ENABLE_COMDID1) == ENABLE_COMDID1)
 				{
 					/* Get Receive PD DataSet1 from Traffic Store */
-					memcpy(&getDataSet1, (void *)((int)pTrafficStoreAddr + OFFSET_ADDRESS3), dataSet1Size);
+					memcpy(&getDataSet1, getTsDataSet1, dataSet1Size);
 					vos_printLog(VOS_LOG_DBG, "Get Traffic Store PD DATASET%d character:%u\n", DATASET_NO_1, getDataSet1.character);
 				}
 				/* Enable Comid2 ? */
 				if ((VALID_PD_COMID & ENABLE_COMDID2) == ENABLE_COMDID2)
 				{
 					/* Get Receive PD DataSet1 from Traffic Store */
-					memcpy(&getDataSet2, (void *)((int)pTrafficStoreAddr + OFFSET_ADDRESS4), dataSet2Size);
+					memcpy(&getDataSet2, getTsDataSet2, dataSet2Size);
 					vos_printLog(VOS_LOG_DBG, "Get Traffic Store PD DATASET%d character:%u\n", DATASET_NO_2, getDataSet2.dataset1[0].character);
 				}
     		}
@@ -1507,7 +1517,10 @@ int main (int argc, char *argv[])
 				/* Get DataSet1Size */
 				dataSet1Size = sizeof(dataSet1);
     			/* Set PD DataSet1 in Traffic Store */
-				memcpy((void *)((int)pTrafficStoreAddr + OFFSET_ADDRESS1), &getDataSet1, dataSet1Size);
+				if (tau_writeTrafficStore(OFFSET_ADDRESS1, (UINT8 *) &getDataSet1, dataSet1Size) != TRDP_NO_ERR)
+				{
+					vos_printLog(VOS_LOG_ERROR, "Set Traffic Store PD DATASET%d Failed\n", DATASET_NO_1);
+				}
     		}
     		/* Enable Comid2 ? */
     		if ((VALID_PD_COMID & ENABLE_COMDID2) == ENABLE_COMDID2)
@@ -1515,16 +1528,12 @@ int main (int argc, char *argv[])
 				/* Get DataSet1Size */
 				dataSet2Size = sizeof(dataSet2);
     			/* Set PD DataSet2 in Traffic Store */
-				memcpy((void *)((int)pTrafficStoreAddr + OFFSET_ADDRESS2), &getDataSet2, dataSet2Size);
+				if (tau_writeTrafficStore(OFFSET_ADDRESS2, (UINT8 *) &getDataSet2, dataSet2Size) != TRDP_NO_ERR)
+				{
+					vos_printLog(VOS_LOG_ERROR, "Set Traffic Store PD DATASET%d Failed\n", DATASET_NO_2);
+				}
     		}
 
-			/* Release access right to Traffic Store*/
-			err = tau_unlockTrafficStore();
-			if (err != TRDP_NO_ERR)
-			{
-				vos_printLog(VOS_LOG_ERROR, "Release Traffic Store accessibility Failed\n");
-			}
-
 			/* Get Write Traffic Store Receive SubnetId */
 			if (tau_getNetworkContext(&TS_SUBNET) != TRDP_NO_ERR)
 			{
@@ -1646,7 +1655,7 @@ int main (int argc, char *argv[])
     	}
     	else
     	{
-    		vos_printLog(VOS_LOG_ERROR, "Get Traffic Store accessibility Failed\n");
+    		vos_printLog(VOS_LOG_ERROR, "Get Traffic Store PD DATASET Failed\n");
     	}
 
 		/* Waits for a next to Traffic Store put/get cycle */
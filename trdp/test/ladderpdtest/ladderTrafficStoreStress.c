@@ -0,0 +1,254 @@
+/**********************************************************************************************************************/
+/**
+ * @file            ladderTrafficStoreStress.c
+ *
+ * @brief           Multi-process stress test for the Traffic Store seqlocks
+ *
+ * @details         Several writer processes update datasets in the Traffic Store while several reader processes take
+ *                  lock-free copies with tau_readTrafficStore(). Every dataset is written as a block of identical
+ *                  words, so a torn (inconsistent) copy is detected by the readers. Two writers share one dataset,
+ *                  like the receive paths of both subnets do.
+ *
+ * @note            Project: TCNOpen TRDP prototype stack
+ *
+ * @author          agent
+ *
+ * @remarks This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0.
+ *          If a copy of the MPL was not distributed with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ *          Copyright agent, 2026. All rights reserved.
+ *
+ * $Id$
+ *
+ */
+
+#ifdef TRDP_OPTION_LADDER
+
+/***********************************************************************************************************************
+ * INCLUDES
+ */
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+#include <getopt.h>
+#include <sys/types.h>
+#include <sys/wait.h>
+
+#include "vos_utils.h"
+#include "vos_thread.h"
+#include "trdp_if_light.h"
+#include "tau_ladder.h"
+
+/***********************************************************************************************************************
+ * DEFINES
+ */
+#define STRESS_MAX_PROCS        16u
+#define STRESS_DATASET_WORDS    256u                            /* 1 KB datasets */
+#define STRESS_DATASET_SIZE     (STRESS_DATASET_WORDS * sizeof(UINT32))
+#define STRESS_OFFSET(writer)   ((UINT16) (((writer) / 2u) * 2048u))    /* writers 0/1, 2/3, ... share a dataset */
+
+/***********************************************************************************************************************
+ * LOCALS
+ */
+static UINT32   gNoOfWriters    = 4u;
+static UINT32   gNoOfReaders    = 4u;
+static UINT32   gRunTime        = 5u;   /* seconds */
+
+/**********************************************************************************************************************/
+/** Log output
+ */
+static void dbgOut (
+    void        *pRefCon,
+    TRDP_LOG_T  category,
+    const CHAR8 *pTime,
+    const CHAR8 *pFile,
+    UINT16      lineNumber,
+    const CHAR8 *pMsgStr)
+{
+    if (category <= VOS_LOG_WARNING)
+    {
+        printf("%s %s:%u %s", pTime, pFile, lineNumber, pMsgStr);
+    }
+}
+
+/**********************************************************************************************************************/
+/** Check whether the run time is over
+ *
+ *  @param[in]      pEnd            end of the test
+ *
+ *  @retval         TRUE            stop now
+ */
+static BOOL8 timeIsUp (
+    const VOS_TIMEVAL_T *pEnd)
+{
+    VOS_TIMEVAL_T now;
+
+    vos_getTime(&now);
+    return (vos_cmpTime(&now, (VOS_TIMEVAL_T *) pEnd) > 0) ? TRUE : FALSE;
+}
+
+/**********************************************************************************************************************/
+/** Writer process: fill its dataset with identical words, incrementing the value each time
+ *
+ *  @param[in]      writer          number of the writer
+ *  @param[in]      pEnd            end of the test
+ *
+ *  @retval         exit code
+ */
+static int writerProcess (
+    UINT32              writer,
+    const VOS_TIMEVAL_T *pEnd)
+{
+    UINT32  dataset[STRESS_DATASET_WORDS];
+    UINT32  value   = writer << 24u;
+    UINT32  count   = 0u;
+    UINT32  i;
+
+    while (timeIsUp(pEnd) == FALSE)
+    {
+        value++;
+        for (i = 0u; i < STRESS_DATASET_WORDS; i++)
+        {
+            dataset[i] = value;
+        }
+        if (tau_writeTrafficStore(STRESS_OFFSET(writer), (UINT8 *) dataset, STRESS_DATASET_SIZE) != TRDP_NO_ERR)
+        {
+            printf("writer %u: tau_writeTrafficStore() failed\n", writer);
+            return 1;
+        }
+        count++;
+    }
+    printf("writer %u: %u writes\n", writer, count);
+    return 0;
+}
+
+/**********************************************************************************************************************/
+/** Reader process: copy all datasets and check their consistency
+ *
+ *  @param[in]      reader          number of the reader
+ *  @param[in]      pEnd            end of the test
+ *
+ *  @retval         exit code
+ */
+static int readerProcess (
+    UINT32              reader,
+    const VOS_TIMEVAL_T *pEnd)
+{
+    UINT32  dataset[STRESS_DATASET_WORDS];
+    UINT32  count   = 0u;
+    UINT32  torn    = 0u;
+    UINT32  writer;
+    UINT32  i;
+
+    while (timeIsUp(pEnd) == FALSE)
+    {
+        for (writer = 0u; writer < gNoOfWriters; writer += 2u)
+        {
+            if (tau_readTrafficStore(STRESS_OFFSET(writer), (UINT8 *) dataset, STRESS_DATASET_SIZE) != TRDP_NO_ERR)
+            {
+                printf("reader %u: tau_readTrafficStore() failed\n", reader);
+                return 1;
+            }
+            for (i = 1u; i < STRESS_DATASET_WORDS; i++)
+            {
+                if (dataset[i] != dataset[0])
+                {
+                    torn++;
+                    break;
+                }
+            }
+            count++;
+        }
+    }
+    printf("reader %u: %u reads, %u inconsistent\n", reader, count, torn);
+    return (torn == 0u) ? 0 : 1;
+}
+
+/**********************************************************************************************************************/
+/** main entry
+ *
+ *  @retval         0               no error
+ *  @retval         1               some error
+ */
+int main (int argc, char *argv[])
+{
+    pid_t           pids[2u * STRESS_MAX_PROCS];
+    UINT32          noOfProcs = 0u;
+    UINT32          i;
+    int             ch;
+    int             status;
+    int             failed = 0;
+    VOS_TIMEVAL_T   end;
+    VOS_TIMEVAL_T   runTime;
+
+    while ((ch = getopt(argc, argv, "w:r:s:h?")) != -1)
+    {
+        switch (ch)
+        {
+            case 'w':
+                gNoOfWriters = (UINT32) strtoul(optarg, NULL, 10);
+                break;
+            case 'r':
+                gNoOfReaders = (UINT32) strtoul(optarg, NULL, 10);
+                break;
+            case 's':
+                gRunTime = (UINT32) strtoul(optarg, NULL, 10);
+                break;
+            case 'h':
+            case '?':
+            default:
+                printf("usage: %s [-w writers] [-r readers] [-s seconds]\n", argv[0]);
+                return 1;
+        }
+    }
+    if ((gNoOfWriters == 0u) || (gNoOfWriters > STRESS_MAX_PROCS) || (gNoOfReaders > STRESS_MAX_PROCS))
+    {
+        printf("1..%u writers, 0..%u readers\n", STRESS_MAX_PROCS, STRESS_MAX_PROCS);
+        return 1;
+    }
+
+    if ((tlc_init(dbgOut, NULL, NULL) != TRDP_NO_ERR) ||
+        (tau_ladder_init() != TRDP_NO_ERR))
+    {
+        printf("Traffic Store initialisation failed\n");
+        return 1;
+    }
+
+    /* The Traffic Store mapping is shared with the child processes */
+    vos_getTime(&end);
+    runTime.tv_sec  = (long) gRunTime;
+    runTime.tv_usec = 0;
+    vos_addTime(&end, &runTime);
+
+    for (i = 0u; i < gNoOfWriters + gNoOfReaders; i++)
+    {
+        pids[i] = fork();
+        if (pids[i] == 0)
+        {
+            exit((i < gNoOfWriters) ? writerProcess(i, &end) : readerProcess(i - gNoOfWriters, &end));
+        }
+        else if (pids[i] < 0)
+        {
+            printf("fork() failed\n");
+            failed = 1;
+            break;
+        }
+        noOfProcs++;
+    }
+
+    for (i = 0u; i < noOfProcs; i++)
+    {
+        if ((waitpid(pids[i], &status, 0) != pids[i]) || !WIFEXITED(status) || (WEXITSTATUS(status) != 0))
+        {
+            failed = 1;
+        }
+    }
+
+    (void) tau_ladder_terminate();
+    (void) tlc_terminate();
+
+    printf("%s\n", (failed == 0) ? "Traffic Store stress test passed" : "Traffic Store stress test FAILED");
+    return failed;
+}
+
+#endif /* TRDP_OPTION_LADDER */
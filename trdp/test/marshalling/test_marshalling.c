@@ -16,6 +16,9 @@
  *
  * $Id$
  *
+ *      AG 2026-10-19: test5: cached dataset sizes, tau_unmarshallAlloc()
+ *      AG 2026-10-19: test4: identity layout datasets
+ *      AG 2026-10-19: test3: field accessor views
  *      SB 2019-05-24: Ticket #252 Bug in unmarshalling/marshalling of TIMEDATE48 and TIMEDATE64
  *      BL 2018-09-05: Ticket #211 XML handling: Dataset Name should be stored in TRDP_DATASET_ELEMENT_T
  *      BL 2018-04-27: Testing ticket #197
@@ -24,6 +27,7 @@
 #include <stdio.h>
 #include <string.h>
 #include "tau_marshall.h"
+#include "vos_mem.h"
 
 /*    Test data sets    */
 TRDP_DATASET_T  gDataSet1990 =
@@ -1052,6 +1056,164 @@ static int test2()
     return 0;
 }
 
+/***********************************************************************************************************************
+    Test field accessor views on the marshalled test dataset
+***********************************************************************************************************************/
+static int test3()
+{
+    TRDP_ERR_T  err;
+    TAU_VIEW_T  *pView = NULL;
+    UINT32      bufSize = sizeof(gDstDataBuffer);
+    UINT32      noOfItems;
+    UINT8       u8;
+    INT32       i32;
+    UINT64      u64;
+    REAL32      r32;
+    REAL64      r64[4];
+    CHAR8       string[16];
+    int         result = 0;
+
+    err = tau_marshall(gpRefCon, 1000, (UINT8 *) &gMyDataSet1000, sizeof(gMyDataSet1000), gDstDataBuffer, &bufSize, NULL);
+    if (err == TRDP_NO_ERR)
+    {
+        err = tau_createView(gpRefCon, 1000, &pView);
+    }
+    if (err == TRDP_NO_ERR)
+    {
+        err = tau_setViewData(pView, gDstDataBuffer, bufSize);
+    }
+    if (err != TRDP_NO_ERR)
+    {
+        printf("tau_createView returns error %d\n", err);
+        return 1;
+    }
+
+    /*  Fields 0...31 have fixed offsets, field 33 and the following depend on the sizes in the data  */
+    noOfItems = 4u;
+    if ((tau_getU8(pView, 0u, &u8) != TRDP_NO_ERR) || (u8 != gMyDataSet1000.bool8_1) ||
+        (tau_getI32(pView, 5u, &i32) != TRDP_NO_ERR) || (i32 != gMyDataSet1000.int32_1) ||
+        (tau_getU64(pView, 10u, &u64) != TRDP_NO_ERR) || (u64 != gMyDataSet1000.uint64_1) ||
+        (tau_getReal32(pView, 11u, &r32) != TRDP_NO_ERR) || (r32 != gMyDataSet1000.float32_1) ||
+        (tau_getI32(pView, 43u, &i32) != TRDP_NO_ERR) || (i32 != gMyDataSet1000.int32_0[0]) ||
+        (tau_getReal64Array(pView, 57u, 0u, r64, &noOfItems) != TRDP_NO_ERR) || (noOfItems != 4u) ||
+        (memcmp(r64, gMyDataSet1000.float64_0, sizeof(r64)) != 0) ||
+        (tau_getU8(pView, 67u, &u8) != TRDP_NO_ERR) || (u8 != gMyDataSet1000.ds.ds.ds.ds.level))
+    {
+        printf("Field accessor returns wrong data!\n");
+        result = 1;
+    }
+
+    noOfItems = sizeof(string);
+    if ((tau_getU8Array(pView, 68u, 0u, (UINT8 *) string, &noOfItems) != TRDP_NO_ERR) ||
+        (noOfItems != sizeof(string)) || (strcmp(string, gMyDataSet1000.ds.ds.ds.ds.string) != 0))
+    {
+        printf("Field accessor returns wrong string!\n");
+        result = 1;
+    }
+
+    /*  Wrong type, short data  */
+    if ((tau_getU32(pView, 11u, (UINT32 *) &r32) != TRDP_PARAM_ERR) ||
+        (tau_setViewData(pView, gDstDataBuffer, 200u) != TRDP_NO_ERR) ||
+        (tau_getU8(pView, 67u, &u8) != TRDP_MARSHALLING_ERR))
+    {
+        printf("Field accessor does not detect errors!\n");
+        result = 1;
+    }
+
+    (void) tau_deleteView(pView);
+
+    if (result == 0)
+    {
+        printf("Field accessors matched!\n");
+    }
+    return result;
+}
+
+/***********************************************************************************************************************
+    Test datasets with identity layout, copied as a whole
+***********************************************************************************************************************/
+static int test4()
+{
+    TAU_LAYOUT_T            layout1000, layout1993;
+    UINT32                  wireSize;
+    UINT32                  bufSize     = sizeof(gDstDataBuffer);
+    UINT32                  bufSize2;
+    struct myDataSet1993    copy;
+
+    if ((tau_getDatasetLayout(gpRefCon, 1000, &layout1000, NULL) != TRDP_NO_ERR) ||
+        (tau_getDatasetLayout(gpRefCon, 1993, &layout1993, &wireSize) != TRDP_NO_ERR) ||
+        (layout1000 != TAU_LAYOUT_MARSHALL) || (layout1993 != TAU_LAYOUT_IDENTITY) ||
+        (wireSize != sizeof(struct myDataSet1993)))
+    {
+        printf("Wrong dataset layout: %d %d\n", layout1000, layout1993);
+        return 1;
+    }
+
+    bufSize2 = sizeof(copy);
+    memset(&copy, 0, sizeof(copy));
+    if ((tau_marshallDs(gpRefCon, 1993, (UINT8 *) &gMyDataSet1000.ds, sizeof(gMyDataSet1000.ds), gDstDataBuffer,
+                        &bufSize, NULL) != TRDP_NO_ERR) ||
+        (bufSize != sizeof(struct myDataSet1993)) ||
+        (memcmp(gDstDataBuffer, gMarshalledData1000 + sizeof(gMarshalledData1000) - bufSize, bufSize) != 0) ||
+        (tau_unmarshallDs(gpRefCon, 1993, gDstDataBuffer, bufSize, (UINT8 *) &copy, &bufSize2, NULL) != TRDP_NO_ERR) ||
+        (bufSize2 != sizeof(copy)) || (memcmp(&copy, &gMyDataSet1000.ds, sizeof(copy)) != 0))
+    {
+        printf("Identity layout dataset not copied correctly!\n");
+        return 1;
+    }
+
+    printf("Identity layout datasets matched!\n");
+    return 0;
+}
+
+/***********************************************************************************************************************
+    Test cached sizes of fixed size datasets and unmarshalling into an allocated buffer
+***********************************************************************************************************************/
+static int test5()
+{
+    UINT32                  compSize    = 0;
+    UINT32                  bufSize     = sizeof(gDstDataBuffer);
+    UINT32                  allocSize   = 0;
+    struct myDataSet1000    *pCopy      = NULL;
+    int                     result      = 0;
+
+    gMyDataSet2003.c = gMyDataSet2002;
+
+    /*  Fixed size dataset: size from the cache    */
+    if ((tau_marshall(gpRefCon, 2003, (UINT8 *) &gMyDataSet2003, sizeof(gMyDataSet2003), gDstDataBuffer, &bufSize,
+                      NULL) != TRDP_NO_ERR) ||
+        (tau_calcDatasetSizeByComId(gpRefCon, 2003, gDstDataBuffer, bufSize, &compSize, NULL) != TRDP_NO_ERR) ||
+        (compSize != sizeof(gMyDataSet2003)))
+    {
+        printf("Cached size of dataset 2003 is wrong (%u != %lu)!\n", compSize, (unsigned long) sizeof(gMyDataSet2003));
+        result = 1;
+    }
+
+    /*  Variable size dataset   */
+    bufSize = sizeof(gDstDataBuffer);
+    if ((tau_marshall(gpRefCon, 1000, (UINT8 *) &gMyDataSet1000, sizeof(gMyDataSet1000), gDstDataBuffer, &bufSize,
+                      NULL) != TRDP_NO_ERR) ||
+        (tau_unmarshallAlloc(gpRefCon, 1000, gDstDataBuffer, bufSize, (UINT8 * *) &pCopy, &allocSize,
+                             NULL) != TRDP_NO_ERR) ||
+        (allocSize != sizeof(gMyDataSet1000)) ||
+        (pCopy->uint64_0[3] != gMyDataSet1000.uint64_0[3]) ||
+        (strcmp(pCopy->ds.ds.ds.ds.string, gMyDataSet1000.ds.ds.ds.ds.string) != 0))
+    {
+        printf("tau_unmarshallAlloc returns wrong data (size %u)!\n", allocSize);
+        result = 1;
+    }
+    if (pCopy != NULL)
+    {
+        vos_memFree((UINT8 *) pCopy);
+    }
+
+    if (result == 0)
+    {
+        printf("Cached sizes matched!\n");
+    }
+    return result;
+}
+
 /******/
 int main ()
 {
@@ -1061,7 +1223,7 @@ int main ()
 
     if (err == TRDP_NO_ERR)
     {
-        return test1();
+        return test1() || test3() || test4() || test5();
         //return test2();
     }
 }
@@ -0,0 +1,441 @@
+/**********************************************************************************************************************/
+/**
+ * @file            trdp-md-fanout-test.c
+ *
+ * @brief           MD notifications and requests to many destinations
+ *
+ * @details         A caller session on 127.0.0.1 sends the same payload to a number of destinations (127.0.0.2 ...),
+ *                  received by a replier session bound to any address. Notifications are sent with one tlm_notify()
+ *                  per destination and with tlm_notifyMulti(), reported is the time the caller spends to queue and
+ *                  send them. Requests are sent with tlm_requestMulti(), each reply must arrive for the session ID of
+ *                  the destination it was sent to.
+ *
+ * @note            Project: TCNOpen TRDP prototype stack
+ *
+ * @author          agent
+ *
+ * @remarks This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0.
+ *          If a copy of the MPL was not distributed with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ *          Copyright agent, 2026. All rights reserved.
+ *
+ * $Id$
+ *
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#if defined (POSIX)
+#include <unistd.h>
+#endif
+
+#include "trdp_if_light.h"
+#include "vos_thread.h"
+#include "vos_utils.h"
+
+/***********************************************************************************************************************
+ * DEFINITIONS
+ */
+#define APP_VERSION         "1.0"
+
+#define FO_NOTIFY_COMID     7220u
+#define FO_REQUEST_COMID    7221u
+#define FO_DEFAULT_DEST     32u
+#define FO_MAX_DEST         64u             /* the replier drains its socket after each round */
+#define FO_DEFAULT_ROUNDS   200u
+#define FO_PAYLOAD_SIZE     1024u
+#define FO_REPLY_TIMEOUT    1000000u        /* us                               */
+#define FO_POLL_DELAY       200u            /* us between two polls             */
+#define FO_DRAIN_POLLS      5000u           /* max. polls to receive a round    */
+
+/***********************************************************************************************************************
+ * GLOBALS
+ */
+static BOOL8            gVerbose = FALSE;
+static UINT32           gNoOfDest = FO_DEFAULT_DEST;
+static TRDP_IP_ADDR_T   gDest[FO_MAX_DEST];
+static TRDP_UUID_T      gSessionId[FO_MAX_DEST];
+static BOOL8            gReplied[FO_MAX_DEST];
+static UINT32           gNotified;          /* notifications seen by the replier    */
+static UINT32           gReplies;           /* replies matching their session       */
+static UINT32           gMismatch;          /* replies from the wrong destination   */
+static UINT32           gPayload[FO_PAYLOAD_SIZE / sizeof(UINT32)];
+
+/***********************************************************************************************************************
+ * PROTOTYPES
+ */
+static void dbgOut (void *, TRDP_LOG_T, const CHAR8 *, const CHAR8 *, UINT16, const CHAR8 *);
+static void usage (const char *);
+static void callerCallback (void *, TRDP_APP_SESSION_T, const TRDP_MD_INFO_T *, UINT8 *, UINT32);
+static void replierCallback (void *, TRDP_APP_SESSION_T, const TRDP_MD_INFO_T *, UINT8 *, UINT32);
+static void poll (TRDP_APP_SESSION_T);
+static int runNotify (TRDP_APP_SESSION_T, TRDP_APP_SESSION_T, BOOL8, UINT32);
+static int runRequest (TRDP_APP_SESSION_T, TRDP_APP_SESSION_T);
+
+/**********************************************************************************************************************/
+/** callback routine for TRDP logging/error output
+ *
+ *  @param[in]      pRefCon          user supplied context pointer
+ *  @param[in]      category         Log category (Error, Warning, Info etc.)
+ *  @param[in]      pTime            pointer to NULL-terminated string of time stamp
+ *  @param[in]      pFile            pointer to NULL-terminated string of source module
+ *  @param[in]      lineNumber       line
+ *  @param[in]      pMsgStr          pointer to NULL-terminated string
+ *  @retval         none
+ */
+static void dbgOut (
+    void        *pRefCon,
+    TRDP_LOG_T  category,
+    const CHAR8 *pTime,
+    const CHAR8 *pFile,
+    UINT16      lineNumber,
+    const CHAR8 *pMsgStr)
+{
+    const char *catStr[] = {"**Error:", "Warning:", "   Info:", "  Debug:", "   User:"};
+
+    if ((category == VOS_LOG_ERROR) || (category == VOS_LOG_USR) || (gVerbose == TRUE))
+    {
+        printf("%s %s %s:%d %s",
+               strrchr(pTime, '-') + 1,
+               catStr[category],
+               strrchr(pFile, VOS_DIR_SEP) + 1,
+               lineNumber,
+               pMsgStr);
+    }
+}
+
+/**********************************************************************************************************************/
+/* Print a sensible usage message */
+static void usage (const char *appName)
+{
+    printf("Usage of %s\n", appName);
+    printf("This tool sends notifications and requests to many destinations on the local host and compares\n"
+           "one tlm_notify() per destination with tlm_notifyMulti().\n"
+           "Arguments are:\n"
+           "-n <number of destinations> (default %u, max. %u)\n"
+           "-r <number of rounds> (default %u)\n"
+           "-d verbose output\n"
+           "-h print usage\n",
+           FO_DEFAULT_DEST, FO_MAX_DEST, FO_DEFAULT_ROUNDS);
+}
+
+/**********************************************************************************************************************/
+/** Caller callback: match the reply with the session of its destination
+ *
+ *  @param[in]      pRefCon         user supplied context pointer
+ *  @param[in]      appHandle       session
+ *  @param[in]      pMsg            message info
+ *  @param[in]      pData           received data
+ *  @param[in]      dataSize        size of the data
+ */
+static void callerCallback (
+    void                    *pRefCon,
+    TRDP_APP_SESSION_T      appHandle,
+    const TRDP_MD_INFO_T    *pMsg,
+    UINT8                   *pData,
+    UINT32                  dataSize)
+{
+    UINT32 i;
+
+    if ((pMsg->msgType != TRDP_MSG_MP) || (pMsg->resultCode != TRDP_NO_ERR))
+    {
+        return;
+    }
+    for (i = 0u; i < gNoOfDest; i++)
+    {
+        if (memcmp(gSessionId[i], pMsg->sessionId, sizeof(TRDP_UUID_T)) == 0)
+        {
+            /*  The replier returns the address the request was sent to (its source address is chosen by the
+                kernel, as it is bound to any address)  */
+            if ((gReplied[i] == FALSE) && (dataSize == sizeof(UINT32)) &&
+                (vos_ntohl(*(UINT32 *)pData) == gDest[i]))
+            {
+                gReplied[i] = TRUE;
+                gReplies++;
+            }
+            else
+            {
+                gMismatch++;
+            }
+            return;
+        }
+    }
+    gMismatch++;
+}
+
+/**********************************************************************************************************************/
+/** Replier callback: count notifications, reply to requests with the destination address
+ *
+ *  @param[in]      pRefCon         user supplied context pointer
+ *  @param[in]      appHandle       session
+ *  @param[in]      pMsg            message info
+ *  @param[in]      pData           received data
+ *  @param[in]      dataSize        size of the data
+ */
+static void replierCallback (
+    void                    *pRefCon,
+    TRDP_APP_SESSION_T      appHandle,
+    const TRDP_MD_INFO_T    *pMsg,
+    UINT8                   *pData,
+    UINT32                  dataSize)
+{
+    UINT32 reply;
+
+    if (pMsg->resultCode != TRDP_NO_ERR)
+    {
+        return;
+    }
+    if ((pMsg->msgType == TRDP_MSG_MN) && (dataSize == FO_PAYLOAD_SIZE) &&
+        (memcmp(pData, gPayload, FO_PAYLOAD_SIZE) == 0))
+    {
+        gNotified++;
+    }
+    else if (pMsg->msgType == TRDP_MSG_MR)
+    {
+        reply = vos_htonl(pMsg->destIpAddr);
+        (void) tlm_reply(appHandle, &pMsg->sessionId, pMsg->comId, 0u, NULL, (UINT8 *)&reply, sizeof(reply));
+    }
+}
+
+/**********************************************************************************************************************/
+/** Process a session once
+ *
+ *  @param[in]      appHandle       session
+ */
+static void poll (
+    TRDP_APP_SESSION_T appHandle)
+{
+    TRDP_FDS_T  rfds;
+    INT32       noDesc;
+    TRDP_TIME_T tv;
+    INT32       rv;
+
+    FD_ZERO(&rfds);
+    tlc_getInterval(appHandle, &tv, &rfds, &noDesc);
+    vos_clearTime(&tv);
+    rv = vos_select(noDesc + 1, &rfds, NULL, NULL, &tv);
+    (void) tlc_process(appHandle, &rfds, &rv);
+}
+
+/**********************************************************************************************************************/
+/** Send notifications to all destinations, a number of rounds
+ *
+ *  @param[in]      caller          caller session
+ *  @param[in]      replier         replier session
+ *  @param[in]      multi           use tlm_notifyMulti
+ *  @param[in]      rounds          number of rounds
+ *  @retval         0               no error
+ *  @retval         1               some error
+ */
+static int runNotify (
+    TRDP_APP_SESSION_T  caller,
+    TRDP_APP_SESSION_T  replier,
+    BOOL8               multi,
+    UINT32              rounds)
+{
+    TRDP_STATISTICS_T   stats;
+    TRDP_TIME_T         start, now;
+    UINT64              sum     = 0u;
+    UINT32              lost    = 0u;
+    UINT32              r, i;
+    TRDP_ERR_T          err     = TRDP_NO_ERR;
+
+    (void) tlc_resetStatistics(caller);
+
+    for (r = 0u; r < rounds; r++)
+    {
+        gNotified = 0u;
+
+        /*  Time spent by the caller: queue and send one round  */
+        vos_getTime(&start);
+        if (multi == TRUE)
+        {
+            err = tlm_notifyMulti(caller, NULL, NULL, FO_NOTIFY_COMID, 0u, 0u, 0u, gDest, gNoOfDest,
+                                  TRDP_FLAGS_CALLBACK, NULL, (UINT8 *)gPayload, FO_PAYLOAD_SIZE, NULL, NULL);
+        }
+        else
+        {
+            for (i = 0u; (i < gNoOfDest) && (err == TRDP_NO_ERR); i++)
+            {
+                err = tlm_notify(caller, NULL, NULL, FO_NOTIFY_COMID, 0u, 0u, 0u, gDest[i],
+                                 TRDP_FLAGS_CALLBACK, NULL, (UINT8 *)gPayload, FO_PAYLOAD_SIZE, NULL, NULL);
+            }
+        }
+        if (err != TRDP_NO_ERR)
+        {
+            vos_printLog(VOS_LOG_USR, "tlm_notify%s failed (%s)\n", multi ? "Multi" : "",
+                         vos_getErrorString((VOS_ERR_T)err));
+            return 1;
+        }
+        poll(caller);
+        vos_getTime(&now);
+        vos_subTime(&now, &start);
+        sum += (UINT64)now.tv_sec * 1000000u + (UINT64)now.tv_usec;
+
+        for (i = 0u; (i < FO_DRAIN_POLLS) && (gNotified < gNoOfDest); i++)
+        {
+            poll(replier);
+            vos_threadDelay(FO_POLL_DELAY);
+        }
+        lost += gNoOfDest - gNotified;
+
+        /*  Let the caller free its sessions  */
+        poll(caller);
+    }
+
+    (void) tlc_getStatistics(caller, &stats);
+    printf("%-7s: %u notifications per round, %5u us per round, %u sent, %u lost\n",
+           multi ? "multi" : "single", gNoOfDest, (UINT32)(sum / rounds), stats.udpMd.numSend, lost);
+
+    return ((lost > 0u) || (stats.udpMd.numSend != rounds * gNoOfDest)) ? 1 : 0;
+}
+
+/**********************************************************************************************************************/
+/** Send one request to all destinations, every reply must match the session of its destination
+ *
+ *  @param[in]      caller          caller session
+ *  @param[in]      replier         replier session
+ *  @retval         0               no error
+ *  @retval         1               some error
+ */
+static int runRequest (
+    TRDP_APP_SESSION_T  caller,
+    TRDP_APP_SESSION_T  replier)
+{
+    TRDP_ERR_T  err;
+    UINT32      i;
+
+    gReplies    = 0u;
+    gMismatch   = 0u;
+    memset(gReplied, 0, sizeof(gReplied));
+
+    err = tlm_requestMulti(caller, NULL, NULL, gSessionId, FO_REQUEST_COMID, 0u, 0u, 0u, gDest, gNoOfDest,
+                           TRDP_FLAGS_CALLBACK, FO_REPLY_TIMEOUT, NULL, (UINT8 *)gPayload, FO_PAYLOAD_SIZE,
+                           NULL, NULL);
+    if (err != TRDP_NO_ERR)
+    {
+        vos_printLog(VOS_LOG_USR, "tlm_requestMulti failed (%s)\n", vos_getErrorString((VOS_ERR_T)err));
+        return 1;
+    }
+
+    for (i = 0u; (i < FO_DRAIN_POLLS) && (gReplies + gMismatch < gNoOfDest); i++)
+    {
+        poll(caller);
+        poll(replier);
+        vos_threadDelay(FO_POLL_DELAY);
+    }
+    /*  Let the caller free its sessions  */
+    poll(caller);
+
+    printf("request: %u destinations, %u replies matched, %u mismatched\n", gNoOfDest, gReplies, gMismatch);
+
+    return ((gReplies != gNoOfDest) || (gMismatch != 0u)) ? 1 : 0;
+}
+
+/**********************************************************************************************************************/
+/** main entry
+ *
+ *  @retval         0        no error
+ *  @retval         1        some error
+ */
+int main (int argc, char *argv[])
+{
+    TRDP_APP_SESSION_T      caller;
+    TRDP_APP_SESSION_T      replier;
+    TRDP_PROCESS_CONFIG_T   processConfig   = {"MdFanout", "", 0u, 0u, TRDP_OPTION_NONE};
+    TRDP_MD_CONFIG_T        callerConfig    = {callerCallback, NULL, TRDP_MD_DEFAULT_SEND_PARAM, TRDP_FLAGS_CALLBACK,
+                                               FO_REPLY_TIMEOUT, TRDP_MD_DEFAULT_CONFIRM_TIMEOUT,
+                                               TRDP_MD_DEFAULT_CONNECTION_TIMEOUT, TRDP_MD_DEFAULT_SENDING_TIMEOUT,
+                                               TRDP_MD_UDP_PORT, TRDP_MD_TCP_PORT, TRDP_MD_MAX_NUM_SESSIONS};
+    TRDP_MD_CONFIG_T        replierConfig   = {replierCallback, NULL, TRDP_MD_DEFAULT_SEND_PARAM, TRDP_FLAGS_CALLBACK,
+                                               FO_REPLY_TIMEOUT, TRDP_MD_DEFAULT_CONFIRM_TIMEOUT,
+                                               TRDP_MD_DEFAULT_CONNECTION_TIMEOUT, TRDP_MD_DEFAULT_SENDING_TIMEOUT,
+                                               TRDP_MD_UDP_PORT, TRDP_MD_TCP_PORT, TRDP_MD_MAX_NUM_SESSIONS};
+    TRDP_LIS_T              notifyListener;
+    TRDP_LIS_T              requestListener;
+    UINT32                  rounds  = FO_DEFAULT_ROUNDS;
+    UINT32                  i;
+    int                     rc      = 0;
+    int                     ch;
+
+    while ((ch = getopt(argc, argv, "n:r:dh?")) != -1)
+    {
+        switch (ch)
+        {
+           case 'n':
+               if ((sscanf(optarg, "%u", &gNoOfDest) < 1) || (gNoOfDest < 1u) || (gNoOfDest > FO_MAX_DEST))
+               {
+                   usage(argv[0]);
+                   exit(1);
+               }
+               break;
+           case 'r':
+               if ((sscanf(optarg, "%u", &rounds) < 1) || (rounds < 1u))
+               {
+                   usage(argv[0]);
+                   exit(1);
+               }
+               break;
+           case 'd':
+               gVerbose = TRUE;
+               break;
+           case 'h':
+           case '?':
+           default:
+               printf("%s: Version %s\t(%s - %s)\n", argv[0], APP_VERSION, __DATE__, __TIME__);
+               usage(argv[0]);
+               return 1;
+        }
+    }
+
+    for (i = 0u; i < gNoOfDest; i++)
+    {
+        gDest[i] = vos_dottedIP("127.0.0.2") + i;
+    }
+    for (i = 0u; i < FO_PAYLOAD_SIZE / sizeof(UINT32); i++)
+    {
+        gPayload[i] = i;
+    }
+
+    if (tlc_init(&dbgOut, NULL, NULL) != TRDP_NO_ERR)
+    {
+        fprintf(stderr, "Initialization error\n");
+        return 1;
+    }
+
+    if ((tlc_openSession(&caller, vos_dottedIP("127.0.0.1"), 0u, NULL, NULL, &callerConfig, &processConfig)
+         != TRDP_NO_ERR) ||
+        (tlc_openSession(&replier, 0u, 0u, NULL, NULL, &replierConfig, &processConfig)
+         != TRDP_NO_ERR))
+    {
+        vos_printLogStr(VOS_LOG_USR, "Initialization error\n");
+        tlc_terminate();
+        return 1;
+    }
+
+    if ((tlm_addListener(replier, &notifyListener, NULL, NULL, TRUE, FO_NOTIFY_COMID, 0u, 0u,
+                         0u, 0u, 0u, TRDP_FLAGS_CALLBACK, NULL, NULL) != TRDP_NO_ERR) ||
+        (tlm_addListener(replier, &requestListener, NULL, NULL, TRUE, FO_REQUEST_COMID, 0u, 0u,
+                         0u, 0u, 0u, TRDP_FLAGS_CALLBACK, NULL, NULL) != TRDP_NO_ERR))
+    {
+        vos_printLogStr(VOS_LOG_USR, "tlm_addListener error\n");
+        tlc_terminate();
+        return 1;
+    }
+
+    printf("%u destinations (%s ...), %u rounds, %u bytes payload\n",
+           gNoOfDest, vos_ipDotted(gDest[0]), rounds, FO_PAYLOAD_SIZE);
+
+    rc |= runNotify(caller, replier, FALSE, rounds);
+    rc |= runNotify(caller, replier, TRUE, rounds);
+    rc |= runRequest(caller, replier);
+
+    (void) tlm_delListener(replier, requestListener);
+    (void) tlm_delListener(replier, notifyListener);
+    (void) tlc_closeSession(replier);
+    (void) tlc_closeSession(caller);
+    (void) tlc_terminate();
+
+    return rc;
+}
@@ -0,0 +1,371 @@
+/**********************************************************************************************************************/
+/**
+ * @file            trdp-md-rtt-test.c
+ *
+ * @brief           MD call latency with fixed and adaptive retry timeouts
+ *
+ * @details         A caller session on 127.0.0.1 sends requests to a replier session on 127.0.0.2, one at a time.
+ *                  The replier drops every n-th request once (it aborts the session instead of replying), the caller
+ *                  has to retry. The calls are run with the retry after the reply timeout (default) and with the
+ *                  adaptive retry timeout (tlm_setAdaptiveRetry), reported is the call latency and the round trip
+ *                  time estimation of the replier (tlc_getMdPeerStatistics).
+ *
+ * @note            Project: TCNOpen TRDP prototype stack
+ *
+ * @author          agent
+ *
+ * @remarks This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0.
+ *          If a copy of the MPL was not distributed with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ *          Copyright agent, 2026. All rights reserved.
+ *
+ * $Id$
+ *
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#if defined (POSIX)
+#include <unistd.h>
+#endif
+
+#include "trdp_if_light.h"
+#include "vos_thread.h"
+#include "vos_utils.h"
+
+/***********************************************************************************************************************
+ * DEFINITIONS
+ */
+#define APP_VERSION         "1.0"
+
+#define RT_COMID            7210u
+#define RT_DEFAULT_COUNT    200u
+#define RT_MAX_COUNT        10000u
+#define RT_DEFAULT_DROP     10u
+#define RT_REPLY_TIMEOUT    200000u         /* us                               */
+#define RT_POLL_DELAY       200u            /* us between two polls             */
+
+/***********************************************************************************************************************
+ * GLOBALS
+ */
+static BOOL8        gVerbose = FALSE;
+static UINT32       gDropEvery = RT_DEFAULT_DROP;
+static UINT32       gRequests;              /* requests seen by the replier     */
+static TRDP_UUID_T  gDropped;               /* session of the dropped request   */
+static BOOL8        gDone;
+static TRDP_ERR_T   gResult;
+static UINT32       gLatency[RT_MAX_COUNT];
+static UINT32       gPayload[16];
+
+/***********************************************************************************************************************
+ * PROTOTYPES
+ */
+static void dbgOut (void *, TRDP_LOG_T, const CHAR8 *, const CHAR8 *, UINT16, const CHAR8 *);
+static void usage (const char *);
+static void callerCallback (void *, TRDP_APP_SESSION_T, const TRDP_MD_INFO_T *, UINT8 *, UINT32);
+static void replierCallback (void *, TRDP_APP_SESSION_T, const TRDP_MD_INFO_T *, UINT8 *, UINT32);
+static int cmpLatency (const void *, const void *);
+static int runTest (TRDP_APP_SESSION_T, TRDP_APP_SESSION_T, BOOL8, UINT32);
+
+/**********************************************************************************************************************/
+/** callback routine for TRDP logging/error output
+ *
+ *  @param[in]      pRefCon          user supplied context pointer
+ *  @param[in]      category         Log category (Error, Warning, Info etc.)
+ *  @param[in]      pTime            pointer to NULL-terminated string of time stamp
+ *  @param[in]      pFile            pointer to NULL-terminated string of source module
+ *  @param[in]      lineNumber       line
+ *  @param[in]      pMsgStr          pointer to NULL-terminated string
+ *  @retval         none
+ */
+static void dbgOut (
+    void        *pRefCon,
+    TRDP_LOG_T  category,
+    const CHAR8 *pTime,
+    const CHAR8 *pFile,
+    UINT16      lineNumber,
+    const CHAR8 *pMsgStr)
+{
+    const char *catStr[] = {"**Error:", "Warning:", "   Info:", "  Debug:", "   User:"};
+
+    if ((category == VOS_LOG_ERROR) || (category == VOS_LOG_USR) || (gVerbose == TRUE))
+    {
+        printf("%s %s %s:%d %s",
+               strrchr(pTime, '-') + 1,
+               catStr[category],
+               strrchr(pFile, VOS_DIR_SEP) + 1,
+               lineNumber,
+               pMsgStr);
+    }
+}
+
+/**********************************************************************************************************************/
+/* Print a sensible usage message */
+static void usage (const char *appName)
+{
+    printf("Usage of %s\n", appName);
+    printf("This tool calls a replier on the local host which drops some requests once and reports the call\n"
+           "latency with the retry after the reply timeout and with the adaptive retry timeout.\n"
+           "Arguments are:\n"
+           "-n <number of calls per run> (default %u, max. %u)\n"
+           "-l <drop every n-th request, 0 = none> (default %u)\n"
+           "-d verbose output\n"
+           "-h print usage\n",
+           RT_DEFAULT_COUNT, RT_MAX_COUNT, RT_DEFAULT_DROP);
+}
+
+/**********************************************************************************************************************/
+/** Caller callback: the call is done
+ *
+ *  @param[in]      pRefCon         user supplied context pointer
+ *  @param[in]      appHandle       session
+ *  @param[in]      pMsg            message info
+ *  @param[in]      pData           received data
+ *  @param[in]      dataSize        size of the data
+ */
+static void callerCallback (
+    void                    *pRefCon,
+    TRDP_APP_SESSION_T      appHandle,
+    const TRDP_MD_INFO_T    *pMsg,
+    UINT8                   *pData,
+    UINT32                  dataSize)
+{
+    if ((pMsg->msgType == TRDP_MSG_MP) || (pMsg->resultCode != TRDP_NO_ERR))
+    {
+        gResult = pMsg->resultCode;
+        gDone   = TRUE;
+    }
+}
+
+/**********************************************************************************************************************/
+/** Replier callback: reply, but drop every n-th request once
+ *
+ *  @param[in]      pRefCon         user supplied context pointer
+ *  @param[in]      appHandle       session
+ *  @param[in]      pMsg            message info
+ *  @param[in]      pData           received data
+ *  @param[in]      dataSize        size of the data
+ */
+static void replierCallback (
+    void                    *pRefCon,
+    TRDP_APP_SESSION_T      appHandle,
+    const TRDP_MD_INFO_T    *pMsg,
+    UINT8                   *pData,
+    UINT32                  dataSize)
+{
+    if ((pMsg->msgType != TRDP_MSG_MR) || (pMsg->resultCode != TRDP_NO_ERR))
+    {
+        return;
+    }
+    gRequests++;
+    if ((gDropEvery != 0u) && ((gRequests % gDropEvery) == 0u) &&
+        (memcmp(gDropped, pMsg->sessionId, sizeof(TRDP_UUID_T)) != 0))
+    {
+        /*  Forget the request, the retry will be answered  */
+        memcpy(gDropped, pMsg->sessionId, sizeof(TRDP_UUID_T));
+        (void) tlm_abortSession(appHandle, &pMsg->sessionId);
+        return;
+    }
+    (void) tlm_reply(appHandle, &pMsg->sessionId, pMsg->comId, 0u, NULL, (UINT8 *)gPayload, sizeof(gPayload));
+}
+
+/**********************************************************************************************************************/
+static int cmpLatency (const void *pA, const void *pB)
+{
+    UINT32 a = *(const UINT32 *)pA;
+    UINT32 b = *(const UINT32 *)pB;
+
+    return (a > b) - (a < b);
+}
+
+/**********************************************************************************************************************/
+/** Run a number of calls, one after the other
+ *
+ *  @param[in]      caller          caller session
+ *  @param[in]      replier         replier session
+ *  @param[in]      adaptive        use the adaptive retry timeout
+ *  @param[in]      count           number of calls
+ *  @retval         0               no error
+ *  @retval         1               some error
+ */
+static int runTest (
+    TRDP_APP_SESSION_T  caller,
+    TRDP_APP_SESSION_T  replier,
+    BOOL8               adaptive,
+    UINT32              count)
+{
+    TRDP_APP_SESSION_T          session[2];
+    TRDP_MD_PEER_STATISTICS_T   peer;
+    TRDP_TIME_T                 start, now;
+    UINT16                      numPeer = 1u;
+    UINT32                      failed  = 0u;
+    UINT64                      sum     = 0u;
+    UINT32                      i, s;
+    TRDP_ERR_T                  err;
+
+    session[0]  = caller;
+    session[1]  = replier;
+    gRequests   = 0u;
+    memset(gDropped, 0, sizeof(TRDP_UUID_T));
+
+    if (tlm_setAdaptiveRetry(caller, adaptive, 0u) != TRDP_NO_ERR)
+    {
+        return 1;
+    }
+
+    for (i = 0u; i < count; i++)
+    {
+        gDone   = FALSE;
+        gResult = TRDP_NO_ERR;
+        vos_getTime(&start);
+        err = tlm_request(caller, NULL, NULL, NULL, RT_COMID, 0u, 0u, 0u, vos_dottedIP("127.0.0.2"),
+                          TRDP_FLAGS_CALLBACK, 1u, RT_REPLY_TIMEOUT, NULL,
+                          (UINT8 *)gPayload, sizeof(gPayload), NULL, NULL);
+        if (err != TRDP_NO_ERR)
+        {
+            vos_printLog(VOS_LOG_USR, "tlm_request failed (%s)\n", vos_getErrorString((VOS_ERR_T)err));
+            return 1;
+        }
+
+        while (gDone == FALSE)
+        {
+            for (s = 0u; s < 2u; s++)
+            {
+                TRDP_FDS_T  rfds;
+                INT32       noDesc;
+                TRDP_TIME_T tv;
+                INT32       rv;
+
+                FD_ZERO(&rfds);
+                tlc_getInterval(session[s], &tv, &rfds, &noDesc);
+                vos_clearTime(&tv);
+                rv = vos_select(noDesc + 1, &rfds, NULL, NULL, &tv);
+                (void) tlc_process(session[s], &rfds, &rv);
+            }
+            vos_threadDelay(RT_POLL_DELAY);
+        }
+
+        vos_getTime(&now);
+        vos_subTime(&now, &start);
+        gLatency[i] = (UINT32)now.tv_sec * 1000000u + (UINT32)now.tv_usec;
+        sum += gLatency[i];
+        if (gResult != TRDP_NO_ERR)
+        {
+            failed++;
+        }
+    }
+
+    qsort(gLatency, count, sizeof(UINT32), cmpLatency);
+
+    if (tlc_getMdPeerStatistics(caller, &numPeer, &peer) != TRDP_NO_ERR)
+    {
+        numPeer = 0u;
+    }
+    printf("%-8s: latency mean %6u us, p99 %6u us, max %6u us, failed %u/%u\n",
+           adaptive ? "adaptive" : "fixed",
+           (UINT32)(sum / count), gLatency[(count * 99u) / 100u], gLatency[count - 1u], failed, count);
+    if (numPeer == 1u)
+    {
+        printf("          peer %s: srtt %u us, rttVar %u us, retry timeout %u us, %u samples, %u retries\n",
+               vos_ipDotted(peer.ipAddr), peer.srtt, peer.rttVar, peer.retryTimeout, peer.numSamples,
+               peer.numRetries);
+    }
+    (void) tlc_resetStatistics(caller);
+
+    /*  A dropped request must not wait for the reply timeout with adaptive retries  */
+    return ((failed > 0u) || (numPeer != 1u) ||
+            (adaptive && (gDropEvery != 0u) && (gLatency[count - 1u] >= RT_REPLY_TIMEOUT))) ? 1 : 0;
+}
+
+/**********************************************************************************************************************/
+/** main entry
+ *
+ *  @retval         0        no error
+ *  @retval         1        some error
+ */
+int main (int argc, char *argv[])
+{
+    TRDP_APP_SESSION_T      caller;
+    TRDP_APP_SESSION_T      replier;
+    TRDP_PROCESS_CONFIG_T   processConfig   = {"MdRtt", "", 0u, 0u, TRDP_OPTION_NONE};
+    TRDP_MD_CONFIG_T        callerConfig    = {callerCallback, NULL, TRDP_MD_DEFAULT_SEND_PARAM, TRDP_FLAGS_CALLBACK,
+                                               RT_REPLY_TIMEOUT, TRDP_MD_DEFAULT_CONFIRM_TIMEOUT,
+                                               TRDP_MD_DEFAULT_CONNECTION_TIMEOUT, TRDP_MD_DEFAULT_SENDING_TIMEOUT,
+                                               TRDP_MD_UDP_PORT, TRDP_MD_TCP_PORT, TRDP_MD_MAX_NUM_SESSIONS};
+    TRDP_MD_CONFIG_T        replierConfig   = {replierCallback, NULL, TRDP_MD_DEFAULT_SEND_PARAM, TRDP_FLAGS_CALLBACK,
+                                               RT_REPLY_TIMEOUT, TRDP_MD_DEFAULT_CONFIRM_TIMEOUT,
+                                               TRDP_MD_DEFAULT_CONNECTION_TIMEOUT, TRDP_MD_DEFAULT_SENDING_TIMEOUT,
+                                               TRDP_MD_UDP_PORT, TRDP_MD_TCP_PORT, TRDP_MD_MAX_NUM_SESSIONS};
+    TRDP_LIS_T              listener;
+    UINT32                  count   = RT_DEFAULT_COUNT;
+    int                     rc      = 0;
+    int                     ch;
+
+    while ((ch = getopt(argc, argv, "n:l:dh?")) != -1)
+    {
+        switch (ch)
+        {
+           case 'n':
+               if ((sscanf(optarg, "%u", &count) < 1) || (count < 1u) || (count > RT_MAX_COUNT))
+               {
+                   usage(argv[0]);
+                   exit(1);
+               }
+               break;
+           case 'l':
+               if (sscanf(optarg, "%u", &gDropEvery) < 1)
+               {
+                   usage(argv[0]);
+                   exit(1);
+               }
+               break;
+           case 'd':
+               gVerbose = TRUE;
+               break;
+           case 'h':
+           case '?':
+           default:
+               printf("%s: Version %s\t(%s - %s)\n", argv[0], APP_VERSION, __DATE__, __TIME__);
+               usage(argv[0]);
+               return 1;
+        }
+    }
+
+    if (tlc_init(&dbgOut, NULL, NULL) != TRDP_NO_ERR)
+    {
+        fprintf(stderr, "Initialization error\n");
+        return 1;
+    }
+
+    if ((tlc_openSession(&caller, vos_dottedIP("127.0.0.1"), 0u, NULL, NULL, &callerConfig, &processConfig)
+         != TRDP_NO_ERR) ||
+        (tlc_openSession(&replier, vos_dottedIP("127.0.0.2"), 0u, NULL, NULL, &replierConfig, &processConfig)
+         != TRDP_NO_ERR))
+    {
+        vos_printLogStr(VOS_LOG_USR, "Initialization error\n");
+        tlc_terminate();
+        return 1;
+    }
+
+    if (tlm_addListener(replier, &listener, NULL, NULL, TRUE, RT_COMID, 0u, 0u,
+                        0u, 0u, 0u, TRDP_FLAGS_CALLBACK, NULL, NULL) != TRDP_NO_ERR)
+    {
+        vos_printLogStr(VOS_LOG_USR, "tlm_addListener error\n");
+        tlc_terminate();
+        return 1;
+    }
+
+    printf("%u calls, every %u. request dropped once, reply timeout %u us, %u retries\n",
+           count, gDropEvery, RT_REPLY_TIMEOUT, TRDP_MD_DEFAULT_RETRIES);
+
+    rc |= runTest(caller, replier, FALSE, count);
+    rc |= runTest(caller, replier, TRUE, count);
+
+    (void) tlm_delListener(replier, listener);
+    (void) tlc_closeSession(replier);
+    (void) tlc_closeSession(caller);
+    (void) tlc_terminate();
+
+    return rc;
+}
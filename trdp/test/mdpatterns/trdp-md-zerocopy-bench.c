@@ -0,0 +1,450 @@
+/**********************************************************************************************************************/
+/**
+ * @file            trdp-md-zerocopy-bench.c
+ *
+ * @brief           MD transmit throughput: copied, referenced and zero copy payloads
+ *
+ * @details         Sends notifications of a given size to a listener of the same session on the local host, over UDP
+ *                  and TCP, with the payload copied into the stack (default), sent by reference from the caller's
+ *                  buffer (tlm_setPayloadRef) and sent by reference with zero copy (MSG_ZEROCOPY on Linux).
+ *                  The session is polled without waiting, reported is the throughput until the last reception.
+ *                  Note that the loopback device copies zero copy payloads anyway, the gain of zero copy is visible on
+ *                  real NICs only, the gain of sending by reference is visible here.
+ *
+ * @note            Project: TCNOpen TRDP prototype stack
+ *
+ * @author          agent
+ *
+ * @remarks This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0.
+ *          If a copy of the MPL was not distributed with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ *          Copyright agent, 2026. All rights reserved.
+ *
+ * $Id$
+ *
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#if defined (POSIX)
+#include <unistd.h>
+#endif
+
+#include "trdp_if_light.h"
+#include "vos_thread.h"
+#include "vos_utils.h"
+
+/***********************************************************************************************************************
+ * DEFINITIONS
+ */
+#define APP_VERSION         "1.0"
+
+#define ZB_COMID_UDP        7200u
+#define ZB_COMID_TCP        7201u
+#define ZB_DEFAULT_SIZE     60000u
+#define ZB_DEFAULT_COUNT    2000u
+#define ZB_DEFAULT_WINDOW   8u
+#define ZB_MAX_WINDOW       64u
+#define ZB_TIMEOUT          10u             /* s, per run                       */
+#define ZB_STALL            100000          /* us without reception: count the notifications in flight as lost */
+
+typedef enum
+{
+    ZB_COPY         = 0,
+    ZB_REFERENCE    = 1,
+    ZB_ZEROCOPY     = 2
+} ZB_MODE_T;
+
+typedef struct
+{
+    UINT8   *pData;
+    BOOL8   inUse;                          /* referenced by the stack          */
+} ZB_BUFFER_T;
+
+/***********************************************************************************************************************
+ * GLOBALS
+ */
+static const char       *cModeName[] = {"copy", "reference", "zero copy"};
+static ZB_BUFFER_T      gBuffer[ZB_MAX_WINDOW];
+static UINT32           gDataSize   = ZB_DEFAULT_SIZE;
+static UINT32           gWindow     = ZB_DEFAULT_WINDOW;
+static BOOL8            gVerbose    = FALSE;
+static UINT32           gReceived;
+static UINT32           gCorrupt;
+static UINT32           gReleased;
+static UINT32           gLost;
+
+/***********************************************************************************************************************
+ * PROTOTYPES
+ */
+static void dbgOut (void *, TRDP_LOG_T, const CHAR8 *, const CHAR8 *, UINT16, const CHAR8 *);
+static void usage (const char *);
+static void mdCallback (void *, TRDP_APP_SESSION_T, const TRDP_MD_INFO_T *, UINT8 *, UINT32);
+static void mdRelease (void *, const UINT8 *, UINT32);
+static int runTest (TRDP_APP_SESSION_T, BOOL8, ZB_MODE_T, UINT32);
+
+/**********************************************************************************************************************/
+/** callback routine for TRDP logging/error output
+ *
+ *  @param[in]      pRefCon          user supplied context pointer
+ *  @param[in]      category         Log category (Error, Warning, Info etc.)
+ *  @param[in]      pTime            pointer to NULL-terminated string of time stamp
+ *  @param[in]      pFile            pointer to NULL-terminated string of source module
+ *  @param[in]      lineNumber       line
+ *  @param[in]      pMsgStr          pointer to NULL-terminated string
+ *  @retval         none
+ */
+static void dbgOut (
+    void        *pRefCon,
+    TRDP_LOG_T  category,
+    const CHAR8 *pTime,
+    const CHAR8 *pFile,
+    UINT16      lineNumber,
+    const CHAR8 *pMsgStr)
+{
+    const char *catStr[] = {"**Error:", "Warning:", "   Info:", "  Debug:", "   User:"};
+
+    if (((category != VOS_LOG_DBG) && (category != VOS_LOG_INFO)) || (gVerbose == TRUE))
+    {
+        printf("%s %s %s:%d %s",
+               strrchr(pTime, '-') + 1,
+               catStr[category],
+               strrchr(pFile, VOS_DIR_SEP) + 1,
+               lineNumber,
+               pMsgStr);
+    }
+}
+
+/**********************************************************************************************************************/
+/* Print a sensible usage message */
+static void usage (const char *appName)
+{
+    printf("Usage of %s\n", appName);
+    printf("This tool sends MD notifications to itself on the local host and reports the throughput with the\n"
+           "payload copied, sent by reference and sent with zero copy, over UDP and TCP.\n"
+           "Arguments are:\n"
+           "-s <payload size> (default %u, max. %u)\n"
+           "-n <number of notifications per run> (default %u)\n"
+           "-w <notifications in flight over UDP> (default %u, max. %u)\n"
+           "-d verbose output\n"
+           "-h print usage\n",
+           ZB_DEFAULT_SIZE, TRDP_MAX_MD_DATA_SIZE, ZB_DEFAULT_COUNT, ZB_DEFAULT_WINDOW, ZB_MAX_WINDOW);
+}
+
+/**********************************************************************************************************************/
+/** MD callback: count and check the received notifications
+ *
+ *  @param[in]      pRefCon         user supplied context pointer
+ *  @param[in]      appHandle       session
+ *  @param[in]      pMsg            message info
+ *  @param[in]      pData           received data
+ *  @param[in]      dataSize        size of the data
+ */
+static void mdCallback (
+    void                    *pRefCon,
+    TRDP_APP_SESSION_T      appHandle,
+    const TRDP_MD_INFO_T    *pMsg,
+    UINT8                   *pData,
+    UINT32                  dataSize)
+{
+    UINT32 first, last;
+
+    if ((pMsg->resultCode != TRDP_NO_ERR) || (pMsg->msgType != TRDP_MSG_MN))
+    {
+        return;
+    }
+
+    /*  The message number is written to the first and the last word of the payload   */
+    if ((pData == NULL) || (dataSize != gDataSize))
+    {
+        gCorrupt++;
+    }
+    else
+    {
+        memcpy(&first, pData, sizeof(first));
+        memcpy(&last, pData + dataSize - sizeof(last), sizeof(last));
+        if (first != last)
+        {
+            gCorrupt++;
+        }
+    }
+    gReceived++;
+}
+
+/**********************************************************************************************************************/
+/** Release callback: the stack no longer references the buffer
+ *
+ *  @param[in]      pRefCon         user supplied context pointer
+ *  @param[in]      pData           released payload
+ *  @param[in]      dataSize        size of the payload
+ */
+static void mdRelease (
+    void        *pRefCon,
+    const UINT8 *pData,
+    UINT32      dataSize)
+{
+    UINT32 i;
+
+    for (i = 0u; i < gWindow; i++)
+    {
+        if (gBuffer[i].pData == pData)
+        {
+            gBuffer[i].inUse = FALSE;
+        }
+    }
+    gReleased++;
+}
+
+/**********************************************************************************************************************/
+/** Send a number of notifications and wait until they were received
+ *
+ *  @param[in]      appHandle       session
+ *  @param[in]      tcp             use TCP
+ *  @param[in]      mode            payload handling
+ *  @param[in]      count           number of notifications
+ *  @retval         0               no error
+ *  @retval         1               some error
+ */
+static int runTest (
+    TRDP_APP_SESSION_T  appHandle,
+    BOOL8               tcp,
+    ZB_MODE_T           mode,
+    UINT32              count)
+{
+    TRDP_TIME_T     start, now, elapsed, lastRx, stall;
+    UINT32          lastReceived = 0u;
+    TRDP_IP_ADDR_T  destIP  = vos_dottedIP("127.0.0.1");
+    UINT32          sent    = 0u;
+    UINT32          i;
+    double          seconds;
+    TRDP_ERR_T      err;
+
+    gReceived   = 0u;
+    gCorrupt    = 0u;
+    gReleased   = 0u;
+    gLost       = 0u;
+    for (i = 0u; i < gWindow; i++)
+    {
+        gBuffer[i].inUse = FALSE;
+    }
+
+    err = tlm_setPayloadRef(appHandle,
+                            (mode == ZB_COPY) ? 0u : 1u,
+                            (mode == ZB_ZEROCOPY) ? 1u : 0u,
+                            mdRelease, NULL);
+    if (err != TRDP_NO_ERR)
+    {
+        return 1;
+    }
+
+    vos_getTime(&start);
+    lastRx      = start;
+
+    do
+    {
+        TRDP_FDS_T  rfds;
+        INT32       noDesc;
+        TRDP_TIME_T tv;
+        INT32       rv;
+
+        /*  Keep the window filled. Over TCP only one notification is sent at a time, concurrent notifications
+            would open a connection each   */
+        while ((sent < count) && (sent < gReceived + gLost + (tcp ? 1u : gWindow)))
+        {
+            ZB_BUFFER_T *pBuffer = NULL;
+
+            for (i = 0u; (i < gWindow) && (pBuffer == NULL); i++)
+            {
+                if (gBuffer[i].inUse == FALSE)
+                {
+                    pBuffer = &gBuffer[i];
+                }
+            }
+            if (pBuffer == NULL)
+            {
+                break;
+            }
+            memcpy(pBuffer->pData, &sent, sizeof(sent));
+            memcpy(pBuffer->pData + gDataSize - sizeof(sent), &sent, sizeof(sent));
+            pBuffer->inUse = (mode != ZB_COPY);
+
+            err = tlm_notify(appHandle, NULL, NULL,
+                             tcp ? ZB_COMID_TCP : ZB_COMID_UDP,
+                             0u, 0u,
+                             0u, destIP,
+                             tcp ? TRDP_FLAGS_TCP : TRDP_FLAGS_NONE,
+                             NULL,
+                             pBuffer->pData, gDataSize,
+                             NULL, NULL);
+            if (err != TRDP_NO_ERR)
+            {
+                vos_printLog(VOS_LOG_USR, "tlm_notify failed (%s)\n", vos_getErrorString((VOS_ERR_T)err));
+                return 1;
+            }
+            sent++;
+        }
+
+        /*  Poll, partially sent TCP messages are continued by the next tlc_process() */
+        FD_ZERO(&rfds);
+        tlc_getInterval(appHandle, &tv, &rfds, &noDesc);
+        vos_clearTime(&tv);
+        rv = vos_select(noDesc + 1, &rfds, NULL, NULL, &tv);
+        (void) tlc_process(appHandle, &rfds, &rv);
+
+        vos_getTime(&now);
+        if (gReceived != lastReceived)
+        {
+            lastReceived    = gReceived;
+            lastRx          = now;
+        }
+        else if (sent > gReceived + gLost)
+        {
+            /*  UDP datagrams dropped (receive buffer), do not wait for them   */
+            stall = now;
+            vos_subTime(&stall, &lastRx);
+            if ((stall.tv_sec > 0) || (stall.tv_usec > ZB_STALL))
+            {
+                gLost   = sent - gReceived;
+                lastRx  = now;
+            }
+        }
+        elapsed = now;
+        vos_subTime(&elapsed, &start);
+        if (elapsed.tv_sec >= ZB_TIMEOUT)
+        {
+            break;
+        }
+    }
+    while ((gReceived + gLost < count) || ((mode != ZB_COPY) && (gReleased < sent)));
+
+    /*  Throughput until the last reception    */
+    elapsed = lastRx;
+    vos_subTime(&elapsed, &start);
+    seconds = (double) elapsed.tv_sec + (double) elapsed.tv_usec / 1e6;
+
+    printf("%-3s %-9s: %8.1f MB/s, %8.0f msg/s, received %u/%u, released %u, corrupt %u\n",
+           tcp ? "TCP" : "UDP",
+           cModeName[mode],
+           (double) gReceived * gDataSize / seconds / 1e6,
+           (double) gReceived / seconds,
+           gReceived, count, gReleased, gCorrupt);
+
+    /*  Every payload passed by reference must have been released  */
+    return ((gCorrupt > 0u) || ((mode != ZB_COPY) && (gReleased != sent))) ? 1 : 0;
+}
+
+/**********************************************************************************************************************/
+/** main entry
+ *
+ *  @retval         0        no error
+ *  @retval         1        some error
+ */
+int main (int argc, char *argv[])
+{
+    TRDP_APP_SESSION_T      appHandle;
+    TRDP_PROCESS_CONFIG_T   processConfig   = {"MdZeroCopy", "", 0u, 0u, TRDP_OPTION_NONE};
+    TRDP_MD_CONFIG_T        mdConfig        = {mdCallback, NULL, TRDP_MD_DEFAULT_SEND_PARAM, TRDP_FLAGS_CALLBACK,
+                                               TRDP_MD_DEFAULT_REPLY_TIMEOUT, TRDP_MD_DEFAULT_CONFIRM_TIMEOUT,
+                                               TRDP_MD_DEFAULT_CONNECTION_TIMEOUT, TRDP_MD_DEFAULT_SENDING_TIMEOUT,
+                                               TRDP_MD_UDP_PORT, TRDP_MD_TCP_PORT, TRDP_MD_MAX_NUM_SESSIONS};
+    TRDP_LIS_T              listenUDP;
+    TRDP_LIS_T              listenTCP;
+    UINT32                  count   = ZB_DEFAULT_COUNT;
+    UINT32                  i;
+    int                     rc      = 0;
+    int                     ch;
+
+    while ((ch = getopt(argc, argv, "s:n:w:dh?")) != -1)
+    {
+        switch (ch)
+        {
+           case 's':
+               if ((sscanf(optarg, "%u", &gDataSize) < 1) || (gDataSize < 8u) ||
+                   (gDataSize > TRDP_MAX_MD_DATA_SIZE))
+               {
+                   usage(argv[0]);
+                   exit(1);
+               }
+               break;
+           case 'n':
+               if ((sscanf(optarg, "%u", &count) < 1) || (count < 1u))
+               {
+                   usage(argv[0]);
+                   exit(1);
+               }
+               break;
+           case 'w':
+               if ((sscanf(optarg, "%u", &gWindow) < 1) || (gWindow < 1u) || (gWindow > ZB_MAX_WINDOW))
+               {
+                   usage(argv[0]);
+                   exit(1);
+               }
+               break;
+           case 'd':
+               gVerbose = TRUE;
+               break;
+           case 'h':
+           case '?':
+           default:
+               printf("%s: Version %s\t(%s - %s)\n", argv[0], APP_VERSION, __DATE__, __TIME__);
+               usage(argv[0]);
+               return 1;
+        }
+    }
+
+    for (i = 0u; i < gWindow; i++)
+    {
+        gBuffer[i].pData = (UINT8 *) calloc(1u, gDataSize);
+        if (gBuffer[i].pData == NULL)
+        {
+            fprintf(stderr, "Out of memory\n");
+            return 1;
+        }
+    }
+
+    if (tlc_init(&dbgOut, NULL, NULL) != TRDP_NO_ERR)
+    {
+        fprintf(stderr, "Initialization error\n");
+        return 1;
+    }
+
+    if (tlc_openSession(&appHandle, vos_dottedIP("127.0.0.1"), 0u, NULL, NULL, &mdConfig, &processConfig)
+        != TRDP_NO_ERR)
+    {
+        vos_printLogStr(VOS_LOG_USR, "Initialization error\n");
+        tlc_terminate();
+        return 1;
+    }
+
+    if ((tlm_addListener(appHandle, &listenUDP, NULL, NULL, TRUE, ZB_COMID_UDP, 0u, 0u,
+                         0u, 0u, 0u, TRDP_FLAGS_CALLBACK, NULL, NULL) != TRDP_NO_ERR)
+        || (tlm_addListener(appHandle, &listenTCP, NULL, NULL, TRUE, ZB_COMID_TCP, 0u, 0u,
+                            0u, 0u, 0u, TRDP_FLAGS_CALLBACK | TRDP_FLAGS_TCP, NULL, NULL) != TRDP_NO_ERR))
+    {
+        vos_printLogStr(VOS_LOG_USR, "tlm_addListener failed\n");
+        tlc_terminate();
+        return 1;
+    }
+
+    vos_printLogStr(VOS_LOG_USR, "-----------------------------------------------\n");
+    vos_printLog(VOS_LOG_USR, "Payload size              :   %u bytes\n", gDataSize);
+    vos_printLog(VOS_LOG_USR, "Notifications per run     :   %u, %u in flight\n", count, gWindow);
+    vos_printLogStr(VOS_LOG_USR, "-----------------------------------------------\n");
+
+    for (i = 0u; i < 6u; i++)
+    {
+        rc |= runTest(appHandle, (i >= 3u) ? TRUE : FALSE, (ZB_MODE_T) (i % 3u), count);
+    }
+
+    (void) tlm_delListener(appHandle, listenUDP);
+    (void) tlm_delListener(appHandle, listenTCP);
+    (void) tlc_closeSession(appHandle);
+    (void) tlc_terminate();
+
+    for (i = 0u; i < gWindow; i++)
+    {
+        free(gBuffer[i].pData);
+    }
+    return rc;
+}
@@ -0,0 +1,283 @@
+/**********************************************************************************************************************/
+/**
+ * @file            trdp-pd-batch-test.c
+ *
+ * @brief           Batch callback with several packets of one telegram per receive pass
+ *
+ * @details         Publishes two telegrams on demand to the local host and subscribes to them with the batch
+ *                  callback. Every round sends the first telegram twice (the second time unchanged) and the second
+ *                  telegram once, before a single receive pass picks up all three packets. The batch callback
+ *                  checks that every entry carries the data of its own telegram.
+ *
+ * @note            Project: TCNOpen TRDP prototype stack
+ *
+ * @author          agent
+ *
+ * @remarks This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0.
+ *          If a copy of the MPL was not distributed with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ *          Copyright agent, 2026. All rights reserved.
+ *
+ * $Id$
+ *
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#if defined (POSIX)
+#include <unistd.h>
+#endif
+
+#include "trdp_if_light.h"
+#include "vos_thread.h"
+#include "vos_utils.h"
+
+/***********************************************************************************************************************
+ * DEFINITIONS
+ */
+#define APP_VERSION         "1.0"
+
+#define BT_COMID_A          7200u
+#define BT_COMID_B          7201u
+#define BT_DATA_SIZE        64u
+#define BT_DEFAULT_ROUNDS   100u
+
+/***********************************************************************************************************************
+ * GLOBALS
+ */
+static UINT32   gRound      = 0u;
+static UINT32   gEntries    = 0u;
+static UINT32   gErrors     = 0u;
+static BOOL8    gVerbose    = FALSE;
+
+/***********************************************************************************************************************
+ * PROTOTYPES
+ */
+static void dbgOut (void *, TRDP_LOG_T, const CHAR8 *, const CHAR8 *, UINT16, const CHAR8 *);
+static void usage (const char *);
+static void batchCallback (void *, TRDP_APP_SESSION_T, const TRDP_PD_BATCH_ENTRY_T *, UINT32);
+
+/**********************************************************************************************************************/
+/** callback routine for TRDP logging/error output
+ *
+ *  @param[in]      pRefCon          user supplied context pointer
+ *  @param[in]      category         Log category (Error, Warning, Info etc.)
+ *  @param[in]      pTime            pointer to NULL-terminated string of time stamp
+ *  @param[in]      pFile            pointer to NULL-terminated string of source module
+ *  @param[in]      lineNumber       line
+ *  @param[in]      pMsgStr          pointer to NULL-terminated string
+ *  @retval         none
+ */
+static void dbgOut (
+    void        *pRefCon,
+    TRDP_LOG_T  category,
+    const CHAR8 *pTime,
+    const CHAR8 *pFile,
+    UINT16      lineNumber,
+    const CHAR8 *pMsgStr)
+{
+    const char *catStr[] = {"**Error:", "Warning:", "   Info:", "  Debug:", "   User:"};
+
+    if (((category != VOS_LOG_DBG) && (category != VOS_LOG_INFO)) || (gVerbose == TRUE))
+    {
+        printf("%s %s %s:%d %s",
+               strrchr(pTime, '-') + 1,
+               catStr[category],
+               strrchr(pFile, VOS_DIR_SEP) + 1,
+               lineNumber,
+               pMsgStr);
+    }
+}
+
+/**********************************************************************************************************************/
+/* Print a sensible usage message */
+static void usage (const char *appName)
+{
+    printf("Usage of %s\n", appName);
+    printf("This tool sends two telegrams to the local host, the first one twice per receive pass, and checks\n"
+           "the data reported by the batch callback.\n"
+           "Arguments are:\n"
+           "-r <number of rounds> (default %u)\n"
+           "-d verbose output\n"
+           "-h print usage\n",
+           BT_DEFAULT_ROUNDS);
+}
+
+/**********************************************************************************************************************/
+/** Batch callback: the data of every entry must be the pattern of its telegram in the current round
+ *
+ *  @param[in]      pRefCon         user supplied context pointer
+ *  @param[in]      appHandle       session
+ *  @param[in]      pEntries        updated telegrams
+ *  @param[in]      noOfEntries     number of entries
+ */
+static void batchCallback (
+    void                        *pRefCon,
+    TRDP_APP_SESSION_T          appHandle,
+    const TRDP_PD_BATCH_ENTRY_T *pEntries,
+    UINT32                      noOfEntries)
+{
+    UINT32 i, j;
+
+    for (i = 0u; i < noOfEntries; i++)
+    {
+        UINT8 expected = (UINT8) (pEntries[i].info.comId + gRound);
+
+        if ((pEntries[i].subHandle == NULL) || (pEntries[i].info.resultCode != TRDP_NO_ERR))
+        {
+            continue;
+        }
+        gEntries++;
+        if ((pEntries[i].pData == NULL) || (pEntries[i].dataSize != BT_DATA_SIZE))
+        {
+            gErrors++;
+            continue;
+        }
+        for (j = 0u; j < BT_DATA_SIZE; j++)
+        {
+            if (pEntries[i].pData[j] != expected)
+            {
+                vos_printLog(VOS_LOG_USR, "round %u: comId %u carries 0x%02x instead of 0x%02x\n",
+                             gRound, pEntries[i].info.comId, pEntries[i].pData[j], expected);
+                gErrors++;
+                break;
+            }
+        }
+    }
+}
+
+/**********************************************************************************************************************/
+/** main entry
+ *
+ *  @retval         0        no error
+ *  @retval         1        some error
+ */
+int main (int argc, char *argv[])
+{
+    TRDP_APP_SESSION_T      appHandle;
+    TRDP_PROCESS_CONFIG_T   processConfig   = {"BatchTest", "", 0u, 0u, TRDP_OPTION_NO_PD_STATS};
+    TRDP_IP_ADDR_T          destIP          = vos_dottedIP("127.0.0.1");
+    TRDP_PUB_T              pubA, pubB;
+    TRDP_SUB_T              subA, subB;
+    UINT32                  noOfRounds      = BT_DEFAULT_ROUNDS;
+    UINT8                   data[BT_DATA_SIZE];
+    int                     ch;
+    TRDP_ERR_T              err;
+
+    while ((ch = getopt(argc, argv, "r:dh?")) != -1)
+    {
+        switch (ch)
+        {
+           case 'r':
+               if ((sscanf(optarg, "%u", &noOfRounds) < 1) || (noOfRounds < 1u))
+               {
+                   usage(argv[0]);
+                   exit(1);
+               }
+               break;
+           case 'd':
+               gVerbose = TRUE;
+               break;
+           case 'h':
+           case '?':
+           default:
+               printf("%s: Version %s\t(%s - %s)\n", argv[0], APP_VERSION, __DATE__, __TIME__);
+               usage(argv[0]);
+               return 1;
+        }
+    }
+
+    if (tlc_init(&dbgOut, NULL, NULL) != TRDP_NO_ERR)
+    {
+        fprintf(stderr, "Initialization error\n");
+        return 1;
+    }
+
+    if (tlc_openSession(&appHandle, 0u, 0u, NULL, NULL, NULL, &processConfig) != TRDP_NO_ERR)
+    {
+        vos_printLogStr(VOS_LOG_USR, "Initialization error\n");
+        tlc_terminate();
+        return 1;
+    }
+
+    err = tlp_subscribe(appHandle, &subA, NULL, NULL, 0u, BT_COMID_A, 0u, 0u, 0u, 0u, 0u,
+                        TRDP_FLAGS_CALLBACK, NULL, 10000000u, TRDP_TO_KEEP_LAST_VALUE);
+    if (err == TRDP_NO_ERR)
+    {
+        err = tlp_subscribe(appHandle, &subB, NULL, NULL, 0u, BT_COMID_B, 0u, 0u, 0u, 0u, 0u,
+                            TRDP_FLAGS_CALLBACK, NULL, 10000000u, TRDP_TO_KEEP_LAST_VALUE);
+    }
+    if (err == TRDP_NO_ERR)
+    {
+        err = tlp_publish(appHandle, &pubA, NULL, NULL, 0u, BT_COMID_A, 0u, 0u, 0u, destIP, 0u, 0u,
+                          TRDP_FLAGS_NONE, NULL, NULL, BT_DATA_SIZE);
+    }
+    if (err == TRDP_NO_ERR)
+    {
+        err = tlp_publish(appHandle, &pubB, NULL, NULL, 0u, BT_COMID_B, 0u, 0u, 0u, destIP, 0u, 0u,
+                          TRDP_FLAGS_NONE, NULL, NULL, BT_DATA_SIZE);
+    }
+    if (err == TRDP_NO_ERR)
+    {
+        err = tlc_updateSession(appHandle);
+    }
+    if (err == TRDP_NO_ERR)
+    {
+        err = tlp_setBatchCallback(appHandle, batchCallback, NULL);
+    }
+    if (err != TRDP_NO_ERR)
+    {
+        vos_printLog(VOS_LOG_USR, "subscribe/publish failed (%s)\n", vos_getErrorString((VOS_ERR_T)err));
+        tlc_terminate();
+        return 1;
+    }
+
+    for (gRound = 1u; gRound <= noOfRounds; gRound++)
+    {
+        TRDP_FDS_T  rfds;
+        INT32       noDesc;
+        TRDP_TIME_T tv;
+        INT32       rv;
+
+        /*  The first telegram twice, the repetition is unchanged and not reported on its own   */
+        memset(data, (int) (UINT8) (BT_COMID_A + gRound), BT_DATA_SIZE);
+        err = tlp_putImmediate(appHandle, pubA, data, BT_DATA_SIZE, NULL);
+        if (err == TRDP_NO_ERR)
+        {
+            err = tlp_putImmediate(appHandle, pubA, data, BT_DATA_SIZE, NULL);
+        }
+        memset(data, (int) (UINT8) (BT_COMID_B + gRound), BT_DATA_SIZE);
+        if (err == TRDP_NO_ERR)
+        {
+            err = tlp_putImmediate(appHandle, pubB, data, BT_DATA_SIZE, NULL);
+        }
+        if (err != TRDP_NO_ERR)
+        {
+            vos_printLog(VOS_LOG_USR, "tlp_putImmediate() failed (%s)\n", vos_getErrorString((VOS_ERR_T)err));
+            gErrors++;
+            break;
+        }
+        (void) vos_threadDelay(2000u);
+
+        /*  One receive pass for all three packets  */
+        FD_ZERO(&rfds);
+        (void) tlp_getInterval(appHandle, &tv, &rfds, &noDesc);
+        vos_clearTime(&tv);
+        tv.tv_usec = 100000;
+        rv = vos_select(noDesc + 1, &rfds, NULL, NULL, &tv);
+        (void) tlp_processReceive(appHandle, &rfds, &rv);
+    }
+
+    vos_printLogStr(VOS_LOG_USR, "-----------------------------------------------\n");
+    vos_printLog(VOS_LOG_USR, "Rounds                    :   %u\n", noOfRounds);
+    vos_printLog(VOS_LOG_USR, "Batch entries             :   %u\n", gEntries);
+    vos_printLog(VOS_LOG_USR, "Errors                    :   %u\n", gErrors);
+    vos_printLogStr(VOS_LOG_USR, "-----------------------------------------------\n");
+
+    (void) tlp_setBatchCallback(appHandle, NULL, NULL);
+    (void) tlc_closeSession(appHandle);
+    (void) tlc_terminate();
+
+    return ((gErrors == 0u) && (gEntries == 2u * noOfRounds)) ? 0 : 1;
+}
@@ -0,0 +1,643 @@
+/**********************************************************************************************************************/
+/**
+ * @file            trdp-pd-busypoll-test.c
+ *
+ * @brief           PD receive latency with blocking wait and with busy polling
+ *
+ * @details         Publishes one cyclic telegram to a local address and subscribes to it again. The pre-send callback
+ *                  writes the send time into the telegram, the subscriber callback records the time from sending
+ *                  to delivery. The same traffic is received one after the other
+ *                  - blocking: select() and tlp_processReceive(), the wakeup path
+ *                  - spin:     tlp_processReceive() spins up to the budget (tlp_setBusyPoll), then select()
+ *                  - cyclic:   a cyclic thread (vos_threadCreateSync) wakes up shortly before the sender and spins
+ *                  and the latency distributions are reported side by side.
+ *                  The sender is a cyclic thread, too. For meaningful figures, pin the receiver (-a) to an isolated
+ *                  CPU (isolcpus/nohz_full) and use real-time scheduling (-r). Device busy polling (-p) has no effect
+ *                  on loopback, use a local address on a NAPI capable interface for it.
+ *
+ * @note            Project: TCNOpen TRDP prototype stack
+ *
+ * @author          agent
+ *
+ * @remarks This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0.
+ *          If a copy of the MPL was not distributed with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ *          Copyright agent, 2026. All rights reserved.
+ *
+ * $Id$
+ *
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#if defined (POSIX)
+#include <unistd.h>
+#endif
+
+#include "trdp_if_light.h"
+#include "vos_thread.h"
+#include "vos_utils.h"
+
+/***********************************************************************************************************************
+ * DEFINITIONS
+ */
+#define APP_VERSION         "1.0"
+
+#define BP_COMID            8000u
+#define BP_DATA_SIZE        64u
+#define BP_DEFAULT_CYCLE    5000u           /* send cycle in us                 */
+#define BP_DEFAULT_BUDGET   500u            /* spin budget in us                */
+#define BP_DEFAULT_LEAD     100u            /* wakeup of the cyclic receiver before the sender in us */
+#define BP_DEFAULT_TIME     5u              /* run time per mode in seconds     */
+#define BP_MAX_SAMPLES      200000u
+
+typedef enum
+{
+    BP_MODE_BLOCK   = 0,
+    BP_MODE_SPIN    = 1,
+    BP_MODE_CYCLIC  = 2,
+    BP_NO_OF_MODES  = 3
+} BP_MODE_T;
+
+typedef struct
+{
+    const char  *pName;
+    UINT32      count;              /* samples taken                */
+    UINT32      lost;               /* sequence counter gaps        */
+    UINT32      misses;             /* spins without reception      */
+    UINT32      lastSeqCnt;
+    UINT32      samples[BP_MAX_SAMPLES];    /* latency in ns        */
+} BP_RESULT_T;
+
+/***********************************************************************************************************************
+ * GLOBALS
+ */
+static BP_RESULT_T          gResult[BP_NO_OF_MODES] =
+{
+    {"blocking", 0u, 0u, 0u, 0u, {0u}},
+    {"spin",     0u, 0u, 0u, 0u, {0u}},
+    {"cyclic",   0u, 0u, 0u, 0u, {0u}}
+};
+static TRDP_APP_SESSION_T   gAppHandle;
+static BP_MODE_T            gMode       = BP_MODE_BLOCK;
+static volatile BOOL8       gMeasure    = FALSE;
+static volatile BOOL8       gRun        = FALSE;
+static volatile BOOL8       gDone       = FALSE;
+static volatile BOOL8       gSending    = TRUE;
+static INT32                gCpu        = -1;
+static BOOL8                gVerbose    = FALSE;
+
+/***********************************************************************************************************************
+ * PROTOTYPES
+ */
+static void dbgOut (void *, TRDP_LOG_T, const CHAR8 *, const CHAR8 *, UINT16, const CHAR8 *);
+static void usage (const char *);
+static void sendCallback (void *, TRDP_APP_SESSION_T, const TRDP_PD_INFO_T *, UINT8 *, UINT32);
+static void rcvCallback (void *, TRDP_APP_SESSION_T, const TRDP_PD_INFO_T *, UINT8 *, UINT32);
+static void pinThread (void);
+static void senderThread (void *);
+static void receiverLoop (void *);
+static void cyclicReceiver (void *);
+static int  compareSamples (const void *, const void *);
+static void printResults (void);
+
+/**********************************************************************************************************************/
+/** callback routine for TRDP logging/error output
+ *
+ *  @param[in]      pRefCon          user supplied context pointer
+ *  @param[in]      category         Log category (Error, Warning, Info etc.)
+ *  @param[in]      pTime            pointer to NULL-terminated string of time stamp
+ *  @param[in]      pFile            pointer to NULL-terminated string of source module
+ *  @param[in]      lineNumber       line
+ *  @param[in]      pMsgStr          pointer to NULL-terminated string
+ *  @retval         none
+ */
+static void dbgOut (
+    void        *pRefCon,
+    TRDP_LOG_T  category,
+    const CHAR8 *pTime,
+    const CHAR8 *pFile,
+    UINT16      lineNumber,
+    const CHAR8 *pMsgStr)
+{
+    const char *catStr[] = {"**Error:", "Warning:", "   Info:", "  Debug:", "   User:"};
+
+    if (((category != VOS_LOG_DBG) && (category != VOS_LOG_INFO)) || (gVerbose == TRUE))
+    {
+        printf("%s %s %s:%d %s",
+               strrchr(pTime, '-') + 1,
+               catStr[category],
+               strrchr(pFile, VOS_DIR_SEP) + 1,
+               lineNumber,
+               pMsgStr);
+    }
+}
+
+/**********************************************************************************************************************/
+/* Print a sensible usage message */
+static void usage (const char *appName)
+{
+    printf("Usage of %s\n", appName);
+    printf("This tool sends a cyclic telegram to a local address, receives it with blocking wait, with busy polling\n"
+           "and with a cyclic busy polling thread, and reports the send to delivery latencies. Arguments are:\n"
+           "-o <own IP address> (default INADDR_ANY)\n"
+           "-t <target IP address, must be local> (default 127.0.0.1)\n"
+           "-c <send cycle in us> (default %u, below 5000 only with HIGH_PERF_INDEXED)\n"
+           "-b <spin budget in us> (default %u)\n"
+           "-l <wakeup of the cyclic receiver before the sender in us> (default %u)\n"
+           "-p <device busy poll time of the sockets in us> (default 0)\n"
+           "-a <CPU to pin the receiver to> (default none)\n"
+           "-s <run time per mode in s> (default %u)\n"
+           "-r use real-time (FIFO) scheduling for sender and receiver\n"
+           "-d verbose output\n"
+           "-h print usage\n",
+           BP_DEFAULT_CYCLE, BP_DEFAULT_BUDGET, BP_DEFAULT_LEAD, BP_DEFAULT_TIME);
+}
+
+/**********************************************************************************************************************/
+/** Pre-send callback: stamp the telegram with the send time
+ *
+ *  @param[in]      pRefCon         user supplied context pointer
+ *  @param[in]      appHandle       application handle
+ *  @param[in]      pMsg            pointer to header/packet infos
+ *  @param[in]      pData           pointer to data block
+ *  @param[in]      dataSize        pointer to data size
+ *  @retval         none
+ */
+static void sendCallback (
+    void                    *pRefCon,
+    TRDP_APP_SESSION_T      appHandle,
+    const TRDP_PD_INFO_T    *pMsg,
+    UINT8                   *pData,
+    UINT32                  dataSize)
+{
+    UINT64 now;
+
+    if ((pData != NULL) && (dataSize >= sizeof(now)))
+    {
+        vos_getNanoTime(&now);
+        memcpy(pData, &now, sizeof(now));
+    }
+}
+
+/**********************************************************************************************************************/
+/** Subscriber callback: record the latency in the results of the current mode
+ *
+ *  @param[in]      pRefCon         user supplied context pointer
+ *  @param[in]      appHandle       application handle
+ *  @param[in]      pMsg            pointer to header/packet infos
+ *  @param[in]      pData           pointer to data block
+ *  @param[in]      dataSize        pointer to data size
+ *  @retval         none
+ */
+static void rcvCallback (
+    void                    *pRefCon,
+    TRDP_APP_SESSION_T      appHandle,
+    const TRDP_PD_INFO_T    *pMsg,
+    UINT8                   *pData,
+    UINT32                  dataSize)
+{
+    BP_RESULT_T *pResult = &gResult[gMode];
+    UINT64      now;
+    UINT64      sent;
+
+    vos_getNanoTime(&now);
+
+    if ((gMeasure == FALSE) || (pMsg->resultCode != TRDP_NO_ERR) || (pData == NULL) || (dataSize < sizeof(sent)))
+    {
+        return;
+    }
+    memcpy(&sent, pData, sizeof(sent));
+
+    if ((pResult->lastSeqCnt != 0u) && (pMsg->seqCount > pResult->lastSeqCnt + 1u))
+    {
+        pResult->lost += pMsg->seqCount - pResult->lastSeqCnt - 1u;
+    }
+    pResult->lastSeqCnt = pMsg->seqCount;
+
+    if ((pResult->count < BP_MAX_SAMPLES) && (now >= sent))
+    {
+        pResult->samples[pResult->count++] = (UINT32) (now - sent);
+    }
+}
+
+/**********************************************************************************************************************/
+/** Pin the calling thread to the CPU given by -a
+ */
+static void pinThread (void)
+{
+    if ((gCpu < 0) || (gCpu > 63))
+    {
+        return;
+    }
+    if (vos_threadSetAffinity(NULL, (VOS_CPU_SET_T)1u << gCpu) != VOS_NO_ERR)
+    {
+        vos_printLog(VOS_LOG_USR, "Receiver could not be pinned to CPU %d\n", gCpu);
+    }
+}
+
+/**********************************************************************************************************************/
+/** Cyclic send thread: just call tlp_processSend
+ *
+ *  @param[in]      pArg        application handle
+ *  @retval         none
+ */
+static void senderThread (
+    void *pArg)
+{
+    TRDP_ERR_T err;
+
+    if (gSending == FALSE)
+    {
+        return;
+    }
+    err = tlp_processSend((TRDP_APP_SESSION_T) pArg);
+    if ((err != TRDP_NO_ERR) && (err != TRDP_BLOCK_ERR))
+    {
+        vos_printLog(VOS_LOG_USR, "tlp_processSend failed (%s)\n", vos_getErrorString((VOS_ERR_T)err));
+    }
+}
+
+/**********************************************************************************************************************/
+/** Receive loop for the blocking and the spin mode, runs until gRun is cleared
+ *
+ *  @param[in]      pArg        application handle
+ *  @retval         none
+ */
+static void receiverLoop (
+    void *pArg)
+{
+    TRDP_APP_SESSION_T appHandle = (TRDP_APP_SESSION_T) pArg;
+
+    pinThread();
+
+    while (gRun == TRUE)
+    {
+        TRDP_FDS_T  rfds;
+        INT32       noDesc;
+        TRDP_TIME_T tv;
+        TRDP_TIME_T max_tv = {0, 100000};
+        INT32       rv = 0;
+
+        FD_ZERO(&rfds);
+        tlp_getInterval(appHandle, &tv, &rfds, &noDesc);
+        if (vos_cmpTime(&tv, &max_tv) > 0)
+        {
+            tv = max_tv;
+        }
+
+        /*  Spin first, block only if nothing arrived within the budget    */
+        if ((gMode == BP_MODE_BLOCK) ||
+            (tlp_processReceive(appHandle, &rfds, &rv) == TRDP_NODATA_ERR))
+        {
+            if (gMode != BP_MODE_BLOCK)
+            {
+                gResult[gMode].misses++;
+            }
+            rv = vos_select(noDesc + 1, &rfds, NULL, NULL, &tv);
+            (void) tlp_processReceive(appHandle, &rfds, &rv);
+        }
+    }
+    gDone = TRUE;
+}
+
+/**********************************************************************************************************************/
+/** Cyclic receiver: woken up shortly before the sender, spins until the telegram is there
+ *
+ *  @param[in]      pArg        application handle
+ *  @retval         none
+ */
+static void cyclicReceiver (
+    void *pArg)
+{
+    static BOOL8        pinned = FALSE;
+    TRDP_APP_SESSION_T  appHandle = (TRDP_APP_SESSION_T) pArg;
+    TRDP_FDS_T          rfds;
+    INT32               noDesc;
+    TRDP_TIME_T         tv;
+    INT32               rv = 0;
+
+    if (gRun == FALSE)
+    {
+        return;
+    }
+    if (pinned == FALSE)
+    {
+        pinThread();
+        pinned = TRUE;
+    }
+
+    FD_ZERO(&rfds);
+    tlp_getInterval(appHandle, &tv, &rfds, &noDesc);
+    if (tlp_processReceive(appHandle, &rfds, &rv) == TRDP_NODATA_ERR)
+    {
+        gResult[BP_MODE_CYCLIC].misses++;
+    }
+}
+
+/**********************************************************************************************************************/
+/** qsort helper
+ */
+static int compareSamples (
+    const void  *pA,
+    const void  *pB)
+{
+    UINT32  a   = *(const UINT32 *) pA;
+    UINT32  b   = *(const UINT32 *) pB;
+
+    return (a > b) - (a < b);
+}
+
+/**********************************************************************************************************************/
+/** Output the latency distributions of all modes
+ */
+static void printResults (void)
+{
+    static const UINT32 cPerMille[] = {0u, 500u, 900u, 990u, 999u, 1000u};
+    UINT32              i, j;
+
+    printf("\n%-9s %8s %6s %7s |", "mode", "count", "lost", "misses");
+    printf(" %8s %8s %8s %8s %8s %8s\n", "min", "p50", "p90", "p99", "p99.9", "max");
+
+    for (i = 0u; i < (UINT32) BP_NO_OF_MODES; i++)
+    {
+        BP_RESULT_T *pResult = &gResult[i];
+
+        printf("%-9s %8u %6u %7u |", pResult->pName, pResult->count, pResult->lost, pResult->misses);
+        if (pResult->count == 0u)
+        {
+            printf(" %8s\n", "-");
+            continue;
+        }
+        qsort(pResult->samples, pResult->count, sizeof(UINT32), compareSamples);
+        for (j = 0u; j < sizeof(cPerMille) / sizeof(cPerMille[0]); j++)
+        {
+            UINT32 idx = (UINT32) (((UINT64) (pResult->count - 1u) * cPerMille[j]) / 1000u);
+
+            printf(" %8.1f", (double) pResult->samples[idx] / 1000.0);
+        }
+        printf("\n");
+    }
+    printf("(send to delivery latency in us; misses: spin budgets used up without reception)\n");
+}
+
+/**********************************************************************************************************************/
+/** main entry
+ *
+ *  @retval         0        no error
+ *  @retval         1        some error
+ */
+int main (int argc, char *argv[])
+{
+    TRDP_PROCESS_CONFIG_T   processConfig   = {"BusyPollTest", "", 0u, 0u, TRDP_OPTION_NO_PD_STATS};
+    TRDP_PUB_T              pubHandle;
+    TRDP_SUB_T              subHandle;
+    TRDP_IP_ADDR_T          ownIP           = 0u;
+    TRDP_IP_ADDR_T          destIP          = vos_dottedIP("127.0.0.1");
+    VOS_THREAD_POLICY_T     policy          = VOS_THREAD_POLICY_OTHER;
+    VOS_THREAD_PRIORITY_T   prio            = VOS_THREAD_PRIORITY_DEFAULT;
+    VOS_THREAD_T            sendThread      = NULL;
+    VOS_THREAD_T            rcvThread       = NULL;
+    VOS_TIMEVAL_T           startTime;
+    VOS_TIMEVAL_T           rcvStartTime;
+    VOS_TIMEVAL_T           lead;
+    UINT32                  cycle           = BP_DEFAULT_CYCLE;
+    UINT32                  budget          = BP_DEFAULT_BUDGET;
+    UINT32                  leadTime        = BP_DEFAULT_LEAD;
+    UINT32                  busyPollTime    = 0u;
+    UINT32                  runTime         = BP_DEFAULT_TIME;
+    UINT8                   data[BP_DATA_SIZE];
+    UINT32                  i;
+    int                     ch;
+    TRDP_ERR_T              err;
+
+    while ((ch = getopt(argc, argv, "o:t:c:b:l:p:a:s:rdh?")) != -1)
+    {
+        switch (ch)
+        {
+           case 'o':
+               ownIP = vos_dottedIP(optarg);
+               break;
+           case 't':
+               destIP = vos_dottedIP(optarg);
+               break;
+           case 'c':
+               if ((sscanf(optarg, "%u", &cycle) < 1) || (cycle < 100u))
+               {
+                   usage(argv[0]);
+                   exit(1);
+               }
+               break;
+           case 'b':
+               if ((sscanf(optarg, "%u", &budget) < 1) || (budget == 0u))
+               {
+                   usage(argv[0]);
+                   exit(1);
+               }
+               break;
+           case 'l':
+               if (sscanf(optarg, "%u", &leadTime) < 1)
+               {
+                   usage(argv[0]);
+                   exit(1);
+               }
+               break;
+           case 'p':
+               if (sscanf(optarg, "%u", &busyPollTime) < 1)
+               {
+                   usage(argv[0]);
+                   exit(1);
+               }
+               break;
+           case 'a':
+               if (sscanf(optarg, "%d", &gCpu) < 1)
+               {
+                   usage(argv[0]);
+                   exit(1);
+               }
+               break;
+           case 's':
+               if (sscanf(optarg, "%u", &runTime) < 1)
+               {
+                   usage(argv[0]);
+                   exit(1);
+               }
+               break;
+           case 'r':
+               policy   = VOS_THREAD_POLICY_FIFO;
+               prio     = VOS_THREAD_PRIORITY_HIGHEST;
+               break;
+           case 'd':
+               gVerbose = TRUE;
+               break;
+           case 'h':
+           case '?':
+           default:
+               printf("%s: Version %s\t(%s - %s)\n", argv[0], APP_VERSION, __DATE__, __TIME__);
+               usage(argv[0]);
+               return 1;
+        }
+    }
+
+    if ((destIP == 0u) || (leadTime >= cycle))
+    {
+        usage(argv[0]);
+        return 1;
+    }
+
+    /* The sender runs once per send cycle */
+    processConfig.cycleTime = cycle;
+
+    if (tlc_init(&dbgOut, NULL, NULL) != TRDP_NO_ERR)
+    {
+        fprintf(stderr, "Initialization error\n");
+        return 1;
+    }
+
+    if (tlc_openSession(&gAppHandle, ownIP, 0u, NULL, NULL, NULL, &processConfig) != TRDP_NO_ERR)
+    {
+        vos_printLogStr(VOS_LOG_USR, "Initialization error\n");
+        tlc_terminate();
+        return 1;
+    }
+
+    memset(data, 0, sizeof(data));
+    err = tlp_subscribe(gAppHandle, &subHandle, NULL, rcvCallback,
+                        0u, BP_COMID,
+                        0u, 0u,
+                        0u, 0u,
+                        0u,
+                        TRDP_FLAGS_CALLBACK | TRDP_FLAGS_FORCE_CB,
+                        NULL,
+                        1000000u, TRDP_TO_SET_TO_ZERO);
+    if (err == TRDP_NO_ERR)
+    {
+        err = tlp_publish(gAppHandle, &pubHandle,
+                          NULL, sendCallback,
+                          0u, BP_COMID,
+                          0u, 0u,
+                          0u, destIP,
+                          cycle,
+                          0u,
+                          TRDP_FLAGS_CALLBACK,
+                          NULL,
+                          data, BP_DATA_SIZE);
+    }
+    if (err == TRDP_NO_ERR)
+    {
+        /*  Build the index tables (HIGH_PERF_INDEXED) */
+        err = tlc_updateSession(gAppHandle);
+    }
+    if (err != TRDP_NO_ERR)
+    {
+        vos_printLog(VOS_LOG_USR, "subscribe/publish failed (%s)\n", vos_getErrorString((VOS_ERR_T)err));
+        tlc_terminate();
+        return 1;
+    }
+
+    vos_printLogStr(VOS_LOG_USR, "-----------------------------------------------\n");
+    vos_printLog(VOS_LOG_USR, "Send cycle                :   %uus to %s\n", cycle, vos_ipDotted(destIP));
+    vos_printLog(VOS_LOG_USR, "Spin budget               :   %uus\n", budget);
+    vos_printLog(VOS_LOG_USR, "Cyclic receiver lead      :   %uus\n", leadTime);
+    vos_printLog(VOS_LOG_USR, "Device busy poll          :   %uus\n", busyPollTime);
+    vos_printLog(VOS_LOG_USR, "Receiver CPU              :   %d\n", gCpu);
+    vos_printLog(VOS_LOG_USR, "Run time per mode         :   %us\n", runTime);
+    vos_printLogStr(VOS_LOG_USR, "-----------------------------------------------\n");
+
+    /*  Start the sender on the next full second, the cyclic receiver a little earlier  */
+    vos_getTime(&startTime);
+    startTime.tv_sec++;
+    startTime.tv_usec = 0;
+
+    err = (TRDP_ERR_T) vos_threadCreateSync(&sendThread, "Sender Task",
+                                            policy,
+                                            prio,
+                                            cycle,          /*  interval for cyclic thread      */
+                                            &startTime,     /*  start time for cyclic threads   */
+                                            0u,             /*  stack size (default 4 x PTHREAD_STACK_MIN)   */
+                                            (VOS_THREAD_FUNC_T) senderThread, gAppHandle);
+    if (err != TRDP_NO_ERR)
+    {
+        vos_printLog(VOS_LOG_USR, "Sender thread could not be created (%s)\n", vos_getErrorString((VOS_ERR_T)err));
+        tlc_terminate();
+        return 1;
+    }
+
+    for (i = 0u; i < (UINT32) BP_NO_OF_MODES; i++)
+    {
+        gMode   = (BP_MODE_T) i;
+        gRun    = TRUE;
+        gDone   = FALSE;
+
+        err = tlp_setBusyPoll(gAppHandle, (gMode == BP_MODE_BLOCK) ? 0u : budget, busyPollTime);
+        if ((err != TRDP_NO_ERR) && (err != TRDP_UNKNOWN_ERR) && (err != TRDP_SOCK_ERR))
+        {
+            vos_printLog(VOS_LOG_USR, "tlp_setBusyPoll failed (%s)\n", vos_getErrorString((VOS_ERR_T)err));
+            break;
+        }
+
+        if (gMode == BP_MODE_CYCLIC)
+        {
+            rcvStartTime    = startTime;
+            lead.tv_sec     = 0;
+            lead.tv_usec    = (suseconds_t) leadTime;
+            vos_subTime(&rcvStartTime, &lead);
+            err = (TRDP_ERR_T) vos_threadCreateSync(&rcvThread, "Receiver Task",
+                                                    policy, prio,
+                                                    cycle, &rcvStartTime, 0u,
+                                                    (VOS_THREAD_FUNC_T) cyclicReceiver, gAppHandle);
+        }
+        else
+        {
+            err = (TRDP_ERR_T) vos_threadCreate(&rcvThread, "Receiver Task",
+                                                policy, prio,
+                                                0u, 0u,
+                                                (VOS_THREAD_FUNC_T) receiverLoop, gAppHandle);
+        }
+        if (err != TRDP_NO_ERR)
+        {
+            vos_printLog(VOS_LOG_USR, "Receiver thread could not be created (%s)\n",
+                         vos_getErrorString((VOS_ERR_T)err));
+            break;
+        }
+
+        /*  Skip the settling phase, then measure  */
+        (void) vos_threadDelay(1000000u);
+        gMeasure = TRUE;
+        (void) vos_threadDelay(runTime * 1000000u);
+        gMeasure = FALSE;
+
+        /*  Let the receiver leave the stack before it is stopped   */
+        gRun = FALSE;
+        if (gMode == BP_MODE_CYCLIC)
+        {
+            (void) vos_threadDelay(4u * cycle);
+            (void) vos_threadTerminate(rcvThread);
+        }
+        else
+        {
+            while (gDone == FALSE)
+            {
+                (void) vos_threadDelay(10000u);
+            }
+        }
+        vos_printLog(VOS_LOG_USR, "%s: %u samples\n", gResult[i].pName, gResult[i].count);
+    }
+
+    gSending = FALSE;
+    (void) vos_threadDelay(4u * cycle);
+    (void) vos_threadTerminate(sendThread);
+
+    printResults();
+
+    /*
+     *    We always clean up behind us!
+     */
+    (void) tlp_unpublish(gAppHandle, pubHandle);
+    (void) tlp_unsubscribe(gAppHandle, subHandle);
+    (void) tlc_closeSession(gAppHandle);
+    (void) tlc_terminate();
+
+    return 0;
+}
@@ -0,0 +1,421 @@
+/**********************************************************************************************************************/
+/**
+ * @file            trdp-pd-cb-latency.c
+ *
+ * @brief           Receive loop latency with a slow subscriber callback
+ *
+ * @details         Publishes a number of cyclic telegrams to the local host and subscribes to them again. The callback
+ *                  of the first subscription deliberately sleeps, the others just record the time from reception to
+ *                  callback. Reported are the execution times of tlc_process() (the receive loop) and the callback
+ *                  latencies, either with callbacks executed by the receiving thread (-p 0) or by a pool of
+ *                  callback threads (tlp_enableCallbackPool).
+ *
+ * @note            Project: TCNOpen TRDP prototype stack
+ *
+ * @author          agent
+ *
+ * @remarks This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0.
+ *          If a copy of the MPL was not distributed with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ *          Copyright agent, 2026. All rights reserved.
+ *
+ * $Id$
+ *
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#if defined (POSIX)
+#include <unistd.h>
+#endif
+
+#include "trdp_if_light.h"
+#include "vos_thread.h"
+#include "vos_utils.h"
+
+/***********************************************************************************************************************
+ * DEFINITIONS
+ */
+#define APP_VERSION         "1.0"
+
+#define CL_COMID_BASE       7000u
+#define CL_DATA_SIZE        64u
+#define CL_CYCLE_TIME       10000u          /* 10ms                     */
+#define CL_DEFAULT_TIME     5u              /* run time in seconds      */
+#define CL_DEFAULT_TELEGRAMS 8u
+#define CL_DEFAULT_THREADS  2u
+#define CL_DEFAULT_SLOW     50u             /* slow callback in ms      */
+#define CL_MAX_TELEGRAMS    64u
+
+typedef struct
+{
+    TRDP_PUB_T  pubHandle;
+    TRDP_SUB_T  subHandle;
+    BOOL8       slow;
+    UINT32      callbacks;
+    UINT32      timeouts;
+    UINT32      lastSeqCnt;
+    UINT32      skipped;
+    UINT64      sumLatency;                 /* us */
+    UINT32      maxLatency;                 /* us */
+} CL_TELEGRAM_T;
+
+/***********************************************************************************************************************
+ * GLOBALS
+ */
+static CL_TELEGRAM_T    gTelegram[CL_MAX_TELEGRAMS];
+static UINT32           gSlowTime   = CL_DEFAULT_SLOW;
+static BOOL8            gVerbose    = FALSE;
+
+/***********************************************************************************************************************
+ * PROTOTYPES
+ */
+static void dbgOut (void *, TRDP_LOG_T, const CHAR8 *, const CHAR8 *, UINT16, const CHAR8 *);
+static void usage (const char *);
+static void pdCallback (void *, TRDP_APP_SESSION_T, const TRDP_PD_INFO_T *, UINT8 *, UINT32);
+static UINT32 elapsedUs (const TRDP_TIME_T *, const TRDP_TIME_T *);
+
+/**********************************************************************************************************************/
+/** callback routine for TRDP logging/error output
+ *
+ *  @param[in]      pRefCon          user supplied context pointer
+ *  @param[in]      category         Log category (Error, Warning, Info etc.)
+ *  @param[in]      pTime            pointer to NULL-terminated string of time stamp
+ *  @param[in]      pFile            pointer to NULL-terminated string of source module
+ *  @param[in]      lineNumber       line
+ *  @param[in]      pMsgStr          pointer to NULL-terminated string
+ *  @retval         none
+ */
+static void dbgOut (
+    void        *pRefCon,
+    TRDP_LOG_T  category,
+    const CHAR8 *pTime,
+    const CHAR8 *pFile,
+    UINT16      lineNumber,
+    const CHAR8 *pMsgStr)
+{
+    const char *catStr[] = {"**Error:", "Warning:", "   Info:", "  Debug:", "   User:"};
+
+    if (((category != VOS_LOG_DBG) && (category != VOS_LOG_INFO)) || (gVerbose == TRUE))
+    {
+        printf("%s %s %s:%d %s",
+               strrchr(pTime, '-') + 1,
+               catStr[category],
+               strrchr(pFile, VOS_DIR_SEP) + 1,
+               lineNumber,
+               pMsgStr);
+    }
+}
+
+/**********************************************************************************************************************/
+/* Print a sensible usage message */
+static void usage (const char *appName)
+{
+    printf("Usage of %s\n", appName);
+    printf("This tool publishes and subscribes cyclic telegrams on the local host. The callback of the first\n"
+           "subscription is slow. The execution time of the receive loop and the callback latencies are reported.\n"
+           "Arguments are:\n"
+           "-p <number of callback threads, 0: call back from the receive loop> (default %u)\n"
+           "-n <number of telegrams> (default %u, max. %u)\n"
+           "-w <duration of the slow callback in ms> (default %u)\n"
+           "-s <run time in s> (default %u)\n"
+           "-d verbose output\n"
+           "-h print usage\n",
+           CL_DEFAULT_THREADS, CL_DEFAULT_TELEGRAMS, CL_MAX_TELEGRAMS, CL_DEFAULT_SLOW, CL_DEFAULT_TIME);
+}
+
+/**********************************************************************************************************************/
+/** Time difference in us
+ *
+ *  @param[in]      pFrom           earlier time
+ *  @param[in]      pTo             later time
+ *  @retval         difference in us (0 if negative)
+ */
+static UINT32 elapsedUs (
+    const TRDP_TIME_T   *pFrom,
+    const TRDP_TIME_T   *pTo)
+{
+    TRDP_TIME_T diff = *pTo;
+
+    if (vos_cmpTime((TRDP_TIME_T *) pTo, (TRDP_TIME_T *) pFrom) < 0)
+    {
+        return 0u;
+    }
+    vos_subTime(&diff, pFrom);
+    return (UINT32) diff.tv_sec * 1000000u + (UINT32) diff.tv_usec;
+}
+
+/**********************************************************************************************************************/
+/** PD callback: sleep for the slow subscription, record the latency for the others
+ *
+ *  @param[in]      pRefCon         user supplied context pointer
+ *  @param[in]      appHandle       session
+ *  @param[in]      pMsg            message info
+ *  @param[in]      pData           received data
+ *  @param[in]      dataSize        size of the data
+ */
+static void pdCallback (
+    void                    *pRefCon,
+    TRDP_APP_SESSION_T      appHandle,
+    const TRDP_PD_INFO_T    *pMsg,
+    UINT8                   *pData,
+    UINT32                  dataSize)
+{
+    CL_TELEGRAM_T   *pTelegram = (CL_TELEGRAM_T *) pMsg->pUserRef;
+    TRDP_TIME_T     now;
+    UINT32          latency;
+
+    if (pTelegram == NULL)
+    {
+        return;
+    }
+    if (pMsg->resultCode != TRDP_NO_ERR)
+    {
+        pTelegram->timeouts++;
+        return;
+    }
+
+    vos_getTime(&now);
+    latency = elapsedUs(&pMsg->rxTime, &now);
+    if ((pTelegram->callbacks > 0u) && (pMsg->seqCount > pTelegram->lastSeqCnt + 1u))
+    {
+        pTelegram->skipped += pMsg->seqCount - pTelegram->lastSeqCnt - 1u;
+    }
+    pTelegram->lastSeqCnt = pMsg->seqCount;
+    pTelegram->callbacks++;
+    pTelegram->sumLatency += latency;
+    if (latency > pTelegram->maxLatency)
+    {
+        pTelegram->maxLatency = latency;
+    }
+
+    if (pTelegram->slow == TRUE)
+    {
+        (void) vos_threadDelay(gSlowTime * 1000u);
+    }
+}
+
+/**********************************************************************************************************************/
+/** main entry
+ *
+ *  @retval         0        no error
+ *  @retval         1        some error
+ */
+int main (int argc, char *argv[])
+{
+    TRDP_APP_SESSION_T      appHandle;
+    TRDP_PROCESS_CONFIG_T   processConfig   = {"CbLatency", "", 0u, 0u, TRDP_OPTION_NO_PD_STATS};
+    TRDP_PD_CONFIG_T        pdConfig        = {pdCallback, NULL, TRDP_PD_DEFAULT_SEND_PARAM, TRDP_FLAGS_CALLBACK,
+                                               1000000u, TRDP_TO_SET_TO_ZERO, TRDP_PD_UDP_PORT};
+    TRDP_IP_ADDR_T          destIP          = vos_dottedIP("127.0.0.1");
+    UINT32                  noOfThreads     = CL_DEFAULT_THREADS;
+    UINT32                  noOfTelegrams   = CL_DEFAULT_TELEGRAMS;
+    UINT32                  runTime         = CL_DEFAULT_TIME;
+    UINT8                   data[CL_DATA_SIZE];
+    UINT64                  sumLoop         = 0u;
+    UINT32                  maxLoop         = 0u;
+    UINT32                  noOfLoops       = 0u;
+    UINT64                  sumLatency      = 0u;
+    UINT32                  maxLatency      = 0u;
+    UINT32                  callbacks       = 0u;
+    UINT32                  skipped         = 0u;
+    TRDP_TIME_T             end;
+    TRDP_TIME_T             now;
+    UINT32                  i;
+    int                     ch;
+    TRDP_ERR_T              err;
+
+    while ((ch = getopt(argc, argv, "p:n:w:s:dh?")) != -1)
+    {
+        switch (ch)
+        {
+           case 'p':
+               if (sscanf(optarg, "%u", &noOfThreads) < 1)
+               {
+                   usage(argv[0]);
+                   exit(1);
+               }
+               break;
+           case 'n':
+               if ((sscanf(optarg, "%u", &noOfTelegrams) < 1) || (noOfTelegrams < 2u) ||
+                   (noOfTelegrams > CL_MAX_TELEGRAMS))
+               {
+                   usage(argv[0]);
+                   exit(1);
+               }
+               break;
+           case 'w':
+               if (sscanf(optarg, "%u", &gSlowTime) < 1)
+               {
+                   usage(argv[0]);
+                   exit(1);
+               }
+               break;
+           case 's':
+               if (sscanf(optarg, "%u", &runTime) < 1)
+               {
+                   usage(argv[0]);
+                   exit(1);
+               }
+               break;
+           case 'd':
+               gVerbose = TRUE;
+               break;
+           case 'h':
+           case '?':
+           default:
+               printf("%s: Version %s\t(%s - %s)\n", argv[0], APP_VERSION, __DATE__, __TIME__);
+               usage(argv[0]);
+               return 1;
+        }
+    }
+
+    if (tlc_init(&dbgOut, NULL, NULL) != TRDP_NO_ERR)
+    {
+        fprintf(stderr, "Initialization error\n");
+        return 1;
+    }
+
+    if (tlc_openSession(&appHandle, 0u, 0u, NULL, &pdConfig, NULL, &processConfig) != TRDP_NO_ERR)
+    {
+        vos_printLogStr(VOS_LOG_USR, "Initialization error\n");
+        tlc_terminate();
+        return 1;
+    }
+
+    if (noOfThreads > 0u)
+    {
+        err = tlp_enableCallbackPool(appHandle, noOfThreads, VOS_THREAD_POLICY_OTHER, VOS_THREAD_PRIORITY_DEFAULT);
+        if (err != TRDP_NO_ERR)
+        {
+            vos_printLog(VOS_LOG_USR, "tlp_enableCallbackPool failed (%s)\n", vos_getErrorString((VOS_ERR_T)err));
+            tlc_terminate();
+            return 1;
+        }
+    }
+
+    memset(data, 0, sizeof(data));
+    gTelegram[0].slow = TRUE;
+    for (i = 0u; i < noOfTelegrams; i++)
+    {
+        err = tlp_subscribe(appHandle, &gTelegram[i].subHandle, &gTelegram[i], NULL,
+                            0u, CL_COMID_BASE + i,
+                            0u, 0u,
+                            0u, 0u,
+                            0u,
+                            TRDP_FLAGS_CALLBACK | TRDP_FLAGS_FORCE_CB,
+                            NULL,
+                            1000000u, TRDP_TO_SET_TO_ZERO);
+        if (err == TRDP_NO_ERR)
+        {
+            err = tlp_publish(appHandle, &gTelegram[i].pubHandle,
+                              NULL, NULL,
+                              0u, CL_COMID_BASE + i,
+                              0u, 0u,
+                              0u, destIP,
+                              CL_CYCLE_TIME,
+                              0u,
+                              TRDP_FLAGS_NONE,
+                              NULL,
+                              data, CL_DATA_SIZE);
+        }
+        if (err != TRDP_NO_ERR)
+        {
+            vos_printLog(VOS_LOG_USR, "subscribe/publish failed (%s)\n", vos_getErrorString((VOS_ERR_T)err));
+            tlc_terminate();
+            return 1;
+        }
+    }
+
+    vos_printLogStr(VOS_LOG_USR, "-----------------------------------------------\n");
+    vos_printLog(VOS_LOG_USR, "Telegrams                 :   %u every %ums\n", noOfTelegrams, CL_CYCLE_TIME / 1000u);
+    vos_printLog(VOS_LOG_USR, "Slow callback             :   %ums\n", gSlowTime);
+    vos_printLog(VOS_LOG_USR, "Callback threads          :   %u\n", noOfThreads);
+    vos_printLog(VOS_LOG_USR, "Run time                  :   %us\n", runTime);
+    vos_printLogStr(VOS_LOG_USR, "-----------------------------------------------\n");
+
+    vos_getTime(&end);
+    now.tv_sec  = (long) runTime;
+    now.tv_usec = 0;
+    vos_addTime(&end, &now);
+
+    /*
+        Enter the main processing loop and measure the time tlc_process() needs
+     */
+    do
+    {
+        TRDP_FDS_T  rfds;
+        INT32       noDesc;
+        TRDP_TIME_T tv;
+        TRDP_TIME_T start;
+        TRDP_TIME_T max_tv = {0, 100000};
+        INT32       rv;
+        UINT32      loop;
+
+        FD_ZERO(&rfds);
+        tlc_getInterval(appHandle, &tv, &rfds, &noDesc);
+        if (vos_cmpTime(&tv, &max_tv) > 0)
+        {
+            tv = max_tv;
+        }
+        rv = vos_select(noDesc + 1, &rfds, NULL, NULL, &tv);
+
+        vos_getTime(&start);
+        (void) tlc_process(appHandle, &rfds, &rv);
+        vos_getTime(&now);
+
+        loop = elapsedUs(&start, &now);
+        sumLoop += loop;
+        noOfLoops++;
+        if (loop > maxLoop)
+        {
+            maxLoop = loop;
+        }
+    }
+    while (vos_cmpTime(&now, &end) < 0);
+
+    /*  Stop the callback threads before evaluating their results   */
+    (void) tlp_enableCallbackPool(appHandle, 0u, VOS_THREAD_POLICY_OTHER, VOS_THREAD_PRIORITY_DEFAULT);
+
+    printf("receive loop: %u calls, avg %llu us, max %u us\n",
+           noOfLoops, (unsigned long long) ((noOfLoops > 0u) ? sumLoop / noOfLoops : 0u), maxLoop);
+    for (i = 0u; i < noOfTelegrams; i++)
+    {
+        if (gVerbose == TRUE)
+        {
+            printf("comId %u%s: %u callbacks, %u skipped, %u timeouts, avg latency %llu us, max %u us\n",
+                   CL_COMID_BASE + i, (gTelegram[i].slow == TRUE) ? " (slow)" : "",
+                   gTelegram[i].callbacks, gTelegram[i].skipped, gTelegram[i].timeouts,
+                   (unsigned long long) ((gTelegram[i].callbacks > 0u) ?
+                                         gTelegram[i].sumLatency / gTelegram[i].callbacks : 0u),
+                   gTelegram[i].maxLatency);
+        }
+        if (gTelegram[i].slow == FALSE)
+        {
+            callbacks   += gTelegram[i].callbacks;
+            skipped     += gTelegram[i].skipped;
+            sumLatency  += gTelegram[i].sumLatency;
+            if (gTelegram[i].maxLatency > maxLatency)
+            {
+                maxLatency = gTelegram[i].maxLatency;
+            }
+        }
+    }
+    printf("fast callbacks: %u, %u skipped, avg latency %llu us, max %u us\n",
+           callbacks, skipped, (unsigned long long) ((callbacks > 0u) ? sumLatency / callbacks : 0u), maxLatency);
+    printf("slow callbacks: %u, %u skipped (conflated)\n", gTelegram[0].callbacks, gTelegram[0].skipped);
+
+    /*
+     *    We always clean up behind us!
+     */
+    for (i = 0u; i < noOfTelegrams; i++)
+    {
+        (void) tlp_unpublish(appHandle, gTelegram[i].pubHandle);
+        (void) tlp_unsubscribe(appHandle, gTelegram[i].subHandle);
+    }
+    (void) tlc_closeSession(appHandle);
+    (void) tlc_terminate();
+
+    return 0;
+}
@@ -0,0 +1,546 @@
+/**********************************************************************************************************************/
+/**
+ * @file            trdp-pd-jitter-test.c
+ *
+ * @brief           Timing accuracy benchmark for the indexed (HIGH_PERF_INDEXED) PD send scheduler
+ *
+ * @details         Publishes a set of telegrams with sub-millisecond and millisecond intervals, drives
+ *                  tlp_processSend() from a synchronized cyclic thread and records the point in time each
+ *                  telegram is handed to the socket (via the optional pre-send callback).
+ *                  At the end, the deviation of the actual send interval from the configured one is reported
+ *                  per comId as min/max/avg and as a histogram.
+ *                  Optionally (-g) the stack's own send interval histograms are printed for comparison.
+ *                  To get meaningful figures, run it on a PREEMPT_RT kernel with RT_THREADS enabled and
+ *                  sufficient privileges (e.g. 'chrt' capable user or root). Pinning the sender (-a) and locking
+ *                  and prefaulting memory (-m) removes migrations and page faults from the measurement.
+ *                  The timing of the send thread itself (wakeup latency, execution time, missed periods) is
+ *                  reported from the VOS cyclic thread statistics.
+ *
+ * @note            Project: TCNOpen TRDP prototype stack
+ *
+ * @author          agent
+ *
+ * @remarks This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0.
+ *          If a copy of the MPL was not distributed with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ *          Copyright agent, 2026. All rights reserved.
+ *
+ * $Id$
+ *
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#if defined (POSIX)
+#include <unistd.h>
+#endif
+
+#include "trdp_if_light.h"
+#include "vos_thread.h"
+#include "vos_utils.h"
+
+/***********************************************************************************************************************
+ * DEFINITIONS
+ */
+#define APP_VERSION         "1.0"
+
+#define JT_COMID_BASE       5000u
+#define JT_DATA_SIZE        64u
+#define JT_DEFAULT_TIME     10u             /* run time in seconds      */
+#define JT_DEFAULT_BASE     250u            /* base tick in us          */
+#define JT_MAX_PUB          8u
+#define JT_HIST_BUCKETS     8u
+#define JT_POOL_SIZE        4000000u        /* memory pool used with -m */
+
+/* upper bounds (in us) of the histogram buckets for the absolute deviation  */
+static const UINT32 cHistLimits[JT_HIST_BUCKETS] = { 5u, 10u, 25u, 50u, 100u, 250u, 500u, 0xFFFFFFFFu };
+
+/* intervals to publish (in us), only those >= base tick are used */
+static const UINT32 cIntervals[JT_MAX_PUB] = { 100u, 250u, 500u, 1000u, 2500u, 5000u, 10000u, 100000u };
+
+typedef struct
+{
+    TRDP_PUB_T      pubHandle;
+    UINT32          comId;
+    UINT32          interval;           /* configured interval in us    */
+    VOS_TIMEVAL_T   lastSent;
+    UINT32          count;              /* number of measured intervals */
+    INT32           minDev;
+    INT32           maxDev;
+    INT64           sumDev;
+    UINT64          sumAbsDev;
+    UINT32          hist[JT_HIST_BUCKETS];
+} JT_PUB_T;
+
+/***********************************************************************************************************************
+ * GLOBALS
+ */
+static JT_PUB_T     gPub[JT_MAX_PUB];
+static UINT32       gNoOfPub    = 0u;
+static BOOL8        gVerbose    = FALSE;
+static BOOL8        gMeasure    = FALSE;
+static BOOL8        gHistograms = FALSE;
+static UINT8        gData[JT_DATA_SIZE];
+
+/***********************************************************************************************************************
+ * PROTOTYPES
+ */
+static void dbgOut (void *, TRDP_LOG_T, const CHAR8 *, const CHAR8 *, UINT16, const CHAR8 *);
+static void usage (const char *);
+static void sendCallback (void *, TRDP_APP_SESSION_T, const TRDP_PD_INFO_T *, UINT8 *, UINT32);
+static void senderThread (void *);
+static void printResults (void);
+static void printStackHistograms (TRDP_APP_SESSION_T);
+
+/**********************************************************************************************************************/
+/** callback routine for TRDP logging/error output
+ *
+ *  @param[in]      pRefCon          user supplied context pointer
+ *  @param[in]      category         Log category (Error, Warning, Info etc.)
+ *  @param[in]      pTime            pointer to NULL-terminated string of time stamp
+ *  @param[in]      pFile            pointer to NULL-terminated string of source module
+ *  @param[in]      lineNumber       line
+ *  @param[in]      pMsgStr          pointer to NULL-terminated string
+ *  @retval         none
+ */
+static void dbgOut (
+    void        *pRefCon,
+    TRDP_LOG_T  category,
+    const CHAR8 *pTime,
+    const CHAR8 *pFile,
+    UINT16      lineNumber,
+    const CHAR8 *pMsgStr)
+{
+    const char *catStr[] = {"**Error:", "Warning:", "   Info:", "  Debug:", "   User:"};
+
+    if ((category != VOS_LOG_DBG) || (gVerbose == TRUE))
+    {
+        printf("%s %s %s:%d %s",
+               strrchr(pTime, '-') + 1,
+               catStr[category],
+               strrchr(pFile, VOS_DIR_SEP) + 1,
+               lineNumber,
+               pMsgStr);
+    }
+}
+
+/**********************************************************************************************************************/
+/* Print a sensible usage message */
+static void usage (const char *appName)
+{
+    printf("Usage of %s\n", appName);
+    printf("This tool publishes telegrams with intervals down to the base tick of the indexed scheduler\n"
+           "and measures the actual send jitter. Arguments are:\n"
+           "-o <own IP address> (default INADDR_ANY)\n"
+           "-t <target IP address> (default 127.0.0.1)\n"
+           "-b <base tick in us> (100...10000, default 250)\n"
+           "-n <number of categories> (1...5, default 3)\n"
+           "-s <run time in seconds> (default 10)\n"
+           "-r use real-time (FIFO) scheduling for the send thread\n"
+           "-a <CPU to pin the send thread to> (default none)\n"
+           "-m lock and prefault memory (stack, pool in huge pages if available)\n"
+           "-g print the stack's send interval histograms, too\n"
+           "-d verbose output\n"
+           "-h print usage\n"
+           );
+}
+
+/**********************************************************************************************************************/
+/** Pre-send callback: Take the timestamp and update the statistics of the comId
+ *
+ *  @param[in]      pRefCon         user supplied context pointer
+ *  @param[in]      appHandle       application handle
+ *  @param[in]      pMsg            pointer to header/packet infos
+ *  @param[in]      pData           pointer to data block
+ *  @param[in]      dataSize        pointer to data size
+ *  @retval         none
+ */
+static void sendCallback (
+    void                    *pRefCon,
+    TRDP_APP_SESSION_T      appHandle,
+    const TRDP_PD_INFO_T    *pMsg,
+    UINT8                   *pData,
+    UINT32                  dataSize)
+{
+    VOS_TIMEVAL_T   now;
+    VOS_TIMEVAL_T   delta;
+    JT_PUB_T        *pPub;
+    INT32           dev;
+    UINT32          absDev;
+    UINT32          i;
+
+    vos_getTime(&now);
+
+    if ((pMsg->comId < JT_COMID_BASE) || (pMsg->comId >= JT_COMID_BASE + gNoOfPub))
+    {
+        return;
+    }
+    pPub = &gPub[pMsg->comId - JT_COMID_BASE];
+
+    if ((gMeasure == TRUE) && (timerisset(&pPub->lastSent)))
+    {
+        delta = now;
+        vos_subTime(&delta, &pPub->lastSent);
+        dev     = (INT32)(delta.tv_sec * 1000000 + delta.tv_usec) - (INT32) pPub->interval;
+        absDev  = (UINT32) ((dev < 0) ? -dev : dev);
+
+        if ((pPub->count == 0u) || (dev < pPub->minDev))
+        {
+            pPub->minDev = dev;
+        }
+        if ((pPub->count == 0u) || (dev > pPub->maxDev))
+        {
+            pPub->maxDev = dev;
+        }
+        pPub->sumDev    += dev;
+        pPub->sumAbsDev += absDev;
+        pPub->count++;
+
+        for (i = 0u; i < JT_HIST_BUCKETS; i++)
+        {
+            if (absDev <= cHistLimits[i])
+            {
+                pPub->hist[i]++;
+                break;
+            }
+        }
+    }
+    pPub->lastSent = now;
+}
+
+/**********************************************************************************************************************/
+/** Cyclic send thread: just call tlp_processSend
+ *
+ *  @param[in]      pArg        application handle
+ *  @retval         none
+ */
+static void senderThread (
+    void *pArg)
+{
+    TRDP_ERR_T err = tlp_processSend((TRDP_APP_SESSION_T) pArg);
+
+    if ((err != TRDP_NO_ERR) && (err != TRDP_BLOCK_ERR))
+    {
+        vos_printLog(VOS_LOG_USR, "tlp_processSend failed (%s)\n", vos_getErrorString((VOS_ERR_T)err));
+    }
+}
+
+/**********************************************************************************************************************/
+/** Output the collected statistics
+ */
+static void printResults (void)
+{
+    UINT32 i, j;
+
+    printf("\n%6s %8s %8s %8s %8s %8s %8s |", "comId", "cycle", "count", "min", "max", "avg", "avg|d|");
+    for (j = 0u; j < JT_HIST_BUCKETS - 1u; j++)
+    {
+        printf(" <=%-5u", cHistLimits[j]);
+    }
+    printf("  >%-5u\n", cHistLimits[JT_HIST_BUCKETS - 2u]);
+
+    for (i = 0u; i < gNoOfPub; i++)
+    {
+        JT_PUB_T *pPub = &gPub[i];
+
+        if (pPub->count == 0u)
+        {
+            printf("%6u %8u %8s\n", pPub->comId, pPub->interval, "-");
+            continue;
+        }
+        printf("%6u %8u %8u %8d %8d %8d %8u |",
+               pPub->comId,
+               pPub->interval,
+               pPub->count,
+               pPub->minDev,
+               pPub->maxDev,
+               (int) (pPub->sumDev / (INT64) pPub->count),
+               (unsigned int) (pPub->sumAbsDev / pPub->count));
+        for (j = 0u; j < JT_HIST_BUCKETS; j++)
+        {
+            printf(" %7u", pPub->hist[j]);
+        }
+        printf("\n");
+    }
+    printf("(all deviations in us, relative to the configured interval)\n");
+}
+
+/**********************************************************************************************************************/
+/** Output the send interval histograms recorded by the stack
+ *
+ *  @param[in]      appHandle       application handle
+ */
+static void printStackHistograms (TRDP_APP_SESSION_T appHandle)
+{
+    TRDP_PD_HISTOGRAMS_T    histos;
+    UINT32                  i;
+
+    printf("\n%6s %8s %8s %8s %8s %8s %8s %8s %8s\n",
+           "comId", "cycle", "count", "min", "p50", "p99", "p99.9", "max", "cb p99");
+
+    for (i = 0u; i < gNoOfPub; i++)
+    {
+        if (tlc_getPubHistograms(appHandle, gPub[i].pubHandle, &histos) != TRDP_NO_ERR)
+        {
+            continue;
+        }
+        printf("%6u %8u %8u %8u %8u %8u %8u %8u %8u\n",
+               gPub[i].comId,
+               gPub[i].interval,
+               histos.interval.count,
+               histos.interval.min,
+               tlc_getHistoPercentile(&histos.interval, 500u),
+               tlc_getHistoPercentile(&histos.interval, 990u),
+               tlc_getHistoPercentile(&histos.interval, 999u),
+               histos.interval.max,
+               tlc_getHistoPercentile(&histos.cbExec, 990u));
+    }
+    printf("(send intervals in us as recorded by the stack, %u buckets per power of two)\n",
+           TRDP_HISTO_SUB_BUCKETS);
+}
+
+/**********************************************************************************************************************/
+/** main entry
+ *
+ *  @retval         0        no error
+ *  @retval         1        some error
+ */
+int main (int argc, char *argv[])
+{
+    TRDP_APP_SESSION_T      appHandle;
+    TRDP_PROCESS_CONFIG_T   processConfig   = {"JitterTest", "", 0u, 0u, TRDP_OPTION_NONE};
+    TRDP_IDX_TABLE_T        idxSizes        = {10u, 10u, 10u,       /* subscriptions (low, mid, high)   */
+                                               20u, 4u,             /* fast publishers, depth           */
+                                               10u, 4u,             /* mid publishers, depth            */
+                                               10u, 4u,             /* slow publishers, depth           */
+                                               10u,                 /* ext publishers                   */
+                                               0u, 0u};             /* base tick, categories (below)    */
+    TRDP_MEM_CONFIG_T       memConfig       = {NULL, JT_POOL_SIZE, {0}};
+    VOS_RT_PROFILE_T        rtProfile       = {0u, FALSE, FALSE, FALSE, FALSE};
+    TRDP_IP_ADDR_T          ownIP           = 0u;
+    TRDP_IP_ADDR_T          destIP          = vos_dottedIP("127.0.0.1");
+    VOS_THREAD_POLICY_T     policy          = VOS_THREAD_POLICY_OTHER;
+    VOS_THREAD_PRIORITY_T   prio            = VOS_THREAD_PRIORITY_DEFAULT;
+    VOS_THREAD_T            sendThread      = NULL;
+    VOS_THREAD_STATS_T      threadStats;
+    VOS_TIMEVAL_T           startTime;
+    UINT32                  baseCycle       = JT_DEFAULT_BASE;
+    UINT32                  noOfCategories  = 0u;
+    UINT32                  runTime         = JT_DEFAULT_TIME;
+    UINT32                  cpu;
+    UINT32                  i;
+    int                     ch;
+    TRDP_ERR_T              err;
+
+    while ((ch = getopt(argc, argv, "o:t:b:n:s:a:mrgdh?")) != -1)
+    {
+        switch (ch)
+        {
+           case 'o':
+               ownIP = vos_dottedIP(optarg);
+               break;
+           case 't':
+               destIP = vos_dottedIP(optarg);
+               break;
+           case 'b':
+               if (sscanf(optarg, "%u", &baseCycle) < 1)
+               {
+                   usage(argv[0]);
+                   exit(1);
+               }
+               break;
+           case 'n':
+               if (sscanf(optarg, "%u", &noOfCategories) < 1)
+               {
+                   usage(argv[0]);
+                   exit(1);
+               }
+               break;
+           case 's':
+               if (sscanf(optarg, "%u", &runTime) < 1)
+               {
+                   usage(argv[0]);
+                   exit(1);
+               }
+               break;
+           case 'a':
+               if ((sscanf(optarg, "%u", &cpu) < 1) || (cpu > 63u))
+               {
+                   usage(argv[0]);
+                   exit(1);
+               }
+               rtProfile.cpuSet = (VOS_CPU_SET_T)1u << cpu;
+               break;
+           case 'm':
+               rtProfile.lockMemory     = TRUE;
+               rtProfile.prefaultStack  = TRUE;
+               rtProfile.prefaultHeap   = TRUE;
+               rtProfile.hugePages      = TRUE;
+               break;
+           case 'r':
+               policy   = VOS_THREAD_POLICY_FIFO;
+               prio     = VOS_THREAD_PRIORITY_HIGHEST;
+               break;
+           case 'g':
+               gHistograms = TRUE;
+               break;
+           case 'd':
+               gVerbose = TRUE;
+               break;
+           case 'h':
+           case '?':
+           default:
+               printf("%s: Version %s\t(%s - %s)\n", argv[0], APP_VERSION, __DATE__, __TIME__);
+               usage(argv[0]);
+               return 1;
+        }
+    }
+
+    if (destIP == 0u)
+    {
+        fprintf(stderr, "No destination address given!\n");
+        usage(argv[0]);
+        return 1;
+    }
+
+    /* The process cycle is the base tick */
+    processConfig.cycleTime = baseCycle;
+    idxSizes.baseCycle      = baseCycle;
+    idxSizes.noOfCategories = noOfCategories;
+
+    /* The profile has to be set before tlc_init() creates the memory pool */
+    if ((rtProfile.cpuSet != 0u) || (rtProfile.lockMemory == TRUE))
+    {
+        if (vos_threadSetRtProfile(&rtProfile) != VOS_NO_ERR)
+        {
+            fprintf(stderr, "Real-time profile not (fully) applied\n");
+        }
+    }
+
+    if (tlc_init(&dbgOut, NULL, (rtProfile.lockMemory == TRUE) ? &memConfig : NULL) != TRDP_NO_ERR)
+    {
+        fprintf(stderr, "Initialization error\n");
+        return 1;
+    }
+
+    if (tlc_openSession(&appHandle, ownIP, 0u, NULL, NULL, NULL, &processConfig) != TRDP_NO_ERR)
+    {
+        vos_printLogStr(VOS_LOG_USR, "Initialization error\n");
+        return 1;
+    }
+
+    err = tlc_presetIndexSession(appHandle, &idxSizes);
+    if (err != TRDP_NO_ERR)
+    {
+        vos_printLog(VOS_LOG_USR, "tlc_presetIndexSession failed (%s)\n", vos_getErrorString((VOS_ERR_T)err));
+        tlc_terminate();
+        return 1;
+    }
+
+    /*  Publish one telegram per interval usable with the chosen base tick  */
+    for (i = 0u; i < JT_MAX_PUB; i++)
+    {
+        JT_PUB_T *pPub;
+
+        if (cIntervals[i] < baseCycle)
+        {
+            continue;
+        }
+        pPub            = &gPub[gNoOfPub];
+        pPub->comId     = JT_COMID_BASE + gNoOfPub;
+        pPub->interval  = cIntervals[i];
+
+        err = tlp_publish(appHandle, &pPub->pubHandle,
+                          NULL, sendCallback,
+                          0u, pPub->comId,
+                          0u, 0u,
+                          0u, destIP,
+                          pPub->interval,
+                          0u,
+                          TRDP_FLAGS_CALLBACK,
+                          NULL,
+                          gData, JT_DATA_SIZE);
+        if (err != TRDP_NO_ERR)
+        {
+            vos_printLog(VOS_LOG_USR, "tlp_publish failed (%s)\n", vos_getErrorString((VOS_ERR_T)err));
+            tlc_terminate();
+            return 1;
+        }
+        gNoOfPub++;
+    }
+
+    /*  Build the index tables */
+    err = tlc_updateSession(appHandle);
+    if (err != TRDP_NO_ERR)
+    {
+        vos_printLog(VOS_LOG_USR, "tlc_updateSession failed (%s)\n", vos_getErrorString((VOS_ERR_T)err));
+        tlc_terminate();
+        return 1;
+    }
+
+    vos_printLogStr(VOS_LOG_USR, "-----------------------------------------------\n");
+    vos_printLog(VOS_LOG_USR, "Base tick / process cycle :   %uus\n", baseCycle);
+    vos_printLog(VOS_LOG_USR, "Publishers                :   %u\n", gNoOfPub);
+    vos_printLog(VOS_LOG_USR, "Run time                  :   %us\n", runTime);
+    vos_printLogStr(VOS_LOG_USR, "-----------------------------------------------\n");
+
+    /*  Start the sender on the next full second   */
+    vos_getTime(&startTime);
+    startTime.tv_sec++;
+    startTime.tv_usec = 0;
+
+    err = (TRDP_ERR_T) vos_threadCreateSync(&sendThread, "Sender Task",
+                                            policy,
+                                            prio,
+                                            baseCycle,      /*  interval for cyclic thread      */
+                                            &startTime,     /*  start time for cyclic threads   */
+                                            0u,             /*  stack size (default 4 x PTHREAD_STACK_MIN)   */
+                                            (VOS_THREAD_FUNC_T) senderThread, appHandle);
+    if (err != TRDP_NO_ERR)
+    {
+        vos_printLog(VOS_LOG_USR, "Sender thread could not be created (%s)\n", vos_getErrorString((VOS_ERR_T)err));
+        tlc_terminate();
+        return 1;
+    }
+
+    /*  Skip the settling phase, then measure  */
+    (void) vos_threadDelay(2000000u);
+    if (gHistograms == TRUE)
+    {
+        (void) tlc_enableHistograms(appHandle, TRUE);
+    }
+    (void) vos_threadResetStatistics(sendThread);
+    gMeasure = TRUE;
+    (void) vos_threadDelay(runTime * 1000000u);
+    gMeasure = FALSE;
+
+    /*  Must be read before the thread is gone  */
+    if (vos_threadGetStatistics(sendThread, &threadStats) != VOS_NO_ERR)
+    {
+        memset(&threadStats, 0, sizeof(threadStats));
+    }
+    (void) vos_threadTerminate(sendThread);
+
+    printResults();
+    printf("\nSend thread: %u cycles, %u missed, wakeup latency min/avg/max %u/%u/%u us, exec avg/max %u/%u us\n",
+           threadStats.numCycles, threadStats.numMissed,
+           threadStats.minWakeupLatency, threadStats.avgWakeupLatency, threadStats.maxWakeupLatency,
+           threadStats.avgExecTime, threadStats.maxExecTime);
+    if (gHistograms == TRUE)
+    {
+        printStackHistograms(appHandle);
+    }
+
+    /*
+     *    We always clean up behind us!
+     */
+    for (i = 0u; i < gNoOfPub; i++)
+    {
+        (void) tlp_unpublish(appHandle, gPub[i].pubHandle);
+    }
+    (void) tlc_closeSession(appHandle);
+    (void) tlc_terminate();
+
+    return 0;
+}
@@ -0,0 +1,324 @@
+/**********************************************************************************************************************/
+/**
+ * @file            trdp-pd-put-contention.c
+ *
+ * @brief           Contention benchmark for the PD API entry points
+ *
+ * @details         Opens several sessions and lets a number of application threads hammer tlp_put() on
+ *                  publishers spread across these sessions (thread n uses session n % sessions).
+ *                  The achieved number of calls per second is reported in total and per thread.
+ *                  Every call passes the session handle validation, which formerly serialized all threads
+ *                  of all sessions on one global mutex.
+ *
+ * @note            Project: TCNOpen TRDP prototype stack
+ *
+ * @author          agent
+ *
+ * @remarks This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0.
+ *          If a copy of the MPL was not distributed with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ *          Copyright agent, 2026. All rights reserved.
+ *
+ * $Id$
+ *
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#if defined (POSIX)
+#include <unistd.h>
+#endif
+
+#include "trdp_if_light.h"
+#include "vos_thread.h"
+#include "vos_utils.h"
+
+/***********************************************************************************************************************
+ * DEFINITIONS
+ */
+#define APP_VERSION         "1.0"
+
+#define PC_COMID_BASE       6000u
+#define PC_DATA_SIZE        64u
+#define PC_DEFAULT_TIME     5u              /* run time in seconds      */
+#define PC_DEFAULT_THREADS  16u
+#define PC_DEFAULT_SESSIONS 4u
+#define PC_MAX_THREADS      64u
+#define PC_MAX_SESSIONS     8u
+
+typedef struct
+{
+    TRDP_APP_SESSION_T  appHandle;
+    TRDP_PUB_T          pubHandle;
+    VOS_THREAD_T        thread;
+    UINT32              calls;
+    UINT32              errors;
+    BOOL8               done;
+} PC_WORKER_T;
+
+/***********************************************************************************************************************
+ * GLOBALS
+ */
+static PC_WORKER_T          gWorker[PC_MAX_THREADS];
+static volatile BOOL8       gRun        = FALSE;
+static volatile BOOL8       gStop       = FALSE;
+static BOOL8                gVerbose    = FALSE;
+
+/***********************************************************************************************************************
+ * PROTOTYPES
+ */
+static void dbgOut (void *, TRDP_LOG_T, const CHAR8 *, const CHAR8 *, UINT16, const CHAR8 *);
+static void usage (const char *);
+static void putThread (void *);
+
+/**********************************************************************************************************************/
+/** callback routine for TRDP logging/error output
+ *
+ *  @param[in]      pRefCon          user supplied context pointer
+ *  @param[in]      category         Log category (Error, Warning, Info etc.)
+ *  @param[in]      pTime            pointer to NULL-terminated string of time stamp
+ *  @param[in]      pFile            pointer to NULL-terminated string of source module
+ *  @param[in]      lineNumber       line
+ *  @param[in]      pMsgStr          pointer to NULL-terminated string
+ *  @retval         none
+ */
+static void dbgOut (
+    void        *pRefCon,
+    TRDP_LOG_T  category,
+    const CHAR8 *pTime,
+    const CHAR8 *pFile,
+    UINT16      lineNumber,
+    const CHAR8 *pMsgStr)
+{
+    const char *catStr[] = {"**Error:", "Warning:", "   Info:", "  Debug:", "   User:"};
+
+    if (((category != VOS_LOG_DBG) && (category != VOS_LOG_INFO)) || (gVerbose == TRUE))
+    {
+        printf("%s %s %s:%d %s",
+               strrchr(pTime, '-') + 1,
+               catStr[category],
+               strrchr(pFile, VOS_DIR_SEP) + 1,
+               lineNumber,
+               pMsgStr);
+    }
+}
+
+/**********************************************************************************************************************/
+/* Print a sensible usage message */
+static void usage (const char *appName)
+{
+    printf("Usage of %s\n", appName);
+    printf("This tool lets several threads call tlp_put() on publishers of several sessions\n"
+           "and reports the achieved call rate. Arguments are:\n"
+           "-o <own IP address> (default INADDR_ANY)\n"
+           "-t <target IP address> (default 127.0.0.1)\n"
+           "-n <number of threads> (default %u, max. %u)\n"
+           "-c <number of sessions> (default %u, max. %u)\n"
+           "-s <run time in s> (default %u)\n"
+           "-d verbose output\n"
+           "-h print usage\n",
+           PC_DEFAULT_THREADS, PC_MAX_THREADS, PC_DEFAULT_SESSIONS, PC_MAX_SESSIONS, PC_DEFAULT_TIME);
+}
+
+/**********************************************************************************************************************/
+/** Worker thread: call tlp_put as often as possible while the measurement runs
+ *
+ *  @param[in]      pArg        pointer to the worker
+ *  @retval         none
+ */
+static void putThread (
+    void *pArg)
+{
+    PC_WORKER_T *pWorker = (PC_WORKER_T *) pArg;
+    UINT8       data[PC_DATA_SIZE];
+
+    memset(data, 0, sizeof(data));
+
+    while (gRun == FALSE)
+    {
+        (void) vos_threadDelay(1000u);
+    }
+    while (gStop == FALSE)
+    {
+        data[0]++;
+        if (tlp_put(pWorker->appHandle, pWorker->pubHandle, data, PC_DATA_SIZE) == TRDP_NO_ERR)
+        {
+            pWorker->calls++;
+        }
+        else
+        {
+            pWorker->errors++;
+        }
+    }
+    pWorker->done = TRUE;
+}
+
+/**********************************************************************************************************************/
+/** main entry
+ *
+ *  @retval         0        no error
+ *  @retval         1        some error
+ */
+int main (int argc, char *argv[])
+{
+    TRDP_APP_SESSION_T      appHandle[PC_MAX_SESSIONS];
+    TRDP_PROCESS_CONFIG_T   processConfig   = {"PutContention", "", 0u, 0u, TRDP_OPTION_NO_PD_STATS};
+    TRDP_IP_ADDR_T          ownIP           = 0u;
+    TRDP_IP_ADDR_T          destIP          = vos_dottedIP("127.0.0.1");
+    UINT32                  noOfThreads     = PC_DEFAULT_THREADS;
+    UINT32                  noOfSessions    = PC_DEFAULT_SESSIONS;
+    UINT32                  runTime         = PC_DEFAULT_TIME;
+    UINT64                  total           = 0u;
+    UINT32                  errors          = 0u;
+    UINT32                  i;
+    int                     ch;
+    TRDP_ERR_T              err;
+
+    while ((ch = getopt(argc, argv, "o:t:n:c:s:dh?")) != -1)
+    {
+        switch (ch)
+        {
+           case 'o':
+               ownIP = vos_dottedIP(optarg);
+               break;
+           case 't':
+               destIP = vos_dottedIP(optarg);
+               break;
+           case 'n':
+               if ((sscanf(optarg, "%u", &noOfThreads) < 1) || (noOfThreads == 0u) || (noOfThreads > PC_MAX_THREADS))
+               {
+                   usage(argv[0]);
+                   exit(1);
+               }
+               break;
+           case 'c':
+               if ((sscanf(optarg, "%u", &noOfSessions) < 1) || (noOfSessions == 0u) ||
+                   (noOfSessions > PC_MAX_SESSIONS))
+               {
+                   usage(argv[0]);
+                   exit(1);
+               }
+               break;
+           case 's':
+               if (sscanf(optarg, "%u", &runTime) < 1)
+               {
+                   usage(argv[0]);
+                   exit(1);
+               }
+               break;
+           case 'd':
+               gVerbose = TRUE;
+               break;
+           case 'h':
+           case '?':
+           default:
+               printf("%s: Version %s\t(%s - %s)\n", argv[0], APP_VERSION, __DATE__, __TIME__);
+               usage(argv[0]);
+               return 1;
+        }
+    }
+
+    if (tlc_init(&dbgOut, NULL, NULL) != TRDP_NO_ERR)
+    {
+        fprintf(stderr, "Initialization error\n");
+        return 1;
+    }
+
+    for (i = 0u; i < noOfSessions; i++)
+    {
+        if (tlc_openSession(&appHandle[i], ownIP, 0u, NULL, NULL, NULL, &processConfig) != TRDP_NO_ERR)
+        {
+            vos_printLogStr(VOS_LOG_USR, "Initialization error\n");
+            tlc_terminate();
+            return 1;
+        }
+    }
+
+    /*  One publisher (not cyclic, just a buffer to update) per thread */
+    for (i = 0u; i < noOfThreads; i++)
+    {
+        UINT8 initData[PC_DATA_SIZE];
+
+        memset(initData, 0, sizeof(initData));
+        gWorker[i].appHandle = appHandle[i % noOfSessions];
+
+        err = tlp_publish(gWorker[i].appHandle, &gWorker[i].pubHandle,
+                          NULL, NULL,
+                          0u, PC_COMID_BASE + i,
+                          0u, 0u,
+                          0u, destIP,
+                          0u,
+                          0u,
+                          TRDP_FLAGS_NONE,
+                          NULL,
+                          initData, PC_DATA_SIZE);
+        if (err != TRDP_NO_ERR)
+        {
+            vos_printLog(VOS_LOG_USR, "tlp_publish failed (%s)\n", vos_getErrorString((VOS_ERR_T)err));
+            tlc_terminate();
+            return 1;
+        }
+    }
+
+    for (i = 0u; i < noOfThreads; i++)
+    {
+        err = (TRDP_ERR_T) vos_threadCreate(&gWorker[i].thread, "Put Task",
+                                            VOS_THREAD_POLICY_OTHER,
+                                            VOS_THREAD_PRIORITY_DEFAULT,
+                                            0u,             /*  run once, the worker loops itself   */
+                                            0u,             /*  default stack size                  */
+                                            (VOS_THREAD_FUNC_T) putThread, &gWorker[i]);
+        if (err != TRDP_NO_ERR)
+        {
+            vos_printLog(VOS_LOG_USR, "Worker thread could not be created (%s)\n",
+                         vos_getErrorString((VOS_ERR_T)err));
+            gStop   = TRUE;
+            gRun    = TRUE;
+            noOfThreads = i;
+            break;
+        }
+    }
+
+    vos_printLogStr(VOS_LOG_USR, "-----------------------------------------------\n");
+    vos_printLog(VOS_LOG_USR, "Sessions                  :   %u\n", noOfSessions);
+    vos_printLog(VOS_LOG_USR, "Threads                   :   %u\n", noOfThreads);
+    vos_printLog(VOS_LOG_USR, "Run time                  :   %us\n", runTime);
+    vos_printLogStr(VOS_LOG_USR, "-----------------------------------------------\n");
+
+    gRun = TRUE;
+    (void) vos_threadDelay(runTime * 1000000u);
+    gStop = TRUE;
+
+    for (i = 0u; i < noOfThreads; i++)
+    {
+        while (gWorker[i].done == FALSE)
+        {
+            (void) vos_threadDelay(1000u);
+        }
+        printf("thread %2u (session %u): %10u calls, %u errors\n",
+               i, i % noOfSessions, gWorker[i].calls, gWorker[i].errors);
+        total   += gWorker[i].calls;
+        errors  += gWorker[i].errors;
+    }
+    if (runTime > 0u)
+    {
+        printf("total: %llu calls, %llu calls/s, %u errors\n",
+               (unsigned long long) total, (unsigned long long) (total / runTime), errors);
+    }
+
+    /*
+     *    We always clean up behind us!
+     */
+    for (i = 0u; i < noOfThreads; i++)
+    {
+        (void) tlp_unpublish(gWorker[i].appHandle, gWorker[i].pubHandle);
+    }
+    for (i = 0u; i < noOfSessions; i++)
+    {
+        (void) tlc_closeSession(appHandle[i]);
+    }
+    (void) tlc_terminate();
+
+    return (errors == 0u) ? 0 : 1;
+}
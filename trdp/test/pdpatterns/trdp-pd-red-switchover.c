@@ -0,0 +1,479 @@
+/**********************************************************************************************************************/
+/**
+ * @file            trdp-pd-red-switchover.c
+ *
+ * @brief           Redundancy switchover gap on the local host
+ *
+ * @details         Publishes a number of cyclic telegrams of one redundancy group to the local host and subscribes
+ *                  to them again. The leadership of the group is toggled periodically with tlp_setRedundant().
+ *                  Reported are the execution time of tlp_setRedundant(), the time from the switch to leader until
+ *                  the first and until all telegrams of the group were received, the time until the last telegram
+ *                  was received after the switch to follower and the sequence counter advance per cycle while
+ *                  the group was follower (1.0 if the counters are kept aligned).
+ *
+ * @note            Project: TCNOpen TRDP prototype stack
+ *
+ * @author          agent
+ *
+ * @remarks This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0.
+ *          If a copy of the MPL was not distributed with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ *          Copyright agent, 2026. All rights reserved.
+ *
+ * $Id$
+ *
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#if defined (POSIX)
+#include <unistd.h>
+#endif
+
+#include "trdp_if_light.h"
+#include "vos_thread.h"
+#include "vos_utils.h"
+
+/***********************************************************************************************************************
+ * DEFINITIONS
+ */
+#define APP_VERSION         "1.0"
+
+#define RS_COMID_BASE       7100u
+#define RS_RED_ID           1u
+#define RS_DATA_SIZE        64u
+#define RS_DEFAULT_CYCLE    10000u          /* 10ms                             */
+#define RS_DEFAULT_HOLD     200u            /* time between switches in ms      */
+#define RS_DEFAULT_SWITCHES 10u
+#define RS_DEFAULT_TELEGRAMS 100u
+#define RS_MAX_TELEGRAMS    500u
+
+typedef struct
+{
+    TRDP_PUB_T  pubHandle;
+    TRDP_SUB_T  subHandle;
+    UINT32      phase;                      /* leader phase of the last reception   */
+    UINT32      lastSeqCnt;
+    TRDP_TIME_T lastRx;
+} RS_TELEGRAM_T;
+
+typedef struct
+{
+    UINT32  count;
+    UINT64  sum;                            /* us */
+    UINT32  max;                            /* us */
+} RS_MEASURE_T;
+
+/***********************************************************************************************************************
+ * GLOBALS
+ */
+static RS_TELEGRAM_T    gTelegram[RS_MAX_TELEGRAMS];
+static UINT32           gNoOfTelegrams  = RS_DEFAULT_TELEGRAMS;
+static UINT32           gCycle          = RS_DEFAULT_CYCLE;
+static BOOL8            gVerbose        = FALSE;
+static BOOL8            gLeader         = TRUE;
+static UINT32           gPhase          = 0u;   /* incremented with every switch to leader  */
+static TRDP_TIME_T      gSwitchTime;
+static UINT32           gFirstSeen;             /* telegrams received in the current leader phase */
+static RS_MEASURE_T     gFirst;
+static RS_MEASURE_T     gAll;
+static RS_MEASURE_T     gStop;
+static RS_MEASURE_T     gCall;
+static UINT64           gSeqAdvance;
+static UINT64           gSeqCycles;
+
+/***********************************************************************************************************************
+ * PROTOTYPES
+ */
+static void dbgOut (void *, TRDP_LOG_T, const CHAR8 *, const CHAR8 *, UINT16, const CHAR8 *);
+static void usage (const char *);
+static void pdCallback (void *, TRDP_APP_SESSION_T, const TRDP_PD_INFO_T *, UINT8 *, UINT32);
+static UINT32 elapsedUs (const TRDP_TIME_T *, const TRDP_TIME_T *);
+static void addMeasure (RS_MEASURE_T *, UINT32);
+static void printMeasure (const char *, const RS_MEASURE_T *);
+
+/**********************************************************************************************************************/
+/** callback routine for TRDP logging/error output
+ *
+ *  @param[in]      pRefCon          user supplied context pointer
+ *  @param[in]      category         Log category (Error, Warning, Info etc.)
+ *  @param[in]      pTime            pointer to NULL-terminated string of time stamp
+ *  @param[in]      pFile            pointer to NULL-terminated string of source module
+ *  @param[in]      lineNumber       line
+ *  @param[in]      pMsgStr          pointer to NULL-terminated string
+ *  @retval         none
+ */
+static void dbgOut (
+    void        *pRefCon,
+    TRDP_LOG_T  category,
+    const CHAR8 *pTime,
+    const CHAR8 *pFile,
+    UINT16      lineNumber,
+    const CHAR8 *pMsgStr)
+{
+    const char *catStr[] = {"**Error:", "Warning:", "   Info:", "  Debug:", "   User:"};
+
+    if (((category != VOS_LOG_DBG) && (category != VOS_LOG_INFO)) || (gVerbose == TRUE))
+    {
+        printf("%s %s %s:%d %s",
+               strrchr(pTime, '-') + 1,
+               catStr[category],
+               strrchr(pFile, VOS_DIR_SEP) + 1,
+               lineNumber,
+               pMsgStr);
+    }
+}
+
+/**********************************************************************************************************************/
+/* Print a sensible usage message */
+static void usage (const char *appName)
+{
+    printf("Usage of %s\n", appName);
+    printf("This tool publishes and subscribes cyclic telegrams of one redundancy group on the local host and\n"
+           "toggles the leadership of the group. The switchover gaps are reported.\n"
+           "Arguments are:\n"
+           "-n <number of telegrams> (default %u, max. %u)\n"
+           "-c <cycle time in us> (default %u)\n"
+           "-w <time between switches in ms> (default %u)\n"
+           "-r <number of switches to leader> (default %u)\n"
+           "-d verbose output\n"
+           "-h print usage\n",
+           RS_DEFAULT_TELEGRAMS, RS_MAX_TELEGRAMS, RS_DEFAULT_CYCLE, RS_DEFAULT_HOLD, RS_DEFAULT_SWITCHES);
+}
+
+/**********************************************************************************************************************/
+/** Time difference in us
+ *
+ *  @param[in]      pFrom           earlier time
+ *  @param[in]      pTo             later time
+ *  @retval         difference in us (0 if negative)
+ */
+static UINT32 elapsedUs (
+    const TRDP_TIME_T   *pFrom,
+    const TRDP_TIME_T   *pTo)
+{
+    TRDP_TIME_T diff = *pTo;
+
+    if (vos_cmpTime((TRDP_TIME_T *) pTo, (TRDP_TIME_T *) pFrom) < 0)
+    {
+        return 0u;
+    }
+    vos_subTime(&diff, pFrom);
+    return (UINT32) diff.tv_sec * 1000000u + (UINT32) diff.tv_usec;
+}
+
+/**********************************************************************************************************************/
+/** Add a sample to a measurement
+ *
+ *  @param[in]      pMeasure        measurement
+ *  @param[in]      value           sample in us
+ */
+static void addMeasure (
+    RS_MEASURE_T    *pMeasure,
+    UINT32          value)
+{
+    pMeasure->count++;
+    pMeasure->sum += value;
+    if (value > pMeasure->max)
+    {
+        pMeasure->max = value;
+    }
+}
+
+/**********************************************************************************************************************/
+/** Print a measurement
+ *
+ *  @param[in]      pName           label
+ *  @param[in]      pMeasure        measurement
+ */
+static void printMeasure (
+    const char          *pName,
+    const RS_MEASURE_T  *pMeasure)
+{
+    printf("%-34s: avg %6llu us, max %6u us (%u samples)\n",
+           pName,
+           (unsigned long long) ((pMeasure->count > 0u) ? pMeasure->sum / pMeasure->count : 0u),
+           pMeasure->max, pMeasure->count);
+}
+
+/**********************************************************************************************************************/
+/** PD callback: record the first reception of every telegram after a switch to leader
+ *
+ *  @param[in]      pRefCon         user supplied context pointer
+ *  @param[in]      appHandle       session
+ *  @param[in]      pMsg            message info
+ *  @param[in]      pData           received data
+ *  @param[in]      dataSize        size of the data
+ */
+static void pdCallback (
+    void                    *pRefCon,
+    TRDP_APP_SESSION_T      appHandle,
+    const TRDP_PD_INFO_T    *pMsg,
+    UINT8                   *pData,
+    UINT32                  dataSize)
+{
+    RS_TELEGRAM_T *pTelegram = (RS_TELEGRAM_T *) pMsg->pUserRef;
+
+    if ((pTelegram == NULL) || (pMsg->resultCode != TRDP_NO_ERR))
+    {
+        return;
+    }
+
+    if ((pTelegram->phase != gPhase) && (gLeader == TRUE))
+    {
+        UINT32 gap      = elapsedUs(&gSwitchTime, &pMsg->rxTime);
+        UINT32 standby  = elapsedUs(&pTelegram->lastRx, &pMsg->rxTime);
+
+        if (gFirstSeen == 0u)
+        {
+            addMeasure(&gFirst, gap);
+        }
+        gFirstSeen++;
+        if (gFirstSeen == gNoOfTelegrams)
+        {
+            addMeasure(&gAll, gap);
+        }
+
+        /*  Sequence counter advance while we were follower, compared to the cycles passed   */
+        gSeqAdvance += pMsg->seqCount - pTelegram->lastSeqCnt;
+        gSeqCycles  += (standby + gCycle / 2u) / gCycle;
+        pTelegram->phase = gPhase;
+    }
+    pTelegram->lastSeqCnt   = pMsg->seqCount;
+    pTelegram->lastRx       = pMsg->rxTime;
+}
+
+/**********************************************************************************************************************/
+/** main entry
+ *
+ *  @retval         0        no error
+ *  @retval         1        some error
+ */
+int main (int argc, char *argv[])
+{
+    TRDP_APP_SESSION_T      appHandle;
+    TRDP_PROCESS_CONFIG_T   processConfig   = {"RedSwitch", "", 0u, 0u, TRDP_OPTION_NO_PD_STATS};
+    TRDP_PD_CONFIG_T        pdConfig        = {pdCallback, NULL, TRDP_PD_DEFAULT_SEND_PARAM, TRDP_FLAGS_CALLBACK,
+                                               10000000u, TRDP_TO_KEEP_LAST_VALUE, TRDP_PD_UDP_PORT};
+    TRDP_IP_ADDR_T          destIP          = vos_dottedIP("127.0.0.1");
+    UINT32                  holdTime        = RS_DEFAULT_HOLD;
+    UINT32                  noOfSwitches    = RS_DEFAULT_SWITCHES;
+    UINT32                  switches        = 0u;
+    UINT8                   data[RS_DATA_SIZE];
+    TRDP_TIME_T             nextSwitch;
+    TRDP_TIME_T             hold;
+    TRDP_TIME_T             now;
+    UINT32                  i;
+    int                     ch;
+    TRDP_ERR_T              err;
+
+    while ((ch = getopt(argc, argv, "n:c:w:r:dh?")) != -1)
+    {
+        switch (ch)
+        {
+           case 'n':
+               if ((sscanf(optarg, "%u", &gNoOfTelegrams) < 1) || (gNoOfTelegrams < 1u) ||
+                   (gNoOfTelegrams > RS_MAX_TELEGRAMS))
+               {
+                   usage(argv[0]);
+                   exit(1);
+               }
+               break;
+           case 'c':
+               if ((sscanf(optarg, "%u", &gCycle) < 1) || (gCycle < 1000u))
+               {
+                   usage(argv[0]);
+                   exit(1);
+               }
+               break;
+           case 'w':
+               if ((sscanf(optarg, "%u", &holdTime) < 1) || (holdTime * 1000u < 4u * gCycle))
+               {
+                   usage(argv[0]);
+                   exit(1);
+               }
+               break;
+           case 'r':
+               if (sscanf(optarg, "%u", &noOfSwitches) < 1)
+               {
+                   usage(argv[0]);
+                   exit(1);
+               }
+               break;
+           case 'd':
+               gVerbose = TRUE;
+               break;
+           case 'h':
+           case '?':
+           default:
+               printf("%s: Version %s\t(%s - %s)\n", argv[0], APP_VERSION, __DATE__, __TIME__);
+               usage(argv[0]);
+               return 1;
+        }
+    }
+
+    if (tlc_init(&dbgOut, NULL, NULL) != TRDP_NO_ERR)
+    {
+        fprintf(stderr, "Initialization error\n");
+        return 1;
+    }
+
+    if (tlc_openSession(&appHandle, 0u, 0u, NULL, &pdConfig, NULL, &processConfig) != TRDP_NO_ERR)
+    {
+        vos_printLogStr(VOS_LOG_USR, "Initialization error\n");
+        tlc_terminate();
+        return 1;
+    }
+
+    memset(data, 0, sizeof(data));
+    for (i = 0u; i < gNoOfTelegrams; i++)
+    {
+        err = tlp_subscribe(appHandle, &gTelegram[i].subHandle, &gTelegram[i], NULL,
+                            0u, RS_COMID_BASE + i,
+                            0u, 0u,
+                            0u, 0u,
+                            0u,
+                            TRDP_FLAGS_CALLBACK | TRDP_FLAGS_FORCE_CB,
+                            NULL,
+                            10000000u, TRDP_TO_KEEP_LAST_VALUE);
+        if (err == TRDP_NO_ERR)
+        {
+            err = tlp_publish(appHandle, &gTelegram[i].pubHandle,
+                              NULL, NULL,
+                              0u, RS_COMID_BASE + i,
+                              0u, 0u,
+                              0u, destIP,
+                              gCycle,
+                              RS_RED_ID,
+                              TRDP_FLAGS_NONE,
+                              NULL,
+                              data, RS_DATA_SIZE);
+        }
+        if (err != TRDP_NO_ERR)
+        {
+            vos_printLog(VOS_LOG_USR, "subscribe/publish failed (%s)\n", vos_getErrorString((VOS_ERR_T)err));
+            tlc_terminate();
+            return 1;
+        }
+    }
+
+    vos_printLogStr(VOS_LOG_USR, "-----------------------------------------------\n");
+    vos_printLog(VOS_LOG_USR, "Telegrams                 :   %u every %uus\n", gNoOfTelegrams, gCycle);
+    vos_printLog(VOS_LOG_USR, "Switch every              :   %ums\n", holdTime);
+    vos_printLog(VOS_LOG_USR, "Switches to leader        :   %u\n", noOfSwitches);
+    vos_printLogStr(VOS_LOG_USR, "-----------------------------------------------\n");
+
+    hold.tv_sec     = (long) (holdTime / 1000u);
+    hold.tv_usec    = (long) (holdTime % 1000u) * 1000;
+    vos_getTime(&nextSwitch);
+    vos_addTime(&nextSwitch, &hold);
+
+    /*
+        Enter the main processing loop, toggle the leadership when due
+     */
+    do
+    {
+        TRDP_FDS_T  rfds;
+        INT32       noDesc;
+        TRDP_TIME_T tv;
+        INT32       rv;
+
+        FD_ZERO(&rfds);
+        tlc_getInterval(appHandle, &tv, &rfds, &noDesc);
+        vos_getTime(&now);
+        if (vos_cmpTime(&now, &nextSwitch) >= 0)
+        {
+            vos_clearTime(&tv);
+        }
+        else
+        {
+            TRDP_TIME_T toSwitch = nextSwitch;
+
+            vos_subTime(&toSwitch, &now);
+            if (vos_cmpTime(&tv, &toSwitch) > 0)
+            {
+                tv = toSwitch;
+            }
+        }
+        rv = vos_select(noDesc + 1, &rfds, NULL, NULL, &tv);
+        (void) tlc_process(appHandle, &rfds, &rv);
+
+        vos_getTime(&now);
+        if ((vos_cmpTime(&now, &nextSwitch) >= 0) &&
+            ((gLeader == FALSE) || (switches < noOfSwitches)))
+        {
+            TRDP_TIME_T done;
+
+            if (gLeader == TRUE)
+            {
+                /*  The telegrams still in flight belong to the last leader phase   */
+                vos_getTime(&gSwitchTime);
+                err = tlp_setRedundant(appHandle, RS_RED_ID, FALSE);
+                vos_getTime(&done);
+                gLeader = FALSE;
+            }
+            else
+            {
+                /*  Last reception after the switch to follower    */
+                UINT32 stop = 0u;
+                for (i = 0u; i < gNoOfTelegrams; i++)
+                {
+                    UINT32 last = elapsedUs(&gSwitchTime, &gTelegram[i].lastRx);
+                    if (last > stop)
+                    {
+                        stop = last;
+                    }
+                }
+                addMeasure(&gStop, stop);
+
+                gFirstSeen = 0u;
+                gPhase++;
+                gLeader = TRUE;
+                vos_getTime(&gSwitchTime);
+                err = tlp_setRedundant(appHandle, RS_RED_ID, TRUE);
+                vos_getTime(&done);
+                switches++;
+            }
+            if (err != TRDP_NO_ERR)
+            {
+                vos_printLog(VOS_LOG_USR, "tlp_setRedundant failed (%s)\n", vos_getErrorString((VOS_ERR_T)err));
+                break;
+            }
+            addMeasure(&gCall, elapsedUs(&gSwitchTime, &done));
+            if (gVerbose == TRUE)
+            {
+                printf("switched to %s, %u telegrams received in the last leader phase\n",
+                       (gLeader == TRUE) ? "leader" : "follower", gFirstSeen);
+            }
+            nextSwitch = now;
+            vos_addTime(&nextSwitch, &hold);
+        }
+    }
+    while ((switches < noOfSwitches) || (gLeader == FALSE) || (vos_cmpTime(&now, &nextSwitch) < 0));
+
+    printf("telegrams: %u in redundancy group %u, cycle %u us\n", gNoOfTelegrams, RS_RED_ID, gCycle);
+    printMeasure("tlp_setRedundant()", &gCall);
+    printMeasure("leader: first telegram received", &gFirst);
+    printMeasure("leader: all telegrams received", &gAll);
+    printMeasure("follower: last telegram received", &gStop);
+    printf("%-34s: %.2f per cycle\n", "follower: sequence counter advance",
+           (gSeqCycles > 0u) ? (double) gSeqAdvance / (double) gSeqCycles : 0.0);
+    if (gAll.count < switches)
+    {
+        printf("%u leader phases without all telegrams received\n", switches - gAll.count);
+    }
+
+    /*
+     *    We always clean up behind us!
+     */
+    for (i = 0u; i < gNoOfTelegrams; i++)
+    {
+        (void) tlp_unpublish(appHandle, gTelegram[i].pubHandle);
+        (void) tlp_unsubscribe(appHandle, gTelegram[i].subHandle);
+    }
+    (void) tlc_closeSession(appHandle);
+    (void) tlc_terminate();
+
+    return (gAll.count < switches) ? 1 : 0;
+}
@@ -0,0 +1,373 @@
+/**********************************************************************************************************************/
+/**
+ * @file            trdp-pd-uring-test.c
+ *
+ * @brief           PD sent and received with an io_uring
+ *
+ * @details         Opens a session which publishes a number of cyclic telegrams to its own IP address and subscribes
+ *                  to them. With the io_uring enabled (tlp_enableUring) they are sent with one system call per cycle
+ *                  and received by multishot receives. Reported are the receptions, the statistics of the io_uring
+ *                  and the system calls to it per cycle. With -s the standard sockets are used for comparison.
+ *                  Needs a build with URING_SUPPORT=1 and Linux 6.0 or later.
+ *
+ * @note            Project: TCNOpen TRDP prototype stack
+ *
+ * @author          agent
+ *
+ * @remarks This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0.
+ *          If a copy of the MPL was not distributed with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ *          Copyright agent, 2026. All rights reserved.
+ *
+ * $Id$
+ *
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#if defined (POSIX)
+#include <unistd.h>
+#endif
+
+#include "trdp_if_light.h"
+#include "vos_thread.h"
+#include "vos_utils.h"
+
+/***********************************************************************************************************************
+ * DEFINITIONS
+ */
+#define APP_VERSION         "1.0"
+
+#define UT_COMID            7600u
+#define UT_DATA_SIZE        64u
+#define UT_DEFAULT_CYCLE    10000u          /* 10ms                             */
+#define UT_DEFAULT_TIME     3u              /* test duration in s               */
+#define UT_DEFAULT_TELEGRAMS 20u
+#define UT_MAX_TELEGRAMS    100u
+#define UT_DEFAULT_BUFFERS  256u
+#define UT_MIN_RECEIVED     90u             /* percentage of the cycles to pass */
+
+/***********************************************************************************************************************
+ * GLOBALS
+ */
+static TRDP_APP_SESSION_T   gAppHandle;
+static TRDP_PUB_T           gPubHandle[UT_MAX_TELEGRAMS];
+static TRDP_SUB_T           gSubHandle[UT_MAX_TELEGRAMS];
+static UINT32               gNoOfTelegrams  = UT_DEFAULT_TELEGRAMS;
+static UINT32               gReceived       = 0u;
+static UINT32               gLastSeqCnt[UT_MAX_TELEGRAMS];
+static UINT32               gSeqGaps        = 0u;
+static BOOL8                gVerbose        = FALSE;
+
+/***********************************************************************************************************************
+ * PROTOTYPES
+ */
+static void dbgOut (void *, TRDP_LOG_T, const CHAR8 *, const CHAR8 *, UINT16, const CHAR8 *);
+static void usage (const char *);
+static void pdCallback (void *, TRDP_APP_SESSION_T, const TRDP_PD_INFO_T *, UINT8 *, UINT32);
+
+/**********************************************************************************************************************/
+/** callback routine for TRDP logging/error output
+ *
+ *  @param[in]      pRefCon          user supplied context pointer
+ *  @param[in]      category         Log category (Error, Warning, Info etc.)
+ *  @param[in]      pTime            pointer to NULL-terminated string of time stamp
+ *  @param[in]      pFile            pointer to NULL-terminated string of source module
+ *  @param[in]      lineNumber       line
+ *  @param[in]      pMsgStr          pointer to NULL-terminated string
+ *  @retval         none
+ */
+static void dbgOut (
+    void        *pRefCon,
+    TRDP_LOG_T  category,
+    const CHAR8 *pTime,
+    const CHAR8 *pFile,
+    UINT16      lineNumber,
+    const CHAR8 *pMsgStr)
+{
+    const char *catStr[] = {"**Error:", "Warning:", "   Info:", "  Debug:", "   User:"};
+
+    if (((category != VOS_LOG_DBG) && (category != VOS_LOG_INFO)) || (gVerbose == TRUE))
+    {
+        printf("%s %s %s:%d %s",
+               strrchr(pTime, '-') + 1,
+               catStr[category],
+               strrchr(pFile, VOS_DIR_SEP) + 1,
+               lineNumber,
+               pMsgStr);
+    }
+}
+
+/**********************************************************************************************************************/
+/* Print a sensible usage message */
+static void usage (const char *appName)
+{
+    printf("Usage of %s\n", appName);
+    printf("This tool sends cyclic telegrams to itself, sending and receiving with an io_uring.\n"
+           "Arguments are:\n"
+           "-o <own IP address> (default 127.0.0.1)\n"
+           "-n <number of telegrams> (default %u, max. %u)\n"
+           "-c <cycle time in us> (default %u)\n"
+           "-t <duration in s> (default %u)\n"
+           "-b <number of receive buffers> (default %u)\n"
+           "-s use the sockets, not the io_uring\n"
+           "-d verbose output\n"
+           "-h print usage\n",
+           UT_DEFAULT_TELEGRAMS, UT_MAX_TELEGRAMS, UT_DEFAULT_CYCLE, UT_DEFAULT_TIME, UT_DEFAULT_BUFFERS);
+}
+
+/**********************************************************************************************************************/
+/** PD callback: count the receptions and gaps of the sequence counters
+ *
+ *  @param[in]      pRefCon         user supplied context pointer
+ *  @param[in]      appHandle       session
+ *  @param[in]      pMsg            message info
+ *  @param[in]      pData           received data
+ *  @param[in]      dataSize        size of the data
+ */
+static void pdCallback (
+    void                    *pRefCon,
+    TRDP_APP_SESSION_T      appHandle,
+    const TRDP_PD_INFO_T    *pMsg,
+    UINT8                   *pData,
+    UINT32                  dataSize)
+{
+    UINT32 idx = pMsg->comId - UT_COMID;
+
+    if (pMsg->resultCode != TRDP_NO_ERR)
+    {
+        return;
+    }
+    if ((idx >= gNoOfTelegrams) || (dataSize != UT_DATA_SIZE) || (pData[0] != (UINT8) idx))
+    {
+        vos_printLog(VOS_LOG_USR, "unexpected telegram comId %u, size %u\n", pMsg->comId, dataSize);
+        return;
+    }
+    if ((gLastSeqCnt[idx] != 0u) && (pMsg->seqCount != gLastSeqCnt[idx] + 1u))
+    {
+        gSeqGaps++;
+    }
+    gLastSeqCnt[idx] = pMsg->seqCount;
+    gReceived++;
+}
+
+/**********************************************************************************************************************/
+/** main entry
+ *
+ *  @retval         0        no error
+ *  @retval         1        some error
+ */
+int main (int argc, char *argv[])
+{
+    TRDP_PROCESS_CONFIG_T   processConfig   = {"UringTest", "", UT_DEFAULT_CYCLE, 0u, TRDP_OPTION_NO_PD_STATS};
+    TRDP_PD_CONFIG_T        pdConfig        = {pdCallback, NULL, TRDP_PD_DEFAULT_SEND_PARAM, TRDP_FLAGS_CALLBACK,
+                                               10000000u, TRDP_TO_KEEP_LAST_VALUE, TRDP_PD_UDP_PORT};
+    TRDP_URING_STATISTICS_T uringStats;
+    TRDP_IP_ADDR_T          ownIP       = 0x7F000001u;
+    UINT32                  cycle       = UT_DEFAULT_CYCLE;
+    UINT32                  duration    = UT_DEFAULT_TIME;
+    UINT32                  noOfBuffers = UT_DEFAULT_BUFFERS;
+    BOOL8                   useSockets  = FALSE;
+    UINT32                  cycles      = 0u;
+    UINT32                  expected;
+    UINT8                   data[UT_DATA_SIZE];
+    TRDP_TIME_T             end;
+    TRDP_TIME_T             now;
+    TRDP_TIME_T             nextSend;
+    TRDP_TIME_T             tick;
+    TRDP_ERR_T              err;
+    int                     ch;
+    int                     rc          = 0;
+    UINT32                  ip[4];
+    UINT32                  i;
+
+    while ((ch = getopt(argc, argv, "o:n:c:t:b:sdh?")) != -1)
+    {
+        switch (ch)
+        {
+           case 'o':
+               if (sscanf(optarg, "%u.%u.%u.%u", &ip[0], &ip[1], &ip[2], &ip[3]) < 4)
+               {
+                   usage(argv[0]);
+                   exit(1);
+               }
+               ownIP = (ip[0] << 24) | (ip[1] << 16) | (ip[2] << 8) | ip[3];
+               break;
+           case 'n':
+               if ((sscanf(optarg, "%u", &gNoOfTelegrams) < 1) || (gNoOfTelegrams < 1u) ||
+                   (gNoOfTelegrams > UT_MAX_TELEGRAMS))
+               {
+                   usage(argv[0]);
+                   exit(1);
+               }
+               break;
+           case 'c':
+               if ((sscanf(optarg, "%u", &cycle) < 1) || (cycle < 1000u))
+               {
+                   usage(argv[0]);
+                   exit(1);
+               }
+               break;
+           case 't':
+               if ((sscanf(optarg, "%u", &duration) < 1) || (duration < 1u))
+               {
+                   usage(argv[0]);
+                   exit(1);
+               }
+               break;
+           case 'b':
+               if ((sscanf(optarg, "%u", &noOfBuffers) < 1) || (noOfBuffers < 1u))
+               {
+                   usage(argv[0]);
+                   exit(1);
+               }
+               break;
+           case 's':
+               useSockets = TRUE;
+               break;
+           case 'd':
+               gVerbose = TRUE;
+               break;
+           case 'h':
+           case '?':
+           default:
+               printf("%s: Version %s\t(%s - %s)\n", argv[0], APP_VERSION, __DATE__, __TIME__);
+               usage(argv[0]);
+               return 1;
+        }
+    }
+
+    if (tlc_init(&dbgOut, NULL, NULL) != TRDP_NO_ERR)
+    {
+        fprintf(stderr, "Initialization error\n");
+        return 1;
+    }
+
+    processConfig.cycleTime = cycle;
+    err = tlc_openSession(&gAppHandle, ownIP, 0u, NULL, &pdConfig, NULL, &processConfig);
+    for (i = 0u; (i < gNoOfTelegrams) && (err == TRDP_NO_ERR); i++)
+    {
+        memset(data, (int) i, sizeof(data));
+        err = tlp_subscribe(gAppHandle, &gSubHandle[i], NULL, NULL,
+                            0u, UT_COMID + i,
+                            0u, 0u,
+                            0u, 0u,
+                            0u,
+                            TRDP_FLAGS_CALLBACK | TRDP_FLAGS_FORCE_CB,
+                            NULL,
+                            10000000u, TRDP_TO_KEEP_LAST_VALUE);
+        if (err == TRDP_NO_ERR)
+        {
+            err = tlp_publish(gAppHandle, &gPubHandle[i],
+                              NULL, NULL,
+                              0u, UT_COMID + i,
+                              0u, 0u,
+                              0u, ownIP,
+                              cycle,
+                              0u,
+                              TRDP_FLAGS_NONE,
+                              NULL,
+                              data, UT_DATA_SIZE);
+        }
+    }
+    if (err == TRDP_NO_ERR)
+    {
+        err = tlc_updateSession(gAppHandle);
+    }
+    if (err != TRDP_NO_ERR)
+    {
+        vos_printLogStr(VOS_LOG_USR, "Initialization error\n");
+        tlc_terminate();
+        return 1;
+    }
+    if ((useSockets == FALSE) && (tlp_enableUring(gAppHandle, noOfBuffers) != TRDP_NO_ERR))
+    {
+        vos_printLogStr(VOS_LOG_USR, "io_uring not available (URING_SUPPORT=1 and Linux 6.0 needed)\n");
+        tlc_terminate();
+        return 1;
+    }
+
+    vos_printLogStr(VOS_LOG_USR, "-----------------------------------------------\n");
+    vos_printLog(VOS_LOG_USR, "Own IP address            :   %s\n", vos_ipDotted(ownIP));
+    vos_printLog(VOS_LOG_USR, "Telegrams                 :   %u every %uus with %s\n", gNoOfTelegrams, cycle,
+                 (useSockets == TRUE) ? "the sockets" : "io_uring");
+    vos_printLogStr(VOS_LOG_USR, "-----------------------------------------------\n");
+
+    vos_getTime(&end);
+    nextSend = end;
+    end.tv_sec += (long) duration;
+    tick.tv_sec     = (long) (cycle / 1000000u);
+    tick.tv_usec    = (long) (cycle % 1000000u);
+
+    /*
+        Enter the main processing loop, send every cycle (also for HIGH_PERF_INDEXED)
+     */
+    do
+    {
+        TRDP_FDS_T  rfds;
+        INT32       noDesc  = 0;
+        TRDP_TIME_T interval;
+        TRDP_TIME_T tv      = nextSend;
+        INT32       rv;
+
+        vos_getTime(&now);
+        if (vos_cmpTime(&now, &nextSend) >= 0)
+        {
+            (void) tlp_processSend(gAppHandle);
+            vos_addTime(&nextSend, &tick);
+            tv = nextSend;
+            cycles++;
+        }
+        if (vos_cmpTime(&tv, &now) > 0)
+        {
+            vos_subTime(&tv, &now);
+        }
+        else
+        {
+            vos_clearTime(&tv);
+        }
+
+        FD_ZERO(&rfds);
+        (void) tlp_getInterval(gAppHandle, &interval, &rfds, &noDesc);
+        rv = vos_select(noDesc + 1, &rfds, NULL, NULL, &tv);
+        (void) tlp_processReceive(gAppHandle, &rfds, &rv);
+        vos_getTime(&now);
+    }
+    while (vos_cmpTime(&now, &end) < 0);
+
+    expected = gNoOfTelegrams * ((duration * 1000000u) / cycle) * UT_MIN_RECEIVED / 100u;
+
+    vos_printLogStr(VOS_LOG_USR, "-----------------------------------------------\n");
+    vos_printLog(VOS_LOG_USR, "Received                  :   %u (gaps %u) in %u cycles\n", gReceived, gSeqGaps, cycles);
+    if (useSockets == FALSE)
+    {
+        memset(&uringStats, 0, sizeof(uringStats));
+        (void) tlp_getUringStatistics(gAppHandle, &uringStats);
+        vos_printLog(VOS_LOG_USR, "io_uring received         :   %u (invalid %u)\n", uringStats.numRx,
+                     uringStats.numRxInvalid);
+        vos_printLog(VOS_LOG_USR, "io_uring sent             :   %u (failed %u)\n", uringStats.numTx,
+                     uringStats.numTxErr);
+        vos_printLog(VOS_LOG_USR, "Receives armed            :   %u (%u out of buffers)\n", uringStats.numArmed,
+                     uringStats.numNoBuf);
+        vos_printLog(VOS_LOG_USR, "io_uring_enter() per cycle:   %u.%02u\n", uringStats.numEnter / cycles,
+                     (uringStats.numEnter % cycles) * 100u / cycles);
+    }
+    vos_printLogStr(VOS_LOG_USR, "-----------------------------------------------\n");
+
+    if ((gReceived < expected) ||
+        ((useSockets == FALSE) && ((uringStats.numRx < gReceived) || (uringStats.numTx < gReceived))))
+    {
+        vos_printLog(VOS_LOG_USR, "FAILED: less than %u telegrams received\n", expected);
+        rc = 1;
+    }
+    else
+    {
+        vos_printLogStr(VOS_LOG_USR, "PASSED\n");
+    }
+
+    (void) tlp_enableUring(gAppHandle, 0u);
+    (void) tlc_closeSession(gAppHandle);
+    (void) tlc_terminate();
+    return rc;
+}
@@ -0,0 +1,445 @@
+/**********************************************************************************************************************/
+/**
+ * @file            trdp-pd-xdp-test.c
+ *
+ * @brief           PD over an AF_XDP socket on a veth pair
+ *
+ * @details         Opens two sessions, one on each end of a veth pair. The second session receives and sends its PD
+ *                  with an AF_XDP socket (tlp_enableXdp), the first one with the standard sockets. Both publish a
+ *                  number of cyclic multicast telegrams the other one subscribes to. Reported are the receptions in
+ *                  each direction and the statistics of the AF_XDP socket.
+ *                  Needs root (or CAP_NET_ADMIN, CAP_NET_RAW and CAP_BPF), a build with XDP_SUPPORT=1 and the veth
+ *                  pair:
+ *
+ *                      ip link add trdp0 type veth peer name trdp1
+ *                      ip addr add 10.64.0.1/24 dev trdp0
+ *                      ip addr add 10.64.0.2/24 dev trdp1
+ *                      ip link set trdp0 up
+ *                      ip link set trdp1 up
+ *                      sysctl net.ipv4.conf.all.rp_filter=0 net.ipv4.conf.trdp0.rp_filter=0
+ *                      sysctl net.ipv4.conf.trdp1.rp_filter=0
+ *
+ * @note            Project: TCNOpen TRDP prototype stack
+ *
+ * @author          agent
+ *
+ * @remarks This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0.
+ *          If a copy of the MPL was not distributed with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ *          Copyright agent, 2026. All rights reserved.
+ *
+ * $Id$
+ *
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#if defined (POSIX)
+#include <unistd.h>
+#endif
+
+#include "trdp_if_light.h"
+#include "vos_thread.h"
+#include "vos_utils.h"
+
+/***********************************************************************************************************************
+ * DEFINITIONS
+ */
+#define APP_VERSION         "1.0"
+
+#define XT_COMID_TO_XDP     7200u           /* published by the socket session, received with AF_XDP    */
+#define XT_COMID_FROM_XDP   7400u           /* published with AF_XDP, received by the socket session    */
+#define XT_DATA_SIZE        64u
+#define XT_DEFAULT_CYCLE    10000u          /* 10ms                             */
+#define XT_DEFAULT_TIME     3u              /* test duration in s               */
+#define XT_DEFAULT_TELEGRAMS 20u
+#define XT_MAX_TELEGRAMS    100u
+#define XT_MIN_RECEIVED     90u             /* percentage of the cycles to pass */
+
+typedef struct
+{
+    const char          *pIfName;
+    TRDP_IP_ADDR_T      ownIP;
+    TRDP_IP_ADDR_T      mcGroup;            /* published to         */
+    UINT32              comIdBase;          /* published comIds     */
+    TRDP_APP_SESSION_T  appHandle;
+    TRDP_PUB_T          pubHandle[XT_MAX_TELEGRAMS];
+    TRDP_SUB_T          subHandle[XT_MAX_TELEGRAMS];
+    UINT32              received;
+    UINT32              lastSeqCnt[XT_MAX_TELEGRAMS];
+    UINT32              seqGaps;
+} XT_SESSION_T;
+
+/***********************************************************************************************************************
+ * GLOBALS
+ */
+static XT_SESSION_T gSession[2] =
+{
+    {"trdp0", 0x0A400001u, 0xEF400001u, XT_COMID_TO_XDP},
+    {"trdp1", 0x0A400002u, 0xEF400002u, XT_COMID_FROM_XDP}
+};
+static UINT32       gNoOfTelegrams  = XT_DEFAULT_TELEGRAMS;
+static BOOL8        gVerbose        = FALSE;
+
+/***********************************************************************************************************************
+ * PROTOTYPES
+ */
+static void dbgOut (void *, TRDP_LOG_T, const CHAR8 *, const CHAR8 *, UINT16, const CHAR8 *);
+static void usage (const char *);
+static void pdCallback (void *, TRDP_APP_SESSION_T, const TRDP_PD_INFO_T *, UINT8 *, UINT32);
+static TRDP_ERR_T openSession (XT_SESSION_T *, UINT32, const XT_SESSION_T *);
+
+/**********************************************************************************************************************/
+/** callback routine for TRDP logging/error output
+ *
+ *  @param[in]      pRefCon          user supplied context pointer
+ *  @param[in]      category         Log category (Error, Warning, Info etc.)
+ *  @param[in]      pTime            pointer to NULL-terminated string of time stamp
+ *  @param[in]      pFile            pointer to NULL-terminated string of source module
+ *  @param[in]      lineNumber       line
+ *  @param[in]      pMsgStr          pointer to NULL-terminated string
+ *  @retval         none
+ */
+static void dbgOut (
+    void        *pRefCon,
+    TRDP_LOG_T  category,
+    const CHAR8 *pTime,
+    const CHAR8 *pFile,
+    UINT16      lineNumber,
+    const CHAR8 *pMsgStr)
+{
+    const char *catStr[] = {"**Error:", "Warning:", "   Info:", "  Debug:", "   User:"};
+
+    if (((category != VOS_LOG_DBG) && (category != VOS_LOG_INFO)) || (gVerbose == TRUE))
+    {
+        printf("%s %s %s:%d %s",
+               strrchr(pTime, '-') + 1,
+               catStr[category],
+               strrchr(pFile, VOS_DIR_SEP) + 1,
+               lineNumber,
+               pMsgStr);
+    }
+}
+
+/**********************************************************************************************************************/
+/* Print a sensible usage message */
+static void usage (const char *appName)
+{
+    printf("Usage of %s\n", appName);
+    printf("This tool exchanges cyclic multicast telegrams between the ends of a veth pair, one end sends and\n"
+           "receives with an AF_XDP socket. See the source for the setup of the veth pair.\n"
+           "Arguments are:\n"
+           "-a <interface with sockets> (default %s)\n"
+           "-b <interface with AF_XDP> (default %s)\n"
+           "-n <number of telegrams per direction> (default %u, max. %u)\n"
+           "-c <cycle time in us> (default %u)\n"
+           "-t <duration in s> (default %u)\n"
+           "-z try zero copy\n"
+           "-d verbose output\n"
+           "-h print usage\n",
+           gSession[0].pIfName, gSession[1].pIfName,
+           XT_DEFAULT_TELEGRAMS, XT_MAX_TELEGRAMS, XT_DEFAULT_CYCLE, XT_DEFAULT_TIME);
+}
+
+/**********************************************************************************************************************/
+/** PD callback: count the receptions and gaps of the sequence counters
+ *
+ *  @param[in]      pRefCon         user supplied context pointer
+ *  @param[in]      appHandle       session
+ *  @param[in]      pMsg            message info
+ *  @param[in]      pData           received data
+ *  @param[in]      dataSize        size of the data
+ */
+static void pdCallback (
+    void                    *pRefCon,
+    TRDP_APP_SESSION_T      appHandle,
+    const TRDP_PD_INFO_T    *pMsg,
+    UINT8                   *pData,
+    UINT32                  dataSize)
+{
+    XT_SESSION_T    *pSession = (XT_SESSION_T *) pRefCon;
+    UINT32          idx;
+
+    if ((pSession == NULL) || (pMsg->resultCode != TRDP_NO_ERR))
+    {
+        return;
+    }
+    idx = (UINT32) (pMsg->comId - ((pSession == &gSession[0]) ? XT_COMID_FROM_XDP : XT_COMID_TO_XDP));
+    if ((idx >= gNoOfTelegrams) || (dataSize != XT_DATA_SIZE) || (pData[0] != (UINT8) idx))
+    {
+        vos_printLog(VOS_LOG_USR, "unexpected telegram comId %u, size %u\n", pMsg->comId, dataSize);
+        return;
+    }
+    if ((pSession->lastSeqCnt[idx] != 0u) && (pMsg->seqCount != pSession->lastSeqCnt[idx] + 1u))
+    {
+        pSession->seqGaps++;
+    }
+    pSession->lastSeqCnt[idx] = pMsg->seqCount;
+    pSession->received++;
+}
+
+/**********************************************************************************************************************/
+/** Open a session, publish its telegrams and subscribe to the ones of the peer
+ *
+ *  @param[in]      pSession        session to open
+ *  @param[in]      cycle           cycle time in us
+ *  @param[in]      pPeer           peer session
+ *  @retval         TRDP_NO_ERR     no error
+ */
+static TRDP_ERR_T openSession (
+    XT_SESSION_T        *pSession,
+    UINT32              cycle,
+    const XT_SESSION_T  *pPeer)
+{
+    TRDP_PROCESS_CONFIG_T   processConfig   = {"XdpTest", "", cycle, 0u,
+                                               TRDP_OPTION_NO_PD_STATS | TRDP_OPTION_NO_MC_LOOP_BACK};
+    TRDP_PD_CONFIG_T        pdConfig        = {pdCallback, NULL, TRDP_PD_DEFAULT_SEND_PARAM, TRDP_FLAGS_CALLBACK,
+                                               10000000u, TRDP_TO_KEEP_LAST_VALUE, TRDP_PD_UDP_PORT};
+    UINT8                   data[XT_DATA_SIZE];
+    TRDP_ERR_T              err;
+    UINT32                  i;
+
+    pdConfig.pRefCon = pSession;
+    err = tlc_openSession(&pSession->appHandle, pSession->ownIP, 0u, NULL, &pdConfig, NULL, &processConfig);
+    for (i = 0u; (i < gNoOfTelegrams) && (err == TRDP_NO_ERR); i++)
+    {
+        memset(data, (int) i, sizeof(data));
+        err = tlp_subscribe(pSession->appHandle, &pSession->subHandle[i], NULL, NULL,
+                            0u, pPeer->comIdBase + i,
+                            0u, 0u,
+                            0u, 0u,
+                            pPeer->mcGroup,
+                            TRDP_FLAGS_CALLBACK | TRDP_FLAGS_FORCE_CB,
+                            NULL,
+                            10000000u, TRDP_TO_KEEP_LAST_VALUE);
+        if (err == TRDP_NO_ERR)
+        {
+            err = tlp_publish(pSession->appHandle, &pSession->pubHandle[i],
+                              NULL, NULL,
+                              0u, pSession->comIdBase + i,
+                              0u, 0u,
+                              0u, pSession->mcGroup,
+                              cycle,
+                              0u,
+                              TRDP_FLAGS_NONE,
+                              NULL,
+                              data, XT_DATA_SIZE);
+        }
+    }
+    if (err == TRDP_NO_ERR)
+    {
+        err = tlc_updateSession(pSession->appHandle);
+    }
+    return err;
+}
+
+/**********************************************************************************************************************/
+/** main entry
+ *
+ *  @retval         0        no error
+ *  @retval         1        some error
+ */
+int main (int argc, char *argv[])
+{
+    TRDP_XDP_STATISTICS_T   xdpStats;
+    UINT32                  cycle       = XT_DEFAULT_CYCLE;
+    UINT32                  duration    = XT_DEFAULT_TIME;
+    BOOL8                   zeroCopy    = FALSE;
+    UINT32                  expected;
+    TRDP_TIME_T             end;
+    TRDP_TIME_T             now;
+    TRDP_TIME_T             nextSend;
+    TRDP_TIME_T             tick;
+    int                     ch;
+    int                     rc          = 0;
+    UINT32                  i;
+
+    while ((ch = getopt(argc, argv, "a:b:n:c:t:zdh?")) != -1)
+    {
+        switch (ch)
+        {
+           case 'a':
+               gSession[0].pIfName = optarg;
+               break;
+           case 'b':
+               gSession[1].pIfName = optarg;
+               break;
+           case 'n':
+               if ((sscanf(optarg, "%u", &gNoOfTelegrams) < 1) || (gNoOfTelegrams < 1u) ||
+                   (gNoOfTelegrams > XT_MAX_TELEGRAMS))
+               {
+                   usage(argv[0]);
+                   exit(1);
+               }
+               break;
+           case 'c':
+               if ((sscanf(optarg, "%u", &cycle) < 1) || (cycle < 1000u))
+               {
+                   usage(argv[0]);
+                   exit(1);
+               }
+               break;
+           case 't':
+               if ((sscanf(optarg, "%u", &duration) < 1) || (duration < 1u))
+               {
+                   usage(argv[0]);
+                   exit(1);
+               }
+               break;
+           case 'z':
+               zeroCopy = TRUE;
+               break;
+           case 'd':
+               gVerbose = TRUE;
+               break;
+           case 'h':
+           case '?':
+           default:
+               printf("%s: Version %s\t(%s - %s)\n", argv[0], APP_VERSION, __DATE__, __TIME__);
+               usage(argv[0]);
+               return 1;
+        }
+    }
+
+    if (tlc_init(&dbgOut, NULL, NULL) != TRDP_NO_ERR)
+    {
+        fprintf(stderr, "Initialization error\n");
+        return 1;
+    }
+
+    /*  The interface addresses are the own IP addresses of the sessions  */
+    for (i = 0u; i < 2u; i++)
+    {
+        VOS_IF_REC_T    ifAddrs[VOS_MAX_NUM_IF];
+        UINT32          noOfIf  = VOS_MAX_NUM_IF;
+        UINT32          j;
+
+        if (vos_getInterfaces(&noOfIf, ifAddrs) == VOS_NO_ERR)
+        {
+            for (j = 0u; j < noOfIf; j++)
+            {
+                if (strcmp(ifAddrs[j].name, gSession[i].pIfName) == 0)
+                {
+                    gSession[i].ownIP = ifAddrs[j].ipAddr;
+                }
+            }
+        }
+    }
+
+    if ((openSession(&gSession[0], cycle, &gSession[1]) != TRDP_NO_ERR) ||
+        (openSession(&gSession[1], cycle, &gSession[0]) != TRDP_NO_ERR))
+    {
+        vos_printLogStr(VOS_LOG_USR, "Initialization error\n");
+        tlc_terminate();
+        return 1;
+    }
+    if (tlp_enableXdp(gSession[1].appHandle, gSession[1].pIfName, 0u, zeroCopy) != TRDP_NO_ERR)
+    {
+        vos_printLog(VOS_LOG_USR, "AF_XDP socket on %s not available (root, XDP_SUPPORT=1 and a veth pair needed)\n",
+                     gSession[1].pIfName);
+        tlc_terminate();
+        return 1;
+    }
+
+    vos_printLogStr(VOS_LOG_USR, "-----------------------------------------------\n");
+    vos_printLog(VOS_LOG_USR, "Sockets                   :   %s (%s)\n", gSession[0].pIfName,
+                 vos_ipDotted(gSession[0].ownIP));
+    vos_printLog(VOS_LOG_USR, "AF_XDP                    :   %s (%s)\n", gSession[1].pIfName,
+                 vos_ipDotted(gSession[1].ownIP));
+    vos_printLog(VOS_LOG_USR, "Telegrams per direction   :   %u every %uus\n", gNoOfTelegrams, cycle);
+    vos_printLogStr(VOS_LOG_USR, "-----------------------------------------------\n");
+
+    vos_getTime(&end);
+    nextSend = end;
+    end.tv_sec += (long) duration;
+    tick.tv_sec     = (long) (cycle / 1000000u);
+    tick.tv_usec    = (long) (cycle % 1000000u);
+
+    /*
+        Enter the main processing loop of both sessions, send every cycle (also for HIGH_PERF_INDEXED)
+     */
+    do
+    {
+        TRDP_FDS_T  rfds;
+        INT32       noDesc  = 0;
+        TRDP_TIME_T tv      = nextSend;
+        INT32       rv;
+
+        vos_getTime(&now);
+        if (vos_cmpTime(&now, &nextSend) >= 0)
+        {
+            for (i = 0u; i < 2u; i++)
+            {
+                (void) tlp_processSend(gSession[i].appHandle);
+            }
+            vos_addTime(&nextSend, &tick);
+            tv = nextSend;
+        }
+        if (vos_cmpTime(&tv, &now) > 0)
+        {
+            vos_subTime(&tv, &now);
+        }
+        else
+        {
+            vos_clearTime(&tv);
+        }
+
+        FD_ZERO(&rfds);
+        for (i = 0u; i < 2u; i++)
+        {
+            TRDP_TIME_T interval;
+            INT32       n = 0;
+
+            (void) tlp_getInterval(gSession[i].appHandle, &interval, &rfds, &n);
+            if (n > noDesc)
+            {
+                noDesc = n;
+            }
+        }
+        rv = vos_select(noDesc + 1, &rfds, NULL, NULL, &tv);
+        for (i = 0u; i < 2u; i++)
+        {
+            INT32 count = rv;
+
+            (void) tlp_processReceive(gSession[i].appHandle, &rfds, &count);
+        }
+        vos_getTime(&now);
+    }
+    while (vos_cmpTime(&now, &end) < 0);
+
+    (void) tlp_getXdpStatistics(gSession[1].appHandle, &xdpStats);
+
+    /*  The first cycles are lost until the multicast groups are joined    */
+    expected = gNoOfTelegrams * ((duration * 1000000u) / cycle) * XT_MIN_RECEIVED / 100u;
+
+    vos_printLogStr(VOS_LOG_USR, "-----------------------------------------------\n");
+    vos_printLog(VOS_LOG_USR, "Received with AF_XDP      :   %u (gaps %u)\n", gSession[1].received, gSession[1].seqGaps);
+    vos_printLog(VOS_LOG_USR, "Sent with AF_XDP          :   %u (received %u, gaps %u)\n", xdpStats.numTx,
+                 gSession[0].received, gSession[0].seqGaps);
+    vos_printLog(VOS_LOG_USR, "AF_XDP frames received    :   %u (invalid %u)\n", xdpStats.numRx,
+                 xdpStats.numRxInvalid);
+    vos_printLog(VOS_LOG_USR, "AF_XDP sent with socket   :   %u (no frame), %u (MAC unknown)\n",
+                 xdpStats.numTxNoFrame, xdpStats.numTxNoNeigh);
+    vos_printLog(VOS_LOG_USR, "Mode                      :   %s, XDP %s\n",
+                 (xdpStats.zeroCopy == TRUE) ? "zero copy" : "copy",
+                 (xdpStats.nativeXdp == TRUE) ? "native" : "generic");
+    vos_printLogStr(VOS_LOG_USR, "-----------------------------------------------\n");
+
+    if ((gSession[1].received < expected) || (gSession[0].received < expected) ||
+        (xdpStats.numRx < gSession[1].received) || (xdpStats.numTx < gSession[0].received))
+    {
+        vos_printLog(VOS_LOG_USR, "FAILED: less than %u telegrams received per direction\n", expected);
+        rc = 1;
+    }
+    else
+    {
+        vos_printLogStr(VOS_LOG_USR, "PASSED\n");
+    }
+
+    (void) tlp_enableXdp(gSession[1].appHandle, NULL, 0u, FALSE);
+    (void) tlc_closeSession(gSession[1].appHandle);
+    (void) tlc_closeSession(gSession[0].appHandle);
+    (void) tlc_terminate();
+    return rc;
+}
@@ -0,0 +1,322 @@
+/**********************************************************************************************************************/
+/**
+ * @file            trdp-xml-codegen-bench.c
+ *
+ * @brief           Benchmark of generated marshalling code against tau_marshall
+ *
+ * @details         Uses the header generated by trdp-xml-codegen from test/xml/nestedDS.xml. For each dataset the
+ *                  results of the generated functions are checked against tau_marshallDs / tau_unmarshallDs and
+ *                  the time per call of both is reported. The ComId dispatchers are checked the same way against
+ *                  tau_marshall / tau_unmarshall.
+ *
+ * @note            Project: TCNOpen TRDP prototype stack
+ *
+ * @author          agent
+ *
+ * @remarks This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0.
+ *          If a copy of the MPL was not distributed with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ *          Copyright agent, 2026. All rights reserved.
+ *
+ * $Id$
+ *
+ */
+
+#include <stdio.h>
+#include <string.h>
+#include <stdlib.h>
+
+#include "tau_xml.h"
+#include "tau_marshall.h"
+#include "vos_utils.h"
+#include "nestedDS_gen.h"
+
+/***********************************************************************************************************************
+ * DEFINITIONS
+ */
+#define APP_VERSION         "1.0"
+
+#define BENCH_DEFAULT_FILE  "test/xml/nestedDS.xml"
+#define BENCH_DEFAULT_LOOPS 1000000u
+#define BENCH_BUFFER_SIZE   1024u
+
+typedef void (*BENCH_MARSHALL_T)(const void *pSrc, UINT8 *pDst);
+typedef void (*BENCH_UNMARSHALL_T)(const UINT8 *pSrc, void *pDst);
+
+/** One dataset under test  */
+typedef struct
+{
+    UINT32              dsId;
+    UINT32              hostSize;
+    UINT32              wireSize;
+    BENCH_MARSHALL_T    pfMarshall;
+    BENCH_UNMARSHALL_T  pfUnmarshall;
+} BENCH_DS_T;
+
+/*  Adapters with a common signature, the generated functions are inlined into them   */
+static void marshall2002 (const void *pSrc, UINT8 *pDst)   { nestedDS_marshallDs2002((const NESTEDDS_DS2002_T *) pSrc, pDst); }
+static void marshall2003 (const void *pSrc, UINT8 *pDst)   { nestedDS_marshallDs2003((const NESTEDDS_DS2003_T *) pSrc, pDst); }
+static void marshall2004 (const void *pSrc, UINT8 *pDst)   { nestedDS_marshallDs2004((const NESTEDDS_DS2004_T *) pSrc, pDst); }
+static void unmarshall2002 (const UINT8 *pSrc, void *pDst) { nestedDS_unmarshallDs2002(pSrc, (NESTEDDS_DS2002_T *) pDst); }
+static void unmarshall2003 (const UINT8 *pSrc, void *pDst) { nestedDS_unmarshallDs2003(pSrc, (NESTEDDS_DS2003_T *) pDst); }
+static void unmarshall2004 (const UINT8 *pSrc, void *pDst) { nestedDS_unmarshallDs2004(pSrc, (NESTEDDS_DS2004_T *) pDst); }
+
+static const BENCH_DS_T cDatasets[] =
+{
+    {2002u, sizeof(NESTEDDS_DS2002_T), NESTEDDS_DS2002_WIRE_SIZE, marshall2002, unmarshall2002},
+    {2003u, sizeof(NESTEDDS_DS2003_T), NESTEDDS_DS2003_WIRE_SIZE, marshall2003, unmarshall2003},
+    {2004u, sizeof(NESTEDDS_DS2004_T), NESTEDDS_DS2004_WIRE_SIZE, marshall2004, unmarshall2004}
+};
+
+/***********************************************************************************************************************
+ * GLOBALS
+ */
+static volatile UINT32 gSink;               /* keeps the optimizer from dropping the loops  */
+
+/**********************************************************************************************************************/
+/** Microseconds elapsed since a start time
+ *
+ *  @param[in]      pStart          start time
+ *
+ *  @retval         elapsed time in us
+ */
+static UINT32 elapsed (
+    const VOS_TIMEVAL_T *pStart)
+{
+    VOS_TIMEVAL_T now;
+
+    vos_getTime(&now);
+    vos_subTime(&now, pStart);
+    return (UINT32) now.tv_sec * 1000000u + (UINT32) now.tv_usec;
+}
+
+/**********************************************************************************************************************/
+/** Check and time one dataset
+ *
+ *  @param[in]      pRefCon         marshalling context
+ *  @param[in]      pDs             dataset under test
+ *  @param[in]      loops           iterations
+ *
+ *  @retval         0 ok, 1 results differ
+ */
+static int benchDataset (
+    void                *pRefCon,
+    const BENCH_DS_T    *pDs,
+    UINT32              loops)
+{
+    UINT8           host[BENCH_BUFFER_SIZE];
+    UINT8           hostTau[BENCH_BUFFER_SIZE];
+    UINT8           hostGen[BENCH_BUFFER_SIZE];
+    UINT8           wireTau[BENCH_BUFFER_SIZE];
+    UINT8           wireGen[BENCH_BUFFER_SIZE];
+    UINT32          size;
+    UINT32          i;
+    UINT32          tTau[2], tGen[2];
+    TRDP_DATASET_T  *pCachedDS = NULL;
+    VOS_TIMEVAL_T   start;
+
+    for (i = 0u; i < pDs->hostSize; i++)
+    {
+        host[i] = (UINT8) (i * 37u + 11u);
+    }
+    memset(hostTau, 0, sizeof(hostTau));
+    memset(hostGen, 0, sizeof(hostGen));
+
+    /*  Same results?   */
+    size = sizeof(wireTau);
+    if ((tau_marshallDs(pRefCon, pDs->dsId, host, pDs->hostSize, wireTau, &size, &pCachedDS) != TRDP_NO_ERR) ||
+        (size != pDs->wireSize))
+    {
+        printf("dataset %u: tau_marshallDs failed or size %u differs from %u\n", pDs->dsId, size, pDs->wireSize);
+        return 1;
+    }
+    pDs->pfMarshall(host, wireGen);
+    if (memcmp(wireTau, wireGen, pDs->wireSize) != 0)
+    {
+        printf("dataset %u: marshalled data differs\n", pDs->dsId);
+        return 1;
+    }
+    size = sizeof(hostTau);
+    pCachedDS = NULL;
+    if ((tau_unmarshallDs(pRefCon, pDs->dsId, wireTau, pDs->wireSize, hostTau, &size, &pCachedDS) != TRDP_NO_ERR) ||
+        (size != pDs->hostSize))
+    {
+        printf("dataset %u: tau_unmarshallDs failed or size %u differs from %u\n", pDs->dsId, size, pDs->hostSize);
+        return 1;
+    }
+    pDs->pfUnmarshall(wireGen, hostGen);
+    if (memcmp(hostTau, hostGen, pDs->hostSize) != 0)
+    {
+        printf("dataset %u: unmarshalled data differs\n", pDs->dsId);
+        return 1;
+    }
+
+    /*  Timing  */
+    vos_getTime(&start);
+    for (i = 0u; i < loops; i++)
+    {
+        size = sizeof(wireTau);
+        host[0] = (UINT8) i;
+        (void) tau_marshallDs(pRefCon, pDs->dsId, host, pDs->hostSize, wireTau, &size, &pCachedDS);
+        gSink += wireTau[0];
+    }
+    tTau[0] = elapsed(&start);
+
+    vos_getTime(&start);
+    for (i = 0u; i < loops; i++)
+    {
+        host[0] = (UINT8) i;
+        pDs->pfMarshall(host, wireGen);
+        gSink += wireGen[0];
+    }
+    tGen[0] = elapsed(&start);
+
+    vos_getTime(&start);
+    for (i = 0u; i < loops; i++)
+    {
+        size = sizeof(hostTau);
+        wireTau[0] = (UINT8) i;
+        (void) tau_unmarshallDs(pRefCon, pDs->dsId, wireTau, pDs->wireSize, hostTau, &size, &pCachedDS);
+        gSink += hostTau[0];
+    }
+    tTau[1] = elapsed(&start);
+
+    vos_getTime(&start);
+    for (i = 0u; i < loops; i++)
+    {
+        wireGen[0] = (UINT8) i;
+        pDs->pfUnmarshall(wireGen, hostGen);
+        gSink += hostGen[0];
+    }
+    tGen[1] = elapsed(&start);
+
+    printf("dataset %u (%3u bytes):   marshall %8.1f ns / %8.1f ns   unmarshall %8.1f ns / %8.1f ns\n",
+           pDs->dsId, pDs->wireSize,
+           1000.0 * tTau[0] / loops, 1000.0 * tGen[0] / loops,
+           1000.0 * tTau[1] / loops, 1000.0 * tGen[1] / loops);
+    return 0;
+}
+
+/**********************************************************************************************************************/
+/** Check and time the ComId dispatchers
+ *
+ *  @param[in]      pRefCon         marshalling context
+ *  @param[in]      comId           ComId to use
+ *  @param[in]      loops           iterations
+ *
+ *  @retval         0 ok, 1 results differ
+ */
+static int benchComId (
+    void    *pRefCon,
+    UINT32  comId,
+    UINT32  loops)
+{
+    UINT8           host[BENCH_BUFFER_SIZE];
+    UINT8           wireTau[BENCH_BUFFER_SIZE];
+    UINT8           wireGen[BENCH_BUFFER_SIZE];
+    UINT32          sizeTau = sizeof(wireTau);
+    UINT32          sizeGen = sizeof(wireGen);
+    UINT32          i;
+    UINT32          tTau, tGen;
+    TRDP_DATASET_T  *pCachedDS = NULL;
+    VOS_TIMEVAL_T   start;
+
+    for (i = 0u; i < sizeof(host); i++)
+    {
+        host[i] = (UINT8) (i * 13u + 5u);
+    }
+
+    if ((tau_marshall(pRefCon, comId, host, sizeof(NESTEDDS_DS2004_T), wireTau, &sizeTau, &pCachedDS) != TRDP_NO_ERR) ||
+        (nestedDS_marshall(pRefCon, comId, host, sizeof(NESTEDDS_DS2004_T), wireGen, &sizeGen, NULL) != TRDP_NO_ERR) ||
+        (sizeTau != sizeGen) || (memcmp(wireTau, wireGen, sizeTau) != 0))
+    {
+        printf("comId %u: marshalled data differs\n", comId);
+        return 1;
+    }
+
+    vos_getTime(&start);
+    for (i = 0u; i < loops; i++)
+    {
+        sizeTau = sizeof(wireTau);
+        host[0] = (UINT8) i;
+        (void) tau_marshall(pRefCon, comId, host, sizeof(NESTEDDS_DS2004_T), wireTau, &sizeTau, &pCachedDS);
+        gSink += wireTau[0];
+    }
+    tTau = elapsed(&start);
+
+    vos_getTime(&start);
+    for (i = 0u; i < loops; i++)
+    {
+        sizeGen = sizeof(wireGen);
+        host[0] = (UINT8) i;
+        (void) nestedDS_marshall(pRefCon, comId, host, sizeof(NESTEDDS_DS2004_T), wireGen, &sizeGen, NULL);
+        gSink += wireGen[0];
+    }
+    tGen = elapsed(&start);
+
+    printf("comId %u via pfCbMarshall:  %8.1f ns / %8.1f ns\n", comId, 1000.0 * tTau / loops, 1000.0 * tGen / loops);
+    return 0;
+}
+
+/**********************************************************************************************************************/
+/** main entry
+ *
+ *  @retval         0        no error
+ *  @retval         1        some error
+ */
+int main (int argc, char *argv[])
+{
+    TRDP_XML_DOC_HANDLE_T   docHandle;
+    TRDP_COMID_DSID_MAP_T   *pComIdDsIdMap  = NULL;
+    UINT32                  numComId        = 0u;
+    apTRDP_DATASET_T        apDataset       = NULL;
+    UINT32                  numDataset      = 0u;
+    const char              *pFileName      = BENCH_DEFAULT_FILE;
+    UINT32                  loops           = BENCH_DEFAULT_LOOPS;
+    void                    *pRefCon        = NULL;
+    UINT32                  i;
+    int                     failed = 0;
+
+    if ((argc > 3) || ((argc > 1) && (argv[1][0] == '-')))
+    {
+        printf("%s: Version %s\t(%s - %s)\n", argv[0], APP_VERSION, __DATE__, __TIME__);
+        printf("Usage: %s [<XML file> (default %s) [<loops> (default %u)]]\n", argv[0], BENCH_DEFAULT_FILE,
+               BENCH_DEFAULT_LOOPS);
+        return 1;
+    }
+    if (argc > 1)
+    {
+        pFileName = argv[1];
+    }
+    if ((argc > 2) && ((sscanf(argv[2], "%u", &loops) < 1) || (loops == 0u)))
+    {
+        printf("Invalid number of loops\n");
+        return 1;
+    }
+
+    if ((tau_prepareXmlDoc(pFileName, &docHandle) != TRDP_NO_ERR) ||
+        (tau_readXmlDatasetConfig(&docHandle, &numComId, &pComIdDsIdMap, &numDataset, &apDataset) != TRDP_NO_ERR) ||
+        (tau_initMarshall(&pRefCon, numComId, pComIdDsIdMap, numDataset, apDataset) != TRDP_NO_ERR))
+    {
+        printf("Failed to read the datasets of %s\n", pFileName);
+        return 1;
+    }
+
+    printf("%u loops, times are tau_marshall (interpreted) / generated\n", loops);
+    for (i = 0u; i < sizeof(cDatasets) / sizeof(cDatasets[0]); i++)
+    {
+        failed |= benchDataset(pRefCon, &cDatasets[i], loops);
+    }
+    for (i = 0u; i < numComId; i++)
+    {
+        if (pComIdDsIdMap[i].datasetId == 2004u)
+        {
+            failed |= benchComId(pRefCon, pComIdDsIdMap[i].comId, loops);
+        }
+    }
+
+    tau_freeXmlDatasetConfig(numComId, pComIdDsIdMap, numDataset, apDataset);
+    tau_freeXmlDoc(&docHandle);
+
+    printf("%s\n", (failed == 0) ? "generated code matches tau_marshall" : "generated code FAILED");
+    return failed;
+}
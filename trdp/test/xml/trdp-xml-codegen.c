@@ -0,0 +1,760 @@
+/**********************************************************************************************************************/
+/**
+ * @file            trdp-xml-codegen.c
+ *
+ * @brief           Code generator for typed datasets
+ *
+ * @details         Reads the dataset and ComId definitions of a TRDP XML configuration file and writes a C header
+ *                  containing for each dataset
+ *                   - a host struct (layout as expected by tau_marshall / tau_unmarshall),
+ *                   - its marshalled size and the offsets of its elements as compile-time constants,
+ *                   - straight-line marshalling and unmarshalling functions,
+ *                  and marshall/unmarshall functions per ComId which can be registered as pfCbMarshall and
+ *                  pfCbUnmarshall in TRDP_MARSHALL_CONFIG_T. ComIds of datasets with variable sized elements, and
+ *                  unknown ComIds, are passed on to tau_marshall / tau_unmarshall.
+ *
+ * @note            Project: TCNOpen TRDP prototype stack
+ *
+ * @author          agent
+ *
+ * @remarks This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0.
+ *          If a copy of the MPL was not distributed with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ *          Copyright agent, 2026. All rights reserved.
+ *
+ * $Id$
+ *
+ */
+
+#include <stdio.h>
+#include <string.h>
+#include <stdlib.h>
+#include <ctype.h>
+
+#include "tau_xml.h"
+
+/***********************************************************************************************************************
+ * DEFINITIONS
+ */
+#define APP_VERSION     "1.0"
+
+#define CG_MAX_NAME     64u                 /* max. length of generated identifiers (without prefix)  */
+#define CG_MAX_LEVEL    5u                  /* max. nesting of datasets, as in tau_marshall           */
+
+/** Generator state of a dataset    */
+typedef struct
+{
+    TRDP_DATASET_T  *pDataset;              /* the dataset definition                                 */
+    UINT32          wireSize;               /* marshalled size, 0 if it depends on the data           */
+    BOOL8           emitted;                /* code already written                                   */
+} CG_DS_T;
+
+/***********************************************************************************************************************
+ * GLOBALS
+ */
+static CG_DS_T      *gDs        = NULL;
+static UINT32       gNumDs      = 0u;
+static CHAR8        gPrefix[CG_MAX_NAME];   /* prefix of functions                                    */
+static CHAR8        gPrefixUp[CG_MAX_NAME]; /* prefix of types and macros                             */
+
+/**********************************************************************************************************************/
+/* Print a sensible usage message */
+static void usage (const char *appName)
+{
+    printf("Usage of %s\n", appName);
+    printf("Generates typed dataset structs and marshalling functions from a TRDP XML configuration.\n"
+           "Arguments are:\n"
+           "<XML configuration file> <output header> [<prefix>]\n"
+           "The prefix of the generated identifiers defaults to the name of the output header.\n");
+}
+
+/**********************************************************************************************************************/
+/** Find a dataset by its id
+ *
+ *  @param[in]      id              dataset id
+ *
+ *  @retval         generator state of the dataset or NULL
+ */
+static CG_DS_T *findDs (
+    UINT32 id)
+{
+    UINT32 i;
+
+    for (i = 0u; i < gNumDs; i++)
+    {
+        if (gDs[i].pDataset->id == id)
+        {
+            return &gDs[i];
+        }
+    }
+    return NULL;
+}
+
+/**********************************************************************************************************************/
+/** Marshalled size of one item of a basic type
+ *
+ *  @param[in]      type            element type
+ *
+ *  @retval         size in bytes, 0 for nested datasets
+ */
+static UINT32 typeWireSize (
+    UINT32 type)
+{
+    switch (type)
+    {
+        case TRDP_BITSET8:
+        case TRDP_CHAR8:
+        case TRDP_INT8:
+        case TRDP_UINT8:
+            return 1u;
+        case TRDP_UTF16:
+        case TRDP_INT16:
+        case TRDP_UINT16:
+            return 2u;
+        case TRDP_INT32:
+        case TRDP_UINT32:
+        case TRDP_REAL32:
+        case TRDP_TIMEDATE32:
+            return 4u;
+        case TRDP_TIMEDATE48:
+            return 6u;
+        case TRDP_INT64:
+        case TRDP_UINT64:
+        case TRDP_REAL64:
+        case TRDP_TIMEDATE64:
+            return 8u;
+        default:
+            return 0u;
+    }
+}
+
+/**********************************************************************************************************************/
+/** C type of a basic type in the host struct
+ *
+ *  @param[in]      type            element type
+ *
+ *  @retval         type name
+ */
+static const char *typeName (
+    UINT32 type)
+{
+    switch (type)
+    {
+        case TRDP_BITSET8:      return "BOOL8";
+        case TRDP_CHAR8:        return "CHAR8";
+        case TRDP_UTF16:        return "UTF16";
+        case TRDP_INT8:         return "INT8";
+        case TRDP_INT16:        return "INT16";
+        case TRDP_INT32:        return "INT32";
+        case TRDP_INT64:        return "INT64";
+        case TRDP_UINT8:        return "UINT8";
+        case TRDP_UINT16:       return "UINT16";
+        case TRDP_UINT32:       return "UINT32";
+        case TRDP_UINT64:       return "UINT64";
+        case TRDP_REAL32:       return "REAL32";
+        case TRDP_REAL64:       return "REAL64";
+        case TRDP_TIMEDATE32:   return "TIMEDATE32";
+        case TRDP_TIMEDATE48:   return "TIMEDATE48";
+        case TRDP_TIMEDATE64:   return "TIMEDATE64";
+        default:                return NULL;
+    }
+}
+
+/**********************************************************************************************************************/
+/** Determine the marshalled size of a dataset
+ *
+ *  @param[in]      pDs             generator state of the dataset
+ *  @param[in]      level           nesting level
+ *
+ *  @retval         size in bytes, 0 if it depends on the data or a nested dataset is unknown
+ */
+static UINT32 dsWireSize (
+    CG_DS_T *pDs,
+    UINT32  level)
+{
+    UINT32  size = 0u;
+    UINT32  itemSize;
+    UINT16  i;
+
+    if (level >= CG_MAX_LEVEL)
+    {
+        return 0u;
+    }
+    for (i = 0u; i < pDs->pDataset->numElement; i++)
+    {
+        TRDP_DATASET_ELEMENT_T *pEl = &pDs->pDataset->pElement[i];
+
+        if (pEl->size == TRDP_VAR_SIZE)
+        {
+            return 0u;
+        }
+        if (pEl->type <= TRDP_TIMEDATE64)
+        {
+            itemSize = typeWireSize(pEl->type);
+        }
+        else
+        {
+            CG_DS_T *pNested = findDs(pEl->type);
+
+            itemSize = (pNested == NULL) ? 0u : dsWireSize(pNested, level + 1u);
+        }
+        if (itemSize == 0u)
+        {
+            return 0u;
+        }
+        size += itemSize * pEl->size;
+    }
+    return size;
+}
+
+/**********************************************************************************************************************/
+/** C identifier of a dataset element
+ *
+ *  @param[in]      pDataset        the dataset
+ *  @param[in]      index           element index
+ *  @param[in]      upper           upper case (for macros)
+ *  @param[out]     pName           buffer of CG_MAX_NAME characters
+ */
+static void elementName (
+    const TRDP_DATASET_T    *pDataset,
+    UINT16                  index,
+    BOOL8                   upper,
+    CHAR8                   *pName)
+{
+    const CHAR8 *pSrc = pDataset->pElement[index].name;
+    UINT32      len     = 0u;
+    UINT16      i;
+
+    if ((pSrc == NULL) || (*pSrc == '\0'))
+    {
+        (void) snprintf(pName, CG_MAX_NAME, "e%u", index);
+    }
+    else
+    {
+        if (isdigit((unsigned char) *pSrc))
+        {
+            pName[len++] = 'e';
+        }
+        for (; (*pSrc != '\0') && (len < CG_MAX_NAME - 8u); pSrc++)
+        {
+            pName[len++] = (isalnum((unsigned char) *pSrc)) ? *pSrc : '_';
+        }
+        pName[len] = '\0';
+
+        /*  Names must be unique within the struct  */
+        for (i = 0u; i < index; i++)
+        {
+            if ((pDataset->pElement[i].name != NULL) &&
+                (strcmp(pDataset->pElement[i].name, pDataset->pElement[index].name) == 0))
+            {
+                (void) snprintf(&pName[len], CG_MAX_NAME - len, "_%u", index);
+                break;
+            }
+        }
+    }
+    if (upper == TRUE)
+    {
+        for (len = 0u; pName[len] != '\0'; len++)
+        {
+            pName[len] = (CHAR8) toupper((unsigned char) pName[len]);
+        }
+    }
+}
+
+/**********************************************************************************************************************/
+/** Write the byte order helpers
+ *
+ *  @param[in]      pOut            output file
+ */
+static void emitHelpers (
+    FILE *pOut)
+{
+    static const struct
+    {
+        const char  *type;
+        UINT32      bits;
+    } sizes[] = {{"UINT16", 16u}, {"UINT32", 32u}, {"UINT64", 64u}};
+    UINT32 i, shift;
+
+    fprintf(pOut, "/*  Network byte order access, compilers map these to byte swapping loads and stores  */\n");
+    for (i = 0u; i < sizeof(sizes) / sizeof(sizes[0]); i++)
+    {
+        fprintf(pOut, "static INLINE void %s_put%u (UINT8 *pDst, %s val)\n{\n", gPrefix, sizes[i].bits, sizes[i].type);
+        for (shift = sizes[i].bits; shift > 0u; shift -= 8u)
+        {
+            fprintf(pOut, "    pDst[%u] = (UINT8) (val >> %uu);\n", (sizes[i].bits - shift) / 8u, shift - 8u);
+        }
+        fprintf(pOut, "}\n\n");
+        fprintf(pOut, "static INLINE %s %s_get%u (const UINT8 *pSrc)\n{\n    return (%s) (", sizes[i].type, gPrefix,
+                sizes[i].bits, sizes[i].type);
+        for (shift = sizes[i].bits; shift > 0u; shift -= 8u)
+        {
+            fprintf(pOut, "%s((%s) pSrc[%u] << %uu)", (shift == sizes[i].bits) ? "" : " |\n                   ",
+                    sizes[i].type, (sizes[i].bits - shift) / 8u, shift - 8u);
+        }
+        fprintf(pOut, ");\n}\n\n");
+    }
+}
+
+/**********************************************************************************************************************/
+/** Write the statement(s) converting one item
+ *
+ *  @param[in]      pOut            output file
+ *  @param[in]      marshall        TRUE: host to network, FALSE: network to host
+ *  @param[in]      type            element type
+ *  @param[in]      pHost           host side lvalue
+ *  @param[in]      pWire           wire side offset expression
+ *  @param[in]      pIndent         indentation
+ */
+static void emitItem (
+    FILE        *pOut,
+    BOOL8       marshall,
+    UINT32      type,
+    const char  *pHost,
+    const char  *pWire,
+    const char  *pIndent)
+{
+    switch (type)
+    {
+        case TRDP_BITSET8:
+        case TRDP_CHAR8:
+        case TRDP_INT8:
+        case TRDP_UINT8:
+            if (marshall == TRUE)
+            {
+                fprintf(pOut, "%spDst[%s] = (UINT8) %s;\n", pIndent, pWire, pHost);
+            }
+            else
+            {
+                fprintf(pOut, "%s%s = (%s) pSrc[%s];\n", pIndent, pHost, typeName(type), pWire);
+            }
+            break;
+        case TRDP_UTF16:
+        case TRDP_INT16:
+        case TRDP_UINT16:
+        case TRDP_INT32:
+        case TRDP_UINT32:
+        case TRDP_TIMEDATE32:
+        case TRDP_INT64:
+        case TRDP_UINT64:
+        {
+            UINT32 bits = 8u * typeWireSize(type);
+
+            if (marshall == TRUE)
+            {
+                fprintf(pOut, "%s%s_put%u(&pDst[%s], (UINT%u) %s);\n", pIndent, gPrefix, bits, pWire, bits, pHost);
+            }
+            else
+            {
+                fprintf(pOut, "%s%s = (%s) %s_get%u(&pSrc[%s]);\n", pIndent, pHost, typeName(type), gPrefix, bits,
+                        pWire);
+            }
+            break;
+        }
+        case TRDP_REAL32:
+        case TRDP_REAL64:
+        {
+            UINT32 bits = 8u * typeWireSize(type);
+
+            /*  Bit copies, the optimizer removes the memcpy   */
+            if (marshall == TRUE)
+            {
+                fprintf(pOut, "%s{\n%s    UINT%u raw;\n%s    memcpy(&raw, &%s, sizeof(raw));\n"
+                        "%s    %s_put%u(&pDst[%s], raw);\n%s}\n",
+                        pIndent, pIndent, bits, pIndent, pHost, pIndent, gPrefix, bits, pWire, pIndent);
+            }
+            else
+            {
+                fprintf(pOut, "%s{\n%s    UINT%u raw = %s_get%u(&pSrc[%s]);\n%s    memcpy(&%s, &raw, sizeof(raw));\n%s}\n",
+                        pIndent, pIndent, bits, gPrefix, bits, pWire, pIndent, pHost, pIndent);
+            }
+            break;
+        }
+        case TRDP_TIMEDATE48:
+            if (marshall == TRUE)
+            {
+                fprintf(pOut, "%s%s_put32(&pDst[%s], %s.sec);\n", pIndent, gPrefix, pWire, pHost);
+                fprintf(pOut, "%s%s_put16(&pDst[%s + 4u], %s.ticks);\n", pIndent, gPrefix, pWire, pHost);
+            }
+            else
+            {
+                fprintf(pOut, "%s%s.sec = %s_get32(&pSrc[%s]);\n", pIndent, pHost, gPrefix, pWire);
+                fprintf(pOut, "%s%s.ticks = %s_get16(&pSrc[%s + 4u]);\n", pIndent, pHost, gPrefix, pWire);
+            }
+            break;
+        case TRDP_TIMEDATE64:
+            if (marshall == TRUE)
+            {
+                fprintf(pOut, "%s%s_put32(&pDst[%s], %s.tv_sec);\n", pIndent, gPrefix, pWire, pHost);
+                fprintf(pOut, "%s%s_put32(&pDst[%s + 4u], (UINT32) %s.tv_usec);\n", pIndent, gPrefix, pWire, pHost);
+            }
+            else
+            {
+                fprintf(pOut, "%s%s.tv_sec = %s_get32(&pSrc[%s]);\n", pIndent, pHost, gPrefix, pWire);
+                fprintf(pOut, "%s%s.tv_usec = (INT32) %s_get32(&pSrc[%s + 4u]);\n", pIndent, pHost, gPrefix, pWire);
+            }
+            break;
+        default:
+            break;
+    }
+}
+
+/**********************************************************************************************************************/
+/** Write the marshalling or unmarshalling function of a dataset
+ *
+ *  @param[in]      pOut            output file
+ *  @param[in]      pDs             generator state of the dataset
+ *  @param[in]      marshall        TRUE: host to network, FALSE: network to host
+ */
+static void emitConversion (
+    FILE    *pOut,
+    CG_DS_T *pDs,
+    BOOL8   marshall)
+{
+    TRDP_DATASET_T  *pDataset   = pDs->pDataset;
+    UINT32          offset      = 0u;
+    BOOL8           needIndex   = FALSE;
+    CHAR8           name[CG_MAX_NAME];
+    CHAR8           host[2u * CG_MAX_NAME];
+    CHAR8           wire[2u * CG_MAX_NAME];
+    UINT16          i;
+
+    for (i = 0u; i < pDataset->numElement; i++)
+    {
+        if ((pDataset->pElement[i].size > 1u) && (typeWireSize(pDataset->pElement[i].type) != 1u))
+        {
+            needIndex = TRUE;
+        }
+    }
+
+    if (marshall == TRUE)
+    {
+        fprintf(pOut, "static INLINE void %s_marshallDs%u (\n    const %s_DS%u_T *pSrc,\n    UINT8 *pDst)\n{\n",
+                gPrefix, pDataset->id, gPrefixUp, pDataset->id);
+    }
+    else
+    {
+        fprintf(pOut, "static INLINE void %s_unmarshallDs%u (\n    const UINT8 *pSrc,\n    %s_DS%u_T *pDst)\n{\n",
+                gPrefix, pDataset->id, gPrefixUp, pDataset->id);
+    }
+    if (needIndex == TRUE)
+    {
+        fprintf(pOut, "    UINT32 i;\n\n");
+    }
+
+    for (i = 0u; i < pDataset->numElement; i++)
+    {
+        TRDP_DATASET_ELEMENT_T  *pEl        = &pDataset->pElement[i];
+        UINT32                  itemSize    = (pEl->type <= TRDP_TIMEDATE64) ?
+                                              typeWireSize(pEl->type) : findDs(pEl->type)->wireSize;
+
+        elementName(pDataset, i, FALSE, name);
+        if (pEl->size == 1u)
+        {
+            (void) snprintf(host, sizeof(host), "%s->%s", (marshall == TRUE) ? "pSrc" : "pDst", name);
+            (void) snprintf(wire, sizeof(wire), "%uu", offset);
+            if (pEl->type <= TRDP_TIMEDATE64)
+            {
+                emitItem(pOut, marshall, pEl->type, host, wire, "    ");
+            }
+            else if (marshall == TRUE)
+            {
+                fprintf(pOut, "    %s_marshallDs%u(&%s, &pDst[%s]);\n", gPrefix, pEl->type, host, wire);
+            }
+            else
+            {
+                fprintf(pOut, "    %s_unmarshallDs%u(&pSrc[%s], &%s);\n", gPrefix, pEl->type, wire, host);
+            }
+        }
+        else if (itemSize == 1u)
+        {
+            /*  Byte arrays are copied as a whole  */
+            if (marshall == TRUE)
+            {
+                fprintf(pOut, "    memcpy(&pDst[%uu], pSrc->%s, %uu);\n", offset, name, pEl->size);
+            }
+            else
+            {
+                fprintf(pOut, "    memcpy(pDst->%s, &pSrc[%uu], %uu);\n", name, offset, pEl->size);
+            }
+        }
+        else
+        {
+            /*  Constant trip count: unrolled / vectorized by the compiler   */
+            (void) snprintf(host, sizeof(host), "%s->%s[i]", (marshall == TRUE) ? "pSrc" : "pDst", name);
+            (void) snprintf(wire, sizeof(wire), "%uu + %uu * i", offset, itemSize);
+            fprintf(pOut, "    for (i = 0u; i < %uu; i++)\n    {\n", pEl->size);
+            if (pEl->type <= TRDP_TIMEDATE64)
+            {
+                emitItem(pOut, marshall, pEl->type, host, wire, "        ");
+            }
+            else if (marshall == TRUE)
+            {
+                fprintf(pOut, "        %s_marshallDs%u(&%s, &pDst[%s]);\n", gPrefix, pEl->type, host, wire);
+            }
+            else
+            {
+                fprintf(pOut, "        %s_unmarshallDs%u(&pSrc[%s], &%s);\n", gPrefix, pEl->type, wire, host);
+            }
+            fprintf(pOut, "    }\n");
+        }
+        offset += itemSize * pEl->size;
+    }
+    fprintf(pOut, "}\n\n");
+}
+
+/**********************************************************************************************************************/
+/** Write struct, constants and functions of a dataset, nested datasets first
+ *
+ *  @param[in]      pOut            output file
+ *  @param[in]      pDs             generator state of the dataset
+ */
+static void emitDataset (
+    FILE    *pOut,
+    CG_DS_T *pDs)
+{
+    TRDP_DATASET_T  *pDataset   = pDs->pDataset;
+    UINT32          offset      = 0u;
+    CHAR8           name[CG_MAX_NAME];
+    UINT16          i;
+
+    if ((pDs->emitted == TRUE) || (pDs->wireSize == 0u))
+    {
+        return;
+    }
+    pDs->emitted = TRUE;
+
+    for (i = 0u; i < pDataset->numElement; i++)
+    {
+        if (pDataset->pElement[i].type > TRDP_TIMEDATE64)
+        {
+            emitDataset(pOut, findDs(pDataset->pElement[i].type));
+        }
+    }
+
+    fprintf(pOut, "/**********************************************************************************************************************/\n");
+    fprintf(pOut, "/*  Dataset %u  */\n\n", pDataset->id);
+    fprintf(pOut, "typedef struct\n{\n");
+    for (i = 0u; i < pDataset->numElement; i++)
+    {
+        TRDP_DATASET_ELEMENT_T *pEl = &pDataset->pElement[i];
+        CHAR8 type[CG_MAX_NAME + 16u];
+
+        if (pEl->type <= TRDP_TIMEDATE64)
+        {
+            (void) snprintf(type, sizeof(type), "%s", typeName(pEl->type));
+        }
+        else
+        {
+            (void) snprintf(type, sizeof(type), "%s_DS%u_T", gPrefixUp, pEl->type);
+        }
+        elementName(pDataset, i, FALSE, name);
+        if (pEl->size == 1u)
+        {
+            fprintf(pOut, "    %-24s %s;\n", type, name);
+        }
+        else
+        {
+            fprintf(pOut, "    %-24s %s[%u];\n", type, name, pEl->size);
+        }
+    }
+    fprintf(pOut, "} %s_DS%u_T;\n\n", gPrefixUp, pDataset->id);
+
+    fprintf(pOut, "#define %s_DS%u_WIRE_SIZE %uu\n", gPrefixUp, pDataset->id, pDs->wireSize);
+    for (i = 0u; i < pDataset->numElement; i++)
+    {
+        TRDP_DATASET_ELEMENT_T *pEl = &pDataset->pElement[i];
+
+        elementName(pDataset, i, TRUE, name);
+        fprintf(pOut, "#define %s_DS%u_%s_OFFSET %uu\n", gPrefixUp, pDataset->id, name, offset);
+        offset += pEl->size * ((pEl->type <= TRDP_TIMEDATE64) ? typeWireSize(pEl->type) : findDs(pEl->type)->wireSize);
+    }
+    fprintf(pOut, "\n");
+
+    emitConversion(pOut, pDs, TRUE);
+    emitConversion(pOut, pDs, FALSE);
+}
+
+/**********************************************************************************************************************/
+/** Write the ComId dispatchers
+ *
+ *  @param[in]      pOut            output file
+ *  @param[in]      numComId        number of ComId mappings
+ *  @param[in]      pComIdDsIdMap   ComId mappings
+ */
+static void emitDispatchers (
+    FILE                        *pOut,
+    UINT32                      numComId,
+    const TRDP_COMID_DSID_MAP_T *pComIdDsIdMap)
+{
+    UINT32  i;
+    CG_DS_T *pDs;
+
+    fprintf(pOut, "/**********************************************************************************************************************/\n");
+    fprintf(pOut, "/*  Marshalling by ComId, to be registered as pfCbMarshall in TRDP_MARSHALL_CONFIG_T.\n"
+                  "    Other ComIds are passed on to tau_marshall(), pRefCon must be the one of tau_initMarshall(). */\n");
+    fprintf(pOut, "static INLINE TRDP_ERR_T %s_marshall (\n"
+                  "    void            *pRefCon,\n"
+                  "    UINT32          comId,\n"
+                  "    UINT8           *pSrc,\n"
+                  "    UINT32          srcSize,\n"
+                  "    UINT8           *pDst,\n"
+                  "    UINT32          *pDstSize,\n"
+                  "    TRDP_DATASET_T  * *ppCachedDS)\n{\n", gPrefix);
+    fprintf(pOut, "    if ((pSrc == NULL) || (pDst == NULL) || (pDstSize == NULL))\n    {\n"
+                  "        return TRDP_PARAM_ERR;\n    }\n    switch (comId)\n    {\n");
+    for (i = 0u; i < numComId; i++)
+    {
+        pDs = findDs(pComIdDsIdMap[i].datasetId);
+        if ((pDs == NULL) || (pDs->wireSize == 0u))
+        {
+            continue;
+        }
+        fprintf(pOut, "        case %uu:\n"
+                      "            if ((srcSize < sizeof(%s_DS%u_T)) || (*pDstSize < %s_DS%u_WIRE_SIZE))\n"
+                      "            {\n                return TRDP_PARAM_ERR;\n            }\n"
+                      "            %s_marshallDs%u((const %s_DS%u_T *) pSrc, pDst);\n"
+                      "            *pDstSize = %s_DS%u_WIRE_SIZE;\n"
+                      "            return TRDP_NO_ERR;\n",
+                pComIdDsIdMap[i].comId, gPrefixUp, pDs->pDataset->id, gPrefixUp, pDs->pDataset->id,
+                gPrefix, pDs->pDataset->id, gPrefixUp, pDs->pDataset->id, gPrefixUp, pDs->pDataset->id);
+    }
+    fprintf(pOut, "        default:\n"
+                  "            return tau_marshall(pRefCon, comId, pSrc, srcSize, pDst, pDstSize, ppCachedDS);\n"
+                  "    }\n}\n\n");
+
+    fprintf(pOut, "/*  Unmarshalling by ComId, to be registered as pfCbUnmarshall in TRDP_MARSHALL_CONFIG_T.\n"
+                  "    Other ComIds are passed on to tau_unmarshall(), pRefCon must be the one of tau_initMarshall(). */\n");
+    fprintf(pOut, "static INLINE TRDP_ERR_T %s_unmarshall (\n"
+                  "    void            *pRefCon,\n"
+                  "    UINT32          comId,\n"
+                  "    UINT8           *pSrc,\n"
+                  "    UINT32          srcSize,\n"
+                  "    UINT8           *pDst,\n"
+                  "    UINT32          *pDstSize,\n"
+                  "    TRDP_DATASET_T  * *ppCachedDS)\n{\n", gPrefix);
+    fprintf(pOut, "    if ((pSrc == NULL) || (pDst == NULL) || (pDstSize == NULL))\n    {\n"
+                  "        return TRDP_PARAM_ERR;\n    }\n    switch (comId)\n    {\n");
+    for (i = 0u; i < numComId; i++)
+    {
+        pDs = findDs(pComIdDsIdMap[i].datasetId);
+        if ((pDs == NULL) || (pDs->wireSize == 0u))
+        {
+            continue;
+        }
+        fprintf(pOut, "        case %uu:\n"
+                      "            if (srcSize < %s_DS%u_WIRE_SIZE)\n"
+                      "            {\n                return TRDP_MARSHALLING_ERR;\n            }\n"
+                      "            if (*pDstSize < sizeof(%s_DS%u_T))\n"
+                      "            {\n                return TRDP_PARAM_ERR;\n            }\n"
+                      "            %s_unmarshallDs%u(pSrc, (%s_DS%u_T *) pDst);\n"
+                      "            *pDstSize = sizeof(%s_DS%u_T);\n"
+                      "            return TRDP_NO_ERR;\n",
+                pComIdDsIdMap[i].comId, gPrefixUp, pDs->pDataset->id, gPrefixUp, pDs->pDataset->id,
+                gPrefix, pDs->pDataset->id, gPrefixUp, pDs->pDataset->id, gPrefixUp, pDs->pDataset->id);
+    }
+    fprintf(pOut, "        default:\n"
+                  "            return tau_unmarshall(pRefCon, comId, pSrc, srcSize, pDst, pDstSize, ppCachedDS);\n"
+                  "    }\n}\n\n");
+}
+
+/**********************************************************************************************************************/
+/** main entry
+ *
+ *  @retval         0        no error
+ *  @retval         1        some error
+ */
+int main (int argc, char *argv[])
+{
+    TRDP_XML_DOC_HANDLE_T   docHandle;
+    TRDP_COMID_DSID_MAP_T   *pComIdDsIdMap  = NULL;
+    UINT32                  numComId        = 0u;
+    apTRDP_DATASET_T        apDataset       = NULL;
+    UINT32                  numDataset      = 0u;
+    const char              *pBase;
+    FILE                    *pOut;
+    UINT32                  i, len;
+
+    if ((argc < 3) || (argc > 4))
+    {
+        printf("%s: Version %s\t(%s - %s)\n", argv[0], APP_VERSION, __DATE__, __TIME__);
+        usage(argv[0]);
+        return 1;
+    }
+
+    /*  Prefix: given or the base name of the output header    */
+    pBase = (argc == 4) ? argv[3] : argv[2];
+    if ((argc == 3) && (strrchr(pBase, '/') != NULL))
+    {
+        pBase = strrchr(pBase, '/') + 1;
+    }
+    for (len = 0u; (pBase[len] != '\0') && (pBase[len] != '.') && (len < CG_MAX_NAME - 1u); len++)
+    {
+        gPrefix[len]    = (isalnum((unsigned char) pBase[len])) ? pBase[len] : '_';
+        gPrefixUp[len]  = (CHAR8) toupper((unsigned char) gPrefix[len]);
+    }
+    if ((len == 0u) || isdigit((unsigned char) gPrefix[0]))
+    {
+        fprintf(stderr, "Invalid prefix '%s'\n", pBase);
+        return 1;
+    }
+
+    if (tau_prepareXmlDoc(argv[1], &docHandle) != TRDP_NO_ERR)
+    {
+        fprintf(stderr, "Failed to parse XML document %s\n", argv[1]);
+        return 1;
+    }
+    if (tau_readXmlDatasetConfig(&docHandle, &numComId, &pComIdDsIdMap, &numDataset, &apDataset) != TRDP_NO_ERR)
+    {
+        fprintf(stderr, "Failed to read the datasets of %s\n", argv[1]);
+        tau_freeXmlDoc(&docHandle);
+        return 1;
+    }
+
+    gNumDs  = numDataset;
+    gDs     = (CG_DS_T *) calloc((numDataset > 0u) ? numDataset : 1u, sizeof(CG_DS_T));
+    if (gDs == NULL)
+    {
+        fprintf(stderr, "Out of memory\n");
+        return 1;
+    }
+    for (i = 0u; i < numDataset; i++)
+    {
+        gDs[i].pDataset = apDataset[i];
+    }
+    for (i = 0u; i < numDataset; i++)
+    {
+        gDs[i].wireSize = dsWireSize(&gDs[i], 0u);
+        if (gDs[i].wireSize == 0u)
+        {
+            printf("Dataset %u has a variable size or unknown nested datasets, left to tau_marshall\n",
+                   gDs[i].pDataset->id);
+        }
+    }
+
+    pOut = fopen(argv[2], "w");
+    if (pOut == NULL)
+    {
+        fprintf(stderr, "Cannot write %s\n", argv[2]);
+        return 1;
+    }
+
+    fprintf(pOut, "/* Generated by trdp-xml-codegen from %s - do not edit */\n\n", argv[1]);
+    fprintf(pOut, "#ifndef %s_H\n#define %s_H\n\n", gPrefixUp, gPrefixUp);
+    fprintf(pOut, "#include <string.h>\n\n#include \"trdp_types.h\"\n#include \"tau_marshall.h\"\n\n");
+    fprintf(pOut, "#ifdef __cplusplus\nextern \"C\" {\n#endif\n\n");
+    emitHelpers(pOut);
+    for (i = 0u; i < numDataset; i++)
+    {
+        emitDataset(pOut, &gDs[i]);
+    }
+    emitDispatchers(pOut, numComId, pComIdDsIdMap);
+    fprintf(pOut, "#ifdef __cplusplus\n}\n#endif\n\n#endif\n");
+    (void) fclose(pOut);
+
+    printf("%u datasets, %u ComIds written to %s\n", numDataset, numComId, argv[2]);
+
+    free(gDs);
+    tau_freeXmlDatasetConfig(numComId, pComIdDsIdMap, numDataset, apDataset);
+    tau_freeXmlDoc(&docHandle);
+    return 0;
+}